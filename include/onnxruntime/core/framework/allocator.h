@@ -20,7 +20,9 @@ struct OrtArenaCfg {
                   initial_chunk_size_bytes(-1),
                   max_dead_bytes_per_chunk(-1),
                   initial_growth_chunk_size_bytes(-1),
-                  max_power_of_two_extend_bytes(-1) {}
+                  max_power_of_two_extend_bytes(-1),
+                  use_huge_pages(-1),
+                  free_region_idle_timeout_ms(-1) {}
   OrtArenaCfg(size_t max_mem, int arena_extend_strategy, int initial_chunk_size_bytes,
               int max_dead_bytes_per_chunk, int initial_growth_chunk_size_bytes,
               int64_t max_power_of_two_extend_bytes)
@@ -29,7 +31,9 @@ struct OrtArenaCfg {
         initial_chunk_size_bytes(initial_chunk_size_bytes),
         max_dead_bytes_per_chunk(max_dead_bytes_per_chunk),
         initial_growth_chunk_size_bytes(initial_growth_chunk_size_bytes),
-        max_power_of_two_extend_bytes(max_power_of_two_extend_bytes) {}
+        max_power_of_two_extend_bytes(max_power_of_two_extend_bytes),
+        use_huge_pages(-1),
+        free_region_idle_timeout_ms(-1) {}
 
   size_t max_mem;                         // use 0 to allow ORT to choose the default
   int arena_extend_strategy;              // use -1 to allow ORT to choose the default, 0 = kNextPowerOfTwo, 1 = kSameAsRequested
@@ -37,6 +41,11 @@ struct OrtArenaCfg {
   int max_dead_bytes_per_chunk;           // use -1 to allow ORT to choose the default
   int initial_growth_chunk_size_bytes;    // use -1 to allow ORT to choose the default
   int64_t max_power_of_two_extend_bytes;  // use -1 to allow ORT to choose the default
+  int use_huge_pages;                     // use 1 to back large CPU arena regions with huge pages,
+                                          // use -1 to allow ORT to choose the default (disabled)
+  int free_region_idle_timeout_ms;        // free arena regions idle for at least this many milliseconds
+                                          // are returned to the system; use -1 to allow ORT to choose
+                                          // the default (disabled; memory is only returned via shrinkage)
 };
 
 namespace onnxruntime {
@@ -267,7 +267,8 @@ class KernelDefBuilder {
 
   /**
      Specify that the output_index-th output can be strided tensor, and share the data
-     from input_index-th input.
+     from input_index-th input. An output_index of -1 matches any output, for kernels
+     with variadic outputs (e.g. Split) where the output count is not known up front.
    */
   KernelDefBuilder& MayStridedOutput(int input_index, int output_index);
 #endif
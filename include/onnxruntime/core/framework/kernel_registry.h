@@ -9,7 +9,9 @@
 
 namespace onnxruntime {
 
-using KernelCreateMap = std::multimap<std::string, KernelCreateInfo>;
+// The comparator is transparent so that lookups can be performed with a std::string_view key composed
+// in a stack buffer, avoiding a std::string allocation per query on the kernel resolution path.
+using KernelCreateMap = std::multimap<std::string, KernelCreateInfo, std::less<>>;
 using KernelDefHashes = std::vector<std::pair<std::string, HashValue>>;
 
 class IKernelTypeStrResolver;
@@ -138,6 +138,14 @@ class OpKernelContext {
    */
   [[nodiscard]] Status GetTempSpaceCPUAllocator(AllocatorPtr* output) const;
 
+  /**
+   Try to reserve transient workspace from the per-stream scratch buffer broker instead of
+   allocating it privately. The returned buffer is only valid for the duration of this kernel's
+   Compute call and must not be cached. A nullptr return means the request could not be brokered
+   and the caller should fall back to allocating through GetTempSpaceAllocator.
+   */
+  [[nodiscard]] virtual void* TryGetScratchBuffer(size_t size_in_bytes) const;
+
   /**
   Return the device id that current kernel runs on.
   */
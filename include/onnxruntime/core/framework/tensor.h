@@ -250,9 +250,22 @@ class Tensor final {
   }
 
   bool OwnsBuffer() const noexcept {
-    return buffer_deleter_ != nullptr;
+    return buffer_deleter_ != nullptr || UsesInlineBuffer();
   }
 
+  /// <summary>
+  /// True if the tensor data is stored in the inline buffer instead of allocator-provided
+  /// memory. Small CPU tensors created through the allocator-owning constructor (common in
+  /// shape-arithmetic chains such as Shape->Gather->Concat) are stored inline so they never
+  /// touch the allocator.
+  /// </summary>
+  bool UsesInlineBuffer() const noexcept {
+    return p_data_ == inline_buffer_;
+  }
+
+  /// Size in bytes of the inline small-tensor buffer.
+  static constexpr size_t kInlineBufferSize = 64;
+
   /**
    * Resizes the tensor without touching underlying storage.
    * This requires the total size of the tensor to remains constant.
@@ -349,6 +362,11 @@ class Tensor final {
   const PrimitiveDataTypeBase* dtype_;
   OrtMemoryInfo alloc_info_;
   ptrdiff_t byte_offset_;
+
+  // Storage for tensors of up to kInlineBufferSize bytes of plain (non-string) data on
+  // default CPU memory. When used, p_data_ points at this member and buffer_deleter_ is
+  // null; moves copy the bytes and re-point p_data_ at the destination's buffer.
+  alignas(16) unsigned char inline_buffer_[kInlineBufferSize];
 };
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
@@ -52,6 +52,10 @@ struct IndexedSubGraph;
 class Model;
 class OpSignature;
 
+namespace concurrency {
+class ThreadPool;
+}
+
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 class RuntimeOptimizationRecordContainer;
 #endif
@@ -464,6 +468,13 @@ class Node {
     execution_provider_type_ = execution_provider_type;
   }
 
+  /** Gets the execution ProviderType that was assigned to this node when the ORT format model was saved.
+  Empty unless this node was loaded from an ORT format model that recorded an assignment.
+  The ORT format model-specific graph partitioning may replay this assignment instead of recomputing it. */
+  ProviderType GetOrtFormatSavedExecutionProviderType() const noexcept {
+    return ort_format_saved_execution_provider_type_;
+  }
+
   /** Call the provided function for all explicit inputs, implicit inputs, and outputs of this Node.
       If the NodeArg is an explicit or implicit input, is_input will be true when func is called.
       @param include_missing_optional_defs Include NodeArgs that are optional and were not provided
@@ -662,6 +673,9 @@ class Node {
   // Device.
   std::string execution_provider_type_;
 
+  // The execution provider assignment saved in the ORT format model this node was loaded from, if any.
+  std::string ort_format_saved_execution_provider_type_;
+
   // Map from attribute name to attribute.
   // This allows attribute adding and removing.
   NodeAttributes attributes_;
@@ -1263,6 +1277,9 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
   /** Sets the type of a NodeArg, replacing existing type/shape if any */
   void SetNodeArgType(NodeArg& arg, const ONNX_NAMESPACE::TypeProto& type_proto);
 
+  // The producer/consumer lookups below are populated during Resolve and ORT format load and kept
+  // in sync by AddNode/RemoveNode. Code that rewires node inputs/outputs directly is still
+  // responsible for calling the Update/Add/Remove methods for the affected node args.
   const Node* GetProducerNode(const std::string& node_arg_name) const {
     return GetProducerNodeImpl(*this, node_arg_name);
   }
@@ -1332,6 +1349,10 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
     // Whether to set that no proto sync is required after resolving.
     // Useful for resolving right after loading from a GraphProto.
     bool no_proto_sync_required = false;
+    // Optional thread pool used to run type/shape inference concurrently for independent nodes
+    // of the same topological level. Inference remains single threaded when nullptr. Nodes with
+    // subgraphs are always processed serially as their inference recurses into the subgraph.
+    concurrency::ThreadPool* shape_inference_thread_pool = nullptr;
   };
 
   /**
@@ -1557,6 +1578,10 @@ class Graph {  // NOLINT(clang-analyzer-optin.performance.Padding): preserve exi
 
   common::Status InferAndVerifyTypeMatch(Node& node, const ONNX_NAMESPACE::OpSchema& op, const ResolveOptions& options);
 
+  // Performs type/shape inference for all nodes by topological level, running independent nodes of a level
+  // concurrently on options.shape_inference_thread_pool with a barrier between levels.
+  common::Status ParallelTypeAndShapeInference(const ResolveOptions& options);
+
   // perform type and shape inferencing on the subgraph and Resolve to validate
   static common::Status InferAndVerifySubgraphTypes(const Node& node, Graph& subgraph,
                                                     const std::vector<const ONNX_NAMESPACE::TypeProto*>& input_types,
@@ -3,6 +3,7 @@
 
 #pragma once
 #include <string>
+#include <vector>
 
 #include "core/common/common.h"
 #include "core/common/inlined_containers.h"
@@ -43,6 +44,12 @@ class GraphTransformer {
 
   virtual bool ShouldOnlyApplyOnce() const { return false; }
 
+  /** Gets the op types this transformer can possibly match. GraphTransformerManager uses this to skip
+  the transformer when none of the op types occur in the graph (including subgraphs). An empty vector
+  means the transformer must always be applied.
+  */
+  virtual std::vector<std::string> TargetOpTypes() const noexcept { return {}; }
+
  protected:
   /** Helper method to call ApplyImpl on any subgraphs in the Node. */
   Status Recurse(Node& node, bool& modified, int graph_level, const logging::Logger& logger) const {
@@ -44,12 +44,15 @@ std::unique_ptr<RuleBasedGraphTransformer> GenerateRuleBasedGraphTransformer(
     const InlinedHashSet<std::string_view>& compatible_execution_providers);
 
 /** Generates all predefined (both rule-based and non-rule-based) transformers for this level.
-    Any transformers or rewrite rules named in rules_and_transformers_to_disable will be excluded. */
+    Any transformers or rewrite rules named in rules_and_transformers_to_disable will be excluded.
+    If device_execution_provider is supplied, constant folding executes nodes with a kernel registered for
+    that provider on its device and only copies the folded results back to CPU memory. */
 InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
     TransformerLevel level,
     const SessionOptions& session_options,
     const IExecutionProvider& execution_provider /*required by constant folding*/,
-    const InlinedHashSet<std::string>& rules_and_transformers_to_disable = {});
+    const InlinedHashSet<std::string>& rules_and_transformers_to_disable = {},
+    IExecutionProvider* device_execution_provider = nullptr);
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
@@ -53,6 +53,11 @@ class RuleBasedGraphTransformer : public GraphTransformer {
   /** Returns the total number of rules that are registered in this transformer. */
   size_t RulesCount() const;
 
+  /** Returns the union of the target op types of the registered rules, so that GraphTransformerManager
+      can skip this transformer when no candidate nodes exist. If any rule triggers on all op types an
+      empty vector is returned and the transformer is always applied. */
+  std::vector<std::string> TargetOpTypes() const noexcept override;
+
  protected:
   /** Applies the given set of rewrite rules on the Node of this Graph.
       @param[in] graph The Graph.
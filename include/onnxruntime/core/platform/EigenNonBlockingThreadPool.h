@@ -39,7 +39,9 @@
 #pragma warning(disable : 4127)
 #pragma warning(disable : 4805)
 #endif
+#include <algorithm>
 #include <memory>
+#include <thread>
 #include "unsupported/Eigen/CXX11/ThreadPool"
 
 #if defined(__GNUC__)
@@ -222,6 +224,7 @@ class ThreadPoolProfiler {
   ThreadPoolProfiler(int, const CHAR_TYPE*){};
   ~ThreadPoolProfiler() = default;
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ThreadPoolProfiler);
+  bool Enabled() const { return false; }
   void Start(){};
   std::string Stop() { return "not available for minimal build"; }
   void LogStart(){};
@@ -229,8 +232,12 @@ class ThreadPoolProfiler {
   void LogEndAndStart(ThreadPoolEvent){};
   void LogStartAndCoreAndBlock(std::ptrdiff_t){};
   void LogCoreAndBlock(std::ptrdiff_t){};
+  void LogShards(unsigned){};
   void LogThreadId(int){};
   void LogRun(int){};
+  void LogSteal(int){};
+  void LogSpinTime(int, uint64_t){};
+  void LogQueueLatency(int, uint64_t){};
   std::string DumpChildThreadStat() { return {}; }
 };
 #else
@@ -248,6 +255,7 @@ class ThreadPoolProfiler {
   ~ThreadPoolProfiler();
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ThreadPoolProfiler);
   using Clock = std::chrono::high_resolution_clock;
+  bool Enabled() const { return enabled_; }
   void Start();                  // called by executor to start profiling
   std::string Stop();            // called by executor to stop profiling and return collected numbers
   void LogStart();               // called in main thread to record the starting time point
@@ -255,8 +263,12 @@ class ThreadPoolProfiler {
   void LogEndAndStart(ThreadPoolEvent);
   void LogStartAndCoreAndBlock(std::ptrdiff_t block_size);
   void LogCoreAndBlock(std::ptrdiff_t block_size);  // called in main thread to log core and block size for task breakdown
+  void LogShards(unsigned shards);                  // called in main thread to log the shard count of a parallel loop
   void LogThreadId(int thread_idx);                 // called in child thread to log its id
   void LogRun(int thread_idx);                      // called in child thread to log num of run
+  void LogSteal(int thread_idx);                    // called in child thread when it picked up a stolen task
+  void LogSpinTime(int thread_idx, uint64_t microseconds);      // called in child thread after a spin-wait for work
+  void LogQueueLatency(int thread_idx, uint64_t microseconds);  // called in child thread with enqueue-to-run latency
   std::string DumpChildThreadStat();                // return all child statitics collected so far
 
  private:
@@ -265,9 +277,11 @@ class ThreadPoolProfiler {
     uint64_t events_[MAX_EVENT] = {};
     int32_t core_ = -1;
     std::vector<std::ptrdiff_t> blocks_;  // block size determined by cost model
+    std::vector<unsigned> shards_;        // shard (degree of parallelism) count per parallel loop
     std::vector<onnxruntime::TimePoint> points_;
     void LogCore();
     void LogBlockSize(std::ptrdiff_t block_size);
+    void LogShards(unsigned shards);
     void LogStart();
     void LogEnd(ThreadPoolEvent);
     void LogEndAndStart(ThreadPoolEvent);
@@ -284,6 +298,10 @@ class ThreadPoolProfiler {
   struct ORT_ALIGN_TO_AVOID_FALSE_SHARING ChildThreadStat {
     std::thread::id thread_id_;
     uint64_t num_run_ = 0;
+    uint64_t num_steal_ = 0;          // tasks this thread picked up by stealing from another queue
+    uint64_t spin_time_us_ = 0;       // time spent spin-waiting for work before finding it or blocking
+    uint64_t queue_latency_us_ = 0;   // total enqueue-to-run latency of the tasks this thread ran
+    uint64_t num_latency_samples_ = 0;
     onnxruntime::TimePoint last_logged_point_ = Clock::now();
     int32_t core_ = -1;  // core that the child thread is running on
   };
@@ -307,6 +325,11 @@ class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
   virtual void StartParallelSection(ThreadPoolParallelSection& ps) = 0;
   virtual void EndParallelSection(ThreadPoolParallelSection& ps) = 0;
 
+  // Variant of Schedule() for dispatching a batch of independent tasks.
+  // Implementations may spread successive calls across distinct worker queues;
+  // the default simply forwards to Schedule().
+  virtual void ScheduleSpread(std::function<void()> fn) { Schedule(std::move(fn)); }
+
   // Run fn with up to n degree-of-parallelism enlisting the thread
   // pool for help.  The degree-of-parallelism includes the caller,
   // and so if n==1 then the function will run directly in the caller.
@@ -773,6 +796,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
         env_(env),
         num_threads_(num_threads),
         allow_spinning_(allow_spinning),
+        adaptive_spinning_(thread_options.adaptive_spinning),
         set_denormal_as_zero_(thread_options.set_denormal_as_zero),
         worker_data_(num_threads),
         all_coprimes_(num_threads),
@@ -831,6 +855,26 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     }
   }
 
+  // Run fn() as Schedule() does, but spread successive calls across distinct worker
+  // queues.  Schedule() picks the target queue at random, so a batch of independent
+  // tasks released by the same trigger (e.g. downstream continuations in the stream
+  // executor) can collide on one queue and run serially until another worker steals
+  // them.  Round-robin placement starts each task of a batch on its own worker and
+  // wakes that worker, letting the work-stealing queues balance from there.
+  void ScheduleSpread(std::function<void()> fn) override {
+    unsigned q_idx = next_spread_queue_.fetch_add(1, std::memory_order_relaxed) % num_threads_;
+    WorkerData& td = worker_data_[q_idx];
+    Queue& q = td.queue;
+    fn = q.PushBack(std::move(fn));
+    if (!fn) {
+      // The queue accepted the work; ensure that the thread will pick it up
+      td.EnsureAwake();
+    } else {
+      // Run the work directly if the queue rejected the work
+      fn();
+    }
+  }
+
   //......................................................................
   //
   // Parallel sections
@@ -866,6 +910,30 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     StartParallelSectionInternal(*pt, ps);
   }
 
+  // Wait at a parallel section join point.  By the time we get here the
+  // caller cannot help with the remaining work: pending tasks have been
+  // revoked, and what is left is running on other threads.  Spin briefly
+  // on the optimistic assumption that those threads are about to finish,
+  // then back off to yielding the processor.  On a dedicated machine the
+  // spin almost always succeeds; when several sessions share the machine
+  // the yield hands the core to another tenant's runnable thread instead
+  // of burning it until the join completes.
+  template <typename Pred>
+  static void WaitForJoin(Pred&& done) {
+    // Keep the spin phase in the order of the cost of a context switch so
+    // that we do not give up on fast joins that a yield would only delay.
+    constexpr int spin_count = 4000;
+    for (int i = 0; i < spin_count; i++) {
+      if (done()) {
+        return;
+      }
+      onnxruntime::concurrency::SpinPause();
+    }
+    while (!done()) {
+      std::this_thread::yield();
+    }
+  }
+
   // End a parallel section, waiting for all worker threads to exit from
   // section.  Hence, on return, the ThreadPoolParallelSection object
   // can be dealloacted.
@@ -908,9 +976,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     // finish dispatch work.  This avoids new tasks being started
     // concurrently with us attempting to end the parallel section.
     if (ps.dispatch_q_idx != -1) {
-      while (!ps.dispatch_done.load(std::memory_order_acquire)) {
-        onnxruntime::concurrency::SpinPause();
-      }
+      WaitForJoin([&ps]() { return ps.dispatch_done.load(std::memory_order_acquire); });
     }
 
     // Now we know that dispatch is finshed, we synchronize with the
@@ -931,16 +997,12 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
 
     // Wait for the dispatch task's own work...
     if (ps.dispatch_q_idx > -1) {
-      while (!ps.work_done.load(std::memory_order_acquire)) {
-        onnxruntime::concurrency::SpinPause();
-      }
+      WaitForJoin([&ps]() { return ps.work_done.load(std::memory_order_acquire); });
     }
 
     // ...and wait for any other tasks not revoked to finish their work
     auto tasks_to_wait_for = tasks_started - ps.tasks_revoked;
-    while (ps.tasks_finished < tasks_to_wait_for) {
-      onnxruntime::concurrency::SpinPause();
-    }
+    WaitForJoin([&ps, tasks_to_wait_for]() { return ps.tasks_finished >= tasks_to_wait_for; });
 
     // Clear status to allow the ThreadPoolParallelSection to be
     // re-used.
@@ -1100,7 +1162,15 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       unsigned w_idx;
 
       // Attempt to enqueue the task
-      auto push_status = q.PushBackWithTag([worker_fn, par_idx, &preferred_workers, &ps, this]() {
+      const bool log_latency = profiler_.Enabled();
+      onnxruntime::TimePoint enqueue_time = log_latency ? std::chrono::high_resolution_clock::now()
+                                                        : onnxruntime::TimePoint();
+      auto push_status = q.PushBackWithTag([worker_fn, par_idx, log_latency, enqueue_time, &preferred_workers, &ps, this]() {
+        if (log_latency) {
+          profiler_.LogQueueLatency(GetPerThread()->thread_id,
+                                    static_cast<uint64_t>(TimeDiffMicroSeconds(enqueue_time,
+                                                                               std::chrono::high_resolution_clock::now())));
+        }
         // Record the worker thread that actually runs this task.
         // This will form the preferred worker for the next loop.
         UpdatePreferredWorker(preferred_workers, par_idx);
@@ -1181,7 +1251,16 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
         assert(current_dop == 1);
 
         // Task for dispatching work asynchronously.
-        Task dispatch_task = [current_dop, new_dop, worker_fn, &preferred_workers, &ps, &pt, this]() {
+        const bool log_latency = profiler_.Enabled();
+        onnxruntime::TimePoint enqueue_time = log_latency ? std::chrono::high_resolution_clock::now()
+                                                          : onnxruntime::TimePoint();
+        Task dispatch_task = [current_dop, new_dop, worker_fn, log_latency, enqueue_time,
+                              &preferred_workers, &ps, &pt, this]() {
+          if (log_latency) {
+            profiler_.LogQueueLatency(GetPerThread()->thread_id,
+                                      static_cast<uint64_t>(TimeDiffMicroSeconds(enqueue_time,
+                                                                                 std::chrono::high_resolution_clock::now())));
+          }
           // Record that dispatch work has started.  This must occur
           // prior to scheduling tasks, in order to synchronize with
           // EndParallelSectionInternal.  [ If EndParallelSection
@@ -1243,6 +1322,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
                             std::ptrdiff_t block_size) override {
     ORT_ENFORCE(n <= num_threads_ + 1, "More work items than threads");
     profiler_.LogStartAndCoreAndBlock(block_size);
+    profiler_.LogShards(n);
     PerThread* pt = GetPerThread();
     assert(pt->leading_par_section && "RunInParallel, but not in parallel section");
     assert((n > 1) && "Trivial parallel section; should be avoided by caller");
@@ -1280,9 +1360,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
 
     // Wait for workers to exit the loop
     ps.current_loop = 0;
-    while (ps.workers_in_loop) {
-      onnxruntime::concurrency::SpinPause();
-    }
+    WaitForJoin([&ps]() { return ps.workers_in_loop == 0; });
     profiler_.LogEnd(ThreadPoolProfiler::WAIT);
   }
 
@@ -1301,6 +1379,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
   void RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, std::ptrdiff_t block_size) override {
     ORT_ENFORCE(n <= num_threads_ + 1, "More work items than threads");
     profiler_.LogStartAndCoreAndBlock(block_size);
+    profiler_.LogShards(n);
     PerThread* pt = GetPerThread();
     ThreadPoolParallelSection ps;
     StartParallelSectionInternal(*pt, ps);
@@ -1492,11 +1571,13 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
   Environment& env_;
   const unsigned num_threads_;
   const bool allow_spinning_;
+  const bool adaptive_spinning_;
   const bool set_denormal_as_zero_;
   Eigen::MaxSizeVector<WorkerData> worker_data_;
   Eigen::MaxSizeVector<Eigen::MaxSizeVector<unsigned>> all_coprimes_;
   std::atomic<unsigned> blocked_;  // Count of blocked workers, used as a termination condition
   std::atomic<bool> done_;
+  std::atomic<unsigned> next_spread_queue_{0};  // Next queue for round-robin placement in ScheduleSpread
 
   // SpinLoopStatus indicates whether the main worker spinning (inner) loop should exit immediately when there is
   // no work available (kIdle) or whether it should follow the configured spin-then-block policy (kBusy).
@@ -1533,8 +1614,16 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     assert(td.GetStatus() == WorkerData::ThreadStatus::Spinning);
 
     constexpr int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull << log2_spin) : 0;
-    const int steal_count = spin_count / 100;
+    const int max_spin_count = allow_spinning_ ? (1ull << log2_spin) : 0;
+
+    // With adaptive spinning, the budget for each spin phase follows the outcome of recent
+    // phases: it halves every time a phase expires without finding work and doubles, up to
+    // the maximum, when work arrives during the spin.  Workers of a session that is mostly
+    // idle therefore park after a short spin instead of burning a full budget of cycles that
+    // a co-located session could use, while workers kept busy retain the full spin and its
+    // low wake-up latency.
+    const int min_spin_count = std::max(max_spin_count >> 6, 1);
+    int spin_budget = max_spin_count;
 
     SetDenormalAsZero(set_denormal_as_zero_);
     profiler_.LogThreadId(thread_id);
@@ -1543,9 +1632,16 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       Task t = q.PopFront();
       if (!t) {
         // Spin waiting for work.
+        const int spin_count = adaptive_spinning_ ? spin_budget : max_spin_count;
+        const int steal_count = std::max(spin_count / 100, 1);
+        const bool log_spin = profiler_.Enabled();
+        onnxruntime::TimePoint spin_start = log_spin ? std::chrono::high_resolution_clock::now()
+                                                     : onnxruntime::TimePoint();
+        bool stolen = false;
         for (int i = 0; i < spin_count && !done_; i++) {
           if (((i + 1) % steal_count == 0)) {
             t = Steal(StealAttemptKind::TRY_ONE);
+            stolen = !!t;
           } else {
             t = q.PopFront();
           }
@@ -1556,6 +1652,19 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
           }
           onnxruntime::concurrency::SpinPause();
         }
+        if (log_spin) {
+          profiler_.LogSpinTime(thread_id,
+                                static_cast<uint64_t>(TimeDiffMicroSeconds(spin_start,
+                                                                           std::chrono::high_resolution_clock::now())));
+        }
+        if (stolen) {
+          profiler_.LogSteal(thread_id);
+        }
+
+        if (adaptive_spinning_ && max_spin_count > 0) {
+          spin_budget = t ? std::min(spin_budget * 2, max_spin_count)
+                          : std::max(spin_budget / 2, min_spin_count);
+        }
 
         // Attempt to block
         if (!t) {
@@ -1619,7 +1728,12 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
           // blocking, or are exiting, then either work was pushed to
           // us, or it was pushed to an overloaded queue
           if (!t) t = q.PopFront();
-          if (!t) t = Steal(StealAttemptKind::TRY_ALL);
+          if (!t) {
+            t = Steal(StealAttemptKind::TRY_ALL);
+            if (t) {
+              profiler_.LogSteal(thread_id);
+            }
+          }
         }
       }
 
@@ -16,6 +16,7 @@ limitations under the License.
 /* Modifications Copyright (c) Microsoft. */
 
 #pragma once
+#include <atomic>
 #include <string>
 #include <vector>
 #include <functional>
@@ -213,6 +214,55 @@ class ThreadPool {
     ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ParallelSection);
   };
 
+  // Scheduling priority applied to parallel loops.  Priorities allow
+  // latency-sensitive and batch work to share one pool: while a
+  // high-priority loop is running, low-priority loops stop handing
+  // iterations to worker threads at the next shard boundary and finish
+  // the remainder on the thread that started them, freeing the workers
+  // for the high-priority loop.  Normal-priority loops are unaffected.
+  enum class Priority {
+    kLow = 0,
+    kNormal = 1,
+    kHigh = 2,
+  };
+
+  // RAII scope that sets the priority applied to parallel loops started
+  // by the calling thread, restoring the previous priority on exit.
+  // The priority is tracked in thread-local state, so it covers loops
+  // started by operators executing on this thread but not loops started
+  // from other threads.
+  class PriorityScope {
+   public:
+    explicit PriorityScope(Priority priority);
+    ~PriorityScope();
+
+   private:
+    Priority previous_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PriorityScope);
+  };
+
+  // Return the priority applied to parallel loops started by the calling thread.
+  static Priority CurrentThreadPriority();
+
+  // RAII scope that caps the degree of parallelism reported for parallel
+  // loops started by the calling thread, restoring the previous cap on
+  // exit.  Sessions sharing one intra-op thread pool use this as a quota:
+  // while the scope is active each loop fans out to at most `cap` workers,
+  // leaving the remaining workers free for concurrent sessions.  A nested
+  // scope can lower the effective cap but not raise it.  Like the loop
+  // priority above, the cap is tracked in thread-local state, so it covers
+  // loops started by operators executing on this thread but not loops
+  // started from other threads.
+  class ParallelismCapScope {
+   public:
+    explicit ParallelismCapScope(int cap);
+    ~ParallelismCapScope();
+
+   private:
+    int previous_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ParallelismCapScope);
+  };
+
   // The below API allows to disable spinning
   // This is used to support real-time scenarios where
   // spinning between relatively infrequent requests
@@ -234,6 +284,18 @@ class ThreadPool {
     }
   }
 
+  // Schedules fn() as Schedule() does, but spreads a batch of independent tasks
+  // across distinct worker queues so the tasks start on separate threads instead
+  // of relying on work stealing to balance them.
+  static void ScheduleSpread(ThreadPool* tp,
+                             std::function<void()> fn) {
+    if (tp) {
+      tp->ScheduleSpread(fn);
+    } else {
+      fn();
+    }
+  }
+
   // ParallelFor shards the "total" units of work assuming each unit of work
   // having roughly "cost_per_unit" cost, in cycles. Each unit of work is
   // indexed 0, 1, ..., total - 1. Each shard contains 1 or more units of work
@@ -411,6 +473,8 @@ class ThreadPool {
 
   void Schedule(std::function<void()> fn);
 
+  void ScheduleSpread(std::function<void()> fn);
+
   void StartProfiling();
 
   std::string StopProfiling();
@@ -428,6 +492,17 @@ class ThreadPool {
 
   // Force the thread pool to run in hybrid mode on a normal cpu.
   bool force_hybrid_ = false;
+
+  // Number of high-priority loops currently running on this pool.  Low-priority
+  // loops poll this at shard boundaries and release their worker threads while
+  // it is non-zero.
+  std::atomic<int> high_priority_loops_{0};
+
+  // Measures cost-model driven parallel loops and learns, per loop signature, the degree of
+  // parallelism that actually runs fastest.  Allocated only when ThreadOptions::loop_tuning
+  // is set.
+  class LoopTuner;
+  std::unique_ptr<LoopTuner> loop_tuner_;
 };
 
 }  // namespace concurrency
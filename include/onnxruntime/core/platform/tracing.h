@@ -3,7 +3,64 @@
 
 #pragma once
 
+#if defined(_WIN32)
 #include <windows.h>
 #include <TraceLoggingProvider.h>
 
 TRACELOGGING_DECLARE_PROVIDER(telemetry_provider_handle);
+#endif
+
+// Tracepoints for hot paths such as kernel dispatch and arena allocation. When
+// ONNXRUNTIME_ENABLE_INSTRUMENT is defined these emit ETW events on Windows and USDT probes
+// (consumable via perf, SystemTap or bpftrace) on Linux, so system profilers can be attached to
+// live processes and runtime activity correlated with OS scheduling without the overhead of the
+// JSON profiler. Without the define they compile to nothing.
+#if defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && defined(_WIN32)
+
+#include <winmeta.h>
+
+#define ORT_TRACEPOINT_KERNEL_BEGIN(op_name, node_index)       \
+  TraceLoggingWrite(telemetry_provider_handle, "KernelBegin",  \
+                    TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE), \
+                    TraceLoggingString(op_name, "op_name"),    \
+                    TraceLoggingValue(node_index, "node_index"))
+
+#define ORT_TRACEPOINT_KERNEL_END(op_name, node_index)         \
+  TraceLoggingWrite(telemetry_provider_handle, "KernelEnd",    \
+                    TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE), \
+                    TraceLoggingString(op_name, "op_name"),    \
+                    TraceLoggingValue(node_index, "node_index"))
+
+#define ORT_TRACEPOINT_ARENA_ALLOC(allocator_name, num_bytes)        \
+  TraceLoggingWrite(telemetry_provider_handle, "ArenaAlloc",         \
+                    TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),       \
+                    TraceLoggingString(allocator_name, "allocator"), \
+                    TraceLoggingValue(num_bytes, "num_bytes"))
+
+#define ORT_TRACEPOINT_ARENA_FREE(allocator_name, ptr)               \
+  TraceLoggingWrite(telemetry_provider_handle, "ArenaFree",          \
+                    TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),       \
+                    TraceLoggingString(allocator_name, "allocator"), \
+                    TraceLoggingPointer(ptr, "ptr"))
+
+#elif defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && defined(__linux__) && __has_include(<sys/sdt.h>)
+
+#include <sys/sdt.h>
+
+#define ORT_TRACEPOINT_KERNEL_BEGIN(op_name, node_index) \
+  DTRACE_PROBE2(onnxruntime, kernel_begin, op_name, node_index)
+#define ORT_TRACEPOINT_KERNEL_END(op_name, node_index) \
+  DTRACE_PROBE2(onnxruntime, kernel_end, op_name, node_index)
+#define ORT_TRACEPOINT_ARENA_ALLOC(allocator_name, num_bytes) \
+  DTRACE_PROBE2(onnxruntime, arena_alloc, allocator_name, num_bytes)
+#define ORT_TRACEPOINT_ARENA_FREE(allocator_name, ptr) \
+  DTRACE_PROBE2(onnxruntime, arena_free, allocator_name, ptr)
+
+#else
+
+#define ORT_TRACEPOINT_KERNEL_BEGIN(op_name, node_index) static_cast<void>(0)
+#define ORT_TRACEPOINT_KERNEL_END(op_name, node_index) static_cast<void>(0)
+#define ORT_TRACEPOINT_ARENA_ALLOC(allocator_name, num_bytes) static_cast<void>(0)
+#define ORT_TRACEPOINT_ARENA_FREE(allocator_name, ptr) static_cast<void>(0)
+
+#endif
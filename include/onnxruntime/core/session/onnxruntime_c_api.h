@@ -281,6 +281,7 @@ ORT_RUNTIME_CLASS(Env);
 ORT_RUNTIME_CLASS(Status);  // nullptr for Status* indicates success
 ORT_RUNTIME_CLASS(MemoryInfo);
 ORT_RUNTIME_CLASS(IoBinding);
+ORT_RUNTIME_CLASS(PipelinedRun);
 ORT_RUNTIME_CLASS(Session);  // Don't call ReleaseSession from Dllmain (because session owns a thread pool)
 ORT_RUNTIME_CLASS(Value);
 ORT_RUNTIME_CLASS(RunOptions);
@@ -296,6 +297,7 @@ ORT_RUNTIME_CLASS(ThreadPoolParams);
 ORT_RUNTIME_CLASS(ThreadingOptions);
 ORT_RUNTIME_CLASS(ArenaCfg);
 ORT_RUNTIME_CLASS(PrepackedWeightsContainer);
+ORT_RUNTIME_CLASS(SharedInitializersContainer);
 ORT_RUNTIME_CLASS(TensorRTProviderOptionsV2);
 ORT_RUNTIME_CLASS(CUDAProviderOptionsV2);
 ORT_RUNTIME_CLASS(CANNProviderOptions);
@@ -2799,6 +2801,14 @@ struct OrtApi {
    *  Use -1 to allow ORT to choose the default 1GB for max_power_of_two_extend_bytes.
    *  Ultimately, the allocation size is determined by the allocation memory request.
    *  Further allocation sizes are governed by the arena extend strategy.
+   * "use_huge_pages": Use 1 to advise the OS to back arena regions of 2MB or more with huge
+   *  pages, which reduces TLB pressure for large CPU resident models. Best effort: ignored
+   *  on platforms without huge page support. Only applies to CPU memory.
+   *  Use -1 to allow ORT to choose the default (disabled).
+   * "free_region_idle_timeout_ms": Arena regions in which every chunk has been free for at least
+   *  this many milliseconds are returned to the system on the next free, so the arena does not
+   *  stay at its high-water mark after a burst of large allocations.
+   *  Use -1 to allow ORT to choose the default (disabled; memory is only returned via shrinkage).
    *
    * \param[in] arena_config_keys Keys to configure the arena
    * \param[in] arena_config_values Values to configure the arena
@@ -4661,6 +4671,309 @@ struct OrtApi {
                   _In_reads_(num_external_initializer_files) char* const* external_initializer_file_buffer_array,
                   _In_reads_(num_external_initializer_files) const size_t* external_initializer_file_lengths,
                   size_t num_external_initializer_files);
+
+  /** \brief Get the sampled per-kernel execution latency histograms of a session as a JSON string
+   *
+   * Only available when the session was created with the config entry
+   * "session.kernel_latency_sampling_interval" set to a non-zero value; returns an error otherwise.
+   * Unlike profiling, this may be called at any time - including while Run calls are in flight - and
+   * does not stop collection. The snapshot aggregates all Run calls made so far.
+   *
+   * \param[in] session
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null terminated JSON string. Must be freed using `allocator`
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(SessionGetKernelLatencyStats, _In_ const OrtSession* session, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /// @}
+  /// \name OrtSharedInitializersContainer
+  /// @{
+
+  /** \brief Create an ::OrtSharedInitializersContainer
+   *
+   * This container holds deserialized constant initializers for sharing between sessions.
+   * Sessions created from the same model bytes with the same container reference one copy of each
+   * CPU placed constant initializer instead of each session materializing its own, collapsing the
+   * weight memory footprint of replicated sessions. Unlike OrtApi::AddInitializer, the weights do
+   * not have to be loaded by the application; the first session to initialize populates the
+   * container and subsequent sessions re-use its entries.
+   *
+   * Initializers are keyed by name, so an instance must only be shared between sessions that were
+   * created from the same model bytes.
+   *
+   * \param[out] out Newly created ::OrtSharedInitializersContainer. Must be freed with OrtApi::ReleaseSharedInitializersContainer
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(CreateSharedInitializersContainer, _Outptr_ OrtSharedInitializersContainer** out);
+
+  /** \brief Release OrtSharedInitializersContainer instance
+   *
+   * \note instance must not be released until the sessions using it are released
+   */
+  ORT_CLASS_RELEASE(SharedInitializersContainer);
+
+  /// @}
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Create session with shared initializers container
+   *
+   * Same functionality offered by OrtApi::CreateSession except that the created session reads its
+   * CPU placed constant initializers from / writes them into the provided container so that
+   * sessions created from the same model share one copy of each weight.
+   *
+   * \param[in] env OrtEnv instance instance
+   * \param[in] model_path Null terminated string of the path (wchar on Windows, char otherwise)
+   * \param[in] options
+   * \param[in] shared_initializers_container
+   * \param[out] out Newly created ::OrtSession. Must be freed with OrtApi::ReleaseSession
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(CreateSessionWithSharedInitializersContainer, _In_ const OrtEnv* env, _In_ const ORTCHAR_T* model_path,
+                  _In_ const OrtSessionOptions* options, _Inout_ OrtSharedInitializersContainer* shared_initializers_container,
+                  _Outptr_ OrtSession** out);
+
+  /** \brief Create session from memory with shared initializers container
+   *
+   * Same functionality offered by OrtApi::CreateSessionFromArray except that the created session
+   * reads its CPU placed constant initializers from / writes them into the provided container so
+   * that sessions created from the same model bytes share one copy of each weight.
+   *
+   * \param[in] env
+   * \param[in] model_data Array of bytes holding the model
+   * \param[in] model_data_length Number of bytes in `model_data_model`
+   * \param[in] options
+   * \param[in] shared_initializers_container
+   * \param[out] out Newly created ::OrtSession. Must be freed with OrtApi::ReleaseSession
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(CreateSessionFromArrayWithSharedInitializersContainer, _In_ const OrtEnv* env,
+                  _In_ const void* model_data, size_t model_data_length,
+                  _In_ const OrtSessionOptions* options, _Inout_ OrtSharedInitializersContainer* shared_initializers_container,
+                  _Outptr_ OrtSession** out);
+
+  /** \brief Return unused arena memory of the session's device allocators back to the system
+   *
+   * Frees arena regions that hold no live allocation for the listed devices. Tensors owned by the
+   * session (e.g. initializers) stay resident, so the session remains usable without
+   * re-initialization. This lets an idle session hand scratch memory to other sessions
+   * time-sharing the same device without waiting for the next OrtApi::Run call to trigger
+   * shrinkage through the "memory.enable_memory_arena_shrinkage" run option.
+   *
+   * \param[in] session
+   * \param[in] ort_device_list UTF-8 null terminated semicolon separated device list,
+   *            e.g. "cpu:0" or "gpu:0;gpu:1", in the same format as the
+   *            "memory.enable_memory_arena_shrinkage" run option value. An error is returned if a
+   *            listed device has no arena based allocator registered with the session.
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(SessionReleaseUnusedArenaMemory, _Inout_ OrtSession* session,
+                  _In_ const char* ort_device_list);
+
+  /// @}
+  /// \name OrtValue
+  /// @{
+
+  /** \brief Re-point an existing tensor ::OrtValue at new user data and shape
+   *
+   * Rebinds a tensor OrtValue created with OrtApi::CreateTensorWithDataAsOrtValue to new
+   * pre-allocated data, shape and element type without allocating a new OrtValue or Tensor.
+   * High rate callers can keep a pool of caller owned OrtValue slots and update them before each
+   * OrtApi::Run call instead of creating and releasing values on every request.
+   *
+   * `value` must currently hold a tensor that does not own its buffer. An error is returned for
+   * values created with OrtApi::CreateTensorAsOrtValue, as rebinding those would discard memory
+   * owned by ORT.
+   *
+   * \param[in] value An ::OrtValue created with OrtApi::CreateTensorWithDataAsOrtValue
+   * \param[in] info Memory description of where `p_data` is stored
+   * \param[in] p_data Pointer to the user supplied buffer. Not copied; it must stay valid until the
+   *            value is released or updated again
+   * \param[in] p_data_len The number of bytes in `p_data`
+   * \param[in] shape Pointer to the new tensor shape dimensions
+   * \param[in] shape_len The number of tensor shape dimensions
+   * \param[in] type The element type of the data in `p_data`
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(UpdateTensorWithDataAsOrtValue, _Inout_ OrtValue* value, _In_ const OrtMemoryInfo* info,
+                  _Inout_ void* p_data, size_t p_data_len, _In_ const int64_t* shape, size_t shape_len,
+                  ONNXTensorElementDataType type);
+
+  /// @}
+  /// \name OrtPipelinedRun
+  /// @{
+
+  /** \brief Create an ::OrtPipelinedRun that double buffers inference over a session
+   *
+   * The pipelined run owns two ::OrtIoBinding instances and a worker thread that executes
+   * submitted runs in order. The caller alternates between the two bindings: while the worker
+   * infers the binding submitted for frame N, OrtApi::PipelinedRunAcquireBinding hands out the
+   * other binding so the host can preprocess and bind frame N+1 concurrently. Device copies and
+   * compute overlap through the session's normal stream machinery; this object only provides the
+   * acquire/submit choreography that is otherwise clumsy to build over OrtApi::RunWithBinding.
+   *
+   * The pipelined run must be released before the session it was created over.
+   *
+   * \param[in] session
+   * \param[out] out The created ::OrtPipelinedRun. Must be freed with OrtApi::ReleasePipelinedRun,
+   *             which drains any submitted runs first
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(CreatePipelinedRun, _Inout_ OrtSession* session, _Outptr_ OrtPipelinedRun** out);
+
+  /** \brief Acquire the next free input binding of an ::OrtPipelinedRun
+   *
+   * Blocks until the run previously submitted with this binding (if any) has completed, then
+   * returns the binding so the caller can read its bound outputs and bind the next inputs.
+   * If the completed run failed, its error status is returned, no binding is handed out, and the
+   * slot is considered free again so a subsequent acquire succeeds.
+   *
+   * Only one binding can be acquired at a time; acquiring again before OrtApi::PipelinedRunSubmit
+   * is an error. The returned binding stays owned by the pipelined run — do not release it.
+   *
+   * \param[in] pipelined_run
+   * \param[out] binding The binding to fill for the next run
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(PipelinedRunAcquireBinding, _Inout_ OrtPipelinedRun* pipelined_run,
+                  _Outptr_ OrtIoBinding** binding);
+
+  /** \brief Submit the acquired binding of an ::OrtPipelinedRun for inference
+   *
+   * Enqueues a run over the binding returned by the last OrtApi::PipelinedRunAcquireBinding call
+   * and returns immediately; the worker thread executes queued runs in submission order. The run's
+   * status is reported by the acquire call that next hands out the same binding.
+   *
+   * \param[in] pipelined_run
+   * \param[in] run_options Optional. Copied before this call returns
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(PipelinedRunSubmit, _Inout_ OrtPipelinedRun* pipelined_run,
+                  _In_opt_ const OrtRunOptions* run_options);
+
+  /* \brief Release an ::OrtPipelinedRun
+   *
+   * Blocks until all submitted runs have completed before releasing the bindings.
+   */
+  ORT_CLASS_RELEASE(PipelinedRun);
+
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Reset a session's run-accumulated state back to post-initialize conditions
+   *
+   * Clears the memory pattern and inferred shape caches built for the input shapes seen so far,
+   * returns transient arena chunks (regions with no live allocation) of every arena based
+   * allocator of the session back to the system, and discards buffered profiling events.
+   * The loaded model, created kernels and pre-packed weights are untouched, so the next
+   * OrtApi::Run call behaves like the first one after session creation. This makes it safe to
+   * keep sessions in a pool and hand them to different tenants instead of paying session
+   * creation per request.
+   *
+   * Must not be called while OrtApi::Run calls on the session are in flight.
+   *
+   * \param[in] session
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   */
+  ORT_API2_STATUS(SessionResetState, _Inout_ OrtSession* session);
+
+  /// @}
+  /// \name OrtValue
+  /// @{
+
+  /** \brief Export a tensor ::OrtValue as a DLPack managed tensor without copying
+   *
+   * Wraps the tensor's buffer in a `DLManagedTensor` (returned as void* so that this header does
+   * not depend on the dlpack headers). The buffer gets an additional reference that the managed
+   * tensor's deleter releases, so the exported tensor stays valid after the OrtValue is released
+   * and no device-to-device copy is made. The consumer must invoke the deleter exactly once when
+   * it is done with the tensor.
+   *
+   * For tensors on a CUDA device the caller must ensure the producing work has completed or is
+   * ordered before the consumer's reads. Values obtained after OrtApi::Run or
+   * OrtApi::SynchronizeBoundOutputs returned satisfy this with a NULL `consumer_stream`.
+   * If `consumer_stream` (a cudaStream_t) is non-NULL, an event is recorded on the device's
+   * legacy default stream and `consumer_stream` is made to wait on it before this call returns,
+   * matching the DLPack protocol convention for producers whose work is ordered with the default
+   * stream; no host synchronization takes place.
+   *
+   * Only available in builds with DLPack support compiled in; returns an error otherwise.
+   *
+   * \param[in] value A tensor ::OrtValue to export
+   * \param[in] consumer_stream Optional cudaStream_t the consumer will read the tensor on
+   * \param[out] dlpack_tensor The exported `DLManagedTensor*`
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.19.
+   */
+  ORT_API2_STATUS(CreateDLPackTensorFromValue, _Inout_ OrtValue* value, _In_opt_ void* consumer_stream,
+                  _Outptr_ void** dlpack_tensor);
+
+  /** \brief Create a tensor ::OrtValue over the memory of a DLPack managed tensor without copying
+   *
+   * Takes ownership of the `DLManagedTensor*` passed as void*: its deleter is invoked when the
+   * returned OrtValue is released, and the producer's memory is used in place, so tensors
+   * produced by CUDA based pre-processing can be fed to a session without a device-to-device
+   * copy. Per the DLPack protocol the producer is responsible for ordering its pending work
+   * before the consumer's reads - when the value is consumed by a session, run the producer on
+   * the stream passed as the session's "user_compute_stream" or synchronize it before calling
+   * OrtApi::Run. Only contiguous tensors are supported.
+   *
+   * DLPack encodes bool and uint8 tensors identically; pass a non-zero `is_bool_tensor` to
+   * create a bool tensor from such data.
+   *
+   * Only available in builds with DLPack support compiled in; returns an error otherwise.
+   *
+   * \param[in] dlpack_tensor The `DLManagedTensor*` to wrap
+   * \param[in] is_bool_tensor Whether 8-bit unsigned data should be typed as bool
+   * \param[out] out The created ::OrtValue. Must be freed with OrtApi::ReleaseValue
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.19.
+   */
+  ORT_API2_STATUS(CreateValueFromDLPackTensor, _In_ void* dlpack_tensor, bool is_bool_tensor,
+                  _Outptr_ OrtValue** out);
+
+  /// @}
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Get per-allocator memory statistics of a session as a JSON string
+   *
+   * Reports one entry per allocator registered with the session, carrying the counters the
+   * allocator collects (see AllocatorStats): bytes in use, peak bytes in use, total bytes
+   * reserved from the system (for arena allocators this is the arena reservation), allocation
+   * counts, arena extension/shrinkage counts and the configured byte limit. Arena backed
+   * allocators collect these counters as part of normal operation, so calling this is cheap
+   * enough for periodic fleet telemetry; allocators that do not track statistics report zeros.
+   * May be called at any time, including while Run calls are in flight.
+   *
+   * \param[in] session
+   * \param[in] allocator Allocator used to allocate the output string
+   * \param[out] out Null terminated JSON string. Must be freed using `allocator`
+   *
+   * \snippet{doc} snippets.dox OrtStatus Return Value
+   *
+   * \since Version 1.19.
+   */
+  ORT_API2_STATUS(SessionGetMemoryStats, _In_ const OrtSession* session, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /// @}
 };
 
 /*
@@ -4773,6 +5086,17 @@ struct OrtCustomOp {
   // Same as GetMayInplace() and ReleaseMayInplace()
   size_t(ORT_API_CALL* GetAliasMap)(_Out_ int** input_index, _Out_ int** output_index);
   void(ORT_API_CALL* ReleaseAliasMap)(_Frees_ptr_opt_ int* input_index, _Frees_ptr_opt_ int* output_index);
+
+  // Optional prepacking hook, called once per constant initializer input during session
+  // initialization, before any compute call. 'tensor' is the initializer feeding input
+  // 'input_index' of the kernel. The kernel may copy the data into its own layout and set
+  // *is_packed to non-zero; ORT then releases its copy of the initializer and the corresponding
+  // input reads as null during KernelCompute. Leave *is_packed at zero to keep the initializer
+  // as a regular input. Combined with KernelContext_GetScratchBuffer and
+  // KernelContext_GetGPUComputeStream this lets custom kernels match the behavior of built-in
+  // EP kernels. May be nullptr.
+  OrtStatusPtr(ORT_API_CALL* KernelPrePack)(_In_ void* op_kernel, _In_ const OrtValue* tensor,
+                                            _In_ int input_index, _Out_ int* is_packed);
 };
 
 /*
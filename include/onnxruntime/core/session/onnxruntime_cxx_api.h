@@ -2309,6 +2309,7 @@ struct CustomOpBase : OrtCustomOp {
     OrtCustomOp::ReleaseMayInplace = nullptr;
     OrtCustomOp::GetAliasMap = nullptr;
     OrtCustomOp::ReleaseAliasMap = nullptr;
+    OrtCustomOp::KernelPrePack = nullptr;
   }
 
   // Default implementation of GetExecutionProviderType that returns nullptr to default to the CPU provider
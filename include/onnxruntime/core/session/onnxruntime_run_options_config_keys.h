@@ -26,6 +26,51 @@
 // By default, the value for this key is empty (i.e.) no memory arenas are shrunk
 static const char* const kOrtRunOptionsConfigEnableMemoryArenaShrinkage = "memory.enable_memory_arena_shrinkage";
 
+// Per-run budget, in bytes, for device memory allocated through stream-aware arena allocators
+// (e.g. the CUDA BFC arena). When set to a positive integer, an allocation on one of this run's
+// device streams that would push the stream's in-use bytes past the budget fails the run with an
+// error instead of growing the arena, so a single request with pathological shapes cannot exhaust
+// memory shared with co-tenant sessions. The budget applies to each device stream of the run and
+// does not cover allocations that bypass the arena. "0" (default) disables the limit.
+static const char* const kOrtRunOptionsConfigDeviceMemoryBudget = "memory.device_memory_budget_bytes";
+
+// Scheduling priority of this run relative to other runs sharing the same intra-op thread pool.
+// Supported values: "low", "normal" (default), "high".
+// While a high-priority run has a parallel loop in flight, low-priority runs stop handing
+// iterations to worker threads at the next shard boundary and finish the remainder on their
+// calling thread, so latency-sensitive and batch traffic can share one session without the
+// batch runs monopolizing the pool.
+static const char* const kOrtRunOptionsConfigRunPriority = "run.priority";
+
+// Set to "1" to execute this run's plan inline on the calling thread in deterministic plan order,
+// even when the session was created with ORT_PARALLEL execution mode. Every such run dispatches
+// kernels in exactly the same order with no inter-op scheduler involvement, so back-to-back
+// benchmark runs measure kernel time rather than scheduling variance. Wide graphs lose inter-op
+// concurrency for the run; intra-op parallelism inside each kernel is unaffected.
+// "0": default, use the session's execution mode.
+static const char* const kOrtRunOptionsConfigDeterministicDispatch = "run.deterministic_dispatch";
+
+// Cache key identifying this run's results in the session's Run() result cache (see
+// kOrtSessionOptionsRunResultCacheCapacity). When the key is already cached the run returns the
+// cached outputs without executing the graph; otherwise the run executes normally and its outputs
+// are inserted under the key. Empty (default): the run neither consults nor populates the cache.
+static const char* const kOrtRunOptionsConfigResultCacheKey = "run.result_cache_key";
+
+// Fingerprint identifying this run's inputs for request coalescing. Concurrent Run() calls on the
+// same session with the same non-empty key execute the graph once: the first caller runs it and
+// the others block until it completes, then return the same output OrtValues. The caller owns the
+// key space, exactly as for kOrtRunOptionsConfigResultCacheKey: a key must uniquely identify the
+// feeds, and the two keys compose (a coalesced run still consults and populates the result cache).
+// Coalesced callers share output buffers, so the outputs must be treated as read-only. If the
+// executing run fails, the waiting runs execute independently instead of sharing the failure.
+// Runs with pre-allocated fetches bypass coalescing. Empty (default): no coalescing.
+static const char* const kOrtRunOptionsConfigCoalesceKey = "run.coalesce_key";
+
+// Set to "1" to opt this run out of batch splitting when the session was created with
+// kOrtSessionOptionsConfigBatchSplitFactor. Also set internally on the per-slice replica runs so
+// they execute unsplit.
+static const char* const kOrtRunOptionsConfigDisableBatchSplit = "run.disable_batch_split";
+
 // Set to '1' to not synchronize execution providers with CPU at the end of session run.
 // Per default it will be set to '0'
 // Taking CUDA EP as an example, it omit triggering cudaStreamSynchronize on the compute stream.
@@ -67,6 +67,13 @@ static const char* const kOrtSessionOptionsEnableQuantQDQCleanup = "session.enab
 // GeluApproximation has side effects which may change the inference results. It is disabled by default due to this.
 static const char* const kOrtSessionOptionsEnableGeluApproximation = "optimization.enable_gelu_approximation";
 
+// Enable or disable constant folding on a non-CPU execution provider. "0": disable; "1": enable. The default is "0".
+// When enabled, nodes with a kernel registered for the first non-CPU execution provider in the session are folded
+// on that provider's device and only the folded results are copied back to CPU memory. This can significantly speed
+// up session creation for models with large constant subgraphs. The device kernels may produce slightly different
+// results than the CPU kernels, so this is disabled by default.
+static const char* const kOrtSessionOptionsEnableDeviceConstantFolding = "optimization.enable_device_constant_folding";
+
 // This setting controls whether to enable AheadOfTime function inlining.
 // AOT function inlining examines the graph and attempts to inline as many locally defined functions in the model
 // as possible with the help of enabled execution providers.
@@ -111,18 +118,204 @@ static const char* const kOrtSessionOptionsDisableSpecifiedOptimizers = "optimiz
 // Using device allocators means the memory allocation is made using malloc/new.
 static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "session.use_device_allocator_for_initializers";
 
+// Background read-ahead for externally stored (mmap'd) CPU initializers. Initializers are deserialized in the
+// order their first consumer appears in the execution plan, and with a value N > 0 the mapped regions of the
+// external CPU initializers are additionally touched on a thread pool task in that same order, N initializers
+// per task. The first inference can then start before the whole model is resident and only faults on pages the
+// read-ahead has not reached yet. Mainly useful when the model file lives on slow or network-backed storage
+// where demand paging is expensive. Smaller values interleave better with demand paging from an already-running
+// inference; larger values reduce scheduling overhead.
+// "0": disabled (default).
+static const char* const kOrtSessionOptionsInitializerReadAheadDepth = "session.initializer_read_ahead_depth";
+
+// Defer releasing intermediate values that were allocated inside a cached memory pattern buffer until the
+// end of the run, instead of releasing them one by one as nodes finish executing. The backing buffer is only
+// reclaimed at run end either way, so this costs no additional memory and removes per-value release
+// bookkeeping, which is measurable on small models served at high QPS. Only takes effect for runs served by
+// a cached memory pattern.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsDeferPatternedValueRelease = "session.defer_patterned_value_release";
+
+// Give each Run() call its own CPU memory arena for the duration of the run. Activations,
+// temporary buffers and outputs that are not bound to a caller-provided buffer are served
+// from a run-private arena instead of the shared session allocator, so concurrent requests
+// on one session cannot fragment each other's memory. The private arena is released
+// wholesale once the run's values are no longer referenced. Weights and other
+// session-lifetime allocations still come from the session allocator.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsUseRunScopedCpuArena = "session.use_run_scoped_cpu_arena";
+
+// Use the Winograd F(2x2,3x3) fast algorithm for eligible float Conv nodes on CPU
+// (3x3 kernel, unit strides and dilations, enough channels and filters per group to
+// amortize the transforms). This cuts the multiply count by ~2.25x on the convolutions
+// that dominate ResNet-style CNNs. The reduction is reassociated, so results are close
+// to but not bit-identical with the default GEMM-based algorithms, which is why the
+// algorithm is opt-in.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsEnableWinogradConvolution = "session.enable_winograd_convolution";
+
+// Store 2-D float MatMul initializer weights in compressed sparse row form and use a sparse
+// kernel when the fraction of zero elements in the weight meets or exceeds this value, e.g.
+// "0.9" for pruned models where at least 90% of the weights are zero. The decision is made
+// per weight at pre-pack time; dense weights keep the regular GEMM path. Accepts a decimal
+// in (0, 1]. Unset or "0" (default) disables the sparse path.
+static const char* const kOrtSessionOptionsMatMulSparseWeightThreshold = "session.matmul_sparse_weight_threshold";
+
+// Partition the CPU memory arena into one sub-arena per NUMA node and serve each allocation from the
+// sub-arena of the node the requesting thread runs on. With first-touch page placement this keeps large
+// activations in node-local memory on multi-socket machines. Has no effect on single-node machines or
+// when the CPU memory arena is disabled.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsUseNumaPartitionedArena = "session.use_numa_partitioned_arena";
+
+// Fuse chains of same-shape float elementwise ops (e.g. the Add/Mul/Sigmoid chains of Swish or erf-based
+// Gelu subgraphs) on the CPU execution provider into a single compiled kernel that evaluates the whole
+// chain one cache-resident tile at a time, instead of making a full pass over memory per op. Only applies
+// to the CPU execution provider that the session creates implicitly.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsEnableCpuElementwiseFusion = "session.enable_cpu_elementwise_fusion";
+
+// Run the iterations of a Scan node concurrently on the inter-op thread pool when the subgraph carries no
+// state between iterations (the Scan has no loop state variables), e.g. sliding-window models that scan
+// overlapping frames independently. Iterations that carry state always run sequentially regardless of this
+// setting, as do Loop nodes whose continuation condition makes every iteration depend on the previous one.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsParallelScanIterations = "session.parallel_scan_iterations";
+
+// Bounds the number of memory pattern groups cached per session when memory pattern optimization is enabled.
+// A pattern group is cached per distinct combination of input shapes, so models run with many dynamic shapes
+// (e.g. many distinct sequence lengths) can otherwise grow the cache without bound. When the limit is exceeded
+// the least recently used pattern group is evicted; in-flight runs holding an evicted group are unaffected.
+// The value is the maximum number of cached pattern groups. "0" means unbounded. The default is "0".
+static const char* const kOrtSessionOptionsMemoryPatternCacheLimit = "session.memory_pattern_cache_limit";
+
+// Resolve the graph's symbolic dimensions against the feed shapes once per distinct combination of input
+// shapes and cache the concrete shapes of all statically determined activations. Kernels can then pick up
+// their output shape from the memo (OpKernelContext::TryGetInferredOutputShape) instead of re-deriving it on
+// every run, which removes a constant per-run cost on large graphs served at high QPS with a small number of
+// recurring input shapes. Unrelated to memory pattern optimization, but the memo shares its shape cache.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsEnableShapeMemo = "session.enable_shape_memo";
+
+// Derive the graph annotation id used for CUDA graph capture (see kOrtRunOptionsConfigCudaGraphAnnotation
+// in onnxruntime_run_options_config_keys.h) from the shapes of the input tensors when the run options do
+// not provide one. Each distinct combination of input names and shapes is lazily assigned its own
+// annotation id on first occurrence, so a session serving a bounded set of padded shape buckets captures
+// and replays one graph per bucket instead of supporting only a single static shape. Every new shape
+// combination captures and caches another graph for the lifetime of the session, so this should only be
+// enabled when the set of input shapes is small. Only takes effect when the execution provider has graph
+// capture enabled.
+// "0": disabled (default); "1": enabled.
+static const char* const kOrtSessionOptionsCudaGraphAnnotationFromInputShapes =
+    "session.cuda_graph_annotation_from_input_shapes";
+
 // Configure whether to allow the inter_op/intra_op threads spinning a number of times before blocking
 // "0": thread will block if found no job to run
 // "1": default, thread will spin a number of times before blocking
 static const char* const kOrtSessionOptionsConfigAllowInterOpSpinning = "session.inter_op.allow_spinning";
 static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session.intra_op.allow_spinning";
 
+// Configure whether the inter_op/intra_op threads adapt how long they spin to the outcome of their
+// recent waits for work. Only meaningful when spinning is allowed. The spin budget shrinks each time
+// a spin phase expires without finding work and recovers when work arrives during the spin, so the
+// threads of a mostly idle session park quickly instead of stealing cycles from other workloads
+// sharing the machine.
+// "0": default, thread always spins for the full budget before blocking
+// "1": thread adapts its spin budget to recent wait outcomes
+static const char* const kOrtSessionOptionsConfigAdaptiveInterOpSpinning = "session.inter_op.adaptive_spinning";
+static const char* const kOrtSessionOptionsConfigAdaptiveIntraOpSpinning = "session.intra_op.adaptive_spinning";
+
+// Configure whether the intra_op thread pool tunes parallel loops from measured run times.
+// The static cost model tends to overpredict the benefit of sharding small shapes; with tuning
+// enabled, each distinct loop (keyed by iteration count and cost estimate) cycles through a few
+// candidate degrees of parallelism - including running sequentially - and then sticks with the
+// fastest one measured. The learned choices live in the session's thread pool and reset with it.
+// Only takes effect for sessions that create their own intra_op thread pool.
+// "0": default, disabled.
+// "1": enabled.
+static const char* const kOrtSessionOptionsConfigIntraOpLoopTuning = "session.intra_op.loop_tuning";
+
+// Shard the batch dimension of Run() calls across K concurrent replica executions of the graph.
+// "0" (default) disables the mode. "K" (K >= 2): the feeds are split into K contiguous slices
+// along dimension 0 and each slice is executed as an independent run against this session - sharing
+// its weights, allocators and thread pools - with the per-slice outputs concatenated back along
+// dimension 0. Useful when intra_op parallelism of a single batch saturates well below the core
+// count of the machine. The caller asserts that dimension 0 of every input AND every output is the
+// batch dimension; models with unbatched outputs (e.g. a scalar loss) must not enable this.
+// A Run() whose feeds do not qualify (non-CPU or non-tensor feeds, mismatched or too small batch,
+// pre-allocated outputs) silently executes unsplit.
+static const char* const kOrtSessionOptionsConfigBatchSplitFactor = "session.batch_split_factor";
+
+// Capacity of the session's Run() result cache. "0" (default) disables the cache.
+// "N" (N >= 1): a run that supplies kOrtRunOptionsConfigResultCacheKey has its fetched outputs
+// retained under that key, and a later run with the same key and output names returns the
+// retained OrtValues without executing the graph. The N most recently used keys are kept.
+// The caller owns the key space: a key must uniquely identify the feeds that produced the
+// result (e.g. a document id fed to a frozen feature-extractor tower); the session does not
+// hash the inputs. Outputs served from the cache share their buffers with the cache, so they
+// must be treated as read-only. Runs with pre-allocated fetches bypass the cache.
+static const char* const kOrtSessionOptionsRunResultCacheCapacity = "session.run_result_cache_capacity";
+
+// Path of a machine-readable partition report written during session initialization, after graph
+// partitioning has run. The JSON artifact lists, per execution provider, the assigned node count
+// and the number of disjoint partitions (a node fused/compiled by a provider counts as one
+// partition), plus every boundary tensor crossing from one provider to another with its element
+// count and size in bytes when statically known (-1 when the shape or type is dynamic).
+// Deployment tooling can fail a rollout when a model export fragments into too many partitions,
+// without parsing verbose logs. Empty (default): no report is written.
+static const char* const kOrtSessionOptionsPartitionReportFile = "session.partition_report_file";
+
+// Sampled collection of per-kernel execution latency into lock-free log2-bucketed histograms.
+// "0": default, disabled.
+// "N" (N >= 1): every Nth invocation of each kernel of the main graph is timed and added to that
+// kernel's histogram. The aggregated histograms can be read at any time - including while Run()
+// calls are in flight - via the SessionGetKernelLatencyStats C API. Use "1" to time every
+// invocation; larger intervals reduce the (already small) overhead further for always-on use.
+static const char* const kOrtSessionOptionsKernelLatencySamplingInterval =
+    "session.kernel_latency_sampling_interval";
+
+// Set to "1" to have the profiler record node events as fixed-size 32-byte binary records in a
+// preallocated ring buffer instead of string-keyed events. Recording a compact event is two time
+// stamps and an atomic increment, so enabling profiling no longer distorts microsecond kernels;
+// in exchange node events lose their per-node argument details (input/output sizes, shapes,
+// thread pool stats) and the fence events are not emitted. The records are converted to the
+// regular chrome trace JSON when the profile file is written, so consumers are unaffected.
+// "0": default, disabled.
+static const char* const kOrtSessionOptionsProfilerCompactEvents = "session.profiler_compact_events";
+
+// Set to "1" to run a one-time micro benchmark at session initialization that probes a few MLAS
+// SGEMM blocking configurations on the running machine and installs the fastest, instead of relying
+// solely on the static per-architecture defaults. The probe runs once per process and costs a few
+// milliseconds of session creation time. The tuned blocking is process wide and affects all sessions.
+// "0": disabled (default). "1": enabled.
+static const char* const kOrtSessionOptionsEnableMlasGemmTuning = "session.enable_mlas_gemm_tuning";
+
+// Set to "1" to request deterministic compute: kernels that have a choice between a fast
+// non-deterministic implementation and a reproducible one pick the reproducible one. This sets
+// SessionOptions::use_deterministic_compute, which was previously reachable only through the
+// Python API. On CUDA/ROCm it disables the fast non-deterministic reduction and TopK paths.
+// On CPU it pins the shard count of parallel whole-tensor reductions to a value that does not
+// depend on the thread pool size, so results are bitwise identical across runs and across
+// intra-op thread count settings at a small parallelism cost. "0": disabled (default).
+static const char* const kOrtSessionOptionsConfigUseDeterministicCompute = "session.use_deterministic_compute";
+
+// Set to "1" to store large fp32 activations as fp16 between their producer and topologically
+// distant consumers on CPU. A Cast to float16 is inserted after the producer and a Cast back to
+// float in front of the distant consumers; consumers adjacent to the producer keep reading the
+// original tensor. This halves the memory footprint and read bandwidth of long-lived
+// intermediates (e.g. skip connections in high-resolution segmentation models) at the price of
+// two element-wise casts and fp16 rounding of the compressed values. "0": disabled (default).
+static const char* const kOrtSessionOptionsCompressLongLivedActivations = "session.compress_long_lived_activations";
+
 // Key for using model bytes directly for ORT format
 // If a session is created using an input byte array contains the ORT format model data,
 // By default we will copy the model bytes at the time of session creation to ensure the model bytes
 // buffer is valid.
 // Setting this option to "1" will disable copy the model bytes, and use the model bytes directly. The caller
 // has to guarantee that the model bytes are valid until the ORT session using the model bytes is destroyed.
+// If a session is created from a file path instead, setting this option to "1" makes ORT memory map the
+// ORT format model file rather than read it into memory up front, so only the sections of the model that are
+// actually accessed are faulted in. The mapping is owned by the session.
 static const char* const kOrtSessionOptionsConfigUseORTModelBytesDirectly = "session.use_ort_model_bytes_directly";
 
 /// <summary>
@@ -183,6 +376,15 @@ static const char* const kOrtSessionOptionsConfigDynamicBlockBase = "session.dyn
 // Applies only to internal thread-pools
 static const char* const kOrtSessionOptionsConfigForceSpinningStop = "session.force_spinning_stop";
 
+// A quota on the intra-op parallelism of this session's parallel loops.
+// While a Run() is executing, each parallel loop started by the session fans out to at most this
+// many workers, leaving the remaining workers of the thread pool free for concurrent sessions.
+// Intended for sessions that share the environment's global thread pool (see
+// CreateEnvWithGlobalThreadPools); with per-session pools the pool size already bounds the
+// session. "0" (default) applies no quota. See kOrtRunOptionsConfigRunPriority for prioritizing
+// individual runs that share a pool.
+static const char* const kOrtSessionOptionsConfigIntraOpThreadQuota = "session.intra_op_thread_quota";
+
 // "1": all inconsistencies encountered during shape and type inference
 // will result in failures.
 // "0": in some cases warnings will be logged but processing will continue. The default.
@@ -214,6 +416,16 @@ static const char* const kNodePartitionConfigFile = "session.node_partition_conf
 //    Hence 64-65 is an invalid configuration, because a windows thread cannot be attached to processors across group boundary.
 static const char* const kOrtSessionOptionsConfigIntraOpThreadAffinities = "session.intra_op_thread_affinities";
 
+// This option restricts the intra op thread pool to the performance (P) cores of a hybrid CPU.
+// When enabled, the pool is sized to the number of performance cores and each worker thread is
+// attached to one of them, so no shard of a parallel loop lands on a slower efficiency (E) core.
+// It is ignored when intra_op_num_threads is set explicitly or when an affinity string is
+// configured via kOrtSessionOptionsConfigIntraOpThreadAffinities, and it has no effect on
+// systems where all cores are of a single type.
+// "0": disabled. [DEFAULT]
+// "1": enabled.
+static const char* const kOrtSessionOptionsConfigIntraOpRestrictToPerformanceCores = "session.intra_op_restrict_to_performance_cores";
+
 // This option will dump out the model to assist debugging any issues with layout transformation,
 // and is primarily intended for developer usage. It is only relevant if an execution provider that requests
 // NHWC layout is enabled such as NNAPI, XNNPACK or QNN.
@@ -242,6 +454,24 @@ static const char* const kDebugLayoutTransformation = "session.debug_layout_tran
 // - "1": CPU EP fallback is disabled.
 static const char* const kOrtSessionOptionsDisableCPUEPFallback = "session.disable_cpu_ep_fallback";
 
+// Specifies whether type/shape inference during Graph::Resolve may run concurrently for independent
+// nodes of the same topological level, using the session's inter-op (or, failing that, intra-op)
+// thread pool. Primarily useful to speed up session creation for very large graphs.
+// Option values:
+// - "0": parallel shape inference is disabled. [DEFAULT]
+// - "1": parallel shape inference is enabled.
+static const char* const kOrtSessionOptionsConfigParallelShapeInference = "session.parallel_shape_inference";
+
+// Specifies whether the ModelProto is deserialized into a protobuf arena owned by the model
+// instead of using default heap allocation. Reduces allocator pressure and speeds up loading
+// of models with very large graphs at the cost of releasing the proto memory only when the
+// session is destroyed.
+// Option values:
+// - "0": protobuf arena parsing is disabled. [DEFAULT]
+// - "1": protobuf arena parsing is enabled.
+static const char* const kOrtSessionOptionsConfigUseProtobufArenaForModelParsing =
+    "session.use_protobuf_arena_for_model_parsing";
+
 // Use this config when serializing a large model after optimization to specify an external initializers file
 static const char* const kOrtSessionOptionsOptimizedModelExternalInitializersFileName =
     "session.optimized_model_external_initializers_file_name";
@@ -250,6 +480,13 @@ static const char* const kOrtSessionOptionsOptimizedModelExternalInitializersFil
 static const char* const kOrtSessionOptionsOptimizedModelExternalInitializersMinSizeInBytes =
     "session.optimized_model_external_initializers_min_size_in_bytes";
 
+// Use this config to specify a directory for a file-backed cache of pre-packed weights that is shared
+// across processes. Only takes effect when a PrepackedWeightsContainer has been registered with the session.
+// Cache entries are written atomically and mapped read-only, so concurrent worker processes running the
+// same model share one copy of the packed buffers in physical memory.
+static const char* const kOrtSessionOptionsPrepackedWeightsFileCacheDirectory =
+    "session.prepacked_weights_file_cache_directory";
+
 // Enable EP context feature to dump the partitioned graph which includes the EP context into Onnx file.
 // The dumped Onnx model with EP context can be used for future inference to avoid the EP graph partitioning/compile overhead.
 // "0": disable. (default)
@@ -265,7 +502,16 @@ static const char* const kOrtSessionOptionEpContextFilePath = "ep.context_file_p
 // "1": dump the EP context into the Onnx model. (default).
 static const char* const kOrtSessionOptionEpContextEmbedMode = "ep.context_embed_mode";
 
+// Share the EP context across sessions in the process. Sessions created with this enabled use one
+// backend instance (one device handle and one compiled context) instead of initializing the
+// accelerator per session, so a bundle of models pays the hardware bring-up cost once and their
+// compiled graphs are packed into a single context. Currently supported by the QNN EP.
+// "0": each session initializes its own EP context. (default)
+// "1": sessions share one EP context.
+static const char* const kOrtSessionOptionShareEpContexts = "ep.share_ep_contexts";
+
 // Gemm fastmath mode provides fp32 gemm acceleration with bfloat16 based matmul.
+// Despite the historical name, this also covers the AMX-BF16 accelerated path on x64.
 // Option values:
 // - "0": Gemm FastMath mode is not enabled. [DEFAULT]
 // - "1": Gemm FastMath mode is enabled.
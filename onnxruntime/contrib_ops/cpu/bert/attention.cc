@@ -333,6 +333,44 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
     });
   }
 
+  // Self-attention without masking or state can use the fused flash attention kernel,
+  // which streams K/V blocks through cache instead of materializing the BxNxSxT score matrix.
+  if constexpr (std::is_same_v<T, float>) {
+    if (mask_index == nullptr && past == nullptr && relative_position_bias == nullptr &&
+        !is_unidirectional_ && context->OutputCount() == 1) {
+      MLAS_FLASH_ATTENTION_THREADED_ARGS args;
+      args.BatchSize = batch_size;
+      args.NumHeads = num_heads_;
+      args.QSequenceLength = sequence_length;
+      args.KVSequenceLength = sequence_length;
+      args.QKHeadSize = parameters.head_size;
+      args.VHeadSize = parameters.v_head_size;
+      args.QBlockSize = std::min(sequence_length, 256);
+      args.KVBlockSize = std::min(sequence_length, 512);
+      args.Scale = scale_ == 0.0f ? 1.0f / sqrt(static_cast<float>(parameters.head_size)) : scale_;
+      args.ThreadCount = ThreadPool::DegreeOfParallelism(tp);
+
+      size_t floats_per_thread = SafeInt<size_t>(args.QBlockSize) * args.KVBlockSize +
+                                 SafeInt<size_t>(args.QBlockSize) * args.VHeadSize +
+                                 SafeInt<size_t>(2) * args.QBlockSize;
+      args.BufferSizePerThread = floats_per_thread * sizeof(float);
+
+      AllocatorPtr scratch_allocator;
+      ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&scratch_allocator));
+      auto buffer = scratch_allocator->Alloc(SafeInt<size_t>(args.ThreadCount) * args.BufferSizePerThread);
+      BufferUniquePtr scratch_buffer(buffer, BufferDeleter(std::move(scratch_allocator)));
+      args.Buffer = reinterpret_cast<float*>(buffer);
+
+      args.Query = Q;
+      args.Key = K;
+      args.Value = V;
+      args.Output = output->MutableData<T>();
+
+      MlasFlashAttention(&args, tp);
+      return Status::OK();
+    }
+  }
+
   // Compute the attention score and apply the score to V
   return ApplyAttention(Q, K, V, mask_index, past, nullptr /* past_key */, nullptr /* past_value */,
                         output, nullptr /* present_key */, nullptr /* present_value */,
@@ -27,7 +27,8 @@ Status CheckInputs(const T* query,
                    float scale,
                    bool is_unidirectional,
                    bool past_present_share_buffer,
-                   bool dmmha_packing) {
+                   bool dmmha_packing,
+                   int beam_width = 1) {
   //     key_padding_mask (K/V)     : (B) or (2*B + 1) or (B, L) or None
   //     relative_position_bias     : (B, 1, S, L)
   //     past_key                   : (B, N, S*, H)
@@ -143,8 +144,14 @@ Status CheckInputs(const T* query,
                              key_dims.size());
     }
     if (query_dims[0] != key_dims[0]) {
-      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
-                             "Input 'query' and 'key' shall have same dim 0 (batch size)");
+      // Inside BeamSearch the 4-D cross-attention K/V may hold a single copy per batch
+      // entry that is shared by all beams, while query carries batch_size * beam_width rows.
+      const bool kv_shared_across_beams =
+          key_dims.size() == 4 && beam_width > 1 && key_dims[0] * beam_width == query_dims[0];
+      if (!kv_shared_across_beams) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Input 'query' and 'key' shall have same dim 0 (batch size)");
+      }
     }
 
     if (key_dims.size() == 3) {
@@ -247,8 +254,12 @@ Status CheckInputs(const T* query,
     }
 
     if (query_dims[0] != value_dims[0]) {
-      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
-                             "Input 'query' and 'value' shall have same dim 0 (batch_size)");
+      const bool kv_shared_across_beams =
+          value_dims.size() == 4 && beam_width > 1 && value_dims[0] * beam_width == query_dims[0];
+      if (!kv_shared_across_beams) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Input 'query' and 'value' shall have same dim 0 (batch_size)");
+      }
     }
 
     if (value_dims.size() == 3) {
@@ -346,14 +357,15 @@ Status CheckInputs(const T* query,
                    bool is_unidirectional,
                    bool past_present_share_buffer,
                    bool dmmha_packing,
-                   int max_threads_per_block) {
+                   int max_threads_per_block,
+                   int beam_width = 1) {
   if (max_threads_per_block > 0 && num_heads > max_threads_per_block) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "num_heads should be no larger than ", max_threads_per_block);
   }
 
   return CheckInputs(query, key, value, bias, key_padding_mask, relative_position_bias, past_key, past_value,
                      past_seq_len, parameters, num_heads, mask_filter_value, scale, is_unidirectional,
-                     past_present_share_buffer, dmmha_packing);
+                     past_present_share_buffer, dmmha_packing, beam_width);
 }
 
 }  // namespace multihead_attention_helper
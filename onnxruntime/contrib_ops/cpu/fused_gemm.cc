@@ -9,6 +9,41 @@ namespace contrib {
 constexpr const char* ACTIVATION_NAME_PREFIX = "activation_";
 constexpr size_t ACTIVATION_NAME_PREFIX_LEN = 11;
 
+// Map an activation name and its (prefix-stripped) attributes to an MLAS activation so it can run
+// as a GEMM epilogue. Returns false when the activation or its attributes have no MLAS equivalent,
+// in which case the caller falls back to the ElementWiseRangedTransform second pass.
+static bool TryMapToMlasActivation(const std::string& activation, const NodeAttributes& attrs,
+                                   MLAS_ACTIVATION& mlas_activation) {
+  auto get_float_attr = [&attrs](const char* name, float& value) -> bool {
+    auto it = attrs.find(name);
+    if (it == attrs.end() ||
+        it->second.type() != ONNX_NAMESPACE::AttributeProto::AttributeType::AttributeProto_AttributeType_FLOAT) {
+      return false;
+    }
+    value = it->second.f();
+    return true;
+  };
+
+  if (activation == "Relu") {
+    mlas_activation.ActivationKind = MlasReluActivation;
+  } else if (activation == "Tanh") {
+    mlas_activation.ActivationKind = MlasTanhActivation;
+  } else if (activation == "Sigmoid") {
+    mlas_activation.ActivationKind = MlasLogisticActivation;
+  } else if (activation == "LeakyRelu") {
+    mlas_activation.ActivationKind = MlasLeakyReluActivation;
+    return get_float_attr("alpha", mlas_activation.Parameters.LeakyRelu.alpha);
+  } else if (activation == "HardSigmoid") {
+    mlas_activation.ActivationKind = MlasHardSigmoidActivation;
+    return get_float_attr("alpha", mlas_activation.Parameters.HardSigmoid.alpha) &&
+           get_float_attr("beta", mlas_activation.Parameters.HardSigmoid.beta);
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
 template <typename T>
 class FusedGemm final : public Gemm<T> {
  public:
@@ -20,6 +55,13 @@ class FusedGemm final : public Gemm<T> {
         attrs[p.first.substr(ACTIVATION_NAME_PREFIX_LEN)] = p.second;
       }
     }
+
+    // Prefer the MLAS epilogue, which is applied tile by tile while the GEMM output is still cache
+    // resident rather than as a second full pass over the output.
+    if (std::is_same<T, float>::value && TryMapToMlasActivation(activation, attrs, this->fused_activation_)) {
+      return;
+    }
+
     ORT_THROW_IF_ERROR(functors::ElementWiseRangedTransform<T>::Create(activation, attrs, this->activation_));
   }
 };
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cpu/math/bitmask_dropout.h"
+
+#include <algorithm>
+#include <random>
+
+#include "core/common/narrow.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace {
+constexpr float k_default_ratio{0.5f};
+
+template <typename T2>
+float GetRatioOrDefault(const Tensor* ratio_tensor) {
+  if (ratio_tensor) {
+    ORT_ENFORCE(ratio_tensor->Shape().Size() == 1, "ratio input should have a single value.");
+    const float ratio_value = static_cast<float>(*ratio_tensor->Data<T2>());
+    ORT_ENFORCE(0.0f <= ratio_value && ratio_value < 1.0f, "ratio must be in the range [0, 1)");
+    return ratio_value;
+  }
+  return k_default_ratio;
+}
+}  // namespace
+
+#define REGISTER_KERNEL_TYPED(T1, T2)                                     \
+  ONNX_OPERATOR_TYPED_KERNEL_EX(                                          \
+      BitmaskDropout,                                                     \
+      kMSDomain,                                                          \
+      1,                                                                  \
+      T1##_##T2,                                                          \
+      kCpuExecutionProvider,                                              \
+      KernelDefBuilder()                                                  \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<T1>())         \
+          .TypeConstraint("T1", DataTypeImpl::GetTensorType<T2>())        \
+          .TypeConstraint("T2", DataTypeImpl::GetTensorType<bool>())      \
+          .TypeConstraint("T3",                                           \
+                          DataTypeImpl::GetTensorType<BitmaskElementType>()), \
+      BitmaskDropout<T1, T2>);
+
+REGISTER_KERNEL_TYPED(float, MLFloat16)
+REGISTER_KERNEL_TYPED(float, float)
+REGISTER_KERNEL_TYPED(float, double)
+REGISTER_KERNEL_TYPED(double, MLFloat16)
+REGISTER_KERNEL_TYPED(double, float)
+REGISTER_KERNEL_TYPED(double, double)
+
+template <typename T1, typename T2>
+Status BitmaskDropout<T1, T2>::Compute(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  auto X_span = X->DataAsSpan<T1>();
+  const Tensor* ratio = context->Input<Tensor>(1);  // optional
+  const float ratio_value = GetRatioOrDefault<T2>(ratio);
+  const auto& X_shape = X->Shape();
+  const int64_t N = X_shape.Size();
+  Tensor* Y = context->Output(0, X_shape);
+  auto Y_span = Y->MutableDataAsSpan<T1>();
+
+  const int64_t mask_element_count = (N + kNumBitsPerBitmaskElement - 1) / kNumBitsPerBitmaskElement;
+  Tensor* mask = context->Output(1, {mask_element_count});  // optional
+
+  const Tensor* training_mode = context->Input<Tensor>(2);
+  if ((0 == ratio_value) || (training_mode == nullptr || *(training_mode->Data<bool>()) == false)) {
+    // drop none
+    if (X_span.data() != Y_span.data()) {
+      std::copy(X_span.begin(), X_span.end(), Y_span.begin());
+    }
+
+    if (mask != nullptr) {
+      std::fill_n(mask->MutableData<BitmaskElementType>(), narrow<size_t>(mask_element_count),
+                  std::numeric_limits<BitmaskElementType>::max());
+    }
+
+    return Status::OK();
+  }
+
+  // drop some
+  RandomGenerator& generator = generator_ != nullptr ? *generator_.get() : RandomGenerator::Default();
+  std::default_random_engine rng(gsl::narrow_cast<std::default_random_engine::result_type>(generator.NextSeed()));
+  std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+
+  // Divide rather than multiply by a precomputed reciprocal so the output is bit-identical to Dropout.
+  const T1 keep_prob = static_cast<T1>(1.0f - ratio_value);
+  BitmaskElementType* mask_data = mask != nullptr ? mask->MutableData<BitmaskElementType>() : nullptr;
+
+  for (int64_t i = 0; i < N; i += kNumBitsPerBitmaskElement) {
+    const int64_t count = std::min<int64_t>(kNumBitsPerBitmaskElement, N - i);
+    BitmaskElementType word = 0;
+    for (int64_t j = 0; j < count; ++j) {
+      const bool keep = dist(rng) >= ratio_value;
+      Y_span[narrow<size_t>(i + j)] = keep ? X_span[narrow<size_t>(i + j)] / keep_prob : T1{};
+      word |= static_cast<BitmaskElementType>(keep) << j;
+    }
+    if (mask_data != nullptr) {
+      mask_data[narrow<size_t>(i / kNumBitsPerBitmaskElement)] = word;
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include "core/framework/op_kernel.h"
+#include "core/framework/random_generator.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Bit-packed dropout mask layout shared by the CPU BitmaskDropout and BitmaskDropoutGrad
+// kernels: element i maps to bit (i % 32) of uint32 word (i / 32), matching the layout the
+// CUDA/ROCm kernels produce.
+using BitmaskElementType = uint32_t;
+constexpr int kNumBitsPerBitmaskElement = std::numeric_limits<BitmaskElementType>::digits;
+
+template <typename T1, typename T2>
+class BitmaskDropout final : public OpKernel {
+ public:
+  BitmaskDropout(const OpKernelInfo& info) : OpKernel{info} {
+    int64_t seed = 0;
+    if (info.GetAttr<int64_t>("seed", &seed).IsOK()) {
+      generator_ = std::make_unique<RandomGenerator>(seed);
+    }
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  mutable std::unique_ptr<RandomGenerator> generator_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,590 @@
+#include "core/common/narrow.h"
+#include "core/common/safeint.h"
+#include "core/providers/cpu/rnn/deep_cpu_gru.h"
+#include "core/providers/cpu/rnn/rnn_helpers.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+using namespace rnn::detail;
+
+class DynamicQuantizeGRU : public OpKernel {
+ public:
+  DynamicQuantizeGRU(const OpKernelInfo& info) : OpKernel(info) {
+    // required attributes
+    std::string direction;
+    ORT_ENFORCE(info.GetAttr("direction", &direction).IsOK());
+
+    int64_t int64_value;
+    ORT_ENFORCE(info.GetAttr("linear_before_reset", &int64_value).IsOK());
+    linear_before_reset_ = narrow<int>(int64_value);
+
+    ORT_ENFORCE(info.GetAttr("hidden_size", &int64_value).IsOK() && int64_value > 0);
+    hidden_size_ = narrow<int>(int64_value);
+
+    // optional attributes
+    std::vector<std::string> activation_func_names = info.GetAttrsOrDefault<std::string>("activations");
+    std::vector<float> activation_func_alphas = info.GetAttrsOrDefault<float>("activation_alpha");
+    std::vector<float> activation_func_betas = info.GetAttrsOrDefault<float>("activation_beta");
+
+    clip_ = info.GetAttrOrDefault<float>("clip", std::numeric_limits<float>::max());
+    ORT_ENFORCE(clip_ > 0.f);
+
+    direction_ = rnn::detail::MakeDirection(direction);
+    num_directions_ = direction_ == rnn::detail::Direction::kBidirectional ? 2 : 1;
+
+    if (activation_func_names.empty()) {
+      for (int i = 0; i < num_directions_; ++i) {
+        activation_func_names.emplace_back("sigmoid");
+        activation_func_names.emplace_back("tanh");
+      }
+    }
+
+    ORT_ENFORCE(activation_func_names.size() == static_cast<size_t>(num_directions_) * 2);
+
+    activation_funcs_ = rnn::detail::ActivationFuncs(activation_func_names,
+                                                     activation_func_alphas,
+                                                     activation_func_betas);
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx,
+                 AllocatorPtr alloc, /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+  ~DynamicQuantizeGRU() override = default;
+
+ private:
+  Status TryPackInputWeights(const Tensor& weights, AllocatorPtr& alloc, bool& is_packed);
+
+  Status TryPackRecurrentWeights(const Tensor& weights, AllocatorPtr& alloc, bool& is_packed);
+
+  Status ValidateInputs(const Tensor& X,
+                        const TensorShape& W_shape,
+                        const TensorShape& R_shape,
+                        const Tensor* B,
+                        const Tensor* sequence_lens,
+                        const Tensor* initial_h) const;
+
+  rnn::detail::Direction direction_;
+  int num_directions_;
+
+  int hidden_size_{};
+  float clip_;
+  int linear_before_reset_{};
+
+  rnn::detail::ActivationFuncs activation_funcs_;
+
+  PackedWeights packed_W_;
+  // R is consumed as two sub-matrices so the update/reset gate GEMM and the hidden gate GEMM
+  // can run separately. ZR fwd followed by bwd, same for H.
+  PackedWeights packed_ZR_;
+  PackedWeights packed_H_;
+  bool is_W_signed_{false};
+  bool is_R_signed_{false};
+};
+
+Status DynamicQuantizeGRU::TryPackInputWeights(const Tensor& weights, AllocatorPtr& alloc, bool& is_packed) {
+  const auto& shape = weights.Shape();
+  if (shape.NumDimensions() != 3) {
+    return Status::OK();
+  }
+
+  // weights: [num_directions, input_size, 3*hidden_size]
+  const size_t K = static_cast<size_t>(shape[1]);
+  const size_t N = static_cast<size_t>(shape[2]);
+
+  if ((shape[0] != num_directions_) || (N != static_cast<size_t>(hidden_size_) * 3)) {
+    return Status::OK();
+  }
+
+  is_W_signed_ = weights.IsDataType<int8_t>();
+  const size_t packed_weights_size = MlasGemmPackBSize(N, K, false /*AIsSigned*/, is_W_signed_);
+  if (packed_weights_size == 0) {
+    return Status::OK();
+  }
+
+  const size_t buffer_size = SafeInt<size_t>(packed_weights_size) * num_directions_;
+  packed_W_.buffer_ = IAllocator::MakeUniquePtr<void>(alloc, buffer_size, true);
+
+  auto* packed_weights_data = packed_W_.buffer_.get();
+
+  // Initialize memory to 0 as there could be some padding associated with pre-packed
+  // buffer memory and we don not want it uninitialized and generate different hashes
+  // if and when we try to cache this pre-packed buffer for sharing between sessions.
+  memset(packed_weights_data, 0, buffer_size);
+
+  packed_W_.buffer_size_ = buffer_size;
+  packed_W_.weights_size_ = packed_weights_size;
+  packed_W_.shape_ = shape;
+
+  const auto* weights_data = static_cast<const uint8_t*>(weights.DataRaw());
+  for (int i = 0; i < num_directions_; i++) {
+    MlasGemmPackB(N, K, weights_data, N, false /*AIsSigned*/, is_W_signed_, packed_weights_data);
+    packed_weights_data = static_cast<uint8_t*>(packed_weights_data) + packed_weights_size;
+    weights_data += N * K;
+  }
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status DynamicQuantizeGRU::TryPackRecurrentWeights(const Tensor& weights, AllocatorPtr& alloc, bool& is_packed) {
+  const auto& shape = weights.Shape();
+  if (shape.NumDimensions() != 3) {
+    return Status::OK();
+  }
+
+  // recurrence weights: [num_directions, hidden_size, 3*hidden_size]
+  const size_t K = static_cast<size_t>(shape[1]);
+  const size_t N = static_cast<size_t>(shape[2]);
+
+  if ((shape[0] != num_directions_) || (K != static_cast<size_t>(hidden_size_)) ||
+      (N != static_cast<size_t>(hidden_size_) * 3)) {
+    return Status::OK();
+  }
+
+  const size_t N_ZR = static_cast<size_t>(hidden_size_) * 2;
+  const size_t N_H = static_cast<size_t>(hidden_size_);
+
+  is_R_signed_ = weights.IsDataType<int8_t>();
+
+  // We are making two packed buffers, one for ZR weights and another for H weights.
+  const size_t ZR_packed_size = MlasGemmPackBSize(N_ZR, K, false /*AIsSigned*/, is_R_signed_);
+  if (ZR_packed_size == 0) {
+    return Status::OK();
+  }
+
+  const size_t H_packed_size = MlasGemmPackBSize(N_H, K, false /*AIsSigned*/, is_R_signed_);
+  if (H_packed_size == 0) {
+    return Status::OK();
+  }
+
+  const size_t buffer_size_ZR = SafeInt<size_t>(ZR_packed_size) * num_directions_;
+  const size_t buffer_size_H = SafeInt<size_t>(H_packed_size) * num_directions_;
+
+  packed_ZR_.buffer_ = IAllocator::MakeUniquePtr<void>(alloc, buffer_size_ZR, true);
+  auto* buffer_ZR = packed_ZR_.buffer_.get();
+  memset(buffer_ZR, 0, buffer_size_ZR);
+
+  packed_ZR_.buffer_size_ = buffer_size_ZR;
+  packed_ZR_.weights_size_ = ZR_packed_size;
+  packed_ZR_.shape_ = shape;  // original shape, not used in prepacked calculations, but useful for validation
+
+  packed_H_.buffer_ = IAllocator::MakeUniquePtr<void>(alloc, buffer_size_H, true);
+  auto* buffer_H = packed_H_.buffer_.get();
+  memset(buffer_H, 0, buffer_size_H);
+
+  packed_H_.buffer_size_ = buffer_size_H;
+  packed_H_.weights_size_ = H_packed_size;
+  packed_H_.shape_ = shape;  // original shape, not used in prepacked calculations, but useful for validation
+
+  // the ZR and H blocks are column ranges of the per-direction [hidden_size, 3*hidden_size] matrix,
+  // so they are packed directly from the original data using its leading dimension
+  const auto* weights_data = static_cast<const uint8_t*>(weights.DataRaw());
+  for (int i = 0; i < num_directions_; i++) {
+    MlasGemmPackB(N_ZR, K, weights_data, N, false /*AIsSigned*/, is_R_signed_,
+                  static_cast<uint8_t*>(buffer_ZR) + ZR_packed_size * i);
+    MlasGemmPackB(N_H, K, weights_data + N_ZR, N, false /*AIsSigned*/, is_R_signed_,
+                  static_cast<uint8_t*>(buffer_H) + H_packed_size * i);
+    weights_data += N * K;
+  }
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status DynamicQuantizeGRU::PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                                   /*out*/ bool& is_packed,
+                                   /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  const bool share_prepacked_weights = (prepacked_weights != nullptr);
+
+  if (input_idx == 1) {
+    ORT_RETURN_IF_ERROR(TryPackInputWeights(tensor, alloc, is_packed));
+    if (is_packed && share_prepacked_weights) {
+      prepacked_weights->buffers_.push_back(std::move(packed_W_.buffer_));
+      prepacked_weights->buffer_sizes_.push_back(packed_W_.buffer_size_);
+    }
+  } else if (input_idx == 2) {
+    ORT_RETURN_IF_ERROR(TryPackRecurrentWeights(tensor, alloc, is_packed));
+    if (is_packed && share_prepacked_weights) {
+      prepacked_weights->buffers_.push_back(std::move(packed_ZR_.buffer_));
+      prepacked_weights->buffer_sizes_.push_back(packed_ZR_.buffer_size_);
+      prepacked_weights->buffers_.push_back(std::move(packed_H_.buffer_));
+      prepacked_weights->buffer_sizes_.push_back(packed_H_.buffer_size_);
+    }
+  }
+
+  return Status::OK();
+}
+
+Status DynamicQuantizeGRU::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                                     int input_idx,
+                                                     /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == 1) {
+    packed_W_.buffer_ = std::move(prepacked_buffers[0]);
+    used_shared_buffers = true;
+  } else if (input_idx == 2) {
+    packed_ZR_.buffer_ = std::move(prepacked_buffers[0]);
+    packed_H_.buffer_ = std::move(prepacked_buffers[1]);
+    used_shared_buffers = true;
+  }
+
+  return Status::OK();
+}
+
+Status DynamicQuantizeGRU::ValidateInputs(const Tensor& X,
+                                          const TensorShape& W_shape,
+                                          const TensorShape& R_shape,
+                                          const Tensor* B,
+                                          const Tensor* sequence_lens,
+                                          const Tensor* initial_h) const {
+  auto& X_shape = X.Shape();
+
+  if (X_shape.NumDimensions() != 3)
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input X must have 3 dimensions only. Actual:", X_shape);
+
+  int64_t seq_length = X_shape[0];
+  int64_t batch_size = X_shape[1];
+  int64_t input_size = X_shape[2];
+
+  if (W_shape.NumDimensions() != 3 ||
+      W_shape[0] != num_directions_ ||
+      W_shape[1] != input_size ||
+      W_shape[2] != 3 * hidden_size_)
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input W must have shape {",
+                           num_directions_, ",", input_size, ",", 3 * hidden_size_, "}. Actual:", W_shape);
+
+  if (R_shape.NumDimensions() != 3 ||
+      R_shape[0] != num_directions_ ||
+      R_shape[1] != hidden_size_ ||
+      R_shape[2] != 3 * hidden_size_)
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input R must have shape {",
+                           num_directions_, ",", hidden_size_, ",", 3 * hidden_size_, "}. Actual:", R_shape);
+
+  if (B != nullptr) {
+    auto& B_shape = B->Shape();
+    if (B_shape.NumDimensions() != 2 ||
+        B_shape[0] != num_directions_ ||
+        B_shape[1] != 6 * hidden_size_)
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input B must have shape {",
+                             num_directions_, ",", 6, "*", hidden_size_, "}. Actual:", B_shape);
+  }
+
+  if (sequence_lens != nullptr) {
+    auto& sequence_lens_shape = sequence_lens->Shape();
+    if (sequence_lens_shape.NumDimensions() != 1 ||
+        sequence_lens_shape[0] != batch_size) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input sequence_lens must have shape {",
+                             batch_size, "}. Actual:", sequence_lens_shape);
+    }
+
+    auto sequence_len_entries = sequence_lens->DataAsSpan<int>();
+    if (std::any_of(sequence_len_entries.begin(),
+                    sequence_len_entries.end(),
+                    [seq_length](int len) { return len < 0 || len > seq_length; })) {
+      return ORT_MAKE_STATUS(
+          ONNXRUNTIME, INVALID_ARGUMENT,
+          "Invalid value/s in sequence_lens. All values must be > 0 and < seq_length. seq_length=", seq_length);
+    }
+  }
+
+  if (initial_h != nullptr) {
+    auto& initial_h_shape = initial_h->Shape();
+
+    if (initial_h_shape.NumDimensions() != 3 ||
+        initial_h_shape[0] != num_directions_ ||
+        initial_h_shape[1] != batch_size ||
+        initial_h_shape[2] != hidden_size_)
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Input initial_h must have shape {",
+                             num_directions_, ",", batch_size, ",", hidden_size_, "}. Actual:", initial_h_shape);
+  }
+
+  return Status::OK();
+}
+
+#define WeightCheck(weight_shape, weight_name)                                                                                              \
+  if ((weight_shape.NumDimensions() != 1 && weight_shape.NumDimensions() != 2) ||                                                           \
+      (weight_shape.NumDimensions() == 2 && weight_shape[1] != static_cast<int64_t>(hidden_size_) * 3) ||                                   \
+      weight_shape[0] != num_directions_) {                                                                                                 \
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,                                                                                   \
+                           "Input ", #weight_name, " must have shape {", num_directions_, "} for per-tensor/layer quantization or shape {", \
+                           num_directions_, ", 3*", hidden_size_, "} for per-channel quantization. Actual:", weight_shape);                 \
+  }
+
+#define ZeroPointCheck(w_zp, zp_shape, is_signed, weight_name)                                                                            \
+  if (zp_shape.NumDimensions() == 2) {                                                                                                    \
+    const int64_t zp_size = zp_shape.Size();                                                                                              \
+    const uint8_t* w_zp_data = static_cast<const uint8_t*>(w_zp->DataRaw());                                                              \
+    if (is_signed) {                                                                                                                      \
+      for (int64_t i = 0; i < zp_size; i++) {                                                                                             \
+        if (w_zp_data[i] != 0) {                                                                                                          \
+          return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "DynamicQuantizeGRU : ", #weight_name, "Weight zero point must be zero"); \
+        }                                                                                                                                 \
+      }                                                                                                                                   \
+    } else {                                                                                                                              \
+      const uint8_t W_zero_point_value = w_zp_data[0];                                                                                    \
+      for (int64_t i = 1; i < zp_size; i++) {                                                                                             \
+        if (w_zp_data[i] != W_zero_point_value) {                                                                                         \
+          return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "DynamicQuantizeGRU : ", #weight_name, "Weight point must be constant");  \
+        }                                                                                                                                 \
+      }                                                                                                                                   \
+    }                                                                                                                                     \
+  }
+
+Status DynamicQuantizeGRU::Compute(OpKernelContext* context) const {
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  const Tensor& X = *context->Input<Tensor>(0);  // inputs. [seq_length, batch_size, input_size]
+
+  // weights. [num_directions, input_size, 3*hidden_size]
+  const Tensor* W = packed_W_.buffer_ ? nullptr : context->Input<Tensor>(1);
+  // recurrence weights. [num_directions, hidden_size, 3*hidden_size]
+  const Tensor* R = packed_ZR_.buffer_ ? nullptr : context->Input<Tensor>(2);
+
+  // optional
+  const auto* B = context->Input<Tensor>(3);              // bias. [num_directions, 6*hidden_size]
+  const auto* sequence_lens = context->Input<Tensor>(4);  // [batch_size]
+  const auto* initial_h = context->Input<Tensor>(5);      // initial hidden. [num_directions, batch_size, hidden_size]
+
+  const Tensor* w_scale = context->Input<Tensor>(6);
+  const Tensor* w_zp = context->Input<Tensor>(7);
+  const Tensor* r_scale = context->Input<Tensor>(8);
+  const Tensor* r_zp = context->Input<Tensor>(9);
+
+  const auto& W_shape = (W != nullptr) ? W->Shape() : packed_W_.shape_;
+  const auto& R_shape = (R != nullptr) ? R->Shape() : packed_ZR_.shape_;  // original shape saved
+
+  auto& X_shape = X.Shape();
+
+  int seq_length = narrow<int>(X_shape[0]);
+  int batch_size = narrow<int>(X_shape[1]);
+  int input_size = narrow<int>(X_shape[2]);
+
+  auto status = ValidateInputs(X, W_shape, R_shape, B, sequence_lens, initial_h);
+  ORT_RETURN_IF_ERROR(status);
+
+  const TensorShape& W_zp_shape = w_zp->Shape();
+  const TensorShape& R_zp_shape = r_zp->Shape();
+  const TensorShape& W_scale_shape = w_scale->Shape();
+  const TensorShape& R_scale_shape = r_scale->Shape();
+
+  WeightCheck(W_zp_shape, W_zero_point);
+  WeightCheck(R_zp_shape, R_zero_point);
+  WeightCheck(W_scale_shape, W_scale);
+  WeightCheck(R_scale_shape, R_scale);
+
+  const bool is_W_signed = (W != nullptr) ? W->IsDataType<int8_t>() : is_W_signed_;
+  const bool is_R_signed = (R != nullptr) ? R->IsDataType<int8_t>() : is_R_signed_;
+
+  ZeroPointCheck(w_zp, W_zp_shape, is_W_signed, Input);
+  ZeroPointCheck(r_zp, R_zp_shape, is_R_signed, Recurrent);
+
+  const size_t W_scale_size = W_scale_shape.NumDimensions() == 2 ? narrow<size_t>(W_scale_shape[1]) : 1;
+  const size_t R_scale_size = R_scale_shape.NumDimensions() == 2 ? narrow<size_t>(R_scale_shape[1]) : 1;
+  const bool R_per_channel = R_scale_size > 1;
+
+  // GRU outputs are optional but must be in the same order
+  TensorShape Y_dims{seq_length, num_directions_, batch_size, hidden_size_};
+  Tensor* Y = context->Output(/*index*/ 0, Y_dims);
+
+  TensorShape Y_h_dims{num_directions_, batch_size, hidden_size_};
+  Tensor* Y_h = context->Output(/*index*/ 1, Y_h_dims);
+
+  // Reset output and return if max sequence length is 0
+  if (sequence_lens != nullptr) {
+    int32_t max_sequence_length = *std::max_element(sequence_lens->Data<int32_t>(),
+                                                    sequence_lens->Data<int32_t>() + sequence_lens->Shape().Size());
+    if (max_sequence_length == 0) {
+      if (Y != nullptr) std::fill_n(Y->MutableData<float>(), Y_dims.Size(), 0.f);
+      if (Y_h != nullptr) std::fill_n(Y_h->MutableData<float>(), Y_h_dims.Size(), 0.f);
+      return Status::OK();
+    }
+  }
+
+  AllocatorPtr alloc;
+  status = context->GetTempSpaceAllocator(&alloc);
+  ORT_RETURN_IF_ERROR(status);
+
+  const size_t hidden_size_x2 = SafeInt<size_t>(hidden_size_) * 2;
+  const size_t hidden_size_x3 = SafeInt<size_t>(hidden_size_) * 3;
+  const size_t W_size_per_direction = SafeInt<size_t>(input_size) * hidden_size_x3;
+  const size_t ZR_size_per_direction = SafeInt<size_t>(hidden_size_) * hidden_size_x2;
+  const size_t H_size_per_direction = SafeInt<size_t>(hidden_size_) * hidden_size_;
+
+  const uint8_t* W_data = W != nullptr ? static_cast<const uint8_t*>(W->DataRaw()) : nullptr;
+
+  // the qgemm implementation requires unpacked B to be a contiguous [K, N] matrix, so if R was
+  // not prepacked (e.g. it isn't a constant initializer) split out contiguous copies of the
+  // ZR and H column blocks of each direction's [hidden_size, 3*hidden_size] matrix.
+  IAllocatorUniquePtr<uint8_t> ZR_copy_ptr;
+  IAllocatorUniquePtr<uint8_t> H_copy_ptr;
+  if (R != nullptr) {
+    ZR_copy_ptr = IAllocator::MakeUniquePtr<uint8_t>(alloc, ZR_size_per_direction * num_directions_);
+    H_copy_ptr = IAllocator::MakeUniquePtr<uint8_t>(alloc, H_size_per_direction * num_directions_);
+
+    const uint8_t* R_data = static_cast<const uint8_t*>(R->DataRaw());
+    uint8_t* ZR_copy = ZR_copy_ptr.get();
+    uint8_t* H_copy = H_copy_ptr.get();
+    for (int64_t row = 0, num_rows = SafeInt<int64_t>(num_directions_) * hidden_size_; row < num_rows; ++row) {
+      memcpy(ZR_copy, R_data, hidden_size_x2);
+      memcpy(H_copy, R_data + hidden_size_x2, hidden_size_);
+      R_data += hidden_size_x3;
+      ZR_copy += hidden_size_x2;
+      H_copy += hidden_size_;
+    }
+  }
+
+  QuantizationParameter quant_para_W_1(w_scale->Data<float>(),
+                                       static_cast<const uint8_t*>(w_zp->DataRaw()),
+                                       is_W_signed,
+                                       W_scale_size);
+
+  // for per-channel quantization of R the first 2*hidden_size scales cover ZR and the
+  // remaining hidden_size scales cover H
+  QuantizationParameter quant_para_ZR_1(r_scale->Data<float>(),
+                                        static_cast<const uint8_t*>(r_zp->DataRaw()),
+                                        is_R_signed,
+                                        R_per_channel ? hidden_size_x2 : 1);
+  QuantizationParameter quant_para_H_1(quant_para_ZR_1);
+  if (R_per_channel) {
+    quant_para_H_1.scale += hidden_size_x2;
+    quant_para_H_1.zero_point += hidden_size_x2;
+    quant_para_H_1.scale_size = hidden_size_;
+  }
+
+  GemmWeights<uint8_t> W_1(0, W_data, W_size_per_direction, packed_W_, &quant_para_W_1);
+
+  GemmWeights<uint8_t> ZR_1;
+  GemmWeights<uint8_t> H_1;
+  if (R != nullptr) {
+    ZR_1.Init(0, ZR_copy_ptr.get(), ZR_size_per_direction, packed_ZR_, &quant_para_ZR_1);
+    H_1.Init(0, H_copy_ptr.get(), H_size_per_direction, packed_H_, &quant_para_H_1);
+  } else {
+    // The data ptr and the size are taken from pre-packed buffer
+    ZR_1.Init(0, nullptr, 0, packed_ZR_, &quant_para_ZR_1);
+    H_1.Init(0, nullptr, 0, packed_H_, &quant_para_H_1);
+  }
+
+  const size_t bias_size_per_direction = SafeInt<size_t>(hidden_size_) * 6;
+  gsl::span<const float> bias = B != nullptr ? B->DataAsSpan<float>() : gsl::span<const float>();
+  gsl::span<const float> bias_1 = bias.empty() ? bias : bias.subspan(0, bias_size_per_direction);
+
+  gsl::span<const float> input = X.DataAsSpan<float>();
+  gsl::span<const int> sequence_lens_span = sequence_lens != nullptr ? sequence_lens->DataAsSpan<int>()
+                                                                     : gsl::span<const int>();
+
+  const size_t initial_hidden_size_per_direction = SafeInt<size_t>(batch_size) * hidden_size_;
+  gsl::span<const float> initial_hidden = initial_h != nullptr ? initial_h->DataAsSpan<float>() : gsl::span<const float>();
+  gsl::span<const float> initial_hidden_1 = initial_hidden.empty()
+                                                ? initial_hidden
+                                                : initial_hidden.subspan(0, initial_hidden_size_per_direction);
+
+  // output shape is [seq_length, num_directions, batch_size, hidden_size]
+  // so it's not a case of all the output for one direction being first.
+  // due to that we can only easily check that the end of the output for each direction is valid.
+  const size_t output_size = onnxruntime::narrow<size_t>(Y != nullptr ? Y->Shape().Size() : 0);
+  const size_t per_direction_offset = SafeInt<size_t>(batch_size) * hidden_size_;
+  gsl::span<float> output = Y != nullptr ? Y->MutableDataAsSpan<float>() : gsl::span<float>();
+  gsl::span<float> output_1 = output.empty()
+                                  ? output
+                                  : output.subspan(0, output_size - (num_directions_ - 1) * per_direction_offset);
+
+  // UniDirectionalGru needs somewhere to write output, so even if we aren't returning Y_h
+  // we provide an appropriately sized buffer for that purpose.
+  const size_t hidden_output_size_per_direction = SafeInt<size_t>(batch_size) * hidden_size_;
+  IAllocatorUniquePtr<float> local_hidden_output;
+  gsl::span<float> hidden_output =
+      Y_h ? Y_h->MutableDataAsSpan<float>()
+          : Allocate<float>(alloc, hidden_output_size_per_direction * num_directions_, local_hidden_output);
+
+  gsl::span<float> hidden_output_1 = hidden_output.subspan(0, hidden_output_size_per_direction);
+
+  if (direction_ == Direction::kBidirectional) {
+    QuantizationParameter quant_para_W_2(quant_para_W_1);
+    quant_para_W_2.scale += W_scale_size;
+    quant_para_W_2.zero_point += W_scale_size;  // zero_point and scale have same size
+
+    QuantizationParameter quant_para_ZR_2(quant_para_ZR_1);
+    QuantizationParameter quant_para_H_2(quant_para_H_1);
+    quant_para_ZR_2.scale += R_scale_size;
+    quant_para_ZR_2.zero_point += R_scale_size;  // zero_point and scale have same size
+    quant_para_H_2.scale += R_scale_size;
+    quant_para_H_2.zero_point += R_scale_size;
+
+    GemmWeights<uint8_t> W_2(1, W_data, W_size_per_direction, packed_W_, &quant_para_W_2);
+
+    GemmWeights<uint8_t> ZR_2;
+    GemmWeights<uint8_t> H_2;
+    if (R != nullptr) {
+      ZR_2.Init(1, ZR_copy_ptr.get(), ZR_size_per_direction, packed_ZR_, &quant_para_ZR_2);
+      H_2.Init(1, H_copy_ptr.get(), H_size_per_direction, packed_H_, &quant_para_H_2);
+    } else {
+      ZR_2.Init(1, nullptr, 0, packed_ZR_, &quant_para_ZR_2);
+      H_2.Init(1, nullptr, 0, packed_H_, &quant_para_H_2);
+    }
+
+    gsl::span<const float> bias_2 = bias.empty() ? bias : bias.subspan(bias_size_per_direction, bias_size_per_direction);
+
+    gsl::span<const float> initial_hidden_2 = initial_hidden.empty()
+                                                  ? initial_hidden
+                                                  : initial_hidden.subspan(initial_hidden_size_per_direction,
+                                                                           initial_hidden_size_per_direction);
+    gsl::span<float> output_2 = output.empty()
+                                    ? output
+                                    : output.subspan(per_direction_offset, output_size - per_direction_offset);
+
+    gsl::span<float> hidden_output_2 = hidden_output.subspan(hidden_output_size_per_direction,
+                                                             hidden_output_size_per_direction);
+
+    onnxruntime::detail::UniDirectionalGru<float> fw(alloc, seq_length, batch_size, input_size, hidden_size_,
+                                                     linear_before_reset_ != 0, Direction::kForward, bias_1,
+                                                     initial_hidden_1,
+                                                     activation_funcs_.Entries()[0],
+                                                     activation_funcs_.Entries()[1],
+                                                     clip_, thread_pool);
+    fw.Compute(input, sequence_lens_span, num_directions_, W_1, ZR_1, H_1, output_1, hidden_output_1);
+
+    onnxruntime::detail::UniDirectionalGru<float> bw(alloc, seq_length, batch_size, input_size, hidden_size_,
+                                                     linear_before_reset_ != 0, Direction::kReverse, bias_2,
+                                                     initial_hidden_2,
+                                                     activation_funcs_.Entries()[2],
+                                                     activation_funcs_.Entries()[3],
+                                                     clip_, thread_pool);
+    bw.Compute(input, sequence_lens_span, num_directions_, W_2, ZR_2, H_2, output_2, hidden_output_2);
+  } else {
+    onnxruntime::detail::UniDirectionalGru<float> gru_p(alloc, seq_length, batch_size, input_size, hidden_size_,
+                                                        linear_before_reset_ != 0, direction_, bias_1,
+                                                        initial_hidden_1,
+                                                        activation_funcs_.Entries()[0],
+                                                        activation_funcs_.Entries()[1],
+                                                        clip_, thread_pool);
+    gru_p.Compute(input, sequence_lens_span, num_directions_, W_1, ZR_1, H_1, output_1, hidden_output_1);
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    DynamicQuantizeGRU,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<int32_t>())
+        .TypeConstraint("T2", {DataTypeImpl::GetTensorType<uint8_t>(), DataTypeImpl::GetTensorType<int8_t>()}),
+    DynamicQuantizeGRU);
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/common.h"
+#include "core/common/narrow.h"
+#include "core/framework/data_types_internal.h"
+#include "core/framework/int4.h"
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/common.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+class GatherBlockQuantized final : public OpKernel {
+ public:
+  explicit GatherBlockQuantized(const OpKernelInfo& info) : OpKernel(info) {
+    gather_axis_ = info.GetAttrOrDefault<int64_t>("gather_axis", 0);
+    quantize_axis_ = info.GetAttrOrDefault<int64_t>("quantize_axis", 1);
+    block_size_ = info.GetAttrOrDefault<int64_t>("block_size", 128);
+    ORT_ENFORCE(block_size_ >= 16 && ((block_size_ - 1) & block_size_) == 0,
+                "'block_size' must be a power of 2 and not smaller than 16.");
+  }
+
+  Status Compute(OpKernelContext* ctx) const override;
+
+ private:
+  template <typename T1>
+  struct ComputeImpl;
+
+  int64_t gather_axis_;
+  int64_t quantize_axis_;
+  int64_t block_size_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    GatherBlockQuantized,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", BuildKernelDefConstraints<int8_t, uint8_t, Int4x2, UInt4x2>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("Tind", BuildKernelDefConstraints<int32_t, int64_t>()),
+    GatherBlockQuantized);
+
+namespace {
+template <typename T1>
+inline int32_t GetQuantizedElem(const T1* data, int64_t index) {
+  return static_cast<int32_t>(data[index]);
+}
+
+// int4 tensors store two logical elements per byte.
+template <bool Signed>
+inline int32_t GetQuantizedElem(const Int4x2Base<Signed>* data, int64_t index) {
+  return static_cast<int32_t>(data[index >> 1].GetElem(static_cast<size_t>(index & 1)));
+}
+}  // namespace
+
+template <typename T1>
+struct GatherBlockQuantized::ComputeImpl {
+  template <typename Tind>
+  Status ComputeTyped(OpKernelContext* ctx, const Tensor& data, const Tensor& indices,
+                      const Tensor& scales, const Tensor* zero_points,
+                      int64_t gather_axis, int64_t quantize_axis, int64_t block_size) const {
+    const auto data_dims = data.Shape().GetDims();
+    const int64_t gather_dim = data_dims[narrow<size_t>(gather_axis)];
+    const int64_t outer_size = data.Shape().SizeToDimension(narrow<size_t>(gather_axis));
+    const int64_t inner_size = data.Shape().SizeFromDimension(narrow<size_t>(gather_axis) + 1);
+    const int64_t index_count = indices.Shape().Size();
+
+    TensorShapeVector output_dims;
+    output_dims.reserve(data_dims.size() - 1 + indices.Shape().NumDimensions());
+    for (int64_t i = 0; i < gather_axis; ++i) {
+      output_dims.push_back(data_dims[narrow<size_t>(i)]);
+    }
+    for (auto dim : indices.Shape().GetDims()) {
+      output_dims.push_back(dim);
+    }
+    for (size_t i = narrow<size_t>(gather_axis) + 1; i < data_dims.size(); ++i) {
+      output_dims.push_back(data_dims[i]);
+    }
+
+    Tensor* output = ctx->Output(0, TensorShape(output_dims));
+
+    const int64_t dim_q = data_dims[narrow<size_t>(quantize_axis)];
+    const int64_t stride_q = data.Shape().SizeFromDimension(narrow<size_t>(quantize_axis) + 1);
+    const int64_t scale_dim_q = scales.Shape()[narrow<size_t>(quantize_axis)];
+
+    const T1* data_ptr = data.Data<T1>();
+    const Tind* indices_ptr = indices.Data<Tind>();
+    const float* scales_ptr = scales.Data<float>();
+    const T1* zero_points_ptr = zero_points != nullptr ? zero_points->Data<T1>() : nullptr;
+    float* output_ptr = output->MutableData<float>();
+
+    // Validate all indices up front so the parallel loop below never reads out of bounds.
+    for (int64_t i = 0; i < index_count; ++i) {
+      const int64_t idx = static_cast<int64_t>(indices_ptr[i]);
+      ORT_RETURN_IF(idx < -gather_dim || idx >= gather_dim,
+                    "indices element out of data's gather_axis dimension range. indices[", i, "]=", idx);
+    }
+
+    // Each unit of work dequantizes one gathered slice of inner_size contiguous data elements.
+    auto fn = [data_ptr, indices_ptr, scales_ptr, zero_points_ptr, output_ptr,
+               gather_dim, inner_size, index_count, dim_q, stride_q, scale_dim_q,
+               block_size](ptrdiff_t slice) {
+      const int64_t outer_idx = static_cast<int64_t>(slice) / index_count;
+      const int64_t index_idx = static_cast<int64_t>(slice) % index_count;
+      int64_t gather_idx = static_cast<int64_t>(indices_ptr[index_idx]);
+      if (gather_idx < 0) {
+        gather_idx += gather_dim;
+      }
+
+      const int64_t data_base = (outer_idx * gather_dim + gather_idx) * inner_size;
+      float* output_slice = output_ptr + static_cast<int64_t>(slice) * inner_size;
+      for (int64_t i = 0; i < inner_size; ++i) {
+        const int64_t data_flat = data_base + i;
+        const int64_t q_coord = (data_flat / stride_q) % dim_q;
+        const int64_t scale_flat = (data_flat / (stride_q * dim_q)) * (scale_dim_q * stride_q) +
+                                   (q_coord / block_size) * stride_q + (data_flat % stride_q);
+        const int32_t q = GetQuantizedElem(data_ptr, data_flat);
+        const int32_t zp = zero_points_ptr != nullptr ? GetQuantizedElem(zero_points_ptr, scale_flat) : 0;
+        output_slice[i] = static_cast<float>(q - zp) * scales_ptr[scale_flat];
+      }
+    };
+
+    concurrency::ThreadPool::TryBatchParallelFor(ctx->GetOperatorThreadPool(),
+                                                 narrow<ptrdiff_t>(outer_size * index_count),
+                                                 std::move(fn), 0);
+    return Status::OK();
+  }
+
+  Status operator()(OpKernelContext* ctx, const Tensor& data, const Tensor& indices,
+                    const Tensor& scales, const Tensor* zero_points,
+                    int64_t gather_axis, int64_t quantize_axis, int64_t block_size) const {
+    if (indices.IsDataType<int32_t>()) {
+      return ComputeTyped<int32_t>(ctx, data, indices, scales, zero_points,
+                                   gather_axis, quantize_axis, block_size);
+    }
+    return ComputeTyped<int64_t>(ctx, data, indices, scales, zero_points,
+                                 gather_axis, quantize_axis, block_size);
+  }
+};
+
+Status GatherBlockQuantized::Compute(OpKernelContext* ctx) const {
+  const auto& data = *ctx->Input<Tensor>(0);
+  const auto& indices = *ctx->Input<Tensor>(1);
+  const auto& scales = *ctx->Input<Tensor>(2);
+  const auto* zero_points = ctx->Input<Tensor>(3);
+
+  const auto& data_shape = data.Shape();
+  const int64_t rank = static_cast<int64_t>(data_shape.NumDimensions());
+  ORT_RETURN_IF(rank < 1, "data tensor must have rank >= 1.");
+  const int64_t gather_axis = HandleNegativeAxis(gather_axis_, rank);
+  const int64_t quantize_axis = HandleNegativeAxis(quantize_axis_, rank);
+
+  const auto& scales_shape = scales.Shape();
+  ORT_RETURN_IF(static_cast<int64_t>(scales_shape.NumDimensions()) != rank,
+                "scales must have the same rank as data.");
+  for (int64_t i = 0; i < rank; ++i) {
+    const int64_t expected = i == quantize_axis
+                                 ? (data_shape[narrow<size_t>(i)] + block_size_ - 1) / block_size_
+                                 : data_shape[narrow<size_t>(i)];
+    ORT_RETURN_IF(scales_shape[narrow<size_t>(i)] != expected,
+                  "scales shape does not match data shape and block_size on dimension ", i);
+  }
+
+  if (zero_points != nullptr) {
+    ORT_RETURN_IF(zero_points->GetElementType() != data.GetElementType(),
+                  "zero_points must have the same type as data.");
+    ORT_RETURN_IF(zero_points->Shape() != scales_shape,
+                  "zero_points must have the same shape as scales.");
+  }
+
+  utils::MLTypeCallDispatcher<int8_t, uint8_t, Int4x2, UInt4x2> t_disp(data.GetElementType());
+  return t_disp.InvokeRet<Status, ComputeImpl>(ctx, data, indices, scales, zero_points,
+                                               gather_axis, quantize_axis, block_size_);
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -274,9 +274,12 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
                        this->temp_space_allocator_->Info(),
                        position_ids);
 
+  GenerationStepProfiler step_profiler(this->decoder_session_state_.Profiler(), "BeamSearchGpt");
+
   int current_length = parameters->sequence_length;
   int iteration_counter = 0;
   while (current_length < parameters->max_length) {
+    const TimePoint step_start = step_profiler.Start();
 #ifdef DEBUG_GENERATION
     auto cur_len = std::to_string(current_length);
     dumper->Print("***CurrentLength", cur_len, true);
@@ -291,6 +294,8 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
     }
 #endif
 
+    const TimePoint decoder_run_start = step_profiler.Start();
+
     // For the first iteration use the init_run_decoder subgraph (if present)
     if (iteration_counter++ == 0 &&
         init_run_decoder_session_state_ != nullptr) {
@@ -322,7 +327,9 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
     }
 
     ORT_RETURN_IF_ERROR(status);
+    step_profiler.RecordPhase(GenerationStepProfiler::kDecoderRun, iteration_counter, decoder_run_start);
 
+    const TimePoint process_logits_start = step_profiler.Start();
     const OrtValue& logits = fetches[0];
     gsl::span<int32_t> beam_next_tokens;
     ORT_RETURN_IF_ERROR(this->GenerateNextToken(logits,
@@ -330,6 +337,7 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
                                                 beam_state,
                                                 cpu_state,
                                                 iteration_counter));
+    step_profiler.RecordPhase(GenerationStepProfiler::kProcessLogits, iteration_counter, process_logits_start);
 
     // When all batches are finished, stop earlier to avoid wasting computation.
     if (this->beam_scorer_->IsDone())
@@ -363,6 +371,7 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
       // For the first iteration, position_ids is initialized as sequence lengths. We can add it to feeds directly.
       // For the remaining iterations, we need increase position_ids first, then add it to feeds.
       bool increase_position = (iteration_counter > 1);
+      const TimePoint update_feeds_start = step_profiler.Start();
       ORT_RETURN_IF_ERROR(UpdateFeeds(fetches, feeds, current_length,
                                       position_ids, increase_position,
                                       ReinterpretAsSpan<const int32_t>(beam_next_tokens),
@@ -375,6 +384,7 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
                                       current_length - 1,
                                       parameters->sequence_length,
                                       gpt_subgraph_.has_decoder_masked_attention_));
+      step_profiler.RecordPhase(GenerationStepProfiler::kUpdateFeeds, iteration_counter, update_feeds_start);
     }
 
     if (this->beam_scorer_->IsDoneLater())
@@ -388,8 +398,12 @@ Status BeamSearchGpt<T>::Execute(const FeedsFetchesManager* init_run_feeds_fetch
     } else {
       fetches.clear();
     }
+
+    step_profiler.RecordPhase(GenerationStepProfiler::kStep, iteration_counter, step_start);
   }
 
+  step_profiler.LogSummary(this->context_.Logger());
+
   gsl::span<const float> final_beam_scores = beam_state.beam_scores;
   this->beam_scorer_->Finalize(cpu_state.sequences,
                                final_beam_scores,
@@ -2,10 +2,13 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <array>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
+#include "core/common/profiler.h"
 #include "core/common/span_utils.h"
 #include "contrib_ops/cpu/transformers/generation_shared.h"
 
@@ -86,6 +89,93 @@ inline void AllocateTempBufferForGetGreedySearchTopOne(
   output_tokens = gsl::make_span<int32_t>(output_token_data, output_element_size);
 }
 
+// Collects per-phase timing of the generation loop so a token latency regression can be pinned to
+// the decode step and phase where it happened. Timings surface in two ways:
+//  - when session profiling is enabled, one profiler event per phase per decode step is recorded
+//    with the name "<op>_step_<n>_<phase>", alongside the regular node events of the subgraph;
+//  - aggregate counters (count/total/max per phase) are always accumulated and can be queried via
+//    GetCounter or written to the verbose log with LogSummary. The cost is two clock reads per
+//    phase, so the counters stay on permanently and token latency can be compared across builds
+//    without a full profiling run.
+class GenerationStepProfiler {
+ public:
+  enum Phase : size_t {
+    kDecoderRun = 0,  // decoder subgraph execution for one step
+    kProcessLogits,   // logits processing and next token selection, including any host sync
+    kUpdateFeeds,     // feeding present state back as past state and building the next feeds
+    kStep,            // the whole decode step
+    kNumPhases
+  };
+
+  struct Counter {
+    uint64_t total_ns{0};
+    uint64_t max_ns{0};
+    uint64_t count{0};
+  };
+
+  GenerationStepProfiler(profiling::Profiler& profiler, const char* op_name)
+      : profiler_(profiler), op_name_(op_name) {}
+
+  TimePoint Start() const {
+    return std::chrono::high_resolution_clock::now();
+  }
+
+  void RecordPhase(Phase phase, int step, const TimePoint& phase_start) {
+    auto elapsed_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                std::chrono::high_resolution_clock::now() - phase_start)
+                                                .count());
+    Counter& counter = counters_[phase];
+    counter.total_ns += elapsed_ns;
+    counter.max_ns = std::max(counter.max_ns, elapsed_ns);
+    ++counter.count;
+
+    if (profiler_.IsEnabled()) {
+      profiler_.EndTimeAndRecordEvent(profiling::NODE_EVENT,
+                                      MakeString(op_name_, "_step_", step, "_", PhaseName(phase)),
+                                      phase_start,
+                                      {{"step", std::to_string(step)}});
+    }
+  }
+
+  const Counter& GetCounter(Phase phase) const {
+    return counters_[phase];
+  }
+
+  // Write one summary line per phase to the verbose log after the search has finished.
+  void LogSummary(const logging::Logger& logger) const {
+    for (size_t i = 0; i < kNumPhases; ++i) {
+      const Counter& counter = counters_[i];
+      if (counter.count == 0) {
+        continue;
+      }
+      VLOGS(logger, 1) << op_name_ << " " << PhaseName(static_cast<Phase>(i))
+                       << ": count=" << counter.count
+                       << " avg_us=" << static_cast<double>(counter.total_ns / counter.count) / 1000.0
+                       << " max_us=" << static_cast<double>(counter.max_ns) / 1000.0;
+    }
+  }
+
+  static const char* PhaseName(Phase phase) {
+    switch (phase) {
+      case kDecoderRun:
+        return "decoder_run";
+      case kProcessLogits:
+        return "process_logits";
+      case kUpdateFeeds:
+        return "update_feeds";
+      case kStep:
+        return "step";
+      default:
+        return "unknown";
+    }
+  }
+
+ private:
+  profiling::Profiler& profiler_;
+  const char* op_name_;
+  std::array<Counter, kNumPhases> counters_{};
+};
+
 class GenerateBase {
  public:
   GenerateBase(OpKernelContextInternal& context,
@@ -211,12 +211,19 @@ Status GreedySearchBase<T, ParametersT>::CheckInputs(const OpKernelContextIntern
   //   input_ids          : (batch_size, sequence_length)
   //   vocab_mask         : (vocab_size) or nullptr
   //   decoder_input_ids  : (batch_size, initial_decode_sequence_length)
+
+  // Input 7 is presence_mask for the Sampling operator. For GreedySearch it is draft_token_ids,
+  // which is validated where it is consumed.
+  const Tensor* presence_mask = std::is_same<ParametersT, SamplingParameters>::value
+                                    ? context.Input<Tensor>(7)
+                                    : nullptr;
+
   ORT_RETURN_IF_ERROR(this->CheckInputsImpl(parameters_,
                                             context.Input<Tensor>(0),     // input_ids
                                             context.Input<Tensor>(4),     // vocab_mask
                                             context.Input<Tensor>(5),     // prefix_vocab_mask
                                             context.Input<Tensor>(6),     // attention_mask
-                                            context.Input<Tensor>(7),     // presence_mask
+                                            presence_mask,
                                             context.Input<Tensor>(10)));  // decoder_input_ids
 
   return Status::OK();
@@ -3,8 +3,11 @@
 
 #pragma once
 #include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <vector>
 
+#include "core/common/inlined_containers.h"
 #include "core/common/span_utils.h"
 #include "contrib_ops/cpu/transformers/greedy_search_impl_base.h"
 
@@ -101,6 +104,30 @@ class GreedySearchGpt : public GreedySearchBase<T, ParametersT> {
       gsl::span<const int32_t> next_tokens,
       int past_sequence_length);
 
+  // Retire sequences that met EOS from the running batch: copy their result to the output,
+  // compact the per-row state, feeds and fetches down to the still-active rows, and shrink the
+  // batch size so later iterations no longer pay for finished sequences. CPU only, and not
+  // compatible with shared past/present buffers since those alias feeds and fetches.
+  Status RetireFinishedSequences(GreedySearchState<T>& greedy_state,
+                                 std::vector<OrtValue>& feeds,
+                                 std::vector<OrtValue>& fetches,
+                                 OrtValue& position_ids,
+                                 InlinedVector<int32_t>& row_to_batch,
+                                 gsl::span<int32_t> output_sequences);
+
+  // Decode the remaining tokens with draft-token verification: each subgraph call scores the last
+  // accepted token followed by the draft continuation, the longest prefix of the draft that matches
+  // the model's own greedy choices is accepted in one pass, and the past state is rolled back to
+  // the accepted length before the next call. The output is identical to one-token-at-a-time
+  // greedy decoding; once the sequence diverges from the draft this degrades to one token per call.
+  Status DecodeWithDraftTokens(const FeedsFetchesManager& feeds_fetches_manager,
+                               GreedySearchState<T>& greedy_state,
+                               std::vector<OrtValue>& feeds,
+                               std::vector<OrtValue>& fetches,
+                               gsl::span<const int32_t> draft_tokens,
+                               int32_t last_token,
+                               int& current_length);
+
   const SessionState* init_run_decoder_session_state_ = nullptr;
   GptSubgraph* init_run_gpt_subgraph_ = nullptr;
   GptSubgraph& gpt_subgraph_;
@@ -187,6 +214,261 @@ Status GreedySearchGpt<T, ParametersT>::UpdateFeeds(
                             false);
 }
 
+template <typename T, typename ParametersT>
+Status GreedySearchGpt<T, ParametersT>::RetireFinishedSequences(GreedySearchState<T>& greedy_state,
+                                                                std::vector<OrtValue>& feeds,
+                                                                std::vector<OrtValue>& fetches,
+                                                                OrtValue& position_ids,
+                                                                InlinedVector<int32_t>& row_to_batch,
+                                                                gsl::span<int32_t> output_sequences) {
+  ParametersT* parameters = this->parameters_;
+  const int batch_size = parameters->batch_size;
+  gsl::span<bool>& eos_meet = greedy_state.eos_meet;
+
+  InlinedVector<int32_t> kept_rows;
+  kept_rows.reserve(static_cast<size_t>(batch_size));
+  for (int row = 0; row < batch_size; ++row) {
+    if (eos_meet[row] == false) {
+      kept_rows.push_back(row);
+    }
+  }
+
+  const int active_batch_size = static_cast<int>(kept_rows.size());
+  if (active_batch_size == batch_size || active_batch_size == 0) {
+    return Status::OK();
+  }
+
+  // Finished rows will not be updated again, so copy their sequences to the output now.
+  for (int row = 0; row < batch_size; ++row) {
+    if (eos_meet[row]) {
+      auto batch_output = output_sequences.subspan(
+          static_cast<size_t>(row_to_batch[row]) * parameters->max_length,
+          parameters->max_length);
+      gsl::copy(greedy_state.sequences.GetSequence(row), batch_output);
+    }
+  }
+
+  // Compact the per-row state. kept_rows is ascending so rows only move towards the front.
+  for (int i = 0; i < active_batch_size; ++i) {
+    const int row = kept_rows[i];
+    if (row == i) {
+      continue;
+    }
+    row_to_batch[i] = row_to_batch[row];
+    greedy_state.next_tokens[i] = greedy_state.next_tokens[row];
+    greedy_state.next_positions[i] = greedy_state.next_positions[row];
+  }
+
+  // The stopping criteria scans the whole eos_meet buffer, so rows beyond the active batch
+  // stay marked as finished.
+  for (int row = 0; row < batch_size; ++row) {
+    eos_meet[row] = (row >= active_batch_size);
+  }
+
+  greedy_state.sequences.CompactBatch(gsl::make_span(kept_rows.data(), kept_rows.size()));
+
+  // Recreate position_ids over the compacted next_positions buffer with the new batch size.
+  int64_t position_dims[] = {active_batch_size, 1};
+  TensorShape position_shape(&position_dims[0], 2);
+  Tensor::InitOrtValue(DataTypeImpl::GetType<int32_t>(),
+                       position_shape,
+                       greedy_state.next_positions.data(),
+                       this->temp_space_allocator_->Info(),
+                       position_ids);
+
+  // Compact the attention mask feed. UpdateFeeds appends the column for the new token.
+  const Tensor& old_mask = feeds[2].Get<Tensor>();
+  const int64_t mask_length = old_mask.Shape()[1];
+  const int32_t* old_mask_data = old_mask.Data<int32_t>();
+  int64_t mask_dims[] = {active_batch_size, mask_length};
+  TensorShape mask_shape(&mask_dims[0], 2);
+  OrtValue attention_mask;
+  Tensor::InitOrtValue(DataTypeImpl::GetType<int32_t>(), mask_shape, this->temp_space_allocator_, attention_mask);
+  int32_t* mask_data = attention_mask.GetMutable<Tensor>()->MutableData<int32_t>();
+  for (int i = 0; i < active_batch_size; ++i) {
+    std::memcpy(mask_data + static_cast<int64_t>(i) * mask_length,
+                old_mask_data + static_cast<int64_t>(kept_rows[i]) * mask_length,
+                static_cast<size_t>(mask_length) * sizeof(int32_t));
+  }
+  feeds[2] = attention_mask;
+
+  // Compact the present state fetches, which UpdateFeeds feeds back as past state.
+  for (size_t j = static_cast<size_t>(gpt_subgraph_.GetFirstPresentOutputIndex()); j < fetches.size(); ++j) {
+    const Tensor& present = fetches[j].Get<Tensor>();
+    // Present state has shape (2, batch_size, num_heads, past_seq_len, head_size).
+    auto present_dims = present.Shape().AsShapeVector();
+    const int64_t row_bytes = present.Shape().SizeFromDimension(2) * static_cast<int64_t>(present.DataType()->Size());
+    present_dims[1] = active_batch_size;
+    OrtValue compacted;
+    Tensor::InitOrtValue(present.DataType(), TensorShape(present_dims), this->temp_space_allocator_, compacted);
+    const char* present_data = static_cast<const char*>(present.DataRaw());
+    char* compacted_data = static_cast<char*>(compacted.GetMutable<Tensor>()->MutableDataRaw());
+    for (int64_t kv = 0; kv < 2; ++kv) {
+      for (int i = 0; i < active_batch_size; ++i) {
+        std::memcpy(compacted_data + (kv * active_batch_size + i) * row_bytes,
+                    present_data + (kv * batch_size + kept_rows[i]) * row_bytes,
+                    static_cast<size_t>(row_bytes));
+      }
+    }
+    fetches[j] = compacted;
+  }
+
+  parameters->batch_size = active_batch_size;
+
+  return Status::OK();
+}
+
+template <typename T, typename ParametersT>
+Status GreedySearchGpt<T, ParametersT>::DecodeWithDraftTokens(const FeedsFetchesManager& feeds_fetches_manager,
+                                                              GreedySearchState<T>& greedy_state,
+                                                              std::vector<OrtValue>& feeds,
+                                                              std::vector<OrtValue>& fetches,
+                                                              gsl::span<const int32_t> draft_tokens,
+                                                              int32_t last_token,
+                                                              int& current_length) {
+  ParametersT* parameters = this->parameters_;
+  const int vocab_size = parameters->vocab_size;
+  const int prompt_length = parameters->sequence_length;
+  const int first_past_input_idx = gpt_subgraph_.GetFirstPastInputIndex();
+  const int first_present_output_idx = gpt_subgraph_.GetFirstPresentOutputIndex();
+  auto int32_type = DataTypeImpl::GetType<int32_t>();
+
+  // Position of the next input token, and the attention mask over the accepted sequence.
+  // Both stay at length current_length - 1, matching the past state.
+  int32_t next_position = greedy_state.next_positions[0];
+  gsl::span<const int32_t> entry_mask = feeds[2].Get<Tensor>().DataAsSpan<int32_t>();
+  InlinedVector<int32_t> attention_mask(entry_mask.begin(), entry_mask.end());
+
+  while (current_length < parameters->max_length) {
+    // Feed the present state back as past, rolled back to the accepted length. Tokens of the
+    // window that were rejected in the previous pass have their key/value entries dropped here.
+    const int64_t past_length = current_length - 1;
+    for (size_t i = static_cast<size_t>(first_present_output_idx); i < fetches.size(); ++i) {
+      const size_t past_idx = static_cast<size_t>(first_past_input_idx) + i - first_present_output_idx;
+      const Tensor& present = fetches[i].Get<Tensor>();
+      // Present state has shape (2, 1, num_heads, total_length, head_size).
+      auto present_dims = present.Shape().AsShapeVector();
+      if (present_dims[3] == past_length) {
+        feeds[past_idx] = fetches[i];
+        continue;
+      }
+
+      const int64_t head_size = present_dims[4];
+      const int64_t block_count = present_dims[0] * present_dims[1] * present_dims[2];
+      const int64_t present_block_elements = present_dims[3] * head_size;
+      const int64_t past_block_elements = past_length * head_size;
+      present_dims[3] = past_length;
+      OrtValue past_value;
+      Tensor::InitOrtValue(present.DataType(), TensorShape(present_dims), this->temp_space_allocator_, past_value);
+      const T* present_data = present.Data<T>();
+      T* past_data = past_value.GetMutable<Tensor>()->MutableData<T>();
+      for (int64_t block = 0; block < block_count; ++block) {
+        std::memcpy(past_data + block * past_block_elements,
+                    present_data + block * present_block_elements,
+                    static_cast<size_t>(past_block_elements) * sizeof(T));
+      }
+      feeds[past_idx] = past_value;
+    }
+
+    // The window is the last accepted token followed by the draft continuation, as long as the
+    // accepted sequence still matches the draft. draft_tokens[i] is the draft for generated
+    // position prompt_length + i.
+    InlinedVector<int32_t> window;
+    window.push_back(last_token);
+    const int draft_index = current_length - 1 - prompt_length;
+    if (static_cast<size_t>(draft_index) < draft_tokens.size() && draft_tokens[draft_index] == last_token) {
+      const int max_window = parameters->max_length - current_length;
+      for (int j = 1; j < max_window && static_cast<size_t>(draft_index + j) < draft_tokens.size(); ++j) {
+        window.push_back(draft_tokens[draft_index + j]);
+      }
+    }
+    const int window_length = static_cast<int>(window.size());
+
+    OrtValue input_ids;
+    int64_t input_ids_dims[] = {1, window_length};
+    Tensor::InitOrtValue(int32_type, TensorShape(&input_ids_dims[0], 2), this->temp_space_allocator_, input_ids);
+    std::memcpy(input_ids.GetMutable<Tensor>()->MutableData<int32_t>(), window.data(),
+                window.size() * sizeof(int32_t));
+    feeds[0] = input_ids;
+
+    OrtValue position_ids;
+    Tensor::InitOrtValue(int32_type, TensorShape(&input_ids_dims[0], 2), this->temp_space_allocator_, position_ids);
+    int32_t* position_data = position_ids.GetMutable<Tensor>()->MutableData<int32_t>();
+    for (int j = 0; j < window_length; ++j) {
+      position_data[j] = next_position + j;
+    }
+    feeds[1] = position_ids;
+
+    OrtValue mask_value;
+    int64_t mask_dims[] = {1, static_cast<int64_t>(attention_mask.size()) + window_length};
+    Tensor::InitOrtValue(int32_type, TensorShape(&mask_dims[0], 2), this->temp_space_allocator_, mask_value);
+    int32_t* mask_data = mask_value.GetMutable<Tensor>()->MutableData<int32_t>();
+    std::memcpy(mask_data, attention_mask.data(), attention_mask.size() * sizeof(int32_t));
+    for (int j = 0; j < window_length; ++j) {
+      mask_data[attention_mask.size() + j] = 1;
+    }
+    feeds[2] = mask_value;
+
+    fetches.clear();
+
+#ifdef DEBUG_NODE_INPUTS_OUTPUTS
+    const_cast<SessionState&>(this->decoder_session_state_).IncrementGraphExecutionCounter();
+#endif
+    ORT_RETURN_IF_ERROR(utils::ExecuteSubgraph(this->decoder_session_state_,
+                                               feeds_fetches_manager,
+                                               feeds,
+                                               fetches,
+                                               {},
+                                               ExecutionMode::ORT_SEQUENTIAL,
+                                               this->context_.GetTerminateFlag(),
+                                               this->context_.Logger(),
+                                               this->ort_stream_));
+
+    // Verify the window: accept the model's greedy choice for every position while it agrees with
+    // the draft, plus the first correction after a mismatch. Logits shape is (1, window, vocab).
+    const T* logits_data = fetches[0].Get<Tensor>().Data<T>();
+    int accepted = 0;
+    bool reached_eos = false;
+    for (int j = 0; j < window_length; ++j) {
+      const T* step_logits = logits_data + static_cast<size_t>(j) * vocab_size;
+      int32_t next_token = 0;
+      for (int v = 1; v < vocab_size; ++v) {
+        if (step_logits[v] > step_logits[next_token]) {
+          next_token = v;
+        }
+      }
+
+      gsl::span<int32_t> next_token_span(&next_token, 1);
+      greedy_state.sequences.AppendNextTokenToSequences(next_token_span);
+      ++current_length;
+      ++accepted;
+      last_token = next_token;
+
+      if (next_token == parameters->eos_token_id) {
+        reached_eos = true;
+        break;
+      }
+      if (current_length == parameters->max_length) {
+        break;
+      }
+      if (j + 1 < window_length && next_token != window[j + 1]) {
+        break;  // The draft diverged; the correction has been appended.
+      }
+    }
+
+    if (reached_eos) {
+      greedy_state.eos_meet[0] = true;
+      break;
+    }
+
+    next_position += accepted;
+    greedy_state.next_positions[0] = next_position;
+    attention_mask.resize(attention_mask.size() + static_cast<size_t>(accepted), 1);
+  }
+
+  return Status::OK();
+}
+
 template <typename T, typename ParametersT>
 Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_run_feeds_fetches_manager,
                                                 const FeedsFetchesManager& feeds_fetches_manager) {
@@ -197,6 +479,45 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
   int64_t sequences_dims[] = {parameters->batch_size, parameters->max_length};
   TensorShape sequences_shape(&sequences_dims[0], sizeof(sequences_dims) / sizeof(sequences_dims[0]));
   Tensor* output_sequences = this->context_.Output(0, sequences_shape);
+  gsl::span<int32_t> output = output_sequences->MutableDataAsSpan<int32_t>();
+
+  // Sequences that meet EOS are retired from the running batch between iterations, so mixed
+  // batches stop paying subgraph cost for rows that already finished. Shared past/present
+  // buffers alias feeds and fetches and cannot be compacted, and the sampling state keeps
+  // per-row buffers sized for the full batch.
+  const bool retire_finished_sequences = !this->IsCuda() &&
+                                         !gpt_subgraph_.past_present_share_buffer_ &&
+                                         !std::is_same<ParametersT, SamplingParameters>::value;
+
+  // Maps a row of the (possibly compacted) running batch back to its position in the output.
+  InlinedVector<int32_t> row_to_batch(static_cast<size_t>(parameters->batch_size));
+  std::iota(row_to_batch.begin(), row_to_batch.end(), 0);
+
+  // An optional draft continuation enables speculative verification: score the draft window in one
+  // decoder pass and accept the longest prefix that matches the model's own greedy choices. This
+  // is only lossless when no logits processor rewrites the scores, and the implementation is
+  // limited to the CPU single-batch path without a shared past/present buffer.
+  gsl::span<const int32_t> draft_tokens;
+  if (!std::is_same<ParametersT, SamplingParameters>::value) {
+    const Tensor* draft_tokens_tensor = this->context_.Input<Tensor>(7);
+    if (draft_tokens_tensor != nullptr) {
+      const auto& draft_dims = draft_tokens_tensor->Shape().GetDims();
+      if (draft_dims.size() != 2 || draft_dims[0] != parameters->batch_size) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Input 'draft_token_ids' is expected to have shape (batch_size, draft_length)");
+      }
+
+      const bool plain_greedy = parameters->repetition_penalty == 1.0f &&
+                                parameters->no_repeat_ngram_size == 0 &&
+                                parameters->min_length == 0 &&
+                                parameters->vocab_mask.empty() &&
+                                parameters->prefix_vocab_mask.empty();
+      if (parameters->batch_size == 1 && plain_greedy && !this->IsCuda() &&
+          !gpt_subgraph_.past_present_share_buffer_) {
+        draft_tokens = draft_tokens_tensor->DataAsSpan<int32_t>();
+      }
+    }
+  }
 
   std::vector<OrtValue> feeds;
   std::vector<OrtValue> fetches;
@@ -268,9 +589,12 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
                        this->temp_space_allocator_->Info(),
                        position_ids);
 
+  GenerationStepProfiler step_profiler(this->decoder_session_state_.Profiler(), "GreedySearchGpt");
+
   int current_length = parameters->sequence_length;
   int iteration_counter = 0;
   while (current_length < parameters->max_length) {
+    const TimePoint step_start = step_profiler.Start();
 #ifdef DEBUG_GENERATION
     auto cur_len = std::to_string(current_length);
     dumper->Print("***CurrentLength", cur_len, true);
@@ -280,6 +604,8 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
     dumper->Print("past", feeds[3]);
 #endif
 
+    const TimePoint decoder_run_start = step_profiler.Start();
+
     // For the first iteration use the init_run_decoder subgraph (if present)
     if (iteration_counter++ == 0 &&
         init_run_decoder_session_state_ != nullptr) {
@@ -311,7 +637,9 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
     }
 
     ORT_RETURN_IF_ERROR(status);
+    step_profiler.RecordPhase(GenerationStepProfiler::kDecoderRun, iteration_counter, decoder_run_start);
 
+    const TimePoint process_logits_start = step_profiler.Start();
     const OrtValue& logits = fetches[0];
     gsl::span<int32_t> next_tokens;
 
@@ -321,6 +649,7 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
                                                 sampling_state,
                                                 iteration_counter,
                                                 parameters->eos_token_id));
+    step_profiler.RecordPhase(GenerationStepProfiler::kProcessLogits, iteration_counter, process_logits_start);
 
     // When all batches are finished, stop earlier to avoid wasting computation.
     gsl::span<bool>& eos_meet = greedy_state.eos_meet;
@@ -338,6 +667,12 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
     // Increase sequence length after a new token is generated.
     ++current_length;
 
+    if (!draft_tokens.empty() && current_length < parameters->max_length) {
+      ORT_RETURN_IF_ERROR(DecodeWithDraftTokens(feeds_fetches_manager, greedy_state, feeds, fetches,
+                                                draft_tokens, next_tokens[0], current_length));
+      break;
+    }
+
 #ifdef USE_CUDA
     // Reorder past state after first run if the GPT subgraph (the one used after the first iteration)
     // contains DecoderMaskedSelfAttention nodes
@@ -361,10 +696,18 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
     if (current_length < parameters->max_length) {
       bool increase_position = (iteration_counter > 1);
 
+      if (retire_finished_sequences) {
+        ORT_RETURN_IF_ERROR(RetireFinishedSequences(greedy_state, feeds, fetches, position_ids,
+                                                    row_to_batch, output));
+      }
+
+      const TimePoint update_feeds_start = step_profiler.Start();
       ORT_RETURN_IF_ERROR(UpdateFeeds(fetches, feeds, current_length,
                                       position_ids, increase_position,
-                                      ReinterpretAsSpan<const int32_t>(next_tokens),
+                                      ReinterpretAsSpan<const int32_t>(next_tokens)
+                                          .first(static_cast<size_t>(parameters->batch_size)),
                                       current_length - 1));
+      step_profiler.RecordPhase(GenerationStepProfiler::kUpdateFeeds, iteration_counter, update_feeds_start);
     }
     if (gpt_subgraph_.past_present_share_buffer_) {
       // clear fetched values before presents[]
@@ -374,13 +717,17 @@ Status GreedySearchGpt<T, ParametersT>::Execute(const FeedsFetchesManager* init_
     } else {
       fetches.clear();
     }
+
+    step_profiler.RecordPhase(GenerationStepProfiler::kStep, iteration_counter, step_start);
   }
 
-  // Copy the sequences to output
-  gsl::span<int32_t> output = output_sequences->MutableDataAsSpan<int32_t>();
+  step_profiler.LogSummary(this->context_.Logger());
+
+  // Copy the still-running sequences to output. Rows retired during the search have already
+  // been copied.
   for (int batch_id = 0; batch_id < parameters->batch_size; ++batch_id) {
     auto batch_output = output.subspan(
-        static_cast<size_t>(batch_id) * parameters->max_length,
+        static_cast<size_t>(row_to_batch[batch_id]) * parameters->max_length,
         parameters->max_length);
     gsl::span<const int32_t> sequence_source = greedy_state.sequences.GetSequence(batch_id);
     gsl::copy(sequence_source, batch_output);
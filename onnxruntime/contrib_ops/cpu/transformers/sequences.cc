@@ -81,6 +81,26 @@ void Sequences::AppendNextTokenToSequences(gsl::span<int32_t>& next_tokens) {
   ++current_length_;
 }
 
+void Sequences::CompactBatch(gsl::span<const int32_t> kept_rows) {
+  // kept_rows is ascending, so each row moves towards the front and never overwrites a row
+  // that still needs to be read.
+  for (size_t i = 0; i < kept_rows.size(); i++) {
+    const int source_row = kept_rows[i];
+    if (source_row == static_cast<int>(i)) {
+      continue;
+    }
+    for (auto& buffer : sequences) {
+      gsl::span<const int32_t> source = buffer.subspan(SafeInt<size_t>(source_row) * max_length_,
+                                                       static_cast<gsl::index>(current_length_));
+      gsl::span<int32_t> target = buffer.subspan(SafeInt<size_t>(i) * max_length_,
+                                                 static_cast<gsl::index>(current_length_));
+      gsl::copy(source, target);
+    }
+  }
+
+  batch_beam_size_ = static_cast<int>(kept_rows.size());
+}
+
 void Sequences::AfterDeviceAppendedNextToken() {
   ++current_length_;
   current_sequences_buffer ^= 1;
@@ -40,6 +40,10 @@ class Sequences : public ISequences {
 
   void AfterDeviceAppendedNextToken();
 
+  // Move the rows listed in kept_rows (ascending order) to the front of the buffers and shrink
+  // the batch, so finished sequences can be dropped from the running batch.
+  void CompactBatch(gsl::span<const int32_t> kept_rows);
+
  private:
   // Two buffers of shape (batch_size, num_beams, max_seq_length) to store sequences.
   // At each time, there is only one buffer is active. The other one will be active in next token.
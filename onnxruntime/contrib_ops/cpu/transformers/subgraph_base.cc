@@ -54,7 +54,10 @@ Subgraph::Subgraph(
   for (const auto& n : subgraph.Nodes()) {
     if (n.OpType() == "DecoderMaskedSelfAttention" || n.OpType() == "DecoderMaskedMultiHeadAttention") {
       has_decoder_masked_attention_ = true;
-      break;
+      if (n.OpType() == "DecoderMaskedMultiHeadAttention") {
+        has_decoder_masked_multihead_attention_ = true;
+        break;
+      }
     }
   }
 }
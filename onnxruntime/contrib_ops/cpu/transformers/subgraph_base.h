@@ -45,6 +45,9 @@ class Subgraph {
   int num_layers;
   bool past_present_share_buffer_;
   bool has_decoder_masked_attention_;
+  // True only when cross attention also runs through DecoderMaskedMultiHeadAttention,
+  // which can read a cross K/V cache shared across beams.
+  bool has_decoder_masked_multihead_attention_ = false;
   bool output_cross_qk_ = false;
 
   // Setup execution
@@ -232,6 +232,14 @@ Status WhisperDecoderSubgraph::CreateInitialFeeds(
       // past key/value for cross attention does not need to be initialized with max_seq_len since they are static.
       bool use_max_seq_len = (j - first_past_input_index_) <= 2 * static_cast<size_t>(num_layers);
 
+      if (!use_max_seq_len && has_decoder_masked_multihead_attention_) {
+        // DecoderMaskedMultiHeadAttention indexes the cross-attention cache with the
+        // beam-aware batch index, so the encoder's K/V can stay device-resident with a
+        // single copy per batch entry shared across beams instead of being tiled per beam.
+        decoder_feeds.push_back(encoder_fetches[j]);
+        continue;
+      }
+
       OrtValue expanded_cache;
       if (is_output_float16_) {
         ORT_RETURN_IF_ERROR(expand_buffer_float16_func(stream,
@@ -0,0 +1,254 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cctype>
+#include <string_view>
+#include <unordered_map>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/common/narrow.h"
+#include "core/common/safeint.h"
+#include "core/common/utf8_util.h"
+#include "core/framework/op_kernel.h"
+#include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+namespace wordpiece_details {
+
+// Byte-level trie over the vocabulary. A forward walk that records the deepest
+// node carrying a token id yields the longest matching piece in a single pass
+// over the word, instead of hashing every candidate substring.
+class VocabTrie {
+ public:
+  VocabTrie() : token_ids_{-1} {}
+
+  void Insert(std::string_view token, int32_t id) {
+    int32_t node = 0;
+    for (char c : token) {
+      const int64_t key = (static_cast<int64_t>(node) << 8) | static_cast<unsigned char>(c);
+      auto hit = children_.find(key);
+      if (hit == children_.end()) {
+        const int32_t child = narrow<int32_t>(token_ids_.size());
+        token_ids_.push_back(-1);
+        hit = children_.emplace(key, child).first;
+      }
+      node = hit->second;
+    }
+    token_ids_[narrow<size_t>(node)] = id;
+  }
+
+  // Returns the id of the longest vocabulary entry that is a prefix of
+  // text[start..) and sets match_len to its byte length, or -1 if none matches.
+  int32_t LongestMatch(std::string_view text, size_t start, size_t& match_len) const {
+    int32_t node = 0;
+    int32_t best_id = -1;
+    match_len = 0;
+    for (size_t pos = start; pos < text.size(); ++pos) {
+      const int64_t key = (static_cast<int64_t>(node) << 8) | static_cast<unsigned char>(text[pos]);
+      auto hit = children_.find(key);
+      if (hit == children_.end()) {
+        break;
+      }
+      node = hit->second;
+      const int32_t id = token_ids_[narrow<size_t>(node)];
+      if (id >= 0) {
+        best_id = id;
+        match_len = pos - start + 1;
+      }
+    }
+    return best_id;
+  }
+
+ private:
+  // token_ids_[node] is the vocabulary id terminating at that node, -1 if none.
+  // Node 0 is the root. Children are keyed by (parent << 8) | byte.
+  InlinedVector<int32_t> token_ids_;
+  std::unordered_map<int64_t, int32_t> children_;
+};
+
+}  // namespace wordpiece_details
+
+class WordpieceEncoder final : public OpKernel {
+ public:
+  explicit WordpieceEncoder(const OpKernelInfo& info);
+  WordpieceEncoder(const WordpieceEncoder&) = delete;
+  WordpieceEncoder& operator=(const WordpieceEncoder&) = delete;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  void EncodeRow(std::string_view text, int64_t* input_ids, int64_t* attention_mask,
+                 int64_t* token_type_ids) const;
+  void EncodeWord(std::string_view word, InlinedVector<int64_t>& ids) const;
+
+  // Word-initial pieces and suffix pieces (vocabulary entries carrying the
+  // suffix indicator, stored with the indicator stripped) live in separate tries.
+  wordpiece_details::VocabTrie initial_pieces_;
+  wordpiece_details::VocabTrie suffix_pieces_;
+
+  int64_t max_length_{0};
+  bool do_lower_case_{true};
+  int32_t unk_id_{-1};
+  int32_t cls_id_{-1};
+  int32_t sep_id_{-1};
+  int32_t pad_id_{-1};
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    WordpieceEncoder,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<std::string>())
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<int64_t>()),
+    WordpieceEncoder);
+
+WordpieceEncoder::WordpieceEncoder(const OpKernelInfo& info) : OpKernel(info) {
+  std::vector<std::string> vocab;
+  auto status = info.GetAttrs("vocab", vocab);
+  ORT_ENFORCE(status.IsOK(), "attribute vocab is not set");
+  ORT_ENFORCE(!vocab.empty(), "vocab must not be empty");
+
+  status = info.GetAttr("max_length", &max_length_);
+  ORT_ENFORCE(status.IsOK(), "attribute max_length is not set");
+  ORT_ENFORCE(max_length_ >= 2, "max_length must be at least 2 to fit the start/end tokens");
+
+  do_lower_case_ = info.GetAttrOrDefault<int64_t>("do_lower_case", 1) != 0;
+  const std::string suffix_indicator = info.GetAttrOrDefault<std::string>("suffix_indicator", "##");
+  const std::string unk_token = info.GetAttrOrDefault<std::string>("unk_token", "[UNK]");
+  const std::string cls_token = info.GetAttrOrDefault<std::string>("cls_token", "[CLS]");
+  const std::string sep_token = info.GetAttrOrDefault<std::string>("sep_token", "[SEP]");
+  const std::string pad_token = info.GetAttrOrDefault<std::string>("pad_token", "[PAD]");
+
+  for (size_t i = 0, vocab_size = vocab.size(); i < vocab_size; ++i) {
+    const std::string& token = vocab[i];
+    const auto id = narrow<int32_t>(i);
+    std::string_view piece{token};
+    if (!suffix_indicator.empty() && piece.size() > suffix_indicator.size() &&
+        piece.compare(0, suffix_indicator.size(), suffix_indicator) == 0) {
+      suffix_pieces_.Insert(piece.substr(suffix_indicator.size()), id);
+    } else {
+      initial_pieces_.Insert(piece, id);
+    }
+
+    if (token == unk_token) {
+      unk_id_ = id;
+    } else if (token == cls_token) {
+      cls_id_ = id;
+    } else if (token == sep_token) {
+      sep_id_ = id;
+    } else if (token == pad_token) {
+      pad_id_ = id;
+    }
+  }
+
+  ORT_ENFORCE(unk_id_ >= 0, "unk_token is not present in vocab: ", unk_token);
+  ORT_ENFORCE(cls_id_ >= 0, "cls_token is not present in vocab: ", cls_token);
+  ORT_ENFORCE(sep_id_ >= 0, "sep_token is not present in vocab: ", sep_token);
+  ORT_ENFORCE(pad_id_ >= 0, "pad_token is not present in vocab: ", pad_token);
+}
+
+void WordpieceEncoder::EncodeWord(std::string_view word, InlinedVector<int64_t>& ids) const {
+  const size_t first_piece = ids.size();
+  size_t start = 0;
+  while (start < word.size()) {
+    const auto& trie = start == 0 ? initial_pieces_ : suffix_pieces_;
+    size_t match_len = 0;
+    const int32_t id = trie.LongestMatch(word, start, match_len);
+    if (id < 0) {
+      // The whole word maps to a single unknown token, not each unmatched piece.
+      ids.resize(first_piece);
+      ids.push_back(unk_id_);
+      return;
+    }
+    ids.push_back(id);
+    start += match_len;
+  }
+}
+
+void WordpieceEncoder::EncodeRow(std::string_view text, int64_t* input_ids,
+                                 int64_t* attention_mask, int64_t* token_type_ids) const {
+  InlinedVector<int64_t> ids;
+  ids.push_back(cls_id_);
+
+  std::string word;
+  auto flush_word = [&]() {
+    if (!word.empty()) {
+      EncodeWord(word, ids);
+      word.clear();
+    }
+  };
+
+  for (char c : text) {
+    const auto uc = static_cast<unsigned char>(c);
+    if (std::isspace(uc)) {
+      flush_word();
+    } else if (uc < 0x80 && std::ispunct(uc)) {
+      // ASCII punctuation always forms a word of its own.
+      flush_word();
+      word.assign(1, c);
+      flush_word();
+    } else {
+      word.push_back(do_lower_case_ && uc < 0x80 ? static_cast<char>(std::tolower(uc)) : c);
+    }
+  }
+  flush_word();
+
+  // Reserve the last slot for the end token, truncating the pieces if needed.
+  const auto max_len = narrow<size_t>(max_length_);
+  if (ids.size() > max_len - 1) {
+    ids.resize(max_len - 1);
+  }
+  ids.push_back(sep_id_);
+
+  const size_t real_tokens = ids.size();
+  for (size_t i = 0; i < max_len; ++i) {
+    input_ids[i] = i < real_tokens ? ids[i] : pad_id_;
+    attention_mask[i] = i < real_tokens ? 1 : 0;
+    token_type_ids[i] = 0;
+  }
+}
+
+Status WordpieceEncoder::Compute(OpKernelContext* ctx) const {
+  const auto* X = ctx->Input<Tensor>(0);
+  if (X == nullptr) return Status(common::ONNXRUNTIME, common::FAIL, "input count mismatch");
+
+  auto& input_shape = X->Shape();
+  if (input_shape.NumDimensions() != 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input must have shape [N]");
+  }
+
+  const auto input_span = X->DataAsSpan<std::string>();
+  // Validate up front so the parallel encoding loop below has no failure path.
+  for (const auto& s : input_span) {
+    size_t utf8_chars = 0;
+    if (!utf8_util::utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(), utf8_chars)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input string contains invalid utf8 chars");
+    }
+  }
+
+  const int64_t N = input_shape[0];
+  TensorShape output_shape({N, max_length_});
+  auto* input_ids = ctx->Output(0, output_shape)->MutableData<int64_t>();
+  auto* attention_mask = ctx->Output(1, output_shape)->MutableData<int64_t>();
+  auto* token_type_ids = ctx->Output(2, output_shape)->MutableData<int64_t>();
+
+  concurrency::ThreadPool::TryBatchParallelFor(
+      ctx->GetOperatorThreadPool(), narrow<ptrdiff_t>(N),
+      [&](ptrdiff_t row) {
+        const auto offset = SafeInt<size_t>(row) * max_length_;
+        EncodeRow(input_span[narrow<size_t>(row)], input_ids + offset,
+                  attention_mask + offset, token_type_ids + offset);
+      },
+      0);
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
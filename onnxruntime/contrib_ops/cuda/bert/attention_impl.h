@@ -51,6 +51,12 @@ size_t GetAttentionWorkspaceSize(
 template <typename T>
 struct AttentionData {
   T* gemm_buffer = nullptr;
+
+  // Attention operator only: set when gemm_buffer already holds Q/K/V transposed to 3xBxNxSxH with
+  // bias applied (quantized attention fuses the dequantize with the bias add and transpose), so
+  // PrepareQkv can use the buffer in place instead of transposing it into the workspace.
+  bool gemm_buffer_transposed = false;
+
   const T* bias = nullptr;
 
   const T* query = nullptr;
@@ -37,9 +37,18 @@ Status PrepareQkv_Attention(contrib::AttentionParameters& parameters,
     // For quantized attention, bias has been added so only need transpose here.
     // gemm_buffer should be BxSx3xNxH => qkv: 3xBxNxSxH
     assert(qk_head_size == v_head_size);
-    int matrix_to_trans = (past_present_share_buffer ? 1 : 3);
-    ORT_RETURN_IF_ERROR(LaunchTransQkv(stream, matrix_to_trans, sequence_length, batch_size, qk_head_size, num_heads,
-                                       max_threads_per_block, false, data.gemm_buffer, qkv, 3));
+    if (data.gemm_buffer_transposed && !past_present_share_buffer) {
+      // the dequantize kernel already produced 3xBxNxSxH, so use the gemm buffer in place.
+      const size_t elements = static_cast<size_t>(batch_size) * num_heads * sequence_length * qk_head_size;
+      data.q = data.gemm_buffer;
+      data.k = data.gemm_buffer + elements;
+      data.v = data.k + elements;
+      data.scratch = data.workspace;
+    } else {
+      int matrix_to_trans = (past_present_share_buffer ? 1 : 3);
+      ORT_RETURN_IF_ERROR(LaunchTransQkv(stream, matrix_to_trans, sequence_length, batch_size, qk_head_size, num_heads,
+                                         max_threads_per_block, false, data.gemm_buffer, qkv, 3));
+    }
     qkv_format = AttentionQkvFormat::Q_K_V_BNSH;
   } else {
     // For fused TRT attention, transpose qkv to BxSxNx3xH (format 2)
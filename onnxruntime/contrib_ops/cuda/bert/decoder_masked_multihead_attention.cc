@@ -76,6 +76,13 @@ Status DecoderMaskedMultiHeadAttention<T1, T2>::ComputeInternal(OpKernelContext*
 
   bool is_unidirectional = false;
   bool is_dmmha_packing = (key == nullptr && value == nullptr);
+
+  // Beam width (in case we are using this op inside BeamSearch). Needed up front since the
+  // cross-attention K/V cache may hold a single copy per batch entry shared by all beams.
+  if (beam_width != nullptr) {
+    parameters.beam_width = static_cast<int>(*beam_width->Data<int32_t>());
+  }
+
   ORT_RETURN_IF_ERROR(multihead_attention_helper::CheckInputs<Tensor>(query,
                                                                       key,
                                                                       value,
@@ -92,7 +99,8 @@ Status DecoderMaskedMultiHeadAttention<T1, T2>::ComputeInternal(OpKernelContext*
                                                                       is_unidirectional,
                                                                       past_present_share_buffer_,
                                                                       is_dmmha_packing,  // dmmha_packing
-                                                                      device_prop.maxThreadsPerBlock));
+                                                                      device_prop.maxThreadsPerBlock,
+                                                                      parameters.beam_width));
 
   if (bias) {
     const T1* bias_data = bias->Data<T1>();
@@ -155,6 +163,9 @@ Status DecoderMaskedMultiHeadAttention<T1, T2>::ComputeInternal(OpKernelContext*
     }
 
     parameters.is_cross_attention = true;
+    // BeamSearch may pass the encoder's K/V once per batch entry instead of tiling them
+    // per beam; the kernel then indexes the cache with the beam-aware batch index.
+    parameters.kv_shared_across_beams = key->Shape().GetDims()[0] != parameters.batch_size;
     parameters.total_sequence_length = parameters.kv_sequence_length;
     parameters.max_sequence_length = parameters.kv_sequence_length;
     // parameters.k and paraneters.v are nullptr
@@ -220,11 +231,6 @@ Status DecoderMaskedMultiHeadAttention<T1, T2>::ComputeInternal(OpKernelContext*
     parameters.mask = mask_index->Data<int32_t>();
   }
 
-  // Beam width (in case we are using this op inside BeamSearch)
-  if (beam_width != nullptr) {
-    parameters.beam_width = static_cast<int>(*beam_width->Data<int32_t>());
-  }
-
   // Cache indirection (in case we are using this op inside BeamSearch)
   if (parameters.beam_width > 1) {
     // If beam width > 1, then cache indirection buffer MUST be present
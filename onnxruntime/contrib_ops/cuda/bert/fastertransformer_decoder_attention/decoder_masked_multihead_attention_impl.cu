@@ -130,6 +130,11 @@ __global__ void masked_multihead_attention_kernel(DecoderMaskedMultiHeadAttentio
   // Combine the "beam-aware" batch idx and the head indices.
   const int bbhi = bbi * params.beam_width * params.num_heads + hi;
 
+  // Base batch/head index into the K/V cache. When the cross-attention cache is
+  // shared across beams it holds one copy per batch entry, so the beam-aware
+  // batch index is not scaled by the beam width.
+  const int kv_bhi = params.kv_shared_across_beams ? bbi * params.num_heads + hi : bbhi;
+
   // The thread in the block.
   const int tidx = threadIdx.x;
 
@@ -335,7 +340,7 @@ __global__ void masked_multihead_attention_kernel(DecoderMaskedMultiHeadAttentio
   constexpr int K_PER_WARP = WARP_SIZE / THREADS_PER_KEY;
 
   // Base pointer for the beam's batch, before offsetting with indirection buffer
-  T* k_cache_batch = &params_k_cache[bbhi * params.max_sequence_length * head_size + ki];
+  T* k_cache_batch = &params_k_cache[kv_bhi * params.max_sequence_length * head_size + ki];
 
   // Pick a number of keys to make sure all the threads of a warp enter (due to shfl_sync).
   int ti_end = ((tlength + K_PER_WARP - 1) / K_PER_WARP) * K_PER_WARP;
@@ -573,7 +578,7 @@ __global__ void masked_multihead_attention_kernel(DecoderMaskedMultiHeadAttentio
   T* v_cache = &params_v_cache[bhi * params.max_sequence_length * head_size + vi];
 
   // Base pointer for the beam's batch, before offsetting with indirection buffer
-  T* v_cache_batch = &params_v_cache[bbhi * params.max_sequence_length * head_size + vi];
+  T* v_cache_batch = &params_v_cache[kv_bhi * params.max_sequence_length * head_size + vi];
 
   // The number of values processed per iteration of the loop.
   constexpr int V_PER_ITER = THREADS_PER_BLOCK / THREADS_PER_VALUE;
@@ -22,6 +22,10 @@ struct DecoderMaskedMultiHeadAttentionParams : AttentionParameters {
   bool is_cross_attention = false;
   bool is_packed_qkv = false;
 
+  // The cross-attention K/V cache holds a single copy per batch entry that is
+  // shared by all beams, instead of one (identical) copy per beam.
+  bool kv_shared_across_beams = false;
+
   // Useful to better use global memory bandwidth on certain CUDA architectures.
   // Turned off by default for now until we fully understand performance implications
   // for all types of workloads.
@@ -377,6 +377,265 @@ Status LaunchConcatKVInPlace(contrib::GroupQueryAttentionParameters& parameters,
                                max_threads_per_block);
 }
 
+// Kernel to append new kv into a paged kv cache pool through a block table
+template <typename T>
+__global__ void AppendKVToPagedCache(const int block_size,
+                                     const int max_blocks_per_seq,
+                                     T* kv_pool,
+                                     const T* new_kv,
+                                     const int* block_table,
+                                     const int* past_seqlens_k,
+                                     const bool is_new_kv_bnsh_format) {
+  const int h = threadIdx.x;
+  const int n = threadIdx.y;
+  const int s = blockIdx.x;
+  const int b = blockIdx.y;
+
+  const int new_seqlen = gridDim.x;
+  const int kv_num_heads = blockDim.y;
+  const int H = blockDim.x;
+
+  const int past_seq_len = past_seqlens_k == nullptr ? 0 : past_seqlens_k[b];
+  const int token_pos = past_seq_len + s;
+  const int block_id = block_table[b * max_blocks_per_seq + token_pos / block_size];
+
+  // pool blocks are (block_size, kv_num_heads, H)
+  int out_offset = INDEX_4D(block_size, kv_num_heads, H, block_id, token_pos % block_size, n, h);
+
+  int in_offset = is_new_kv_bnsh_format
+                      ? INDEX_4D(kv_num_heads, new_seqlen, H, b, n, s, h)
+                      : INDEX_4D(new_seqlen, kv_num_heads, H, b, s, n, h);
+
+  kv_pool[out_offset] = new_kv[in_offset];
+}
+
+template <typename T>
+__global__ void AppendKVToPagedCacheLarge(const int block_size,
+                                          const int max_blocks_per_seq,
+                                          const int H,
+                                          const int kv_num_heads,
+                                          T* kv_pool,
+                                          const T* new_kv,
+                                          const int* block_table,
+                                          const int* past_seqlens_k,
+                                          const bool is_new_kv_bnsh_format) {
+  int i = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (i < H * kv_num_heads) {
+    const int h = i % H;
+    const int n = i / H;
+    const int s = blockIdx.y;
+    const int b = blockIdx.z;
+    const int new_seqlen = gridDim.y;
+
+    const int past_seq_len = past_seqlens_k == nullptr ? 0 : past_seqlens_k[b];
+    const int token_pos = past_seq_len + s;
+    const int block_id = block_table[b * max_blocks_per_seq + token_pos / block_size];
+
+    int out_offset = INDEX_4D(block_size, kv_num_heads, H, block_id, token_pos % block_size, n, h);
+
+    int in_offset = is_new_kv_bnsh_format
+                        ? INDEX_4D(kv_num_heads, new_seqlen, H, b, n, s, h)
+                        : INDEX_4D(new_seqlen, kv_num_heads, H, b, s, n, h);
+
+    kv_pool[out_offset] = new_kv[in_offset];
+  }
+}
+
+// Append new kv into a paged kv cache pool
+template <typename T>
+Status LaunchAppendKVToPagedCache(int batch_size,
+                                  int kv_num_heads,
+                                  int head_size,
+                                  int block_size,
+                                  int max_blocks_per_seq,
+                                  const int* block_table,
+                                  const int* past_seqlens_k,
+                                  int new_seq_len,
+                                  const T* new_key,
+                                  const T* new_value,
+                                  T* key_pool,
+                                  T* value_pool,
+                                  bool is_new_kv_bnsh_format,
+                                  cudaStream_t stream,
+                                  const int max_threads_per_block) {
+  static_assert(sizeof(T) == 2);
+  assert(head_size % 4 == 0);
+
+  const int H = head_size / 4;
+  if (H * kv_num_heads <= max_threads_per_block) {
+    const dim3 grid(new_seq_len, batch_size, 1);
+    const dim3 block(H, kv_num_heads, 1);
+    AppendKVToPagedCache<float2><<<grid, block, 0, stream>>>(block_size,
+                                                             max_blocks_per_seq,
+                                                             reinterpret_cast<float2*>(key_pool),
+                                                             reinterpret_cast<const float2*>(new_key),
+                                                             block_table,
+                                                             past_seqlens_k,
+                                                             is_new_kv_bnsh_format);
+    AppendKVToPagedCache<float2><<<grid, block, 0, stream>>>(block_size,
+                                                             max_blocks_per_seq,
+                                                             reinterpret_cast<float2*>(value_pool),
+                                                             reinterpret_cast<const float2*>(new_value),
+                                                             block_table,
+                                                             past_seqlens_k,
+                                                             is_new_kv_bnsh_format);
+  } else {
+    int steps = int(ceil(float(H * kv_num_heads) / 256.0));
+    const dim3 grid(steps, new_seq_len, batch_size);
+    const dim3 block(256, 1, 1);
+    AppendKVToPagedCacheLarge<float2><<<grid, block, 0, stream>>>(block_size,
+                                                                  max_blocks_per_seq,
+                                                                  H,
+                                                                  kv_num_heads,
+                                                                  reinterpret_cast<float2*>(key_pool),
+                                                                  reinterpret_cast<const float2*>(new_key),
+                                                                  block_table,
+                                                                  past_seqlens_k,
+                                                                  is_new_kv_bnsh_format);
+    AppendKVToPagedCacheLarge<float2><<<grid, block, 0, stream>>>(block_size,
+                                                                  max_blocks_per_seq,
+                                                                  H,
+                                                                  kv_num_heads,
+                                                                  reinterpret_cast<float2*>(value_pool),
+                                                                  reinterpret_cast<const float2*>(new_value),
+                                                                  block_table,
+                                                                  past_seqlens_k,
+                                                                  is_new_kv_bnsh_format);
+  }
+  return CUDA_CALL(cudaGetLastError());
+}
+
+// Kernel to gather a paged kv cache into a contiguous BSNH or BNSH buffer
+template <typename T>
+__global__ void GatherPagedKVCache(const int block_size,
+                                   const int max_blocks_per_seq,
+                                   const T* kv_pool,
+                                   T* kv_out,
+                                   const int* block_table,
+                                   const int* total_seqlens_k,
+                                   const bool is_out_bnsh_format) {
+  const int h = threadIdx.x;
+  const int n = threadIdx.y;
+  const int s = blockIdx.x;
+  const int b = blockIdx.y;
+
+  const int max_seqlen = gridDim.x;
+  const int kv_num_heads = blockDim.y;
+  const int H = blockDim.x;
+
+  if (s >= total_seqlens_k[b]) {
+    return;
+  }
+
+  const int block_id = block_table[b * max_blocks_per_seq + s / block_size];
+
+  int in_offset = INDEX_4D(block_size, kv_num_heads, H, block_id, s % block_size, n, h);
+
+  int out_offset = is_out_bnsh_format
+                       ? INDEX_4D(kv_num_heads, max_seqlen, H, b, n, s, h)
+                       : INDEX_4D(max_seqlen, kv_num_heads, H, b, s, n, h);
+
+  kv_out[out_offset] = kv_pool[in_offset];
+}
+
+template <typename T>
+__global__ void GatherPagedKVCacheLarge(const int block_size,
+                                        const int max_blocks_per_seq,
+                                        const int H,
+                                        const int kv_num_heads,
+                                        const T* kv_pool,
+                                        T* kv_out,
+                                        const int* block_table,
+                                        const int* total_seqlens_k,
+                                        const bool is_out_bnsh_format) {
+  int i = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (i < H * kv_num_heads) {
+    const int h = i % H;
+    const int n = i / H;
+    const int s = blockIdx.y;
+    const int b = blockIdx.z;
+    const int max_seqlen = gridDim.y;
+
+    if (s >= total_seqlens_k[b]) {
+      return;
+    }
+
+    const int block_id = block_table[b * max_blocks_per_seq + s / block_size];
+
+    int in_offset = INDEX_4D(block_size, kv_num_heads, H, block_id, s % block_size, n, h);
+
+    int out_offset = is_out_bnsh_format
+                         ? INDEX_4D(kv_num_heads, max_seqlen, H, b, n, s, h)
+                         : INDEX_4D(max_seqlen, kv_num_heads, H, b, s, n, h);
+
+    kv_out[out_offset] = kv_pool[in_offset];
+  }
+}
+
+// Gather a paged kv cache into contiguous buffers
+template <typename T>
+Status LaunchGatherPagedKVCache(int batch_size,
+                                int kv_num_heads,
+                                int head_size,
+                                int block_size,
+                                int max_blocks_per_seq,
+                                int max_sequence_length,
+                                const int* block_table,
+                                const int* total_seqlens_k,
+                                const T* key_pool,
+                                const T* value_pool,
+                                T* key_out,
+                                T* value_out,
+                                bool is_out_bnsh_format,
+                                cudaStream_t stream,
+                                const int max_threads_per_block) {
+  static_assert(sizeof(T) == 2);
+  assert(head_size % 4 == 0);
+
+  const int H = head_size / 4;
+  if (H * kv_num_heads <= max_threads_per_block) {
+    const dim3 grid(max_sequence_length, batch_size, 1);
+    const dim3 block(H, kv_num_heads, 1);
+    GatherPagedKVCache<float2><<<grid, block, 0, stream>>>(block_size,
+                                                           max_blocks_per_seq,
+                                                           reinterpret_cast<const float2*>(key_pool),
+                                                           reinterpret_cast<float2*>(key_out),
+                                                           block_table,
+                                                           total_seqlens_k,
+                                                           is_out_bnsh_format);
+    GatherPagedKVCache<float2><<<grid, block, 0, stream>>>(block_size,
+                                                           max_blocks_per_seq,
+                                                           reinterpret_cast<const float2*>(value_pool),
+                                                           reinterpret_cast<float2*>(value_out),
+                                                           block_table,
+                                                           total_seqlens_k,
+                                                           is_out_bnsh_format);
+  } else {
+    int steps = int(ceil(float(H * kv_num_heads) / 256.0));
+    const dim3 grid(steps, max_sequence_length, batch_size);
+    const dim3 block(256, 1, 1);
+    GatherPagedKVCacheLarge<float2><<<grid, block, 0, stream>>>(block_size,
+                                                                max_blocks_per_seq,
+                                                                H,
+                                                                kv_num_heads,
+                                                                reinterpret_cast<const float2*>(key_pool),
+                                                                reinterpret_cast<float2*>(key_out),
+                                                                block_table,
+                                                                total_seqlens_k,
+                                                                is_out_bnsh_format);
+    GatherPagedKVCacheLarge<float2><<<grid, block, 0, stream>>>(block_size,
+                                                                max_blocks_per_seq,
+                                                                H,
+                                                                kv_num_heads,
+                                                                reinterpret_cast<const float2*>(value_pool),
+                                                                reinterpret_cast<float2*>(value_out),
+                                                                block_table,
+                                                                total_seqlens_k,
+                                                                is_out_bnsh_format);
+  }
+  return CUDA_CALL(cudaGetLastError());
+}
+
 // Kernel for use with memory efficient kernel... kv_in is grouped and of bnsh or bsnh... kv_out is ungrouped and bsnh
 template <typename T>
 __global__ void Ungroup(const T* kv_in,
@@ -939,6 +1198,70 @@ template Status LaunchConcatKVInPlace<BFloat16>(int batch_size,
                                                 cudaStream_t stream,
                                                 const int max_threads_per_block);
 
+template Status LaunchAppendKVToPagedCache<half>(int batch_size,
+                                                 int kv_num_heads,
+                                                 int head_size,
+                                                 int block_size,
+                                                 int max_blocks_per_seq,
+                                                 const int* block_table,
+                                                 const int* past_seqlens_k,
+                                                 int new_seq_len,
+                                                 const half* new_key,
+                                                 const half* new_value,
+                                                 half* key_pool,
+                                                 half* value_pool,
+                                                 bool is_new_kv_bnsh_format,
+                                                 cudaStream_t stream,
+                                                 const int max_threads_per_block);
+
+template Status LaunchAppendKVToPagedCache<BFloat16>(int batch_size,
+                                                     int kv_num_heads,
+                                                     int head_size,
+                                                     int block_size,
+                                                     int max_blocks_per_seq,
+                                                     const int* block_table,
+                                                     const int* past_seqlens_k,
+                                                     int new_seq_len,
+                                                     const BFloat16* new_key,
+                                                     const BFloat16* new_value,
+                                                     BFloat16* key_pool,
+                                                     BFloat16* value_pool,
+                                                     bool is_new_kv_bnsh_format,
+                                                     cudaStream_t stream,
+                                                     const int max_threads_per_block);
+
+template Status LaunchGatherPagedKVCache<half>(int batch_size,
+                                               int kv_num_heads,
+                                               int head_size,
+                                               int block_size,
+                                               int max_blocks_per_seq,
+                                               int max_sequence_length,
+                                               const int* block_table,
+                                               const int* total_seqlens_k,
+                                               const half* key_pool,
+                                               const half* value_pool,
+                                               half* key_out,
+                                               half* value_out,
+                                               bool is_out_bnsh_format,
+                                               cudaStream_t stream,
+                                               const int max_threads_per_block);
+
+template Status LaunchGatherPagedKVCache<BFloat16>(int batch_size,
+                                                   int kv_num_heads,
+                                                   int head_size,
+                                                   int block_size,
+                                                   int max_blocks_per_seq,
+                                                   int max_sequence_length,
+                                                   const int* block_table,
+                                                   const int* total_seqlens_k,
+                                                   const BFloat16* key_pool,
+                                                   const BFloat16* value_pool,
+                                                   BFloat16* key_out,
+                                                   BFloat16* value_out,
+                                                   bool is_out_bnsh_format,
+                                                   cudaStream_t stream,
+                                                   const int max_threads_per_block);
+
 }  // namespace cuda
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -56,6 +56,47 @@ Status LaunchUnpackQKV(const T* packed_qkv, T* unpacked_q, T* unpacked_k, T* unp
                        const int kv_num_heads, const int head_size, const int sequence_length, const int batch_size,
                        cudaStream_t stream, const int max_threads_per_block);
 
+// Append new kv into a paged kv cache pool. The pool holds fixed-size blocks of shape
+// (block_size, kv_num_heads, head_size) and block_table maps the logical token position of each
+// sequence onto pool blocks: token p of batch b lives in block block_table[b * max_blocks_per_seq
+// + p / block_size] at row p % block_size. KV memory then scales with the tokens actually
+// generated instead of the worst-case context length.
+template <typename T>
+Status LaunchAppendKVToPagedCache(int batch_size,
+                                  int kv_num_heads,
+                                  int head_size,
+                                  int block_size,
+                                  int max_blocks_per_seq,
+                                  const int* block_table,     // (batch_size, max_blocks_per_seq)
+                                  const int* past_seqlens_k,  // nullptr for prompt, i.e. append at position 0.
+                                  int new_seq_len,
+                                  const T* new_key,
+                                  const T* new_value,
+                                  T* key_pool,
+                                  T* value_pool,
+                                  bool is_new_kv_bnsh_format,
+                                  cudaStream_t stream,
+                                  const int max_threads_per_block);
+
+// Gather a paged kv cache into a contiguous BSNH or BNSH buffer so the existing attention
+// kernels, which require contiguous present kv, can consume sequences stored in pool blocks.
+template <typename T>
+Status LaunchGatherPagedKVCache(int batch_size,
+                                int kv_num_heads,
+                                int head_size,
+                                int block_size,
+                                int max_blocks_per_seq,
+                                int max_sequence_length,  // sequence length of the contiguous buffers.
+                                const int* block_table,   // (batch_size, max_blocks_per_seq)
+                                const int* total_seqlens_k,
+                                const T* key_pool,
+                                const T* value_pool,
+                                T* key_out,
+                                T* value_out,
+                                bool is_out_bnsh_format,
+                                cudaStream_t stream,
+                                const int max_threads_per_block);
+
 template <typename T>
 Status LaunchConcatKVInPlace(int batch_size,
                              int kv_num_heads,
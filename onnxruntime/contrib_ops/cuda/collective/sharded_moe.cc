@@ -84,16 +84,16 @@ Status ShardedMoE<T>::ComputeInternal(OpKernelContext* context) const {
   size_t expanded_source_row_to_expanded_dest_row_size = k_ * moe_params.num_rows * sizeof(int);
   size_t expert_for_source_row_size = k_ * moe_params.num_rows * sizeof(int);
 
-  // TODO: allocate one buffer and reuse it.
-  IAllocatorUniquePtr<void> work_space = IAllocator::MakeUniquePtr<void>(allocator, ws_size, false, stream);
-  IAllocatorUniquePtr<void> fc2_output = IAllocator::MakeUniquePtr<void>(allocator, fc2_output_size, false, stream);
-  IAllocatorUniquePtr<void> fc2_output_bc = IAllocator::MakeUniquePtr<void>(allocator, fc2_output_size, false, stream);
-  IAllocatorUniquePtr<void> expert_scales =
-      IAllocator::MakeUniquePtr<void>(allocator, expert_scales_size, false, stream);
-  IAllocatorUniquePtr<void> expanded_source_row_to_expanded_dest_row =
-      IAllocator::MakeUniquePtr<void>(allocator, expanded_source_row_to_expanded_dest_row_size, false, stream);
-  IAllocatorUniquePtr<void> expert_for_source_row =
-      IAllocator::MakeUniquePtr<void>(allocator, expert_for_source_row_size, false, stream);
+  // one stream-ordered allocation serves the GEMM workspace and all the routing buffers
+  MoEScratchSpace scratch(allocator, stream,
+                          {ws_size, fc2_output_size, fc2_output_size, expert_scales_size,
+                           expanded_source_row_to_expanded_dest_row_size, expert_for_source_row_size});
+  char* work_space = static_cast<char*>(scratch.Segment(0));
+  CudaT* fc2_output = static_cast<CudaT*>(scratch.Segment(1));
+  CudaT* fc2_output_bc = static_cast<CudaT*>(scratch.Segment(2));
+  CudaT* expert_scales = static_cast<CudaT*>(scratch.Segment(3));
+  int* expanded_source_row_to_expanded_dest_row = static_cast<int*>(scratch.Segment(4));
+  int* expert_for_source_row = static_cast<int*>(scratch.Segment(5));
 
   const CudaT* fc_scales_ptr = nullptr;
 
@@ -116,15 +116,15 @@ Status ShardedMoE<T>::ComputeInternal(OpKernelContext* context) const {
       static_cast<int>(moe_params.num_rows), static_cast<int>(moe_params.hidden_size),
       static_cast<int>(moe_params.inter_size), static_cast<int>(moe_params.num_experts),
       static_cast<int>(moe_params.local_num_experts), static_cast<int>(local_experts_start_index_),
-      static_cast<int>(k_), reinterpret_cast<char*>(work_space.get()), reinterpret_cast<CudaT*>(fc2_output.get()),
-      reinterpret_cast<CudaT*>(expert_scales.get()),
-      reinterpret_cast<int*>(expanded_source_row_to_expanded_dest_row.get()),
-      reinterpret_cast<int*>(expert_for_source_row.get()), Stream(context));
+      static_cast<int>(k_), work_space, fc2_output,
+      expert_scales,
+      expanded_source_row_to_expanded_dest_row,
+      expert_for_source_row, Stream(context));
 
   Tensor* output = context->Output(0, input->Shape());
 
   if (moe_params.parallel_type == MoEParallelType::None) {
-    fc2_output_bc = std::move(fc2_output);
+    fc2_output_bc = fc2_output;
   }
 
   if (moe_params.parallel_type == MoEParallelType::EPAndTP) {
@@ -134,8 +134,8 @@ Status ShardedMoE<T>::ComputeInternal(OpKernelContext* context) const {
   if (moe_params.parallel_type == MoEParallelType::TP) {
     ORT_ENFORCE(moe_params.tensor_shards == nccl_->Size());
     NCCL_RETURN_IF_ERROR(ncclGroupStart());
-    NCCL_RETURN_IF_ERROR(ncclAllReduce(reinterpret_cast<const char*>(fc2_output.get()),
-                                       reinterpret_cast<char*>(fc2_output_bc.get()), fc2_output_size / sizeof(CudaT),
+    NCCL_RETURN_IF_ERROR(ncclAllReduce(reinterpret_cast<const char*>(fc2_output),
+                                       reinterpret_cast<char*>(fc2_output_bc), fc2_output_size / sizeof(CudaT),
                                        GetNcclDataType(input->DataType()), ncclSum, nccl_->Comm(), Stream(context)));
     NCCL_RETURN_IF_ERROR(ncclGroupEnd());
   }
@@ -153,8 +153,8 @@ Status ShardedMoE<T>::ComputeInternal(OpKernelContext* context) const {
       int64_t experts_start_index = rank_to_experts_start_index_[rank];
       moe_runner.get_total_rows_info(experts_start_index, moe_params.local_num_experts, total_past_rows,
                                      total_covered_rows);
-      const char* src = reinterpret_cast<const char*>(fc2_output.get()) + total_past_rows * stride_bytes;
-      char* dst = reinterpret_cast<char*>(fc2_output_bc.get()) + total_past_rows * stride_bytes;
+      const char* src = reinterpret_cast<const char*>(fc2_output) + total_past_rows * stride_bytes;
+      char* dst = reinterpret_cast<char*>(fc2_output_bc) + total_past_rows * stride_bytes;
       NCCL_RETURN_IF_ERROR(ncclBroadcast(src, dst, total_covered_rows * stride_count,
                                          GetNcclDataType(input->DataType()), rank, nccl_->Comm(), Stream(context)));
     }
@@ -162,13 +162,13 @@ Status ShardedMoE<T>::ComputeInternal(OpKernelContext* context) const {
   }
 
   ort_fastertransformer::finalize_moe_routing_kernelLauncher(
-      reinterpret_cast<CudaT*>(fc2_output_bc.get()), reinterpret_cast<CudaT*>(output->template MutableData<T>()),
+      fc2_output_bc, reinterpret_cast<CudaT*>(output->template MutableData<T>()),
       fc2_experts_bias_optional == nullptr
           ? nullptr
           : reinterpret_cast<const CudaT*>(fc2_experts_bias_optional->template Data<T>()),
-      reinterpret_cast<CudaT*>(expert_scales.get()),
-      reinterpret_cast<int*>(expanded_source_row_to_expanded_dest_row.get()),
-      reinterpret_cast<int*>(expert_for_source_row.get()), static_cast<int>(moe_params.num_rows),
+      expert_scales,
+      expanded_source_row_to_expanded_dest_row,
+      expert_for_source_row, static_cast<int>(moe_params.num_rows),
       static_cast<int>(moe_params.hidden_size), static_cast<int>(k_), Stream(context));
 
   return Status::OK();
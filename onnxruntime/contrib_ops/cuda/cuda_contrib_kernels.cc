@@ -159,6 +159,7 @@ class CUDA_MS_OP_TYPED_CLASS_NAME(1, BFloat16, TransposeMatMul);  // backward co
 class CUDA_MS_OP_TYPED_CLASS_NAME(1, BFloat16, FusedMatMul);
 class CUDA_MS_OP_CLASS_NAME(1, QOrderedMatMul);
 class CUDA_MS_OP_CLASS_NAME(1, QOrderedLayerNormalization);
+class CUDA_MS_OP_CLASS_NAME(1, QOrderedSkipLayerNormalization);
 class CUDA_MS_OP_CLASS_NAME(1, QOrderedGelu);
 class CUDA_MS_OP_CLASS_NAME(1, QuantizeWithOrder);
 class CUDA_MS_OP_CLASS_NAME(1, DequantizeWithOrder);
@@ -369,6 +370,7 @@ Status RegisterCudaContribKernels(KernelRegistry& kernel_registry) {
     BuildKernelCreateInfo<CUDA_MS_OP_TYPED_CLASS_NAME(1, float, FusedConv)>,
     BuildKernelCreateInfo<CUDA_MS_OP_CLASS_NAME(1, QOrderedMatMul)>,
     BuildKernelCreateInfo<CUDA_MS_OP_CLASS_NAME(1, QOrderedLayerNormalization)>,
+    BuildKernelCreateInfo<CUDA_MS_OP_CLASS_NAME(1, QOrderedSkipLayerNormalization)>,
     BuildKernelCreateInfo<CUDA_MS_OP_CLASS_NAME(1, QOrderedGelu)>,
     BuildKernelCreateInfo<CUDA_MS_OP_CLASS_NAME(1, QuantizeWithOrder)>,
     BuildKernelCreateInfo<CUDA_MS_OP_CLASS_NAME(1, DequantizeWithOrder)>,
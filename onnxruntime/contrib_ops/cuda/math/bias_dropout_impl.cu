@@ -21,6 +21,7 @@
 #include <curand_kernel.h>
 #include <algorithm>
 #include "core/providers/cuda/cu_inc/bitmask.cuh"
+#include "core/providers/cuda/generator/philox_cuda_state.h"
 
 namespace onnxruntime {
 namespace contrib {
@@ -33,14 +34,16 @@ template <typename T, bool HasSameShapeBias, bool HasResidual, bool UseBitmask>
 __global__ void BiasDropoutKernel(const CUDA_LONG N, const CUDA_LONG mask_element_count, const int step_size,
                                   const int steps_per_thread, const fast_divmod fdm_bits_per_element,
                                   const fast_divmod fdm_dim, const float ratio,
-                                  const std::pair<uint64_t, uint64_t> seeds, const T* X_data, const T* bias_data,
+                                  const PhiloxCudaState philox_state, const T* X_data, const T* bias_data,
                                   const T* residual_data, T* Y_data, void* mask_data) {
   CUDA_LONG idx = blockDim.x * blockIdx.x + threadIdx.x;
 
   const float p = 1.0f - ratio;
   const float scale = 1.0f / p;
   curandStatePhilox4_32_10_t state;
-  curand_init(seeds.first, idx, seeds.second, &state);
+  const uint64_t philox_offset =
+      philox_state.offset_ptr != nullptr ? *philox_state.offset_ptr : philox_state.offset;
+  curand_init(philox_state.seed, idx, philox_offset, &state);
 
   float4 rand;
 
@@ -96,14 +99,16 @@ template <typename T, bool HasSameShapeBias, bool HasResidual, bool UseBitmask>
 __global__ void BiasDropoutVectorizedKernel(const CUDA_LONG N, const CUDA_LONG mask_element_count, const int step_size,
                                             const int steps_per_thread, const fast_divmod fdm_bits_per_element,
                                             const fast_divmod fdm_dim, const float ratio,
-                                            const std::pair<uint64_t, uint64_t> seeds, const T* X_data,
+                                            const PhiloxCudaState philox_state, const T* X_data,
                                             const T* bias_data, const T* residual_data, T* Y_data, void* mask_data) {
   CUDA_LONG idx = blockDim.x * blockIdx.x + threadIdx.x;
 
   const float p = 1.0f - ratio;
   const float scale = 1.0f / p;
   curandStatePhilox4_32_10_t state;
-  curand_init(seeds.first, idx, seeds.second, &state);
+  const uint64_t philox_offset =
+      philox_state.offset_ptr != nullptr ? *philox_state.offset_ptr : philox_state.offset;
+  curand_init(philox_state.seed, idx, philox_offset, &state);
 
   float4 rand;
 
@@ -183,7 +188,7 @@ __global__ void BiasDropoutVectorizedKernel(const CUDA_LONG N, const CUDA_LONG m
 #define LAUNCH_BIAS_DROPOUT_KERNEL(FuncName, HasSameShapeBias, HasResidual, UseBitmask)                   \
   FuncName<T, HasSameShapeBias, HasResidual, UseBitmask><<<grid_size, kBlockSize, 0, stream>>>(           \
       static_cast<CUDA_LONG>(N), static_cast<CUDA_LONG>(mask_element_count), step_size, steps_per_thread, \
-      fdm_bits_per_element, fdm_dim, ratio, seeds, X_data, bias_data, residual_data, Y_data, mask_data)
+      fdm_bits_per_element, fdm_dim, ratio, philox_state, X_data, bias_data, residual_data, Y_data, mask_data)
 
 #define HANDLE_BIAS_DROPOUT_USE_BITMASK(FuncName, HasSameShapeBias, HasResidual) \
   if (use_bitmask) {                                                             \
@@ -219,7 +224,8 @@ void BiasDropoutKernelImpl(const cudaDeviceProp& prop, cudaStream_t stream, cons
   // amount.
   const int step_size = kBlockSize * grid_size * kNumUnroll;
   const int steps_per_thread = static_cast<int>(CeilDiv(N, step_size));
-  auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(steps_per_thread * kNumUnroll));
+  auto philox_state =
+      NextPhiloxCudaState(generator, static_cast<uint64_t>(steps_per_thread * kNumUnroll), stream);
 
   fast_divmod fdm_bits_per_element(kNumBitsPerBitmaskElement);
   if (N % kNumUnroll != 0) {
@@ -62,15 +62,15 @@ Status MoE<T>::ComputeInternal(OpKernelContext* context) const {
   AllocatorPtr allocator;
   ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
 
-  // TODO: allocate one buffer and reuse it.
-  IAllocatorUniquePtr<void> work_space = IAllocator::MakeUniquePtr<void>(allocator, ws_size, false, stream);
-  IAllocatorUniquePtr<void> fc2_output = IAllocator::MakeUniquePtr<void>(allocator, fc2_output_size, false, stream);
-  IAllocatorUniquePtr<void> expert_scales =
-      IAllocator::MakeUniquePtr<void>(allocator, expert_scales_size, false, stream);
-  IAllocatorUniquePtr<void> expanded_source_row_to_expanded_dest_row =
-      IAllocator::MakeUniquePtr<void>(allocator, expanded_source_row_to_expanded_dest_row_size, false, stream);
-  IAllocatorUniquePtr<void> expert_for_source_row =
-      IAllocator::MakeUniquePtr<void>(allocator, expert_for_source_row_size, false, stream);
+  // one stream-ordered allocation serves the GEMM workspace and all the routing buffers
+  MoEScratchSpace scratch(allocator, stream,
+                          {ws_size, fc2_output_size, expert_scales_size,
+                           expanded_source_row_to_expanded_dest_row_size, expert_for_source_row_size});
+  char* work_space = static_cast<char*>(scratch.Segment(0));
+  CudaT* fc2_output = static_cast<CudaT*>(scratch.Segment(1));
+  CudaT* expert_scales = static_cast<CudaT*>(scratch.Segment(2));
+  int* expanded_source_row_to_expanded_dest_row = static_cast<int*>(scratch.Segment(3));
+  int* expert_for_source_row = static_cast<int*>(scratch.Segment(4));
 
   const CudaT* fc_scales_ptr = nullptr;
 
@@ -92,21 +92,21 @@ Status MoE<T>::ComputeInternal(OpKernelContext* context) const {
       static_cast<int>(moe_params.num_rows), static_cast<int>(moe_params.hidden_size),
       static_cast<int>(moe_params.inter_size), static_cast<int>(moe_params.num_experts),
       static_cast<int>(moe_params.local_num_experts), 0 /*local_experts_start_index_ used in sharded MoE*/,
-      static_cast<int>(k_), reinterpret_cast<char*>(work_space.get()), reinterpret_cast<CudaT*>(fc2_output.get()),
-      reinterpret_cast<CudaT*>(expert_scales.get()),
-      reinterpret_cast<int*>(expanded_source_row_to_expanded_dest_row.get()),
-      reinterpret_cast<int*>(expert_for_source_row.get()), Stream(context));
+      static_cast<int>(k_), work_space, fc2_output,
+      expert_scales,
+      expanded_source_row_to_expanded_dest_row,
+      expert_for_source_row, Stream(context));
 
   Tensor* output = context->Output(0, input->Shape());
 
   ort_fastertransformer::finalize_moe_routing_kernelLauncher(
-      reinterpret_cast<CudaT*>(fc2_output.get()), reinterpret_cast<CudaT*>(output->template MutableData<T>()),
+      fc2_output, reinterpret_cast<CudaT*>(output->template MutableData<T>()),
       fc2_experts_bias_optional == nullptr
           ? nullptr
           : reinterpret_cast<const CudaT*>(fc2_experts_bias_optional->template Data<T>()),
-      reinterpret_cast<CudaT*>(expert_scales.get()),
-      reinterpret_cast<int*>(expanded_source_row_to_expanded_dest_row.get()),
-      reinterpret_cast<int*>(expert_for_source_row.get()), static_cast<int>(moe_params.num_rows),
+      expert_scales,
+      expanded_source_row_to_expanded_dest_row,
+      expert_for_source_row, static_cast<int>(moe_params.num_rows),
       static_cast<int>(moe_params.hidden_size), static_cast<int>(k_), Stream(context));
 
   return Status::OK();
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/common/common.h"
+#include "core/common/inlined_containers.h"
 #include "core/framework/tensor_shape.h"
 #include "core/framework/op_kernel.h"
 #include "contrib_ops/cuda/moe/ft_moe/moe_gemm_kernels.h"
@@ -37,6 +38,39 @@ struct MoEParameters {
   int64_t tensor_shards{1};
 };
 
+// Scratch buffers for one MoE invocation, carved out of a single stream-ordered allocation.
+// Each expert layer needs several device buffers per call (GEMM workspace, permuted FC2 output,
+// routing scales and permutation maps); allocating them individually costs one arena round trip
+// each on every token batch. Segments are 256-byte aligned so each keeps the alignment a
+// standalone device allocation would have.
+class MoEScratchSpace {
+ public:
+  MoEScratchSpace(const AllocatorPtr& allocator, Stream* stream, std::initializer_list<size_t> segment_sizes) {
+    size_t total_size = 0;
+    for (size_t segment_size : segment_sizes) {
+      total_size += Align(segment_size);
+    }
+    buffer_ = IAllocator::MakeUniquePtr<void>(allocator, total_size, false, stream);
+    char* segment = static_cast<char*>(buffer_.get());
+    segments_.reserve(segment_sizes.size());
+    for (size_t segment_size : segment_sizes) {
+      segments_.push_back(segment);
+      segment += Align(segment_size);
+    }
+  }
+
+  void* Segment(size_t index) const { return segments_[index]; }
+
+ private:
+  static size_t Align(size_t size) {
+    constexpr size_t alignment = 256;
+    return (size + alignment - 1) & ~(alignment - 1);
+  }
+
+  IAllocatorUniquePtr<void> buffer_;
+  InlinedVector<void*, 8> segments_;
+};
+
 class MoEBase {
  public:
   Status CheckInputs(MoEParameters& parameters, MoEQuantType& quant_type, const Tensor* input,
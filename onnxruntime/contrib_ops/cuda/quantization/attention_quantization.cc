@@ -160,15 +160,30 @@ Status QAttention<T, int8_t>::ComputeInternal(OpKernelContext* context) const {
     dequant_scale = input_scale * weight_scale;
   }
 
-  // scale back and bias
-  // TODO(tianleiwu): fuse Dequantize with Add bias and Transpose.
-  ORT_RETURN_IF_ERROR(CudaDequantizeWithBias(Stream(context),
-                                             gemm_buffer_quantized.get(),
-                                             reinterpret_cast<const CudaT*>(bias->Data<T>()),
-                                             reinterpret_cast<CudaT*>(gemm_buffer.get()),
-                                             dequant_scale,
-                                             m,
-                                             n));
+  // scale back and bias. When the Q/K/V head sizes match, fuse the transpose to 3xBxNxSxH that
+  // QkvToContext would otherwise run as a separate pass over the QKV buffer.
+  const bool fuse_transpose = parameters.head_size == parameters.v_head_size &&
+                              parameters.hidden_size == parameters.v_hidden_size &&
+                              !parameters.past_present_share_buffer;
+  if (fuse_transpose) {
+    ORT_RETURN_IF_ERROR(CudaDequantizeWithBiasTranspose(Stream(context),
+                                                        gemm_buffer_quantized.get(),
+                                                        reinterpret_cast<const CudaT*>(bias->Data<T>()),
+                                                        reinterpret_cast<CudaT*>(gemm_buffer.get()),
+                                                        dequant_scale,
+                                                        batch_size,
+                                                        sequence_length,
+                                                        parameters.num_heads,
+                                                        head_size));
+  } else {
+    ORT_RETURN_IF_ERROR(CudaDequantizeWithBias(Stream(context),
+                                               gemm_buffer_quantized.get(),
+                                               reinterpret_cast<const CudaT*>(bias->Data<T>()),
+                                               reinterpret_cast<CudaT*>(gemm_buffer.get()),
+                                               dequant_scale,
+                                               m,
+                                               n));
+  }
 
   std::vector<int64_t> present_dims{2, parameters.batch_size, parameters.num_heads,
                                     parameters.total_sequence_length, parameters.head_size};
@@ -197,6 +212,7 @@ Status QAttention<T, int8_t>::ComputeInternal(OpKernelContext* context) const {
   typedef typename ToCudaType<T>::MappedType CudaT;
   AttentionData<CudaT> data;
   data.gemm_buffer = reinterpret_cast<CudaT*>(gemm_buffer.get());
+  data.gemm_buffer_transposed = fuse_transpose;
   if (nullptr != mask_index) {
     data.mask_index = mask_index->Data<int>();
     data.mask_index_dims = mask_index->Shape().GetDims();
@@ -47,6 +47,53 @@ Status CudaDequantizeWithBias(cudaStream_t stream, const int32_t* quantize, cons
 template Status CudaDequantizeWithBias<float>(cudaStream_t stream, const int32_t* quantize, const float* bias, float* output, float scale, int m, int n);
 template Status CudaDequantizeWithBias<half>(cudaStream_t stream, const int32_t* quantize, const half* bias, half* output, half scale, int m, int n);
 
+template <class T, int NumThreadsPerBlock, int NumElementsPerThread>
+__global__ void DequantizeWithBiasTransposeKernel(const int32_t* quantize, const T* bias, T* output, T scale,
+                                                  int batch_size, int sequence_length, int num_heads, int head_size,
+                                                  CUDA_LONG N) {
+  CUDA_LONG id = NumElementsPerThread * NumThreadsPerBlock * blockIdx.x + threadIdx.x;
+
+#pragma unroll
+  for (int i = 0; i < NumElementsPerThread; i++) {
+    if (id < N) {
+      // id indexes the transposed output (3xBxNxSxH) so writes are coalesced.
+      const int h = static_cast<int>(id % head_size);
+      const int s = static_cast<int>((id / head_size) % sequence_length);
+      const int n = static_cast<int>((id / (static_cast<CUDA_LONG>(head_size) * sequence_length)) % num_heads);
+      const int b = static_cast<int>((id / (static_cast<CUDA_LONG>(head_size) * sequence_length * num_heads)) % batch_size);
+      const int m = static_cast<int>(id / (static_cast<CUDA_LONG>(head_size) * sequence_length * num_heads * batch_size));
+
+      const int bias_offset = (m * num_heads + n) * head_size + h;
+      const CUDA_LONG in_offset =
+          (((static_cast<CUDA_LONG>(b) * sequence_length + s) * 3 + m) * num_heads + n) * head_size + h;
+
+      output[id] = (static_cast<T>(quantize[in_offset]) * scale) + bias[bias_offset];
+      id += NumThreadsPerBlock;
+    }
+  }
+}
+
+template <class T>
+Status CudaDequantizeWithBiasTranspose(cudaStream_t stream, const int32_t* quantize, const T* bias, T* output,
+                                       T scale, int batch_size, int sequence_length, int num_heads, int head_size) {
+  const CUDA_LONG N = static_cast<CUDA_LONG>(3) * batch_size * sequence_length * num_heads * head_size;
+  int blocksPerGrid = static_cast<int>(CeilDiv(N, GridDim::maxThreadsPerBlock * GridDim::maxElementsPerThread));
+  DequantizeWithBiasTransposeKernel<T, GridDim::maxThreadsPerBlock, GridDim::maxElementsPerThread><<<blocksPerGrid, GridDim::maxThreadsPerBlock, 0, stream>>>(
+      quantize,
+      bias,
+      output,
+      scale,
+      batch_size,
+      sequence_length,
+      num_heads,
+      head_size,
+      N);
+  return Status::OK();
+}
+
+template Status CudaDequantizeWithBiasTranspose<float>(cudaStream_t stream, const int32_t* quantize, const float* bias, float* output, float scale, int batch_size, int sequence_length, int num_heads, int head_size);
+template Status CudaDequantizeWithBiasTranspose<half>(cudaStream_t stream, const int32_t* quantize, const half* bias, half* output, half scale, int batch_size, int sequence_length, int num_heads, int head_size);
+
 }  // namespace cuda
 }  // namespace contrib
 }  // namespace onnxruntime
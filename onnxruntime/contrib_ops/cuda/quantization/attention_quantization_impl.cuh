@@ -10,6 +10,12 @@ namespace cuda {
 template <class Tin>
 Status CudaDequantizeWithBias(cudaStream_t stream, const int32_t* quantize, const Tin* bias, Tin* output, Tin scale, int m, int n);
 
+// Dequantize the int32 QKV GEMM output (BxSx3xNxH), add bias, and write the result transposed
+// to 3xBxNxSxH so the attention kernels can consume it without a separate transpose pass.
+template <class Tin>
+Status CudaDequantizeWithBiasTranspose(cudaStream_t stream, const int32_t* quantize, const Tin* bias, Tin* output,
+                                       Tin scale, int batch_size, int sequence_length, int num_heads, int head_size);
+
 }  // namespace cuda
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -16,6 +16,14 @@ Status QOrderedLayerNorm(
     const T* gamma, const T* beta, const float epsilon,
     unsigned batch, unsigned rows, unsigned cols);
 
+template <typename T>
+Status QOrderedSkipLayerNorm(
+    cudaStream_t stream, const cudaDeviceProp& device_prop, cublasLtOrder_t order,
+    const int8_t* src, const float src_scale, const int8_t* skip, const float skip_scale,
+    int8_t* dst, const float dst_scale,
+    const T* gamma, const T* beta, const float epsilon,
+    unsigned batch, unsigned rows, unsigned cols);
+
 }
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -680,7 +680,7 @@ template <typename T>
 IAllocatorUniquePtr<T> AllocateCPUPinned() {
   T* p;
   CUDA_CALL_THROW(cudaMallocHost(&p, sizeof(T)));
-  return IAllocatorUniquePtr<T>{p, [](cuda::BeamScorerState* p) { ORT_IGNORE_RETURN_VALUE(cudaFreeHost(p)); }};
+  return IAllocatorUniquePtr<T>{p, [](T* p) { ORT_IGNORE_RETURN_VALUE(cudaFreeHost(p)); }};
 }
 
 CudaBeamSearchScorer::CudaBeamSearchScorer(const transformers::IGenerationParameters& parameters,
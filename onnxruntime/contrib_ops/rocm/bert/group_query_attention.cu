@@ -0,0 +1,244 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/rocm/bert/group_query_attention.h"
+
+#include "contrib_ops/cpu/bert/group_query_attention_helper.h"
+#include "contrib_ops/rocm/bert/attention_impl.h"
+#include "contrib_ops/rocm/bert/batched_gemm_softmax_gemm_permute_pipelines.cuh"
+#include "core/providers/rocm/rocm_common.h"
+
+using namespace onnxruntime::rocm;
+using namespace ::onnxruntime::common;
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace contrib {
+namespace rocm {
+
+#define REGISTER_GQA_KERNEL_TYPED(T)                                     \
+  ONNX_OPERATOR_TYPED_KERNEL_EX(                                         \
+      GroupQueryAttention,                                               \
+      kMSDomain,                                                         \
+      1,                                                                 \
+      T,                                                                 \
+      kRocmExecutionProvider,                                            \
+      (*KernelDefBuilder::Create())                                      \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<T>())         \
+          .TypeConstraint("M", {DataTypeImpl::GetTensorType<int32_t>()}) \
+          .MayInplace(3, 1)                                              \
+          .MayInplace(4, 2)                                              \
+          .InputMemoryType(OrtMemTypeCPUInput, 5)                        \
+          .InputMemoryType(OrtMemTypeCPUInput, 6),                       \
+      GroupQueryAttention<T>);
+
+REGISTER_GQA_KERNEL_TYPED(float);
+REGISTER_GQA_KERNEL_TYPED(MLFloat16);
+
+template <typename T>
+GroupQueryAttention<T>::GroupQueryAttention(const OpKernelInfo& info)
+    : RocmKernel(info) {
+  int64_t num_heads = 0;
+  int64_t kv_num_heads = 0;
+  ORT_ENFORCE(info.GetAttr("num_heads", &num_heads).IsOK() && num_heads > 0);
+  ORT_ENFORCE(info.GetAttr("kv_num_heads", &kv_num_heads).IsOK() && kv_num_heads > 0 && num_heads % kv_num_heads == 0);
+  num_heads_ = static_cast<int>(num_heads);
+  kv_num_heads_ = static_cast<int>(kv_num_heads);
+  scale_ = info.GetAttrOrDefault<float>("scale", 0.0f);
+  local_window_size_ = static_cast<int>(info.GetAttrOrDefault<int64_t>("local_window_size", -1));
+  do_rotary_ = info.GetAttrOrDefault<int64_t>("do_rotary", 0) == 1;
+  rotary_interleaved_ = info.GetAttrOrDefault<int64_t>("rotary_interleaved", 0) == 1;
+
+  using HipT = typename ToHipType<T>::MappedType;
+  using AttentionTunableOp = GemmSoftmaxGemmPermuteTunableOp<HipT>;
+  tunable_op_ = std::make_shared<AttentionTunableOp>();
+}
+
+template <typename T>
+Status GroupQueryAttention<T>::ComputeInternal(OpKernelContext* context) const {
+  ORT_ENFORCE(
+      GetTuningContext()->IsTunableOpEnabled(),
+      "GroupQueryAttention of ROCm EP is only supported if tunable op is used and tuning is enabled.");
+
+  const Tensor* query = context->Input<Tensor>(0);
+  const Tensor* key = context->Input<Tensor>(1);
+  const Tensor* value = context->Input<Tensor>(2);
+  const Tensor* past_key = context->Input<Tensor>(3);
+  const Tensor* past_value = context->Input<Tensor>(4);
+  const Tensor* seqlens_k = context->Input<Tensor>(5);
+  const Tensor* total_seqlen = context->Input<Tensor>(6);
+  const Tensor* cos_cache = context->Input<Tensor>(7);
+  const Tensor* sin_cache = context->Input<Tensor>(8);
+
+  if (do_rotary_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                           "do_rotary is not supported on ROCm EP. "
+                           "User should apply RotaryEmbedding to query and key before this node instead.");
+  }
+  if (local_window_size_ != -1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "local attention is not supported on ROCm EP.");
+  }
+
+  GroupQueryAttentionParameters parameters;
+  ORT_RETURN_IF_ERROR(
+      group_query_attention_helper::CheckInputs(
+          query, key, value, past_key, past_value, cos_cache, sin_cache,
+          &parameters, num_heads_, kv_num_heads_, seqlens_k, total_seqlen, scale_));
+
+  if (parameters.is_packed_qkv) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "packed qkv is not supported on ROCm EP.");
+  }
+
+  const int batch_size = parameters.batch_size;
+  const int sequence_length = parameters.sequence_length;
+  const int head_size = parameters.head_size;
+  const int present_len = parameters.seqlen_present_kv_cache;
+
+  // seqlens_k is on CPU for this EP so that the dense-batch restriction below can be
+  // validated without a device sync. Ragged batches need a flash attention style kernel.
+  const int total_sequence_length = *total_seqlen->Data<int32_t>();
+  const int32_t* seqlens = seqlens_k->Data<int32_t>();
+  for (int b = 0; b < batch_size; ++b) {
+    if (seqlens[b] + 1 != total_sequence_length) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED,
+                             "GroupQueryAttention of ROCm EP requires all batch entries to have "
+                             "total_sequence_length tokens, got seqlens_k[", b, "] = ", seqlens[b]);
+    }
+  }
+  const int past_len = total_sequence_length - sequence_length;
+  ORT_RETURN_IF(past_len < 0, "total_sequence_length shall not be less than sequence_length.");
+  if (past_key != nullptr) {
+    ORT_RETURN_IF(past_len > parameters.seqlen_past_kv_cache,
+                  "total_sequence_length exceeds the capacity of the past kv cache.");
+  } else {
+    ORT_RETURN_IF(past_len != 0, "past_key and past_value are required when total_sequence_length > sequence_length.");
+  }
+
+  TensorShapeVector output_shape(3);
+  output_shape[0] = static_cast<int64_t>(batch_size);
+  output_shape[1] = static_cast<int64_t>(sequence_length);
+  output_shape[2] = static_cast<int64_t>(parameters.hidden_size);
+  Tensor* output = context->Output(0, output_shape);
+
+  std::vector<int64_t> present_dims{batch_size, kv_num_heads_, present_len, head_size};
+  TensorShape present_shape(present_dims);
+  Tensor* present_key = context->Output(1, present_shape);
+  Tensor* present_value = context->Output(2, present_shape);
+
+  using HipT = typename ToHipType<T>::MappedType;
+  auto& device_prop = GetDeviceProp();
+  const int max_threads_per_block = device_prop.maxThreadsPerBlock;
+  hipStream_t stream = Stream(context);
+
+  // The tunable pipeline below operates on num_heads ordinary attention heads, so the kv
+  // cache is first made dense in present and then the kv heads are expanded (repeated) into
+  // compact BNSH workspace buffers. Queries are transposed from BSNH to BNSH alongside.
+  RocmAttentionParameters attn = {};
+  attn.batch_size = batch_size;
+  attn.sequence_length = sequence_length;
+  attn.kv_sequence_length = total_sequence_length;
+  attn.past_sequence_length = 0;
+  attn.total_sequence_length = total_sequence_length;
+  attn.max_sequence_length = total_sequence_length;
+  attn.hidden_size = parameters.hidden_size;
+  attn.head_size = head_size;
+  attn.v_hidden_size = parameters.hidden_size;
+  attn.v_head_size = head_size;
+  attn.num_heads = num_heads_;
+  attn.is_unidirectional = true;
+  attn.mask_filter_value = -10000.0f;
+  attn.scale = scale_;
+  attn.mask_type = MASK_NONE;
+  attn.qkv_format = Q_K_V_BNSH;
+  attn.mode = QFMT_KFMT_VFMT_NONE_NONE_NONE_NONE;
+
+  using AttentionTunableOp = GemmSoftmaxGemmPermuteTunableOp<HipT>;
+  auto align256 = [](size_t bytes) { return (bytes + 255) & ~static_cast<size_t>(255); };
+  const size_t q_bytes = align256(
+      static_cast<size_t>(batch_size) * num_heads_ * sequence_length * head_size * sizeof(HipT));
+  const size_t kv_bytes = align256(
+      static_cast<size_t>(batch_size) * num_heads_ * total_sequence_length * head_size * sizeof(HipT));
+  const size_t pipeline_bytes = AttentionTunableOp::GetWorkspaceNumBytes(&attn);
+  auto workspace = GetScratchBuffer<void>(q_bytes + 2 * kv_bytes + pipeline_bytes, context->GetComputeStream());
+  HipT* q_bnsh = reinterpret_cast<HipT*>(workspace.get());
+  HipT* k_expanded = reinterpret_cast<HipT*>(reinterpret_cast<char*>(workspace.get()) + q_bytes);
+  HipT* v_expanded = reinterpret_cast<HipT*>(reinterpret_cast<char*>(workspace.get()) + q_bytes + kv_bytes);
+  void* pipeline_workspace = reinterpret_cast<char*>(workspace.get()) + q_bytes + 2 * kv_bytes;
+
+  // Build the dense present kv cache. Past is copied over unless the buffers are shared,
+  // then the new kv tokens are appended after the past tokens.
+  const bool share_buffer = past_key != nullptr &&
+                            past_key->DataRaw() == present_key->MutableDataRaw() &&
+                            past_value->DataRaw() == present_value->MutableDataRaw();
+  auto present_strides = Strides::BNSHMemory(batch_size, kv_num_heads_, present_len, head_size);
+  HipT* present_key_data = reinterpret_cast<HipT*>(present_key->MutableDataRaw());
+  HipT* present_value_data = reinterpret_cast<HipT*>(present_value->MutableDataRaw());
+  if (!share_buffer) {
+    const size_t present_bytes =
+        static_cast<size_t>(batch_size) * kv_num_heads_ * present_len * head_size * sizeof(HipT);
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(present_key_data, 0, present_bytes, stream));
+    HIP_RETURN_IF_ERROR(hipMemsetAsync(present_value_data, 0, present_bytes, stream));
+    if (past_len > 0) {
+      int4 past_shape{batch_size, kv_num_heads_, past_len, head_size};
+      auto past_strides = Strides::BNSHMemory(batch_size, kv_num_heads_, parameters.seqlen_past_kv_cache, head_size);
+      ORT_RETURN_IF_ERROR(LaunchStridedCopy(
+          stream, reinterpret_cast<const HipT*>(past_key->DataRaw()), past_shape, past_strides.ForBNSHCoord(),
+          present_key_data, present_strides.ForBNSHCoord(), max_threads_per_block));
+      ORT_RETURN_IF_ERROR(LaunchStridedCopy(
+          stream, reinterpret_cast<const HipT*>(past_value->DataRaw()), past_shape, past_strides.ForBNSHCoord(),
+          present_value_data, present_strides.ForBNSHCoord(), max_threads_per_block));
+    }
+  }
+
+  int4 new_kv_shape{batch_size, kv_num_heads_, sequence_length, head_size};
+  auto new_kv_strides = Strides::BSNHMemory(batch_size, sequence_length, kv_num_heads_, head_size);
+  const int64_t append_offset = present_strides.OffsetAt(0, 0, past_len, 0);
+  ORT_RETURN_IF_ERROR(LaunchStridedCopy(
+      stream, reinterpret_cast<const HipT*>(key->DataRaw()), new_kv_shape, new_kv_strides.ForBNSHCoord(),
+      present_key_data + append_offset, present_strides.ForBNSHCoord(), max_threads_per_block));
+  ORT_RETURN_IF_ERROR(LaunchStridedCopy(
+      stream, reinterpret_cast<const HipT*>(value->DataRaw()), new_kv_shape, new_kv_strides.ForBNSHCoord(),
+      present_value_data + append_offset, present_strides.ForBNSHCoord(), max_threads_per_block));
+
+  // Expand each kv head to the num_heads / kv_num_heads query heads that attend to it, so
+  // expanded head n corresponds to kv head n / factor. One strided copy per repeat.
+  const int factor = num_heads_ / kv_num_heads_;
+  int4 expand_shape{batch_size, kv_num_heads_, total_sequence_length, head_size};
+  Strides expand_strides{longlong4{
+      static_cast<int64_t>(num_heads_) * total_sequence_length * head_size,
+      static_cast<int64_t>(factor) * total_sequence_length * head_size,
+      static_cast<int64_t>(head_size),
+      static_cast<int64_t>(1),
+  }};
+  for (int r = 0; r < factor; ++r) {
+    const int64_t repeat_offset = static_cast<int64_t>(r) * total_sequence_length * head_size;
+    ORT_RETURN_IF_ERROR(LaunchStridedCopy(
+        stream, present_key_data, expand_shape, present_strides.ForBNSHCoord(),
+        k_expanded + repeat_offset, expand_strides.ForBNSHCoord(), max_threads_per_block));
+    ORT_RETURN_IF_ERROR(LaunchStridedCopy(
+        stream, present_value_data, expand_shape, present_strides.ForBNSHCoord(),
+        v_expanded + repeat_offset, expand_strides.ForBNSHCoord(), max_threads_per_block));
+  }
+
+  ORT_RETURN_IF_ERROR(LaunchTransQkv(
+      stream, 1, sequence_length, batch_size, head_size, num_heads_,
+      max_threads_per_block, false, reinterpret_cast<const HipT*>(query->DataRaw()), q_bnsh));
+
+  GemmSoftmaxGemmPermuteParams<HipT> params;
+  params.tuning_ctx = GetTuningContext();
+  params.stream = context->GetComputeStream();
+  params.handle = GetRocblasHandle(context);
+  params.attention = &attn;
+  params.device_prop = &device_prop;
+  params.scale = scale_ == 0 ? 1.0f / sqrt(attn.head_size) : scale_;
+  params.q_buffer = q_bnsh;
+  params.k_buffer = k_expanded;
+  params.v_buffer = v_expanded;
+  params.out_buffer = reinterpret_cast<HipT*>(output->MutableDataRaw());
+  params.workspace_buffer = pipeline_workspace;
+  return (*std::static_pointer_cast<AttentionTunableOp>(tunable_op_))(&params);
+}
+
+}  // namespace rocm
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include "core/providers/rocm/rocm_kernel.h"
+#include "contrib_ops/rocm/bert/attention_impl.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace rocm {
+
+using namespace onnxruntime::rocm;
+
+template <typename T>
+class GroupQueryAttention final : public RocmKernel {
+ public:
+  GroupQueryAttention(const OpKernelInfo& info);
+  Status ComputeInternal(OpKernelContext* context) const override;
+
+ protected:
+  int num_heads_;     // number of attention heads of Q
+  int kv_num_heads_;  // number of attention heads of K or V
+  float scale_;
+  int local_window_size_;
+  bool do_rotary_;
+  bool rotary_interleaved_;
+
+  // type-erased GemmSoftmaxGemmPermuteTunableOp<HipT>, the reason for this is:
+  //   1. We don't want to include the cuh file where GemmSoftmaxGemmPermuteTunableOp<HipT> is defined.
+  //   2. We don't want to construct the object repeatly (which is expansive) during Compute.
+  std::shared_ptr<void> tunable_op_;
+};
+
+}  // namespace rocm
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -28,6 +28,7 @@ class CPUIDInfo {
 
   // ARM
   bool HasArmNeonDot() const { return has_arm_neon_dot_; }
+  bool HasArmSVE() const { return has_arm_sve_; }
   bool HasArmNeon_I8MM() const { return has_arm_neon_i8mm_; }
   bool HasArmSVE_I8MM() const { return has_arm_sve_i8mm_; }
   bool HasArmNeon_BF16() const { return has_arm_neon_bf16_; }
@@ -115,6 +116,7 @@ class CPUIDInfo {
   bool has_arm_neon_dot_{false};
   bool has_fp16_{false};
   bool has_arm_neon_i8mm_{false};
+  bool has_arm_sve_{false};
   bool has_arm_sve_i8mm_{false};
   bool has_arm_neon_bf16_{false};
 
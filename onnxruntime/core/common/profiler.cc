@@ -3,6 +3,8 @@
 
 #include "profiler.h"
 
+#include <algorithm>
+
 namespace onnxruntime {
 namespace profiling {
 using namespace std::chrono;
@@ -102,6 +104,46 @@ void Profiler::EndTimeAndRecordEvent(EventCategory category,
   }
 }
 
+void Profiler::EnableCompactEvents() {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (!compact_events_enabled_) {
+    compact_events_enabled_ = true;
+    compact_events_.resize(max_num_events_);
+  }
+}
+
+uint32_t Profiler::InternName(const std::string& name) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = interned_name_ids_.find(name);
+  if (it != interned_name_ids_.end()) {
+    return it->second;
+  }
+  const uint32_t id = static_cast<uint32_t>(interned_names_.size());
+  interned_names_.push_back(name);
+  interned_name_ids_.emplace(name, id);
+  return id;
+}
+
+void Profiler::EndTimeAndRecordCompactEvent(EventCategory category, uint32_t name_id, const TimePoint& start_time) {
+  const long long dur = TimeDiffMicroSeconds(start_time);
+  const long long ts = TimeDiffMicroSeconds(profiling_start_time_, start_time);
+
+  const uint64_t slot = next_compact_event_.fetch_add(1, std::memory_order_relaxed);
+  CompactEventRecord& rec = compact_events_[slot % compact_events_.size()];
+  rec.ts = ts;
+  rec.dur = static_cast<int32_t>(dur);
+  rec.tid = static_cast<uint32_t>(logging::GetThreadId());
+  rec.name_id = name_id;
+  rec.cat = category;
+}
+
+void Profiler::DiscardEvents() {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  events_.clear();
+  next_compact_event_.store(0, std::memory_order_relaxed);
+  max_events_reached = false;
+}
+
 std::string Profiler::EndProfiling() {
   if (!enabled_) {
     return std::string();
@@ -122,6 +164,10 @@ std::string Profiler::EndProfiling() {
     ep_profiler->EndProfiling(profiling_start_time_, events_);
   }
 
+  const uint64_t total_compact = next_compact_event_.load(std::memory_order_relaxed);
+  const size_t num_compact =
+      compact_events_enabled_ ? static_cast<size_t>(std::min<uint64_t>(total_compact, compact_events_.size())) : 0;
+
   for (size_t i = 0; i < events_.size(); ++i) {
     auto& rec = events_[i];
     profile_stream_ << R"({"cat" : ")" << event_category_names_[rec.cat] << "\",";
@@ -143,7 +189,30 @@ std::string Profiler::EndProfiling() {
       is_first_arg = false;
     }
     profile_stream_ << "}";
-    if (i == events_.size() - 1) {
+    if (i == events_.size() - 1 && num_compact == 0) {
+      profile_stream_ << "}\n";
+    } else {
+      profile_stream_ << "},\n";
+    }
+  }
+
+  // Convert compact records into the same chrome trace format, oldest first when the ring
+  // buffer has wrapped.
+  const auto pid = logging::GetProcessId();
+  for (size_t i = 0; i < num_compact; ++i) {
+    const size_t idx = (total_compact > compact_events_.size())
+                           ? static_cast<size_t>((total_compact + i) % compact_events_.size())
+                           : i;
+    const CompactEventRecord& rec = compact_events_[idx];
+    profile_stream_ << R"({"cat" : ")" << event_category_names_[rec.cat] << "\",";
+    profile_stream_ << "\"pid\" :" << pid << ",";
+    profile_stream_ << "\"tid\" :" << rec.tid << ",";
+    profile_stream_ << "\"dur\" :" << rec.dur << ",";
+    profile_stream_ << "\"ts\" :" << rec.ts << ",";
+    profile_stream_ << R"("ph" : "X",)";
+    profile_stream_ << R"("name" :")" << interned_names_[rec.name_id] << "\",";
+    profile_stream_ << "\"args\" : {}";
+    if (i == num_compact - 1) {
       profile_stream_ << "}\n";
     } else {
       profile_stream_ << "},\n";
@@ -8,6 +8,8 @@
 #include <initializer_list>
 #include <iostream>
 #include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "core/common/profiler_common.h"
 #include "core/common/logging/logging.h"
@@ -80,12 +82,61 @@ class Profiler {
                              const std::initializer_list<std::pair<std::string, std::string>>& event_args = {},
                              bool sync_gpu = false);
 
+  /*
+  Fixed-size record used when compact mode is enabled. Events carry an interned
+  name id instead of strings, so recording is two time stamps and a ring buffer
+  slot with no allocation. Records are converted to the regular chrome trace
+  format when the profile is written.
+  */
+  struct CompactEventRecord {
+    int64_t ts;        // microseconds from the profiling start
+    int32_t dur;       // microseconds
+    uint32_t tid;
+    uint32_t name_id;  // from InternName()
+    EventCategory cat;
+    int64_t reserved;  // pads the record to a fixed 32 bytes
+  };
+  static_assert(sizeof(CompactEventRecord) == 32, "Compact profiler records must stay 32 bytes");
+
+  /*
+  Switch event collection to preallocated fixed-size records. Must be called
+  before events are recorded. Compact node events drop the per-node argument
+  details (sizes, shapes, thread stats) in exchange for a recording cost small
+  enough that microsecond kernels are not distorted.
+  */
+  void EnableCompactEvents();
+
+  /*
+  Whether compact event collection is enabled.
+  */
+  bool IsCompactEventsEnabled() const {
+    return compact_events_enabled_;
+  }
+
+  /*
+  Intern an event name, returning the id to record compact events under.
+  Interning takes the profiler lock; call it once per site, not per event.
+  */
+  uint32_t InternName(const std::string& name);
+
+  /*
+  Record an event as a fixed-size record in the ring buffer. When the buffer
+  wraps, the newest events win.
+  */
+  void EndTimeAndRecordCompactEvent(EventCategory category, uint32_t name_id, const TimePoint& start_time);
+
   /*
   Write profile data to the given stream in chrome format defined below.
   https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview#
   */
   std::string EndProfiling();
 
+  /*
+  Discard buffered events and resume recording if the event cap had been reached.
+  Profiling stays enabled; used when a session's run-accumulated state is reset.
+  */
+  void DiscardEvents();
+
   static Profiler& Instance() {
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
     ORT_ENFORCE(instance_ != nullptr);
@@ -151,6 +202,15 @@ class Profiler {
   bool profile_with_logger_{false};
   const size_t max_num_events_{global_max_num_events_.load()};
 
+  // Compact mode state. The ring buffer is preallocated by EnableCompactEvents()
+  // and written lock-free through next_compact_event_; the interned name table is
+  // only touched by InternName() and the final conversion.
+  bool compact_events_enabled_{false};
+  std::vector<CompactEventRecord> compact_events_;
+  std::atomic<uint64_t> next_compact_event_{0};
+  std::vector<std::string> interned_names_;
+  std::unordered_map<std::string, uint32_t> interned_name_ids_;
+
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
   static Profiler* instance_;
 #endif
@@ -13,11 +13,17 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "core/platform/threadpool.h"
 #include "core/common/common.h"
+#include "core/common/hash_combine.h"
 #include "core/common/cpuid_info.h"
 #include "core/common/eigen_common_wrapper.h"
 #include "core/platform/EigenNonBlockingThreadPool.h"
@@ -143,10 +149,20 @@ void ThreadPoolProfiler::MainThreadStat::LogCore() {
 #endif
 }
 
+void ThreadPoolProfiler::LogShards(unsigned shards) {
+  if (enabled_) {
+    GetMainThreadStat().LogShards(shards);
+  }
+}
+
 void ThreadPoolProfiler::MainThreadStat::LogBlockSize(std::ptrdiff_t block_size) {
   blocks_.emplace_back(block_size);
 }
 
+void ThreadPoolProfiler::MainThreadStat::LogShards(unsigned shards) {
+  shards_.emplace_back(shards);
+}
+
 void ThreadPoolProfiler::MainThreadStat::LogStart() {
   points_.emplace_back(Clock::now());
 }
@@ -172,6 +188,12 @@ std::string ThreadPoolProfiler::MainThreadStat::Reset() {
     ss << blocks_.back();
     blocks_.clear();
   }
+  ss << "], \"shards\": [";
+  if (!shards_.empty()) {
+    std::copy(shards_.begin(), shards_.end() - 1, std::ostream_iterator<unsigned>(ss, ", "));
+    ss << shards_.back();
+    shards_.clear();
+  }
   ss << "], \"core\": " << core_ << ", ";
   for (int i = 0; i < MAX_EVENT; ++i) {
     ss << "\"" << ThreadPoolProfiler::GetEventName(static_cast<ThreadPoolEvent>(i))
@@ -230,11 +252,34 @@ void ThreadPoolProfiler::LogRun(int thread_idx) {
   }
 }
 
+void ThreadPoolProfiler::LogSteal(int thread_idx) {
+  if (enabled_ && thread_idx >= 0) {
+    child_thread_stats_[thread_idx].num_steal_++;
+  }
+}
+
+void ThreadPoolProfiler::LogSpinTime(int thread_idx, uint64_t microseconds) {
+  if (enabled_ && thread_idx >= 0) {
+    child_thread_stats_[thread_idx].spin_time_us_ += microseconds;
+  }
+}
+
+void ThreadPoolProfiler::LogQueueLatency(int thread_idx, uint64_t microseconds) {
+  if (enabled_ && thread_idx >= 0) {
+    child_thread_stats_[thread_idx].queue_latency_us_ += microseconds;
+    child_thread_stats_[thread_idx].num_latency_samples_++;
+  }
+}
+
 std::string ThreadPoolProfiler::DumpChildThreadStat() {
   std::stringstream ss;
   for (int i = 0; i < num_threads_; ++i) {
     ss << "\"" << child_thread_stats_[i].thread_id_ << "\": {"
        << "\"num_run\": " << child_thread_stats_[i].num_run_ << ", "
+       << "\"num_steal\": " << child_thread_stats_[i].num_steal_ << ", "
+       << "\"spin_time_us\": " << child_thread_stats_[i].spin_time_us_ << ", "
+       << "\"queue_latency_us\": " << child_thread_stats_[i].queue_latency_us_ << ", "
+       << "\"num_queued_tasks\": " << child_thread_stats_[i].num_latency_samples_ << ", "
        << "\"core\": " << child_thread_stats_[i].core_ << "}"
        << (i == num_threads_ - 1 ? "" : ",");
   }
@@ -369,6 +414,112 @@ class alignas(CACHE_LINE_BYTES) LoopCounter {
 #pragma warning(pop) /* Padding added in LoopCounterShard, LoopCounter */
 #endif
 
+// Per-pool feedback tuner for cost-model driven parallel loops.  The static cost model
+// overpredicts the benefit of sharding small shapes, and on many ops the dispatch and join
+// overhead makes parallel execution slower than sequential.  Loops that repeat with the same
+// signature - iteration count plus per-iteration cost estimate, which in practice identifies
+// the kernel and shape - are timed at a few candidate degrees of parallelism, after which the
+// fastest candidate is used for all subsequent calls.  Candidates are 1 (sequential) and the
+// powers of two up to the pool's degree of parallelism.  The learned table lives as long as
+// the pool, i.e. as long as the session owning it.
+class ThreadPool::LoopTuner {
+ public:
+  // Number of timed runs of each candidate before converging.  The minimum over the samples is
+  // compared, so a one-off stall does not disqualify a candidate.
+  static constexpr uint32_t kSamplesPerCandidate = 3;
+
+  // Returns the degree of parallelism to run this call with: a candidate that still needs
+  // samples while measuring, or the fastest candidate once all of them have been measured.
+  int ChooseDegreeOfParallelism(std::ptrdiff_t n, const TensorOpCost& cost, int max_dop) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    LoopState& state = loops_[MakeKey(n, cost)];
+    if (state.candidates.empty()) {
+      for (int dop = 1; dop < max_dop; dop *= 2) {
+        state.candidates.push_back({dop, 0, std::numeric_limits<double>::infinity()});
+      }
+      state.candidates.push_back({max_dop, 0, std::numeric_limits<double>::infinity()});
+    }
+
+    if (state.chosen_dop != 0) {
+      return state.chosen_dop;
+    }
+
+    // Hand out candidates round-robin so the samples of each candidate spread over time.
+    const size_t num_candidates = state.candidates.size();
+    for (size_t scanned = 0; scanned < num_candidates; ++scanned) {
+      const Candidate& candidate = state.candidates[state.next_candidate];
+      state.next_candidate = (state.next_candidate + 1) % num_candidates;
+      if (candidate.samples < kSamplesPerCandidate) {
+        return candidate.dop;
+      }
+    }
+
+    const auto best = std::min_element(
+        state.candidates.begin(), state.candidates.end(),
+        [](const Candidate& a, const Candidate& b) { return a.best_seconds < b.best_seconds; });
+    state.chosen_dop = best->dop;
+    return state.chosen_dop;
+  }
+
+  void ReportDuration(std::ptrdiff_t n, const TensorOpCost& cost, int dop, double seconds) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto it = loops_.find(MakeKey(n, cost));
+    if (it == loops_.end() || it->second.chosen_dop != 0) {
+      return;
+    }
+    for (Candidate& candidate : it->second.candidates) {
+      if (candidate.dop == dop) {
+        candidate.samples++;
+        candidate.best_seconds = std::min(candidate.best_seconds, seconds);
+        break;
+      }
+    }
+  }
+
+ private:
+  struct Candidate {
+    int dop;
+    uint32_t samples;
+    double best_seconds;
+  };
+
+  struct LoopState {
+    std::vector<Candidate> candidates;
+    // The converged degree of parallelism; 0 while candidates are still being measured.
+    int chosen_dop{0};
+    size_t next_candidate{0};
+  };
+
+  struct LoopKey {
+    std::ptrdiff_t n;
+    double bytes_loaded;
+    double bytes_stored;
+    double compute_cycles;
+
+    bool operator==(const LoopKey& other) const {
+      return n == other.n && bytes_loaded == other.bytes_loaded &&
+             bytes_stored == other.bytes_stored && compute_cycles == other.compute_cycles;
+    }
+  };
+
+  struct LoopKeyHash {
+    size_t operator()(const LoopKey& key) const {
+      size_t value = std::hash<std::ptrdiff_t>()(key.n);
+      HashCombine(key.bytes_loaded, value);
+      HashCombine(key.bytes_stored, value);
+      HashCombine(key.compute_cycles, value);
+      return value;
+    }
+  };
+
+  static LoopKey MakeKey(std::ptrdiff_t n, const TensorOpCost& cost) {
+    return LoopKey{n, cost.bytes_loaded, cost.bytes_stored, cost.compute_cycles};
+  }
+
+  OrtMutex mutex_;
+  std::unordered_map<LoopKey, LoopState, LoopKeyHash> loops_;
+};
+
 ThreadPool::ThreadPool(Env* env,
                        const ThreadOptions& thread_options,
                        const NAME_CHAR_TYPE* name,
@@ -397,6 +548,10 @@ ThreadPool::ThreadPool(Env* env,
                                                 thread_options_);
     underlying_threadpool_ = extended_eigen_threadpool_.get();
   }
+
+  if (thread_options_.loop_tuning && underlying_threadpool_ != nullptr) {
+    loop_tuner_ = std::make_unique<LoopTuner>();
+  }
 }
 
 ThreadPool::~ThreadPool() = default;
@@ -415,6 +570,26 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
     return;
   }
 
+  // A high-priority loop advertises itself on the pool for its whole duration so
+  // that concurrent low-priority loops release their workers at the next shard
+  // boundary.  Low-priority participants other than the caller stop claiming
+  // iterations while a high-priority loop is active; the caller always keeps
+  // claiming, so the loop still completes all iterations.
+  const Priority priority = CurrentThreadPriority();
+  struct HighPriorityLoopScope {
+    std::atomic<int>* counter;
+    HighPriorityLoopScope(std::atomic<int>* c) : counter(c) {
+      if (counter) counter->fetch_add(1, std::memory_order_relaxed);
+    }
+    ~HighPriorityLoopScope() {
+      if (counter) counter->fetch_sub(1, std::memory_order_relaxed);
+    }
+  } high_priority_scope{priority == Priority::kHigh ? &high_priority_loops_ : nullptr};
+  auto yield_to_high_priority = [this, priority](unsigned idx) -> bool {
+    return priority == Priority::kLow && idx != 0 &&
+           high_priority_loops_.load(std::memory_order_relaxed) > 0;
+  };
+
   auto d_of_p = DegreeOfParallelism(this);
   if (thread_options_.dynamic_block_base_ <= 0) {
     // Split the work across threads in the pool.  Each work item will run a loop claiming iterations,
@@ -432,6 +607,9 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
       while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, block_size)) {
         fn(static_cast<std::ptrdiff_t>(my_iter_start),
            static_cast<std::ptrdiff_t>(my_iter_end));
+        if (yield_to_high_priority(idx)) {
+          break;
+        }
       }
     };
     // Run the work in the thread pool (and in the current thread).  Synchronization with helping
@@ -455,6 +633,9 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
         if (b > 1) {
           b = static_cast<std::ptrdiff_t>(std::max(1LL, std::llroundl(static_cast<long double>(todo) / num_of_blocks)));
         }
+        if (yield_to_high_priority(idx)) {
+          break;
+        }
       }
     };
     // Distribute task among all threads in the pool, reduce number of work items if
@@ -479,6 +660,14 @@ void ThreadPool::Schedule(std::function<void()> fn) {
   }
 }
 
+void ThreadPool::ScheduleSpread(std::function<void()> fn) {
+  if (underlying_threadpool_) {
+    underlying_threadpool_->ScheduleSpread(std::move(fn));
+  } else {
+    fn();
+  }
+}
+
 void ThreadPool::StartProfiling() {
   if (underlying_threadpool_) {
     underlying_threadpool_->StartProfiling();
@@ -495,6 +684,8 @@ std::string ThreadPool::StopProfiling() {
 
 namespace {
 thread_local std::optional<ThreadPoolParallelSection> current_parallel_section;
+thread_local ThreadPool::Priority current_thread_priority = ThreadPool::Priority::kNormal;
+thread_local int current_thread_parallelism_cap = 0;  // 0 means no cap
 }
 
 ThreadPool::ParallelSection::ParallelSection(ThreadPool* tp) {
@@ -515,6 +706,27 @@ ThreadPool::ParallelSection::~ParallelSection() {
   }
 }
 
+ThreadPool::PriorityScope::PriorityScope(Priority priority) : previous_(current_thread_priority) {
+  current_thread_priority = priority;
+}
+
+ThreadPool::PriorityScope::~PriorityScope() {
+  current_thread_priority = previous_;
+}
+
+ThreadPool::Priority ThreadPool::CurrentThreadPriority() {
+  return current_thread_priority;
+}
+
+ThreadPool::ParallelismCapScope::ParallelismCapScope(int cap) : previous_(current_thread_parallelism_cap) {
+  ORT_ENFORCE(cap > 0, "Parallelism cap must be positive");
+  current_thread_parallelism_cap = previous_ > 0 ? std::min(previous_, cap) : cap;
+}
+
+ThreadPool::ParallelismCapScope::~ParallelismCapScope() {
+  current_thread_parallelism_cap = previous_;
+}
+
 void ThreadPool::RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, std::ptrdiff_t block_size) {
   if (underlying_threadpool_) {
     if (current_parallel_section.has_value()) {
@@ -615,6 +827,21 @@ void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
   ORT_ENFORCE(n >= 0);
   Eigen::TensorOpCost cost{c.bytes_loaded, c.bytes_stored, c.compute_cycles};
   auto d_of_p = DegreeOfParallelism(this);
+
+  if (loop_tuner_ != nullptr && ShouldParallelizeLoop(n)) {
+    const int dop = loop_tuner_->ChooseDegreeOfParallelism(n, c, d_of_p);
+    const auto start = std::chrono::steady_clock::now();
+    if (dop <= 1) {
+      f(0, n);
+    } else {
+      const ptrdiff_t block = Eigen::numext::div_ceil<ptrdiff_t>(n, static_cast<ptrdiff_t>(dop));
+      ParallelForFixedBlockSizeScheduling(n, block, f);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    loop_tuner_->ReportDuration(n, c, dop, seconds);
+    return;
+  }
+
   // Compute small problems directly in the caller thread.
   if ((!ShouldParallelizeLoop(n)) ||
       CostModel::numThreads(static_cast<double>(n), cost, d_of_p) == 1) {
@@ -638,15 +865,22 @@ bool ThreadPool::ShouldParallelize(const concurrency::ThreadPool* tp) {
 int ThreadPool::DegreeOfParallelism(const concurrency::ThreadPool* tp) {
   // When not using OpenMP, we parallelise over the N threads created by the pool
   // tp, plus 1 for the thread entering a loop.
+  int dop;
   if (tp) {
     if (tp->force_hybrid_ || CPUIDInfo::GetCPUIDInfo().IsHybrid()) {
-      return ((tp->NumThreads() + 1)) * TaskGranularityFactor;
+      dop = ((tp->NumThreads() + 1)) * TaskGranularityFactor;
     } else {
-      return ((tp->NumThreads() + 1));
+      dop = ((tp->NumThreads() + 1));
     }
   } else {
-    return 1;
+    dop = 1;
+  }
+  // A caller-applied cap acts as a quota on pools shared between sessions.
+  const int cap = current_thread_parallelism_cap;
+  if (cap > 0 && cap < dop) {
+    dop = cap;
   }
+  return dop;
 }
 
 void ThreadPool::StartProfiling(concurrency::ThreadPool* tp) {
@@ -98,6 +98,32 @@ class TensorSeq {
     Add(std::move(value));
   }
 
+  // Allocates a single buffer that can back multiple elements of a sequence via AddFromSlab.
+  // For sequences of many small tensors the per-element allocations dominate, so kernels that produce the
+  // whole sequence at once can make one allocation and add the elements as views into it.
+  static std::shared_ptr<void> AllocateSlab(const AllocatorPtr& allocator, size_t size_in_bytes) {
+    return std::shared_ptr<void>(allocator->Alloc(size_in_bytes),
+                                 [allocator](void* p) { allocator->Free(p); });
+  }
+
+  // Adds an element that is a view over the bytes of `slab` starting at `offset_in_bytes`. The element's
+  // OrtValue shares ownership of the slab, so it remains valid if it is copied into another sequence that
+  // outlives this one. Returns the added tensor so the caller can fill in its data.
+  Tensor& AddFromSlab(const std::shared_ptr<void>& slab, const TensorShape& shape,
+                      const OrtMemoryInfo& location, ptrdiff_t offset_in_bytes) {
+    ORT_ENFORCE(elem_type_ != nullptr, "TensorSeq: SetType must be called before AddFromSlab.");
+    ORT_ENFORCE(elem_type_->GetDataType() != ONNX_NAMESPACE::TensorProto_DataType_STRING,
+                "TensorSeq: string tensors cannot be backed by a slab.");
+    auto tensor = std::make_unique<Tensor>(elem_type_, shape,
+                                           static_cast<char*>(slab.get()) + offset_in_bytes, location);
+    Tensor* p_tensor = tensor.release();
+    OrtValue value;
+    value.Init(p_tensor, DataTypeImpl::GetType<Tensor>(),
+               [slab](void* p) { delete static_cast<Tensor*>(p); });
+    tensors_.push_back(std::move(value));
+    return *p_tensor;
+  }
+
   static void InitOrtValue(const TensorSeq& source_tensor_seq, std::shared_ptr<IAllocator> allocator, OrtValue& ort_value) {
     auto target_tensor_seq = std::make_unique<TensorSeq>(source_tensor_seq.DataType());
     target_tensor_seq->Reserve(source_tensor_seq.Size());
@@ -374,8 +374,9 @@ class PlannerImpl {
     // and share the data from the corresponding input specified in MayStridedOutputsMap.
     const auto& may_strided_outputs_map = ci.kernel_def->MayStridedOutput();
     for (auto& pair : may_strided_outputs_map) {
-      if (pair.second == output_arg_num && pair.first >= 0 && static_cast<size_t>(pair.first) < input_args.size() &&
-          input_args[pair.first]->Exists()) {
+      // an output index of -1 in the map matches any output (kernels with variadic outputs)
+      if ((pair.second == output_arg_num || pair.second == -1) && pair.first >= 0 &&
+          static_cast<size_t>(pair.first) < input_args.size() && input_args[pair.first]->Exists()) {
         bool can_strided = true;
         for (auto it = node.OutputNodesBegin(); it != node.OutputNodesEnd(); ++it) {
           const KernelCreateInfo& output_node_ci = GetKernelCreateInfo(kernel_create_info_map_, it->Index());
@@ -2416,6 +2417,106 @@ void DeviceBasedPartitioner::SaveConfig() const {
   }
 }
 
+// Partitions nodes so that independent branches of the graph land in separate logic streams on
+// the same device, letting e.g. multiple task heads that share a backbone overlap across the
+// inter-op thread pool. A node that leads to exactly one sink node (a node without consumers) is
+// assigned to that sink's branch stream; nodes that reach several sinks (the shared backbone) run
+// in a shared stream which the branch streams synchronize on through the regular inter-stream
+// dependencies. Only CPU nodes are split per branch; other devices keep one stream per device
+// type as with DeviceBasedPartitioner.
+class ParallelBranchPartitioner : public IGraphPartitioner {
+ public:
+  ParallelBranchPartitioner(const logging::Logger& logger,
+                            const PathString& config_file) : IGraphPartitioner(logger, config_file) {}
+
+  Status PartitionGraph(const onnxruntime::GraphViewer& graph_viewer,
+                        const ExecutionProviders& execution_providers,
+                        std::vector<InlinedVector<NodeIndex>>& stream_nodes,
+                        ExecutionOrder execution_order) override;
+
+  const char* Type() const override { return "ParallelBranchPartitioner"; }
+  size_t Streams() const override { return num_streams_; }
+
+ private:
+  // bound the number of branch streams per device; past this point the barrier/notification
+  // overhead outweighs what the extra overlap buys.
+  static constexpr size_t kMaxBranchStreamsPerDevice = 8;
+  size_t num_streams_ = 0;
+};
+
+Status ParallelBranchPartitioner::PartitionGraph(const onnxruntime::GraphViewer& graph_viewer,
+                                                 const ExecutionProviders& execution_providers,
+                                                 std::vector<InlinedVector<NodeIndex>>& stream_nodes,
+                                                 ExecutionOrder execution_order) {
+  constexpr int kSharedBranch = -1;
+  const auto& p_graph_nodes = graph_viewer.GetNodesInTopologicalOrder(execution_order);
+
+  // walk the nodes in reverse topological order and label each one with the single sink node it
+  // leads to, or kSharedBranch when it feeds more than one branch.
+  InlinedHashMap<NodeIndex, int> node_branch;
+  node_branch.reserve(p_graph_nodes.size());
+  int num_branches = 0;
+  for (auto it = p_graph_nodes.rbegin(); it != p_graph_nodes.rend(); ++it) {
+    const auto* node = graph_viewer.GetNode(*it);
+    bool has_consumers = false;
+    bool branch_set = false;
+    int branch = kSharedBranch;
+    for (auto consumer = node->OutputNodesBegin(); consumer != node->OutputNodesEnd(); ++consumer) {
+      auto consumer_branch = node_branch.find(consumer->Index());
+      if (consumer_branch == node_branch.end()) {
+        continue;
+      }
+      has_consumers = true;
+      if (!branch_set) {
+        branch = consumer_branch->second;
+        branch_set = true;
+      } else if (branch != consumer_branch->second) {
+        branch = kSharedBranch;
+      }
+    }
+    if (!has_consumers) {
+      branch = num_branches++;  // each sink starts its own branch
+    }
+    node_branch[*it] = branch;
+  }
+
+  // assign streams: CPU nodes per branch, other devices one stream per device type.
+  InlinedHashMap<OrtDevice::DeviceType, int> device_to_stream;
+  InlinedHashMap<int, int> branch_to_stream;
+  stream_nodes.clear();
+  for (auto node_index : p_graph_nodes) {
+    const auto* node = graph_viewer.GetNode(node_index);
+    auto* ep = execution_providers.Get(*node);
+    auto device_type = ep->GetOrtDeviceByMemType(OrtMemType::OrtMemTypeDefault).Type();
+    int stream_index;
+    if (device_type == OrtDevice::CPU) {
+      int branch = node_branch[node_index];
+      if (branch != kSharedBranch &&
+          branch_to_stream.find(branch) == branch_to_stream.end() &&
+          branch_to_stream.size() >= kMaxBranchStreamsPerDevice) {
+        branch = kSharedBranch;  // fold excess branches into the shared stream
+      }
+      auto it = branch_to_stream.find(branch);
+      if (it == branch_to_stream.end()) {
+        it = branch_to_stream.emplace(branch, static_cast<int>(stream_nodes.size())).first;
+        stream_nodes.emplace_back();
+      }
+      stream_index = it->second;
+    } else {
+      auto it = device_to_stream.find(device_type);
+      if (it == device_to_stream.end()) {
+        it = device_to_stream.emplace(device_type, static_cast<int>(stream_nodes.size())).first;
+        stream_nodes.emplace_back();
+      }
+      stream_index = it->second;
+    }
+    stream_nodes[stream_index].push_back(node_index);
+  }
+
+  num_streams_ = stream_nodes.size();
+  return Status::OK();
+}
+
 std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(const logging::Logger& logger,
                                                                              const PathString& config_file) {
   // use device based partitioner by default
@@ -2430,6 +2531,8 @@ std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(con
           auto type = json_config["type"];
           if (type == "DeviceBasedPartitioner") {
             partitioner_type = IGraphPartitioner::GraphPartitioningStrategy::DeviceBasedPartition;
+          } else if (type == "ParallelBranchPartitioner") {
+            partitioner_type = IGraphPartitioner::GraphPartitioningStrategy::ParallelBranchPartition;
           }
         }
       } catch (const std::exception& ex) {
@@ -2438,6 +2541,10 @@ std::unique_ptr<IGraphPartitioner> IGraphPartitioner::CreateGraphPartitioner(con
       f.close();
     }
   }
+  if (partitioner_type == IGraphPartitioner::GraphPartitioningStrategy::ParallelBranchPartition) {
+    LOGS(logger, INFO) << "Use ParallelBranchPartition";
+    return std::make_unique<ParallelBranchPartitioner>(logger, config_file);
+  }
   if (partitioner_type == IGraphPartitioner::GraphPartitioningStrategy::DeviceBasedPartition) {
     LOGS(logger, INFO) << "Use DeviceBasedPartition as default";
     return std::make_unique<DeviceBasedPartitioner>(logger, config_file);
@@ -82,9 +82,12 @@ class IGraphPartitioner {
   // DeviceBasedPartitioner is the default, who partitions a graph based off device information.
   // i.e., given a graph which has CPU EP nodes, Cuda EP nodes and TRT EP nodes,
   // it will be partitioned as two sequences, one is for CPU EP nodes, another is for TRT and Cuda nodes.
+  // ParallelBranchPartition additionally splits independent branches of the graph (e.g. multiple
+  // heads sharing a backbone) into separate streams on the same device so they can overlap.
   // We will add more optimized partitioner later.
   enum GraphPartitioningStrategy {
     DeviceBasedPartition = 0,
+    ParallelBranchPartition,
     Unknown,
   };
   virtual ~IGraphPartitioner() = default;
@@ -11,6 +11,7 @@
 #include "core/common/logging/logging.h"
 #include "core/common/narrow.h"
 #include "core/framework/bfc_arena.h"
+#include "core/platform/env.h"
 
 namespace onnxruntime {
 using namespace common;
@@ -32,6 +33,10 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
     int64_t max_power_of_two_extend_bytes = info.arena_cfg.max_power_of_two_extend_bytes == -1
                                                 ? BFCArena::DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES
                                                 : info.arena_cfg.max_power_of_two_extend_bytes;
+    bool use_huge_pages = info.arena_cfg.use_huge_pages == 1;
+    int free_region_idle_timeout_ms = info.arena_cfg.free_region_idle_timeout_ms < 0
+                                          ? BFCArena::DEFAULT_FREE_REGION_IDLE_TIMEOUT_MS
+                                          : info.arena_cfg.free_region_idle_timeout_ms;
     ArenaExtendStrategy arena_extend_str;
     switch (info.arena_cfg.arena_extend_strategy) {
       case static_cast<int>(ArenaExtendStrategy::kSameAsRequested):
@@ -61,6 +66,30 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
       ORT_THROW("StreamAwareArena should be transparent to minimal build.");
 #endif
     } else {
+      if (info.use_numa_partitioned_arena) {
+        const int num_numa_nodes = Env::Default().GetNumNumaNodes();
+        if (num_numa_nodes > 1) {
+          std::vector<std::unique_ptr<IAllocator>> node_allocators;
+          node_allocators.reserve(static_cast<size_t>(num_numa_nodes));
+          node_allocators.push_back(std::move(device_allocator));
+          for (int node = 1; node < num_numa_nodes; ++node) {
+            node_allocators.push_back(info.device_alloc_factory(info.device_id));
+          }
+
+          return AllocatorPtr(
+              std::make_unique<NumaPartitionedArena>(std::move(node_allocators),
+                                                     max_mem,
+                                                     arena_extend_str,
+                                                     initial_chunk_size_bytes,
+                                                     max_dead_bytes_per_chunk,
+                                                     initial_growth_chunk_size_bytes,
+                                                     max_power_of_two_extend_bytes,
+                                                     use_huge_pages,
+                                                     free_region_idle_timeout_ms));
+        }
+        // fall through to a single arena on single-node machines
+      }
+
       return AllocatorPtr(
           std::make_unique<BFCArena>(std::move(device_allocator),
                                      max_mem,
@@ -68,7 +97,9 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
                                      initial_chunk_size_bytes,
                                      max_dead_bytes_per_chunk,
                                      initial_growth_chunk_size_bytes,
-                                     max_power_of_two_extend_bytes));
+                                     max_power_of_two_extend_bytes,
+                                     use_huge_pages,
+                                     free_region_idle_timeout_ms));
     }
   } else {
     return device_allocator;
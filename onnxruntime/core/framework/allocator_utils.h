@@ -20,13 +20,15 @@ struct AllocatorCreationInfo {
                         bool use_arena = true,
                         OrtArenaCfg arena_cfg = {0, -1, -1, -1, -1, -1L},
                         bool stream_aware_arena = false,
-                        bool cross_stream_reusing = false)
+                        bool cross_stream_reusing = false,
+                        bool numa_partitioned_arena = false)
       : device_alloc_factory(device_alloc_factory),
         device_id(device_id),
         use_arena(use_arena),
         arena_cfg(arena_cfg),
         use_stream_aware_arena(stream_aware_arena),
-        enable_cross_stream_reusing(cross_stream_reusing) {
+        enable_cross_stream_reusing(cross_stream_reusing),
+        use_numa_partitioned_arena(numa_partitioned_arena) {
   }
 
   AllocatorFactory device_alloc_factory;
@@ -35,6 +37,8 @@ struct AllocatorCreationInfo {
   OrtArenaCfg arena_cfg;
   bool use_stream_aware_arena;
   bool enable_cross_stream_reusing;
+  // partition the arena into per-NUMA-node sub-arenas. has no effect on single-node machines.
+  bool use_numa_partitioned_arena;
 };
 
 // Returns an allocator (an instance of IAllocator) based on the creation info provided.
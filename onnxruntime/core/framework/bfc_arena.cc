@@ -3,6 +3,8 @@
 
 #include "core/framework/allocator.h"
 #include "core/framework/bfc_arena.h"
+#include "core/platform/env.h"
+#include "core/platform/tracing.h"
 #include <type_traits>
 
 namespace onnxruntime {
@@ -12,7 +14,9 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
                    int initial_chunk_size_bytes,
                    int max_dead_bytes_per_chunk,
                    int initial_growth_chunk_size_bytes,
-                   int64_t max_power_of_two_extend_bytes)
+                   int64_t max_power_of_two_extend_bytes,
+                   bool use_huge_pages,
+                   int free_region_idle_timeout_ms)
     : IAllocator(OrtMemoryInfo(resource_allocator->Info().name,
                                OrtAllocatorType::OrtArenaAllocator,
                                resource_allocator->Info().device,
@@ -25,12 +29,16 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
       initial_chunk_size_bytes_(initial_chunk_size_bytes),
       max_dead_bytes_per_chunk_(max_dead_bytes_per_chunk),
       initial_growth_chunk_size_bytes_(initial_growth_chunk_size_bytes),
-      max_power_of_two_extend_bytes_(max_power_of_two_extend_bytes) {
+      max_power_of_two_extend_bytes_(max_power_of_two_extend_bytes),
+      use_huge_pages_(use_huge_pages && device_allocator_->Info().device.Type() == OrtDevice::CPU),
+      free_region_idle_timeout_ms_(free_region_idle_timeout_ms) {
   LOGS_DEFAULT(INFO) << "Creating BFCArena for " << device_allocator_->Info().name
                      << " with following configs: initial_chunk_size_bytes: " << initial_chunk_size_bytes_
                      << " max_dead_bytes_per_chunk: " << max_dead_bytes_per_chunk_
                      << " initial_growth_chunk_size_bytes: " << initial_growth_chunk_size_bytes_
                      << " max_power_of_two_extend_bytes: " << max_power_of_two_extend_bytes_
+                     << " use_huge_pages: " << use_huge_pages_
+                     << " free_region_idle_timeout_ms: " << free_region_idle_timeout_ms_
                      << " memory limit: " << total_memory
                      << " arena_extend_strategy: " << static_cast<int32_t>(arena_extend_strategy);
 
@@ -211,6 +219,15 @@ Status BFCArena::Extend(size_t rounded_bytes) {
 
   LOGS_DEFAULT(INFO) << "Allocated memory at " << mem_addr << " to "
                      << static_cast<void*>(static_cast<char*>(mem_addr) + bytes);
+
+  // Large regions hold long-lived weights that are read on every Run, so
+  // backing them with huge pages saves TLB misses. Smaller regions are not
+  // worth the alignment loss. Best effort: unsupported platforms ignore this.
+  constexpr size_t kHugePageMinRegionBytes = 2 * 1024 * 1024;
+  if (use_huge_pages_ && bytes >= kHugePageMinRegionBytes) {
+    Env::Default().AdviseHugePages(mem_addr, bytes);
+  }
+
   region_manager_.AddAllocationRegion(mem_addr, bytes, stats_.num_arena_extensions);
   stats_.num_arena_extensions += 1;
 
@@ -269,6 +286,7 @@ size_t BFCArena::RoundedBytes(size_t bytes) {
 }
 
 void* BFCArena::Alloc(size_t size) {
+  ORT_TRACEPOINT_ARENA_ALLOC(device_allocator_->Info().name, size);
   return AllocateRawInternal(size, false, nullptr, false, nullptr);
 }
 
@@ -326,6 +344,20 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   BinNum bin_num = BinNumForSize(rounded_bytes);
 
   std::lock_guard<OrtMutex> lock(lock_);
+
+  // fail fast if this allocation would push the stream past its budget, so a single run with
+  // pathological shapes surfaces an error instead of growing the arena at the expense of
+  // co-tenant sessions.
+  if (stream != nullptr) {
+    auto usage_it = stream_usage_.find(stream);
+    if (usage_it != stream_usage_.end() && usage_it->second.budget_bytes > 0 &&
+        usage_it->second.bytes_in_use + rounded_bytes > usage_it->second.budget_bytes) {
+      ORT_THROW("Stream memory budget exceeded on ", device_allocator_->Info().name,
+                ". Requested: ", num_bytes, " bytes. In use on stream: ", usage_it->second.bytes_in_use,
+                " bytes. Budget: ", usage_it->second.budget_bytes, " bytes.");
+    }
+  }
+
   // search for a valid chunk
   auto* chunk = FindChunkPtr(bin_num,
                              rounded_bytes,
@@ -341,6 +373,9 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
       if (stream)
         chunk->stream_timestamp = stream->GetCurrentTimestamp();
     }
+    if (chunk->stream != nullptr) {
+      stream_usage_[chunk->stream].bytes_in_use += chunk->size;
+    }
     return chunk->ptr;
   }
 
@@ -356,6 +391,9 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
       if (chunk->stream == nullptr && stream) {
         chunk->stream = stream;
       }
+      if (chunk->stream != nullptr) {
+        stream_usage_[chunk->stream].bytes_in_use += chunk->size;
+      }
       return chunk->ptr;
     } else {
       status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
@@ -376,6 +414,11 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   ORT_THROW(status.ErrorMessage());
 }
 
+void BFCArena::SetStreamMemoryBudget(Stream* stream, size_t budget_bytes) {
+  std::lock_guard<OrtMutex> lock(lock_);
+  stream_usage_[stream].budget_bytes = budget_bytes;
+}
+
 void BFCArena::GetStats(AllocatorStats* stats) {
   std::lock_guard<OrtMutex> lock(lock_);
   *stats = stats_;
@@ -496,6 +539,7 @@ void BFCArena::Free(void* p) {
   if (p == nullptr) {
     return;
   }
+  ORT_TRACEPOINT_ARENA_FREE(device_allocator_->Info().name, p);
   std::lock_guard<OrtMutex> lock(lock_);
   auto it = reserved_chunks_.find(p);
   if (it != reserved_chunks_.end()) {
@@ -525,54 +569,163 @@ Status BFCArena::Shrink() {
 
   size_t i = 0;
   for (void* region_ptr : region_ptrs) {
-    bool deallocate_region = true;
-    ChunkHandle region_begin_chunk = region_manager_.get_handle(region_ptr);
-    ChunkHandle h = region_begin_chunk;
-    while (h != kInvalidChunkHandle) {
-      const Chunk* c = ChunkFromHandle(h);
-      if (c->in_use()) {
-        // at-least one used chunk found in the allocation region -
-        // so we cannot deallocate it
-        deallocate_region = false;
-        break;
-      }
-      h = c->next;
+    TryDeallocateRegion(region_ptr, region_sizes[i]);
+    ++i;
+  }
+
+  // Will affect how the arena grows if the arena extend strategy is kNextPowerOfTwo
+  // In case the extend strategy is kSameAsRequested, the arena growth is exactly the size of the memory request itself
+  curr_region_allocation_bytes_ = initial_growth_chunk_size_bytes_;
+
+  return Status::OK();
+}
+
+bool BFCArena::TryDeallocateRegion(void* region_ptr, size_t region_size) {
+  ChunkHandle region_begin_chunk = region_manager_.get_handle(region_ptr);
+  ChunkHandle h = region_begin_chunk;
+  while (h != kInvalidChunkHandle) {
+    const Chunk* c = ChunkFromHandle(h);
+    if (c->in_use()) {
+      // at-least one used chunk found in the allocation region -
+      // so we cannot deallocate it
+      return false;
     }
+    h = c->next;
+  }
+
+  stats_.num_arena_shrinkages += 1;
+  stats_.total_allocated_bytes -= region_size;
+
+  LOGS_DEFAULT(VERBOSE) << device_allocator_->Info().name << " BFC Arena shrunk by "
+                        << region_size << " bytes. "
+                        << " The total allocated bytes is now " << stats_.total_allocated_bytes;
+
+  h = region_begin_chunk;
+  ChunkHandle temp = region_begin_chunk;
+  while (h != kInvalidChunkHandle) {
+    const Chunk* c = ChunkFromHandle(h);
+    temp = c->next;
+    RemoveFreeChunkFromBin(h);
+    DeleteChunk(h);
+    h = temp;
+  }
 
-    if (deallocate_region) {
-      auto shrink_size = region_sizes[i];
-      stats_.num_arena_shrinkages += 1;
-      stats_.total_allocated_bytes -= shrink_size;
+  device_allocator_->Free(region_ptr);
+  region_manager_.RemoveAllocationRegion(region_ptr);
+  stats_.num_arena_extensions--;
 
-      LOGS_DEFAULT(VERBOSE) << device_allocator_->Info().name << " BFC Arena shrunk by "
-                            << shrink_size << " bytes. "
-                            << " The total allocated bytes is now " << stats_.total_allocated_bytes;
+  return true;
+}
 
-      h = region_begin_chunk;
-      ChunkHandle temp = region_begin_chunk;
-      while (h != kInvalidChunkHandle) {
-        const Chunk* c = ChunkFromHandle(h);
-        temp = c->next;
-        RemoveFreeChunkFromBin(h);
-        DeleteChunk(h);
-        h = temp;
-      }
+Status BFCArena::Defragment() {
+  std::lock_guard<OrtMutex> lock(lock_);
 
-      device_allocator_->Free(region_ptr);
-      region_manager_.RemoveAllocationRegion(region_ptr);
-      stats_.num_arena_extensions--;
+  // Walk the address-ordered region list and merge every pair of physically contiguous
+  // regions. After a merge the newly combined region may itself be contiguous with its
+  // successor, so stay at the same index until the neighbor is disjoint.
+  size_t merged_regions = 0;
+  size_t i = 0;
+  while (i + 1 < region_manager_.regions().size()) {
+    const AllocationRegion& region = region_manager_.regions()[i];
+    const AllocationRegion& next_region = region_manager_.regions()[i + 1];
+
+    if (region.end_ptr() != next_region.ptr()) {
+      ++i;
+      continue;
     }
 
-    ++i;
+    MergeContiguousRegions(i);
+    ++merged_regions;
   }
 
-  // Will affect how the arena grows if the arena extend strategy is kNextPowerOfTwo
-  // In case the extend strategy is kSameAsRequested, the arena growth is exactly the size of the memory request itself
-  curr_region_allocation_bytes_ = initial_growth_chunk_size_bytes_;
+  if (merged_regions > 0) {
+    LOGS_DEFAULT(INFO) << device_allocator_->Info().name << " BFC Arena defragmentation merged "
+                       << merged_regions << " contiguous region(s). "
+                       << region_manager_.regions().size() << " region(s) remain.";
+  }
 
   return Status::OK();
 }
 
+void BFCArena::MergeContiguousRegions(size_t region_index) {
+  void* first_ptr;
+  void* second_ptr;
+  size_t merged_size;
+  int64_t merged_id;
+
+  {
+    const AllocationRegion& first = region_manager_.regions()[region_index];
+    const AllocationRegion& second = region_manager_.regions()[region_index + 1];
+    ORT_ENFORCE(first.end_ptr() == second.ptr());
+    first_ptr = first.ptr();
+    second_ptr = second.ptr();
+    merged_size = first.memory_size() + second.memory_size();
+    merged_id = first.id();
+  }
+
+  // Collect every chunk of both regions before the per-region handle tables are dropped.
+  // The chunks themselves (and their intra-region prev/next links) are not affected by
+  // the region bookkeeping being rebuilt.
+  std::vector<ChunkHandle> handles;
+  size_t first_region_chunks = 0;
+  for (void* region_ptr : {first_ptr, second_ptr}) {
+    ChunkHandle h = region_manager_.get_handle(region_ptr);
+    while (h != kInvalidChunkHandle) {
+      handles.push_back(h);
+      h = ChunkFromHandle(h)->next;
+    }
+
+    if (region_ptr == first_ptr) {
+      first_region_chunks = handles.size();
+    }
+  }
+
+  // Replace the two regions with one covering both address ranges.
+  region_manager_.RemoveAllocationRegion(first_ptr);
+  region_manager_.RemoveAllocationRegion(second_ptr);
+  region_manager_.AddAllocationRegion(first_ptr, merged_size, merged_id);
+  for (ChunkHandle h : handles) {
+    region_manager_.set_handle(ChunkFromHandle(h)->ptr, h);
+  }
+  stats_.num_arena_extensions -= 1;
+
+  // Stitch the chunk lists together and coalesce across the former boundary when both
+  // border chunks are free, which is what makes a large free block reappear.
+  ChunkHandle last_of_first = handles[first_region_chunks - 1];
+  ChunkHandle first_of_second = handles[first_region_chunks];
+  ChunkFromHandle(last_of_first)->next = first_of_second;
+  ChunkFromHandle(first_of_second)->prev = last_of_first;
+
+  Chunk* border = ChunkFromHandle(last_of_first);
+  if (!border->in_use() && !ChunkFromHandle(first_of_second)->in_use() &&
+      border->stream == ChunkFromHandle(first_of_second)->stream) {
+    RemoveFreeChunkFromBin(last_of_first);
+    ChunkHandle merged = Coalesce(last_of_first);
+    InsertFreeChunkIntoBin(merged);
+  }
+}
+
+void BFCArena::ReclaimIdleFreeRegions() {
+  const auto now = std::chrono::steady_clock::now();
+  const auto timeout = std::chrono::milliseconds(free_region_idle_timeout_ms_);
+
+  // Collect candidates first: deallocating a region mutates the region list.
+  std::vector<std::pair<void*, size_t>> candidates;
+  for (const auto& region : region_manager_.regions()) {
+    if ((consider_first_allocation_region_for_shrinkage_ || region.id() != 0) &&
+        now - region.last_used() >= timeout) {
+      candidates.emplace_back(region.ptr(), region.memory_size());
+    }
+  }
+
+  for (const auto& [region_ptr, region_size] : candidates) {
+    TryDeallocateRegion(region_ptr, region_size);
+  }
+
+  // Unlike Shrink(), do not reset curr_region_allocation_bytes_: reclamation runs
+  // continuously and should not make the arena re-grow in small steps afterwards.
+}
+
 void BFCArena::DeallocateRawInternal(void* ptr) {
   // Find the chunk from the ptr.
   BFCArena::ChunkHandle h = region_manager_.get_handle(ptr);
@@ -580,6 +733,11 @@ void BFCArena::DeallocateRawInternal(void* ptr) {
 
   // Consider coalescing it.
   FreeAndMaybeCoalesce(h);
+
+  if (free_region_idle_timeout_ms_ >= 0) {
+    region_manager_.touch(ptr, std::chrono::steady_clock::now());
+    ReclaimIdleFreeRegions();
+  }
 }
 
 // Merges h1 and h2 when Chunk(h1)->next is h2 and Chunk(h2)->prev is c1.
@@ -659,6 +817,13 @@ void BFCArena::FreeAndMaybeCoalesce(BFCArena::ChunkHandle h) {
   // Updates the stats.
   stats_.bytes_in_use -= c->size;
 
+  if (c->stream != nullptr) {
+    auto usage_it = stream_usage_.find(c->stream);
+    if (usage_it != stream_usage_.end()) {
+      usage_it->second.bytes_in_use -= std::min(usage_it->second.bytes_in_use, c->size);
+    }
+  }
+
   // This chunk is no longer in-use, consider coalescing the chunk
   // with adjacent chunks.
   ChunkHandle chunk_to_reassign = Coalesce(h);
@@ -809,6 +974,9 @@ void BFCArena::DumpMemoryLog(size_t num_bytes) {
 void BFCArena::ResetChunkOnTargetStream(Stream* target_stream, bool coalesce_flag) {
   std::lock_guard<OrtMutex> lock(lock_);
 
+  // the stream is done; drop its budget and accounting along with the chunk assignments.
+  stream_usage_.erase(target_stream);
+
   for (const auto& region : region_manager_.regions()) {
     ChunkHandle region_begin_chunk = region_manager_.get_handle(region.ptr());
     ChunkHandle h = region_begin_chunk;
@@ -887,4 +1055,95 @@ void StreamAwareArena::SecureTheChunk(Stream* chunk_stream, Stream* target_strea
   }
 }
 #endif
+
+NumaPartitionedArena::NumaPartitionedArena(std::vector<std::unique_ptr<IAllocator>> node_allocators,
+                                           size_t total_memory,
+                                           ArenaExtendStrategy arena_extend_strategy,
+                                           int initial_chunk_size_bytes,
+                                           int max_dead_bytes_per_chunk,
+                                           int initial_growth_chunk_size_bytes,
+                                           int64_t max_power_of_two_extend_bytes,
+                                           bool use_huge_pages,
+                                           int free_region_idle_timeout_ms)
+    : IAllocator(OrtMemoryInfo(node_allocators.at(0)->Info().name,
+                               OrtAllocatorType::OrtArenaAllocator,
+                               node_allocators.at(0)->Info().device,
+                               node_allocators.at(0)->Info().id,
+                               node_allocators.at(0)->Info().mem_type)) {
+  LOGS_DEFAULT(INFO) << "Creating NumaPartitionedArena for " << node_allocators[0]->Info().name
+                     << " with " << node_allocators.size() << " NUMA node sub-arenas";
+
+  // split the limit evenly; each sub-arena still starts at its configured initial chunk size.
+  const size_t per_node_memory = std::max(total_memory / node_allocators.size(),
+                                          static_cast<size_t>(initial_chunk_size_bytes));
+  node_arenas_.reserve(node_allocators.size());
+  for (auto& node_allocator : node_allocators) {
+    node_arenas_.push_back(std::make_unique<BFCArena>(std::move(node_allocator),
+                                                      per_node_memory,
+                                                      arena_extend_strategy,
+                                                      initial_chunk_size_bytes,
+                                                      max_dead_bytes_per_chunk,
+                                                      initial_growth_chunk_size_bytes,
+                                                      max_power_of_two_extend_bytes,
+                                                      use_huge_pages,
+                                                      free_region_idle_timeout_ms));
+  }
+}
+
+size_t NumaPartitionedArena::NodeForCallingThread() const {
+  const auto node = static_cast<size_t>(Env::Default().GetCurrentNumaNode());
+  return node < node_arenas_.size() ? node : 0;
+}
+
+void* NumaPartitionedArena::AllocImpl(size_t size, bool use_reserve) {
+  const size_t node = NodeForCallingThread();
+  void* p = use_reserve ? node_arenas_[node]->Reserve(size) : node_arenas_[node]->Alloc(size);
+  if (p != nullptr) {
+    std::lock_guard<OrtMutex> lock(owner_lock_);
+    allocation_owners_[p] = node;
+  }
+  return p;
+}
+
+void* NumaPartitionedArena::Alloc(size_t size) {
+  return AllocImpl(size, /*use_reserve*/ false);
+}
+
+void* NumaPartitionedArena::Reserve(size_t size) {
+  return AllocImpl(size, /*use_reserve*/ true);
+}
+
+void NumaPartitionedArena::Free(void* p) {
+  if (p == nullptr) {
+    return;
+  }
+
+  size_t owner = 0;
+  {
+    std::lock_guard<OrtMutex> lock(owner_lock_);
+    auto it = allocation_owners_.find(p);
+    ORT_ENFORCE(it != allocation_owners_.end(), "NumaPartitionedArena does not own the given pointer.");
+    owner = it->second;
+    allocation_owners_.erase(it);
+  }
+
+  node_arenas_[owner]->Free(p);
+}
+
+void NumaPartitionedArena::GetStats(AllocatorStats* stats) {
+  stats->Clear();
+  for (auto& node_arena : node_arenas_) {
+    AllocatorStats node_stats;
+    node_arena->GetStats(&node_stats);
+    stats->num_allocs += node_stats.num_allocs;
+    stats->num_reserves += node_stats.num_reserves;
+    stats->num_arena_extensions += node_stats.num_arena_extensions;
+    stats->num_arena_shrinkages += node_stats.num_arena_shrinkages;
+    stats->bytes_in_use += node_stats.bytes_in_use;
+    stats->total_allocated_bytes += node_stats.total_allocated_bytes;
+    stats->max_bytes_in_use += node_stats.max_bytes_in_use;
+    stats->max_alloc_size = std::max(stats->max_alloc_size, node_stats.max_alloc_size);
+    stats->bytes_limit += node_stats.bytes_limit;
+  }
+}
 }  // namespace onnxruntime
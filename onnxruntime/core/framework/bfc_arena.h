@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 #include <array>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -61,6 +62,7 @@ class BFCArena : public IAllocator {
   static const int DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES = 2 * 1024 * 1024;
   static const int64_t DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES = 1024 * 1024 * 1024;  // 1GB
   static const size_t DEFAULT_MAX_MEM = std::numeric_limits<size_t>::max();
+  static const int DEFAULT_FREE_REGION_IDLE_TIMEOUT_MS = -1;  // idle-region reclamation disabled
 
   enum ArenaType {
     BaseArena,
@@ -73,7 +75,9 @@ class BFCArena : public IAllocator {
            int initial_chunk_size_bytes = DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
            int max_dead_bytes_per_chunk = DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
            int initial_growth_chunk_size_bytes = DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
-           int64_t max_power_of_two_extend_bytes = DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES);
+           int64_t max_power_of_two_extend_bytes = DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES,
+           bool use_huge_pages = false,
+           int free_region_idle_timeout_ms = DEFAULT_FREE_REGION_IDLE_TIMEOUT_MS);
 
   ~BFCArena() override;
 
@@ -93,6 +97,14 @@ class BFCArena : public IAllocator {
   // and the allocation request.
   Status Shrink();
 
+  // Merges allocation regions that are physically contiguous in the device address space and
+  // coalesces the free chunks at the former region boundaries, restoring large free blocks
+  // that fragmentation across regions has split up. No live allocation is moved - callers
+  // hold raw pointers into the arena, so relocation is not possible - which means this only
+  // reclaims contiguity, not in-region holes pinned by live chunks. Safe to call at any time,
+  // but most effective at a quiescent point after transient buffers have been freed.
+  Status Defragment();
+
   void* Reserve(size_t size) override;
 
   void GetStats(AllocatorStats* stats) override;
@@ -101,6 +113,15 @@ class BFCArena : public IAllocator {
 
   size_t AllocatedSize(const void* ptr);
 
+  // Limit the total bytes that in-use chunks assigned to `stream` may hold. An allocation on the
+  // stream that would exceed the budget fails instead of extending the arena. A value of 0 removes
+  // the limit. The budget and the accounting behind it are discarded when the stream's chunks are
+  // reset via ResetChunkOnTargetStream, i.e. when the stream's buffers are released at the end of
+  // a run.
+  // Note: a chunk borrowed from another stream through cross-stream reuse stays attributed to the
+  // stream it was assigned to, so such chunks count against the original stream's budget.
+  void SetStreamMemoryBudget(Stream* stream, size_t budget_bytes);
+
   ArenaType GetArenaType() const { return arena_type_; }
 
   virtual void SecureTheChunk(Stream* /*chunk_stream*/,
@@ -264,6 +285,8 @@ class BFCArena : public IAllocator {
     }
     void set_handle(const void* p, ChunkHandle h) { handles_[IndexFor(p)] = h; }
     void erase(const void* p) { set_handle(p, kInvalidChunkHandle); }
+    std::chrono::steady_clock::time_point last_used() const { return last_used_; }
+    void set_last_used(std::chrono::steady_clock::time_point t) { last_used_ = t; }
 
    private:
     void Swap(AllocationRegion& other) {
@@ -271,6 +294,7 @@ class BFCArena : public IAllocator {
       std::swap(memory_size_, other.memory_size_);
       std::swap(end_ptr_, other.end_ptr_);
       std::swap(id_, other.id_);
+      std::swap(last_used_, other.last_used_);
       std::swap(handles_, other.handles_);
     }
 
@@ -289,6 +313,9 @@ class BFCArena : public IAllocator {
     // A unique identifier for this allocation region
     // (May be used by the client to track which allocation region was allocated first, second, and so on)
     int64_t id_ = -1;
+    // The last time a chunk backed by this region was returned to the arena.
+    // Only consulted when idle-region reclamation is enabled.
+    std::chrono::steady_clock::time_point last_used_ = std::chrono::steady_clock::now();
 
     // Array of size "memory_size / kMinAllocationSize".  It is
     // indexed by (p-base) / kMinAllocationSize, contains ChunkHandle
@@ -332,6 +359,9 @@ class BFCArena : public IAllocator {
       return MutableRegionFor(p)->set_handle(p, h);
     }
     void erase(const void* p) { return MutableRegionFor(p)->erase(p); }
+    void touch(const void* p, std::chrono::steady_clock::time_point t) {
+      MutableRegionFor(p)->set_last_used(t);
+    }
 
     const std::vector<AllocationRegion>& regions() const { return regions_; }
 
@@ -410,6 +440,19 @@ class BFCArena : public IAllocator {
   // Removes the chunk metadata represented by 'h'.
   void DeleteChunk(ChunkHandle h);
 
+  // Returns the backing memory of 'region_ptr' to the device allocator if no chunk in the
+  // region is in use. Returns true if the region was deallocated. Requires lock_ to be held.
+  bool TryDeallocateRegion(void* region_ptr, size_t region_size);
+
+  // Deallocates fully-free regions whose last activity is older than
+  // free_region_idle_timeout_ms_. Requires lock_ to be held.
+  void ReclaimIdleFreeRegions();
+
+  // Merges the region at `region_index` with the following region, which must start exactly at
+  // its end pointer. The chunk lists of the two regions are stitched together and the border
+  // chunks are coalesced if both are free. Requires lock_ to be held.
+  void MergeContiguousRegions(size_t region_index);
+
   void DumpMemoryLog(size_t num_bytes);
 
   ChunkHandle AllocateChunk();
@@ -504,11 +547,31 @@ class BFCArena : public IAllocator {
 
   std::unordered_map<void*, size_t> reserved_chunks_;
 
+  // Per-stream accounting of the bytes held by in-use chunks, used to enforce the optional
+  // per-stream budgets set through SetStreamMemoryBudget. Entries are erased when the stream's
+  // chunks are reset. Protected by lock_.
+  struct StreamUsage {
+    size_t bytes_in_use = 0;
+    size_t budget_bytes = 0;  // 0 means no limit
+  };
+  std::unordered_map<Stream*, StreamUsage> stream_usage_;
+
   const int initial_chunk_size_bytes_;
   const int max_dead_bytes_per_chunk_;
   const int initial_growth_chunk_size_bytes_;
   const int64_t max_power_of_two_extend_bytes_;
 
+  // Whether to advise the OS to back large allocation regions with huge pages.
+  // Only meaningful for CPU memory; reduces TLB pressure when the arena holds
+  // many GBs of weights that are read on every Run.
+  const bool use_huge_pages_;
+
+  // If >= 0, allocation regions in which every chunk has been free for at least this many
+  // milliseconds are returned to the device allocator on the next Free(). This bounds how
+  // long a traffic spike keeps the arena (and process RSS) at its high-water mark.
+  // -1 disables the behavior; memory is then only returned via Shrink().
+  const int free_region_idle_timeout_ms_;
+
   // This flag is only relevant if Shrink() is invoked.
   // This is a boolean flag that controls whether the first allocation region
   // is to be considered for shrinkage or not.
@@ -545,6 +608,50 @@ class StreamAwareArena : public BFCArena {
   bool enable_cross_stream_reusing_;
 };
 #endif
+
+// Routes each allocation to a BFCArena dedicated to the NUMA node the calling thread is
+// running on. With the OS default first-touch page placement, the regions backing a
+// sub-arena are faulted in by threads on the owning node, which keeps large activations
+// in node-local memory on multi-socket machines. The memory limit is split evenly
+// across the sub-arenas.
+class NumaPartitionedArena : public IAllocator {
+ public:
+  // node_allocators must contain one device allocator per NUMA node, all for the same device.
+  NumaPartitionedArena(std::vector<std::unique_ptr<IAllocator>> node_allocators,
+                       size_t total_memory,
+                       ArenaExtendStrategy arena_extend_strategy = BFCArena::DEFAULT_ARENA_EXTEND_STRATEGY,
+                       int initial_chunk_size_bytes = BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+                       int max_dead_bytes_per_chunk = BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+                       int initial_growth_chunk_size_bytes = BFCArena::DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+                       int64_t max_power_of_two_extend_bytes = BFCArena::DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES,
+                       bool use_huge_pages = false,
+                       int free_region_idle_timeout_ms = BFCArena::DEFAULT_FREE_REGION_IDLE_TIMEOUT_MS);
+
+  void* Alloc(size_t size) override;
+
+  void* Reserve(size_t size) override;
+
+  void Free(void* p) override;
+
+  void GetStats(AllocatorStats* stats) override;
+
+  size_t NumNodeArenas() const { return node_arenas_.size(); }
+
+ private:
+  // Index of the sub-arena serving the calling thread.
+  size_t NodeForCallingThread() const;
+
+  void* AllocImpl(size_t size, bool use_reserve);
+
+  std::vector<std::unique_ptr<BFCArena>> node_arenas_;
+
+  // Maps an outstanding allocation to the sub-arena that owns it, so Free can be
+  // routed correctly regardless of which thread releases the memory.
+  mutable OrtMutex owner_lock_;
+  std::unordered_map<const void*, size_t> allocation_owners_;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(NumaPartitionedArena);
+};
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
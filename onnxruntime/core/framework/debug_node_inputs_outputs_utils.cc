@@ -6,9 +6,17 @@
 #include "core/framework/debug_node_inputs_outputs_utils.h"
 #include "core/framework/print_tensor_utils.h"
 #include "core/framework/print_tensor_statistics_utils.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iomanip>
 #include <cctype>
+#include <limits>
+#include <ostream>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS_ENABLE_DUMP_TO_SQLDB
 #include <sqlite3.h>
@@ -356,6 +364,174 @@ void DumpTensor(
   }
 }
 
+// One flight recorder entry. Fixed size so that slots can be overwritten in place without
+// allocating on the hot path; names longer than the buffers are truncated.
+struct FlightRecord {
+  char tensor_name[64];
+  char op_type[32];
+  size_t iteration;
+  size_t element_count;
+  double min;
+  double max;
+  size_t nan_count;
+  size_t inf_count;
+};
+
+struct FlightRecordSlot {
+  // 0 = never written, odd = write in progress, even = 2 * ticket + 2 of the stored record
+  std::atomic<uint64_t> sequence{0};
+  FlightRecord record{};
+};
+
+// Ring buffer holding the statistics of the most recently produced node outputs. A writer
+// claims a ticket with a single atomic increment and fills its slot in place, so recording
+// never takes a lock; Dump uses the per-slot sequence to detect and skip slots that are
+// concurrently being overwritten, making it safe to call from a watchdog while a run is in
+// flight.
+class NodeOutputFlightRecorder {
+ public:
+  static NodeOutputFlightRecorder& Instance() {
+    static NodeOutputFlightRecorder recorder{
+        NodeDumpOptionsFromEnvironmentVariables().flight_recorder_capacity};
+    return recorder;
+  }
+
+  void Record(const FlightRecord& record) {
+    const uint64_t ticket = next_ticket_.fetch_add(1, std::memory_order_relaxed);
+    FlightRecordSlot& slot = slots_[ticket % slots_.size()];
+    slot.sequence.store(2 * ticket + 1, std::memory_order_release);
+    slot.record = record;
+    slot.sequence.store(2 * ticket + 2, std::memory_order_release);
+  }
+
+  void Dump(std::ostream& out) const {
+    if (slots_.empty()) return;
+
+    std::vector<std::pair<uint64_t, FlightRecord>> records;
+    records.reserve(slots_.size());
+    for (const FlightRecordSlot& slot : slots_) {
+      const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == 0 || sequence % 2 != 0) continue;
+      FlightRecord record = slot.record;
+      if (slot.sequence.load(std::memory_order_acquire) != sequence) continue;
+      records.emplace_back(sequence / 2 - 1, record);
+    }
+
+    std::sort(records.begin(), records.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    out << "-----------\n";
+    out << "Flight recorder: statistics of the last " << records.size()
+        << " recorded node output(s), oldest first:\n";
+    for (const auto& [ticket, record] : records) {
+      out << "#" << ticket << " iteration " << record.iteration << " " << record.op_type
+          << " " << record.tensor_name << ": Count=" << record.element_count;
+      if (record.element_count > record.nan_count) {
+        out << ",Min=" << record.min << ",Max=" << record.max;
+      }
+      if (record.nan_count) out << ",NaN=" << record.nan_count;
+      if (record.inf_count) out << ",Inf=" << record.inf_count;
+      out << "\n";
+    }
+    out << std::flush;
+  }
+
+ private:
+  explicit NodeOutputFlightRecorder(int capacity)
+      : slots_(capacity > 0 ? static_cast<size_t>(capacity) : 0) {}
+
+  std::atomic<uint64_t> next_ticket_{0};
+  std::vector<FlightRecordSlot> slots_;
+};
+
+template <typename T>
+void CollectStatsForFlightRecord(const Tensor& tensor, FlightRecord& record) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    ORT_UNUSED_PARAMETER(tensor);
+    ORT_UNUSED_PARAMETER(record);
+  } else {
+    const size_t count = static_cast<size_t>(tensor.Shape().Size());
+    record.element_count = count;
+    if (count == 0) return;
+
+    constexpr bool is_float = std::is_floating_point_v<T> ||
+                              std::is_same_v<T, MLFloat16> || std::is_same_v<T, BFloat16>;
+
+    const T* data = tensor.Data<T>();
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < count; i++) {
+      if constexpr (is_float) {
+        switch (my_fpclassify(data[i])) {
+          case FP_NAN:
+            record.nan_count++;
+            continue;
+          case FP_INFINITE:
+            record.inf_count++;
+            break;
+          default:
+            break;
+        }
+      }
+
+      double value;
+      if constexpr (std::is_same_v<T, MLFloat16> || std::is_same_v<T, BFloat16>) {
+        value = data[i].ToFloat();
+      } else {
+        value = static_cast<double>(data[i]);
+      }
+      if (value < min) min = value;
+      if (value > max) max = value;
+    }
+
+    record.min = min;
+    record.max = max;
+  }
+}
+
+void RecordNodeOutputs(
+    const NodeDumpOptions& dump_options,
+    const NodeDumpContext& dump_context,
+    OpKernelContext& context,
+    const Node& node) {
+  if (!FilterNode(dump_options, node)) return;
+
+  auto copy_truncated = [](const std::string& src, char* dst, size_t dst_size) {
+    const size_t length = std::min(src.size(), dst_size - 1);
+    std::memcpy(dst, src.data(), length);
+    dst[length] = '\0';
+  };
+
+  const auto& output_defs = node.OutputDefs();
+
+  for (auto i = 0, end = context.OutputCount(); i < end; ++i) {
+    if (!output_defs[i]->Exists()) continue;
+
+    const auto* type = context.OutputType(i);
+    if (type == nullptr || !type->IsTensorType()) continue;
+
+    const auto* tensor = context.Output<Tensor>(i);
+    if (tensor == nullptr) continue;
+
+    // recording is meant to be cheap enough to leave enabled for every node, so outputs
+    // resident on other devices are skipped rather than staged through a copy
+    const auto& tensor_location = tensor->Location();
+    if (tensor_location.device.Type() != OrtDevice::CPU &&
+        tensor_location.mem_type != OrtMemTypeCPUInput &&
+        tensor_location.mem_type != OrtMemTypeCPUOutput) {
+      continue;
+    }
+
+    FlightRecord record{};
+    record.iteration = dump_context.iteration;
+    copy_truncated(output_defs[i]->Name(), record.tensor_name, sizeof(record.tensor_name));
+    copy_truncated(node.OpType(), record.op_type, sizeof(record.op_type));
+    DispatchOnTensorType(tensor->DataType(), CollectStatsForFlightRecord, *tensor, record);
+
+    NodeOutputFlightRecorder::Instance().Record(record);
+  }
+}
+
 }  // namespace
 
 const NodeDumpOptions& NodeDumpOptionsFromEnvironmentVariables() {
@@ -402,6 +578,8 @@ const NodeDumpOptions& NodeDumpOptionsFromEnvironmentVariables() {
     opts.snippet_threshold = ParseEnvironmentVariableWithDefault<int>(env_vars::kSnippetThreshold, kDefaultSnippetThreshold);
     opts.snippet_edge_items = ParseEnvironmentVariableWithDefault<int>(env_vars::kSnippetEdgeItems, kDefaultSnippetEdgeItems);
 
+    opts.flight_recorder_capacity = ParseEnvironmentVariableWithDefault<int>(env_vars::kFlightRecorderCapacity, 0);
+
     if (ParseEnvironmentVariableWithDefault<bool>(env_vars::kAppendRankToFileName, false)) {
       std::string rank = Env::Default().GetEnvironmentVar("OMPI_COMM_WORLD_RANK");
       if (rank.empty()) {
@@ -527,6 +705,12 @@ void DumpNodeOutputs(
     OpKernelContext& context,
     const Node& node,
     const SessionState& session_state) {
+  // the flight recorder only accumulates statistics in memory, so it runs regardless of
+  // which dump flags are set
+  if (dump_options.flight_recorder_capacity > 0) {
+    RecordNodeOutputs(dump_options, dump_context, context, node);
+  }
+
   const bool is_any_output_dumped = IsAnyOutputDumped(dump_options);
   if (!is_any_output_dumped) {
     return;
@@ -594,6 +778,10 @@ void DumpNodeOutputs(
   DumpNodeOutputs(NodeDumpOptionsFromEnvironmentVariables(), dump_context, context, node, session_state);
 }
 
+void DumpNodeOutputFlightRecord(std::ostream& out) {
+  NodeOutputFlightRecorder::Instance().Dump(out);
+}
+
 }  // namespace utils
 }  // namespace onnxruntime
 
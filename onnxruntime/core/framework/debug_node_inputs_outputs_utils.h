@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <iosfwd>
+
 #include "core/common/path.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/session_state.h"
@@ -62,6 +64,10 @@ constexpr const char* kSnippetThreshold = "ORT_DEBUG_NODE_IO_SNIPPET_THRESHOLD";
 // Number of array items in snippet at beginning and end of each dimension (default 3)
 constexpr const char* kSnippetEdgeItems = "ORT_DEBUG_NODE_IO_SNIPPET_EDGE_ITEMS";
 
+// Number of node output statistics records kept by the flight recorder (default 0, disabled).
+// See NodeDumpOptions::flight_recorder_capacity.
+constexpr const char* kFlightRecorderCapacity = "ORT_DEBUG_NODE_IO_FLIGHT_RECORDER_CAPACITY";
+
 }  // namespace debug_node_inputs_outputs_env_vars
 
 constexpr char kFilterPatternDelimiter = ';';
@@ -118,6 +124,15 @@ struct NodeDumpOptions {
 
   // Number of array items in snippet at beginning and end of each dimension for Stdout.
   int snippet_edge_items;
+
+  // When non-zero, keep the statistics (min/max, NaN/Inf counts) of the last N node outputs in an
+  // in-memory ring buffer instead of dumping anything while the run is healthy. The buffer is
+  // written to stdout when a kernel fails, so rare anomalies can be diagnosed without paying the
+  // cost of dumping every node. Honors the name/op type filters; only CPU-resident outputs are
+  // recorded so that recording stays cheap.
+  // Typically combined with ORT_DEBUG_NODE_IO_DUMP_SHAPE_DATA=0 and
+  // ORT_DEBUG_NODE_IO_DUMP_NODE_PLACEMENT=0 to silence the per-node output entirely.
+  int flight_recorder_capacity{0};
 };
 
 struct NodeDumpContext {
@@ -158,6 +173,12 @@ void DumpNodeOutputs(
     const Node& node,
     const SessionState& session_state);
 
+// writes the node output statistics collected by the flight recorder to `out`, oldest record
+// first, and is a no-op when the recorder is disabled. Called automatically when a kernel
+// returns a failure status; it is also safe to call from a watchdog thread or a debugger while
+// a run is in flight, in which case records that are concurrently overwritten are skipped.
+void DumpNodeOutputFlightRecord(std::ostream& out);
+
 }  // namespace utils
 }  // namespace onnxruntime
 
@@ -44,6 +44,26 @@ class DeviceStreamCollectionImpl {
     }
   }
 
+  void SetSingleStreamMemoryBudget(Stream* stream, size_t budget_bytes) {
+    if (!stream) return;
+    for (auto it : allocators_) {
+      if (it.second->Info().device == stream->GetDevice() &&
+          it.second->Info().alloc_type == OrtArenaAllocator) {
+        auto* arena_alloc = static_cast<BFCArena*>(it.second.get());
+        if (StreamAwareArena::FromBFCArena(*arena_alloc)) {
+          arena_alloc->SetStreamMemoryBudget(stream, budget_bytes);
+        }
+      }
+    }
+  }
+
+  void SetMemoryBudget(size_t budget_bytes) {
+    for (auto& stream : owned_streams_) {
+      SetSingleStreamMemoryBudget(stream.get(), budget_bytes);
+    }
+    SetSingleStreamMemoryBudget(root_stream_.get(), budget_bytes);
+  }
+
   Status CleanUp(bool sync_streams) {
     if (sync_streams) {
       for (auto& device_stream : device_streams_) {
@@ -120,6 +140,10 @@ Status DeviceStreamCollection::CleanUp(bool sync_streams) {
   return impl_->CleanUp(sync_streams);
 }
 
+void DeviceStreamCollection::SetMemoryBudget(size_t budget_bytes) {
+  impl_->SetMemoryBudget(budget_bytes);
+}
+
 Stream* DeviceStreamCollection::GetStream(size_t stream_idx) const {
   return impl_->GetStream(stream_idx);
 }
@@ -40,6 +40,12 @@ class DeviceStreamCollection {
   // This API is used to cleanup some resources at the end of an iteration.
   Status CleanUp(bool sync_streams);
 
+  // Apply a memory budget, in bytes, to every stream owned by this collection on the
+  // stream-aware arena allocators of the stream's device. Allocations in the current
+  // iteration that would push a stream past the budget fail instead of growing the arena.
+  // The budget is dropped again when the stream buffers are released in CleanUp.
+  void SetMemoryBudget(size_t budget_bytes);
+
   Stream* GetRootStream() const;
 
  private:
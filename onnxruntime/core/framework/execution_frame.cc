@@ -17,6 +17,7 @@
 #include "core/framework/session_state.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/utils.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -345,6 +346,15 @@ bool IExecutionFrame::IsOutput(int ort_value_idx) const {
   return std::find(fetch_mlvalue_idxs_.begin(), fetch_mlvalue_idxs_.end(), ort_value_idx) != fetch_mlvalue_idxs_.end();
 }
 
+static AllocatorPtr CreateRunScopedCpuArena(const SessionState& session_state) {
+  if (session_state.GetSessionOptions().config_options.GetConfigOrDefault(
+          kOrtSessionOptionsUseRunScopedCpuArena, "0") != "1") {
+    return nullptr;
+  }
+
+  return std::make_shared<BFCArena>(std::make_unique<CPUAllocator>(), BFCArena::DEFAULT_MAX_MEM);
+}
+
 ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
                                gsl::span<const int> fetch_mlvalue_idxs, gsl::span<const OrtValue> fetches,
                                const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
@@ -357,7 +367,14 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
       device_streams_(device_streams),
 #endif
       session_state_(session_state),
+      run_scoped_cpu_arena_(CreateRunScopedCpuArena(session_state)),
+      scratch_buffer_broker_(session_state.GetExecutionPlan() != nullptr &&
+                             session_state.GetExecutionPlan()->execution_plan.size() <= 1),
       mem_patterns_(nullptr) {
+  // Hold the initializer mutex while Init copies out the initializer handles so a concurrent
+  // SessionState::UpdateInitializedTensors cannot swap entries mid-copy. The handles keep the
+  // underlying buffers alive for the duration of this frame.
+  std::lock_guard<OrtMutex> initializers_lock(session_state.GetInitializedTensorsMutex());
   Init(
       feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -411,6 +428,10 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
       if (!mem_patterns_) {
         planner_.emplace(*session_state.GetExecutionPlan());
       } else {
+        defer_patterned_value_release_ =
+            session_state.GetSessionOptions().config_options.GetConfigOrDefault(
+                kOrtSessionOptionsDeferPatternedValueRelease, "0") == "1";
+
         // pre-allocate the big chunk requested in memory pattern.
         // all the internal kernel's input/output tensors will be allocated on these buffer.
         buffers_.reserve(mem_patterns_->locations.size());
@@ -490,6 +511,25 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
       }
     }
   }
+
+  // The resolved symbolic shapes are useful independently of memory patterns: kernels query them via
+  // OpKernelContext::TryGetInferredOutputShape to skip re-deriving output shapes on every run. When memory
+  // patterns did not provide them, pick them up from the per shape-signature memo if the session opted in.
+  if (inferred_shapes_ == nullptr && session_state.GetExecutionPlan() &&
+      session_state.GetSessionOptions().config_options.GetConfigOrDefault(
+          kOrtSessionOptionsEnableShapeMemo, "0") == "1") {
+    bool all_tensors = true;
+    for (const auto& feed : feeds) {
+      if (!feed.IsTensor()) {
+        all_tensors = false;
+        break;
+      }
+    }
+
+    if (all_tensors) {
+      inferred_shapes_ = session_state.GetInferredShapes(feeds, feed_mlvalue_idxs);
+    }
+  }
 }
 
 ExecutionFrame::~ExecutionFrame() = default;
@@ -541,33 +581,44 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
 
   if (mem_patterns_ && per_alloc_plan.alloc_kind != AllocKind::kAllocateOutput &&
       per_alloc_plan.alloc_kind != AllocKind::kAllocatedExternally) {
-    auto pattern = mem_patterns_->GetPatterns(location);
-    if (pattern) {
-      auto block = pattern->GetBlock(ort_value_index);
-      // if block not found, fall back to default behavior
-      if (block) {
-        auto it = buffers_.find(location);
-        if (it != buffers_.end()) {
-          // if the block is not correct, log message then fall back to default behavior
-          if (block->size_ == size) {
-            void* buffer = it->second.get();
-            auto status = AllocateTensorWithPreAllocateBufferHelper(
-                ort_value, static_cast<void*>(static_cast<char*>(buffer) + block->offset_), element_type, location,
-                shape);
-            return status;
-          } else {
-            // the block size may vary especially if the model has NonZero ops, or different sequence lengths are
-            // fed in, so use VERBOSE as the log level as it's expected.
-            // TODO: Should we reuse the block if the size is large enough? Would probably need to allow it
-            // to be freed if the size difference was too large so our memory usage doesn't stick at a high water mark
-            LOGS(session_state_.Logger(), VERBOSE) << "For ort_value with index: " << ort_value_index
-                                                   << ", block in memory pattern size is: " << block->size_
-                                                   << " but the actual size is: " << size
-                                                   << ", fall back to default allocation behavior";
+    // Prefer the flat pre-resolved index built when the pattern group was cached: a single
+    // array access per value, instead of a location scan plus a hash lookup on every run.
+    const MemoryBlock* block = nullptr;
+    if (mem_patterns_->HasResolvedIndex()) {
+      const auto* resolved = mem_patterns_->GetResolvedBlock(ort_value_index);
+      if (resolved && mem_patterns_->locations[resolved->location_index] == location) {
+        block = &resolved->block;
+      }
+    } else if (const auto* pattern = mem_patterns_->GetPatterns(location)) {
+      block = pattern->GetBlock(ort_value_index);
+    }
+
+    // if block not found, fall back to default behavior
+    if (block) {
+      auto it = buffers_.find(location);
+      if (it != buffers_.end()) {
+        // if the block is not correct, log message then fall back to default behavior
+        if (block->size_ == size) {
+          void* buffer = it->second.get();
+          auto status = AllocateTensorWithPreAllocateBufferHelper(
+              ort_value, static_cast<void*>(static_cast<char*>(buffer) + block->offset_), element_type, location,
+              shape);
+          if (status.IsOK() && defer_patterned_value_release_) {
+            patterned_values_.insert(ort_value_index);
           }
+          return status;
+        } else {
+          // the block size may vary especially if the model has NonZero ops, or different sequence lengths are
+          // fed in, so use VERBOSE as the log level as it's expected.
+          // TODO: Should we reuse the block if the size is large enough? Would probably need to allow it
+          // to be freed if the size difference was too large so our memory usage doesn't stick at a high water mark
+          LOGS(session_state_.Logger(), VERBOSE) << "For ort_value with index: " << ort_value_index
+                                                 << ", block in memory pattern size is: " << block->size_
+                                                 << " but the actual size is: " << size
+                                                 << ", fall back to default allocation behavior";
         }
-        // else { we couldn't allocate the large block for the buffer so we didn't insert an entry }
       }
+      // else { we couldn't allocate the large block for the buffer so we didn't insert an entry }
     }
   }
 
@@ -824,6 +875,11 @@ Status ExecutionFrame::AllocateAsPerAllocationPlan(OrtValue& ort_value, int ort_
 }
 
 AllocatorPtr ExecutionFrame::GetAllocatorImpl(const OrtDevice& info) const {
+  if (run_scoped_cpu_arena_ != nullptr &&
+      info.Type() == OrtDevice::CPU && info.MemType() == OrtDevice::MemType::DEFAULT) {
+    return run_scoped_cpu_arena_;
+  }
+
   return session_state_.GetAllocator(info);
 }
 
@@ -875,6 +931,11 @@ void ExecutionFrame::VerifyOutputSizes(int output_index, const Node& node, const
 
 // do not call this in ParallExecutionPlan
 Status ExecutionFrame::ReleaseMLValueImpl(int ort_value_idx) {
+  if (defer_patterned_value_release_ && patterned_values_.count(ort_value_idx) > 0) {
+    // the value lives inside the pattern buffer, which is reclaimed wholesale when the
+    // frame is destroyed at the end of the run, so skip the per-value bookkeeping.
+    return Status::OK();
+  }
   ORT_RETURN_IF_ERROR(IExecutionFrame::ReleaseMLValueImpl(ort_value_idx));
   TraceFree(ort_value_idx);
   return Status::OK();
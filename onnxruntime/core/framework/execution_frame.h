@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include "core/framework/ort_value.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/scratch_buffer_broker.h"
 #include "core/framework/sequential_execution_plan.h"
 #include "core/framework/tensor.h"
 #include "core/graph/graph_viewer.h"
@@ -88,10 +90,24 @@ class IExecutionFrame {
    */
   Status GetOutputs(std::vector<OrtValue>& fetches);
 
+  /**
+   * get the current value of a single graph output. ort_value_index must be one of the
+   * fetch_mlvalue_idxs. Used to hand an output to a fetch ready callback as soon as it has
+   * been produced, before the remaining outputs complete.
+   */
+  const OrtValue& GetFetchedMLValue(int ort_value_index) const {
+    ORT_ENFORCE(IsOutput(ort_value_index), "OrtValue with index ", ort_value_index, " is not a graph output.");
+    return GetMLValue(ort_value_index);
+  }
+
   AllocatorPtr GetAllocator(const OrtDevice& info) const;
 
   Status ReleaseMLValue(int ort_value_idx);
 
+  // Broker for reusable per-stream scratch buffers. Returns nullptr when the frame does not
+  // provide one and callers should allocate their workspace privately.
+  virtual ScratchBufferBroker* GetScratchBufferBroker() { return nullptr; }
+
  protected:
   // get the ort_value_idx from NodeIndexInfo
   int GetNodeIdxToMLValueIdx(int index) const;
@@ -170,6 +186,8 @@ class ExecutionFrame final : public IExecutionFrame {
   // If the retrival is sucessful, this function returns true and false otherwise.
   bool TryGetInferredShape(int index, TensorShape& shape) const override;
 
+  ScratchBufferBroker* GetScratchBufferBroker() override { return &scratch_buffer_broker_; }
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Return the size of virtual memory allocated in runtime.
   // The memory is usually used for activations in forward and backward passes.
@@ -225,13 +243,25 @@ class ExecutionFrame final : public IExecutionFrame {
 
   const SessionState& session_state_;
 
+  // When kOrtSessionOptionsUseRunScopedCpuArena is enabled, all default CPU allocations
+  // made on behalf of this frame come from this arena instead of the shared session
+  // allocator, isolating concurrent runs from each other's fragmentation. The arena is
+  // freed wholesale once the frame and any output values referencing it are released.
+  AllocatorPtr run_scoped_cpu_arena_;
+
+  // Per-stream reusable scratch buffers for transient kernel workspace. Lives and dies with
+  // the frame so buffers are reclaimed at run end.
+  ScratchBufferBroker scratch_buffer_broker_;
+
   // map of index to custom allocator
   InlinedHashMap<int, IExecutor::CustomAllocator> custom_allocators_;
 
   // If we already have cached memory pattern on these input shapes
   // Use this mem pattern that create a big chunk for all the internal
   // kernel's input/output tensors.
-  const MemoryPatternGroup* mem_patterns_;
+  // Ownership is shared with the SessionState cache so the pattern group stays
+  // valid for this run even if the cache entry is evicted.
+  std::shared_ptr<const MemoryPatternGroup> mem_patterns_;
 
   // If no cached memory pattern, and we enable the memory pattern optimization
   // use this planner_ to trace the memory allocation in current executor.
@@ -245,7 +275,16 @@ class ExecutionFrame final : public IExecutionFrame {
   // by i, if the key i exists.
   // inferred_shapes_ is generated together with mem_patterns_.
   // It is never updated after creation
-  const InlinedHashMap<int, TensorShape>* inferred_shapes_{nullptr};
+  std::shared_ptr<const InlinedHashMap<int, TensorShape>> inferred_shapes_;
+
+  // When true, values allocated inside the pattern buffers are not released individually
+  // per the release plan; they are reclaimed wholesale with the buffers at run end.
+  // From kOrtSessionOptionsDeferPatternedValueRelease; only relevant when mem_patterns_ is set.
+  bool defer_patterned_value_release_{false};
+
+  // Ort value indexes allocated inside the pre-allocated pattern buffers.
+  // Only populated when defer_patterned_value_release_ is true.
+  InlinedHashSet<int> patterned_values_;
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Size of virtual memory allocated before any kernel execution.
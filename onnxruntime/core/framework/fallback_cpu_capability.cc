@@ -4,12 +4,15 @@
 #include "core/framework/fallback_cpu_capability.h"
 #include "core/common/inlined_containers.h"
 
+#include <fstream>
 #include <queue>
+#include <string>
 
 #include "onnx/defs/data_type_utils.h"
 
 #include "core/framework/op_kernel.h"
 #include "core/framework/utils.h"
+#include "core/platform/env.h"
 
 using namespace ONNX_NAMESPACE::Utils;
 
@@ -37,6 +40,58 @@ static bool IsSmallInitializer(const onnxruntime::GraphViewer& graph, const Node
 
   return size <= kSmallInitializerThreshold;
 }
+
+// Profile-guided placement overrides, loaded once from the file named by
+// ORT_CPU_FALLBACK_OVERRIDES_PATH. They correct nodes where the static heuristics below picked
+// the slower device according to measured per-node timings.
+struct PlacementOverrides {
+  InlinedHashSet<std::string> force_cpu;
+  InlinedHashSet<std::string> force_provider;
+};
+
+const PlacementOverrides& GetPlacementOverrides() {
+  static const PlacementOverrides overrides = []() {
+    PlacementOverrides result;
+    const std::string path = Env::Default().GetEnvironmentVar(fallback_cpu_env_vars::kOverridesPath);
+    if (path.empty()) {
+      return result;
+    }
+
+    std::ifstream file(path);
+    if (!file) {
+      LOGS_DEFAULT(WARNING) << "Could not open CPU fallback overrides file: " << path;
+      return result;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+      const size_t comment_pos = line.find('#');
+      if (comment_pos != std::string::npos) {
+        line.resize(comment_pos);
+      }
+      const size_t first = line.find_first_not_of(" \t\r");
+      if (first == std::string::npos) {
+        continue;
+      }
+      const size_t last = line.find_last_not_of(" \t\r");
+      line = line.substr(first, last - first + 1);
+
+      constexpr std::string_view cpu_prefix = "cpu:";
+      constexpr std::string_view provider_prefix = "provider:";
+      if (line.compare(0, cpu_prefix.size(), cpu_prefix) == 0) {
+        result.force_cpu.insert(line.substr(cpu_prefix.size()));
+      } else if (line.compare(0, provider_prefix.size(), provider_prefix) == 0) {
+        result.force_provider.insert(line.substr(provider_prefix.size()));
+      } else {
+        LOGS_DEFAULT(WARNING) << "Ignoring malformed CPU fallback override line: " << line;
+      }
+    }
+
+    return result;
+  }();
+
+  return overrides;
+}
 }  // namespace
 
 std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewer& graph,
@@ -171,6 +226,23 @@ std::unordered_set<NodeIndex> GetCpuPreferredNodes(const onnxruntime::GraphViewe
     }
   }
 
+  // Apply profile-guided overrides on top of the heuristic decisions.
+  const PlacementOverrides& overrides = GetPlacementOverrides();
+  if (!overrides.force_cpu.empty() || !overrides.force_provider.empty()) {
+    for (auto& node_id : tentative_nodes) {
+      const Node* node = graph.GetNode(node_id);
+      if (overrides.force_cpu.count(node->Name()) > 0) {
+        if (cpu_nodes.insert(node_id).second) {
+          LOGS_DEFAULT(INFO) << "Profiled override: force fallback to CPU execution for node: " << node->Name();
+        }
+      } else if (overrides.force_provider.count(node->Name()) > 0) {
+        if (cpu_nodes.erase(node_id) > 0) {
+          LOGS_DEFAULT(INFO) << "Profiled override: keep node on target EP: " << node->Name();
+        }
+      }
+    }
+  }
+
   return cpu_nodes;
 }
 
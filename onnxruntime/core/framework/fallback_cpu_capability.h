@@ -10,6 +10,16 @@
 
 namespace onnxruntime {
 
+namespace fallback_cpu_env_vars {
+// Path to a file with profile-guided placement overrides that adjust the result of
+// GetCpuPreferredNodes(). Each line is either "cpu:<node name>" to force the node onto CPU or
+// "provider:<node name>" to keep it on the target execution provider; '#' starts a comment.
+// The node names match the ones recorded by the session profiler, so the file can be derived
+// from per-node timings gathered over a few calibration inferences where the static heuristics
+// picked the slower device.
+constexpr const char* kOverridesPath = "ORT_CPU_FALLBACK_OVERRIDES_PATH";
+}  // namespace fallback_cpu_env_vars
+
 /**
   Returns a list of nodes that are preferred on CPU.
   They are commonly shape-related computation subgraphs.
@@ -875,10 +875,54 @@ static Status PartitionOrtFormatModelImpl(const PartitionParams& partition_param
   return Status::OK();
 }
 
+// Returns true if every node in the graph and its nested subgraphs was saved with a CPU EP
+// assignment in the ORT format model.
+static bool AllNodesSavedWithCpuEpAssignment(const Graph& graph) {
+  for (const auto& node : graph.Nodes()) {
+    if (node.GetOrtFormatSavedExecutionProviderType() != kCpuExecutionProvider) {
+      return false;
+    }
+
+    for (const auto& entry : node.GetAttributeNameToSubgraphMap()) {
+      if (!AllNodesSavedWithCpuEpAssignment(*entry.second)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+static void ReplaySavedCpuEpAssignments(Graph& graph) {
+  for (auto& node : graph.Nodes()) {
+    node.SetExecutionProviderType(kCpuExecutionProvider);
+
+    for (auto& entry : node.GetAttributeNameToMutableSubgraphMap()) {
+      ReplaySavedCpuEpAssignments(*entry.second);
+    }
+  }
+}
+
 // Simplified partitioning where custom EPs may produce compiled nodes.
 static Status PartitionOrtFormatModel(const PartitionParams& partition_params,
                                       const ExecutionProviders& execution_providers,
                                       KernelRegistryManager& kernel_registry_manager) {
+  // When the CPU EP is the only registered provider and the ORT format model saved a CPU EP
+  // assignment for every node, re-running GetCapability can only recompute those same
+  // assignments, so replay them directly. This skips a per-node kernel lookup pass and a
+  // GraphViewer construction per (sub)graph, which adds up for sessions that are created and
+  // thrown away frequently. A node without a CPU kernel still fails session initialization
+  // when the kernels are created, the same way an unassigned node would have.
+  // Any other EP stack goes through the usual per-EP GetCapability pass so the additional EPs
+  // get their chance to claim nodes and compiling EPs can rebuild their fused nodes.
+  auto& graph = partition_params.graph.get();
+  if (execution_providers.NumProviders() == 1 &&
+      (*execution_providers.begin())->Type() == kCpuExecutionProvider &&
+      AllNodesSavedWithCpuEpAssignment(graph)) {
+    ReplaySavedCpuEpAssignments(graph);
+    return Status::OK();
+  }
+
   // process full graph with each EP
   for (const auto& ep : execution_providers) {
     ORT_RETURN_IF_ERROR(PartitionOrtFormatModelImpl(partition_params, kernel_registry_manager, *ep));
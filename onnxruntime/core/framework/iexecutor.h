@@ -22,6 +22,12 @@ class IExecutor {
  public:
   using CustomAllocator = std::function<Status(const TensorShape&, const OrtDevice&, OrtValue&, bool& allocated)>;
 
+  // Invoked as soon as a fetch has been produced during graph execution, before the remaining
+  // fetches complete. Runs on an execution thread, so implementations must be cheap and must not
+  // call back into the session. The value lives on the device it was produced on; device-resident
+  // values may still require a stream synchronization before the host reads them.
+  using FetchReadyCallback = std::function<void(const OrtValue& fetch)>;
+
   virtual ~IExecutor() = default;
 
   /**
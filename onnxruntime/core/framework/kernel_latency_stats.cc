@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/kernel_latency_stats.h"
+
+#include <sstream>
+
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+namespace {
+// Node names come from the model, so escape anything that would break the JSON output.
+std::string JsonEscape(const std::string& s) {
+  std::string result;
+  result.reserve(s.size());
+  for (char c : s) {
+    switch (c) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          constexpr char hex[] = "0123456789abcdef";
+          result += "\\u00";
+          result += hex[(c >> 4) & 0xf];
+          result += hex[c & 0xf];
+        } else {
+          result += c;
+        }
+    }
+  }
+  return result;
+}
+}  // namespace
+
+KernelLatencyStats::KernelLatencyStats(const GraphViewer& graph_viewer, uint64_t sampling_interval)
+    : sampling_interval_(std::max<uint64_t>(sampling_interval, 1)),
+      node_stats_(graph_viewer.MaxNodeIndex()) {
+  for (const auto& node : graph_viewer.Nodes()) {
+    auto& stats = node_stats_[node.Index()];
+    stats.name = node.Name().empty() ? MakeString(node.OpType(), "_", node.Index()) : node.Name();
+    stats.op_type = node.OpType();
+    stats.provider = node.GetExecutionProviderType();
+    stats.valid = true;
+  }
+}
+
+std::string KernelLatencyStats::ReportAsJson() const {
+  std::ostringstream oss;
+  oss << "{\"sampling_interval\":" << sampling_interval_ << ",\"nodes\":[";
+
+  bool first = true;
+  for (const auto& stats : node_stats_) {
+    if (!stats.valid) {
+      continue;
+    }
+
+    if (!first) {
+      oss << ",";
+    }
+    first = false;
+
+    // Drop trailing empty buckets to keep the report compact; bucket i counts samples
+    // with latency in [2^i, 2^(i+1)) ns.
+    size_t num_buckets = kNumBuckets;
+    while (num_buckets > 0 && stats.buckets[num_buckets - 1].load(std::memory_order_relaxed) == 0) {
+      --num_buckets;
+    }
+
+    uint64_t samples = 0;
+    oss << "{\"name\":\"" << JsonEscape(stats.name)
+        << "\",\"op_type\":\"" << JsonEscape(stats.op_type)
+        << "\",\"provider\":\"" << JsonEscape(stats.provider)
+        << "\",\"invocations\":" << stats.invocations.load(std::memory_order_relaxed)
+        << ",\"sum_ns\":" << stats.sum_ns.load(std::memory_order_relaxed)
+        << ",\"buckets\":[";
+    for (size_t i = 0; i < num_buckets; ++i) {
+      const uint64_t count = stats.buckets[i].load(std::memory_order_relaxed);
+      samples += count;
+      oss << (i == 0 ? "" : ",") << count;
+    }
+    oss << "],\"samples\":" << samples << "}";
+  }
+
+  oss << "]}";
+  return oss.str();
+}
+
+}  // namespace onnxruntime
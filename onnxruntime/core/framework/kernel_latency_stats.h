@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/graph/basic_types.h"
+
+namespace onnxruntime {
+class GraphViewer;
+
+/// <summary>
+/// Lock-free per-kernel execution latency histograms intended for always-on use in production,
+/// where the JSON profiler's per-event allocations and serialization are too expensive.
+///
+/// One histogram is kept per node of the main graph, with logarithmic (power of two) nanosecond
+/// buckets. Recording is a couple of relaxed atomic increments, so kernels executing concurrently
+/// from multiple Run() calls can sample without synchronization. The histograms can be serialized
+/// to JSON at any time while the session keeps running; readers see a snapshot that may be mid-update
+/// by at most one sample per node.
+/// </summary>
+class KernelLatencyStats {
+ public:
+  // Latencies from 1ns up to ~4s get their own power of two bucket; anything slower goes in the last one.
+  static constexpr size_t kNumBuckets = 32;
+
+  /// <param name="graph_viewer">Graph the session executes. One histogram slot is created per node
+  /// so recording can index by NodeIndex without hashing.</param>
+  /// <param name="sampling_interval">Every Nth invocation of each kernel is timed. 1 times them all.</param>
+  KernelLatencyStats(const GraphViewer& graph_viewer, uint64_t sampling_interval);
+
+  /// Returns true if the current invocation of the node should be timed.
+  /// Always counts the invocation, sampled or not.
+  bool ShouldSample(NodeIndex node_index) {
+    auto& stats = node_stats_[node_index];
+    return stats.invocations.fetch_add(1, std::memory_order_relaxed) % sampling_interval_ == 0;
+  }
+
+  /// Adds one sampled execution time to the node's histogram.
+  void Record(NodeIndex node_index, uint64_t elapsed_ns) {
+    auto& stats = node_stats_[node_index];
+    stats.sum_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+    stats.buckets[BucketFor(elapsed_ns)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Serializes all histograms to a JSON string. Safe to call while kernels are recording.
+  std::string ReportAsJson() const;
+
+ private:
+  static size_t BucketFor(uint64_t elapsed_ns) {
+    size_t bucket = 0;
+    while (elapsed_ns >>= 1) {
+      ++bucket;
+    }
+    return std::min(bucket, kNumBuckets - 1);
+  }
+
+  struct NodeStats {
+    // Immutable after construction.
+    std::string name;
+    std::string op_type;
+    std::string provider;
+    bool valid{false};
+
+    std::atomic<uint64_t> invocations{0};
+    std::atomic<uint64_t> sum_ns{0};
+    std::array<std::atomic<uint64_t>, kNumBuckets> buckets{};
+  };
+
+  const uint64_t sampling_interval_;
+  // Indexed by NodeIndex. Entries for unused indices have valid == false.
+  std::vector<NodeStats> node_stats_;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(KernelLatencyStats);
+};
+
+}  // namespace onnxruntime
@@ -8,12 +8,37 @@
 #include <numeric>
 #include <unordered_map>
 
+#include "core/common/inlined_containers.h"
 #include "core/framework/kernel_type_str_resolver.h"
 #include "core/framework/session_state.h"
 
 namespace onnxruntime {
 
 namespace {
+// Comfortably fits the concatenated op name, domain and provider for the vast majority of kernels.
+constexpr size_t kTypicalMapKeySize = 128;
+
+using MapKeyBuffer = InlinedVector<char, kTypicalMapKeySize>;
+
+// Builds the same key as KernelRegistry::GetMapKey into a caller-provided buffer.
+// Kernel lookup runs once per node per registry during session initialization, so composing the key
+// on the stack and searching with a transparent comparator avoids a heap allocation per query.
+std::string_view ComposeMapKey(MapKeyBuffer& buffer,
+                               std::string_view op_name, std::string_view domain, std::string_view provider) {
+  if (domain.empty()) {
+    domain = kOnnxDomainAlias;
+  }
+
+  buffer.clear();
+  buffer.reserve(op_name.size() + domain.size() + provider.size() + 2);
+  buffer.insert(buffer.end(), op_name.begin(), op_name.end());
+  buffer.push_back(' ');
+  buffer.insert(buffer.end(), domain.begin(), domain.end());
+  buffer.push_back(' ');
+  buffer.insert(buffer.end(), provider.begin(), provider.end());
+  return std::string_view{buffer.data(), buffer.size()};
+}
+
 bool IsTypeProtoCompatible(gsl::span<const MLDataType> enabled_types, const ONNX_NAMESPACE::TypeProto& actual_type,
                            std::string& mismatch_reason) {
   const bool is_type_compatible = std::any_of(
@@ -186,7 +211,9 @@ Status KernelRegistry::TryFindKernelImpl(const Node& node,
   const auto& node_provider = node.GetExecutionProviderType();
   const auto& expected_provider = (node_provider.empty() ? exec_provider : node_provider);
 
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(node.OpType(), node.Domain(), expected_provider));
+  MapKeyBuffer key_buffer;
+  auto range = kernel_creator_fn_map_.equal_range(ComposeMapKey(key_buffer, node.OpType(), node.Domain(),
+                                                                expected_provider));
   if (out) *out = nullptr;
 
   std::vector<std::string> verify_kernel_def_error_strs;
@@ -261,7 +288,8 @@ Status KernelRegistry::TryFindKernel(ProviderType exec_provider,
                                      int version,
                                      const KernelRegistry::TypeConstraintMap& type_constraints,
                                      const KernelCreateInfo** out) const {
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(op_type, domain, exec_provider));
+  MapKeyBuffer key_buffer;
+  auto range = kernel_creator_fn_map_.equal_range(ComposeMapKey(key_buffer, op_type, domain, exec_provider));
   if (out) *out = nullptr;
 
   std::vector<std::string> verify_kernel_def_error_strs;
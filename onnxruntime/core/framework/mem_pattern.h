@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <algorithm>
+
 #include "core/common/common.h"
 #include "core/common/inlined_containers.h"
 #include "core/framework/allocation_planner.h"
@@ -69,5 +71,47 @@ struct MemoryPatternGroup {
       }
     return nullptr;
   }
+
+  // Placement of one ort value, pre-resolved across all locations.
+  struct ResolvedBlock {
+    int location_index = -1;  // index into locations; -1 if the value is not in any pattern
+    MemoryBlock block;
+  };
+
+  // Builds a flat per-ort-value index over all patterns. Must be called once the group is
+  // fully populated (e.g. when it is inserted into the session's pattern cache). Afterwards
+  // GetResolvedBlock resolves the placement of a value with a single array access on the
+  // run hot path, instead of a per-location scan plus a hash lookup per value per run.
+  void BuildResolvedIndex() {
+    int max_idx = -1;
+    for (const auto& pattern : patterns) {
+      for (const auto& entry : pattern.GetPatternsMap()) {
+        max_idx = std::max(max_idx, entry.first);
+      }
+    }
+
+    resolved_blocks.assign(static_cast<size_t>(max_idx + 1), ResolvedBlock{});
+    for (size_t i = 0; i < patterns.size(); ++i) {
+      for (const auto& entry : patterns[i].GetPatternsMap()) {
+        auto& resolved = resolved_blocks[static_cast<size_t>(entry.first)];
+        resolved.location_index = static_cast<int>(i);
+        resolved.block = entry.second;
+      }
+    }
+    has_resolved_index = true;
+  }
+
+  bool HasResolvedIndex() const { return has_resolved_index; }
+
+  const ResolvedBlock* GetResolvedBlock(int ml_value_idx) const {
+    if (ml_value_idx < 0 || static_cast<size_t>(ml_value_idx) >= resolved_blocks.size()) {
+      return nullptr;
+    }
+    const ResolvedBlock& resolved = resolved_blocks[static_cast<size_t>(ml_value_idx)];
+    return resolved.location_index >= 0 ? &resolved : nullptr;
+  }
+
+  std::vector<ResolvedBlock> resolved_blocks;
+  bool has_resolved_index = false;
 };
 }  // namespace onnxruntime
@@ -1,12 +1,26 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
+#include <algorithm>
+#include <array>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include "model_metadef_id_generator.h"
 #include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
 #include "core/graph/graph_viewer.h"
 #include "core/framework/murmurhash3.h"
+#include "core/framework/tensorprotoutils.h"
 
 namespace onnxruntime {
+
+namespace {
+// Initializer payloads can exceed the 2GB limit of a single MurmurHash3 call, so larger buffers
+// are hashed as fixed size chunks. Each chunk produces an independent 128-bit digest and the
+// digests are folded into the running hash in order, so the result is identical whether the
+// chunks are hashed serially or in parallel.
+constexpr size_t kContentHashChunkSize = size_t{64} * 1024 * 1024;
+}  // namespace
 int ModelMetadefIdGenerator::GenerateId(const onnxruntime::GraphViewer& graph_viewer,
                                         HashValue& model_hash) const {
   // if the EP is shared across multiple sessions there's a very small potential for concurrency issues.
@@ -72,4 +86,111 @@ int ModelMetadefIdGenerator::GenerateId(const onnxruntime::GraphViewer& graph_vi
   return model_metadef_id_[model_hash]++;
 }
 
+HashValue ModelMetadefIdGenerator::GenerateSubgraphContentHash(const onnxruntime::GraphViewer& graph_viewer,
+                                                               concurrency::ThreadPool* thread_pool) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+
+  auto hash_bytes = [&hash](const void* data, size_t num_bytes) {
+    MurmurHash3::x86_128(data, gsl::narrow_cast<int32_t>(num_bytes), hash[0], &hash);
+  };
+
+  auto hash_str = [&hash_bytes](const std::string& str) {
+    hash_bytes(str.data(), str.size());
+  };
+
+  auto hash_large_bytes = [&hash_bytes, thread_pool](const void* data, size_t num_bytes) {
+    if (num_bytes <= kContentHashChunkSize) {
+      hash_bytes(data, num_bytes);
+      return;
+    }
+
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    const size_t num_chunks = (num_bytes + kContentHashChunkSize - 1) / kContentHashChunkSize;
+    std::vector<std::array<uint32_t, 4>> chunk_digests(num_chunks, {0, 0, 0, 0});
+
+    concurrency::ThreadPool::TryBatchParallelFor(
+        thread_pool, gsl::narrow_cast<std::ptrdiff_t>(num_chunks),
+        [&](std::ptrdiff_t chunk_idx) {
+          const size_t offset = static_cast<size_t>(chunk_idx) * kContentHashChunkSize;
+          const size_t chunk_bytes = std::min(kContentHashChunkSize, num_bytes - offset);
+          auto& digest = chunk_digests[static_cast<size_t>(chunk_idx)];
+          MurmurHash3::x86_128(bytes + offset, gsl::narrow_cast<int32_t>(chunk_bytes), digest[0], digest.data());
+        },
+        0);
+
+    hash_bytes(chunk_digests.data(), num_chunks * sizeof(chunk_digests[0]));
+  };
+
+  // nodes in topological order so the hash is independent of node index assignment
+  for (const auto node_idx : graph_viewer.GetNodesInTopologicalOrder()) {
+    const Node& node = *graph_viewer.GetNode(node_idx);
+    hash_str(node.Domain());
+    hash_str(node.OpType());
+    const int since_version = node.SinceVersion();
+    hash_bytes(&since_version, sizeof(since_version));
+
+    // NodeAttributes is unordered, so hash the attributes sorted by name
+    const auto& attributes = node.GetAttributes();
+    std::vector<const std::string*> attr_names;
+    attr_names.reserve(attributes.size());
+    for (const auto& entry : attributes) {
+      attr_names.push_back(&entry.first);
+    }
+    std::sort(attr_names.begin(), attr_names.end(),
+              [](const std::string* l, const std::string* r) { return *l < *r; });
+    for (const auto* attr_name : attr_names) {
+      hash_str(*attr_name);
+      hash_str(attributes.find(*attr_name)->second.SerializeAsString());
+    }
+
+    for (const auto* node_arg : node.InputDefs()) {
+      hash_str(node_arg->Exists() ? node_arg->Name() : std::string{});
+    }
+
+    for (const auto* node_arg : node.OutputDefs()) {
+      hash_str(node_arg->Exists() ? node_arg->Name() : std::string{});
+    }
+  }
+
+  // initializer contents. compiled blobs typically bake the weights in, so the data has to be
+  // part of the key. the initializer map is unordered, so process sorted by name.
+  const auto& initializers = graph_viewer.GetAllInitializedTensors();
+  std::vector<const std::string*> initializer_names;
+  initializer_names.reserve(initializers.size());
+  for (const auto& entry : initializers) {
+    initializer_names.push_back(&entry.first);
+  }
+  std::sort(initializer_names.begin(), initializer_names.end(),
+            [](const std::string* l, const std::string* r) { return *l < *r; });
+  for (const auto* initializer_name : initializer_names) {
+    hash_str(*initializer_name);
+    const ONNX_NAMESPACE::TensorProto& initializer = *initializers.find(*initializer_name)->second;
+    if (utils::HasRawData(initializer) && !utils::HasExternalData(initializer)) {
+      // hash the tensor bytes in place. serializing the proto just to hash it copies the entire
+      // payload, which dominates the cost for models with large weights.
+      const int32_t data_type = initializer.data_type();
+      hash_bytes(&data_type, sizeof(data_type));
+      for (const int64_t dim : initializer.dims()) {
+        hash_bytes(&dim, sizeof(dim));
+      }
+      hash_large_bytes(initializer.raw_data().data(), initializer.raw_data().size());
+    } else {
+      // typed data fields or an external data reference. the serialized proto covers both and is
+      // small relative to raw_data payloads.
+      hash_str(initializer.SerializeAsString());
+    }
+  }
+
+  // graph inputs and outputs pin down the boundary of the subgraph
+  for (const auto* node_arg : graph_viewer.GetInputsIncludingInitializers()) {
+    hash_str(node_arg->Name());
+  }
+
+  for (const auto* node_arg : graph_viewer.GetOutputs()) {
+    hash_str(node_arg->Name());
+  }
+
+  return hash[0] | (uint64_t(hash[1]) << 32);
+}
+
 }  // namespace onnxruntime
@@ -6,6 +6,9 @@
 #include "core/common/basic_types.h"
 namespace onnxruntime {
 class GraphViewer;
+namespace concurrency {
+class ThreadPool;
+}
 
 /// <summary>
 /// helper to generate ids that are unique to model and deterministic, even if the execution provider is shared across
@@ -22,6 +25,20 @@ class ModelMetadefIdGenerator {
    */
   int GenerateId(const onnxruntime::GraphViewer& graph_viewer, HashValue& model_hash) const;
 
+  /** Compute a deterministic content hash of the nodes visible in a graph viewer.
+   Unlike GenerateId, which fingerprints the owning model, this hashes the structure of the
+   viewed nodes (op types, attributes, NodeArg names) and the bytes of all initializers, so the
+   value is stable across sessions and processes. Compiling execution providers can use it to key
+   persistent caches of compiled blobs for fused subgraphs.
+   @param graph_viewer[in] Graph viewer for the nodes to hash.
+   @param thread_pool[in] Optional thread pool used to hash the chunks of large initializers in
+                          parallel. The hash value does not depend on whether a pool is provided.
+   @remarks Initializer data is included in the hash since compiled blobs typically bake in the
+            weights; expect the cost to be proportional to the initializer sizes.
+   */
+  static HashValue GenerateSubgraphContentHash(const onnxruntime::GraphViewer& graph_viewer,
+                                               concurrency::ThreadPool* thread_pool = nullptr);
+
  private:
   // mutable as these are caches so we can minimize the hashing required on each usage of GenerateId
   mutable std::unordered_map<HashValue, HashValue> main_graph_hash_;  // map graph instance hash to model contents hash
@@ -3,6 +3,7 @@
 
 #include "core/framework/op_kernel.h"
 #include "core/framework/execution_frame.h"
+#include "core/framework/scratch_buffer_broker.h"
 #include "core/framework/session_state.h"
 #include "core/graph/op.h"
 #include "core/common/logging/logging.h"
@@ -99,6 +100,24 @@ Status OpKernelContext::GetTempSpaceAllocator(AllocatorPtr* output) const {
   return Status::OK();
 }
 
+void* OpKernelContext::TryGetScratchBuffer(size_t size_in_bytes) const {
+  if (execution_frame_ == nullptr) {
+    return nullptr;
+  }
+
+  ScratchBufferBroker* broker = execution_frame_->GetScratchBufferBroker();
+  if (broker == nullptr) {
+    return nullptr;
+  }
+
+  AllocatorPtr alloc = GetAllocator(kernel_->GetDevice(OrtMemTypeDefault));
+  if (!alloc) {
+    return nullptr;
+  }
+
+  return broker->Reserve(alloc, GetComputeStream(), size_in_bytes);
+}
+
 Status OpKernelContext::GetTempSpaceCPUAllocator(AllocatorPtr* output) const {
   // While looking up the allocator from SessionState
   // (which is called via ExecutionFrame), the allocator lookup
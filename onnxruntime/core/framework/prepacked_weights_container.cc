@@ -2,10 +2,53 @@
 // Licensed under the MIT License.
 
 #include "core/framework/prepacked_weights_container.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "core/common/safeint.h"
 #include "core/framework/allocator_utils.h"
+#include "core/framework/murmurhash3.h"
+#include "core/platform/env.h"
 
 namespace onnxruntime {
 
+namespace {
+
+// On-disk layout of a file cache entry: a fixed header, followed by one uint64_t size per buffer,
+// followed by the raw buffer payloads back to back. The checksum covers the payload bytes and uses
+// the same hashing scheme as PrePackedWeights::GetHash() so an entry can be validated independently
+// of the process that wrote it.
+constexpr uint64_t kPrepackFileCacheMagic = 0x31434B5054524F00;  // "\0ORTPKC1"
+
+struct PrepackFileCacheEntryHeader {
+  uint64_t magic;
+  uint64_t checksum;
+  uint64_t num_buffers;
+};
+
+PathString GetFileCacheEntryPath(const PathString& directory, const std::string& key) {
+  PathString entry_path = directory;
+  entry_path += ORT_TSTR('/');
+  entry_path += PathString(key.begin(), key.end());
+  entry_path += ORT_TSTR(".prepack");
+  return entry_path;
+}
+
+uint64_t ComputeFileCacheChecksum(const std::vector<std::pair<const void*, size_t>>& buffers) {
+  uint32_t hash[4] = {0, 0, 0, 0};
+
+  for (const auto& buffer : buffers) {
+    MurmurHash3::x86_128(buffer.first, static_cast<int>(buffer.second), hash[0], &hash);
+  }
+
+  uint64_t checksum = hash[0];
+  checksum |= uint64_t(hash[1]) << 32;
+  return checksum;
+}
+
+}  // namespace
+
 AllocatorPtr PrepackedWeightsContainer::GetOrCreateAllocator(const std::string& device_name) {
   auto iter = allocators_.find(device_name);
 
@@ -49,4 +92,130 @@ size_t PrepackedWeightsContainer::GetNumberOfElements() const {
   return prepacked_weights_map_.size();
 }
 
+bool PrepackedWeightsContainer::LoadWeightFromFileCache(const std::string& key) {
+  if (HasWeight(key)) {
+    return true;
+  }
+
+  if (!HasFileCache()) {
+    return false;
+  }
+
+  const auto entry_path = GetFileCacheEntryPath(file_cache_directory_, key);
+  const auto& env = Env::Default();
+
+  size_t file_length = 0;
+  if (!env.GetFileLength(entry_path.c_str(), file_length).IsOK() ||
+      file_length < sizeof(PrepackFileCacheEntryHeader)) {
+    return false;
+  }
+
+  Env::MappedMemoryPtr mapped_memory{};
+  if (!env.MapFileIntoMemory(entry_path.c_str(), 0, file_length, mapped_memory).IsOK()) {
+    return false;
+  }
+
+  const char* data = mapped_memory.get();
+  PrepackFileCacheEntryHeader header;
+  memcpy(&header, data, sizeof(header));
+
+  if (header.magic != kPrepackFileCacheMagic || header.num_buffers == 0 ||
+      header.num_buffers > (file_length - sizeof(header)) / sizeof(uint64_t)) {
+    return false;
+  }
+
+  std::vector<size_t> buffer_sizes;
+  buffer_sizes.reserve(header.num_buffers);
+  SafeInt<size_t> expected_length = sizeof(header) + header.num_buffers * sizeof(uint64_t);
+  const char* size_cursor = data + sizeof(header);
+  for (uint64_t i = 0; i < header.num_buffers; ++i) {
+    uint64_t buffer_size = 0;
+    memcpy(&buffer_size, size_cursor + i * sizeof(uint64_t), sizeof(buffer_size));
+    buffer_sizes.push_back(static_cast<size_t>(buffer_size));
+    expected_length += buffer_size;
+  }
+
+  if (file_length < static_cast<size_t>(expected_length)) {
+    return false;
+  }
+
+  const char* payload = data + sizeof(header) + header.num_buffers * sizeof(uint64_t);
+  std::vector<std::pair<const void*, size_t>> payload_buffers;
+  payload_buffers.reserve(buffer_sizes.size());
+  const char* payload_cursor = payload;
+  for (size_t buffer_size : buffer_sizes) {
+    payload_buffers.emplace_back(payload_cursor, buffer_size);
+    payload_cursor += buffer_size;
+  }
+
+  if (ComputeFileCacheChecksum(payload_buffers) != header.checksum) {
+    return false;
+  }
+
+  // the mapping is shared by all buffers of the entry and released along with the last one
+  auto shared_mapping = std::make_shared<Env::MappedMemoryPtr>(std::move(mapped_memory));
+  PrePackedWeights packed_weight;
+  for (const auto& buffer : payload_buffers) {
+    packed_weight.buffers_.emplace_back(const_cast<void*>(buffer.first),
+                                        [shared_mapping](void*) {});
+    packed_weight.buffer_sizes_.push_back(buffer.second);
+  }
+
+  return WriteWeight(key, std::move(packed_weight));
+}
+
+common::Status PrepackedWeightsContainer::WriteWeightToFileCache(const std::string& key) const {
+  ORT_RETURN_IF_NOT(HasFileCache(), "No file cache directory has been configured");
+
+  auto it = prepacked_weights_map_.find(key);
+  ORT_RETURN_IF(it == prepacked_weights_map_.end(),
+                "No pre-packed weight found in the container for key: ", key);
+
+  const PrePackedWeights& weights = it->second;
+  std::vector<std::pair<const void*, size_t>> payload_buffers;
+  payload_buffers.reserve(weights.buffers_.size());
+  for (size_t i = 0; i < weights.buffers_.size(); ++i) {
+    // place-holder buffers cannot be round-tripped through the file format
+    ORT_RETURN_IF(weights.buffers_[i].get() == nullptr,
+                  "Pre-packed weight contains place-holder buffers and cannot be persisted, key: ", key);
+    payload_buffers.emplace_back(weights.buffers_[i].get(), weights.buffer_sizes_[i]);
+  }
+
+  PrepackFileCacheEntryHeader header;
+  header.magic = kPrepackFileCacheMagic;
+  header.checksum = ComputeFileCacheChecksum(payload_buffers);
+  header.num_buffers = payload_buffers.size();
+
+  const auto entry_path = GetFileCacheEntryPath(file_cache_directory_, key);
+  PathString temp_path = entry_path;
+  temp_path += ORT_TSTR(".tmp.");
+  temp_path += ToPathString(std::to_string(static_cast<uint64_t>(Env::Default().GetSelfPid())));
+
+  {
+    std::ofstream file_stream(temp_path, std::ofstream::binary | std::ofstream::trunc);
+    ORT_RETURN_IF_NOT(file_stream.good(), "Unable to open pre-packed weights cache file for writing");
+
+    file_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& buffer : payload_buffers) {
+      const uint64_t buffer_size = buffer.second;
+      file_stream.write(reinterpret_cast<const char*>(&buffer_size), sizeof(buffer_size));
+    }
+    for (const auto& buffer : payload_buffers) {
+      file_stream.write(reinterpret_cast<const char*>(buffer.first), static_cast<std::streamsize>(buffer.second));
+    }
+
+    file_stream.flush();
+    ORT_RETURN_IF_NOT(file_stream.good(), "Failure writing pre-packed weights cache file");
+  }
+
+  std::error_code error_code;
+  std::filesystem::rename(temp_path, entry_path, error_code);
+  if (error_code) {
+    std::filesystem::remove(temp_path, error_code);
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unable to finalize pre-packed weights cache file for key: ", key);
+  }
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
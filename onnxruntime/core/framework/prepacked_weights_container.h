@@ -8,6 +8,7 @@
 #include <string>
 #include <cstdint>
 
+#include "core/common/path_string.h"
 #include "core/framework/buffer_deleter.h"
 
 #include "core/framework/allocator.h"
@@ -47,6 +48,26 @@ class PrepackedWeightsContainer final {
   // Returns the number of elements in the container
   size_t GetNumberOfElements() const;
 
+  // Enables a file-backed cache rooted at the provided directory so that pre-packed weights can be
+  // shared across processes running the same model. Entries are keyed by the same composite key as
+  // the in-memory map and are mapped read-only on load, so identical packed buffers occupy a single
+  // set of physical pages host-wide.
+  void SetFileCacheDirectory(const PathString& directory) { file_cache_directory_ = directory; }
+
+  // Returns a boolean indicating if a file cache directory has been configured.
+  bool HasFileCache() const { return !file_cache_directory_.empty(); }
+
+  // Attempts to populate the in-memory map with the file cache entry pertaining to the provided key.
+  // The entry is mapped read-only and its checksum is verified; a corrupt or unreadable entry is
+  // treated as a miss. Returns a boolean indicating if the weight is available in the container
+  // after the call.
+  bool LoadWeightFromFileCache(const std::string& key);
+
+  // Best-effort persistence of the weight stored under the provided key into the file cache.
+  // The entry is written to a temporary file and atomically renamed into place so that concurrent
+  // workers never observe a partially written entry.
+  common::Status WriteWeightToFileCache(const std::string& key) const;
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PrepackedWeightsContainer);
 
   // Resource to be acquired by the method that is going to invoke calls to the kernels'
@@ -64,6 +85,9 @@ class PrepackedWeightsContainer final {
   // to PrePackedWeights instances.
   // The key is : op_type + "+" + hash_of_prepacked_buffers_in_the_PrepackedWeights_instance.
   std::unordered_map<std::string, PrePackedWeights> prepacked_weights_map_;
+
+  // Directory holding the file-backed cache entries. Empty when the file cache is disabled.
+  PathString file_cache_directory_;
 };
 
 }  // namespace onnxruntime
@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/scratch_buffer_broker.h"
+
+namespace onnxruntime {
+
+void* ScratchBufferBroker::Reserve(const AllocatorPtr& allocator, const Stream* stream,
+                                   size_t size_in_bytes) {
+  if (size_in_bytes == 0 || (stream == nullptr && !allow_null_stream_)) {
+    return nullptr;
+  }
+
+  Slot* slot;
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    slot = &slots_[stream];
+  }
+
+  if (slot->capacity < size_in_bytes || slot->allocator != allocator) {
+    // Release the previous buffer first so the arena can hand its block back for the new request.
+    slot->buffer.reset();
+    slot->allocator = nullptr;
+    slot->capacity = 0;
+
+    void* p = allocator->Alloc(size_in_bytes);
+    if (p == nullptr) {
+      return nullptr;
+    }
+
+    slot->buffer = BufferUniquePtr(p, BufferDeleter(allocator));
+    slot->allocator = allocator;
+    slot->capacity = size_in_bytes;
+  }
+
+  return slot->buffer.get();
+}
+
+}  // namespace onnxruntime
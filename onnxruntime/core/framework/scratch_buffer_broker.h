@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <unordered_map>
+
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+class Stream;
+
+/**
+ * Hands out one reusable scratch buffer per logic stream for transient kernel workspace such as
+ * im2col or convolution working buffers. The buffer grows to the high-water mark of the requests
+ * made on its stream and is released when the broker is destroyed with the execution frame, so
+ * kernels executing in order on a stream share a single allocation instead of each allocating and
+ * freeing a private buffer through the arena on every call.
+ */
+class ScratchBufferBroker {
+ public:
+  explicit ScratchBufferBroker(bool allow_null_stream) : allow_null_stream_(allow_null_stream) {}
+
+  /**
+   * Returns a buffer of at least size_in_bytes bytes, or nullptr if the request cannot be
+   * brokered and the caller should allocate privately. The buffer is only valid until the next
+   * Reserve call for the same stream, so it must not be held across kernel invocations.
+   */
+  void* Reserve(const AllocatorPtr& allocator, const Stream* stream, size_t size_in_bytes);
+
+ private:
+  struct Slot {
+    AllocatorPtr allocator;
+    BufferUniquePtr buffer;
+    size_t capacity = 0;
+  };
+
+  // CPU kernels have no compute stream. With a single logic stream they all run in order and can
+  // share one slot keyed on nullptr; with concurrent logic streams there is nothing to key on and
+  // null-stream requests are refused.
+  const bool allow_null_stream_;
+
+  // Guards the map only. A slot is exclusively used by kernels running in order on its stream, so
+  // the buffer itself needs no lock. std::unordered_map keeps slot addresses stable across
+  // insertions from other streams.
+  OrtMutex mutex_;
+  std::unordered_map<const Stream*, Slot> slots_;
+};
+
+}  // namespace onnxruntime
@@ -17,6 +17,7 @@
 #include "core/framework/utils.h"
 
 #if defined DEBUG_NODE_INPUTS_OUTPUTS
+#include <iostream>
 #include "core/framework/debug_node_inputs_outputs_utils.h"
 #endif
 
@@ -38,9 +39,10 @@
 using namespace Concurrency;
 #endif
 
-#ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
-#include <Windows.h>
 #include "core/platform/tracing.h"
+
+#if defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && defined(_WIN32)
+#include <Windows.h>
 namespace {
 LARGE_INTEGER OrtGetPerformanceFrequency() {
   LARGE_INTEGER v;
@@ -287,12 +289,7 @@ class KernelScope {
 #endif
 #ifdef ENABLE_NVTX_PROFILE
         ,
-        node_compute_range_(MakeString(kernel_.Node().OpType(),
-                                       ".",
-                                       kernel_.Node().Index(),
-                                       "(",
-                                       kernel_.Node().Name(),
-                                       ")"),
+        node_compute_range_(session_scope.session_state_.GetNvtxNodeRangeName(kernel.Node().Index()),
                             profile::Color::Yellow)
 #endif
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
@@ -323,11 +320,12 @@ class KernelScope {
     }
 #endif
 
-#ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
-    LARGE_INTEGER kernel_start;
-    QueryPerformanceCounter(&kernel_start);
+#if defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && defined(_WIN32)
+    QueryPerformanceCounter(&kernel_start_);
 #endif
 
+    ORT_TRACEPOINT_KERNEL_BEGIN(kernel_.KernelDef().OpName().c_str(), kernel_.Node().Index());
+
 #ifdef DEBUG_NODE_INPUTS_OUTPUTS
     utils::DumpNodeInputs(dump_context_, kernel_context_, kernel_.Node(), session_state_);
 #endif
@@ -336,32 +334,57 @@ class KernelScope {
     node_compute_range_.Begin();
 #endif
 
+    if (auto* latency_stats = session_state_.GetKernelLatencyStats();
+        latency_stats != nullptr && latency_stats->ShouldSample(kernel_.Node().Index())) {
+      latency_stats_ = latency_stats;
+      latency_sample_start_ = std::chrono::steady_clock::now();
+    }
+
     if (session_state_.Profiler().IsEnabled()) {
       auto& node = kernel.Node();
-      node_name_ = node.Name().empty() ? MakeString(node.OpType(), "_", node.Index()) : node.Name();
       auto& profiler = session_state_.Profiler();
-      auto sync_time_begin = profiler.Start();
-      profiler.EndTimeAndRecordEvent(profiling::NODE_EVENT,
-                                     node_name_ + "_fence_before",
-                                     sync_time_begin,
-                                     {{"op_name", kernel_.KernelDef().OpName()}});
-      concurrency::ThreadPool::StartProfiling(session_state_.GetThreadPool());
-      VLOGS(session_state_.Logger(), 1) << "Computing kernel: " << node_name_;
-      kernel_begin_time_ = session_state_.Profiler().Start();
-      CalculateTotalInputSizes(&kernel_context, &kernel_,
-                               input_activation_sizes_, input_parameter_sizes_,
-                               node_name_, input_type_shape_);
+      if (profiler.IsCompactEventsEnabled()) {
+        // Compact mode: one fixed-size record per kernel. Skip the fence events, the
+        // input/output size accounting and the thread pool stats, whose string building
+        // distorts microsecond kernels.
+        compact_profiling_ = true;
+        compact_name_id_ = profiler.InternName(
+            (node.Name().empty() ? MakeString(node.OpType(), "_", node.Index()) : node.Name()) + "_kernel_time");
+        kernel_begin_time_ = profiler.Start();
+      } else {
+        node_name_ = node.Name().empty() ? MakeString(node.OpType(), "_", node.Index()) : node.Name();
+        auto sync_time_begin = profiler.Start();
+        profiler.EndTimeAndRecordEvent(profiling::NODE_EVENT,
+                                       node_name_ + "_fence_before",
+                                       sync_time_begin,
+                                       {{"op_name", kernel_.KernelDef().OpName()}});
+        concurrency::ThreadPool::StartProfiling(session_state_.GetThreadPool());
+        VLOGS(session_state_.Logger(), 1) << "Computing kernel: " << node_name_;
+        kernel_begin_time_ = session_state_.Profiler().Start();
+        CalculateTotalInputSizes(&kernel_context, &kernel_,
+                                 input_activation_sizes_, input_parameter_sizes_,
+                                 node_name_, input_type_shape_);
+      }
     }
   }
 
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(KernelScope);
 
   ~KernelScope() {
+    if (latency_stats_ != nullptr) {
+      const auto elapsed = std::chrono::steady_clock::now() - latency_sample_start_;
+      latency_stats_->Record(kernel_.Node().Index(),
+                             static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
 #ifdef ENABLE_NVTX_PROFILE
     node_compute_range_.End();
 #endif
 
-    if (session_state_.Profiler().IsEnabled()) {
+    if (compact_profiling_) {
+      session_state_.Profiler().EndTimeAndRecordCompactEvent(profiling::NODE_EVENT, compact_name_id_,
+                                                             kernel_begin_time_);
+    } else if (session_state_.Profiler().IsEnabled()) {
       auto& profiler = session_state_.Profiler();
       std::string output_type_shape_;
       CalculateTotalOutputSizes(&kernel_context_, total_output_sizes_, node_name_, output_type_shape_);
@@ -388,17 +411,19 @@ class KernelScope {
                                      {{"op_name", kernel_.KernelDef().OpName()}});
     }
 
-#ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
+    ORT_TRACEPOINT_KERNEL_END(kernel_.KernelDef().OpName().c_str(), kernel_.Node().Index());
+
+#if defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && defined(_WIN32)
     LARGE_INTEGER kernel_stop;
     QueryPerformanceCounter(&kernel_stop);
     LARGE_INTEGER elapsed;
-    elapsed.QuadPart = kernel_stop.QuadPart - kernel_start.QuadPart;
+    elapsed.QuadPart = kernel_stop.QuadPart - kernel_start_.QuadPart;
     elapsed.QuadPart *= 1000000;
     elapsed.QuadPart /= perf_freq.QuadPart;
     // Log an event
     TraceLoggingWrite(telemetry_provider_handle,  // handle to my provider
                       "OpEnd",                    // Event Name that should uniquely identify your event.
-                      TraceLoggingValue(p_op_kernel->KernelDef().OpName().c_str(), "op_name"),
+                      TraceLoggingValue(kernel_.KernelDef().OpName().c_str(), "op_name"),
                       TraceLoggingValue(elapsed.QuadPart, "time"));
 #endif
 
@@ -409,6 +434,10 @@ class KernelScope {
 
  private:
   TimePoint kernel_begin_time_;
+  bool compact_profiling_{false};
+  uint32_t compact_name_id_{0};
+  KernelLatencyStats* latency_stats_{nullptr};
+  std::chrono::steady_clock::time_point latency_sample_start_;
   SessionScope& session_scope_;
   const SessionState& session_state_;
   std::string node_name_;
@@ -424,6 +453,10 @@ class KernelScope {
   diagnostic::span span_;
 #endif
 
+#if defined(ONNXRUNTIME_ENABLE_INSTRUMENT) && defined(_WIN32)
+  LARGE_INTEGER kernel_start_{};
+#endif
+
 #ifdef ENABLE_NVTX_PROFILE
   profile::NvtxRangeCreator node_compute_range_;
 #endif
@@ -514,9 +547,15 @@ onnxruntime::Status ExecuteKernel(StreamExecutionContext& ctx,
 #endif
     const auto msg_string = ss.str();
     LOGS(logger, ERROR) << msg_string;
+#ifdef DEBUG_NODE_INPUTS_OUTPUTS
+    // if the flight recorder is enabled, dump the statistics of the node outputs leading up
+    // to the failure
+    utils::DumpNodeOutputFlightRecord(std::cout);
+#endif
     return Status(status.Category(), status.Code(), msg_string);
   }
   ctx.RecycleNodeInputs(idx);
+  ctx.NotifyFetchesProduced(idx);
   VLOGS(logger, 0) << "stream " << stream_idx << " launch kernel with idx " << idx;
   return Status::OK();
 }
@@ -531,7 +570,8 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
 #endif
                                    const bool& terminate_flag,
                                    const bool only_execute_path_to_fetches,
-                                   bool single_thread_mode) {
+                                   bool single_thread_mode,
+                                   const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers) {
   auto* execution_plan = session_state.GetExecutionPlan();
   VLOGS(logger, 0) << "Number of streams: " << execution_plan->execution_plan.size();
   int32_t valid_streams = 0;
@@ -553,7 +593,8 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
                              fetches,
                              fetch_allocators,
                              logger,
-                             single_thread_mode);
+                             single_thread_mode,
+                             fetch_notifiers);
 #else
   StreamExecutionContext ctx(session_state,
                              valid_streams,
@@ -563,7 +604,8 @@ onnxruntime::Status ExecuteThePlan(const SessionState& session_state, gsl::span<
                              fetches,
                              fetch_allocators,
                              logger,
-                             single_thread_mode);
+                             single_thread_mode,
+                             fetch_notifiers);
 #endif
 #ifdef ENABLE_TRAINING
   if (only_execute_path_to_fetches) {
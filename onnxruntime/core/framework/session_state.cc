@@ -3,10 +3,13 @@
 
 #include "core/framework/session_state.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/common/safeint.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
@@ -70,7 +73,8 @@ SessionState::SessionState(Graph& graph,
                            profiling::Profiler& profiler,
                            const SessionOptions& sess_options,
                            PrepackedWeightsContainer* prepacked_weights_container,
-                           AllocatorMap* parent_allocators)
+                           AllocatorMap* parent_allocators,
+                           SharedInitializersContainer* shared_initializers_container)
     : graph_(graph),
       execution_providers_(execution_providers),
       logger_(logger),
@@ -79,7 +83,8 @@ SessionState::SessionState(Graph& graph,
       inter_op_thread_pool_(inter_op_thread_pool),
       data_transfer_mgr_(data_transfer_mgr),
       sess_options_(sess_options),
-      prepacked_weights_container_(prepacked_weights_container)
+      prepacked_weights_container_(prepacked_weights_container),
+      shared_initializers_container_(shared_initializers_container)
 #ifdef ORT_ENABLE_STREAM
       ,
       stream_handles_registry_(std::make_unique<StreamCommandHandleRegistryImpl>())
@@ -87,6 +92,15 @@ SessionState::SessionState(Graph& graph,
 {
   enable_mem_pattern_ = sess_options_.enable_mem_pattern &&
                         sess_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL;
+
+  const std::string mem_patterns_cache_limit_str =
+      sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsMemoryPatternCacheLimit, "0");
+  if (!TryParseStringWithClassicLocale(mem_patterns_cache_limit_str, mem_patterns_cache_limit_)) {
+    LOGS(logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsMemoryPatternCacheLimit << ": "
+                           << mem_patterns_cache_limit_str << ". The memory pattern cache will be unbounded.";
+    mem_patterns_cache_limit_ = 0;
+  }
+
   if (parent_allocators) {
     allocators_ = parent_allocators;
   } else {
@@ -282,6 +296,22 @@ const std::vector<AllocPlanPerValue>& SessionState::GetPerValueAllocPlan() const
   return p_seq_exec_plan_->allocation_plan;
 }
 
+#ifdef ENABLE_NVTX_PROFILE
+const std::string& SessionState::GetNvtxNodeRangeName(NodeIndex node_index) const {
+  std::lock_guard<OrtMutex> lock(nvtx_node_range_names_mutex_);
+  if (nvtx_node_range_names_.empty()) {
+    // Intern the names for the whole graph in one pass. The vector is never
+    // resized afterwards, so the returned references stay valid.
+    nvtx_node_range_names_.resize(static_cast<size_t>(graph_.MaxNodeIndex()));
+    for (const auto& node : graph_.Nodes()) {
+      nvtx_node_range_names_[node.Index()] =
+          MakeString(node.OpType(), ".", node.Index(), "(", node.Name(), ")");
+    }
+  }
+  return nvtx_node_range_names_[node_index];
+}
+#endif
+
 Status SessionState::AddInitializedTensor(int ort_value_index, const OrtValue& ort_value, const OrtCallback* d,
                                           bool constant, bool sparse) {
   auto p = initialized_tensors_.insert({ort_value_index, ort_value});
@@ -314,6 +344,96 @@ const std::unordered_map<int, OrtValue>& SessionState::GetConstantInitializedTen
   return constant_initialized_tensors_;
 }
 
+Status SessionState::UpdateInitializedTensors(const NameMLValMap& delta) {
+  // Validate every entry and stage any device copies before mutating anything so the update is
+  // applied all-or-nothing.
+  InlinedVector<std::pair<int, OrtValue>> staged;
+  staged.reserve(delta.size());
+
+  for (const auto& [name, new_value] : delta) {
+    int ort_value_idx = -1;
+    ORT_RETURN_IF_ERROR(ort_value_name_idx_map_.GetIdx(name, ort_value_idx));
+
+    auto old_it = initialized_tensors_.find(ort_value_idx);
+    if (old_it == initialized_tensors_.end()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "'", name, "' is not an initializer in this graph.");
+    }
+
+    if (prepacked_initialized_tensors_.count(ort_value_idx) > 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Initializer '", name,
+                             "' was consumed by kernel pre-packing and cannot be updated. Disable pre-packing ",
+                             "(session config '", kOrtSessionOptionsConfigDisablePrepacking,
+                             "') for weights that need to be refreshed at runtime.");
+    }
+
+#if !defined(DISABLE_SPARSE_TENSORS)
+    if (IsSparseInitializer(ort_value_idx)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Updating sparse initializer '", name,
+                             "' is not supported.");
+    }
+#endif
+
+    if (!new_value.IsAllocated() || !new_value.IsTensor()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "The value provided for initializer '", name,
+                             "' is not a tensor.");
+    }
+
+    const Tensor& old_tensor = old_it->second.Get<Tensor>();
+    const Tensor& new_tensor = new_value.Get<Tensor>();
+
+    if (new_tensor.DataType() != old_tensor.DataType()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "The value provided for initializer '", name,
+                             "' has data type ", DataTypeImpl::ToString(new_tensor.DataType()),
+                             " but the initializer has data type ", DataTypeImpl::ToString(old_tensor.DataType()));
+    }
+
+    if (new_tensor.Shape() != old_tensor.Shape()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "The value provided for initializer '", name,
+                             "' has shape ", new_tensor.Shape(), " but the initializer has shape ",
+                             old_tensor.Shape());
+    }
+
+    if (new_tensor.Location().device == old_tensor.Location().device) {
+      staged.emplace_back(ort_value_idx, new_value);
+    } else {
+      // stage the new value on the device the old weight lives on so the swap below is just a
+      // handle exchange
+      if (old_tensor.IsDataTypeString()) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "The value provided for initializer '", name,
+                               "' is a string tensor on a different device and cannot be copied.");
+      }
+
+      AllocatorPtr allocator = GetAllocator(old_tensor.Location().device);
+      if (allocator == nullptr) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to get an allocator for the location of initializer '",
+                               name, "': ", old_tensor.Location().ToString());
+      }
+
+      Tensor staged_tensor{new_tensor.DataType(), new_tensor.Shape(), allocator};
+      ORT_RETURN_IF_ERROR(data_transfer_mgr_.CopyTensor(new_tensor, staged_tensor));
+
+      OrtValue staged_value;
+      Tensor::InitOrtValue(std::move(staged_tensor), staged_value);
+      staged.emplace_back(ort_value_idx, std::move(staged_value));
+    }
+  }
+
+  // Swap the new handles in. Execution frames copy the initializer handles under the same mutex
+  // at the start of a run and the shared buffers stay alive as long as any handle references them,
+  // so runs already in flight finish with the weights they started with.
+  std::lock_guard<OrtMutex> lock(initialized_tensors_mutex_);
+  for (auto& [ort_value_idx, value] : staged) {
+    auto constant_it = constant_initialized_tensors_.find(ort_value_idx);
+    if (constant_it != constant_initialized_tensors_.end()) {
+      constant_it->second = value;
+    }
+
+    initialized_tensors_[ort_value_idx] = std::move(value);
+  }
+
+  return Status::OK();
+}
+
 #if !defined(DISABLE_SPARSE_TENSORS)
 bool SessionState::IsSparseInitializer(int ort_value_index) const {
   return sparse_initialized_tensors_.count(ort_value_index) > 0;
@@ -396,7 +516,23 @@ static std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type,
 
 Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
                                                        const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map) {
-  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map](
+  // Pre-packing calls that were deferred during the graph walk so that independent
+  // kernels can be packed in parallel on the intra-op thread pool. Entries are kept
+  // in graph order and post-processed serially once the packing has completed.
+  struct DeferredPrePack {
+    OpKernel* kernel;
+    int input_idx;
+    const Tensor* tensor;
+    AllocatorPtr allocator;
+    SessionState* st;
+    int ort_value_idx;
+    const std::string* input_name;
+    bool is_packed = false;
+  };
+  InlinedVector<DeferredPrePack> deferred_prepacks;
+
+  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map,
+                                     &deferred_prepacks](
                                         bool should_cache_prepacked_weights_for_shared_initializers) -> Status {
     for (auto& node : GetGraphViewer().Nodes()) {
       auto kernel = GetMutableKernel(node.Index());
@@ -455,6 +591,13 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
 
                     bool container_contains_packed_weight = prepacked_weights_container_->HasWeight(prepacked_weights_container_key);
 
+                    if (!container_contains_packed_weight && prepacked_weights_container_->HasFileCache()) {
+                      // another process may have persisted this pre-packed weight already; using the mapped
+                      // copy keeps the packed bytes in physical pages shared by all workers on the host
+                      container_contains_packed_weight =
+                          prepacked_weights_container_->LoadWeightFromFileCache(prepacked_weights_container_key);
+                    }
+
                     if (container_contains_packed_weight) {
                       LOGS(logger_, INFO) << "Using cached version of pre-packed weight for constant initializer: " << input_name
                                           << " used in the node: " << node.Name() << " which is of op type: " << node.OpType();
@@ -470,6 +613,17 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
                         return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unable to write the provided PrePackedWeights instance into the container");
                       }
 
+                      if (prepacked_weights_container_->HasFileCache()) {
+                        // persistence is best-effort; a failure only costs other processes a cache hit
+                        auto persist_status =
+                            prepacked_weights_container_->WriteWeightToFileCache(prepacked_weights_container_key);
+                        if (!persist_status.IsOK()) {
+                          LOGS(logger_, WARNING) << "Unable to persist pre-packed weight for constant initializer: "
+                                                 << input_name << " to the file cache: "
+                                                 << persist_status.ErrorMessage();
+                        }
+                      }
+
                       ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
                                                                           prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
                                                                           node.Name()));
@@ -477,15 +631,15 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
                   }
 
                 } else {  // caching of pre-packed weights' turned OFF
+                  // Defer the packing itself: there is no shared container to coordinate
+                  // with, so independent kernels can pack concurrently once the walk is done.
                   AllocatorPtr session_cpu_alloc = GetAllocator(kernel->Info().GetDevice(OrtMemType::OrtMemTypeDefault));
-                  ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx,
-                                                      session_cpu_alloc,  // use allocator tied to this session
-                                                      is_packed,
-                                                      nullptr  // no caching required
-                                                      ));
+                  deferred_prepacks.push_back({kernel, input_idx, &const_initialized_tensor,
+                                               std::move(session_cpu_alloc), st, ort_value_idx, &input_name});
                 }
                 if (is_packed) {
                   ++number_of_prepacks_counter_;
+                  st->prepacked_initialized_tensors_.insert(ort_value_idx);
 
                   if (constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
                     // release the constant initialized tensor
@@ -517,10 +671,77 @@ Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::strin
     // serialize calls to the method that looks up the container, calls UseCachedPrePackedWeight/PrePack
     // and writes pre-packed weights to the container
     std::lock_guard<onnxruntime::OrtMutex> l(prepacked_weights_container_->mutex_);
-    return prepacked_constant_weights(true);
+    ORT_RETURN_IF_ERROR(prepacked_constant_weights(true));
   } else {
-    return prepacked_constant_weights(false);
+    ORT_RETURN_IF_ERROR(prepacked_constant_weights(false));
+  }
+
+  // Group the deferred work per kernel so that a kernel packing several of its
+  // inputs is never invoked concurrently with itself, then spread the groups
+  // over the intra-op thread pool. Packing large weights (e.g. int4 GEMM B
+  // matrices) dominates session creation for big models and the per-kernel
+  // calls are independent of each other.
+  InlinedVector<std::pair<size_t, size_t>> kernel_ranges;  // [begin, end) into deferred_prepacks
+  for (size_t i = 0, size = deferred_prepacks.size(); i < size;) {
+    size_t j = i + 1;
+    while (j < size && deferred_prepacks[j].kernel == deferred_prepacks[i].kernel) {
+      ++j;
+    }
+    kernel_ranges.emplace_back(i, j);
+    i = j;
+  }
+
+  std::vector<Status> statuses(kernel_ranges.size());
+
+  auto pack_kernel_range = [&](std::ptrdiff_t range_idx) {
+    const auto range = kernel_ranges[range_idx];
+    for (size_t i = range.first; i < range.second && statuses[range_idx].IsOK(); ++i) {
+      auto& prepack = deferred_prepacks[i];
+      ORT_TRY {
+        statuses[range_idx] = prepack.kernel->PrePack(*prepack.tensor, prepack.input_idx,
+                                                      prepack.allocator,  // use allocator tied to this session
+                                                      prepack.is_packed,
+                                                      nullptr  // no caching required
+        );
+      }
+      ORT_CATCH(const std::exception& ex) {
+        ORT_HANDLE_EXCEPTION([&]() {
+          statuses[range_idx] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "PrePack threw: ", ex.what());
+        });
+      }
+    }
+  };
+
+  if (thread_pool_ != nullptr && kernel_ranges.size() > 1) {
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool_, static_cast<std::ptrdiff_t>(kernel_ranges.size()),
+                                                  pack_kernel_range);
+  } else {
+    for (size_t i = 0; i < kernel_ranges.size(); ++i) {
+      pack_kernel_range(static_cast<std::ptrdiff_t>(i));
+    }
   }
+
+  for (const auto& status : statuses) {
+    ORT_RETURN_IF_ERROR(status);
+  }
+
+  // Release initializers whose last consumer has packed them, in graph order as
+  // the serial implementation did.
+  for (const auto& prepack : deferred_prepacks) {
+    if (prepack.is_packed) {
+      ++number_of_prepacks_counter_;
+      prepack.st->prepacked_initialized_tensors_.insert(prepack.ort_value_idx);
+
+      auto usage = constant_initializers_use_count.find(*prepack.input_name);
+      if (usage != constant_initializers_use_count.end() && --usage->second == 0) {
+        // release the constant initialized tensor
+        prepack.st->initialized_tensors_.erase(prepack.ort_value_idx);
+        prepack.st->constant_initialized_tensors_.erase(prepack.ort_value_idx);
+      }
+    }
+  }
+
+  return Status::OK();
 }
 
 static int64_t CalculateMemoryPatternsKey(const gsl::span<const OrtValue>& tensor_inputs) {
@@ -531,7 +752,6 @@ static int64_t CalculateMemoryPatternsKey(const gsl::span<const OrtValue>& tenso
   return key;
 }
 
-#ifdef ENABLE_TRAINING
 namespace {
 Status ResolveDimParams(const GraphViewer& graph,
                         const InlinedHashMap<std::string, TensorShape>& feeds,
@@ -601,24 +821,14 @@ Status TryResolveShape(
 
   return Status::OK();
 }
-
-void TryCalculateSizeFromResolvedShape(int ml_value_idx, const InlinedHashMap<int, TensorShape>& resolved_shapes, size_t& size) {
-  size = 0;
-  auto shape = resolved_shapes.find(ml_value_idx);
-  if (shape != resolved_shapes.end()) {
-    size = 1;
-    for (auto dim : shape->second.GetDims())
-      size *= dim;
-  }
-}
-
 }  // namespace
 
-// If this function fails NO memory planning will take place, hence lets ONLY FAIL and stop training where warranted, example SIZE overflow.
-Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_inputs,
-                                               gsl::span<const int> feed_mlvalue_idxs,
-                                               MemoryPatternGroup& output,
-                                               InlinedHashMap<int, TensorShape>& resolved_shapes) const {
+Status SessionState::ResolveInferredShapes(gsl::span<const OrtValue> tensor_inputs,
+                                           gsl::span<const int> feed_mlvalue_idxs,
+                                           InlinedHashMap<int, TensorShape>& resolved_shapes) const {
+  auto* exe_plan = GetExecutionPlan();
+  ORT_ENFORCE(exe_plan);
+
   InlinedHashMap<std::string, TensorShape> feeds;
   feeds.reserve(feed_mlvalue_idxs.size());
   for (size_t i = 0, end = feed_mlvalue_idxs.size(); i < end; ++i) {
@@ -626,16 +836,12 @@ Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_
     ORT_RETURN_IF_ERROR(this->ort_value_name_idx_map_.GetName(feed_mlvalue_idxs[i], name));
     feeds.emplace(std::move(name), tensor_inputs[i].Get<Tensor>().Shape());
   }
-  InlinedHashMap<std::string, int64_t> map;
-  ORT_RETURN_IF_ERROR(ResolveDimParams(*graph_viewer_, feeds, map));
-  auto* exe_plan = GetExecutionPlan();
-  ORT_ENFORCE(exe_plan);
-  OrtValuePatternPlanner mem_planner(*exe_plan, /*using counters*/ true);
 
-  // Try to resolve shapes for activations.
-  auto& node_index_info = GetNodeIndexInfo();
-  auto& execution_order = exe_plan->node_execution_order_in_training;
-  for (auto& node_idx : execution_order) {
+  InlinedHashMap<std::string, int64_t> symbolic_dimensions;
+  ORT_RETURN_IF_ERROR(ResolveDimParams(*graph_viewer_, feeds, symbolic_dimensions));
+
+  const auto& node_index_info = GetNodeIndexInfo();
+  for (auto node_idx : graph_viewer_->GetNodesInTopologicalOrder()) {
     int node_index = node_index_info.GetNodeOffset(node_idx);
     auto* node = graph_viewer_->GetNode(node_idx);
     int output_start = node_index + static_cast<int>(node->InputDefs().size()) +
@@ -655,19 +861,75 @@ Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_
       TensorShapeVector resolved_shape;
 
       // Tensors whose shape cannot be resolved statically will be allocated at runtime.
-      if (TryResolveShape(arg, map, is_resolved, resolved_shape).IsOK()) {
+      if (TryResolveShape(arg, symbolic_dimensions, is_resolved, resolved_shape).IsOK()) {
         // Store all valid resolved shapes. They will be queried in, for example,
         // Recv operator to bypass the dependency of output shapes on inputs.
         if (is_resolved != 0) {
           resolved_shapes[ml_value_idx] = gsl::make_span(resolved_shape);
         }
       } else {
-        LOGS(logger_, INFO) << "[Static memory planning] Could not resolve shape for tensor with ML index "
+        LOGS(logger_, INFO) << "[Shape memo] Could not resolve shape for tensor with ML index "
                             << ml_value_idx << ", will allocate dynamically.";
       }
     }
   }
 
+  return Status::OK();
+}
+
+std::shared_ptr<const InlinedHashMap<int, TensorShape>> SessionState::GetInferredShapes(
+    gsl::span<const OrtValue> tensor_inputs,
+    gsl::span<const int> feed_mlvalue_idxs) const {
+  int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
+
+  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+  auto it = shape_patterns_.find(key);
+  if (it != shape_patterns_.end()) {
+    TouchMemoryPatternCacheEntry(key, /*is_new_entry*/ false);
+    return it->second;
+  }
+
+  InlinedHashMap<int, TensorShape> resolved_shapes;
+  if (!ResolveInferredShapes(tensor_inputs, feed_mlvalue_idxs, resolved_shapes).IsOK()) {
+    return nullptr;
+  }
+
+  // cache the result even when nothing resolved so the substitution only runs once per shape signature
+  auto insert = shape_patterns_.insert_or_assign(
+      key, std::make_shared<InlinedHashMap<int, TensorShape>>(std::move(resolved_shapes)));
+  TouchMemoryPatternCacheEntry(key, /*is_new_entry*/ true);
+  return insert.first->second;
+}
+
+#ifdef ENABLE_TRAINING
+namespace {
+void TryCalculateSizeFromResolvedShape(int ml_value_idx, const InlinedHashMap<int, TensorShape>& resolved_shapes, size_t& size) {
+  size = 0;
+  auto shape = resolved_shapes.find(ml_value_idx);
+  if (shape != resolved_shapes.end()) {
+    size = 1;
+    for (auto dim : shape->second.GetDims())
+      size *= dim;
+  }
+}
+
+}  // namespace
+
+// If this function fails NO memory planning will take place, hence lets ONLY FAIL and stop training where warranted, example SIZE overflow.
+Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_inputs,
+                                               gsl::span<const int> feed_mlvalue_idxs,
+                                               MemoryPatternGroup& output,
+                                               InlinedHashMap<int, TensorShape>& resolved_shapes) const {
+  // Try to resolve shapes for activations.
+  ORT_RETURN_IF_ERROR(ResolveInferredShapes(tensor_inputs, feed_mlvalue_idxs, resolved_shapes));
+
+  auto* exe_plan = GetExecutionPlan();
+  ORT_ENFORCE(exe_plan);
+  OrtValuePatternPlanner mem_planner(*exe_plan, /*using counters*/ true);
+
+  auto& node_index_info = GetNodeIndexInfo();
+  auto& execution_order = exe_plan->node_execution_order_in_training;
+
   // Allocate activations that want to be laid out contiguously in memory.
   for (auto ml_value_idx : exe_plan->activation_allocation_order) {
     ORT_ENFORCE(ml_value_idx >= 0);
@@ -765,12 +1027,42 @@ Status SessionState::GeneratePatternGroupCache(gsl::span<const OrtValue> tensor_
 
 #endif
 
-// MemoryPatternGroup pointer is cached. It only inserted upon creation
+void SessionState::TouchMemoryPatternCacheEntry(int64_t key, bool is_new_entry) const {
+  if (mem_patterns_cache_limit_ == 0) {
+    return;
+  }
+
+  if (!is_new_entry) {
+    auto pos = std::find(mem_patterns_lru_.begin(), mem_patterns_lru_.end(), key);
+    if (pos != mem_patterns_lru_.end()) {
+      mem_patterns_lru_.splice(mem_patterns_lru_.begin(), mem_patterns_lru_, pos);
+    }
+    return;
+  }
+
+  // a signature may already be tracked if its shape memo entry was created before its pattern group
+  auto pos = std::find(mem_patterns_lru_.begin(), mem_patterns_lru_.end(), key);
+  if (pos != mem_patterns_lru_.end()) {
+    mem_patterns_lru_.splice(mem_patterns_lru_.begin(), mem_patterns_lru_, pos);
+    return;
+  }
+
+  mem_patterns_lru_.push_front(key);
+  while (mem_patterns_lru_.size() > mem_patterns_cache_limit_) {
+    const int64_t evicted_key = mem_patterns_lru_.back();
+    mem_patterns_lru_.pop_back();
+    // in-flight runs keep an evicted pattern group alive through their shared_ptr.
+    mem_patterns_.erase(evicted_key);
+    shape_patterns_.erase(evicted_key);
+  }
+}
+
+// MemoryPatternGroup is cached. It only inserted upon creation
 // and is not updated if already present.
-const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
+std::shared_ptr<const MemoryPatternGroup> SessionState::GetMemoryPatternGroup(
     gsl::span<const OrtValue> tensor_inputs,
     gsl::span<const int> feed_mlvalue_idxs,
-    const InlinedHashMap<int, TensorShape>*& out_inferred_shapes) const {
+    std::shared_ptr<const InlinedHashMap<int, TensorShape>>& out_inferred_shapes) const {
   out_inferred_shapes = nullptr;
   int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
@@ -780,11 +1072,14 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
     MemoryPatternGroup mem_patterns;
     InlinedHashMap<int, TensorShape> inferred_shapes;
     if (GeneratePatternGroupCache(tensor_inputs, feed_mlvalue_idxs, mem_patterns, inferred_shapes).IsOK()) {
-      auto patt_insert = mem_patterns_.insert_or_assign(key, std::move(mem_patterns));
-      auto ptr = &patt_insert.first->second;
-      auto shape_insert = shape_patterns_.insert_or_assign(key, std::move(inferred_shapes));
-      out_inferred_shapes = &shape_insert.first->second;
-      return ptr;
+      mem_patterns.BuildResolvedIndex();
+      auto patt_insert = mem_patterns_.insert_or_assign(
+          key, std::make_shared<MemoryPatternGroup>(std::move(mem_patterns)));
+      auto shape_insert = shape_patterns_.insert_or_assign(
+          key, std::make_shared<InlinedHashMap<int, TensorShape>>(std::move(inferred_shapes)));
+      out_inferred_shapes = shape_insert.first->second;
+      TouchMemoryPatternCacheEntry(key, /*is_new_entry*/ true);
+      return patt_insert.first->second;
     }
 #else
     ORT_UNUSED_PARAMETER(feed_mlvalue_idxs);
@@ -792,11 +1087,13 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
     return nullptr;
   }
 
+  TouchMemoryPatternCacheEntry(key, /*is_new_entry*/ false);
+
   auto patt_hit = shape_patterns_.find(key);
   if (patt_hit != shape_patterns_.cend()) {
-    out_inferred_shapes = &patt_hit->second;
+    out_inferred_shapes = patt_hit->second;
   }
-  return &it->second;
+  return it->second;
 }
 
 void SessionState::ResolveMemoryPatternFlag() {
@@ -850,11 +1147,32 @@ Status SessionState::UpdateMemoryPatternGroupCache(gsl::span<const OrtValue> ten
   int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
-  // Do not update if present, as the pointer to the existing one is cached
-  mem_patterns_.emplace(key, std::move(mem_patterns));
+  // Do not update if present, as the existing one may be in use
+  auto insert_result = mem_patterns_.emplace(key, nullptr);
+  if (insert_result.second) {
+    // Resolve the flat per-value placement index once, before the group is shared with runs.
+    mem_patterns.BuildResolvedIndex();
+    insert_result.first->second = std::make_shared<MemoryPatternGroup>(std::move(mem_patterns));
+    TouchMemoryPatternCacheEntry(key, /*is_new_entry*/ true);
+  }
   return Status::OK();
 }
 
+void SessionState::ClearMemoryPatternCache() {
+  {
+    std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+    mem_patterns_.clear();
+    mem_patterns_lru_.clear();
+    shape_patterns_.clear();
+  }
+
+  for (const auto& node_to_subgraph_states : subgraph_session_states_) {
+    for (const auto& attr_to_subgraph_state : node_to_subgraph_states.second) {
+      attr_to_subgraph_state.second->ClearMemoryPatternCache();
+    }
+  }
+}
+
 bool SessionState::GetEnableMemoryPattern() const { return enable_mem_pattern_; }
 
 bool SessionState::GetEnableMemoryReuse() const { return sess_options_.enable_mem_reuse; }
@@ -1047,7 +1365,8 @@ Status SessionState::CreateSubgraphSessionState() {
           std::make_unique<SessionState>(*subgraph, execution_providers_,
                                          thread_pool_, inter_op_thread_pool_, data_transfer_mgr_,
                                          logger_, profiler_, sess_options_,
-                                         prepacked_weights_container_, allocators_);
+                                         prepacked_weights_container_, allocators_,
+                                         shared_initializers_container_);
 
       // Pass fused function manager to subgraph
       subgraph_session_state->fused_funcs_mgr_.SetFusedFuncs(fused_funcs_mgr_);
@@ -1186,8 +1505,23 @@ Status SessionState::FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE
 
   InlinedHashMap<std::string, size_t> constant_initializers_use_count;
   ComputeConstantInitializerUseCount(graph_, constant_initializers_use_count);
-  return FinalizeSessionStateImpl(graph_location, kernel_registry_manager, nullptr, sess_options_,
-                                  remove_initializers, constant_initializers_use_count);
+  ORT_RETURN_IF_ERROR(FinalizeSessionStateImpl(graph_location, kernel_registry_manager, nullptr, sess_options_,
+                                               remove_initializers, constant_initializers_use_count));
+
+  const std::string sampling_interval_str =
+      sess_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsKernelLatencySamplingInterval, "0");
+  uint64_t sampling_interval = 0;
+  if (!TryParseStringWithClassicLocale(sampling_interval_str, sampling_interval)) {
+    LOGS(logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsKernelLatencySamplingInterval << ": "
+                           << sampling_interval_str << ". Kernel latency stats will not be collected.";
+    sampling_interval = 0;
+  }
+
+  if (sampling_interval > 0) {
+    kernel_latency_stats_ = std::make_unique<KernelLatencyStats>(*graph_viewer_, sampling_interval);
+  }
+
+  return Status::OK();
 }
 
 static Status Index(const OrtValueNameIdxMap& ort_value_name_idx_map,
@@ -1486,7 +1820,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
             }
             return Status::OK();
           },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_, session_options, memory_profile_func));
+          logger_, data_transfer_mgr_, *p_seq_exec_plan_, session_options, memory_profile_func,
+          shared_initializers_container_, thread_pool_));
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Record Weight allocation info on device
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
 #include <map>
 #include <unordered_map>
@@ -24,7 +25,9 @@
 #include "core/framework/feeds_fetches_manager.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/prepacked_weights_container.h"
+#include "core/framework/shared_initializers_container.h"
 #include "core/framework/fuse_nodes_funcs.h"
+#include "core/framework/kernel_latency_stats.h"
 #include "core/framework/kernel_registry_manager.h"
 #include "core/framework/mem_pattern.h"
 #include "core/framework/ort_value.h"
@@ -96,7 +99,8 @@ class SessionState {
                profiling::Profiler& profiler,
                const SessionOptions& sess_options,
                PrepackedWeightsContainer* prepacked_weights_container = nullptr,
-               AllocatorMap* parent_allocators = nullptr);
+               AllocatorMap* parent_allocators = nullptr,
+               SharedInitializersContainer* shared_initializers_container = nullptr);
 
   ~SessionState() {
     for (auto& kvp : deleter_for_initialized_tensors_) {
@@ -161,6 +165,26 @@ class SessionState {
    */
   const std::unordered_map<int, OrtValue>& GetConstantInitializedTensors() const;
 
+  /**
+   * Replaces the values of existing initialized tensors (weights) with the given named tensors.
+   * Every entry must name an existing initializer and match its data type and shape; either all
+   * entries are applied or none are. Values are staged on the device of the weight they replace
+   * before the swap, and the swap itself only exchanges OrtValue handles, so runs that are in
+   * flight finish with the weights they started with and new runs pick up the new weights.
+   * Initializers that were consumed by kernel pre-packing cannot be updated and are rejected;
+   * disable pre-packing (kOrtSessionOptionsConfigDisablePrepacking) for weights that need to be
+   * refreshed at runtime.
+   * Only initializers of the main graph can be updated; subgraph weights are not supported.
+   */
+  Status UpdateInitializedTensors(const NameMLValMap& delta);
+
+  /**
+   * Mutex guarding the initialized tensor maps against concurrent modification by
+   * UpdateInitializedTensors. Held by execution frames while they copy out the initializer
+   * OrtValue handles at the start of a run.
+   */
+  OrtMutex& GetInitializedTensorsMutex() const { return initialized_tensors_mutex_; }
+
 #if !defined(DISABLE_SPARSE_TENSORS)
   bool IsSparseInitializer(int ort_value_index) const;
 #endif
@@ -211,19 +235,43 @@ class SessionState {
   }
 #endif
 
+  /**
+  Get the sampled per-kernel latency histograms for the main graph, or nullptr when
+  kOrtSessionOptionsKernelLatencySamplingInterval is not set. Created during FinalizeSessionState.
+  */
+  KernelLatencyStats* GetKernelLatencyStats() const noexcept { return kernel_latency_stats_.get(); }
+
+#ifdef ENABLE_NVTX_PROFILE
+  /**
+  Get the NVTX range name for the given node. Names are interned for the whole graph on
+  first use, so steady-state kernel launches reuse the cached string instead of
+  rebuilding it on every launch.
+  */
+  const std::string& GetNvtxNodeRangeName(NodeIndex node_index) const;
+#endif
+
   /**
   Get cached memory pattern based on input shapes
   Must be called only when all values contain tensors
-  In training scenarios, the cache may be updated so
-  the callers would receive a copy of inferred shapes
-  made under mutex being held. In inference scenarios,
-  it is not mutable, we do not obtain a lock and simply get a pointer
-  w/o copying a hashtable
+  Shared ownership is returned so that a run keeps using its pattern group
+  even if the entry is evicted from the cache (see
+  kOrtSessionOptionsMemoryPatternCacheLimit) before the run completes.
   */
-  const MemoryPatternGroup* GetMemoryPatternGroup(
+  std::shared_ptr<const MemoryPatternGroup> GetMemoryPatternGroup(
       gsl::span<const OrtValue> tensor_inputs,
       gsl::span<const int> feed_mlvalue_idxs,
-      const InlinedHashMap<int, TensorShape>*& inferred_shapes) const;
+      std::shared_ptr<const InlinedHashMap<int, TensorShape>>& inferred_shapes) const;
+
+  /**
+  Get the per input-shape-signature memo of activation shapes that are fully determined by substituting the
+  symbolic dimensions bound from the feeds. Computed once per signature and cached; kernels query it via
+  OpKernelContext::TryGetInferredOutputShape to skip re-deriving shapes on every run.
+  Must be called only when all values contain tensors.
+  Returns nullptr if the shapes could not be resolved (e.g. a graph input has no static shape information).
+  */
+  std::shared_ptr<const InlinedHashMap<int, TensorShape>> GetInferredShapes(
+      gsl::span<const OrtValue> tensor_inputs,
+      gsl::span<const int> feed_mlvalue_idxs) const;
 
   /**
   Set generated memory pattern with a given input shapes.
@@ -233,6 +281,13 @@ class SessionState {
   Status UpdateMemoryPatternGroupCache(gsl::span<const OrtValue> tensor_inputs,
                                        MemoryPatternGroup mem_patterns) const;
 
+  /**
+  Clears the memory pattern groups and inferred shape memos cached for the input shapes seen so
+  far, including those of any subgraph session states. Patterns are regenerated on demand by
+  subsequent runs. Used when a session's run-accumulated state is reset for pooled reuse.
+  */
+  void ClearMemoryPatternCache();
+
   bool GetUseDeterministicCompute() const { return sess_options_.use_deterministic_compute; }
 
   /**
@@ -402,6 +457,12 @@ class SessionState {
       InlinedHashMap<int, TensorShape>& inferred_shapes) const;
 #endif
 
+  // resolves the symbolic dimensions of the graph inputs against the feeds and substitutes them into the
+  // static shapes of the activations. shapes that are not fully determined by the substitution are skipped.
+  Status ResolveInferredShapes(gsl::span<const OrtValue> tensor_inputs,
+                               gsl::span<const int> feed_mlvalue_idxs,
+                               InlinedHashMap<int, TensorShape>& resolved_shapes) const;
+
   // KernelCreateInfo for each node so we do kernel lookup once
   KernelCreateInfoMap kernel_create_info_map_;
 
@@ -460,6 +521,14 @@ class SessionState {
   // subset of initialized_tensors_ that are constant and cannot be overridden at runtime
   std::unordered_map<int, OrtValue> constant_initialized_tensors_;
 
+  // ort_value_index of every constant initializer a kernel pre-packed. These hold stale copies
+  // of the original bytes inside the kernels, so UpdateInitializedTensors refuses to update them.
+  InlinedHashSet<int> prepacked_initialized_tensors_;
+
+  // guards the maps above against UpdateInitializedTensors swapping entries while an execution
+  // frame is copying out the initializer handles
+  mutable OrtMutex initialized_tensors_mutex_;
+
 #if !defined(DISABLE_SPARSE_TENSORS)
   // This is an auxiliary lookup to check if the OrtValue was actually a sparse tensor
   // this is needed because we currently convert all sparse initializer into dense Tensors
@@ -477,25 +546,43 @@ class SessionState {
   const logging::Logger& logger_;
   profiling::Profiler& profiler_;
 
+#ifdef ENABLE_NVTX_PROFILE
+  // Lazily interned per-node NVTX range names, indexed by NodeIndex. Empty until the
+  // first node executes under profiling; stable once built.
+  mutable std::vector<std::string> nvtx_node_range_names_;
+  mutable OrtMutex nvtx_node_range_names_mutex_;
+#endif
+
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryProfiler* memory_profiler_;
 #endif
 
+  // Sampled per-kernel latency histograms. Only created for the main graph's session state when
+  // kOrtSessionOptionsKernelLatencySamplingInterval is set to a non-zero value.
+  std::unique_ptr<KernelLatencyStats> kernel_latency_stats_;
+
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
+  // Marks the given cache key as most recently used and evicts the least recently used
+  // entries if the configured cache limit is exceeded. Must be called with mem_patterns_lock_ held.
+  // No-op when the cache is unbounded (the default).
+  void TouchMemoryPatternCacheEntry(int64_t key, bool is_new_entry) const;
+
   // lock for the mem_patterns_
   mutable OrtMutex mem_patterns_lock_;
   // cache for the generated mem_patterns. key is calculated based on input shapes.
-  // must be a node based container as a pointer is cached.
-  mutable NodeHashMap<int64_t, MemoryPatternGroup> mem_patterns_;
-  // This is mutable under mutex in training scenarios so execution frame would make a copy
-  // of the value when created.
-#ifdef ENABLE_TRAINING
-  mutable NodeHashMap<int64_t, InlinedHashMap<int, TensorShape>> shape_patterns_;
-#else
-  NodeHashMap<int64_t, InlinedHashMap<int, TensorShape>> shape_patterns_;
-#endif
+  // entries are shared_ptr so an in-flight run keeps its pattern group alive across eviction.
+  mutable NodeHashMap<int64_t, std::shared_ptr<MemoryPatternGroup>> mem_patterns_;
+  // keys of mem_patterns_ ordered from most to least recently used.
+  // only maintained when mem_patterns_cache_limit_ > 0.
+  mutable std::list<int64_t> mem_patterns_lru_;
+  // maximum number of cached pattern groups. 0 means unbounded.
+  // from kOrtSessionOptionsMemoryPatternCacheLimit.
+  size_t mem_patterns_cache_limit_ = 0;
+  // This is mutable under mutex so execution frame would make a copy of the value when created.
+  // populated by GeneratePatternGroupCache in training scenarios and by GetInferredShapes otherwise.
+  mutable NodeHashMap<int64_t, std::shared_ptr<InlinedHashMap<int, TensorShape>>> shape_patterns_;
 
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
@@ -518,6 +605,12 @@ class SessionState {
   // prepacked_weights_container_ can be nullptr if no caching is required for prepacked weights
   PrepackedWeightsContainer* const prepacked_weights_container_{};
 
+  // Container to store deserialized constant initializers to share between sessions created
+  // from the same model. The life-cycle of the container is maintained by the user and the user
+  // will ensure the container is valid while any session reliant on it is still in scope.
+  // shared_initializers_container_ can be nullptr if no sharing of initializers is required
+  SharedInitializersContainer* const shared_initializers_container_{};
+
 #ifdef ENABLE_TRAINING
 // Needed for ORTTrainer. Should be removed along with ORTTrainer code
 #ifndef DISABLE_ABSEIL
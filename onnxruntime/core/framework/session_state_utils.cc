@@ -1,9 +1,11 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include <core/common/status.h>
 
@@ -12,6 +14,7 @@
 #include "core/framework/session_state_utils.h"
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/graph/graph_viewer.h"
 #include "core/framework/data_transfer_manager.h"
 #include "core/framework/graph_partitioner.h"
@@ -20,6 +23,8 @@
 #include "core/framework/ort_value_name_idx_map.h"
 #include "core/framework/sequential_execution_plan.h"
 #include "core/framework/session_state.h"
+#include "core/framework/shared_initializers_container.h"
+#include "core/platform/threadpool.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/framework/bfc_arena.h"
@@ -65,13 +70,15 @@ struct ExtDataValueDeleter {
 static inline common::Status ExtDataTensorProtoToTensor(const Env& env,
                                                         const std::basic_string<PATH_CHAR_TYPE>& proto_path,
                                                         const ONNX_NAMESPACE::TensorProto& tensor_proto,
-                                                        Tensor& tensor, OrtCallback& ext_data_deleter) {
+                                                        Tensor& tensor, OrtCallback& ext_data_deleter,
+                                                        utils::ExternalDataFileMappingCache* file_mapping_cache) {
   ORT_ENFORCE(utils::HasExternalData(tensor_proto));
 
   void* ext_data_buf = nullptr;
   SafeInt<size_t> ext_data_len = 0;
   ORT_RETURN_IF_ERROR(utils::GetExtDataFromTensorProto(env, proto_path.c_str(), tensor_proto,
-                                                       ext_data_buf, ext_data_len, ext_data_deleter));
+                                                       ext_data_buf, ext_data_len, ext_data_deleter,
+                                                       file_mapping_cache));
 
   // NB: creating a do-nothing allocator per tensor is wasteful; can perhaps be
   // avoided if the Tensor class implements the do-nothing behavior when given a
@@ -83,10 +90,25 @@ static inline common::Status ExtDataTensorProtoToTensor(const Env& env,
   return common::Status::OK();
 }
 
+// Touch every page of [data, data + length) to force it resident. Used for background read-ahead of
+// mmap'd external initializers; the volatile sink keeps the loads from being optimized away.
+static void TouchMappedPages(const void* data, size_t length) {
+  constexpr size_t kPageSize = 4096;
+  volatile char sink = 0;
+  const char* p = static_cast<const char*>(data);
+  for (size_t i = 0; i < length; i += kPageSize) {
+    sink += p[i];
+  }
+  if (length > 0) {
+    sink += p[length - 1];
+  }
+}
+
 static common::Status DeserializeTensorProto(const Env& env, const std::basic_string<PATH_CHAR_TYPE>& proto_path,
                                              const ONNX_NAMESPACE::TensorProto& tensor_proto, const MemBuffer* m,
                                              const AllocatorPtr& alloc, const AllocatorPtr& default_cpu_alloc,
                                              OrtValue& ort_value, const DataTransferManager& data_transfer_mgr,
+                                             utils::ExternalDataFileMappingCache* file_mapping_cache,
                                              bool use_device_allocator_for_initializers = false) {
   if (bool(alloc) == (m != nullptr)) {
     return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
@@ -123,7 +145,8 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
       // utilize the mmap'd buffer directly by calling ExtDataTensorProtoToTensor. If we called
       // TensorProtoToTensor it would copy the data, causing unnecessary overhead
       OrtCallback ext_data_deleter;
-      ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_tensor, ext_data_deleter));
+      ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_tensor, ext_data_deleter,
+                                                     file_mapping_cache));
 
       ExtDataValueDeleter deleter{ext_data_deleter, p_tensor.get()};
 
@@ -154,7 +177,7 @@ static common::Status DeserializeTensorProto(const Env& env, const std::basic_st
     std::optional<ScopedOrtCallbackInvoker> scoped_ort_callback_invoker;
     if (utils::HasExternalData(tensor_proto)) {
       ORT_RETURN_IF_ERROR(ExtDataTensorProtoToTensor(env, proto_path, tensor_proto, *p_deserialize_tensor,
-                                                     ext_data_deleter));
+                                                     ext_data_deleter, file_mapping_cache));
       scoped_ort_callback_invoker = ScopedOrtCallbackInvoker(ext_data_deleter);
     } else {
       ORT_RETURN_IF_ERROR(utils::TensorProtoToTensor(env, proto_path.c_str(), tensor_proto, *p_deserialize_tensor));
@@ -187,7 +210,9 @@ common::Status SaveInitializedTensors(
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
     const SessionOptions& session_options,
-    const MemoryProfileFunction& memory_profile_func) {
+    const MemoryProfileFunction& memory_profile_func,
+    SharedInitializersContainer* shared_initializers_container,
+    concurrency::ThreadPool* read_ahead_thread_pool) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -220,6 +245,25 @@ common::Status SaveInitializedTensors(
     return retval;
   };
 
+  // Determine if an initializer can be taken from / stored into the shared initializers container.
+  // Only initializers planned for default CPU memory are shared: their deserialized form is identical
+  // for every session, whereas non-CPU (and pinned) placements are produced with session specific
+  // allocators. Externally backed initializers are excluded as well - on CPU they are views over a
+  // file mapping that the OS already shares across sessions, and their OrtValues carry a file
+  // specific deleter.
+  auto use_shared_initializers_container =
+      [shared_initializers_container, &exec_plan](int ort_value_index,
+                                                  const ONNX_NAMESPACE::TensorProto& tensor_proto) -> bool {
+    if (shared_initializers_container == nullptr) {
+      return false;
+    }
+
+    const auto& planned_mem_info = exec_plan.GetLocation(ort_value_index);
+    return planned_mem_info.Type() == OrtDevice::CPU &&
+           planned_mem_info.MemType() == OrtDevice::MemType::DEFAULT &&
+           !utils::HasExternalData(tensor_proto);
+  };
+
   // 1. first plan the memory
   const InitializedTensorSet& initialized_tensor_set = graph.GetAllInitializedTensors();
   InlinedHashMap<int, const ONNX_NAMESPACE::TensorProto*> id_to_initialized_tensor;
@@ -246,7 +290,8 @@ common::Status SaveInitializedTensors(
     const auto entry = initialized_tensors_to_allocate.find(ort_value_index);
     ORT_ENFORCE(entry != initialized_tensors_to_allocate.end(),
                 "OrtValue index: ", ort_value_index, " from initializer_allocation_order not found among initialized tensors");
-    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU)) {
+    if (!(utils::HasExternalData(*entry->second) && exec_plan.GetLocation(ort_value_index).Type() == OrtDevice::CPU) &&
+        !use_shared_initializers_container(ort_value_index, *entry->second)) {
       // can not trace string tensor
       ORT_ENFORCE(entry->second->data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING, "Can not trace string tensor");
       ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
@@ -263,6 +308,10 @@ common::Status SaveInitializedTensors(
       // do not trace string tensor
       continue;
     }
+    // Shared initializers get their buffer from the shared container's allocator, not the planner
+    if (use_shared_initializers_container(entry.first, *entry.second)) {
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
   // 2. allocate weight buffer on different locations
@@ -282,10 +331,69 @@ common::Status SaveInitializedTensors(
 
   OrtCallback deleter{nullptr, nullptr};
 
+  // a single read-only mapping per external data file is shared by all initializers loaded from that file;
+  // CPU initializers become views over the mapping, so multi-GB checkpoints are not copied at session creation.
+  // initializers that need a mutable or device-side copy (prepacking, non-CPU placement) still get their own
+  // buffer via the planner, as before.
+  utils::ExternalDataFileMappingCache file_mapping_cache;
+
+  // Deserialize in the order the initializers are first consumed by the execution plan instead of in
+  // arbitrary hash map order. External-data reads then follow the graph's execution order, which is what
+  // the background read-ahead below relies on and which also gives the OS a sequential access pattern when
+  // initializers were serialized in topological order.
+  InlinedVector<int> deserialization_order;
+  deserialization_order.reserve(id_to_initialized_tensor.size());
+  {
+    InlinedHashSet<int> ordered_ids;
+    ordered_ids.reserve(id_to_initialized_tensor.size());
+    auto add_first_use = [&](const NodeArg* input_def) {
+      if (!input_def->Exists()) {
+        return;
+      }
+      int ort_value_index = -1;
+      if (!ort_value_name_idx_map.GetIdx(input_def->Name(), ort_value_index).IsOK()) {
+        return;
+      }
+      if (id_to_initialized_tensor.count(ort_value_index) > 0 && ordered_ids.insert(ort_value_index).second) {
+        deserialization_order.push_back(ort_value_index);
+      }
+    };
+
+    for (NodeIndex node_index : graph.GetNodesInTopologicalOrder()) {
+      const Node* node = graph.GetNode(node_index);
+      for (const NodeArg* input_def : node->InputDefs()) {
+        add_first_use(input_def);
+      }
+      for (const NodeArg* input_def : node->ImplicitInputDefs()) {
+        add_first_use(input_def);
+      }
+    }
+
+    // initializers without an explicit consumer in this graph (e.g. ones only exposed as graph outputs) go last
+    for (const auto& entry : id_to_initialized_tensor) {
+      if (ordered_ids.count(entry.first) == 0) {
+        deserialization_order.push_back(entry.first);
+      }
+    }
+  }
+
+  // With a read-ahead depth N > 0, the mapped regions of externally backed CPU initializers are touched on
+  // thread pool tasks in first-use order, N initializers per task, so the first inference can start before
+  // the whole model is resident.
+  int read_ahead_depth = 0;
+  if (read_ahead_thread_pool != nullptr) {
+    const std::string& read_ahead_depth_str =
+        session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsInitializerReadAheadDepth, "0");
+    ORT_RETURN_IF_NOT(TryParseStringWithClassicLocale<int>(read_ahead_depth_str, read_ahead_depth) &&
+                          read_ahead_depth >= 0,
+                      "Invalid value for ", kOrtSessionOptionsInitializerReadAheadDepth, ": ", read_ahead_depth_str);
+  }
+  std::vector<OrtValue> read_ahead_values;
+
   // 3. create weight tensors based on weights buffer
-  for (const auto& entry : id_to_initialized_tensor) {
-    int ort_value_index = entry.first;
-    const std::string& name = entry.second->name();
+  for (int ort_value_index : deserialization_order) {
+    const ONNX_NAMESPACE::TensorProto* initialized_tensor = id_to_initialized_tensor.find(ort_value_index)->second;
+    const std::string& name = initialized_tensor->name();
 
     if (name.empty()) {
       LOGS(logger, INFO) << "Skipping entry for missing optional value at idx " << ort_value_index;
@@ -294,26 +402,47 @@ common::Status SaveInitializedTensors(
 
     OrtValue ort_value;
 
-    if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
+    if (user_supplied_initializer_ids.find(ort_value_index) != user_supplied_initializer_ids.end()) {
       ort_value = *(session_options.initializers_to_share_map.at(name));
       LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
     } else {
-      const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
-
-      std::optional<MemBuffer> m;
-      AllocatorPtr alloc;
-      // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
-      bool use_device_allocator_for_initializers =
-          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
-
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, (m.has_value()) ? &*m : nullptr, alloc,
-                                         default_cpu_alloc, ort_value, data_transfer_mgr,
-                                         use_device_allocator_for_initializers);
-      if (!st.IsOK()) {
-        std::ostringstream oss;
-        oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
-        return Status(st.Category(), st.Code(), oss.str());
+      const ONNX_NAMESPACE::TensorProto& tensor_proto = *initialized_tensor;
+
+      const bool use_shared_container = use_shared_initializers_container(ort_value_index, tensor_proto);
+      if (use_shared_container && shared_initializers_container->GetInitializer(name, ort_value)) {
+        LOGS(logger, INFO) << "Using shared initializer with name (" << name << ").";
+      } else {
+        std::optional<MemBuffer> m;
+        AllocatorPtr alloc;
+        if (use_shared_container) {
+          // Deserialize using the container's allocator so the buffer outlives any single session
+          alloc = shared_initializers_container->GetOrCreateAllocator(CPU);
+        } else {
+          // TODO: if the tensor need be copied, does it have enough room?
+          ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m, alloc));
+        }
+        bool use_device_allocator_for_initializers =
+            session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+
+        Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, (m.has_value()) ? &*m : nullptr, alloc,
+                                           default_cpu_alloc, ort_value, data_transfer_mgr, &file_mapping_cache,
+                                           use_device_allocator_for_initializers);
+        if (!st.IsOK()) {
+          std::ostringstream oss;
+          oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
+          return Status(st.Category(), st.Code(), oss.str());
+        }
+
+        if (use_shared_container) {
+          // Publish the deserialized initializer. If another session published it concurrently,
+          // reference that copy instead so that all sessions share a single buffer.
+          ort_value = shared_initializers_container->AddInitializer(name, ort_value);
+        }
+
+        if (read_ahead_depth > 0 && utils::HasExternalData(tensor_proto) && ort_value.IsTensor() &&
+            ort_value.Get<Tensor>().Location().device.Type() == OrtDevice::CPU) {
+          read_ahead_values.push_back(ort_value);
+        }
       }
     }
 
@@ -332,6 +461,25 @@ common::Status SaveInitializedTensors(
 #endif
   }
 
+  if (!read_ahead_values.empty()) {
+    LOGS(logger, INFO) << "Scheduling background read-ahead for " << read_ahead_values.size()
+                       << " externally backed initializers.";
+    // Each task touches the pages of read_ahead_depth initializers. The OrtValue copies captured by the
+    // task keep the underlying file mappings alive until it completes, independent of the session's lifetime.
+    for (size_t batch_start = 0; batch_start < read_ahead_values.size();
+         batch_start += static_cast<size_t>(read_ahead_depth)) {
+      size_t batch_end = std::min(read_ahead_values.size(), batch_start + static_cast<size_t>(read_ahead_depth));
+      std::vector<OrtValue> batch(read_ahead_values.begin() + static_cast<ptrdiff_t>(batch_start),
+                                  read_ahead_values.begin() + static_cast<ptrdiff_t>(batch_end));
+      concurrency::ThreadPool::Schedule(read_ahead_thread_pool, [batch = std::move(batch)]() {
+        for (const OrtValue& value : batch) {
+          const Tensor& tensor = value.Get<Tensor>();
+          TouchMappedPages(tensor.DataRaw(), tensor.SizeInBytes());
+        }
+      });
+    }
+  }
+
   LOGS(logger, INFO) << "Done saving initialized tensors";
   return common::Status::OK();
 }
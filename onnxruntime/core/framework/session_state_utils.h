@@ -21,10 +21,15 @@ class GraphViewer;
 class OrtValueNameIdxMap;
 class DataTransferManager;
 class NodeArg;
+class SharedInitializersContainer;
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 class MemoryInfo;
 #endif
 
+namespace concurrency {
+class ThreadPool;
+}
+
 namespace logging {
 class Logger;
 }
@@ -44,7 +49,9 @@ common::Status SaveInitializedTensors(
     const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
     const SessionOptions& session_options,
-    const MemoryProfileFunction& memory_profile_func);
+    const MemoryProfileFunction& memory_profile_func,
+    SharedInitializersContainer* shared_initializers_container = nullptr,
+    concurrency::ThreadPool* read_ahead_thread_pool = nullptr);
 
 common::Status SaveInputOutputNamesToNodeMapping(const GraphViewer& graph,
                                                  SessionState& session_state,
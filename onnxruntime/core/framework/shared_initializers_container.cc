@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_initializers_container.h"
+
+#include "core/framework/allocator_utils.h"
+
+namespace onnxruntime {
+
+AllocatorPtr SharedInitializersContainer::GetOrCreateAllocator(const std::string& device_name) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  auto iter = allocators_.find(device_name);
+
+  if (iter != allocators_.end())
+    return iter->second;
+
+  // Support only CPU based allocators for now,
+  // as initializer sharing is only supported for CPU placed initializers.
+  if (device_name == CPU) {
+    // Non-arena based allocator: the buffers are long-lived and freed all at once
+    // when the container goes away, so an arena would only add bookkeeping.
+    AllocatorCreationInfo device_info{[](int) { return std::make_unique<CPUAllocator>(); },
+                                      0, false};
+    auto allocator = CreateAllocator(device_info);
+
+    allocators_[device_name] = allocator;
+
+    return allocator;
+
+  } else {
+    ORT_THROW("Unsupported device allocator in the context of shared initializers: ", device_name);
+  }
+}
+
+bool SharedInitializersContainer::GetInitializer(const std::string& name, /*out*/ OrtValue& ort_value) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  auto iter = initializers_map_.find(name);
+
+  if (iter == initializers_map_.end())
+    return false;
+
+  ort_value = iter->second;
+  return true;
+}
+
+const OrtValue& SharedInitializersContainer::AddInitializer(const std::string& name, const OrtValue& ort_value) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  // If another session raced us to this initializer, keep the previously stored value
+  // so that all sessions reference the same buffer.
+  auto ret = initializers_map_.insert(std::make_pair(name, ort_value));
+  return ret.first->second;
+}
+
+size_t SharedInitializersContainer::GetNumberOfElements() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  return initializers_map_.size();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "core/framework/allocator.h"
+#include "core/framework/ort_value.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Holds deserialized constant initializers so that multiple sessions created from the same model
+// can reference one copy of each weight instead of each session materializing its own.
+// The initializers are keyed by name, so an instance must only be shared between sessions that
+// were created from the same model bytes.
+// The container owns the backing buffers through its own allocator (not any session's allocator),
+// so a stored initializer remains valid for as long as any session references it, irrespective of
+// the order in which the sessions are destroyed. The container instance itself must outlive all
+// sessions it is shared with.
+// All methods are thread safe so that sessions can be initialized concurrently.
+class SharedInitializersContainer final {
+ public:
+  SharedInitializersContainer() {
+  }
+
+  ~SharedInitializersContainer() = default;
+
+  // Returns an allocator keyed by device name.
+  // If an allocator doesn't exist for that specific device, an allocator
+  // is created and stored in a member to be returned on subsequent calls.
+  // Currently, the only supported device is "Cpu".
+  AllocatorPtr GetOrCreateAllocator(const std::string& device_name);
+
+  // If an initializer is stored under the provided name, assigns it to ort_value and
+  // returns true. Returns false otherwise.
+  bool GetInitializer(const std::string& name, /*out*/ OrtValue& ort_value) const;
+
+  // Stores ort_value under the provided name if no entry exists yet and returns the stored value.
+  // When another session has already stored an initializer under the same name, the previously
+  // stored value is returned and ort_value is discarded.
+  const OrtValue& AddInitializer(const std::string& name, const OrtValue& ort_value);
+
+  // Returns the number of elements in the container
+  size_t GetNumberOfElements() const;
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SharedInitializersContainer);
+
+ private:
+  mutable OrtMutex mutex_;
+
+  // Define allocators ahead of the container containing tensors because the allocators
+  // need to be destructed after the container containing the initializer tensors
+  // because the Tensor buffers will be de-allocated using these allocators
+  std::unordered_map<std::string, AllocatorPtr> allocators_;
+
+  // Maps an initializer name to the OrtValue holding its deserialized tensor.
+  std::unordered_map<std::string, OrtValue> initializers_map_;
+};
+
+}  // namespace onnxruntime
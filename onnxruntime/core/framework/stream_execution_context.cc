@@ -20,7 +20,9 @@ StreamExecutionContext::StreamExecutionContext(const SessionState& sess_state,
                                                const std::unordered_map<size_t, IExecutor::CustomAllocator>&
                                                    fetch_allocators,
                                                const logging::Logger& sess_logger,
-                                               bool single_thread_mode)
+                                               bool single_thread_mode,
+                                               const std::unordered_map<size_t, IExecutor::FetchReadyCallback>&
+                                                   fetch_notifiers)
     : session_state_(&sess_state),
       frame_(feed_mlvalue_idxs,
              feeds,
@@ -33,6 +35,7 @@ StreamExecutionContext::StreamExecutionContext(const SessionState& sess_state,
       single_thread_mode_(single_thread_mode),
       device_stream_map_(device_stream_map),
       count_down_barriers_(num_barriers) {
+  InitFetchNotifiers(sess_state, fetch_mlvalue_idxs, fetch_notifiers);
   notifications_.reserve(notification_owners.size());
   for (size_t i = 0; i < notification_owners.size(); ++i) {
     auto* stream = device_stream_map_ ? device_stream_map_->GetStream(notification_owners[i]) : nullptr;
@@ -88,7 +91,9 @@ StreamExecutionContext::StreamExecutionContext(const SessionState& sess_state,
                                                const std::unordered_map<size_t, IExecutor::CustomAllocator>&
                                                    fetch_allocators,
                                                const logging::Logger& sess_logger,
-                                               bool single_thread_mode)
+                                               bool single_thread_mode,
+                                               const std::unordered_map<size_t, IExecutor::FetchReadyCallback>&
+                                                   fetch_notifiers)
     : session_state_(&sess_state),
       frame_(feed_mlvalue_idxs,
              feeds,
@@ -98,6 +103,7 @@ StreamExecutionContext::StreamExecutionContext(const SessionState& sess_state,
              sess_state),
       logger_(&sess_logger),
       single_thread_mode_(single_thread_mode) {
+  InitFetchNotifiers(sess_state, fetch_mlvalue_idxs, fetch_notifiers);
 #ifdef _WIN32
 #pragma warning(push)
 #pragma warning(disable : 26409 26400)
@@ -163,6 +169,50 @@ void StreamExecutionContext ::SetStatus(Status& status) {
 
 StreamExecutionContext::~StreamExecutionContext() {}
 
+void StreamExecutionContext::InitFetchNotifiers(const SessionState& sess_state,
+                                                gsl::span<const int> fetch_mlvalue_idxs,
+                                                const std::unordered_map<size_t, IExecutor::FetchReadyCallback>&
+                                                    fetch_notifiers) {
+  if (fetch_notifiers.empty()) {
+    return;
+  }
+
+  const auto& name_idx_map = sess_state.GetOrtValueNameIdxMap();
+  const auto& graph_viewer = sess_state.GetGraphViewer();
+  for (const auto& [fetch_idx, callback] : fetch_notifiers) {
+    if (fetch_idx >= fetch_mlvalue_idxs.size() || !callback) {
+      continue;
+    }
+    int ort_value_idx = fetch_mlvalue_idxs[fetch_idx];
+    std::string name;
+    if (!name_idx_map.GetName(ort_value_idx, name).IsOK()) {
+      continue;
+    }
+    const Node* producer = graph_viewer.GetProducerNode(name);
+    if (producer == nullptr) {
+      // the output is a pass-through of a feed or an initializer, so it is ready before any node runs
+      callback(frame_.GetFetchedMLValue(ort_value_idx));
+      continue;
+    }
+    fetch_notifiers_[producer->Index()].push_back({ort_value_idx, callback});
+  }
+}
+
+void StreamExecutionContext::NotifyFetchesProduced(onnxruntime::NodeIndex node_index) {
+  if (fetch_notifiers_.empty()) {
+    return;
+  }
+
+  auto it = fetch_notifiers_.find(node_index);
+  if (it == fetch_notifiers_.end()) {
+    return;
+  }
+
+  for (const auto& [ort_value_idx, callback] : it->second) {
+    callback(frame_.GetFetchedMLValue(ort_value_idx));
+  }
+}
+
 void StreamExecutionContext::RecycleNodeInputs(onnxruntime::NodeIndex node_index) {
   auto* execution_plan = session_state_->GetExecutionPlan();
   for (auto idx : execution_plan->node_release_list[node_index]) {
@@ -254,7 +304,9 @@ void ScheduleDownstream(StreamExecutionContext& ctx, size_t trigger, bool single
     for (auto downstream : it->second) {
       // increase the task count before schedule down-stream
       ctx.AddTask();
-      concurrency::ThreadPool::Schedule(tp, [&ctx, downstream, &terminate_flag, &session_scope]() {
+      // spread the unblocked continuations across distinct worker queues so parallel
+      // branches start immediately on separate threads
+      concurrency::ThreadPool::ScheduleSpread(tp, [&ctx, downstream, &terminate_flag, &session_scope]() {
         RunSince(downstream.first, ctx, session_scope, terminate_flag, downstream.second);
       });
     }
@@ -70,7 +70,8 @@ class StreamExecutionContext {
                          std::vector<OrtValue>& fetches,
                          const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
                          const logging::Logger& sess_logger,
-                         bool single_thread_mode);
+                         bool single_thread_mode,
+                         const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers = {});
 
   const SessionState& GetSessionState() const;
 
@@ -116,6 +117,10 @@ class StreamExecutionContext {
   // Release the OrtValues after a step, based on the execution plan.
   void RecycleNodeInputs(onnxruntime::NodeIndex node_index);
 
+  // Invoke the fetch ready callbacks for any fetches produced by the given node.
+  // Called after the node's kernel has completed on its stream.
+  void NotifyFetchesProduced(onnxruntime::NodeIndex node_index);
+
 #ifdef ENABLE_TRAINING
   void SetOrtValueCache(OrtValueCachePtr cache) {
     cache_ = std::move(cache);
@@ -148,6 +153,11 @@ class StreamExecutionContext {
 #endif
 
  private:
+  // Resolve the producing node of each fetch with a ready callback. Fetches that are not produced
+  // by a node (pass-through of a feed or an initializer) are notified immediately.
+  void InitFetchNotifiers(const SessionState& sess_state, gsl::span<const int> fetch_mlvalue_idxs,
+                          const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers);
+
   const SessionState* session_state_;
 
   ExecutionFrame frame_;
@@ -160,6 +170,11 @@ class StreamExecutionContext {
 
   Status task_status_{Status::OK()};
 
+  // per producing node, the ort value index and ready callback of each fetch it produces.
+  // empty unless the caller registered fetch ready callbacks.
+  InlinedHashMap<onnxruntime::NodeIndex, InlinedVector<std::pair<int, IExecutor::FetchReadyCallback>>>
+      fetch_notifiers_;
+
 #ifdef ENABLE_TRAINING
   const ProgramRegion* program_range_{nullptr};
 
@@ -3,6 +3,7 @@
 
 #include "core/framework/tensor.h"
 
+#include <cstring>
 #include <utility>
 #include "core/common/safeint.h"
 #include "core/framework/data_types.h"
@@ -84,11 +85,28 @@ Tensor::Tensor(MLDataType elt_type, const TensorShape& shape, void* p_data, cons
   Init(elt_type, shape, p_data, nullptr, offset, strides);
 }
 
+namespace {
+// The inline buffer can only stand in for allocations whose pointers behave like plain host
+// memory: device buffers and pinned host memory carry semantics (device residency,
+// page-locking for async copies) an ordinary struct member does not have. Strings are
+// excluded because their construction/destruction is tied to the owning deleter.
+bool CanStoreInline(MLDataType elt_type, const OrtMemoryInfo& location) {
+  return location.device.Type() == OrtDevice::CPU &&
+         location.device.MemType() == OrtDevice::MemType::DEFAULT &&
+         !utils::IsPrimitiveDataType<std::string>(elt_type->AsPrimitiveDataType());
+}
+}  // namespace
+
 Tensor::Tensor(MLDataType elt_type, const TensorShape& shape, std::shared_ptr<IAllocator> allocator)
     : alloc_info_(allocator->Info()) {
   ORT_ENFORCE(elt_type != nullptr);
   size_t len = Tensor::CalculateTensorStorageSize(elt_type, shape);
 
+  if (len > 0 && len <= kInlineBufferSize && CanStoreInline(elt_type, alloc_info_)) {
+    Init(elt_type, shape, inline_buffer_, nullptr, 0L);
+    return;
+  }
+
   void* p_data = nullptr;
   if (len > 0) {
     p_data = allocator->Alloc(len);
@@ -196,6 +214,11 @@ Tensor::Tensor(Tensor&& other) noexcept
       dtype_(other.dtype_),
       alloc_info_(other.alloc_info_),
       byte_offset_(other.byte_offset_) {
+  if (other.UsesInlineBuffer()) {
+    memcpy(inline_buffer_, other.inline_buffer_, kInlineBufferSize);
+    p_data_ = inline_buffer_;
+  }
+
   other.p_data_ = nullptr;
   other.buffer_deleter_ = nullptr;
   other.dtype_ = DataTypeImpl::GetType<float>()->AsPrimitiveDataType();
@@ -222,6 +245,11 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
     alloc_info_ = other.alloc_info_;
     byte_offset_ = other.byte_offset_;
 
+    if (other.UsesInlineBuffer()) {
+      memcpy(inline_buffer_, other.inline_buffer_, kInlineBufferSize);
+      p_data_ = inline_buffer_;
+    }
+
     other.p_data_ = nullptr;
     other.buffer_deleter_ = nullptr;
     other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
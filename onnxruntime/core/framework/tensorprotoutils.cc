@@ -914,9 +914,38 @@ static Status GetFileContent(
 }
 #endif
 
+static void ReleaseSharedMappedMemory(void* param) noexcept {
+  delete reinterpret_cast<std::shared_ptr<Env::MappedMemoryPtr>*>(param);
+}
+
+Status ExternalDataFileMappingCache::GetMappedContent(const Env& env,
+                                                      const std::basic_string<ORTCHAR_T>& file_path,
+                                                      FileOffsetType offset, size_t length,
+                                                      void*& ext_data_buf, OrtCallback& ext_data_deleter) {
+  // bounds against the file length are validated by the caller; just guard against offset arithmetic overflow
+  SafeInt<FileOffsetType> end_of_data(offset);
+  end_of_data += length;
+
+  auto it = mappings_.find(file_path);
+  if (it == mappings_.end()) {
+    size_t file_length = 0;
+    ORT_RETURN_IF_ERROR(env.GetFileLength(file_path.c_str(), file_length));
+
+    Env::MappedMemoryPtr mapped_memory{};
+    ORT_RETURN_IF_ERROR(env.MapFileIntoMemory(file_path.c_str(), 0, file_length, mapped_memory));
+    it = mappings_.emplace(file_path, std::make_shared<Env::MappedMemoryPtr>(std::move(mapped_memory))).first;
+  }
+
+  ext_data_buf = it->second->get() + offset;
+  ext_data_deleter = OrtCallback{ReleaseSharedMappedMemory,
+                                 new std::shared_ptr<Env::MappedMemoryPtr>(it->second)};
+  return Status::OK();
+}
+
 Status GetExtDataFromTensorProto(const Env& env, const ORTCHAR_T* model_path,
                                  const ONNX_NAMESPACE::TensorProto& tensor_proto,
-                                 void*& ext_data_buf, SafeInt<size_t>& ext_data_len, OrtCallback& ext_data_deleter) {
+                                 void*& ext_data_buf, SafeInt<size_t>& ext_data_len, OrtCallback& ext_data_deleter,
+                                 ExternalDataFileMappingCache* file_mapping_cache) {
   ORT_ENFORCE(utils::HasExternalData(tensor_proto));
   std::basic_string<ORTCHAR_T> tensor_proto_dir;
   if (model_path != nullptr) {
@@ -936,6 +965,7 @@ Status GetExtDataFromTensorProto(const Env& env, const ORTCHAR_T* model_path,
     ext_data_deleter = OrtCallback{nullptr, nullptr};
   } else {
 #if defined(__wasm__)
+    ORT_UNUSED_PARAMETER(file_mapping_cache);
     ORT_RETURN_IF(file_offset < 0 || file_offset + raw_data_safe_len >= 4294967296,
                   "External initializer: ", tensor_proto.name(),
                   " offset: ", file_offset, " size to read: ", static_cast<size_t>(raw_data_safe_len),
@@ -1012,6 +1042,16 @@ Status GetExtDataFromTensorProto(const Env& env, const ORTCHAR_T* model_path,
                   "External initializer: ", tensor_proto.name(),
                   " offset: ", file_offset, " size to read: ", static_cast<size_t>(raw_data_safe_len),
                   " given file_length: ", file_length, " are out of bounds or can not be read in full.");
+    if (file_mapping_cache != nullptr) {
+      auto cached_status = file_mapping_cache->GetMappedContent(env, external_data_file_path, file_offset,
+                                                                raw_data_safe_len, ext_data_buf, ext_data_deleter);
+      if (cached_status.IsOK()) {
+        ext_data_len = raw_data_safe_len;
+        return Status::OK();
+      }
+      // fall through to the per-tensor mapping/copy path when the file cannot be mapped in full
+    }
+
     ORT_RETURN_IF_ERROR(GetFileContent(env, external_data_file_path.c_str(), file_offset, raw_data_safe_len,
                                        ext_data_buf, ext_data_deleter));
     ext_data_len = raw_data_safe_len;
@@ -3,8 +3,11 @@
 
 #pragma once
 
-#include <vector>
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #ifndef SHARED_PROVIDER
 #include "core/common/common.h"
@@ -98,12 +101,37 @@ address of the memory containing the data.
 */
 constexpr const ORTCHAR_T* kTensorProtoMemoryAddressTag = ORT_TSTR("*/_ORT_MEM_ADDR_/*");
 
+// Caches a single read-only memory mapping per external data file so that all initializers stored in one file
+// can alias the same mapping instead of each creating its own mapping (or worse, its own buffer copy).
+// Mapping the file once from offset 0 also lifts the page-alignment restriction individual tensor offsets would
+// otherwise have to satisfy. The callbacks handed out share ownership of the mapping, so the file is unmapped
+// once the cache and every tensor view over it have been released. Not thread-safe; callers serialize access.
+class ExternalDataFileMappingCache {
+ public:
+  ExternalDataFileMappingCache() = default;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ExternalDataFileMappingCache);
+
+  // Obtain a pointer to 'length' bytes at 'offset' within the shared mapping of 'file_path', mapping the
+  // whole file on first use. 'ext_data_deleter' is updated with a callback that shares ownership of the
+  // mapping. Returns a failure status when the file cannot be mapped; callers are expected to fall back
+  // to a copying path.
+  common::Status GetMappedContent(const Env& env, const std::basic_string<ORTCHAR_T>& file_path,
+                                  FileOffsetType offset, size_t length,
+                                  void*& ext_data_buf, OrtCallback& ext_data_deleter);
+
+ private:
+  std::unordered_map<std::basic_string<ORTCHAR_T>, std::shared_ptr<Env::MappedMemoryPtr>> mappings_;
+};
+
 // Given a tensor proto with external data obtain a pointer to the data and its length.
 // The ext_data_deleter argument is updated with a callback that owns/releases the data.
+// If 'file_mapping_cache' is provided, the data pointer aliases a file mapping shared with other tensors
+// stored in the same external data file rather than a mapping (or copy) private to this tensor.
 common::Status GetExtDataFromTensorProto(const Env& env, const ORTCHAR_T* model_path,
                                          const ONNX_NAMESPACE::TensorProto& tensor_proto,
                                          void*& ext_data_buf, SafeInt<size_t>& ext_data_len,
-                                         OrtCallback& ext_data_deleter);
+                                         OrtCallback& ext_data_deleter,
+                                         ExternalDataFileMappingCache* file_mapping_cache = nullptr);
 
 // Convert the AttributeProto from a Constant node into a TensorProto that can be used as an initializer
 // If AttributeProto contains a TensorProto, this tensor proto is converted as is including the case when the
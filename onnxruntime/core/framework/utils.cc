@@ -69,6 +69,7 @@ bool ProviderIsCpuBased(const std::string& provider_type) {
          provider_type == onnxruntime::kQnnExecutionProvider ||
          provider_type == onnxruntime::kXnnpackExecutionProvider ||
          provider_type == onnxruntime::kAzureExecutionProvider ||
+         provider_type == onnxruntime::kRemoteExecutionProvider ||
          provider_type == onnxruntime::utils::kInternalTestingExecutionProvider;
 }
 
@@ -617,6 +618,7 @@ ExecuteGraphImpl(const SessionState& session_state,
                  const FeedsFetchesManager& feeds_fetches_manager,
                  gsl::span<const OrtValue> feeds, std::vector<OrtValue>& fetches,
                  const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
+                 const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers,
                  ExecutionMode execution_mode, const bool& terminate_flag,
                  const logging::Logger& logger,
 #ifdef ORT_ENABLE_STREAM
@@ -655,7 +657,8 @@ ExecuteGraphImpl(const SessionState& session_state,
                                   terminate_flag,
                                   only_execute_path_to_fetches,
                                   // single thread mode
-                                  single_thread_mode));
+                                  single_thread_mode,
+                                  fetch_notifiers));
     ORT_RETURN_IF_ERROR(status);
   } else {
     auto feeds_to_use = feeds;
@@ -677,6 +680,11 @@ ExecuteGraphImpl(const SessionState& session_state,
     auto num_outputs = fetches.size();
     const auto& fetch_copy_info = feeds_fetches_manager.GetFetchesDeviceCopyInfo();
 
+    // when the fetches need to be staged through device copies, the values produced during execution are
+    // not the ones the caller sees, so readiness notification is deferred until after the copies complete.
+    static const std::unordered_map<size_t, IExecutor::FetchReadyCallback> no_notifiers;
+    const bool defer_fetch_notify = device_copy_checks.output_copy_needed == DeviceCopyCheck::Copy;
+
     if (device_copy_checks.output_copy_needed == DeviceCopyCheck::Copy) {
       // need intermediate fetches. use pre-allocated fetches where possible.
       device_fetches.reserve(num_outputs);
@@ -703,7 +711,8 @@ ExecuteGraphImpl(const SessionState& session_state,
 #endif
                                   terminate_flag,
                                   only_execute_path_to_fetches,
-                                  single_thread_mode));
+                                  single_thread_mode,
+                                  defer_fetch_notify ? no_notifiers : fetch_notifiers));
     ORT_RETURN_IF_ERROR(status);
     InlinedVector<Stream*> fetches_streams;
     fetches_streams.reserve(feeds_fetches_info.fetches_mlvalue_idxs.size());
@@ -728,6 +737,14 @@ ExecuteGraphImpl(const SessionState& session_state,
     if (device_copy_checks.output_copy_needed == DeviceCopyCheck::Copy) {
       ORT_RETURN_IF_ERROR(CopyOutputsAcrossDevices(session_state, *p_fetches, fetches, fetch_copy_info, fetches_streams));
     }
+
+    if (defer_fetch_notify) {
+      for (const auto& [fetch_idx, callback] : fetch_notifiers) {
+        if (fetch_idx < fetches.size() && callback) {
+          callback(fetches[fetch_idx]);
+        }
+      }
+    }
   }
   return Status::OK();
 }
@@ -741,21 +758,22 @@ common::Status ExecuteGraph(const SessionState& session_state,
                             DeviceStreamCollectionHolder& device_stream_collection_holder,
 #endif
                             bool only_execute_path_to_fetches,
-                            Stream* parent_stream) {
+                            Stream* parent_stream,
+                            const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers) {
   ORT_RETURN_IF_ERROR(utils::InitializeFeedFetchCopyInfo(session_state, feeds_fetches_manager));
 
   // finalize the copy info using the provided feeds and fetches. will update device_copy_checks in the background
   FinalizeFeedFetchCopyInfo(feeds_fetches_manager, feeds, fetches);
 #ifdef ORT_ENABLE_STREAM
   DeviceStreamCollection* device_stream_collection = device_stream_collection_holder.p_.get();
-  auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {},
+  auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {}, fetch_notifiers,
                                  execution_mode, terminate_flag, logger,
                                  device_stream_collection,
                                  only_execute_path_to_fetches,
                                  parent_stream);
   return retval;
 #else
-  return ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {},
+  return ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {}, fetch_notifiers,
                           execution_mode, terminate_flag, logger,
                           only_execute_path_to_fetches,
                           parent_stream);
@@ -769,7 +787,14 @@ common::Status ExecuteGraph(const SessionState& session_state,
 #ifdef ORT_ENABLE_STREAM
                             DeviceStreamCollectionHolder& device_stream_collection_holder,
 #endif
-                            const logging::Logger& logger) {
+                            const logging::Logger& logger,
+                            const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers) {
+  // Deterministic dispatch runs the plan inline on the calling thread in plan order, so repeated
+  // runs dispatch kernels identically regardless of the session's execution mode.
+  if (run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigDeterministicDispatch, "0") == "1") {
+    execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  }
+
   return ExecuteGraph(session_state,
                       feeds_fetches_manager,
                       feeds, fetches,
@@ -779,7 +804,9 @@ common::Status ExecuteGraph(const SessionState& session_state,
 #ifdef ORT_ENABLE_STREAM
                       device_stream_collection_holder,
 #endif
-                      run_options.only_execute_path_to_fetches);
+                      run_options.only_execute_path_to_fetches,
+                      /*parent_stream*/ nullptr,
+                      fetch_notifiers);
 }
 
 #ifdef ENABLE_TRAINING
@@ -907,12 +934,12 @@ common::Status ExecuteSubgraph(const SessionState& session_state, const FeedsFet
   DeviceStreamCollectionHolder device_stream_collection_holder(&session_state);
   DeviceStreamCollection* device_stream_collection = device_stream_collection_holder.p_.get();
 
-  auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, fetch_allocators,
+  auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, fetch_allocators, {},
                                  execution_mode, terminate_flag, logger, device_stream_collection, false, parent_stream);
   if (device_stream_collection)
     ORT_CHECK_AND_SET_RETVAL(device_stream_collection->CleanUp(false));
 #else
-  auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, fetch_allocators,
+  auto retval = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, fetch_allocators, {},
                                  execution_mode, terminate_flag, logger, false, parent_stream);
 #endif
   if (retval.IsOK() && sync_subgraph_fetches && parent_stream) {
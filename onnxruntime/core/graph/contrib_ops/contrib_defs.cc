@@ -1332,6 +1332,12 @@ ONNX_MS_OPERATOR_SET_SCHEMA(GreedySearch, 1,
                                 .Input(4, "vocab_mask", "Mask of vocabulary. Words that masked with 0 are not allowed to be generated, and 1 is allowed. Shape is (vocab_size)", "I", OpSchema::Optional)
                                 .Input(5, "prefix_vocab_mask", "Mask of vocabulary for first step. Words that masked with 0 are not allowed to be generated, and 1 is allowed. Shape is (batch_size, vocab_size)", "I", OpSchema::Optional)
                                 .Input(6, "attention_mask", "Custom attention mask. Shape is (batch_size, sequence_length)", "I", OpSchema::Optional)
+                                .Input(7, "draft_token_ids",
+                                       "Draft continuation of input_ids, e.g. produced by a smaller draft model. draft_token_ids[i][j] is the "
+                                       "draft for generated position j of batch i. When greedy decoding is unconstrained, the decoder scores the "
+                                       "remaining draft window in one pass and accepts the longest prefix that matches its own choices, so the "
+                                       "output is unchanged while the number of decoder calls shrinks. Shape is (batch_size, draft_length)",
+                                       "I", OpSchema::Optional)
                                 .Output(0, "sequences", "Word IDs of generated sequences. Shape is (batch_size, max_sequence_length)", "I")
                                 // TODO(wy): support scores if needed.
                                 .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
@@ -1933,6 +1939,96 @@ ONNX_MS_OPERATOR_SET_SCHEMA(Tokenizer, 1,
                                   updateOutputShape(ctx, 0, output_shape);
                                 }));
 
+constexpr const char* WordpieceEncoder_ver1_doc = R"DOC(
+  WordpieceEncoder encodes a batch of raw strings into BERT-style model inputs in a single step,
+  replacing the usual out-of-process tokenize/pad/mask pipeline. Input X has shape [N] where each
+  element is one piece of text. Each string is split into words on whitespace, ASCII punctuation
+  characters are split off as individual words, and each word is then greedily segmented into the
+  longest matching pieces from "vocab" using the WordPiece algorithm. Pieces that continue a word
+  must appear in the vocabulary prefixed with "suffix_indicator". A word that cannot be fully
+  segmented is encoded as "unk_token". The id of a token is its index in "vocab".
+  Every row of the output is "cls_token", followed by the word pieces, followed by "sep_token",
+  truncated and padded with "pad_token" to exactly "max_length" ids. "attention_mask" is 1 for
+  real tokens and 0 for padding, and "token_type_ids" is all zeros since a single segment is
+  produced. If "do_lower_case" is set, ASCII letters are lowercased before lookup; multi-byte
+  UTF-8 characters are matched verbatim. Strings must be valid UTF-8.
+)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(WordpieceEncoder, 1,
+                            OpSchema()
+                                .Input(0, "X", "Strings to encode, shape [N]", "T")
+                                .Output(0, "input_ids", "Token ids, shape [N, max_length]", "T1")
+                                .Output(1, "attention_mask", "1 for real tokens, 0 for padding, shape [N, max_length]", "T1")
+                                .Output(2, "token_type_ids", "Segment ids, all zeros, shape [N, max_length]", "T1")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(string)"},
+                                    "Input is a string tensor")
+                                .TypeConstraint(
+                                    "T1",
+                                    {"tensor(int64)"},
+                                    "Outputs are int64 tensors")
+                                .Attr(
+                                    "vocab",
+                                    "The WordPiece vocabulary. The id of a token is its index in this list.",
+                                    AttributeProto::STRINGS)
+                                .Attr(
+                                    "max_length",
+                                    "Length every output row is truncated or padded to. Must be at least 2 to fit the start/end tokens.",
+                                    AttributeProto::INT)
+                                .Attr(
+                                    "do_lower_case",
+                                    "Whether to lowercase ASCII letters before vocabulary lookup.",
+                                    AttributeProto::INT,
+                                    static_cast<int64_t>(1))
+                                .Attr(
+                                    "suffix_indicator",
+                                    "Prefix that marks vocabulary entries which continue a word.",
+                                    AttributeProto::STRING,
+                                    std::string("##"))
+                                .Attr(
+                                    "unk_token",
+                                    "Token substituted for words that cannot be segmented. Must be present in vocab.",
+                                    AttributeProto::STRING,
+                                    std::string("[UNK]"))
+                                .Attr(
+                                    "cls_token",
+                                    "Token emitted at the start of every row. Must be present in vocab.",
+                                    AttributeProto::STRING,
+                                    std::string("[CLS]"))
+                                .Attr(
+                                    "sep_token",
+                                    "Token emitted at the end of every row. Must be present in vocab.",
+                                    AttributeProto::STRING,
+                                    std::string("[SEP]"))
+                                .Attr(
+                                    "pad_token",
+                                    "Token used to pad rows to max_length. Must be present in vocab.",
+                                    AttributeProto::STRING,
+                                    std::string("[PAD]"))
+                                .SetDoc(WordpieceEncoder_ver1_doc)
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  auto max_length = getAttribute(ctx, "max_length", 0);
+                                  for (size_t i = 0; i < 3; ++i) {
+                                    updateOutputElemType(ctx, i, ONNX_NAMESPACE::TensorProto::INT64);
+                                  }
+
+                                  if (!hasInputShape(ctx, 0))
+                                    return;
+
+                                  auto& input_shape = getInputShape(ctx, 0);
+                                  if (input_shape.dim_size() != 1) {
+                                    fail_shape_inference("Input must have shape [N]");
+                                  }
+
+                                  ONNX_NAMESPACE::TensorShapeProto output_shape;
+                                  *output_shape.add_dim() = input_shape.dim(0);
+                                  output_shape.add_dim()->set_dim_value(max_length);
+                                  for (size_t i = 0; i < 3; ++i) {
+                                    updateOutputShape(ctx, i, output_shape);
+                                  }
+                                }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(MatMulInteger16, 1,
                             OpSchema()
                                 .SetDoc(R"DOC(
@@ -225,6 +225,77 @@ ONNX_MS_OPERATOR_SET_SCHEMA(DequantizeLinear, 1,
                                   updateOutputShape(ctx, 0, input_shape);
                                 }));
 
+static const char* GatherBlockQuantized_ver1_doc = R"DOC(
+GatherBlockQuantized is a Gather with data quantized. It is similar to Gather (https://github.com/onnx/onnx/blob/main/docs/Operators.md#gather) with differences:
+  1. Input `data` is a constant quantized tensor. It is quantized blockwise along attribute `quantize_axis` with block size specified by attribute `block_size`.
+     `block_size` must be a power of 2 and not smaller than 16, like 16, 32, 64, 128, ..
+  2. Input `scales` and `zero_points` are the quantization parameters for `data`. They have the same shape except for the `quantize_axis` dimension,
+     on which `scales` and `zero_points` have dimension value `ceil(data.shape[quantize_axis] / block_size)`.
+  3. Output `output` is the dequantized gather result and has the same type as `scales`.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(
+    GatherBlockQuantized, 1,
+    OpSchema()
+        .Attr("gather_axis",
+              "(Optional) Which axis to gather on. Negative value means counting dimensions from the back. "
+              "Accepted range is [-r, r-1] where r = rank(data). Default value is 0.",
+              AttributeProto::INT, static_cast<int64_t>(0))
+        .Attr("quantize_axis",
+              "(Optional) Which axis `data` was quantized on. Negative value means counting dimensions from the back. "
+              "Accepted range is [-r, r-1] where r = rank(data). Default value is 1.",
+              AttributeProto::INT, static_cast<int64_t>(1))
+        .Attr("block_size",
+              "(Optional) Size of the quantization block along `quantize_axis`. "
+              "It must be a power of 2 and not smaller than 16. Default value is 128.",
+              AttributeProto::INT, static_cast<int64_t>(128))
+        .Input(0, "data", "Tensor of rank r >= 1, quantized blockwise along `quantize_axis`.", "T1")
+        .Input(1, "indices",
+               "Tensor of int32/int64 indices, of any rank q. All index values are expected to be within bounds "
+               "[-s, s-1] along axis of size s. It is an error if any of the index values are out of bounds.",
+               "Tind")
+        .Input(2, "scales", "Quantization scales of `data`.", "T2")
+        .Input(3, "zero_points",
+               "(Optional) Quantization zero points of `data`. Same shape as `scales`. "
+               "Zero point is 0 when it is not specified.",
+               "T1", OpSchema::Optional)
+        .Output(0, "output", "Dequantized output tensor of rank q + (r - 1).", "T2")
+        .TypeConstraint("T1", {"tensor(int8)", "tensor(uint8)", "tensor(int4)", "tensor(uint4)"},
+                        "Constrain quantized types.")
+        .TypeConstraint("T2", {"tensor(float)"}, "Constrain dequantized types.")
+        .TypeConstraint("Tind", {"tensor(int32)", "tensor(int64)"}, "Constrain indices to integer types.")
+        .SetDoc(GatherBlockQuantized_ver1_doc)
+        .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+          propagateElemTypeFromInputToOutput(ctx, 2, 0);
+
+          if (!hasInputShape(ctx, 0) || !hasInputShape(ctx, 1)) return;
+
+          const auto& data_shape = getInputShape(ctx, 0);
+          const auto& indices_shape = getInputShape(ctx, 1);
+          int r = data_shape.dim_size();
+          if (r < 1) {
+            fail_shape_inference("data tensor must have rank >= 1");
+          }
+
+          int64_t gather_axis = getAttribute(ctx, "gather_axis", 0);
+          if (gather_axis < -r || gather_axis > r - 1) {
+            fail_shape_inference("gather_axis must be in [-r, r-1]");
+          }
+          if (gather_axis < 0) gather_axis += r;
+
+          int q = indices_shape.dim_size();
+          ONNX_NAMESPACE::TensorShapeProto output_shape;
+          for (int i = 0; i < gather_axis; ++i) {
+            *output_shape.add_dim() = data_shape.dim(i);
+          }
+          for (int i = 0; i < q; ++i) {
+            *output_shape.add_dim() = indices_shape.dim(i);
+          }
+          for (int i = static_cast<int>(gather_axis) + 1; i < r; ++i) {
+            *output_shape.add_dim() = data_shape.dim(i);
+          }
+          updateOutputShape(ctx, 0, output_shape);
+        }));
+
 static const char* QuantizeBFP_ver1_doc = R"DOC(
 The BFP quantization operator. It consumes a full precision tensor and computes an BFP tensor.
 More documentation on the BFP format can be found in this paper: https://www.microsoft.com/en-us/research/publication/pushing-the-limits-of-narrow-precision-inferencing-at-cloud-scale-with-microsoft-floating-point/)DOC";
@@ -757,6 +828,98 @@ ONNX_MS_OPERATOR_SET_SCHEMA(
         .TypeConstraint("T2", {"tensor(uint8)", "tensor(int8)"}, "Constrain weights types to 8 bit tensors.")
         .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::RNNShapeInference));
 
+ONNX_MS_OPERATOR_SET_SCHEMA(
+    DynamicQuantizeGRU, 1,
+    OpSchema()
+        .Attr("direction",
+              "Specify if the RNN is forward, reverse, or bidirectional. "
+              "Must be one of forward (default), reverse, or bidirectional.",
+              AttributeProto::STRING, std::string("forward"))
+        .Attr("hidden_size", "Number of neurons in the hidden layer", AttributeProto::INT, OPTIONAL_VALUE)
+        .Attr("activation_alpha",
+              "Optional scaling values used by some activation functions. The values "
+              "are consumed in the order of activation functions, for example (f, g, h) "
+              "in LSTM. Default values are the same as of corresponding ONNX operators."
+              "For example with LeakyRelu, the default alpha is 0.01.",
+              AttributeProto::FLOATS, OPTIONAL_VALUE)
+        .Attr("activation_beta",
+              "Optional scaling values used by some activation functions. The values "
+              "are consumed in the order of activation functions, for example (f, g, h) "
+              "in LSTM. Default values are the same as of corresponding ONNX operators.",
+              AttributeProto::FLOATS, OPTIONAL_VALUE)
+        .Attr("clip",
+              "Cell clip threshold. Clipping bounds the elements of a tensor "
+              "in the range of [-threshold, +threshold] and is applied to the input "
+              "of activations. No clip if not specified.",
+              AttributeProto::FLOAT, OPTIONAL_VALUE)
+        .Attr("activations",
+              "A list of 2 (or 4 if bidirectional) activation functions "
+              "for update, reset, and hidden gates. The activation functions must be one "
+              "of the activation functions specified above. Optional: See the equations "
+              "for default if not specified.",
+              AttributeProto::STRINGS, OPTIONAL_VALUE)
+        .Attr("linear_before_reset",
+              "When computing the output of the hidden gate, apply the linear "
+              "transformation before multiplying by the output of the reset gate.",
+              AttributeProto::INT, static_cast<int64_t>(0))
+        .Input(0, "X",
+               "The input sequences packed (and potentially padded) into one 3-D "
+               "tensor with the shape of `[seq_length, batch_size, input_size]`.",
+               "T")
+        .Input(1, "W",
+               "The weight tensor for the gates. Concatenation of `W[zrh]` and "
+               "`WB[zrh]` (if bidirectional) along dimension 0. The tensor has shape "
+               "`[num_directions, input_size, 3*hidden_size]`.",
+               "T2")
+        .Input(2, "R",
+               "The recurrence weight tensor. Concatenation of `R[zrh]` and "
+               "`RB[zrh]` (if bidirectional) along dimension 0. This tensor has shape "
+               "`[num_directions, hidden_size, 3*hidden_size]`.",
+               "T2")
+        .Input(3, "B",
+               "The bias tensor for the gates. Concatenation of `[Wb[zrh], Rb[zrh]]` "
+               "and `[WBb[zrh], RBb[zrh]]` (if bidirectional) along dimension 0. This "
+               "tensor has shape `[num_directions, 6*hidden_size]`. Optional: If not "
+               "specified - assumed to be 0.",
+               "T", OpSchema::Optional)
+        .Input(4, "sequence_lens",
+               "Optional tensor specifying lengths of the sequences in a batch. "
+               "If not specified - assumed all sequences in the batch to have "
+               "length `seq_length`. It has shape `[batch_size]`.",
+               "T1", OpSchema::Optional)
+        .Input(5, "initial_h",
+               "Optional initial value of the hidden. If not specified - assumed "
+               "to be 0. It has shape `[num_directions, batch_size, hidden_size]`.",
+               "T", OpSchema::Optional)
+        .Input(6, "W_scale",
+               "W's scale. Its size is [num_directions] for per-tensor/layer quantization, "
+               "or [num_directions, 3*hidden_size] for per-channel quantization on the axis input_size.",
+               "T")
+        .Input(7, "W_zero_point",
+               "W's zero point. Its size is [num_directions] for per-tensor/layer quantization, "
+               "or [num_directions, 3*hidden_size] for per-channel quantization on the axis input_size.",
+               "T2")
+        .Input(8, "R_scale",
+               "R's scale. Its size is [num_directions] for per-tensor/layer quantization, "
+               "or [num_directions, 3*hidden_size] for per-channel quantization on the axis input_size.",
+               "T")
+        .Input(9, "R_zero_point",
+               "R's zero point. Its size is [num_directions] for per-tensor/layer quantization, "
+               "or [num_directions, 3*hidden_size] for per-channel quantization on the axis input_size.",
+               "T2")
+        .Output(0, "Y",
+                "A tensor that concats all the intermediate output values of the hidden. "
+                "It has shape `[seq_length, num_directions, batch_size, hidden_size]`. ",
+                "T", OpSchema::Optional, true, 1, OpSchema::Differentiable)
+        .Output(1, "Y_h",
+                "The last output value of the hidden. It has shape "
+                "`[num_directions, batch_size, hidden_size]`.",
+                "T", OpSchema::Optional, true, 1, OpSchema::Differentiable)
+        .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+        .TypeConstraint("T1", {"tensor(int32)"}, "Constrain seq_lens to integer tensor.")
+        .TypeConstraint("T2", {"tensor(uint8)", "tensor(int8)"}, "Constrain weights types to 8 bit tensors.")
+        .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::RNNShapeInference));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(
     QLinearConcat, 1,
     OpSchema()
@@ -1251,6 +1414,45 @@ ONNX_MS_OPERATOR_SET_SCHEMA(QOrderedLayerNormalization, 1,
                                   propagateElemTypeFromInputToOutput(ctx, 0, 0);
                                 }));
 
+ONNX_MS_OPERATOR_SET_SCHEMA(QOrderedSkipLayerNormalization, 1,
+                            OpSchema()
+                                .SetDoc("Fused residual add + LayerNormalization operating on ordered quantized "
+                                        "tensors. Computes Y = Quantize(LayerNorm(Dequantize(X) + Dequantize(skip))) "
+                                        "in a single pass so the int8 transformer residual path avoids the "
+                                        "dequantize/add/quantize round trips between qordered GEMMs.")
+                                .Attr("axis",
+                                      "The first normalization dimension: normalization "
+                                      "will be performed along dimensions axis "
+                                      ": rank(inputs).",
+                                      AttributeProto::INT, static_cast<int64_t>(-1))
+                                .Attr("epsilon", "The epsilon value to use to avoid division by zero.",
+                                      AttributeProto::FLOAT, 1e-5f)
+                                .Attr("order_X",
+                                      "cublasLt order of inputs X and skip. Default is ROW MAJOR. See the schema of "
+                                      "QuantizeWithOrder for order definition.",
+                                      AttributeProto::INT, static_cast<int64_t>(1))
+                                .Attr("order_Y",
+                                      "cublasLt order of matrix Y, must be same as order_X. Default is ROW MAJOR.",
+                                      AttributeProto::INT, static_cast<int64_t>(1))
+                                .AllowUncheckedAttributes()
+                                .Input(0, "X", "Input data tensor from the previous layer.", "Q")
+                                .Input(1, "scale_X", "scale of the quantized X", "S")
+                                .Input(2, "skip", "Residual input tensor with the same shape as X.", "Q")
+                                .Input(3, "scale_skip", "scale of the quantized skip", "S")
+                                .Input(4, "scale", "Scale tensor, i.e., gamma vector.", "F")
+                                .Input(5, "B", "Bias tensor.", "F", OpSchema::Optional)
+                                .Input(6, "scale_Y", "scale of the quantized Y", "S")
+                                .Output(0, "Y", "Output data tensor.", "Q")
+                                .TypeConstraint("F", {"tensor(float16)", "tensor(float)"},
+                                                "Constrain input gamma and bias could be float16/float tensors. "
+                                                "float may get better precision, float16 runs faster.")
+                                .TypeConstraint("S", {"tensor(float)"}, "quantization scale must be float tensors.")
+                                .TypeConstraint("Q", {"tensor(int8)"}, "quantization tensor must be int8 tensors.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  propagateShapeAndTypeFromFirstInput(ctx);
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+                                }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(
     QOrderedGelu, 1,
     OpSchema()
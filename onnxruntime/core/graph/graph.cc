@@ -27,6 +27,7 @@
 #include "core/graph/model_load_utils.h"
 #include "core/graph/node_attr_utils.h"
 #include "core/graph/op.h"
+#include "core/platform/threadpool.h"
 #include "core/graph/runtime_optimization_record_container.h"
 #include "core/graph/function_utils.h"
 
@@ -805,9 +806,11 @@ Status Node::LoadFromOrtFormat(const onnxruntime::fbs::Node& fbs_node,
   since_version_ = fbs_node.since_version();
   fbs::utils::LoadStringFromOrtFormat(op_type_, fbs_node.op_type());
   node_type_ = static_cast<Node::Type>(fbs_node.type());
-  // we skip populating the saved EP here
-  // the node will be assigned to an EP by the ORT format model-specific graph partitioning
-  // fbs::utils::LoadStringFromOrtFormat(execution_provider_type_, fbs_node.execution_provider_type());
+  // we do not populate execution_provider_type_ from the saved EP here as the registered EPs may differ
+  // from the ones the assignments were saved with. the node will be assigned to an EP by the ORT format
+  // model-specific graph partitioning, which may replay the saved assignment when it is known to be valid.
+  fbs::utils::LoadStringFromOrtFormat(ort_format_saved_execution_provider_type_,
+                                      fbs_node.execution_provider_type());
   ORT_RETURN_IF_ERROR(LoadNodeArgsFromOrtFormat(fbs_node.inputs(), definitions_.input_defs));
 
   // attributes
@@ -3139,7 +3142,9 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
       }
     }
 
-    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    if (options.shape_inference_thread_pool == nullptr) {
+      NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *p_op, options)));
+    }
 
     // Accumulate output names of the iterated Node
     for (const auto& output : node.OutputDefs()) {
@@ -3147,6 +3152,12 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     }
   }
 
+  if (options.shape_inference_thread_pool != nullptr) {
+    // schema resolution and attribute verification above run serially as they depend on the lexical
+    // scope context; inference itself is deferred so that independent nodes can run concurrently
+    NO_CHANGE_ON_SYNC_FLAG(ORT_RETURN_IF_ERROR(ParallelTypeAndShapeInference(options)));
+  }
+
   // verify subgraphs
   for (auto node_index : nodes_in_topological_order_) {
     auto& node = *GetNode(node_index);
@@ -3159,6 +3170,81 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   return Status::OK();
 }
 
+Status Graph::ParallelTypeAndShapeInference(const ResolveOptions& options) {
+  // Bucket the nodes into topological levels: a node's level is one greater than the maximum level
+  // of its input nodes, so all producers of a level N node belong to levels < N. Within a level
+  // nodes are independent of each other and their inference can run concurrently; completing a level
+  // before starting the next acts as the barrier that makes producer output shapes visible.
+  InlinedHashMap<NodeIndex, size_t> node_levels;
+  node_levels.reserve(nodes_in_topological_order_.size());
+  InlinedVector<InlinedVector<NodeIndex>> levels;
+
+  for (auto node_index : nodes_in_topological_order_) {
+    const auto& node = *GetNode(node_index);
+    size_t level = 0;
+    for (auto it = node.InputNodesBegin(), end = node.InputNodesEnd(); it != end; ++it) {
+      auto entry = node_levels.find(it->Index());
+      if (entry != node_levels.end()) {
+        level = std::max(level, entry->second + 1);
+      }
+    }
+
+    node_levels.insert({node_index, level});
+    if (level >= levels.size()) {
+      levels.resize(level + 1);
+    }
+
+    levels[level].push_back(node_index);
+  }
+
+  for (const auto& level_nodes : levels) {
+    // nodes with subgraphs recurse into subgraph inferencing which mutates shared Graph state,
+    // so they are kept out of the concurrent batch
+    InlinedVector<NodeIndex> parallel_nodes;
+    parallel_nodes.reserve(level_nodes.size());
+
+    for (auto node_index : level_nodes) {
+      auto& node = *GetNode(node_index);
+      if (node.ContainsSubgraph()) {
+        ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *node.Op(), options));
+      } else {
+        parallel_nodes.push_back(node_index);
+      }
+    }
+
+    if (parallel_nodes.size() < 2) {
+      for (auto node_index : parallel_nodes) {
+        auto& node = *GetNode(node_index);
+        ORT_RETURN_IF_ERROR(InferAndVerifyTypeMatch(node, *node.Op(), options));
+      }
+      continue;
+    }
+
+    std::vector<Status> statuses(parallel_nodes.size());
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        options.shape_inference_thread_pool, static_cast<std::ptrdiff_t>(parallel_nodes.size()),
+        [&](std::ptrdiff_t i) {
+          auto& node = *GetNode(parallel_nodes[static_cast<size_t>(i)]);
+          ORT_TRY {
+            statuses[static_cast<size_t>(i)] = InferAndVerifyTypeMatch(node, *node.Op(), options);
+          }
+          ORT_CATCH(const std::exception& ex) {
+            ORT_HANDLE_EXCEPTION([&]() {
+              statuses[static_cast<size_t>(i)] =
+                  ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_GRAPH, "Type/shape inference failed for node ",
+                                  node.Name(), ". Error: ", ex.what());
+            });
+          }
+        });
+
+    for (const auto& status : statuses) {
+      ORT_RETURN_IF_ERROR(status);
+    }
+  }
+
+  return Status::OK();
+}
+
 Status Graph::VerifyInputAndInitializerNames() {
   std::unordered_set<std::string_view>& inputs_and_initializers = resolve_context_.inputs_and_initializers;
 
@@ -3872,6 +3958,16 @@ Node& Graph::AddNode(const std::string& name,
     GraphProtoSyncNeeded(true);
   }
 
+  // Keep the producer/consumer lookup tables in sync so GetProducerNode/GetConsumerNodes
+  // see newly added nodes without waiting for the next Resolve.
+  node->ForEachDef([this, &node](const NodeArg& node_arg, bool is_input) {
+    if (is_input) {
+      node_arg_to_consumer_nodes_[node_arg.Name()].insert(node->Index());
+    } else {
+      node_arg_to_producer_node_[node_arg.Name()] = node->Index();
+    }
+  });
+
   return *node;
 }
 
@@ -3892,6 +3988,21 @@ bool Graph::RemoveNode(NodeIndex p_index) {
     RemoveEdge(input_edge.GetNode().Index(), p_index, input_edge.GetSrcArgIndex(), input_edge.GetDstArgIndex());
   }
 
+  // Drop the node from the producer/consumer lookup tables so they stay usable between Resolve calls.
+  node->ForEachDef([this, p_index](const NodeArg& node_arg, bool is_input) {
+    if (is_input) {
+      auto it = node_arg_to_consumer_nodes_.find(node_arg.Name());
+      if (it != node_arg_to_consumer_nodes_.end()) {
+        it->second.erase(p_index);
+      }
+    } else {
+      auto it = node_arg_to_producer_node_.find(node_arg.Name());
+      if (it != node_arg_to_producer_node_.end() && it->second == p_index) {
+        node_arg_to_producer_node_.erase(it);
+      }
+    }
+  });
+
   return ReleaseNode(p_index);
 }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
@@ -7,6 +7,8 @@
 #include "core/flatbuffers/flatbuffers_utils.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/graph/model.h"
+
+#include <google/protobuf/arena.h>
 #include "core/graph/model_load_utils.h"
 
 #ifdef _MSC_VER
@@ -42,7 +44,7 @@ namespace onnxruntime {
 #if !defined(ORT_MINIMAL_BUILD)
 
 void Model::RemoveLocalFunctionsProtos(const InlinedHashSet<std::string>& retained) {
-  auto* local_functions = model_proto_.mutable_functions();
+  auto* local_functions = model_proto_->mutable_functions();
   if (retained.empty()) {
     model_local_function_templates_maps_.clear();
     model_local_functions_.clear();
@@ -82,11 +84,13 @@ Model::Model(const std::string& graph_name,
              const logging::Logger& logger,
              const ModelOptions& options)
     : model_path_(Path::Parse(model_path)) {
-  model_proto_.set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
-  model_proto_.mutable_graph()->set_name(graph_name);
+  model_proto_owned_ = std::make_unique<ModelProto>();
+  model_proto_ = model_proto_owned_.get();
+  model_proto_->set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
+  model_proto_->mutable_graph()->set_name(graph_name);
   model_metadata_ = model_metadata;
   for (auto& metadata : model_metadata_) {
-    const gsl::not_null<StringStringEntryProto*> prop{model_proto_.add_metadata_props()};
+    const gsl::not_null<StringStringEntryProto*> prop{model_proto_->add_metadata_props()};
     prop->set_key(metadata.first);
     prop->set_value(metadata.second);
   }
@@ -115,21 +119,21 @@ Model::Model(const std::string& graph_name,
   for (const auto& [domain, version] : *p_domain_to_version) {
     model_load_utils::ValidateOpsetForDomain(domain_to_version_static, logger, allow_released_opsets_only_final,
                                              domain, version);
-    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_.add_opset_import()};
+    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_->add_opset_import()};
     opset_id_proto->set_domain(domain);
     opset_id_proto->set_version(version);
   }
 
   model_local_functions_.reserve(model_local_functions.size());
   for (auto& func : model_local_functions) {
-    auto func_ptr = model_proto_.add_functions();
+    auto func_ptr = model_proto_->add_functions();
     func_ptr->CopyFrom(func);
     model_local_functions_.insert_or_assign(function_utils::GetFunctionIdentifier(func_ptr->domain(), func_ptr->name()),
                                             func_ptr);
   }
 
-  model_local_function_templates_maps_.reserve(model_proto_.functions().size());
-  for (auto& func : model_proto_.functions()) {
+  model_local_function_templates_maps_.reserve(model_proto_->functions().size());
+  for (auto& func : model_proto_->functions()) {
     auto func_schema_ptr = function_utils::CreateSchema(func.domain(),
                                                         func.name(),
                                                         model_local_functions_,
@@ -146,7 +150,7 @@ Model::Model(const std::string& graph_name,
 
   // need to call private ctor so can't use make_shared
   GSL_SUPPRESS(r.11)
-  graph_.reset(new Graph(*this, model_proto_.mutable_graph(), *p_domain_to_version, IrVersion(), schema_registry,
+  graph_.reset(new Graph(*this, model_proto_->mutable_graph(), *p_domain_to_version, IrVersion(), schema_registry,
                          logger, options.strict_shape_type_inference));
 }
 
@@ -160,28 +164,46 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
              const IOnnxRuntimeOpSchemaRegistryList* local_registries,
              const logging::Logger& logger, const ModelOptions& options)
     : model_path_(Path::Parse(model_path)) {
-  if (!utils::HasGraph(model_proto)) {
+  model_proto_owned_ = std::make_unique<ModelProto>(std::move(model_proto));
+  model_proto_ = model_proto_owned_.get();
+  InitializeFromModelProto(local_registries, logger, options);
+}
+
+Model::Model(std::unique_ptr<google::protobuf::Arena> arena, ModelProto* model_proto, const PathString& model_path,
+             const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+             const logging::Logger& logger, const ModelOptions& options)
+    : model_path_(Path::Parse(model_path)) {
+  ORT_ENFORCE(arena != nullptr && model_proto != nullptr &&
+                  model_proto->GetArena() == arena.get(),
+              "The ModelProto must be allocated on the provided arena.");
+  model_proto_arena_ = std::move(arena);
+  model_proto_ = model_proto;
+  InitializeFromModelProto(local_registries, logger, options);
+}
+
+void Model::InitializeFromModelProto(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                                     const logging::Logger& logger, const ModelOptions& options) {
+  if (!utils::HasGraph(*model_proto_)) {
     ORT_THROW("ModelProto does not have a graph.");
   }
 
-  if (model_proto.opset_import_size() == 0) {
+  if (model_proto_->opset_import_size() == 0) {
     ORT_THROW(
         "Missing opset in the model. All ModelProtos MUST have at least one entry that"
         " specifies which version of the ONNX OperatorSet is being imported.");
   }
 
-  if (!model_proto.has_ir_version()) {
+  if (!model_proto_->has_ir_version()) {
     ORT_THROW("Missing model IR version.");
   }
 
-  if (const auto ir_version = model_proto.ir_version();
+  if (const auto ir_version = model_proto_->ir_version();
       ir_version > ONNX_NAMESPACE::Version::IR_VERSION) {
     ORT_THROW("Unsupported model IR version: ", ir_version,
               ", max supported IR version: ", ONNX_NAMESPACE::Version::IR_VERSION);
   }
 
-  model_proto_ = std::move(model_proto);
-  for (auto& prop : model_proto_.metadata_props()) {
+  for (auto& prop : model_proto_->metadata_props()) {
     model_metadata_[prop.key()] = prop.value();
   }
 
@@ -203,7 +225,7 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
       schema_registry->GetLastReleasedOpsetVersions(false);
 
   std::unordered_map<std::string, int> domain_to_version;
-  for (auto& opSet : model_proto_.opset_import()) {
+  for (auto& opSet : model_proto_->opset_import()) {
     const auto& domain = opSet.domain();
     const auto version = gsl::narrow_cast<int>(opSet.version());
     // empty domain and 'ai.onnx' are equivalent
@@ -246,19 +268,19 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
   for (const auto& [domain, version] : domain_map) {
     if (domain_to_version.find(domain) == domain_to_version.end()) {
       domain_to_version[domain] = version;
-      const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_.add_opset_import()};
+      const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_->add_opset_import()};
       opset_id_proto->set_domain(domain);
       opset_id_proto->set_version(version);
     }
   }
 
-  model_local_functions_.reserve(model_proto_.functions().size());
-  for (auto& func : model_proto_.functions()) {
+  model_local_functions_.reserve(model_proto_->functions().size());
+  for (auto& func : model_proto_->functions()) {
     model_local_functions_.insert_or_assign(function_utils::GetFunctionIdentifier(func.domain(), func.name()), &func);
   }
 
-  model_local_function_templates_maps_.reserve(model_proto_.functions().size());
-  for (auto& func : model_proto_.functions()) {
+  model_local_function_templates_maps_.reserve(model_proto_->functions().size());
+  for (auto& func : model_proto_->functions()) {
     auto func_schema_ptr = function_utils::CreateSchema(func.domain(),
                                                         func.name(),
                                                         model_local_functions_,
@@ -274,7 +296,7 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
 
   // create instance. need to call private ctor so can't use make_unique
   GSL_SUPPRESS(r.11)
-  graph_.reset(new Graph(*this, model_proto_.mutable_graph(), domain_to_version, IrVersion(), schema_registry,
+  graph_.reset(new Graph(*this, model_proto_->mutable_graph(), domain_to_version, IrVersion(), schema_registry,
                          logger, options.strict_shape_type_inference));
 }
 
@@ -283,70 +305,70 @@ const NodeHashMap<std::string, std::unique_ptr<FunctionTemplate>>& Model::GetMod
 }
 
 Version Model::IrVersion() const {
-  if (utils::HasIrVersion(model_proto_)) {
-    return model_proto_.ir_version();
+  if (utils::HasIrVersion(*model_proto_)) {
+    return model_proto_->ir_version();
   }
   return kNoVersion;
 }
 
 const std::string Model::ProducerName() const {
-  if (model_proto_.has_producer_name()) {
-    return model_proto_.producer_name();
+  if (model_proto_->has_producer_name()) {
+    return model_proto_->producer_name();
   }
   return std::string();
 }
 
 void Model::SetProducerName(const std::string& producer_name) {
-  model_proto_.set_producer_name(producer_name);
+  model_proto_->set_producer_name(producer_name);
 }
 
 const std::string Model::ProducerVersion() const {
-  if (model_proto_.has_producer_version()) {
-    return model_proto_.producer_version();
+  if (model_proto_->has_producer_version()) {
+    return model_proto_->producer_version();
   }
   return std::string();
 }
 
 void Model::SetProducerVersion(const std::string& producer_version) {
-  model_proto_.set_producer_version(producer_version);
+  model_proto_->set_producer_version(producer_version);
 }
 
 const std::string Model::Domain() const {
-  if (model_proto_.has_domain()) {
-    return model_proto_.domain();
+  if (model_proto_->has_domain()) {
+    return model_proto_->domain();
   }
   return std::string();
 }
 
 void Model::SetDomain(const std::string& domain) {
-  model_proto_.set_domain(domain);
+  model_proto_->set_domain(domain);
 }
 
 Version Model::ModelVersion() const {
-  if (utils::HasModelVersion(model_proto_)) {
-    return model_proto_.model_version();
+  if (utils::HasModelVersion(*model_proto_)) {
+    return model_proto_->model_version();
   }
   return kNoVersion;
 }
 
 void Model::SetModelVersion(onnxruntime::Version version) {
-  model_proto_.set_model_version(version);
+  model_proto_->set_model_version(version);
 }
 
 const std::string Model::DocString() const {
-  if (model_proto_.has_doc_string()) {
-    return model_proto_.doc_string();
+  if (model_proto_->has_doc_string()) {
+    return model_proto_->doc_string();
   }
   return std::string();
 }
 
 void Model::SetDocString(const std::string& doc_string) {
-  model_proto_.set_doc_string(doc_string);
+  model_proto_->set_doc_string(doc_string);
 }
 
 const std::string Model::GraphDocString() const {
-  if (model_proto_.has_graph() && model_proto_.graph().has_doc_string()) {
-    return model_proto_.graph().doc_string();
+  if (model_proto_->has_graph() && model_proto_->graph().has_doc_string()) {
+    return model_proto_->graph().doc_string();
   }
   return std::string();
 }
@@ -372,7 +394,7 @@ ModelProto Model::ToProto() const {
   // that returns by value and, therefore, allows us to filter
   // out dense duplicates of sparse initializers and leave the original
   // proto intact.
-  ModelProto result(model_proto_);
+  ModelProto result(*model_proto_);
   const auto& graph = *graph_;
   *(result.mutable_graph()) = graph.ToGraphProto();
   return result;
@@ -381,7 +403,7 @@ ModelProto Model::ToProto() const {
 ModelProto Model::ToGraphProtoWithExternalInitializers(const std::string& external_file_name,
                                                        const PathString& file_path,
                                                        size_t initializer_size_threshold) const {
-  ModelProto result(model_proto_);
+  ModelProto result(*model_proto_);
   const auto& graph = *graph_;
   *(result.mutable_graph()) = graph.ToGraphProtoWithExternalInitializers(external_file_name,
                                                                          file_path,
@@ -440,6 +462,7 @@ Status Model::Load(const ModelProto& model_proto,
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.shape_inference_thread_pool = options.shape_inference_thread_pool;
   ORT_RETURN_IF_ERROR(model->MainGraph().Resolve(resolve_options));
 
   return status;
@@ -479,6 +502,7 @@ Status Model::Load(ModelProto&& model_proto,
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.shape_inference_thread_pool = options.shape_inference_thread_pool;
   ORT_RETURN_IF_ERROR(model->MainGraph().Resolve(resolve_options));
 
   return status;
@@ -666,17 +690,29 @@ Status Model::LoadFromBytes(int count, void* p_bytes, /*out*/ std::shared_ptr<Mo
 Status Model::LoadFromBytes(int count, void* p_bytes, const PathString& model_path,
                             std::shared_ptr<Model>& p_model, const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                             const logging::Logger& logger, const ModelOptions& options) {
-  ModelProto model_proto;
+  if (options.parse_into_protobuf_arena) {
+    // parsing into an arena turns the millions of small sub-message allocations a large graph
+    // produces into bump-pointer allocations; the arena is handed to the Model and released
+    // wholesale when the Model goes away
+    auto arena = std::make_unique<google::protobuf::Arena>();
+    auto* arena_model_proto = google::protobuf::Arena::CreateMessage<ModelProto>(arena.get());
+    ORT_RETURN_IF_ERROR(LoadFromBytes(count, p_bytes, *arena_model_proto));
+    p_model = std::make_shared<Model>(std::move(arena), arena_model_proto, model_path, local_registries, logger,
+                                      options);
+  } else {
+    ModelProto model_proto;
 
-  auto status = LoadFromBytes(count, p_bytes, model_proto);
-  if (!status.IsOK()) {
-    return status;
-  }
+    auto status = LoadFromBytes(count, p_bytes, model_proto);
+    if (!status.IsOK()) {
+      return status;
+    }
 
-  p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger, options);
+    p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger, options);
+  }
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.shape_inference_thread_pool = options.shape_inference_thread_pool;
   ORT_RETURN_IF_ERROR(p_model->MainGraph().Resolve(resolve_options));
 
   return Status::OK();
@@ -728,14 +764,24 @@ Status Model::Load(int fd, std::shared_ptr<Model>& p_model, const IOnnxRuntimeOp
 Status Model::Load(int fd, const PathString& model_path, std::shared_ptr<Model>& p_model,
                    const IOnnxRuntimeOpSchemaRegistryList* local_registries, const logging::Logger& logger,
                    const ModelOptions& options) {
-  ModelProto model_proto;
+  if (options.parse_into_protobuf_arena) {
+    // see Model::LoadFromBytes for the rationale behind the arena-allocated parsing mode
+    auto arena = std::make_unique<google::protobuf::Arena>();
+    auto* arena_model_proto = google::protobuf::Arena::CreateMessage<ModelProto>(arena.get());
+    ORT_RETURN_IF_ERROR(Load(fd, *arena_model_proto));
+    p_model = std::make_shared<Model>(std::move(arena), arena_model_proto, model_path, local_registries, logger,
+                                      options);
+  } else {
+    ModelProto model_proto;
 
-  ORT_RETURN_IF_ERROR(Load(fd, model_proto));
+    ORT_RETURN_IF_ERROR(Load(fd, model_proto));
 
-  p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger, options);
+    p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger, options);
+  }
 
   Graph::ResolveOptions resolve_options;
   resolve_options.no_proto_sync_required = true;
+  resolve_options.shape_inference_thread_pool = options.shape_inference_thread_pool;
   ORT_RETURN_IF_ERROR(p_model->MainGraph().Resolve(resolve_options));
 
   return Status::OK();
@@ -780,18 +826,18 @@ Status Model::SaveWithExternalInitializers(Model& model,
 common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
                                       flatbuffers::Offset<fbs::Model>& fbs_model) const {
   auto producer_name = fbs::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_producer_name(), model_proto_.producer_name());
+      builder, model_proto_->has_producer_name(), model_proto_->producer_name());
   auto producer_version = fbs::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_producer_version(), model_proto_.producer_version());
-  auto domain = builder.CreateSharedString(model_proto_.domain());
+      builder, model_proto_->has_producer_version(), model_proto_->producer_version());
+  auto domain = builder.CreateSharedString(model_proto_->domain());
   auto doc_string = fbs::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_doc_string(), model_proto_.doc_string());
+      builder, model_proto_->has_doc_string(), model_proto_->doc_string());
   auto graph_doc_string = fbs::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_graph() && model_proto_.graph().has_doc_string(), model_proto_.graph().doc_string());
+      builder, model_proto_->has_graph() && model_proto_->graph().has_doc_string(), model_proto_->graph().doc_string());
 
   std::vector<flatbuffers::Offset<fbs::OperatorSetId>> op_set_ids_vec;
-  op_set_ids_vec.reserve(model_proto_.opset_import().size());
-  for (const auto& entry : model_proto_.opset_import()) {
+  op_set_ids_vec.reserve(model_proto_->opset_import().size());
+  for (const auto& entry : model_proto_->opset_import()) {
     auto op_set_domain = builder.CreateSharedString(entry.domain());
     fbs::OperatorSetIdBuilder ob(builder);
     ob.add_domain(op_set_domain);
@@ -839,8 +885,14 @@ common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 Model::Model() : model_path_{} {
+#if !defined(ORT_MINIMAL_BUILD)
+  model_proto_owned_ = std::make_unique<ModelProto>();
+  model_proto_ = model_proto_owned_.get();
+#endif
 }
 
+Model::~Model() = default;
+
 common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
 #if !defined(ORT_MINIMAL_BUILD)
                                         const IOnnxRuntimeOpSchemaRegistryList* local_registries,
@@ -863,15 +915,15 @@ common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
   }
 
 #if !defined(ORT_MINIMAL_BUILD)
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, producer_name, fbs_model.producer_name());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, producer_version, fbs_model.producer_version());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, domain, fbs_model.domain());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, doc_string, fbs_model.doc_string());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), producer_name, fbs_model.producer_name());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), producer_version, fbs_model.producer_version());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), domain, fbs_model.domain());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), doc_string, fbs_model.doc_string());
   if (fbs_model.graph_doc_string()) {
-    model->model_proto_.mutable_graph()->set_doc_string(fbs_model.graph_doc_string()->c_str());
+    model->model_proto_->mutable_graph()->set_doc_string(fbs_model.graph_doc_string()->c_str());
   }
-  model->model_proto_.set_model_version(fbs_model.model_version());
-  model->model_proto_.set_ir_version(fbs_model.ir_version());
+  model->model_proto_->set_model_version(fbs_model.model_version());
+  model->model_proto_->set_ir_version(fbs_model.ir_version());
 
   auto schema_registry = std::make_shared<SchemaRegistryManager>();
   if (local_registries != nullptr) {
@@ -882,7 +934,7 @@ common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
 
   // Populate the metadata to model_proto
   for (auto& metadata : model->model_metadata_) {
-    const gsl::not_null<StringStringEntryProto*> prop{model->model_proto_.add_metadata_props()};
+    const gsl::not_null<StringStringEntryProto*> prop{model->model_proto_->add_metadata_props()};
     prop->set_key(metadata.first);
     prop->set_value(metadata.second);
   }
@@ -906,7 +958,7 @@ common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
   // add the opset imports to the model_proto in case we're updating an ORT format model and need those to be
   // included when SaveToOrtFormat is called later
   for (const auto& [domain, version] : domain_to_version) {
-    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model->model_proto_.add_opset_import()};
+    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model->model_proto_->add_opset_import()};
     opset_id_proto->set_domain(domain);
     opset_id_proto->set_version(version);
   }
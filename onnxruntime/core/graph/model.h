@@ -28,6 +28,12 @@ typedef std::unordered_map<std::string, std::string> ModelMetaData;
 using IOnnxRuntimeOpSchemaRegistryList = std::list<std::shared_ptr<IOnnxRuntimeOpSchemaCollection>>;
 
 // Options to configure Model.
+namespace google {
+namespace protobuf {
+class Arena;
+}
+}  // namespace google
+
 struct ModelOptions {
   bool allow_released_opsets_only;
   // If true, all inconsistencies encountered during shape and type inference
@@ -35,10 +41,21 @@ struct ModelOptions {
   // warnings will be logged but processing will continue and no error will
   // be returned.
   bool strict_shape_type_inference;
-
-  ModelOptions(bool allow_released_opsets_only, bool strict_shape_type_inference)
+  // Optional thread pool forwarded to Graph::Resolve so that type/shape inference of
+  // independent nodes can run concurrently. Resolve stays single threaded when nullptr.
+  concurrency::ThreadPool* shape_inference_thread_pool;
+  // If true, the ModelProto is parsed into a protobuf arena owned by the Model instead of
+  // the default heap allocation. Large graphs produce millions of small sub-message
+  // allocations; the arena replaces them with bump-pointer allocation and a single release.
+  bool parse_into_protobuf_arena;
+
+  ModelOptions(bool allow_released_opsets_only, bool strict_shape_type_inference,
+               concurrency::ThreadPool* shape_inference_thread_pool = nullptr,
+               bool parse_into_protobuf_arena = false)
       : allow_released_opsets_only(allow_released_opsets_only),
-        strict_shape_type_inference(strict_shape_type_inference) {}
+        strict_shape_type_inference(strict_shape_type_inference),
+        shape_inference_thread_pool(shape_inference_thread_pool),
+        parse_into_protobuf_arena(parse_into_protobuf_arena) {}
 
   ModelOptions() : ModelOptions(true, false) {}
 };
@@ -98,6 +115,14 @@ class Model {
                  const logging::Logger& logger,
                  const ModelOptions& options = {});
 
+  // NOTE: after calling this constructor, <*this> model owns the arena, which in turn owns
+  // <model_proto> and all of its sub-messages. <model_proto> must have been allocated on <arena>.
+  Model(std::unique_ptr<google::protobuf::Arena> arena, ONNX_NAMESPACE::ModelProto* model_proto,
+        const PathString& model_path,
+        const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+        const logging::Logger& logger,
+        const ModelOptions& options = {});
+
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -301,10 +326,25 @@ class Model {
 
   Model();
 
+  ~Model();
+
  private:
+#if !defined(ORT_MINIMAL_BUILD)
+  // Shared tail of the ModelProto based constructors. Validates and takes over model_proto_,
+  // which must already be set up along with its owning member.
+  void InitializeFromModelProto(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                                const logging::Logger& logger, const ModelOptions& options);
+#endif
+
   // Model data.
 #if !defined(ORT_MINIMAL_BUILD)
-  ONNX_NAMESPACE::ModelProto model_proto_;
+  // Exactly one of the following two members owns model_proto_:
+  // model_proto_arena_ when the proto was parsed into a protobuf arena (the arena also owns all
+  // sub-messages, so it has to outlive graph_ which aliases the contained GraphProto), or
+  // model_proto_owned_ for default heap allocation.
+  std::unique_ptr<google::protobuf::Arena> model_proto_arena_;
+  std::unique_ptr<ONNX_NAMESPACE::ModelProto> model_proto_owned_;
+  ONNX_NAMESPACE::ModelProto* model_proto_ = nullptr;
   // map from function id to pointer of model local function proto
   // FunctionProto is hosted in ModelProto.
   // this map will be used for the local functions' schema's type/shape inference.
@@ -6,6 +6,15 @@
 namespace onnxruntime {
 
 /// Options to configure how an ORT format model is loaded.
+///
+/// Note: subgraphs of control flow nodes (If/Loop/Scan bodies) are always deserialized eagerly.
+/// Deferring them until first execution has been considered and rejected: the kernels for control
+/// flow nodes build the session state for every body graph during session initialization
+/// (SessionState::FinalizeSessionState -> SetupSubgraphExecutionInfo), so each subgraph has to be
+/// materialized before the first Run() call anyway. The memory cost of rarely executed branches is
+/// instead addressed by can_use_flatbuffer_for_initializers below and the
+/// "session.use_ort_model_bytes_for_initializers" session config, which keep initializer data in
+/// the flatbuffer rather than copying it per subgraph.
 struct OrtFormatLoadOptions {
   /// If true, set initializer TensorProtos to point to memory in the flatbuffer instead of copying data.
   /// This requires the flatbuffer to remain valid for the entire duration of the InferenceSession.
@@ -21,6 +21,8 @@ Abstract:
 #include <cstdlib>
 #include <cstdint>
 
+#include "mlas_gemm_postprocessor.h"
+
 //
 // Define the calling convention for Windows targets.
 //
@@ -133,6 +135,20 @@ MlasGetPreferredBufferAlignment(
     void
     );
 
+/**
+ * @brief Probes a small set of SGEMM blocking configurations on the running
+ *        machine and installs the fastest into the platform support structure.
+ *
+ * The probe runs once per process (subsequent calls return immediately) and
+ * costs a few milliseconds. Intended to be called during application
+ * initialization, before heavy SGEMM traffic.
+ */
+void
+MLASCALL
+MlasSgemmTune(
+    void
+    );
+
 #ifdef MLAS_TARGET_AMD64_IX86
 
 /**
@@ -199,6 +215,34 @@ MlasActivation(
 // op(X) = X or op(X) = transpose(X) or op(X) = conjg(transpose(X))
 //
 
+/**
+ * @brief Single precision activation epilogue, with optional sum tensor.
+ * Supplied sum tensor must be the same layout as the GEMM output tensor.
+ * And the supplied sum tensor will be added to the tensor before activation.
+ */
+class MLAS_SGEMM_ACTIVATION_PROCESSOR : public MLAS_GEMM_POSTPROCESSOR<float>
+{
+  public:
+    MLAS_SGEMM_ACTIVATION_PROCESSOR(
+        const MLAS_ACTIVATION& Activation,
+        const float* SumBuf = nullptr)
+       : Activation_(Activation), SumBuf_(SumBuf)
+    {}
+
+    void Process(
+        float* C,
+        size_t StartM,
+        size_t StartN,
+        size_t CountM,
+        size_t CountN,
+        size_t ldc
+        ) const override;
+
+  private:
+    const MLAS_ACTIVATION& Activation_;
+    const float* SumBuf_;
+};
+
 /**
  * @brief Supply matrices data information to single precision gemm functions
  */
@@ -212,6 +256,9 @@ struct MLAS_SGEMM_DATA_PARAMS {
     float alpha = 1.0f;       /**< Supplies the scalar alpha multiplier (see SGEMM definition) */
     float beta = 0.0f;        /**< Supplies the scalar beta multiplier (see SGEMM definition) */
     bool BIsPacked = false;   /**< Whether B is pre-packed */
+    const MLAS_GEMM_POSTPROCESSOR<float>* OutputProcessor = nullptr; /**< Optional epilogue applied
+                                                                          per tile while the output
+                                                                          is still cache resident */
 };
 
 /**
@@ -754,6 +801,7 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
+    MlasConvAlgorithmWinograd,
 #if defined(MLAS_TARGET_WASM_SCALAR)
     MlasConvAlgorithmDepthwise,
 #endif
@@ -786,6 +834,10 @@ struct MLAS_CONV_PARAMETERS {
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
+        struct {
+            size_t TileCountH;
+            size_t TileCountW;
+        } Winograd;
     } u;
 };
 
@@ -807,6 +859,21 @@ MlasConvPrepare(MLAS_CONV_PARAMETERS* Parameters,
                 float Beta,
                 MLAS_THREADPOOL* ThreadPool);
 
+//
+// Switches a prepared convolution to the Winograd F(2x2,3x3) algorithm when the
+// convolution parameters qualify (3x3 kernel, unit strides and dilations, enough
+// channels and filters to amortize the transforms). Returns true and updates the
+// working buffer size on success. The Winograd result is not bit-identical to the
+// GEMM based algorithms because the reduction is reassociated, so callers opt in.
+//
+
+bool
+MLASCALL
+MlasConvTryUseWinograd(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize
+    );
+
 void
 MLASCALL
 MlasConv(
@@ -1024,6 +1091,54 @@ MlasComputeTanh(
     size_t N
     );
 
+//
+// Finds the maximum value of a buffer. The result for a buffer containing
+// NaN elements is unspecified.
+//
+
+float
+MLASCALL
+MlasReduceMaximum(
+    const float* Input,
+    size_t N
+    );
+
+//
+// Single precision flash attention routine.
+//
+// The query, key and value tensors use a BxNxSxH layout and the output
+// tensor uses a BxSxNxH_v layout. The caller supplies a scratch buffer of
+// BufferSizePerThread bytes for each of ThreadCount threads, where each
+// thread requires (QBlockSize * KVBlockSize + QBlockSize * VHeadSize +
+// 2 * QBlockSize) float elements.
+//
+
+struct MLAS_FLASH_ATTENTION_THREADED_ARGS {
+    int BatchSize;
+    int NumHeads;
+    int QSequenceLength;
+    int KVSequenceLength;
+    int QKHeadSize;
+    int VHeadSize;
+    int QBlockSize;
+    int KVBlockSize;
+    float Scale;
+    int ThreadCount;
+    float* Buffer;
+    size_t BufferSizePerThread;
+    const float* Query;
+    const float* Key;
+    const float* Value;
+    float* Output;
+};
+
+void
+MLASCALL
+MlasFlashAttention(
+    MLAS_FLASH_ATTENTION_THREADED_ARGS* Args,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Half-precision floating-point routines.
 //
@@ -1086,6 +1201,61 @@ MlasTranspose(
     size_t N
     );
 
+//
+// Transpose routines that partition the work over a thread pool. The result is
+// identical to the single-threaded overloads above.
+//
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const int8_t* Input,
+    int8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Buffer reordering routines.
 //
@@ -1242,6 +1412,17 @@ MlasQuantizeLinearS4(
     int8_t ZeroPoint
     );
 
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    );
+
 /**
  * @brief Requantize a block of the intermediate buffer to the output buffer,
  *        optionally adding the supplied bias
@@ -1634,7 +1815,7 @@ MlasHalfGemmConvertPackB(
     void* PackedB
     );
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
 /**
  * @brief Whether current CPU supports Bfloat16(bf16) acceleration.
  */
@@ -17,6 +17,9 @@ Abstract:
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
+
 template<typename T>
 class MLAS_GEMM_POSTPROCESSOR
 {
@@ -31,3 +34,40 @@ class MLAS_GEMM_POSTPROCESSOR
 
     virtual ~MLAS_GEMM_POSTPROCESSOR() {}
 };
+
+/**
+ * @brief A postprocessor composed of several other postprocessors.
+ *
+ * The appended postprocessors run in order against each output tile, so a
+ * residual addition, an activation and a precision conversion can all be
+ * applied during the single pass the GEMM already makes over the output.
+ */
+template<typename T>
+class MLAS_GEMM_EPILOGUE_CHAIN : public MLAS_GEMM_POSTPROCESSOR<T>
+{
+   public:
+    void Append(const MLAS_GEMM_POSTPROCESSOR<T>* Postprocessor)
+    {
+        assert(Count_ < MaximumPostprocessorCount);
+        Postprocessors_[Count_++] = Postprocessor;
+    }
+
+    void Process(T* C,
+                 size_t RangeStartM,
+                 size_t RangeStartN,
+                 size_t RangeCountM,
+                 size_t RangeCountN,
+                 size_t ldc
+    ) const override
+    {
+        for (size_t i = 0; i < Count_; i++) {
+            Postprocessors_[i]->Process(C, RangeStartM, RangeStartN, RangeCountM, RangeCountN, ldc);
+        }
+    }
+
+   private:
+    static constexpr size_t MaximumPostprocessorCount = 4;
+
+    const MLAS_GEMM_POSTPROCESSOR<T>* Postprocessors_[MaximumPostprocessorCount] = {};
+    size_t Count_ = 0;
+};
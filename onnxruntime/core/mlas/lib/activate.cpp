@@ -519,3 +519,79 @@ Return Value:
         }
     }
 }
+
+void
+MLAS_SGEMM_ACTIVATION_PROCESSOR::Process(
+    float* C,
+    size_t StartM,
+    size_t StartN,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc
+    ) const
+/*++
+
+Routine Description:
+
+    This routine runs the activation epilogue over a completed tile of the
+    SGEMM output matrix, optionally adding the supplied sum tensor first.
+
+Arguments:
+
+    C - Supplies the address of the output matrix.
+
+    StartM - Supplies the starting row index of the tile.
+
+    StartN - Supplies the starting column index of the tile.
+
+    CountM - Supplies the number of rows of the tile.
+
+    CountN - Supplies the number of columns of the tile.
+
+    ldc - Supplies the number of elements per row of the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    float* Tile = C + StartM * ldc + StartN;
+
+    if (SumBuf_ != nullptr) {
+
+        const float* SumRow = SumBuf_ + StartM * ldc + StartN;
+        float* Row = Tile;
+
+        for (size_t m = 0; m < CountM; m++) {
+
+            float* buffer = Row;
+            const float* sum = SumRow;
+            size_t n = CountN;
+
+            while (n >= 4) {
+                MlasStoreFloat32x4(buffer, MlasAddFloat32x4(MlasLoadFloat32x4(buffer),
+                    MlasLoadFloat32x4(sum)));
+                buffer += 4;
+                sum += 4;
+                n -= 4;
+            }
+
+            while (n > 0) {
+                *buffer++ += *sum++;
+                n -= 1;
+            }
+
+            Row += ldc;
+            SumRow += ldc;
+        }
+    }
+
+    //
+    // N.B. MlasActivation treats the bias vector as spanning the rows of the
+    // matrix, which does not match the per-tile view here, so the bias must
+    // have been applied by the caller already.
+    //
+
+    MlasActivation(&Activation_, Tile, nullptr, CountM, CountN, ldc);
+}
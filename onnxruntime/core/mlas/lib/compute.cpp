@@ -805,6 +805,166 @@ Return Value:
     }
 }
 
+float
+MLASCALL
+MlasComputeSumExpOnlineF32Kernel(
+    const float* Input,
+    size_t N,
+    float* NegativeMaximum
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the maximum value and the sum of the exponential
+    functions for a row in a single pass using the online normalizer scheme:
+    the partial sums are rescaled whenever the running maximum advances, which
+    avoids the separate maximum reduction pass over the input buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    N - Supplies the number of elements to process.
+
+    NegativeMaximum - Supplies the address to store the negative of the
+        maximum value of the row.
+
+Return Value:
+
+    Returns the sum of the exponential functions.
+
+--*/
+{
+    float Maximum = std::numeric_limits<float>::lowest();
+    float Accumulation = 0.0f;
+
+    if (N >= 4) {
+
+        const MLAS_FLOAT32X4 ZeroVector = MlasZeroFloat32x4();
+        MLAS_FLOAT32X4 MaximumVector = MlasBroadcastFloat32x4(Maximum);
+        MLAS_FLOAT32X4 AccumulatorVector = ZeroVector;
+
+        while (N >= 4) {
+
+            MLAS_FLOAT32X4 Vector = MlasLoadFloat32x4(Input);
+            MLAS_FLOAT32X4 NewMaximumVector = MlasMaximumFloat32x4(MaximumVector, Vector);
+            MLAS_FLOAT32X4 NegativeNewMaximumVector = MlasSubtractFloat32x4(ZeroVector, NewMaximumVector);
+
+            //
+            // Rescale the accumulation to the new running maximum and add the
+            // exponentials of the current block.
+            //
+
+            AccumulatorVector = MlasMultiplyAddFloat32x4(AccumulatorVector,
+                MlasComputeSumExpVector(MaximumVector, NegativeNewMaximumVector),
+                MlasComputeSumExpVector(Vector, NegativeNewMaximumVector));
+            MaximumVector = NewMaximumVector;
+
+            Input += 4;
+            N -= 4;
+        }
+
+        //
+        // Reduce the per-lane running maximums to the row maximum and rescale
+        // each lane of the accumulation to it.
+        //
+
+        Maximum = MlasReduceMaximumFloat32x4(MaximumVector);
+        AccumulatorVector = MlasMultiplyFloat32x4(AccumulatorVector,
+            MlasComputeSumExpVector(MaximumVector, MlasBroadcastFloat32x4(-Maximum)));
+        Accumulation = MlasReduceAddFloat32x4(AccumulatorVector);
+    }
+
+    while (N > 0) {
+
+        float NewMaximum = std::max(Maximum, *Input);
+        MLAS_FLOAT32X4 NegativeNewMaximumVector = MlasBroadcastFloat32x4(-NewMaximum);
+
+        MLAS_FLOAT32X4 Rescaled = MlasMultiplyAddFloat32x4(MlasBroadcastFloat32x4(Accumulation),
+            MlasComputeSumExpVector(MlasBroadcastFloat32x4(Maximum), NegativeNewMaximumVector),
+            MlasComputeSumExpVector(MlasBroadcastFloat32x4(*Input), NegativeNewMaximumVector));
+        Accumulation = MlasExtractLaneFloat32x4<0>(Rescaled);
+        Maximum = NewMaximum;
+
+        Input += 1;
+        N -= 1;
+    }
+
+    *NegativeMaximum = -Maximum;
+
+    return Accumulation;
+}
+
+void
+MLASCALL
+MlasComputeScaledSumExpF32Kernel(
+    const float* Input,
+    float* Output,
+    size_t N,
+    const float* Parameters
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the generic kernel to produce the final output for
+    the softmax operation when the sum of the exponential functions is already
+    known: the exponentials are computed and scaled into the output buffer in
+    a single pass instead of storing the intermediate exp() results and
+    normalizing them with a second pass.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Parameters - Supplies an array containing the negative maximum and
+        scale values.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_FLOAT32X4 NegativeMaximumVector = MlasBroadcastFloat32x4(Parameters[0]);
+    const MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Parameters[1]);
+
+    while (N >= 4) {
+
+        MLAS_FLOAT32X4 Vector = MlasComputeSumExpVector(MlasLoadFloat32x4(Input), NegativeMaximumVector);
+        MlasStoreFloat32x4(Output, MlasMultiplyFloat32x4(ScaleVector, Vector));
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    while (N > 0) {
+
+#if defined(MLAS_SSE2_INTRINSICS)
+        // N.B. SSE2 lacks a broadcast load instruction, so avoid a shuffle and
+        // use zeroes for the upper elements.
+        MLAS_FLOAT32X4 Vector = _mm_load_ss(Input);
+#elif defined(MLAS_LSX_INTRINSICS)
+        MLAS_FLOAT32X4 Vector = (MLAS_FLOAT32X4)__lsx_vldrepl_w(Input, 0);
+#else
+        MLAS_FLOAT32X4 Vector = MlasBroadcastFloat32x4(Input);
+#endif
+
+        Vector = MlasComputeSumExpVector(Vector, NegativeMaximumVector);
+        MlasStoreLaneFloat32x4<0>(Output, MlasMultiplyFloat32x4(ScaleVector, Vector));
+
+        Input += 1;
+        Output += 1;
+        N -= 1;
+    }
+}
+
 void
 MlasComputeSoftmaxThreaded(
     void* Context,
@@ -868,6 +1028,48 @@ Return Value:
         }
 #endif
 
+#if !defined(MLAS_TARGET_AMD64) && !defined(MLAS_TARGET_LARCH64)
+
+        //
+        // Rows at least this wide no longer fit in the fastest cache levels,
+        // so refetching the row for a separate maximum pass costs a full trip
+        // through the cache hierarchy. Compute the maximum and the sum of the
+        // exponential functions in a single online pass instead and produce
+        // the output with a second pass, for two passes over the row in total.
+        //
+        // N.B. The AMD64 and LoongArch builds keep the separate passes as
+        // their platform kernels process the row with wider vectors than the
+        // portable online kernel.
+        //
+
+        constexpr size_t MinimumOnlineColumns = 4096;
+
+        if (D >= MinimumOnlineColumns) {
+
+            float NegativeMaximum;
+            float Accumulation = MlasComputeSumExpOnlineF32Kernel(Input, D, &NegativeMaximum);
+
+            if (LogSoftmax) {
+
+                float Parameters[] = { NegativeMaximum, std::log(Accumulation) };
+
+                MlasComputeLogSoftmaxOutputF32Kernel(Input, Output, D, Parameters);
+
+            } else {
+
+                float Parameters[] = { NegativeMaximum, 1.0f / Accumulation };
+
+                MlasComputeScaledSumExpF32Kernel(Input, Output, D, Parameters);
+            }
+
+            Input += D;
+            Output += D;
+            CountN--;
+            continue;
+        }
+
+#endif
+
         //
         // Find the maximum value for the row.
         //
@@ -1012,3 +1214,38 @@ Return Value:
 
     MlasExecuteThreaded(MlasComputeSoftmaxThreaded, &WorkBlock, ThreadCountN, ThreadPool);
 }
+
+float
+MLASCALL
+MlasReduceMaximum(
+    const float* Input,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine finds the maximum value of the supplied buffer using the
+    platform reduction kernel.
+
+    N.B. NaN elements are not handled specially: the result for a buffer
+    containing NaNs is unspecified, matching the internal softmax usage.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    Returns the maximum value of the supplied buffer.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
+    return GetMlasPlatform().ReduceMaximumF32Kernel(Input, N);
+#else
+    return MlasReduceMaximumF32Kernel(Input, N);
+#endif
+}
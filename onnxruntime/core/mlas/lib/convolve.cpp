@@ -819,6 +819,299 @@ Return Value:
     return true;
 }
 
+//
+// Define the minimum number of channels and filters per group before the
+// Winograd transform overhead is expected to pay for itself.
+//
+
+#define MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS 8
+#define MLAS_CONV_WINOGRAD_MINIMUM_FILTERS 8
+
+bool
+MLASCALL
+MlasConvTryUseWinograd(
+    MLAS_CONV_PARAMETERS* Parameters,
+    size_t* WorkingBufferSize
+    )
+/*++
+
+Routine Description:
+
+    This routine switches a prepared convolution to the Winograd F(2x2,3x3)
+    algorithm when the convolution parameters qualify.
+
+Arguments:
+
+    Parameters - Supplies the structure filled in by MlasConvPrepare.
+
+    WorkingBufferSize - Supplies and receives the number of elements to
+        allocate for the working buffer. Updated only when the routine
+        returns true.
+
+Return Value:
+
+    Returns true if the convolution was switched to the Winograd algorithm.
+
+--*/
+{
+    if (Parameters->Dimensions != 2 ||
+        Parameters->KernelShape[0] != 3 || Parameters->KernelShape[1] != 3 ||
+        Parameters->StrideShape[0] != 1 || Parameters->StrideShape[1] != 1 ||
+        Parameters->DilationShape[0] != 1 || Parameters->DilationShape[1] != 1 ||
+        Parameters->InputChannels < MLAS_CONV_WINOGRAD_MINIMUM_CHANNELS ||
+        Parameters->FilterCount < MLAS_CONV_WINOGRAD_MINIMUM_FILTERS) {
+        return false;
+    }
+
+    //
+    // Each output tile covers a 2x2 block, so the transformed domain carries
+    // 16 planes of [FilterCount x InputChannels] filters, [InputChannels x
+    // TileCount] inputs and [FilterCount x TileCount] accumulators.
+    //
+
+    const size_t TileCountH = (Parameters->OutputShape[0] + 1) / 2;
+    const size_t TileCountW = (Parameters->OutputShape[1] + 1) / 2;
+    const size_t TileCount = TileCountH * TileCountW;
+
+    Parameters->Algorithm = MlasConvAlgorithmWinograd;
+    Parameters->u.Winograd.TileCountH = TileCountH;
+    Parameters->u.Winograd.TileCountW = TileCountW;
+
+    *WorkingBufferSize = 16 * (Parameters->FilterCount * Parameters->InputChannels +
+                               Parameters->InputChannels * TileCount +
+                               Parameters->FilterCount * TileCount);
+
+    return true;
+}
+
+void
+MlasConvWinogradOperation(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* Filter,
+    float* WorkingBuffer,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements one group of a 3x3 stride-1 convolution with the
+    Winograd F(2x2,3x3) fast algorithm: the filter and 4x4 input tiles are
+    moved to the transformed domain, the per-tile reductions collapse into 16
+    independent GEMMs over all tiles, and the 2x2 output tiles are recovered
+    with the inverse transform.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor for this batch and group.
+
+    Filter - Supplies the filter tensor for this group.
+
+    WorkingBuffer - Supplies a working buffer sized to the number of elements
+        returned by MlasConvTryUseWinograd.
+
+    Output - Supplies the output tensor for this batch and group.
+
+    ThreadPool - Supplies the thread pool object to use.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+    const size_t OutputSize = Parameters->OutputSize;
+
+    const size_t TileCountH = Parameters->u.Winograd.TileCountH;
+    const size_t TileCountW = Parameters->u.Winograd.TileCountW;
+    const size_t TileCount = TileCountH * TileCountW;
+
+    const ptrdiff_t PaddingTop = ptrdiff_t(Parameters->Padding[0]);
+    const ptrdiff_t PaddingLeft = ptrdiff_t(Parameters->Padding[1]);
+
+    float* TransformedFilter = WorkingBuffer;
+    float* TransformedInput = TransformedFilter + 16 * FilterCount * InputChannels;
+    float* TransformedOutput = TransformedInput + 16 * InputChannels * TileCount;
+
+    //
+    // Transform the filter: U = G g G' with
+    // G = [1, 0, 0; .5, .5, .5; .5, -.5, .5; 0, 0, 1].
+    //
+
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(FilterCount), [&](ptrdiff_t k) {
+
+        for (size_t c = 0; c < InputChannels; c++) {
+
+            const float* g = Filter + (size_t(k) * InputChannels + c) * 9;
+            float Gg[12];
+
+            for (size_t j = 0; j < 3; j++) {
+                Gg[0 * 3 + j] = g[0 * 3 + j];
+                Gg[1 * 3 + j] = 0.5f * (g[0 * 3 + j] + g[1 * 3 + j] + g[2 * 3 + j]);
+                Gg[2 * 3 + j] = 0.5f * (g[0 * 3 + j] - g[1 * 3 + j] + g[2 * 3 + j]);
+                Gg[3 * 3 + j] = g[2 * 3 + j];
+            }
+
+            for (size_t i = 0; i < 4; i++) {
+
+                float u[4];
+
+                u[0] = Gg[i * 3 + 0];
+                u[1] = 0.5f * (Gg[i * 3 + 0] + Gg[i * 3 + 1] + Gg[i * 3 + 2]);
+                u[2] = 0.5f * (Gg[i * 3 + 0] - Gg[i * 3 + 1] + Gg[i * 3 + 2]);
+                u[3] = Gg[i * 3 + 2];
+
+                for (size_t j = 0; j < 4; j++) {
+                    TransformedFilter[(i * 4 + j) * FilterCount * InputChannels +
+                                      size_t(k) * InputChannels + c] = u[j];
+                }
+            }
+        }
+    });
+
+    //
+    // Transform the input tiles: V = B' d B with
+    // B' = [1, 0, -1, 0; 0, 1, 1, 0; 0, -1, 1, 0; 0, 1, 0, -1].
+    //
+
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(InputChannels), [&](ptrdiff_t c) {
+
+        const float* input = Input + size_t(c) * Parameters->InputSize;
+
+        for (size_t th = 0; th < TileCountH; th++) {
+
+            for (size_t tw = 0; tw < TileCountW; tw++) {
+
+                const size_t Tile = th * TileCountW + tw;
+                float d[16];
+
+                for (size_t i = 0; i < 4; i++) {
+
+                    const ptrdiff_t ih = ptrdiff_t(th * 2 + i) - PaddingTop;
+
+                    for (size_t j = 0; j < 4; j++) {
+
+                        const ptrdiff_t iw = ptrdiff_t(tw * 2 + j) - PaddingLeft;
+
+                        d[i * 4 + j] = (size_t(ih) < InputHeight && size_t(iw) < InputWidth) ?
+                            input[size_t(ih) * InputWidth + size_t(iw)] : 0.0f;
+                    }
+                }
+
+                float t[16];
+
+                for (size_t j = 0; j < 4; j++) {
+                    t[0 * 4 + j] = d[0 * 4 + j] - d[2 * 4 + j];
+                    t[1 * 4 + j] = d[1 * 4 + j] + d[2 * 4 + j];
+                    t[2 * 4 + j] = d[2 * 4 + j] - d[1 * 4 + j];
+                    t[3 * 4 + j] = d[1 * 4 + j] - d[3 * 4 + j];
+                }
+
+                for (size_t i = 0; i < 4; i++) {
+
+                    float v[4];
+
+                    v[0] = t[i * 4 + 0] - t[i * 4 + 2];
+                    v[1] = t[i * 4 + 1] + t[i * 4 + 2];
+                    v[2] = t[i * 4 + 2] - t[i * 4 + 1];
+                    v[3] = t[i * 4 + 1] - t[i * 4 + 3];
+
+                    for (size_t j = 0; j < 4; j++) {
+                        TransformedInput[(i * 4 + j) * InputChannels * TileCount +
+                                         size_t(c) * TileCount + Tile] = v[j];
+                    }
+                }
+            }
+        }
+    });
+
+    //
+    // Multiply the transformed filters against the transformed input tiles.
+    //
+
+    for (size_t Element = 0; Element < 16; Element++) {
+        MlasGemm(CblasNoTrans, CblasNoTrans, FilterCount, TileCount, InputChannels, 1.0f,
+                 TransformedFilter + Element * FilterCount * InputChannels, InputChannels,
+                 TransformedInput + Element * InputChannels * TileCount, TileCount, 0.0f,
+                 TransformedOutput + Element * FilterCount * TileCount, TileCount, ThreadPool);
+    }
+
+    //
+    // Recover the output tiles: Y = A' m A with A' = [1, 1, 1, 0; 0, 1, -1, -1].
+    //
+
+    const float Beta = Parameters->Beta;
+
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(FilterCount), [&](ptrdiff_t k) {
+
+        float* output = Output + size_t(k) * OutputSize;
+
+        for (size_t th = 0; th < TileCountH; th++) {
+
+            for (size_t tw = 0; tw < TileCountW; tw++) {
+
+                const size_t Tile = th * TileCountW + tw;
+                float m[16];
+
+                for (size_t Element = 0; Element < 16; Element++) {
+                    m[Element] = TransformedOutput[Element * FilterCount * TileCount +
+                                                   size_t(k) * TileCount + Tile];
+                }
+
+                float t[8];
+
+                for (size_t j = 0; j < 4; j++) {
+                    t[0 * 4 + j] = m[0 * 4 + j] + m[1 * 4 + j] + m[2 * 4 + j];
+                    t[1 * 4 + j] = m[1 * 4 + j] - m[2 * 4 + j] - m[3 * 4 + j];
+                }
+
+                float y[4];
+
+                for (size_t i = 0; i < 2; i++) {
+                    y[i * 2 + 0] = t[i * 4 + 0] + t[i * 4 + 1] + t[i * 4 + 2];
+                    y[i * 2 + 1] = t[i * 4 + 1] - t[i * 4 + 2] - t[i * 4 + 3];
+                }
+
+                for (size_t i = 0; i < 2; i++) {
+
+                    const size_t oh = th * 2 + i;
+
+                    if (oh >= OutputHeight) {
+                        break;
+                    }
+
+                    for (size_t j = 0; j < 2; j++) {
+
+                        const size_t ow = tw * 2 + j;
+
+                        if (ow >= OutputWidth) {
+                            break;
+                        }
+
+                        if (Beta == 0.0f) {
+                            output[oh * OutputWidth + ow] = y[i * 2 + j];
+                        } else {
+                            output[oh * OutputWidth + ow] = y[i * 2 + j] +
+                                Beta * output[oh * OutputWidth + ow];
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
 void
 MLASCALL
 MlasConv(
@@ -976,6 +1269,23 @@ Return Value:
                     break;
                 }
 
+                case MlasConvAlgorithmWinograd:
+                {
+                    //
+                    // Run the transforms and the per-element GEMMs over the
+                    // transformed tiles, then apply the activation with
+                    // optional bias.
+                    //
+
+                    MlasConvWinogradOperation(Parameters, Input, filter, WorkingBuffer,
+                        Output, ThreadPool);
+
+                    MlasActivation(Parameters->Activation, Output, bias, FilterCount,
+                        OutputSize, OutputSize);
+
+                    break;
+                }
+
 #if defined(MLAS_TARGET_WASM_SCALAR)
 
                 case MlasConvAlgorithmDepthwise:
@@ -0,0 +1,225 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    flashattn.cpp
+
+Abstract:
+
+    This module implements single precision scaled dot product attention
+    using a flash attention tiling scheme.
+
+    Blocks of the key and value matrices are streamed through the cache and
+    the softmax is folded into the accumulation using an online rescaling,
+    so the full query/key score matrix is never materialized.
+
+--*/
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "mlasi.h"
+
+void
+MlasFlashAttentionThreaded(
+    void* Context,
+    ptrdiff_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a slice of the
+    attention operation. Work is partitioned over tuples of batch, head and
+    query row block.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* Args = (const MLAS_FLASH_ATTENTION_THREADED_ARGS*)Context;
+
+    const ptrdiff_t NumHeads = Args->NumHeads;
+    const ptrdiff_t QSequenceLength = Args->QSequenceLength;
+    const ptrdiff_t KVSequenceLength = Args->KVSequenceLength;
+    const ptrdiff_t QKHeadSize = Args->QKHeadSize;
+    const ptrdiff_t VHeadSize = Args->VHeadSize;
+    const ptrdiff_t QBlockSize = Args->QBlockSize;
+    const ptrdiff_t KVBlockSize = Args->KVBlockSize;
+
+    //
+    // Partition the operation over tuples of batch index, head index and
+    // query row block.
+    //
+
+    const size_t QBlockCount = MlasDivRoundup(size_t(QSequenceLength), size_t(QBlockSize));
+    const size_t TotalWork = size_t(Args->BatchSize) * size_t(NumHeads) * QBlockCount;
+
+    size_t WorkIndex;
+    size_t WorkRemaining;
+
+    MlasPartitionWork(ThreadId, Args->ThreadCount, TotalWork, &WorkIndex, &WorkRemaining);
+
+    //
+    // Carve the per-thread buffer into the score tile, the unnormalized
+    // output accumulator and the running row maximum and row sum vectors.
+    //
+
+    float* Buffer = Args->Buffer + size_t(ThreadId) * (Args->BufferSizePerThread / sizeof(float));
+
+    float* Scores = Buffer;
+    float* Accumulator = Scores + QBlockSize * KVBlockSize;
+    float* RowMaximum = Accumulator + QBlockSize * VHeadSize;
+    float* RowSum = RowMaximum + QBlockSize;
+
+    while (WorkRemaining > 0) {
+
+        const ptrdiff_t BatchHeadIndex = ptrdiff_t(WorkIndex / QBlockCount);
+        const ptrdiff_t QIndex = ptrdiff_t(WorkIndex % QBlockCount) * QBlockSize;
+        const ptrdiff_t CountQ = std::min(QBlockSize, QSequenceLength - QIndex);
+
+        const float* Query = Args->Query + (BatchHeadIndex * QSequenceLength + QIndex) * QKHeadSize;
+        const float* Key = Args->Key + BatchHeadIndex * KVSequenceLength * QKHeadSize;
+        const float* Value = Args->Value + BatchHeadIndex * KVSequenceLength * VHeadSize;
+
+        for (ptrdiff_t Row = 0; Row < CountQ; Row++) {
+            RowMaximum[Row] = std::numeric_limits<float>::lowest();
+            RowSum[Row] = 0.0f;
+        }
+
+        std::memset(Accumulator, 0, size_t(CountQ) * VHeadSize * sizeof(float));
+
+        for (ptrdiff_t KVIndex = 0; KVIndex < KVSequenceLength; KVIndex += KVBlockSize) {
+
+            const ptrdiff_t CountKV = std::min(KVBlockSize, KVSequenceLength - KVIndex);
+
+            //
+            // Compute the scaled score tile: Scores = Scale * Query x Key'.
+            //
+
+            MlasGemm(CblasNoTrans, CblasTrans, size_t(CountQ), size_t(CountKV), size_t(QKHeadSize),
+                     Args->Scale, Query, size_t(QKHeadSize), Key + KVIndex * QKHeadSize,
+                     size_t(QKHeadSize), 0.0f, Scores, size_t(CountKV), nullptr);
+
+            //
+            // Exponentiate the score tile against the updated row maximum and
+            // rescale the state accumulated from the previous key blocks.
+            //
+
+            for (ptrdiff_t Row = 0; Row < CountQ; Row++) {
+
+                float* ScoresRow = Scores + Row * CountKV;
+
+#if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
+                float Maximum = GetMlasPlatform().ReduceMaximumF32Kernel(ScoresRow, size_t(CountKV));
+#else
+                float Maximum = MlasReduceMaximumF32Kernel(ScoresRow, size_t(CountKV));
+#endif
+                Maximum = std::max(Maximum, RowMaximum[Row]);
+                float NegativeMaximum = -Maximum;
+
+#if defined(MLAS_TARGET_AMD64)
+                float Accumulation = GetMlasPlatform().ComputeSumExpF32Kernel(ScoresRow, ScoresRow, size_t(CountKV), &NegativeMaximum);
+#else
+                float Accumulation = MlasComputeSumExpF32Kernel(ScoresRow, ScoresRow, size_t(CountKV), &NegativeMaximum);
+#endif
+
+                const float Correction = std::exp(RowMaximum[Row] - Maximum);
+                RowSum[Row] = RowSum[Row] * Correction + Accumulation;
+                RowMaximum[Row] = Maximum;
+
+                if (Correction != 1.0f) {
+
+                    float Parameters[] = { Correction };
+
+#if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
+                    GetMlasPlatform().ComputeSoftmaxOutputF32Kernel(Accumulator + Row * VHeadSize, size_t(VHeadSize), Parameters);
+#else
+                    MlasComputeSoftmaxOutputF32Kernel(Accumulator + Row * VHeadSize, size_t(VHeadSize), Parameters);
+#endif
+                }
+            }
+
+            //
+            // Accumulate the unnormalized output: Accumulator += Scores x Value.
+            //
+
+            MlasGemm(CblasNoTrans, CblasNoTrans, size_t(CountQ), size_t(VHeadSize), size_t(CountKV),
+                     1.0f, Scores, size_t(CountKV), Value + KVIndex * VHeadSize, size_t(VHeadSize),
+                     1.0f, Accumulator, size_t(VHeadSize), nullptr);
+        }
+
+        //
+        // Normalize the accumulator by the softmax denominator and store it
+        // to the BxSxNxH_v output tensor.
+        //
+
+        const ptrdiff_t BatchIndex = BatchHeadIndex / NumHeads;
+        const ptrdiff_t HeadIndex = BatchHeadIndex % NumHeads;
+
+        float* Output = Args->Output +
+                        ((BatchIndex * QSequenceLength + QIndex) * NumHeads + HeadIndex) * VHeadSize;
+
+        for (ptrdiff_t Row = 0; Row < CountQ; Row++) {
+
+            float Parameters[] = { 1.0f / RowSum[Row] };
+
+#if defined(MLAS_TARGET_AMD64) || defined(MLAS_TARGET_LARCH64)
+            GetMlasPlatform().ComputeSoftmaxOutputF32Kernel(Accumulator + Row * VHeadSize, size_t(VHeadSize), Parameters);
+#else
+            MlasComputeSoftmaxOutputF32Kernel(Accumulator + Row * VHeadSize, size_t(VHeadSize), Parameters);
+#endif
+
+            std::memcpy(Output + Row * NumHeads * VHeadSize, Accumulator + Row * VHeadSize,
+                        size_t(VHeadSize) * sizeof(float));
+        }
+
+        WorkIndex++;
+        WorkRemaining--;
+    }
+}
+
+void
+MLASCALL
+MlasFlashAttention(
+    MLAS_FLASH_ATTENTION_THREADED_ARGS* Args,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes scaled dot product attention over the supplied
+    query, key and value tensors using flash attention tiling.
+
+Arguments:
+
+    Args - Supplies the structure containing the attention parameters, the
+        per-thread scratch buffer and the input and output tensors.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(Args->ThreadCount), [&](ptrdiff_t tid) {
+        MlasFlashAttentionThreaded(Args, tid);
+    });
+}
@@ -0,0 +1,365 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    erf_logistic_avx512f.cpp
+
+Abstract:
+
+    This module implements routines to compute the error function and the
+    logistic function with AVX512F instructions.
+
+    The polynomial coefficients and algorithms are identical to the generic
+    kernels in erf.cpp and logistic.cpp. The 512-bit vectors process sixteen
+    elements per iteration and the remainder is handled with opmask loads and
+    stores, so the scalar tail loops of the generic kernels are not needed.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Bundles the constants shared with the generic kernel in erf.cpp.
+//
+
+static const struct {
+    float ErfUpperAbsRange;
+    float ErfSplitBoundary;
+    float ErfSMALL_P0;
+    float ErfSMALL_P1;
+    float ErfSMALL_P2;
+    float ErfSMALL_P3;
+    float ErfSMALL_P4;
+    float ErfSMALL_P5_Minus_One;
+    float ErfBIG_P0;
+    float ErfBIG_P1;
+    float ErfBIG_P2;
+    float ErfBIG_P3;
+    float ErfBIG_P4;
+    float ErfBIG_P5;
+    float ErfBIG_P6_Minus_One;
+
+    float Exp_LowerRange;
+    float Exp_Log2Reciprocal;
+    float Exp_log2_hi;
+    float Exp_log2_lo;
+    float Exp_P0;
+    float Exp_P1;
+    float Exp_P2;
+    float Exp_P3;
+    float Exp_P4;
+    float Exp_P5;
+    float Exp_P6;
+    float Exp_C;
+} MlasErfConstantsAvx512F = {
+    3.925f,
+    0.921875f,
+    -5.99104969e-4f,
+    4.99339588e-3f,
+    -2.67667342e-2f,
+    1.12818025e-1f,
+    -3.76124859e-1f,
+    1.28379151e-1f,
+    1.72948930e-5f,
+    -3.83208680e-4f,
+    3.88393435e-3f,
+    -2.42545605e-2f,
+    1.06777847e-1f,
+    6.34846687e-1f,
+    1.28717512e-1f,
+
+    -88.3762626647949f,
+    1.44269504088896341f,
+    -6.93145752e-1f,
+    -1.42860677e-6f,
+    1.38319808e-3f,
+    8.37550033e-3f,
+    4.16689515e-2f,
+    1.66664466e-1f,
+    4.99999851e-1f,
+    1.00000000e+0f,
+    1.00000000e+0f,
+    1.25829120e+7f,
+};
+
+//
+// Bundles the constants shared with the generic kernel in logistic.cpp.
+//
+
+static const struct {
+    float LowerRange;
+    float UpperRange;
+    float alpha_9;
+    float alpha_7;
+    float alpha_5;
+    float alpha_3;
+    float alpha_1;
+    float beta_10;
+    float beta_8;
+    float beta_6;
+    float beta_4;
+    float beta_2;
+    float beta_0;
+} MlasLogisticConstantsAvx512F = {
+    -18.0f,
+    18.0f,
+    4.37031012579801e-11f,
+    1.15627324459942e-07f,
+    6.08574864600143e-05f,
+    8.51377133304701e-03f,
+    2.48287947061529e-01f,
+    6.10247389755681e-13f,
+    5.76102136993427e-09f,
+    6.29106785017040e-06f,
+    1.70198817374094e-03f,
+    1.16817656904453e-01f,
+    9.93151921023180e-01f,
+};
+
+MLAS_FORCEINLINE
+__mmask16
+MlasTailMask16(
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine builds the opmask register value covering the first N lanes
+    of a 512-bit vector of floats.
+
+Arguments:
+
+    N - Supplies the number of lanes to cover. Must be less than 16.
+
+Return Value:
+
+    Returns the opmask register value.
+
+--*/
+{
+    return static_cast<__mmask16>((uint32_t(1) << N) - 1);
+}
+
+MLAS_FORCEINLINE
+__m512
+MlasErfVectorAvx512F(
+    __m512 Value
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the error function for sixteen elements.
+
+Arguments:
+
+    Value - Supplies the input vector.
+
+Return Value:
+
+    Returns the vector of results.
+
+--*/
+{
+    const __m512i AbsMask = _mm512_set1_epi32(0x7FFFFFFF);
+    __m512i SignBits = _mm512_andnot_si512(AbsMask, _mm512_castps_si512(Value));
+    __m512 AbsValue = _mm512_castsi512_ps(_mm512_and_si512(AbsMask, _mm512_castps_si512(Value)));
+    AbsValue = _mm512_min_ps(_mm512_set1_ps(MlasErfConstantsAvx512F.ErfUpperAbsRange), AbsValue);
+    __m512 SquareValue = _mm512_mul_ps(AbsValue, AbsValue);
+
+    __m512 r_small = _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSMALL_P0);
+    r_small = _mm512_fmadd_ps(r_small, SquareValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSMALL_P1));
+    r_small = _mm512_fmadd_ps(r_small, SquareValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSMALL_P2));
+    r_small = _mm512_fmadd_ps(r_small, SquareValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSMALL_P3));
+    r_small = _mm512_fmadd_ps(r_small, SquareValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSMALL_P4));
+    r_small = _mm512_fmadd_ps(r_small, SquareValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSMALL_P5_Minus_One));
+    r_small = _mm512_fmadd_ps(r_small, AbsValue, AbsValue);
+
+    //
+    // Lanes above the split boundary take the 1.0 - exp(-r_big) path; the two
+    // split results are merged with a blend instead of the and/or dance the
+    // 128-bit kernel needs.
+    //
+
+    __mmask16 BigMask = _mm512_cmp_ps_mask(AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfSplitBoundary), _CMP_GT_OQ);
+
+    __m512 r_big = _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P0);
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P1));
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P2));
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P3));
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P4));
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P5));
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, _mm512_set1_ps(MlasErfConstantsAvx512F.ErfBIG_P6_Minus_One));
+    r_big = _mm512_fmadd_ps(r_big, AbsValue, AbsValue);
+
+    __m512 neg_r = _mm512_sub_ps(_mm512_setzero_ps(), r_big);
+    neg_r = _mm512_max_ps(_mm512_set1_ps(MlasErfConstantsAvx512F.Exp_LowerRange), neg_r);
+    __m512 exp_c = _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_C);
+    __m512 r = _mm512_fmadd_ps(_mm512_set1_ps(MlasErfConstantsAvx512F.Exp_Log2Reciprocal), neg_r, exp_c);
+    r = _mm512_sub_ps(r, exp_c);
+
+    __m512 fx = _mm512_fmadd_ps(r, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_log2_hi), neg_r);
+    fx = _mm512_fmadd_ps(r, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_log2_lo), fx);
+
+    __m512 y = _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P0);
+    y = _mm512_fmadd_ps(y, fx, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P1));
+    y = _mm512_fmadd_ps(y, fx, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P2));
+    y = _mm512_fmadd_ps(y, fx, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P3));
+    y = _mm512_fmadd_ps(y, fx, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P4));
+    y = _mm512_fmadd_ps(y, fx, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P5));
+    y = _mm512_fmadd_ps(y, fx, _mm512_set1_ps(MlasErfConstantsAvx512F.Exp_P6));
+
+    //
+    // 1.0 - exp(fx) * 2^INT(r), with the scale folded in by VSCALEFPS since r
+    // holds an integral value at this point.
+    //
+
+    y = _mm512_scalef_ps(y, r);
+    y = _mm512_sub_ps(_mm512_set1_ps(1.0f), y);
+
+    y = _mm512_mask_blend_ps(BigMask, r_small, y);
+    return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(y), SignBits));
+}
+
+void
+MLASCALL
+MlasErfKernelAvx512F(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the AVX512F kernel for the error function.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (N >= 16) {
+
+        _mm512_storeu_ps(Output, MlasErfVectorAvx512F(_mm512_loadu_ps(Input)));
+
+        Input += 16;
+        Output += 16;
+        N -= 16;
+    }
+
+    if (N > 0) {
+
+        __mmask16 TailMask = MlasTailMask16(N);
+        __m512 Value = _mm512_maskz_loadu_ps(TailMask, Input);
+        _mm512_mask_storeu_ps(Output, TailMask, MlasErfVectorAvx512F(Value));
+    }
+}
+
+MLAS_FORCEINLINE
+__m512
+MlasLogisticVectorAvx512F(
+    __m512 Value
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the logistic function for sixteen elements.
+
+Arguments:
+
+    Value - Supplies the input vector.
+
+Return Value:
+
+    Returns the vector of results.
+
+--*/
+{
+    //
+    // The clamp keeps the constant operand first so a NaN input carries
+    // through to the output, matching the generic kernel.
+    //
+
+    Value = _mm512_max_ps(_mm512_set1_ps(MlasLogisticConstantsAvx512F.LowerRange), Value);
+    Value = _mm512_min_ps(_mm512_set1_ps(MlasLogisticConstantsAvx512F.UpperRange), Value);
+
+    __m512 ValueSquared = _mm512_mul_ps(Value, Value);
+
+    __m512 p;
+    p = _mm512_fmadd_ps(ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.alpha_9),
+        _mm512_set1_ps(MlasLogisticConstantsAvx512F.alpha_7));
+    p = _mm512_fmadd_ps(p, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.alpha_5));
+    p = _mm512_fmadd_ps(p, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.alpha_3));
+    p = _mm512_fmadd_ps(p, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.alpha_1));
+    p = _mm512_mul_ps(p, Value);
+
+    __m512 q;
+    q = _mm512_fmadd_ps(ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.beta_10),
+        _mm512_set1_ps(MlasLogisticConstantsAvx512F.beta_8));
+    q = _mm512_fmadd_ps(q, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.beta_6));
+    q = _mm512_fmadd_ps(q, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.beta_4));
+    q = _mm512_fmadd_ps(q, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.beta_2));
+    q = _mm512_fmadd_ps(q, ValueSquared, _mm512_set1_ps(MlasLogisticConstantsAvx512F.beta_0));
+
+    return _mm512_add_ps(_mm512_div_ps(p, q), _mm512_set1_ps(0.5f));
+}
+
+void
+MLASCALL
+MlasComputeLogisticF32KernelAvx512F(
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the AVX512F kernel for the logistic function.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (N >= 16) {
+
+        _mm512_storeu_ps(Output, MlasLogisticVectorAvx512F(_mm512_loadu_ps(Input)));
+
+        Input += 16;
+        Output += 16;
+        N -= 16;
+    }
+
+    if (N > 0) {
+
+        __mmask16 TailMask = MlasTailMask16(N);
+        __m512 Value = _mm512_maskz_loadu_ps(TailMask, Input);
+        _mm512_mask_storeu_ps(Output, TailMask, MlasLogisticVectorAvx512F(Value));
+    }
+}
@@ -24,6 +24,10 @@ Abstract:
 #include <sys/auxv.h>
 #endif
 
+#if defined(MLAS_TARGET_ARM64) && defined(__ARM_FEATURE_SVE)
+#include <arm_sve.h>
+#endif
+
 #if defined(MLAS_TARGET_ARM64)
 #if defined(_WIN32)
 
@@ -56,6 +60,10 @@ MLASCPUIDInfo::MLASCPUIDInfo()
 #define HWCAP2_I8MM (1 << 13)
 #endif
 
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+
 #ifndef HWCAP2_SVEI8MM
 #define HWCAP2_SVEI8MM (1 << 9)
 #endif
@@ -73,6 +81,7 @@ MLASCPUIDInfo::MLASCPUIDInfo()
     has_fp16_ = has_arm_neon_dot_;
 
     has_arm_neon_i8mm_ = ((getauxval(AT_HWCAP2) & HWCAP2_I8MM) != 0);
+    has_arm_sve_ = ((getauxval(AT_HWCAP) & HWCAP_SVE) != 0);
     has_arm_sve_i8mm_ = ((getauxval(AT_HWCAP2) & HWCAP2_SVEI8MM) != 0);
 
     has_arm_neon_bf16_ = ((getauxval(AT_HWCAP2) & HWCAP2_BF16) != 0);
@@ -424,6 +433,8 @@ Return Value:
                     this->PoolFloatKernel[MlasAveragePoolingIncludePad] = MlasPoolAverageIncludePadFloatKernelAvx512F;
                     this->ComputeExpF32Kernel = MlasComputeExpF32KernelAvx512F;
                     this->ComputeSumExpF32Kernel = MlasComputeSumExpF32KernelAvx512F;
+                    this->ErfKernelRoutine = MlasErfKernelAvx512F;
+                    this->LogisticKernelRoutine = MlasComputeLogisticF32KernelAvx512F;
                     this->ReduceMaximumF32Kernel = MlasReduceMaximumF32KernelAvx512F;
                     this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8KernelAvx512F;
                     this->QuantizeLinearU8Kernel = MlasQuantizeLinearU8KernelAvx512F;
@@ -462,15 +473,20 @@ Return Value:
 
 #ifndef __APPLE__
                 //
-                // Check if the processor supports AMX-TILE and AMX-INT8
-                // features.
+                // Check if the processor supports AMX-TILE together with the
+                // AMX-INT8 and/or AMX-BF16 features.
                 //
                 if ((Cpuid7[3] & 0b1 << 24) != 0 &&
-                    (Cpuid7[3] & 0b1 << 25) != 0 &&
+                    ((Cpuid7[3] & 0b1 << 25) != 0 || (Cpuid7[3] & 0b1 << 22) != 0) &&
                     (xcr0 & XFEATURE_MASK_XTILE) == XFEATURE_MASK_XTILE) {
                     if (MlasInitAMX()) {
-                        this->GemmU8U8Dispatch = &MlasGemmU8S8DispatchAmx;
-                        this->GemmU8S8Dispatch = &MlasGemmU8S8DispatchAmx;
+                        if ((Cpuid7[3] & 0b1 << 25) != 0) {
+                            this->GemmU8U8Dispatch = &MlasGemmU8S8DispatchAmx;
+                            this->GemmU8S8Dispatch = &MlasGemmU8S8DispatchAmx;
+                        }
+                        if ((Cpuid7[3] & 0b1 << 22) != 0) {
+                            this->SBGemmDispatch = &MlasSBGemmDispatchAmx;
+                        }
                     }
                 }
 #endif // __APPLE__
@@ -494,6 +510,25 @@ Return Value:
     this->SymmQgemmDispatch = &MlasSymmQgemmS8DispatchNeon;
     this->ConvSymU8S8Dispatch = &MlasConvSymU8DispatchNeon;
     this->ConvSymS8S8Dispatch = &MlasConvSymS8DispatchNeon;
+    this->SgemmKernelZeroRoutine = MlasSgemmKernelZero;
+    this->SgemmKernelAddRoutine = MlasSgemmKernelAdd;
+
+#if defined(__ARM_FEATURE_SVE)
+
+    //
+    // Check if the processor supports scalable vectors. The SVE kernels are
+    // vector length agnostic, but only pay off over the hand tuned NEON
+    // kernels when the implemented vector length exceeds 128 bits (such as
+    // the 256-bit implementation in Neoverse V1), so stay on the NEON
+    // kernels otherwise.
+    //
+
+    if (MLAS_CPUIDINFO::GetCPUIDInfo().HasArmSVE() && (svcntb() > 16)) {
+        this->SgemmKernelZeroRoutine = MlasSgemmKernelSveZero;
+        this->SgemmKernelAddRoutine = MlasSgemmKernelSveAdd;
+    }
+
+#endif
 
     //
     // Check if the processor supports ASIMD dot product instructions.
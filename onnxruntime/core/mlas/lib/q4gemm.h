@@ -37,6 +37,25 @@ MlasQ4GemmKernel(
     const float* Bias
 );
 
+/**
+ * @brief Dedicated M=1 kernel. Single token decode of LLMs hits this shape on every
+ *        step; the A row stays in cache while the packed B columns are streamed
+ *        sequentially exactly once, so a wider column tile amortizes each A load
+ *        over more FMAs than the GEMM kernel's tiles.
+ */
+template<typename Q4TYPE, typename KERNEL>
+MLAS_FORCEINLINE
+void
+MlasQ4GemvKernel(
+    const float* A,
+    const uint8_t* PackedB,
+    float* C,
+    size_t CountN,
+    size_t CountK,
+    size_t ldb,
+    const float* Bias
+);
+
 template <typename Q4Type, typename KERNEL>
 MLAS_FORCEINLINE
 void
@@ -76,27 +95,16 @@ MlasQ4GemmOperation(
             CountN = std::min(RangeCountN - n, (size_t)128);
 
             //
-            // Step through each slice of matrix A along the M dimension.
+            // Step through each slice of matrix B along the N dimension.
             //
             const float* bias = (Bias == nullptr) ? nullptr : Bias + RangeStartN + n;
             const uint8_t* b_col = PackedB + (RangeStartN + n) * ldb;
-            float* c_blk = C + n;
-            const float* a_row = A;
-
-            size_t RowsRemaining = RangeCountM;
-            while (RowsRemaining > 0) {
-                auto RowsHandled = MlasQ4GemmKernel<Q4TYPE, KERNEL>(
-                    a_row, b_col, c_blk, RowsRemaining, CountN, K, lda, ldb, ldc, bias);
-
-                if (DataParams->OutputProcessor != nullptr) {
-                    DataParams->OutputProcessor->Process(
-                        DataParams->C, RangeStartM + RangeCountM - RowsRemaining, RangeStartN + n,
-                        RowsHandled, CountN, ldc);
-                }
-
-                c_blk += ldc * RowsHandled;
-                a_row += lda * RowsHandled;
-                RowsRemaining -= RowsHandled;
+
+            MlasQ4GemvKernel<Q4TYPE, KERNEL>(A, b_col, C + n, CountN, K, ldb, bias);
+
+            if (DataParams->OutputProcessor != nullptr) {
+                DataParams->OutputProcessor->Process(
+                    DataParams->C, RangeStartM, RangeStartN + n, 1, CountN, ldc);
             }
         }
         return;
@@ -379,6 +379,192 @@ MlasQ4GemmKernel<MLAS_Q4TYPE_BLK0, MLAS_FP_Q4_GEMM_KERNEL_AVX512VNNI>(
 }
 
 
+template<typename Q4Type>
+MLAS_FORCEINLINE
+void
+MlasQ4GemvKernelAvx512f(
+    const float* A,
+    const uint8_t* PackedB,
+    float* C,
+    size_t CountN,
+    size_t CountK,
+    size_t ldb,
+    const float* Bias
+    )
+{
+    // We process 32 quantized values in a batch.
+    static_assert(MLAS_QUANT4_BLK_UNIT == 32);
+    static_assert(Q4Type::BlkLen % MLAS_QUANT4_BLK_UNIT == 0);
+
+    // With a single row of A every load of the activation vector is shared by
+    // all columns of the tile, so a tile twice as wide as the GEMM kernel's
+    // costs no extra A traffic and doubles the independent accumulator chains.
+    constexpr int64_t NCols = 8;
+
+    const __m256i lowMask = _mm256_set1_epi8(0xF);
+
+    const auto* b_col = PackedB;
+    auto* sum_ptr = C;
+    const auto* bias_ptr = Bias;
+
+    int64_t nblk = (int64_t)(CountN) - NCols;
+    while (nblk >= 0) {
+        __m512 acc_lo[NCols];
+        for (int64_t nn = 0; nn < NCols; nn++) {
+            acc_lo[nn] = _mm512_setzero_ps();
+        }
+        const auto* b = b_col;
+
+        for (size_t k = 0; k < CountK; k += Q4Type::BlkLen) {
+            size_t ck = std::min(CountK - k, Q4Type::BlkLen);
+
+            float scale_v[NCols];
+            const __m128i* b_ptr[NCols];
+            for (int64_t nn = 0; nn < NCols; nn++) {
+                const auto* bb = b + ldb * nn;
+                scale_v[nn] = MlasQ4BlkScale<Q4Type>(bb);
+                b_ptr[nn] = (const __m128i*)MlasQ4BlkData<Q4Type>(bb);
+            }
+
+            for (size_t kk = 0; kk < ck; kk += MLAS_QUANT4_BLK_UNIT) {
+                size_t kklen = std::min((size_t)MLAS_QUANT4_BLK_UNIT, ck - kk);
+
+                // Load A row vectors
+                uint32_t mask = 0xffffffff >> (MLAS_QUANT4_BLK_UNIT - kklen);
+                __m512 av_lo = _mm512_maskz_loadu_ps(__mmask16(mask), A + k + kk);
+
+                mask = mask >> 16;
+                __m512 av_hi = mask == 0
+                                   ? _mm512_setzero_ps()
+                                   : _mm512_maskz_loadu_ps(__mmask16(mask), A + k + kk + 16);
+
+                for (int64_t nn = 0; nn < NCols; nn++) {
+                    // Load B col vector and expand 4b into byte array
+                    const __m128i bvi4 = _mm_loadu_si128(b_ptr[nn]++);
+                    __m256i bytes = _mm256_set_m128i(_mm_srli_epi16(bvi4, 4), bvi4);
+                    bytes = _mm256_and_si256(lowMask, bytes);
+
+                    if constexpr (std::is_same_v<Q4Type, MLAS_Q4TYPE_BLK1>) {
+                        // Subtract zero-point from the integers
+                        const auto* bb = b + ldb * nn;
+                        const uint8_t zp = MlasQ4BlkZeroPoint<MLAS_Q4TYPE_BLK1>(bb);
+                        bytes = _mm256_sub_epi8(bytes, _mm256_set1_epi8(zp));
+                    } else {
+                        // Subtract 8 from the integers
+                        const __m256i eight = _mm256_set1_epi8(8);
+                        bytes = _mm256_sub_epi8(bytes, eight);
+                    }
+
+                    // Convert to 16-bit int
+                    const __m256i vx16_lo =
+                        _mm256_cvtepi8_epi16(_mm256_extracti128_si256(bytes, 0));
+                    const __m256i vx16_hi =
+                        _mm256_cvtepi8_epi16(_mm256_extracti128_si256(bytes, 1));
+
+                    // Convert to 32-bit int -> float 32
+                    __m512 bvf_lo = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(vx16_lo));
+                    __m512 bvf_hi = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(vx16_hi));
+                    __m512 s = _mm512_set1_ps(scale_v[nn]);
+                    bvf_lo = _mm512_mul_ps(bvf_lo, s);
+                    bvf_hi = _mm512_mul_ps(bvf_hi, s);
+
+                    acc_lo[nn] = _mm512_fmadd_ps(bvf_lo, av_lo, acc_lo[nn]);
+                    acc_lo[nn] = _mm512_fmadd_ps(bvf_hi, av_hi, acc_lo[nn]);
+                }
+            }
+
+            b += Q4Type::BlobSize;
+        }
+
+        __m128 acc_x0 = FoldAccumulators(acc_lo[0], acc_lo[1], acc_lo[2], acc_lo[3]);
+        __m128 acc_x1 = FoldAccumulators(acc_lo[4], acc_lo[5], acc_lo[6], acc_lo[7]);
+        if (Bias != nullptr) {
+            acc_x0 = _mm_add_ps(acc_x0, _mm_loadu_ps(bias_ptr));
+            acc_x1 = _mm_add_ps(acc_x1, _mm_loadu_ps(bias_ptr + 4));
+        }
+        _mm_storeu_ps(sum_ptr, acc_x0);
+        _mm_storeu_ps(sum_ptr + 4, acc_x1);
+
+        // move to next 8 columns
+        b_col += NCols * ldb;
+        sum_ptr += NCols;
+        bias_ptr += NCols;
+        nblk -= NCols;
+    }
+
+    // left over columns less than 8 ?
+    nblk += NCols;
+    if (nblk > 0) {
+        MlasQ4GemmKernelAvx512f<Q4Type>(A, b_col, sum_ptr, 1, (size_t)nblk, CountK, 0, ldb, 0,
+                                        Bias == nullptr ? nullptr : bias_ptr);
+    }
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasQ4GemvKernel<MLAS_Q4TYPE_BLK1,MLAS_FP_Q4_GEMM_KERNEL_AVX512VNNI>(
+    const float* A,
+    const uint8_t* PackedB,
+    float* C,
+    size_t CountN,
+    size_t CountK,
+    size_t ldb,
+    const float* Bias
+    )
+{
+    MlasQ4GemvKernelAvx512f<MLAS_Q4TYPE_BLK1>(A, PackedB, C, CountN, CountK, ldb, Bias);
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasQ4GemvKernel<MLAS_Q4TYPE_BLK2,MLAS_FP_Q4_GEMM_KERNEL_AVX512VNNI>(
+    const float* A,
+    const uint8_t* PackedB,
+    float* C,
+    size_t CountN,
+    size_t CountK,
+    size_t ldb,
+    const float* Bias
+    )
+{
+    MlasQ4GemvKernelAvx512f<MLAS_Q4TYPE_BLK2>(A, PackedB, C, CountN, CountK, ldb, Bias);
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasQ4GemvKernel<MLAS_Q4TYPE_BLK4,MLAS_FP_Q4_GEMM_KERNEL_AVX512VNNI>(
+    const float* A,
+    const uint8_t* PackedB,
+    float* C,
+    size_t CountN,
+    size_t CountK,
+    size_t ldb,
+    const float* Bias
+    )
+{
+    MlasQ4GemvKernelAvx512f<MLAS_Q4TYPE_BLK4>(A, PackedB, C, CountN, CountK, ldb, Bias);
+}
+
+template<>
+MLAS_FORCEINLINE
+void
+MlasQ4GemvKernel<MLAS_Q4TYPE_BLK0, MLAS_FP_Q4_GEMM_KERNEL_AVX512VNNI>(
+    const float* A,
+    const uint8_t* PackedB,
+    float* C,
+    size_t CountN,
+    size_t CountK,
+    size_t ldb,
+    const float* Bias
+    )
+{
+    MlasQ4GemvKernelAvx512f<MLAS_Q4TYPE_BLK0>(A, PackedB, C, CountN, CountK, ldb, Bias);
+}
+
+
 MLAS_FORCEINLINE
 void
 Transpose16x16Avx512(
@@ -1003,6 +1003,166 @@ MlasQuantizeLinearU4(
 
 #endif
 
+#if defined(MLAS_NEON64_INTRINSICS) || defined(MLAS_SSE2_INTRINSICS)
+
+//
+// DequantizeLinear implementation using NEON or SSE2 intrinsics.
+//
+
+template<typename InputType>
+MLAS_INT32X4
+MlasDequantizeLinearLoadInt32x4(
+    const InputType* Input
+    );
+
+template<>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasDequantizeLinearLoadInt32x4<int8_t>(
+    const int8_t* Input
+    )
+{
+#if defined(MLAS_NEON64_INTRINSICS)
+    uint32_t Bits;
+    memcpy(&Bits, Input, sizeof(Bits));
+    int16x8_t WideVector = vmovl_s8(vreinterpret_s8_u32(vdup_n_u32(Bits)));
+    return vmovl_s16(vget_low_s16(WideVector));
+#else
+    int32_t Bits;
+    memcpy(&Bits, Input, sizeof(Bits));
+    MLAS_INT32X4 ByteVector = _mm_cvtsi32_si128(Bits);
+    ByteVector = _mm_unpacklo_epi8(ByteVector, ByteVector);
+    ByteVector = _mm_unpacklo_epi16(ByteVector, ByteVector);
+    return _mm_srai_epi32(ByteVector, 24);
+#endif
+}
+
+template<>
+MLAS_FORCEINLINE
+MLAS_INT32X4
+MlasDequantizeLinearLoadInt32x4<uint8_t>(
+    const uint8_t* Input
+    )
+{
+#if defined(MLAS_NEON64_INTRINSICS)
+    uint32_t Bits;
+    memcpy(&Bits, Input, sizeof(Bits));
+    uint16x8_t WideVector = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(Bits)));
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(WideVector)));
+#else
+    int32_t Bits;
+    memcpy(&Bits, Input, sizeof(Bits));
+    MLAS_INT32X4 ByteVector = _mm_cvtsi32_si128(Bits);
+    ByteVector = _mm_unpacklo_epi8(ByteVector, ByteVector);
+    ByteVector = _mm_unpacklo_epi16(ByteVector, ByteVector);
+    return _mm_srli_epi32(ByteVector, 24);
+#endif
+}
+
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+/*++
+
+Routine Description:
+
+    This routine dequantizes the input buffer using the supplied quantization
+    parameters:
+
+        Output = (Input - ZeroPoint) * Scale
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Scale - Supplies the quantization scale.
+
+    ZeroPoint - Supplies the quantization zero point value.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Scale);
+    const MLAS_INT32X4 ZeroPointVector = MlasBroadcastInt32x4(int32_t(ZeroPoint));
+
+    while (N >= 4) {
+
+        MLAS_INT32X4 IntegerVector = MlasDequantizeLinearLoadInt32x4<InputType>(Input);
+        IntegerVector = MlasSubtractInt32x4(IntegerVector, ZeroPointVector);
+
+        MLAS_FLOAT32X4 FloatVector = MlasMultiplyFloat32x4(MlasCastToFloat32x4(IntegerVector), ScaleVector);
+        MlasStoreFloat32x4(Output, FloatVector);
+
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    for (size_t n = 0; n < N; n++) {
+        Output[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+}
+
+#else
+
+//
+// DequantizeLinear implementation using the C++ runtime.
+//
+
+template<typename InputType>
+void
+MLASCALL
+MlasDequantizeLinear(
+    const InputType* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    InputType ZeroPoint
+    )
+{
+    for (size_t n = 0; n < N; n++) {
+        Output[n] = float(int32_t(Input[n]) - int32_t(ZeroPoint)) * Scale;
+    }
+}
+
+#endif
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<int8_t>(
+    const int8_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    int8_t ZeroPoint
+    );
+
+template
+void
+MLASCALL
+MlasDequantizeLinear<uint8_t>(
+    const uint8_t* Input,
+    float* Output,
+    size_t N,
+    float Scale,
+    uint8_t ZeroPoint
+    );
+
 #if defined(MLAS_SSE2_INTRINSICS)
 
 template <typename OutputType>
@@ -30,7 +30,7 @@ Abstract:
         MLAS_SBGEMM_STRIDES Strides{128, 128, 256};
 --*/
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
 
 #pragma once
 
@@ -39,6 +39,11 @@ Abstract:
 
 #include "mlasi.h"
 
+#if !defined(MLAS_TARGET_ARM64)
+// The arm_neon.h header supplies this type on aarch64.
+typedef uint16_t bfloat16_t;
+#endif
+
 /**
  * @brief Define the default striding parameters for
  *        the bfloat16 precision gemm operation
@@ -291,6 +296,9 @@ MlasSBGemmGetDispatch()
 {
 #if defined(MLAS_TARGET_ARM64)
     return &MlasSBGemmDispatchNeon;
+#elif defined(MLAS_TARGET_AMD64)
+    // Set during platform initialization when the processor supports AMX-BF16.
+    return GetMlasPlatform().SBGemmDispatch;
 #else
     std::cerr << "SBGemm Kernel is supported only on ARM64 platform.";
     exit(1);
@@ -396,4 +404,4 @@ MlasSBGemmBatch(const size_t M, const size_t N, const size_t K, const size_t Bat
         }
     );
 }
-#endif  // defined(__aarch64__) && defined(__linux__)
+#endif  // (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
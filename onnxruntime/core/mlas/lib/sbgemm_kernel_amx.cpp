@@ -0,0 +1,252 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sbgemm_kernel_amx.cpp
+
+Abstract:
+
+    This module implements bfloat16 precision GEMM kernel for amx.
+
+    The kernel computes one 16x16 tile of the output at a time. Matrix A is
+    converted from fp32 to bf16 on the fly; matrix B has been converted and
+    packed into the dword interleaved layout consumed by TDPBF16PS, in
+    column groups of 16 that each span the K dimension of the packed slab.
+
+--*/
+
+#if defined(__x86_64__) || defined(_M_AMD64)
+
+#include "mlasi.h"
+#include "sbgemm.h"
+#include "amx_common.h"
+
+#define TMM0 0
+#define TMM1 1
+#define TMM2 2
+
+struct MLAS_SBGEMM_KERNEL_AMX {
+    static constexpr bool PackNeeded = true;
+    static constexpr size_t KernelMaxM = 16;  // max # rows the vectorized kernel can process
+    static constexpr size_t PackedK = 2;
+    static constexpr size_t PackedN = MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+    static constexpr MLAS_SBGEMM_STRIDES Strides{32, 128, 256};  // M:N:K
+};
+
+bool MLASCALL
+MlasBf16AccelerationSupported()
+{
+    return MlasSBGemmGetDispatch() != nullptr;
+}
+
+/*
+    Convert 16 single precision elements to bfloat16 using round to nearest
+    even, quieting NaN values so they survive the truncation.
+*/
+MLAS_FORCEINLINE
+__m256i
+MlasSBGemmConvertF32ToBf16(__m512 FloatVector)
+{
+    const __m512i Bits = _mm512_castps_si512(FloatVector);
+    const __m512i RoundingBias = _mm512_add_epi32(
+        _mm512_and_si512(_mm512_srli_epi32(Bits, 16), _mm512_set1_epi32(1)),
+        _mm512_set1_epi32(0x7FFF)
+    );
+    __m512i Rounded = _mm512_add_epi32(Bits, RoundingBias);
+
+    const __mmask16 NanMask = _mm512_cmp_ps_mask(FloatVector, FloatVector, _CMP_UNORD_Q);
+    Rounded = _mm512_mask_mov_epi32(
+        Rounded, NanMask, _mm512_or_si512(Bits, _mm512_set1_epi32(0x00400000))
+    );
+
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(Rounded, 16));
+}
+
+/*
+    This routine converts fp32 to bf16 and copies elements from the source
+    matrix to the destination packed buffer.
+
+    The packed buffer is organized in column groups of 16. Within a group,
+    each row holds a pair of K elements per column interleaved in a dword
+    (the TDPBF16PS B tile layout), with the trailing odd row and the columns
+    of a partial group padded with zero.
+*/
+MLAS_FORCEINLINE
+void
+MlasSBGemmConvertCopyPackBAmx(bfloat16_t* D, const float* B, size_t ldb, size_t CountN, size_t CountK)
+{
+    for (size_t n = 0; n < CountN; n += 16) {
+        const size_t Columns = std::min(CountN - n, size_t(16));
+        const __mmask16 ColumnMask = uint16_t((Columns == 16) ? 0xffff : ((1u << Columns) - 1));
+        const float* b = B + n;
+
+        for (size_t k = 0; k < CountK; k += 2) {
+            __m512 Row0 = _mm512_maskz_loadu_ps(ColumnMask, b);
+            __m512 Row1 = ((k + 1) < CountK) ? _mm512_maskz_loadu_ps(ColumnMask, b + ldb)
+                                             : _mm512_setzero_ps();
+
+            const __m512i Even = _mm512_cvtepu16_epi32(MlasSBGemmConvertF32ToBf16(Row0));
+            const __m512i Odd = _mm512_cvtepu16_epi32(MlasSBGemmConvertF32ToBf16(Row1));
+            _mm512_storeu_si512(D, _mm512_or_si512(Even, _mm512_slli_epi32(Odd, 16)));
+
+            D += 32;
+            b += ldb * 2;
+        }
+    }
+}
+
+template <>
+void
+MlasSBGemmConvertPackB<MLAS_SBGEMM_KERNEL_AMX>(
+    bfloat16_t* PackedB, const float* B, size_t ldb, size_t CountN, size_t CountK
+)
+{
+    constexpr MLAS_SBGEMM_STRIDES Strides = MLAS_SBGEMM_KERNEL_AMX::Strides;
+    constexpr size_t PackedN = MLAS_SBGEMM_KERNEL_AMX::PackedN;
+
+    const size_t AlignedN = (CountN + PackedN - 1) & ~(PackedN - 1);
+
+    //
+    // Step through each slice of matrix B along the K dimension.
+    //
+    size_t K_block_size;
+    for (size_t k = 0; k < CountK; k += K_block_size) {
+        K_block_size = std::min(CountK - k, Strides.K);
+
+        MlasSBGemmConvertCopyPackBAmx(PackedB, B + k * ldb, ldb, CountN, K_block_size);
+        PackedB = PackedB + AlignedN * K_block_size;
+    }
+}
+
+// Tile configure structure
+struct sbgemm_tileconfig_t {
+    uint8_t palette_id = 0;
+    uint8_t start_row = 0;
+    uint8_t reserved1[14] = {0};
+    uint16_t colb[8] = {0};
+    uint8_t reserved2[16] = {0};
+    uint8_t rows[8] = {0};
+    uint8_t reserved3[8] = {0};
+};
+
+MLAS_FORCEINLINE
+void
+MlasSBGemmAmxConfigureTiles()
+{
+    static thread_local struct sbgemm_tileconfig_t tc = {0};
+    struct sbgemm_tileconfig_t current_tc = {0};
+    tile_storeconfig(&current_tc);
+
+    if (tc.palette_id == 0 || (std::memcmp(&current_tc.colb, &tc.colb, sizeof(uint16_t) * 8) != 0 &&
+                               std::memcmp(&current_tc.rows, &tc.rows, sizeof(uint8_t) * 8) != 0)) {
+        // Filling tile configure structure.
+        tc.palette_id = 1;
+        for (int t = 0; t < 8; t++) {
+            tc.rows[t] = 16;
+            tc.colb[t] = 64;
+        }
+
+        tile_loadconfig(&tc);
+    }
+}
+
+template <>
+MLAS_FORCEINLINE void
+MlasSBGemmKernel<MLAS_SBGEMM_KERNEL_AMX>(size_t CountM, size_t CountN, size_t CountK, const float* A, size_t lda, const bfloat16_t* B, float* C, size_t ldc, const float* Bias, const bool ZeroMode)
+{
+    MlasSBGemmAmxConfigureTiles();
+
+    //
+    // Elements per 16 column group of the packed B buffer: pairs of K rows
+    // interleaved into dwords, padded to an even number of rows.
+    //
+    const size_t GroupStride = ((CountK + 1) / 2) * 32;
+
+    MLAS_DECLSPEC_ALIGN(bfloat16_t ABuffer[16 * 32], 64);
+    MLAS_DECLSPEC_ALIGN(float CBuffer[16 * 16], 64);
+
+    for (size_t m = 0; m < CountM; m += 16) {
+        const size_t Rows = std::min(CountM - m, size_t(16));
+        const float* a = A + m * lda;
+        float* c = C + m * ldc;
+
+        for (size_t n = 0; n < CountN; n += 16) {
+            const size_t Columns = std::min(CountN - n, size_t(16));
+            const __mmask16 ColumnMask = uint16_t((Columns == 16) ? 0xffff : ((1u << Columns) - 1));
+            const bfloat16_t* BGroup = B + (n / 16) * GroupStride;
+
+            //
+            // Seed the accumulator tile with the bias vector, the existing
+            // output, or zero.
+            //
+            if (ZeroMode) {
+                const __m512 Seed = (Bias != nullptr) ? _mm512_maskz_loadu_ps(ColumnMask, Bias + n)
+                                                      : _mm512_setzero_ps();
+                for (size_t i = 0; i < 16; i++) {
+                    _mm512_store_ps(&CBuffer[i * 16], Seed);
+                }
+            } else {
+                for (size_t i = 0; i < Rows; i++) {
+                    _mm512_store_ps(&CBuffer[i * 16], _mm512_maskz_loadu_ps(ColumnMask, c + i * ldc + n));
+                }
+                for (size_t i = Rows; i < 16; i++) {
+                    _mm512_store_ps(&CBuffer[i * 16], _mm512_setzero_ps());
+                }
+            }
+
+            tile_loadd(TMM0, CBuffer, 64);
+
+            for (size_t k = 0; k < CountK; k += 32) {
+                const size_t Depth = CountK - k;
+                const __mmask16 DepthMaskLo =
+                    uint16_t((Depth >= 16) ? 0xffff : ((1u << Depth) - 1));
+                const __mmask16 DepthMaskHi =
+                    uint16_t((Depth >= 32) ? 0xffff
+                                           : ((Depth > 16) ? ((1u << (Depth - 16)) - 1) : 0));
+
+                //
+                // Convert the A tile to bf16, zero padding the ragged K edge
+                // and any unused trailing rows.
+                //
+                // N.B. The conversion is repeated for each column group; for
+                // the panel sizes used by the driver the tile multiplies
+                // still dominate.
+                //
+                for (size_t i = 0; i < Rows; i++) {
+                    const float* a_row = a + i * lda + k;
+                    const __m256i Lo = MlasSBGemmConvertF32ToBf16(_mm512_maskz_loadu_ps(DepthMaskLo, a_row));
+                    const __m256i Hi = MlasSBGemmConvertF32ToBf16(_mm512_maskz_loadu_ps(DepthMaskHi, a_row + 16));
+                    _mm256_store_si256((__m256i*)&ABuffer[i * 32], Lo);
+                    _mm256_store_si256((__m256i*)&ABuffer[i * 32 + 16], Hi);
+                }
+                for (size_t i = Rows; i < 16; i++) {
+                    _mm512_store_si512(&ABuffer[i * 32], _mm512_setzero_si512());
+                }
+
+                tile_loadd(TMM1, ABuffer, 64);
+                tile_loadd(TMM2, BGroup + (k / 2) * 32, 64);
+                tile_dpbf16ps(TMM0, TMM1, TMM2);
+            }
+
+            tile_stored(TMM0, CBuffer, 64);
+
+            for (size_t i = 0; i < Rows; i++) {
+                _mm512_mask_storeu_ps(c + i * ldc + n, ColumnMask, _mm512_load_ps(&CBuffer[i * 16]));
+            }
+        }
+    }
+}
+
+const MLAS_SBGEMM_DISPATCH MlasSBGemmDispatchAmx = {
+    MlasSBGemmOperation<MLAS_SBGEMM_KERNEL_AMX>,
+    MlasSBGemmConvertPackB<MLAS_SBGEMM_KERNEL_AMX>,
+    MLAS_SBGEMM_KERNEL_AMX::PackedK,
+    MLAS_SBGEMM_KERNEL_AMX::PackedN,
+    MLAS_SBGEMM_KERNEL_AMX::KernelMaxM,
+    32  // kernel may read beyond buffer end by 32 bytes
+};
+#endif  // defined(__x86_64__) || defined(_M_AMD64)
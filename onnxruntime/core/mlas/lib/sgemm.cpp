@@ -17,6 +17,10 @@ Abstract:
 
 #include "mlasi.h"
 
+#include <chrono>
+#include <mutex>
+#include <vector>
+
 //
 // Define the number of rows from matrix A to transpose to a local buffer.
 //
@@ -1063,6 +1067,12 @@ Return Value:
 
 #if defined(MLAS_TARGET_AMD64_IX86) || defined(MLAS_TARGET_POWER) || defined(MLAS_TARGET_LARCH64)
         RowsHandled = GetMlasPlatform().GemmFloatKernel(A, B, C, CountK, CountM, CountN, lda, ldc, alpha, ZeroMode);
+#elif defined(MLAS_TARGET_ARM64)
+        if (ZeroMode) {
+            RowsHandled = GetMlasPlatform().SgemmKernelZeroRoutine(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+        } else {
+            RowsHandled = GetMlasPlatform().SgemmKernelAddRoutine(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+        }
 #else
         if (ZeroMode) {
             RowsHandled = MlasSgemmKernelZero(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
@@ -1220,8 +1230,21 @@ Return Value:
     // the A panel needs to be used for transposing.
     //
 
-    size_t StrideN = MLAS_SGEMM_STRIDEN;
-    size_t StrideK = MLAS_SGEMM_STRIDEK;
+    size_t StrideN = GetMlasPlatform().SgemmStrideN;
+    size_t StrideK = GetMlasPlatform().SgemmStrideK;
+
+    //
+    // Fall back to the compile time defaults if the tuned strides would
+    // overflow the stack allocated panel buffers: PanelB holds
+    // MLAS_SGEMM_STRIDEN * MLAS_SGEMM_STRIDEK elements and PanelA only holds
+    // MLAS_SGEMM_STRIDEK columns for the transpose path.
+    //
+
+    if ((StrideN * StrideK > size_t(MLAS_SGEMM_STRIDEN) * MLAS_SGEMM_STRIDEK) ||
+        (TransA != CblasNoTrans && StrideK > MLAS_SGEMM_STRIDEK)) {
+        StrideN = MLAS_SGEMM_STRIDEN;
+        StrideK = MLAS_SGEMM_STRIDEK;
+    }
 
     if (N >= K) {
 
@@ -1551,6 +1574,16 @@ Return Value:
         MlasSgemmOperation(TransA, TransB, RangeCountM, RangeCountN, K,
             DataParams->alpha, A, lda, B, ldb, DataParams->beta, C, ldc);
     }
+
+    //
+    // Apply the output epilogue to the completed tile while it is still cache
+    // resident.
+    //
+
+    if (DataParams->OutputProcessor != nullptr) {
+        DataParams->OutputProcessor->Process(DataParams->C, RangeStartM,
+            RangeStartN, RangeCountM, RangeCountN, ldc);
+    }
 }
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(push)
@@ -1592,6 +1625,37 @@ MlasGemmBatch(
         TargetThreadCount = MaximumThreadCount;
     }
 
+    //
+    // When each operation in the batch is small, dispatching one task per
+    // operation costs more in thread pool overhead than the operations
+    // themselves. Fold a contiguous run of operations into each task so the
+    // task count tracks the total complexity of the batch rather than its
+    // size.
+    //
+
+    if (BatchSize > 1 && Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY)) {
+
+        const double BatchComplexity = Complexity * double(BatchSize);
+
+        ptrdiff_t TaskCount = ptrdiff_t(BatchComplexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+        TaskCount = std::min(TaskCount, MaximumThreadCount);
+        TaskCount = std::min(TaskCount, ptrdiff_t(BatchSize));
+
+        MlasTrySimpleParallel(ThreadPool, TaskCount, [=](ptrdiff_t tid)
+        {
+            size_t GemmStart;
+            size_t GemmCount;
+
+            MlasPartitionWork(tid, TaskCount, BatchSize, &GemmStart, &GemmCount);
+
+            for (size_t i = 0; i < GemmCount; i++) {
+                MlasSgemmThreaded(1, 1, TransA, TransB, M, N, K, &Data[GemmStart + i], 0);
+            }
+        });
+
+        return;
+    }
+
     //
     // Segment the operation across multiple threads.
     //
@@ -1739,3 +1803,103 @@ Return Value:
         PackedB = (float*)PackedB + AlignedN * CountK;
     }
 }
+
+void
+MLASCALL
+MlasSgemmTune(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine probes a small set of SGEMM blocking configurations on the
+    running machine and installs the fastest into the platform support
+    structure.
+
+    The probe runs once per process; subsequent calls return immediately.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    static std::once_flag TuneOnceFlag;
+
+    std::call_once(TuneOnceFlag, []() {
+
+        //
+        // Candidate splits of the panel buffer between the N and K dimensions.
+        // Each candidate preserves the panel capacity implied by the compile
+        // time defaults, so the stack allocated panel buffers are never
+        // overflowed.
+        //
+
+        constexpr uint32_t Candidates[][2] = {
+            { MLAS_SGEMM_STRIDEN, MLAS_SGEMM_STRIDEK },
+            { MLAS_SGEMM_STRIDEN * 2, MLAS_SGEMM_STRIDEK / 2 },
+            { MLAS_SGEMM_STRIDEN / 2, MLAS_SGEMM_STRIDEK * 2 },
+        };
+
+        //
+        // Use a shape that is large enough to step through multiple slices of
+        // the panel buffer in both dimensions, but small enough to keep the
+        // one-time probe in the low milliseconds.
+        //
+
+        constexpr size_t M = 96;
+        constexpr size_t N = 384;
+        constexpr size_t K = 384;
+
+        std::vector<float> A(M * K, 1.0f);
+        std::vector<float> B(K * N, 1.0f);
+        std::vector<float> C(M * N);
+
+        MLAS_PLATFORM& Platform = GetMlasPlatform();
+
+        uint32_t BestStrideN = Platform.SgemmStrideN;
+        uint32_t BestStrideK = Platform.SgemmStrideK;
+        auto BestDuration = std::chrono::steady_clock::duration::max();
+
+        for (const auto& Candidate : Candidates) {
+
+            Platform.SgemmStrideN = Candidate[0];
+            Platform.SgemmStrideK = Candidate[1];
+
+            //
+            // Warm the caches, then keep the fastest of a few iterations to
+            // reduce scheduling noise.
+            //
+
+            MlasSgemmOperation(CblasNoTrans, CblasNoTrans, M, N, K, 1.0f,
+                               A.data(), K, B.data(), N, 0.0f, C.data(), N);
+
+            auto CandidateDuration = std::chrono::steady_clock::duration::max();
+
+            for (int Iteration = 0; Iteration < 3; Iteration++) {
+
+                auto Start = std::chrono::steady_clock::now();
+
+                MlasSgemmOperation(CblasNoTrans, CblasNoTrans, M, N, K, 1.0f,
+                                   A.data(), K, B.data(), N, 0.0f, C.data(), N);
+
+                CandidateDuration = std::min(CandidateDuration,
+                                             std::chrono::steady_clock::now() - Start);
+            }
+
+            if (CandidateDuration < BestDuration) {
+                BestDuration = CandidateDuration;
+                BestStrideN = Candidate[0];
+                BestStrideK = Candidate[1];
+            }
+        }
+
+        Platform.SgemmStrideN = BestStrideN;
+        Platform.SgemmStrideK = BestStrideK;
+    });
+}
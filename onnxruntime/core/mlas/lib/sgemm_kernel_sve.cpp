@@ -0,0 +1,276 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sgemm_kernel_sve.cpp
+
+Abstract:
+
+    This module implements the kernels for the single precision matrix/matrix
+    multiply operation (SGEMM) using the scalable vector extension (SVE).
+
+    The kernels are vector length agnostic: the packed panels produced by
+    MlasSgemmCopyPackB and MlasSgemmTransposePackB are a fixed 16 columns
+    wide, and each panel is walked in chunks of the implemented vector
+    length using predicated loads and stores.
+
+--*/
+
+#include "mlasi.h"
+
+#if defined(MLAS_TARGET_ARM64) && defined(__ARM_FEATURE_SVE)
+
+#include <arm_sve.h>
+
+template<bool ZeroMode, bool ProcessTwoRows>
+size_t
+MlasSgemmKernelSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B. The matrix data has been packed using
+        MlasSgemmCopyPackB or MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of rows
+        from matrix B to iterate over.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar multiplier (see SGEMM definition).
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    const uint64_t VectorLength = svcntw();
+
+    do {
+
+        //
+        // The packed buffer is always a full 16 columns wide, but columns
+        // beyond CountN must not be touched in the output matrix, so clamp
+        // the predicates to the valid columns of this panel.
+        //
+
+        const uint64_t PanelN = (CountN >= 16) ? 16 : uint64_t(CountN);
+
+        for (uint64_t n = 0; n < PanelN; n += VectorLength) {
+
+            const svbool_t Pred = svwhilelt_b32_u64(n, PanelN);
+
+            svfloat32_t Row0Block = svdup_n_f32(0.0f);
+            svfloat32_t Row1Block = svdup_n_f32(0.0f);
+
+            //
+            // Accumulate one vector wide column chunk of the output block.
+            //
+
+            const float* a = A;
+            const float* b = B + n;
+
+            for (size_t k = 0; k < CountK; k++) {
+
+                svfloat32_t BElements = svld1_f32(Pred, b);
+
+                Row0Block = svmla_n_f32_m(Pred, Row0Block, BElements, a[0]);
+
+                if (ProcessTwoRows) {
+                    Row1Block = svmla_n_f32_m(Pred, Row1Block, BElements, a[lda]);
+                }
+
+                a += 1;
+                b += 16;
+            }
+
+            //
+            // Multiply by the alpha value and store the output block.
+            //
+
+            Row0Block = svmul_n_f32_m(Pred, Row0Block, alpha);
+
+            if (!ZeroMode) {
+                Row0Block = svadd_f32_m(Pred, Row0Block, svld1_f32(Pred, C + n));
+            }
+
+            svst1_f32(Pred, C + n, Row0Block);
+
+            if (ProcessTwoRows) {
+
+                Row1Block = svmul_n_f32_m(Pred, Row1Block, alpha);
+
+                if (!ZeroMode) {
+                    Row1Block = svadd_f32_m(Pred, Row1Block, svld1_f32(Pred, C + ldc + n));
+                }
+
+                svst1_f32(Pred, C + ldc + n, Row1Block);
+            }
+        }
+
+        B += CountK * 16;
+        C += PanelN;
+        CountN -= PanelN;
+
+    } while (CountN > 0);
+
+    return ProcessTwoRows ? 2 : 1;
+}
+
+template<bool ZeroMode>
+size_t
+MlasSgemmKernelSve(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows.
+
+Arguments:
+
+    A - Supplies the address of matrix A.
+
+    B - Supplies the address of matrix B. The matrix data has been packed using
+        MlasSgemmCopyPackB or MlasSgemmTransposePackB.
+
+    C - Supplies the address of matrix C.
+
+    CountK - Supplies the number of columns from matrix A and the number of rows
+        from matrix B to iterate over.
+
+    CountM - Supplies the maximum number of rows that can be processed for
+        matrix A and matrix C. The actual number of rows handled for this
+        invocation depends on the kernel implementation.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    lda - Supplies the first dimension of matrix A.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    alpha - Supplies the scalar multiplier (see SGEMM definition).
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    size_t RowsHandled;
+
+    if (CountM >= 2) {
+        RowsHandled = MlasSgemmKernelSve<ZeroMode, true>(A, B, C, CountK, CountN, lda, ldc, alpha);
+    } else {
+        RowsHandled = MlasSgemmKernelSve<ZeroMode, false>(A, B, C, CountK, CountN, lda, ldc, alpha);
+    }
+
+    return RowsHandled;
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelSveZero(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows. The output matrix is zero initialized before accumulation.
+
+Arguments:
+
+    See MlasSgemmKernelSve above.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    return MlasSgemmKernelSve<true>(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+}
+
+size_t
+MLASCALL
+MlasSgemmKernelSveAdd(
+    const float* A,
+    const float* B,
+    float* C,
+    size_t CountK,
+    size_t CountM,
+    size_t CountN,
+    size_t lda,
+    size_t ldc,
+    float alpha
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a
+    set of rows. The output matrix is accumulated into.
+
+Arguments:
+
+    See MlasSgemmKernelSve above.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    return MlasSgemmKernelSve<false>(A, B, C, CountK, CountM, CountN, lda, ldc, alpha);
+}
+
+#endif // defined(MLAS_TARGET_ARM64) && defined(__ARM_FEATURE_SVE)
@@ -541,20 +541,24 @@ MlasTranspose8xNVector(
     MlasTranspose4xNVector(&Input[InputStride * 4], InputStride, &Output[OutputStride * 4], OutputStride);
 }
 
+static
 void
-MLASCALL
-MlasTranspose(
+MlasTransposePanel(
     const uint32_t* Input,
     uint32_t* Output,
     size_t M,
-    size_t N
+    size_t N,
+    size_t InputStride,
+    size_t OutputStride
     )
 /*++
 
 Routine Description:
 
-    This routine transposes the input matrix (M rows by N columns) to the
-    output matrix (N rows by M columns).
+    This routine transposes a panel of the input matrix (M rows by N columns)
+    to the output matrix (N rows by M columns). The strides are supplied
+    separately from the panel dimensions so that a larger transpose can be
+    split into independent panels.
 
 Arguments:
 
@@ -562,11 +566,16 @@ Arguments:
 
     Output - Supplies the output buffer.
 
-    M - Supplies the number of rows for the input matrix and the number of
-        columns for the output matrix.
+    M - Supplies the number of rows for the input panel and the number of
+        columns for the output panel.
 
-    N - Supplies the number of columns for the input matrix and the number of
-        rows for the output matrix.
+    N - Supplies the number of columns for the input panel and the number of
+        rows for the output panel.
+
+    InputStride - Supplies the number of elements per row of the input matrix.
+
+    OutputStride - Supplies the number of elements per row of the output
+        matrix.
 
 Return Value:
 
@@ -592,9 +601,9 @@ Return Value:
 
         while (m >= 4) {
 
-            MlasTranspose4x4Block(s, N, d, M);
+            MlasTranspose4x4Block(s, InputStride, d, OutputStride);
 
-            s += N * 4;
+            s += InputStride * 4;
             d += 4;
             m -= 4;
         }
@@ -603,15 +612,15 @@ Return Value:
 
         while (m > 0) {
 
-            MlasTranspose4xNVector(s, 1, d, M);
+            MlasTranspose4xNVector(s, 1, d, OutputStride);
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 4;
-        Output += M * 4;
+        Output += OutputStride * 4;
         n -= 4;
     }
 
@@ -628,9 +637,9 @@ Return Value:
 
         while (m >= 4) {
 
-            MlasTranspose4xNVector(s, N, d, 1);
+            MlasTranspose4xNVector(s, InputStride, d, 1);
 
-            s += N * 4;
+            s += InputStride * 4;
             d += 4;
             m -= 4;
         }
@@ -639,13 +648,13 @@ Return Value:
 
             d[0] = s[0];
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 1;
-        Output += M;
+        Output += OutputStride;
         n -= 1;
     }
 }
@@ -653,25 +662,8 @@ Return Value:
 void
 MLASCALL
 MlasTranspose(
-    const float* Input,
-    float* Output,
-    size_t M,
-    size_t N
-    )
-{
-    MlasTranspose(
-        reinterpret_cast<const uint32_t*>(Input),
-        reinterpret_cast<uint32_t*>(Output),
-        M,
-        N);
-}
-
-
-void
-MLASCALL
-MlasTranspose(
-    const uint16_t* Input,
-    uint16_t* Output,
+    const uint32_t* Input,
+    uint32_t* Output,
     size_t M,
     size_t N
     )
@@ -699,6 +691,37 @@ Return Value:
     None.
 
 --*/
+{
+    MlasTransposePanel(Input, Output, M, N, N, M);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTranspose(
+        reinterpret_cast<const uint32_t*>(Input),
+        reinterpret_cast<uint32_t*>(Output),
+        M,
+        N);
+}
+
+
+static
+void
+MlasTransposePanel(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    size_t InputStride,
+    size_t OutputStride
+    )
 {
     size_t n = N;
 
@@ -717,9 +740,9 @@ Return Value:
 
         while (m >= 4) {
 
-            MlasTranspose4x4Block(s, N, d, M);
+            MlasTranspose4x4Block(s, InputStride, d, OutputStride);
 
-            s += N * 4;
+            s += InputStride * 4;
             d += 4;
             m -= 4;
         }
@@ -728,15 +751,15 @@ Return Value:
 
         while (m > 0) {
 
-            MlasTranspose4xNVector(s, 1, d, M);
+            MlasTranspose4xNVector(s, 1, d, OutputStride);
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 4;
-        Output += M * 4;
+        Output += OutputStride * 4;
         n -= 4;
     }
 
@@ -753,9 +776,9 @@ Return Value:
 
         while (m >= 4) {
 
-            MlasTranspose4xNVector(s, N, d, 1);
+            MlasTranspose4xNVector(s, InputStride, d, 1);
 
-            s += N * 4;
+            s += InputStride * 4;
             d += 4;
             m -= 4;
         }
@@ -764,23 +787,22 @@ Return Value:
 
             d[0] = s[0];
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 1;
-        Output += M;
+        Output += OutputStride;
         n -= 1;
     }
 }
 
-
 void
 MLASCALL
 MlasTranspose(
-    const uint8_t* Input,
-    uint8_t* Output,
+    const uint16_t* Input,
+    uint16_t* Output,
     size_t M,
     size_t N
     )
@@ -808,6 +830,21 @@ Return Value:
     None.
 
 --*/
+{
+    MlasTransposePanel(Input, Output, M, N, N, M);
+}
+
+
+static
+void
+MlasTransposePanel(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    size_t InputStride,
+    size_t OutputStride
+    )
 {
     size_t n = N;
 
@@ -823,24 +860,24 @@ Return Value:
         size_t m = M;
         while (m >= 16) {
 
-            MlasTranspose16x16Block(s, N, d, M);
+            MlasTranspose16x16Block(s, InputStride, d, OutputStride);
 
-            s += N * 16;
+            s += InputStride * 16;
             d += 16;
             m -= 16;
         }
 
         while (m > 0) {
 
-            MlasTranspose16xNVector(s, 1, d, M);
+            MlasTranspose16xNVector(s, 1, d, OutputStride);
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 16;
-        Output += M * 16;
+        Output += OutputStride * 16;
         n -= 16;
     }
 #endif
@@ -854,9 +891,9 @@ Return Value:
 
         while (m >= 8) {
 
-            MlasTranspose8x8Block(s, N, d, M);
+            MlasTranspose8x8Block(s, InputStride, d, OutputStride);
 
-            s += N * 8;
+            s += InputStride * 8;
             d += 8;
             m -= 8;
         }
@@ -865,15 +902,15 @@ Return Value:
 
         while (m > 0) {
 
-            MlasTranspose8xNVector(s, 1, d, M);
+            MlasTranspose8xNVector(s, 1, d, OutputStride);
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 8;
-        Output += M * 8;
+        Output += OutputStride * 8;
         n -= 8;
     }
 
@@ -890,9 +927,9 @@ Return Value:
 
         while (m >= 8) {
 
-            MlasTranspose8xNVector(s, N, d, 1);
+            MlasTranspose8xNVector(s, InputStride, d, 1);
 
-            s += N * 8;
+            s += InputStride * 8;
             d += 8;
             m -= 8;
         }
@@ -901,17 +938,53 @@ Return Value:
 
             d[0] = s[0];
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 1;
-        Output += M;
+        Output += OutputStride;
         n -= 1;
     }
 }
 
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns).
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasTransposePanel(Input, Output, M, N, N, M);
+}
+
 void
 MLASCALL
 MlasTranspose(
@@ -926,3 +999,153 @@ MlasTranspose(
         M,
         N);
 }
+
+template <typename ElementType>
+static
+void
+MlasTransposeThreaded(
+    const ElementType* Input,
+    ElementType* Output,
+    size_t M,
+    size_t N,
+    size_t KernelWidth,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns), splitting the work over the supplied
+    thread pool. The input columns are partitioned into panels that are a
+    multiple of the kernel width so the vectorized blocks stay dense within
+    each panel, and each panel writes a disjoint contiguous range of output
+    rows.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+    KernelWidth - Supplies the column count of the vectorized transpose block
+        for this element type.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Keep small problems on the calling thread to avoid dispatch overhead.
+    //
+
+    constexpr size_t MinimumElementsPerThread = size_t(64) * 1024;
+
+    ptrdiff_t ThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+    const size_t MaximumUsefulThreads = MlasDivRoundup(M * N, MinimumElementsPerThread);
+
+    if (MaximumUsefulThreads < size_t(ThreadCount)) {
+        ThreadCount = ptrdiff_t(MaximumUsefulThreads);
+    }
+
+    if (ThreadCount <= 1) {
+        MlasTransposePanel(Input, Output, M, N, N, M);
+        return;
+    }
+
+    const size_t ColumnsPerThread = MlasDivRoundup(MlasDivRoundup(N, size_t(ThreadCount)), KernelWidth) * KernelWidth;
+    ThreadCount = ptrdiff_t(MlasDivRoundup(N, ColumnsPerThread));
+
+    MlasTrySimpleParallel(ThreadPool, ThreadCount, [=](ptrdiff_t tid) {
+        const size_t ColumnIndex = size_t(tid) * ColumnsPerThread;
+        const size_t ColumnCount = std::min(ColumnsPerThread, N - ColumnIndex);
+
+        MlasTransposePanel(Input + ColumnIndex, Output + ColumnIndex * M, M, ColumnCount, N, M);
+    });
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, 8, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const int8_t* Input,
+    int8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTranspose(
+        reinterpret_cast<const uint8_t*>(Input),
+        reinterpret_cast<uint8_t*>(Output),
+        M,
+        N,
+        ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, 4, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeThreaded(Input, Output, M, N, 4, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const float* Input,
+    float* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTranspose(
+        reinterpret_cast<const uint32_t*>(Input),
+        reinterpret_cast<uint32_t*>(Output),
+        M,
+        N,
+        ThreadPool);
+}
@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/activation_compression.h"
+
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Compressing a tensor costs one fp32->fp16 and one fp16->fp32 pass, so it only pays off for
+// tensors large enough to be evicted from cache between producer and consumer.
+constexpr int64_t kMinCompressedElements = 1 << 20;
+
+// Minimum distance in topological order between the producer and a consumer for the edge to be
+// considered long-lived. Consumers closer than this keep reading the original fp32 tensor.
+constexpr ptrdiff_t kMinTopologicalDistance = 16;
+
+int64_t NumElementsIfKnown(const NodeArg& def) {
+  const auto* shape = def.Shape();
+  if (shape == nullptr) {
+    return -1;
+  }
+  int64_t elements = 1;
+  for (int i = 0; i < shape->dim_size(); ++i) {
+    if (!utils::HasDimValue(shape->dim(i))) {
+      return -1;
+    }
+    elements *= shape->dim(i).dim_value();
+  }
+  return elements;
+}
+
+}  // namespace
+
+Status ActivationCompressionTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                                   const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  InlinedHashMap<NodeIndex, ptrdiff_t> topo_position;
+  topo_position.reserve(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    topo_position.emplace(order[i], static_cast<ptrdiff_t>(i));
+  }
+
+  TypeProto fp16_type;
+  fp16_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT16);
+  TypeProto fp32_type;
+  fp32_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  for (NodeIndex index : order) {
+    auto* node_ptr = graph.GetNode(index);
+    if (node_ptr == nullptr) {
+      continue;
+    }
+    Node& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (node.GetExecutionProviderType() != kCpuExecutionProvider) {
+      continue;
+    }
+
+    const ptrdiff_t producer_position = topo_position[index];
+    for (NodeArg* def : node.MutableOutputDefs()) {
+      if (def == nullptr || !def->Exists() || def->Type() == nullptr || *def->Type() != "tensor(float)") {
+        continue;
+      }
+      if (graph.IsOutput(def) || NumElementsIfKnown(*def) < kMinCompressedElements) {
+        continue;
+      }
+
+      bool rewritable = true;
+      InlinedVector<Node*> far_consumers;
+      for (Node* consumer : graph.GetMutableConsumerNodes(def->Name())) {
+        if (consumer == nullptr) {
+          continue;
+        }
+        // An implicit input feeds a subgraph that references the tensor by name, so it cannot
+        // be rerouted through a renamed restored tensor.
+        const auto& implicit_inputs = consumer->ImplicitInputDefs();
+        if (std::find(implicit_inputs.begin(), implicit_inputs.end(), def) != implicit_inputs.end()) {
+          rewritable = false;
+          break;
+        }
+        auto it = topo_position.find(consumer->Index());
+        if (it == topo_position.end() || it->second - producer_position < kMinTopologicalDistance ||
+            consumer->GetExecutionProviderType() != kCpuExecutionProvider) {
+          continue;
+        }
+        far_consumers.push_back(consumer);
+      }
+      if (!rewritable || far_consumers.empty()) {
+        continue;
+      }
+
+      *fp16_type.mutable_tensor_type()->mutable_shape() = *def->Shape();
+      *fp32_type.mutable_tensor_type()->mutable_shape() = *def->Shape();
+
+      NodeArg& compressed = graph.GetOrCreateNodeArg(graph.GenerateNodeArgName(def->Name() + "_fp16"), &fp16_type);
+      Node& compress = graph.AddNode(graph.GenerateNodeName(def->Name() + "_compress"), "Cast",
+                                     "stores a long-lived activation as fp16", {def}, {&compressed});
+      compress.AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_FLOAT16));
+      compress.SetExecutionProviderType(kCpuExecutionProvider);
+
+      NodeArg& restored = graph.GetOrCreateNodeArg(graph.GenerateNodeArgName(def->Name() + "_restored"), &fp32_type);
+      Node& restore = graph.AddNode(graph.GenerateNodeName(def->Name() + "_restore"), "Cast",
+                                    "restores a compressed activation to fp32", {&compressed}, {&restored});
+      restore.AddAttribute("to", static_cast<int64_t>(TensorProto_DataType_FLOAT));
+      restore.SetExecutionProviderType(kCpuExecutionProvider);
+
+      for (Node* consumer : far_consumers) {
+        const auto num_inputs = consumer->InputDefs().size();
+        for (size_t i = 0; i < num_inputs; ++i) {
+          if (consumer->InputDefs()[i] == def) {
+            graph_utils::ReplaceNodeInput(*consumer, static_cast<int>(i), restored);
+          }
+        }
+      }
+
+      LOGS(logger, INFO) << "Storing activation " << def->Name() << " as fp16 for "
+                         << far_consumers.size() << " distant consumer(s).";
+      modified = true;
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
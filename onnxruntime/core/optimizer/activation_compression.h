@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ActivationCompressionTransformer
+
+Stores large, long-lived fp32 activations as fp16 between their producer and distant consumers.
+For every float tensor whose size and producer-to-consumer topological distance exceed fixed
+thresholds, a Cast to float16 is inserted after the producer and a Cast back to float before the
+distant consumers, which are rerouted to the restored tensor. Consumers close to the producer keep
+reading the original fp32 tensor, so hot producer/consumer pairs are untouched; only the copy that
+would otherwise sit in memory for a long stretch of the execution is halved.
+
+This trades two element-wise casts for half the storage and read bandwidth of the compressed
+tensor, which pays off for bandwidth-bound models with large skip-connection style activations.
+It is opt-in (see kOrtSessionOptionsCompressLongLivedActivations) because the round-trip through
+fp16 loses precision.
+*/
+class ActivationCompressionTransformer : public GraphTransformer {
+ public:
+  ActivationCompressionTransformer(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ActivationCompressionTransformer", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
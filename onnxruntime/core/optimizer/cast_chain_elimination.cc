@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/logging/logging.h"
+#include "core/optimizer/rewrite_rule.h"
+#include "core/optimizer/cast_chain_elimination.h"
+#include "core/optimizer/utils.h"
+#include "core/graph/graph.h"
+#include "core/graph/graph_utils.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Returns true if a cast from 'from' to 'to' preserves every value representable in 'from',
+// so that casting onward from the intermediate type gives the same result as casting from
+// the source type directly.
+bool IsValuePreservingCast(int32_t from, int32_t to) {
+  namespace onnx = ONNX_NAMESPACE;
+
+  if (from == to) {
+    return true;
+  }
+
+  switch (from) {
+    case onnx::TensorProto_DataType_BOOL:
+    case onnx::TensorProto_DataType_INT8:
+      return to == onnx::TensorProto_DataType_INT16 ||
+             to == onnx::TensorProto_DataType_INT32 ||
+             to == onnx::TensorProto_DataType_INT64 ||
+             to == onnx::TensorProto_DataType_FLOAT ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_UINT8:
+      return to == onnx::TensorProto_DataType_UINT16 ||
+             to == onnx::TensorProto_DataType_UINT32 ||
+             to == onnx::TensorProto_DataType_UINT64 ||
+             to == onnx::TensorProto_DataType_INT16 ||
+             to == onnx::TensorProto_DataType_INT32 ||
+             to == onnx::TensorProto_DataType_INT64 ||
+             to == onnx::TensorProto_DataType_FLOAT ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_INT16:
+      return to == onnx::TensorProto_DataType_INT32 ||
+             to == onnx::TensorProto_DataType_INT64 ||
+             to == onnx::TensorProto_DataType_FLOAT ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_UINT16:
+      return to == onnx::TensorProto_DataType_UINT32 ||
+             to == onnx::TensorProto_DataType_UINT64 ||
+             to == onnx::TensorProto_DataType_INT32 ||
+             to == onnx::TensorProto_DataType_INT64 ||
+             to == onnx::TensorProto_DataType_FLOAT ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_INT32:
+      return to == onnx::TensorProto_DataType_INT64 ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_UINT32:
+      return to == onnx::TensorProto_DataType_UINT64 ||
+             to == onnx::TensorProto_DataType_INT64 ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_FLOAT16:
+      return to == onnx::TensorProto_DataType_FLOAT ||
+             to == onnx::TensorProto_DataType_DOUBLE;
+    case onnx::TensorProto_DataType_FLOAT:
+      return to == onnx::TensorProto_DataType_DOUBLE;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+Status CastChainElimination::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger&) const {
+  Node* parent = graph.GetMutableProducerNode(node.MutableInputDefs()[0]->Name());
+
+  // Removing the first Cast rewires this node to the source value, turning the chain into a
+  // single direct cast from the source type.
+  if (parent != nullptr && graph_utils::RemoveNode(graph, *parent)) {
+    rule_effect = RewriteRuleEffect::kModifiedRestOfGraph;
+  }
+
+  return Status::OK();
+}
+
+bool CastChainElimination::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const {
+  const Node* parent = graph_utils::GetInputNode(node, 0);
+  if (parent == nullptr ||
+      !graph_utils::IsSupportedOptypeVersionAndDomain(*parent, "Cast", {6, 9, 13, 19, 21})) {
+    return false;
+  }
+
+  // The intermediate value must be consumed by this node only; any other consumer expects the
+  // intermediate type and would be rewired to the source type.
+  if (parent->GetOutputEdgesCount() != 1 || !graph_utils::CanRemoveNode(graph, *parent, logger)) {
+    return false;
+  }
+
+  const auto* source_type = parent->InputDefs()[0]->TypeAsProto();
+  const auto* intermediate_type = node.InputDefs()[0]->TypeAsProto();
+  if (source_type == nullptr || !source_type->tensor_type().has_elem_type() ||
+      intermediate_type == nullptr || !intermediate_type->tensor_type().has_elem_type()) {
+    return false;
+  }
+
+  return IsValuePreservingCast(source_type->tensor_type().elem_type(),
+                               intermediate_type->tensor_type().elem_type());
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/rewrite_rule.h"
+
+namespace onnxruntime {
+
+/**
+@Class CastChainElimination
+
+Rewrite rule that eliminates the first Cast of a Cast->Cast chain when the intermediate type
+preserves every value of the source type (e.g. int32->int64->int32, fp16->fp32->fp16).
+The remaining Cast then converts directly from the source type; if it becomes a same-type
+cast it is removed by CastElimination.
+
+It is attempted to be triggered only on nodes with op type "Cast".
+*/
+class CastChainElimination : public RewriteRule {
+ public:
+  CastChainElimination() noexcept : RewriteRule("CastChainElimination") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Cast"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -6,6 +6,7 @@
 #include "core/graph/graph_utils.h"
 #include "core/framework/tensorprotoutils.h"
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -302,16 +303,23 @@ std::size_t GetAttributeHash(const ONNX_NAMESPACE::AttributeProto& attr) {
   return hash;
 }
 
-bool SameAttribute(const NodeAttributes::value_type& lhs, const NodeAttributes::value_type& rhs) {
-  return lhs.first == rhs.first && AreEqual(lhs.second, rhs.second);
-}
-
 bool SameAttributes(const NodeAttributes* lhs, const NodeAttributes* rhs) {
   if (lhs == nullptr || rhs == nullptr) {
     return lhs == rhs;
   }
-  return lhs->size() == rhs->size() &&
-         std::equal(lhs->begin(), lhs->end(), rhs->begin(), &SameAttribute);
+  if (lhs->size() != rhs->size()) {
+    return false;
+  }
+  // NodeAttributes is an unordered_map, so two maps with equal contents can iterate in different
+  // orders. Look each attribute up by name rather than comparing in iteration order, otherwise
+  // nodes that only differ in attribute insertion order are treated as distinct.
+  for (const auto& entry : *lhs) {
+    auto it = rhs->find(entry.first);
+    if (it == rhs->end() || !AreEqual(entry.second, it->second)) {
+      return false;
+    }
+  }
+  return true;
 }
 
 bool EquivalenceClass::operator==(const EquivalenceClass& other) const {
@@ -336,9 +344,20 @@ std::size_t EquivalenceClass::CalculateHash() const {
   UpdateHash(op_type_, hash);
   UpdateHash(domain_, hash);
   if (attributes_ != nullptr) {
+    // hash attributes sorted by name so the result is independent of the unordered_map
+    // iteration order, matching the order-independent comparison in SameAttributes
+    InlinedVector<const NodeAttributes::value_type*> sorted_attributes;
+    sorted_attributes.reserve(attributes_->size());
     for (const auto& kv : *attributes_) {
-      UpdateHash(kv.first, hash);
-      UpdateHash(kv.second, &GetAttributeHash, hash);
+      sorted_attributes.push_back(&kv);
+    }
+    std::sort(sorted_attributes.begin(), sorted_attributes.end(),
+              [](const NodeAttributes::value_type* l, const NodeAttributes::value_type* r) {
+                return l->first < r->first;
+              });
+    for (const auto* kv : sorted_attributes) {
+      UpdateHash(kv->first, hash);
+      UpdateHash(kv->second, &GetAttributeHash, hash);
     }
   }
 
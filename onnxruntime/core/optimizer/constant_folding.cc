@@ -9,6 +9,8 @@
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/optimizer_execution_frame.h"
 #include "core/optimizer/utils.h"
+#include "core/framework/kernel_registry.h"
+#include "core/framework/kernel_type_str_resolver.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
 
@@ -20,12 +22,31 @@ ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
                                  bool skip_dequantize_linear,
                                  const ConfigOptions& config_options,
                                  const InlinedHashSet<std::string_view>& compatible_execution_providers,
-                                 const InlinedHashSet<std::string>& excluded_initializers) noexcept
+                                 const InlinedHashSet<std::string>& excluded_initializers,
+                                 IExecutionProvider* device_execution_provider) noexcept
     : GraphTransformer("ConstantFolding", compatible_execution_providers),
       skip_dequantize_linear_(skip_dequantize_linear),
       config_options_(config_options),
       excluded_initializers_(excluded_initializers),
-      execution_provider_(execution_provider) {
+      execution_provider_(execution_provider),
+      device_execution_provider_(device_execution_provider) {
+  if (device_execution_provider_ != nullptr) {
+    // Folding on the device also needs the provider's default device allocator and a
+    // data transfer implementation to stage the inputs and read back the results.
+    const OrtDevice device = device_execution_provider_->GetOrtDeviceByMemType(OrtMemTypeDefault);
+    if (device.Type() != OrtDevice::CPU && device_execution_provider_->GetDataTransfer() != nullptr) {
+      for (auto& allocator : device_execution_provider->CreatePreferredAllocators()) {
+        if (allocator->Info().device == device) {
+          device_allocator_ = std::move(allocator);
+          break;
+        }
+      }
+    }
+
+    if (device_allocator_ == nullptr) {
+      device_execution_provider_ = nullptr;
+    }
+  }
 }
 
 // We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
@@ -225,14 +246,30 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         }
       }
 
+      // Fold on the device provider when one was supplied and it has a kernel for this node.
+      // Nodes without a device kernel still fold with the CPU provider.
+      bool fold_on_device = false;
+      if (device_execution_provider_ != nullptr) {
+        const KernelCreateInfo* device_kci = nullptr;
+        const OpSchemaKernelTypeStrResolver kernel_type_str_resolver{};
+        fold_on_device = device_execution_provider_->GetKernelRegistry()
+                             ->TryFindKernel(*node, device_execution_provider_->Type(),
+                                             kernel_type_str_resolver, &device_kci)
+                             .IsOK();
+      }
+
+      const IExecutionProvider& folding_ep = fold_on_device ? *device_execution_provider_ : execution_provider_;
+
 #if !defined(DISABLE_SPARSE_TENSORS)
       // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         is_sparse_initializer_check);
+      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), folding_ep,
+                                         is_sparse_initializer_check,
+                                         fold_on_device ? device_allocator_ : nullptr);
 #else
       // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         [](std::string const&) { return false; });
+      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), folding_ep,
+                                         [](std::string const&) { return false; },
+                                         fold_on_device ? device_allocator_ : nullptr);
 #endif
 
       std::vector<int> fetch_mlvalue_idxs;
@@ -240,17 +277,17 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
       }
 
-      const bool node_on_cpu_ep = node->GetExecutionProviderType() == kCpuExecutionProvider;
+      const bool node_on_folding_ep = node->GetExecutionProviderType() == folding_ep.Type();
 
       std::unique_ptr<const OpKernel> kernel;
 
-      if (!node_on_cpu_ep) {
+      if (!node_on_folding_ep) {
         // We need to copy the string here instead of taking a reference to it since node->SetExecutionProviderType
         // will change the value of the reference
         auto ep_type = node->GetExecutionProviderType();
 
-        // override the EP assigned to the node so that it will use the CPU kernel for Compute.
-        node->SetExecutionProviderType(kCpuExecutionProvider);
+        // override the EP assigned to the node so that it will use the folding EP's kernel for Compute.
+        node->SetExecutionProviderType(folding_ep.Type());
 
         kernel = info.CreateKernel(node, config_options_);
 
@@ -260,13 +297,12 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         kernel = info.CreateKernel(node, config_options_);
       }
 
-      // We currently constant fold using the CPU EP only.
-      // If we can't find a CPU kernel for this node, then we can't proceed with constant folding.
+      // If we can't find a kernel for this node on the folding EP, then we can't proceed with constant folding.
       //
       // TODO(adrianlizarraga): Support constant folding with other execution providers. For example, we may be able
       // to use a CUDA kernel to constant fold operators with data types not supported by the CPU EP kernel.
       if (kernel == nullptr) {
-        LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
+        LOGS(logger, WARNING) << "Could not find a " << folding_ep.Type() << " kernel and hence "
                               << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
 
         // Move on to the next candidate node
@@ -287,6 +323,27 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
       std::vector<OrtValue> fetches;
       ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
 
+      if (fold_on_device) {
+        // Bring the computed tensors back to CPU memory so they can be serialized into initializers below.
+        AllocatorPtr cpu_allocator = std::make_shared<CPUAllocator>();
+        for (OrtValue& ort_value : fetches) {
+          if (!ort_value.IsTensor()) {
+            continue;
+          }
+
+          const Tensor& device_tensor = ort_value.Get<Tensor>();
+          if (device_tensor.Location().device.Type() == OrtDevice::CPU) {
+            continue;
+          }
+
+          OrtValue cpu_value;
+          Tensor::InitOrtValue(device_tensor.DataType(), device_tensor.Shape(), cpu_allocator, cpu_value);
+          ORT_RETURN_IF_ERROR(info.GetDataTransferManager().CopyTensor(device_tensor,
+                                                                       *cpu_value.GetMutable<Tensor>()));
+          ort_value = std::move(cpu_value);
+        }
+      }
+
       // Go over all output node args and substitute them with the newly computed tensors, which will be
       // added to the graph as initializers.
       ORT_ENFORCE(fetches.size() == node->OutputDefs().size());
@@ -3,6 +3,7 @@
 
 #include <variant>
 
+#include "core/framework/murmurhash3.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/graph/graph_utils.h"
 #include "core/optimizer/initializer.h"
@@ -29,15 +30,14 @@ bool IsSupportedDataType(int32_t data_type) {
 
 using SupportedTypeList = boost::mp11::mp_list<MLFloat16, float, double, int32_t, int64_t>;
 
-// A threshold is defined here to restrict the graph transformation only applied to small tensors.
+// A threshold is defined here to separate small tensors, which are stored by value in the
+// constant store, from large tensors, which are deduplicated by content hash (also across
+// subgraph boundaries).
 // Be note: having a bigger threshold means more overhead when we do the graph transformations.
 // `8` is chosen to cover common constant use cases in some Reshape/Gather/Concat's inputs.
-// TODO(pengwa): we can gradually increase this threshold if we see more benefits (memory-saving
-// or more CSE optimizations triggered). Should be careful to cover test cases that assume initializer
-// name did not change after transformation then.
 
-bool IsAllowedToShare(const ONNX_NAMESPACE::TensorShapeProto* input_shape,
-                      int64_t& num_elements) {
+bool HasKnownElementCount(const ONNX_NAMESPACE::TensorShapeProto* input_shape,
+                          int64_t& num_elements) {
   if (input_shape == nullptr) return false;
 
   size_t dim_size = static_cast<size_t>(input_shape->dim_size());
@@ -48,18 +48,10 @@ bool IsAllowedToShare(const ONNX_NAMESPACE::TensorShapeProto* input_shape,
       return false;
     }
 
-    int64_t dim_value = dim.dim_value();
-    num_elements *= dim_value;
-    if (num_elements > ConstantSharing::TENSOR_ELEM_COUNT_THRESHOLD) {
-      return false;
-    }
-  }
-
-  if (num_elements > 0 && num_elements <= ConstantSharing::TENSOR_ELEM_COUNT_THRESHOLD) {
-    return true;
+    num_elements *= dim.dim_value();
   }
 
-  return false;
+  return num_elements > 0;
 }
 
 // Return true when initializer node arg is consumed by any node containing sub graphs;
@@ -171,6 +163,97 @@ size_t GetOrAddValueInConstantStore(
   return it - data_store.begin();
 }
 
+/**
+ * @brief Build a lookup key for a large initializer from its data type, shape and a content hash.
+ *
+ * Large initializers are not kept in the constant value store (holding all unpacked values alive
+ * would defeat the purpose of the memory saving); instead the hash identifies likely duplicates
+ * and the byte content is only re-compared on a key match.
+ */
+std::string MakeLargeInitializerKey(const Initializer& initializer) {
+  uint64_t hash[2] = {0, 0};
+  auto dims = initializer.dims();
+  MurmurHash3::x86_128(dims.data(), static_cast<int>(dims.size() * sizeof(int64_t)), 0, hash);
+
+  // MurmurHash3 takes an int length, so hash very large tensors in chunks, seeding each chunk
+  // with the running hash.
+  auto bytes = initializer.DataAsByteSpan();
+  constexpr size_t chunk_size = size_t{1} << 30;
+  size_t offset = 0;
+  while (offset < bytes.size()) {
+    const size_t len = std::min(chunk_size, bytes.size() - offset);
+    MurmurHash3::x86_128(bytes.data() + offset, static_cast<int>(len), static_cast<uint32_t>(hash[0]), hash);
+    offset += len;
+  }
+
+  return MakeString(initializer.data_type(), "_", dims.size(), "_", initializer.size(),
+                    "_", hash[0], "_", hash[1]);
+}
+
+bool InitializerContentEqual(const Initializer& lhs, const Initializer& rhs) {
+  return lhs.data_type() == rhs.data_type() &&
+         SpanEq(lhs.dims(), rhs.dims()) &&
+         SpanEq(lhs.DataAsByteSpan(), rhs.DataAsByteSpan());
+}
+
+// Return true when `name` is defined by `graph` itself, i.e. it is produced by a node, stored as
+// an initializer, or listed as a graph input. Outer-scope references do not count as definitions.
+bool DefinesNodeArg(const Graph& graph, const std::string& name) {
+  if (graph.GetProducerNode(name) != nullptr ||
+      graph.GetAllInitializedTensors().count(name) > 0) {
+    return true;
+  }
+
+  const auto& graph_inputs = graph.GetInputsIncludingInitializers();
+  return std::find_if(graph_inputs.begin(), graph_inputs.end(),
+                      [&name](const NodeArg* input) { return input->Name() == name; }) != graph_inputs.end();
+}
+
+/**
+ * @brief A large constant initializer owned by an ancestor graph that subgraph initializers can
+ *        be deduplicated against.
+ */
+struct OuterScopeInitializerEntry {
+  std::string name;
+  const Graph* owner;
+};
+
+// Collect the large constant initializers reachable from `graph` through its parent chain,
+// keyed by MakeLargeInitializerKey. When the same content exists at several levels, the
+// nearest ancestor wins.
+void CollectOuterScopeLargeInitializers(const Graph& graph,
+                                        InlinedHashMap<std::string, OuterScopeInitializerEntry>& candidates) {
+  for (const Graph* ancestor = graph.ParentGraph(); ancestor != nullptr; ancestor = ancestor->ParentGraph()) {
+    for (const auto& entry : ancestor->GetAllInitializedTensors()) {
+      const ONNX_NAMESPACE::TensorProto* tensor_proto = ancestor->GetConstantInitializer(entry.first, true);
+      if (!tensor_proto || !IsSupportedDataType(tensor_proto->data_type())) {
+        continue;
+      }
+
+      Initializer initializer{*tensor_proto, ancestor->ModelPath()};
+      if (static_cast<int64_t>(initializer.size()) <= ConstantSharing::TENSOR_ELEM_COUNT_THRESHOLD) {
+        continue;
+      }
+
+      // A name defined by a graph between `graph` and the ancestor resolves to the nearer
+      // definition, so the ancestor's initializer would not be reachable from here.
+      bool shadowed = false;
+      for (const Graph* between = graph.ParentGraph(); between != ancestor; between = between->ParentGraph()) {
+        if (DefinesNodeArg(*between, entry.first)) {
+          shadowed = true;
+          break;
+        }
+      }
+      if (shadowed) {
+        continue;
+      }
+
+      candidates.try_emplace(MakeLargeInitializerKey(initializer),
+                             OuterScopeInitializerEntry{entry.first, ancestor});
+    }
+  }
+}
+
 }  // namespace
 
 Status ConstantSharing::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/,
@@ -198,11 +281,19 @@ Status ConstantSharing::ApplyImpl(Graph& graph, bool& modified, int /*graph_leve
   // and it will be hard to read. Instead, a constant value store is maintained, then the value index is used as the
   // value unique id when construct pattern key.
   InlinedHashMap<std::string, InlinedVector<std::unique_ptr<InitializerValue>>> const_value_store;
+
+  // Large initializers (above TENSOR_ELEM_COUNT_THRESHOLD elements) are deduplicated by content
+  // hash instead of going through the constant value store. For subgraphs, the parent chain is
+  // consulted first so a duplicated weight is replaced by a reference to the parent-owned copy.
+  InlinedHashMap<std::string, NodeArg*> large_pattern_key_to_shared_arg_map;
+  InlinedHashMap<std::string, OuterScopeInitializerEntry> outer_scope_candidates;
+  bool outer_scope_candidates_collected = false;
+
   for (const auto& initializer_name : original_initializer_names) {
     NodeArg* origin_initializer_node_arg = graph.GetNodeArg(initializer_name);
     int64_t num_elements = 1;
     if (origin_initializer_node_arg == nullptr ||
-        !IsAllowedToShare(origin_initializer_node_arg->Shape(), num_elements)) {
+        !HasKnownElementCount(origin_initializer_node_arg->Shape(), num_elements)) {
       continue;
     }
 
@@ -221,6 +312,68 @@ Status ConstantSharing::ApplyImpl(Graph& graph, bool& modified, int /*graph_leve
     if (found_subgraph_usage || consumer_node_to_input_ports_map.size() == 0) {
       continue;
     }
+
+    if (num_elements > TENSOR_ELEM_COUNT_THRESHOLD) {
+      Initializer origin_initializer{*tensor_proto, graph.ModelPath()};
+      const std::string pattern_key = MakeLargeInitializerKey(origin_initializer);
+
+      // Prefer a parent-owned copy over a local one, so that all subgraphs sharing the same
+      // weight end up referencing a single buffer at the outermost level that has it.
+      if (graph.IsSubgraph()) {
+        if (!outer_scope_candidates_collected) {
+          CollectOuterScopeLargeInitializers(graph, outer_scope_candidates);
+          outer_scope_candidates_collected = true;
+        }
+
+        auto outer_it = outer_scope_candidates.find(pattern_key);
+        if (outer_it != outer_scope_candidates.end()) {
+          const OuterScopeInitializerEntry& candidate = outer_it->second;
+          const ONNX_NAMESPACE::TensorProto* candidate_proto =
+              candidate.owner->GetConstantInitializer(candidate.name, true);
+          const bool name_usable = candidate.name == initializer_name ||
+                                   !DefinesNodeArg(graph, candidate.name);
+          if (candidate_proto != nullptr && name_usable) {
+            Initializer candidate_initializer{*candidate_proto, candidate.owner->ModelPath()};
+            if (InitializerContentEqual(origin_initializer, candidate_initializer)) {
+              if (candidate.name == initializer_name) {
+                // Same name as the parent-owned copy: dropping the local initializer is enough,
+                // consumers then resolve the name to the outer scope value.
+                graph.RemoveInitializedTensor(initializer_name);
+              } else {
+                NodeArg& outer_scope_node_arg = graph.GetOrCreateNodeArg(
+                    candidate.name, origin_initializer_node_arg->TypeAsProto());
+                ReplaceInputsToUseSharedInitializer(graph, consumer_node_to_input_ports_map,
+                                                    origin_initializer_node_arg, &outer_scope_node_arg);
+              }
+              graph.AddOuterScopeNodeArg(candidate.name);
+              shared_count += 1;
+              modified = true;
+              continue;
+            }
+          }
+        }
+      }
+
+      // Deduplicate against other large initializers within this graph.
+      auto local_it = large_pattern_key_to_shared_arg_map.find(pattern_key);
+      if (local_it == large_pattern_key_to_shared_arg_map.end()) {
+        large_pattern_key_to_shared_arg_map.emplace(pattern_key, origin_initializer_node_arg);
+      } else {
+        const ONNX_NAMESPACE::TensorProto* shared_proto = graph.GetConstantInitializer(
+            local_it->second->Name(), true);
+        if (shared_proto != nullptr) {
+          Initializer shared_initializer{*shared_proto, graph.ModelPath()};
+          if (InitializerContentEqual(origin_initializer, shared_initializer)) {
+            shared_count += 1;
+            ReplaceInputsToUseSharedInitializer(graph, consumer_node_to_input_ports_map,
+                                                origin_initializer_node_arg, local_it->second);
+            modified = true;
+          }
+        }
+      }
+      continue;
+    }
+
     const std::string data_store_key = MakeString(tensor_proto->data_type(),
                                                   "_", origin_initializer_node_arg->Shape()->dim_size(),
                                                   "_", num_elements);
@@ -245,7 +398,7 @@ Status ConstantSharing::ApplyImpl(Graph& graph, bool& modified, int /*graph_leve
     }
   }
   if (shared_count > 0) {
-    LOGS(logger, INFO) << "Total shared scalar initializer count: " << shared_count;
+    LOGS(logger, INFO) << "Total shared initializer count: " << shared_count;
   }
   return Status::OK();
 }
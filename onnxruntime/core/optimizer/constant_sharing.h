@@ -15,7 +15,10 @@ namespace onnxruntime {
 
 Transformer that traverses the graph top-down and performs constant sharing, i.e.,
 constant initializers having same data type, value and shape, will be replaced by one single initializer.
-Currently, only scalar-valued initializers are handled.
+Small initializers (up to TENSOR_ELEM_COUNT_THRESHOLD elements) are compared by value; larger
+initializers are deduplicated by content hash. For subgraphs, a large initializer that duplicates
+one owned by an ancestor graph is replaced by an outer-scope reference to the parent-owned copy,
+so exporters that clone weights into every If/Loop branch no longer pay for each copy.
 */
 class ConstantSharing : public GraphTransformer {
  public:
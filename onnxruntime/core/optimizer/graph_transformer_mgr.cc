@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "core/optimizer/graph_transformer_mgr.h"
+
+#include <algorithm>
+
 #include "core/optimizer/rule_based_graph_transformer.h"
 
 using namespace onnxruntime;
@@ -9,6 +12,22 @@ using namespace ::onnxruntime::common;
 
 namespace onnxruntime {
 
+namespace {
+// Collects the op types present in the graph, including nodes in subgraphs, so that
+// transformers which declare their target op types can be skipped when the graph
+// contains no candidate nodes.
+void CollectOpTypes(const Graph& graph, InlinedHashSet<std::string>& op_types) {
+  for (const auto& node : graph.Nodes()) {
+    op_types.insert(node.OpType());
+    if (node.ContainsSubgraph()) {
+      for (const auto& subgraph : node.GetSubgraphs()) {
+        CollectOpTypes(*subgraph, op_types);
+      }
+    }
+  }
+}
+}  // namespace
+
 common::Status GraphTransformerManager::SetSteps(unsigned steps) {
   steps_ = steps;
   return Status::OK();
@@ -26,18 +45,53 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     return Status::OK();
   }
 
-  for (unsigned step = 0; step < steps_; ++step) {
-    bool graph_changed = false;
-    for (const auto& transformer : transformers->second) {
-      if (step > 0 && transformer->ShouldOnlyApplyOnce())
+  const auto& transformer_list = transformers->second;
+  const size_t transformer_count = transformer_list.size();
+
+  // The fixed point is reached once every transformer has been applied (or skipped) without the graph
+  // being modified since the last rewrite. Tracking that across step boundaries avoids re-running the
+  // transformers that already saw the final graph during the step in which the last rewrite occurred.
+  size_t clean_runs = 0;
+
+  // Index of the op types present in the graph. Built lazily and invalidated whenever a transformer
+  // modifies the graph, so transformers with no candidate nodes are skipped without a full-graph pass.
+  InlinedHashSet<std::string> op_type_index;
+  bool op_type_index_valid = false;
+
+  for (unsigned step = 0; step < steps_ && clean_runs < transformer_count; ++step) {
+    for (const auto& transformer : transformer_list) {
+      if (step > 0 && transformer->ShouldOnlyApplyOnce()) {
+        // The transformer will never run again, so it counts towards the fixed point.
+        if (++clean_runs == transformer_count) break;
         continue;
+      }
+
+      const auto target_op_types = transformer->TargetOpTypes();
+      if (!target_op_types.empty()) {
+        if (!op_type_index_valid) {
+          op_type_index.clear();
+          CollectOpTypes(graph, op_type_index);
+          op_type_index_valid = true;
+        }
+
+        const bool have_candidates = std::any_of(target_op_types.cbegin(), target_op_types.cend(),
+                                                 [&op_type_index](const std::string& op_type) {
+                                                   return op_type_index.find(op_type) != op_type_index.cend();
+                                                 });
+        if (!have_candidates) {
+          if (++clean_runs == transformer_count) break;
+          continue;
+        }
+      }
 
       bool modified = false;
       ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
-      graph_changed = graph_changed || modified;
-    }
-    if (!graph_changed) {
-      break;
+      if (modified) {
+        clean_runs = 0;
+        op_type_index_valid = false;
+      } else if (++clean_runs == transformer_count) {
+        break;
+      }
     }
   }
 
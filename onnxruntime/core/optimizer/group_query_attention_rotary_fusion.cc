@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/group_query_attention_rotary_fusion.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+int64_t GetIntAttrOrDefault(const Node& node, const std::string& attr_name, int64_t default_value) {
+  const auto* attr = graph_utils::GetNodeAttribute(node, attr_name);
+  return attr != nullptr ? attr->i() : default_value;
+}
+
+// A RotaryEmbedding node can only be folded into GroupQueryAttention when it relies on the
+// behavior the fused kernels reproduce: rotation over the full head (no custom
+// rotary_embedding_dim or num_heads) and no output scaling. Its output must feed nothing but
+// the attention node, since the rotated value disappears from the graph after the fusion.
+bool IsFusableRotaryEmbedding(const Graph& graph, const Node& rotary) {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(rotary, "RotaryEmbedding", {1}, kMSDomain)) {
+    return false;
+  }
+
+  if (GetIntAttrOrDefault(rotary, "rotary_embedding_dim", 0) != 0 ||
+      GetIntAttrOrDefault(rotary, "num_heads", 0) != 0) {
+    return false;
+  }
+
+  const auto* scale_attr = graph_utils::GetNodeAttribute(rotary, "scale");
+  if (scale_attr != nullptr && scale_attr->f() != 1.0f) {
+    return false;
+  }
+
+  return optimizer_utils::CheckOutputEdges(graph, rotary, 1) &&
+         !graph.NodeProducesGraphOutput(rotary);
+}
+
+}  // namespace
+
+Status GroupQueryAttentionRotaryFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                                  const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "GroupQueryAttention", {1}, kMSDomain) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // The attention node must not already apply rotary embedding, must take separate (non-packed)
+    // query and key inputs, and must not have cos/sin caches bound yet.
+    if (GetIntAttrOrDefault(node, "do_rotary", 0) != 0) {
+      continue;
+    }
+
+    auto& gqa_inputs = node.MutableInputDefs();
+    if (gqa_inputs.size() < 7 || !gqa_inputs[1]->Exists()) {
+      continue;
+    }
+
+    if ((gqa_inputs.size() > 7 && gqa_inputs[7]->Exists()) ||
+        (gqa_inputs.size() > 8 && gqa_inputs[8]->Exists())) {
+      continue;
+    }
+
+    Node* q_rotary = graph.GetMutableProducerNode(gqa_inputs[0]->Name());
+    Node* k_rotary = graph.GetMutableProducerNode(gqa_inputs[1]->Name());
+    if (q_rotary == nullptr || k_rotary == nullptr || q_rotary == k_rotary ||
+        !IsFusableRotaryEmbedding(graph, *q_rotary) ||
+        !IsFusableRotaryEmbedding(graph, *k_rotary) ||
+        q_rotary->GetExecutionProviderType() != node.GetExecutionProviderType() ||
+        k_rotary->GetExecutionProviderType() != node.GetExecutionProviderType()) {
+      continue;
+    }
+
+    // Both rotations must use the same positions and caches and agree on the rotation layout.
+    auto& q_rotary_inputs = q_rotary->MutableInputDefs();
+    auto& k_rotary_inputs = k_rotary->MutableInputDefs();
+    if (q_rotary_inputs[1]->Name() != k_rotary_inputs[1]->Name() ||
+        q_rotary_inputs[2]->Name() != k_rotary_inputs[2]->Name() ||
+        q_rotary_inputs[3]->Name() != k_rotary_inputs[3]->Name()) {
+      continue;
+    }
+
+    const int64_t interleaved = GetIntAttrOrDefault(*q_rotary, "interleaved", 0);
+    if (interleaved != GetIntAttrOrDefault(*k_rotary, "interleaved", 0)) {
+      continue;
+    }
+
+    InlinedVector<NodeArg*> fused_inputs(gqa_inputs.begin(), gqa_inputs.begin() + 7);
+    fused_inputs[0] = q_rotary_inputs[0];
+    fused_inputs[1] = k_rotary_inputs[0];
+    fused_inputs.push_back(q_rotary_inputs[2]);  // cos_cache
+    fused_inputs.push_back(q_rotary_inputs[3]);  // sin_cache
+
+    Node& fused_gqa = graph.AddNode(graph.GenerateNodeName(node.Name() + "/GQARotaryFusion/"),
+                                    "GroupQueryAttention",
+                                    "fused RotaryEmbedding and GroupQueryAttention",
+                                    fused_inputs,
+                                    {},
+                                    &node.GetAttributes(),
+                                    kMSDomain);
+    fused_gqa.AddAttribute("do_rotary", static_cast<int64_t>(1));
+    fused_gqa.AddAttribute("rotary_interleaved", interleaved);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_gqa.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    // The rotary outputs have no consumer besides the attention node, so the rotary nodes can
+    // be dropped once their edges into it are removed.
+    graph_utils::RemoveNodeOutputEdges(graph, *q_rotary);
+    graph.RemoveNode(q_rotary->Index());
+    graph_utils::RemoveNodeOutputEdges(graph, *k_rotary);
+    graph.RemoveNode(k_rotary->Index());
+
+    graph_utils::FinalizeNodeFusion(graph, fused_gqa, node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class GroupQueryAttentionRotaryFusion
+
+Folds the RotaryEmbedding nodes feeding the query and key inputs of a GroupQueryAttention node
+into the attention node itself by setting do_rotary=1 and binding the cos/sin caches as the
+attention node's optional inputs. The GroupQueryAttention kernels apply the rotation during
+QKV preparation, which removes two standalone kernel launches and a full read/write of the
+rotated query and key per layer. Because every fused node references the same cache
+initializers, the caches stay resident on the device and are shared across all layers.
+
+GroupQueryAttention derives the rotation positions from its seqlens_k input (past length plus
+token offset per batch entry), which matches the position_ids the standard exporters generate
+for this pattern. The fusion therefore only fires when both rotary nodes use the default
+full-head rotation, agree on the interleaved layout, and share the same position_ids and
+cos/sin cache values, and when their outputs feed nothing but the attention node.
+*/
+class GroupQueryAttentionRotaryFusion : public GraphTransformer {
+ public:
+  GroupQueryAttentionRotaryFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("GroupQueryAttentionRotaryFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  std::vector<std::string> TargetOpTypes() const noexcept override { return {"GroupQueryAttention"}; }
+};
+
+}  // namespace onnxruntime
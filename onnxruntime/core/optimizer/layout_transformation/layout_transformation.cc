@@ -13,8 +13,6 @@ using namespace onnx_transpose_optimization;
 
 namespace onnxruntime {
 namespace layout_transformation {
-namespace {
-// Cost check for aggressively pushing the Transpose nodes involved in the layout transformation further out.
 CostCheckResult PostLayoutTransformCostCheck(const api::GraphRef& graph, const api::NodeRef& node,
                                              const std::vector<int64_t>& perm,
                                              const std::unordered_set<std::string>& outputs_leading_to_transpose) {
@@ -30,6 +28,7 @@ CostCheckResult PostLayoutTransformCostCheck(const api::GraphRef& graph, const a
   return OrtEPCostCheck(graph, node, perm, outputs_leading_to_transpose);
 }
 
+namespace {
 #if defined(USE_CUDA) && ENABLE_CUDA_NHWC_OPS
 // TODO(mtavenrath) generate list from registered kernels using nhwc domain
 const std::unordered_set<std::string_view>& GetCUDALayoutSensitiveOps() {
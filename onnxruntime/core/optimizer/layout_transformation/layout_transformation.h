@@ -72,6 +72,21 @@ bool IsSupportedOpset(const Graph& graph);
 /// <returns>unordered set of op_types which are layout sensitive</returns>
 const std::unordered_set<std::string_view>& GetORTLayoutSensitiveOps();
 
+/// <summary>
+/// Cost check for aggressively pushing the Transpose nodes involved in the layout transformation further out.
+///
+/// Transposes with channel-first/channel-last perms are pushed through all ops that support it (except Concat,
+/// where doing so can add Transposes to the other inputs) so that the interior of a converted subgraph runs
+/// transpose-free. Other perms fall back to the default ORT cost check.
+/// </summary>
+/// <param name="graph">Graph being optimized</param>
+/// <param name="node">Node the Transpose would be pushed through</param>
+/// <param name="perm">Permutation of the Transpose</param>
+/// <param name="outputs_leading_to_transpose">Set of outputs that lead to another Transpose</param>
+onnx_transpose_optimization::CostCheckResult PostLayoutTransformCostCheck(
+    const onnx_transpose_optimization::api::GraphRef& graph, const onnx_transpose_optimization::api::NodeRef& node,
+    const std::vector<int64_t>& perm, const std::unordered_set<std::string>& outputs_leading_to_transpose);
+
 /// <summary>
 /// Inserts transposes around op inputs/outputs. Alternatively transposes initializers or uses existing Transpose
 /// nodes if possible. Populates shape information on affected node inputs/outputs to reflect the change.
@@ -196,6 +196,106 @@ constexpr static bool IsAllowedFusedMatMulDataType(ONNX_NAMESPACE::TensorProto_D
          element_type == ONNX_NAMESPACE::TensorProto_DataType_BFLOAT16;
 }
 
+/* FuseMatMulWithOutputTranspose:
+ *  Fold a Transpose of a MatMul's (or FusedMatMul's) output into a FusedMatMul using (A x B)^T = B^T x A^T,
+ *  i.e. swap the two inputs and flip both transA/transB. Only a Transpose that swaps the two innermost
+ *  dims and leaves the batch dims in place can be expressed this way.
+ */
+static bool FuseMatMulWithOutputTranspose(Graph& graph, Node& transpose_node) {
+  std::vector<int64_t> perms;
+  if (!GetTransposePerms(transpose_node, perms)) {
+    return false;
+  }
+
+  size_t rank = perms.size();
+  if (rank < 2 ||
+      perms[rank - 2] != static_cast<int64_t>(rank) - 1 ||
+      perms[rank - 1] != static_cast<int64_t>(rank) - 2) {
+    return false;
+  }
+  for (size_t i = 0; i < rank - 2; ++i) {
+    if (perms[i] != static_cast<int64_t>(i)) {
+      return false;
+    }
+  }
+
+  Node* matmul = graph.GetMutableProducerNode(transpose_node.MutableInputDefs()[0]->Name());
+  if (matmul == nullptr ||
+      (!graph_utils::IsSupportedOptypeVersionAndDomain(*matmul, "MatMul", {9, 13}) &&
+       !graph_utils::IsSupportedOptypeVersionAndDomain(*matmul, "FusedMatMul", {1}, kMSDomain)) ||
+      matmul->GetExecutionProviderType() != transpose_node.GetExecutionProviderType()) {
+    return false;
+  }
+
+  // The MatMul output must feed only this Transpose.
+  if (matmul->GetOutputEdgesCount() != 1 || graph.NodeProducesGraphOutput(*matmul)) {
+    return false;
+  }
+
+  // Prefer the input side fusion below: if the Transpose also feeds a MatMul it can be folded there
+  // without swapping operands, so leave it alone here.
+  for (const Node* consumer : graph.GetConsumerNodes(transpose_node.OutputDefs()[0]->Name())) {
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(*consumer, "MatMul", {9, 13}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(*consumer, "FusedMatMul", {1}, kMSDomain)) {
+      return false;
+    }
+  }
+
+  NodeArg* a_input = matmul->MutableInputDefs()[0];
+  NodeArg* b_input = matmul->MutableInputDefs()[1];
+  auto element_type = a_input->TypeAsProto()->tensor_type().elem_type();
+  if (!IsAllowedFusedMatMulDataType(static_cast<ONNX_NAMESPACE::TensorProto_DataType>(element_type))) {
+    return false;
+  }
+
+  // Swapping the inputs is only valid when neither side relies on MatMul's 1-D promotion rules,
+  // so require both ranks to be known and >= 2. Swapping also requires two distinct input defs,
+  // as FinalizeNodeFusion moves input edges to the slot with a matching arg name.
+  const auto* a_shape = a_input->Shape();
+  const auto* b_shape = b_input->Shape();
+  if (!a_shape || !b_shape || a_shape->dim_size() < 2 || b_shape->dim_size() < 2 || a_input == b_input) {
+    return false;
+  }
+
+  bool is_trans_a = false;
+  bool is_trans_b = false;
+  float alpha = 1.0f;
+  if (matmul->OpType() == "FusedMatMul") {
+    const auto& attrs = matmul->GetAttributes();
+    if (attrs.at("transBatchA").i() != 0 || attrs.at("transBatchB").i() != 0) {
+      return false;
+    }
+    is_trans_a = attrs.at("transA").i() != 0;
+    is_trans_b = attrs.at("transB").i() != 0;
+    alpha = attrs.at("alpha").f();
+  }
+
+  const std::array input_defs{b_input, a_input};
+  const std::array output_defs{transpose_node.MutableOutputDefs()[0]};
+
+  Node& fused_node = graph.AddNode(graph.GenerateNodeName(matmul->Name() + "/MatmulTransposeFusion/"),
+                                   "FusedMatMul",
+                                   "fused MatMul and Transpose ",
+                                   input_defs,
+                                   output_defs, {}, kMSDomain);
+  fused_node.AddAttribute("transA", static_cast<int64_t>(!is_trans_b));
+  fused_node.AddAttribute("transB", static_cast<int64_t>(!is_trans_a));
+  fused_node.AddAttribute("transBatchA", static_cast<int64_t>(0));
+  fused_node.AddAttribute("transBatchB", static_cast<int64_t>(0));
+  fused_node.AddAttribute("alpha", alpha);
+  fused_node.SetExecutionProviderType(matmul->GetExecutionProviderType());
+#ifdef USE_ROCM
+  // forward the __backwardpass, if present
+  const auto& matmul_attrs = matmul->GetAttributes();
+  if (matmul_attrs.count("__backwardpass")) {
+    fused_node.AddAttribute("__backwardpass", static_cast<int64_t>(matmul_attrs.at("__backwardpass").i()));
+  }
+#endif
+
+  graph_utils::FinalizeNodeFusion(graph, {*matmul, transpose_node}, fused_node);
+  return true;
+}
+
 /*********************************************************************************************
 
 Case I: The followin is a scenario where Transpose output feeds MatMul. The Transpose input can be either on the left or right.
@@ -285,6 +385,10 @@ Case II: The output of Tanspose feeds Cast and the output from the Cast feeds Ma
                                                   |
                                                   V
 
+Case III: The output of MatMul feeds a Transpose that swaps the two innermost dims. Using
+   (A x B)^T = B^T x A^T, the pair is replaced by a single FusedMatMul with swapped inputs
+   and both transA/transB flipped. See FuseMatMulWithOutputTranspose above.
+
 ********************************************************************************************************************/
 
 Status MatmulTransposeFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
@@ -298,6 +402,14 @@ Status MatmulTransposeFusion::ApplyImpl(Graph& graph, bool& modified, int graph_
     auto& node = *graph.GetNode(node_index);
     ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
 
+    if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13}) &&
+        graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      if (FuseMatMulWithOutputTranspose(graph, node)) {
+        modified = true;
+      }
+      continue;
+    }
+
     if ((!graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {9, 13}) &&
          !graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedMatMul", {1}, kMSDomain)) ||
         !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
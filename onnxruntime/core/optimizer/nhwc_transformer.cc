@@ -228,7 +228,9 @@ Status NhwcTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
   }
 
   if (modified) {
-    Optimize(*api_graph, kCpuExecutionProvider, OrtEPCostCheck, OrtExtendedHandlers());
+    // Push the layout transposes we just inserted through the surrounding elementwise/pool/resize nodes so
+    // chains of converted ops execute transpose-free, matching what TransformLayoutForEP does for other EPs.
+    Optimize(*api_graph, kCpuExecutionProvider, PostLayoutTransformCostCheck, OrtExtendedHandlers());
   }
 
   return Status::OK();
@@ -32,16 +32,27 @@ OptimizerExecutionFrame::Info::Info(const std::vector<const Node*>& nodes,
                                     const InitializedTensorSet& initialized_tensor_set,
                                     const Path& model_path,
                                     const IExecutionProvider& execution_provider,
-                                    const std::function<bool(const std::string&)>& is_sparse_initializer_func)
+                                    const std::function<bool(const std::string&)>& is_sparse_initializer_func,
+                                    AllocatorPtr device_allocator)
     : execution_provider_(execution_provider),
       is_sparse_initializer_func_(is_sparse_initializer_func) {
-  allocator_ptr_ = std::make_shared<CPUAllocator>();
+  AllocatorPtr cpu_allocator = std::make_shared<CPUAllocator>();
+  allocator_ptr_ = device_allocator != nullptr ? std::move(device_allocator) : cpu_allocator;
   ORT_ENFORCE(allocator_ptr_, "Failed to get allocator for optimizer");
 
   ORT_THROW_IF_ERROR(data_transfer_mgr_.RegisterDataTransfer(std::make_unique<CPUDataTransfer>()));
 
+  const bool on_device = allocator_ptr_->Info().device.Type() != OrtDevice::CPU;
+  if (on_device) {
+    auto device_data_transfer = execution_provider.GetDataTransfer();
+    ORT_ENFORCE(device_data_transfer != nullptr,
+                "Execution provider ", execution_provider.Type(), " has no data transfer for device folding");
+    ORT_THROW_IF_ERROR(data_transfer_mgr_.RegisterDataTransfer(std::move(device_data_transfer)));
+  }
+
   // Create MLValues related maps
-  auto initialize_maps = [this, &initialized_tensor_set, &model_path](const NodeArg& arg, size_t /*index*/) -> Status {
+  auto initialize_maps = [this, &initialized_tensor_set, &model_path, &cpu_allocator, on_device](
+                             const NodeArg& arg, size_t /*index*/) -> Status {
     int idx = ort_value_name_idx_map_.Add(arg.Name());
     ort_value_idx_nodearg_map_.insert_or_assign(idx, &arg);
 
@@ -53,7 +64,15 @@ OptimizerExecutionFrame::Info::Info(const std::vector<const Node*>& nodes,
       ORT_RETURN_IF_ERROR(
           utils::TensorProtoToOrtValue(Env::Default(),
                                        model_path.IsEmpty() ? nullptr : model_path.ToPathString().c_str(),
-                                       tensor_proto, allocator_ptr_, ort_value));
+                                       tensor_proto, cpu_allocator, ort_value));
+
+      if (on_device && ort_value.IsTensor()) {
+        const Tensor& cpu_tensor = ort_value.Get<Tensor>();
+        OrtValue device_value;
+        Tensor::InitOrtValue(cpu_tensor.DataType(), cpu_tensor.Shape(), allocator_ptr_, device_value);
+        ORT_RETURN_IF_ERROR(data_transfer_mgr_.CopyTensor(cpu_tensor, *device_value.GetMutable<Tensor>()));
+        ort_value = std::move(device_value);
+      }
 
       initializers_[idx] = std::move(ort_value);
     }
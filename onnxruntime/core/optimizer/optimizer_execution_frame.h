@@ -22,11 +22,15 @@ class OptimizerExecutionFrame final : public IExecutionFrame {
  public:
   class Info {
    public:
+    // device_allocator is only needed when execution_provider is a non-CPU provider.
+    // When supplied, the initializers are copied to the provider's device and node
+    // outputs are allocated there, so the provider's kernels can execute directly.
     Info(const std::vector<const Node*>& nodes,
          const InitializedTensorSet& initialized_tensor_set,
          const Path& model_path,
          const IExecutionProvider& execution_provider,
-         const std::function<bool(const std::string&)>& is_sparse_initializer_func);
+         const std::function<bool(const std::string&)>& is_sparse_initializer_func,
+         AllocatorPtr device_allocator = nullptr);
 
     Info(const std::vector<const Node*>& nodes,
          const std::unordered_map<std::string, OrtValue>& initialized_tensor_set,
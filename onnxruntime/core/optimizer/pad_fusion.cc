@@ -48,11 +48,6 @@ bool PadFusion::SatisfyCondition(const Graph& graph, const Node& node, const log
     return false;
   }
 
-  // This pass currently assumed that this attribute already exists on the child node
-  if (child_node.GetAttributes().find("pads") == child_node.GetAttributes().end()) {
-    return false;
-  }
-
   const NodeAttributes& pad_attributes = node.GetAttributes();
   if (pad_attributes.find("mode") != pad_attributes.end() &&
       pad_attributes.at("mode").s() != "constant") {
@@ -114,6 +109,12 @@ Status PadFusion::Apply(Graph& graph, Node& pad_node, RewriteRuleEffect& rule_ef
   }
 
   Node& child_node = *graph.GetNode(pad_node.OutputNodesBegin()->Index());
+  // Conv/MaxPool treat a missing "pads" attribute as all zeros; materialize it so the
+  // Pad amounts have somewhere to go. The spatial rank is the Pad rank minus the batch
+  // and channel dimensions.
+  if (child_node.GetAttributes().find("pads") == child_node.GetAttributes().end()) {
+    child_node.AddAttribute("pads", std::vector<int64_t>(pads_size - 4, 0));
+  }
   auto child_pads = child_node.GetMutableAttributes()["pads"].mutable_ints();
   uint32_t child_pads_size = static_cast<uint32_t>(child_pads->size());
 
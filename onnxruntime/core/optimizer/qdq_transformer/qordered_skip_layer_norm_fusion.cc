@@ -0,0 +1,120 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/qdq_transformer/qordered_skip_layer_norm_fusion.h"
+#include "core/optimizer/qdq_transformer/qdq_util.h"
+#include "core/optimizer/utils.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace onnxruntime::common;
+namespace onnxruntime {
+
+// The qordered kernels assume symmetric int8 quantization, so the Q/DQ nodes being folded away
+// must carry a zero point that is absent or a constant int8 zero.
+static bool HasZeroInt8ZeroPoint(const Graph& graph, const Node& node) {
+  const auto& input_defs = node.InputDefs();
+  if (input_defs.size() < QDQ::InputIndex::TOTAL_COUNT ||
+      !input_defs[QDQ::InputIndex::ZERO_POINT_ID]->Exists()) {
+    return true;
+  }
+
+  const NodeArg& zp_def = *input_defs[QDQ::InputIndex::ZERO_POINT_ID];
+  const ONNX_NAMESPACE::TensorProto* zp_tensor_proto = nullptr;
+  if (!graph_utils::NodeArgIsConstant(graph, zp_def) ||
+      !graph.GetInitializedTensor(zp_def.Name(), zp_tensor_proto)) {
+    return false;
+  }
+
+  Initializer zero_point(*zp_tensor_proto, graph.ModelPath());
+  return zero_point.size() == 1 &&
+         zero_point.data_type() == ONNX_NAMESPACE::TensorProto_DataType_INT8 &&
+         zero_point.data<int8_t>()[0] == 0;
+}
+
+static bool IsSupportedDQ(const Graph& graph, const Node& node) {
+  if (!QDQ::MatchDQNode(node) || !optimizer_utils::CheckOutputEdges(graph, node, 1)) {
+    return false;
+  }
+
+  const auto& input_defs = node.InputDefs();
+  const std::string* input_type = input_defs[QDQ::InputIndex::INPUT_ID]->Type();
+  if (input_type == nullptr || *input_type != "tensor(int8)") {
+    return false;
+  }
+
+  // The scale is rewired to a scalar CPU input of the fused node.
+  const NodeArg& scale_def = *input_defs[QDQ::InputIndex::SCALE_ID];
+  if (!graph_utils::NodeArgIsConstant(graph, scale_def) || !optimizer_utils::IsScalar(scale_def)) {
+    return false;
+  }
+
+  return HasZeroInt8ZeroPoint(graph, node);
+}
+
+bool QOrderedSkipLayerNormFusion::SatisfyCondition(const Graph& graph, const Node& node,
+                                                   const logging::Logger& /*logger*/) const {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "QOrderedLayerNormalization", {1}, kMSDomain)) {
+    return false;
+  }
+
+  const Node* q_node = graph_utils::GetInputNode(node, 0);
+  if (q_node == nullptr || !QDQ::MatchQNode(*q_node) ||
+      !optimizer_utils::CheckOutputEdges(graph, *q_node, 1) ||
+      !HasZeroInt8ZeroPoint(graph, *q_node)) {
+    return false;
+  }
+
+  const Node* add_node = graph_utils::GetInputNode(*q_node, 0);
+  if (add_node == nullptr ||
+      !graph_utils::IsSupportedOptypeVersionAndDomain(*add_node, "Add", {7, 13, 14}) ||
+      !optimizer_utils::CheckOutputEdges(graph, *add_node, 1)) {
+    return false;
+  }
+
+  const Node* dq_node_0 = graph_utils::GetInputNode(*add_node, 0);
+  const Node* dq_node_1 = graph_utils::GetInputNode(*add_node, 1);
+  return dq_node_0 != nullptr && dq_node_1 != nullptr &&
+         IsSupportedDQ(graph, *dq_node_0) && IsSupportedDQ(graph, *dq_node_1);
+}
+
+Status QOrderedSkipLayerNormFusion::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect,
+                                          const logging::Logger& /*logger*/) const {
+  Node& q_node = *graph.GetNode(graph_utils::GetInputNode(node, 0)->Index());
+  Node& add_node = *graph.GetNode(graph_utils::GetInputNode(q_node, 0)->Index());
+  Node& dq_node_0 = *graph.GetNode(graph_utils::GetInputNode(add_node, 0)->Index());
+  Node& dq_node_1 = *graph.GetNode(graph_utils::GetInputNode(add_node, 1)->Index());
+
+  // QOrderedLayerNormalization inputs: X, scale_X, scale (gamma), B (optional), scale_Y.
+  // The fused node takes the quantized tensors and scales from the two DequantizeLinear
+  // nodes directly, making the intermediate quantization of the sum unnecessary.
+  std::vector<NodeArg*>& ln_input_defs = node.MutableInputDefs();
+  InlinedVector<NodeArg*> fused_input_defs{dq_node_0.MutableInputDefs()[QDQ::InputIndex::INPUT_ID],
+                                           dq_node_0.MutableInputDefs()[QDQ::InputIndex::SCALE_ID],
+                                           dq_node_1.MutableInputDefs()[QDQ::InputIndex::INPUT_ID],
+                                           dq_node_1.MutableInputDefs()[QDQ::InputIndex::SCALE_ID],
+                                           ln_input_defs[2],
+                                           ln_input_defs[3],
+                                           ln_input_defs[4]};
+
+  Node& fused_node = graph.AddNode(graph.GenerateNodeName(node.Name() + "_skip"),
+                                   "QOrderedSkipLayerNormalization",
+                                   "fused residual add + QOrderedLayerNormalization",
+                                   fused_input_defs,
+                                   node.MutableOutputDefs(),
+                                   &node.GetAttributes(),
+                                   kMSDomain);
+  fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+  for (Node* node_to_remove : {&dq_node_0, &dq_node_1, &add_node, &q_node, &node}) {
+    graph_utils::RemoveNodeOutputEdges(graph, *node_to_remove);
+    graph.RemoveNode(node_to_remove->Index());
+  }
+
+  rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
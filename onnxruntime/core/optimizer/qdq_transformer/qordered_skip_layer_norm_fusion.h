@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/rewrite_rule.h"
+
+namespace onnxruntime {
+
+/**
+    @Class QOrderedSkipLayerNormFusion
+
+    Rewrite rule that fuses the residual path feeding a QOrderedLayerNormalization
+
+        DequantizeLinear + DequantizeLinear -> Add -> QuantizeLinear -> QOrderedLayerNormalization
+
+    into a single QOrderedSkipLayerNormalization node, removing the dequantize/add/quantize
+    round trip between qordered GEMMs.
+ */
+class QOrderedSkipLayerNormFusion : public RewriteRule {
+ public:
+  QOrderedSkipLayerNormFusion() noexcept : RewriteRule("QOrderedSkipLayerNormFusion") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"QOrderedLayerNormalization"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
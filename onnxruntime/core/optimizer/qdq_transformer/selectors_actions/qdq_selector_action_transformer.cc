@@ -49,20 +49,32 @@ void DropQDQNodesRules(SelectorActionRegistry& qdq_selector_action_registry) {
   std::unique_ptr<Action> drop_action = std::make_unique<MergeIntoTargetFixed>(std::move(moves));
 
 #if !defined(ORT_MINIMAL_BUILD)
-  // Use a separate selector + action that disallows 16-bit types for MaxPool and Resize.
+  // Use a separate selector + action that disallows 16-bit types for MaxPool, Resize and the other
+  // ops below whose CPU kernels are not registered for 16-bit integers.
   // int16 MaxPool is not supported by the ONNX specification.
   // int16 Resize is not supported by the ORT implementation (although allowed by ONNX).
+  // ReduceMax/ReduceMin only select values, so the quantization parameters carry over to the output.
+  // Their 8-bit CPU kernels start at opset 12.
   std::unique_ptr<NodeSelector> selector_disallow_16bit = std::make_unique<QDQ::DropQDQNodesSelector>(false);
   qdq_selector_action_registry.RegisterSelectorAndAction(drop_action_no_int16_name,
-                                                         {{"MaxPool", {12}},
-                                                          {"Resize", {}}},
+                                                         {{"DepthToSpace", {}},
+                                                          {"MaxPool", {12}},
+                                                          {"ReduceMax", {12, 13, 18, 20}},
+                                                          {"ReduceMin", {12, 13, 18, 20}},
+                                                          {"Resize", {}},
+                                                          {"SpaceToDepth", {}}},
                                                          std::move(selector_disallow_16bit),
                                                          std::move(drop_action_no_int16));
 
   std::unique_ptr<NodeSelector> selector = std::make_unique<QDQ::DropQDQNodesSelector>(true);
   qdq_selector_action_registry.RegisterSelectorAndAction(drop_action_name,
-                                                         {{"Gather", {}},
+                                                         {{"Expand", {}},
+                                                          {"Flatten", {}},
+                                                          {"Gather", {}},
+                                                          {"GatherElements", {}},
                                                           {"Reshape", {}},
+                                                          {"Slice", {}},
+                                                          {"Tile", {}},
                                                           {"Transpose", {}},
                                                           {"Squeeze", {}},
                                                           {"Unsqueeze", {}}},
@@ -92,4 +92,19 @@ size_t RuleBasedGraphTransformer::RulesCount() const {
   return rules_.size();
 }
 
+std::vector<std::string> RuleBasedGraphTransformer::TargetOpTypes() const noexcept {
+  // A rule that triggers on any op type means there is no op type the transformer can be skipped for.
+  if (!any_op_type_rules_.empty()) {
+    return {};
+  }
+
+  std::vector<std::string> op_types;
+  op_types.reserve(op_type_to_rules_.size());
+  for (const auto& entry : op_type_to_rules_) {
+    op_types.push_back(entry.first);
+  }
+
+  return op_types;
+}
+
 }  // namespace onnxruntime
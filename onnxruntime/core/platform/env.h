@@ -91,6 +91,16 @@ struct ThreadOptions {
   void* custom_thread_creation_options = nullptr;
   OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
   int dynamic_block_base_ = 0;
+
+  // If true, worker threads adapt their spin budget to the outcome of recent waits for work,
+  // spinning briefly and then blocking when the pool has been mostly idle. See the spin loop
+  // in EigenNonBlockingThreadPool.h for the policy.
+  bool adaptive_spinning = false;
+
+  // If true, cost-model driven parallel loops measure themselves and learn, per distinct
+  // (iteration count, cost) signature, the degree of parallelism that actually runs fastest on
+  // this pool - including running sequentially. See ThreadPool::LoopTuner.
+  bool loop_tuning = false;
 };
 
 std::ostream& operator<<(std::ostream& os, const LogicalProcessors&);
@@ -147,6 +157,37 @@ class Env {
 
   virtual std::vector<LogicalProcessors> GetDefaultThreadAffinities() const = 0;
 
+  /// <summary>
+  /// The API returns affinities covering only the performance (P) cores of a
+  /// hybrid CPU, one entry per core in the same layout as
+  /// GetDefaultThreadAffinities(). Returns an empty vector when the platform
+  /// exposes no core-type information or when all cores are of a single type,
+  /// in which case callers should fall back to the default affinities.
+  /// </summary>
+  /// <returns>Affinities of the performance cores</returns>
+  virtual std::vector<LogicalProcessors> GetPerformanceCoreThreadAffinities() const { return {}; }
+
+  /// <summary>
+  /// The API returns the number of NUMA nodes on the system.
+  /// Returns 1 when the platform exposes no NUMA information.
+  /// </summary>
+  /// <returns>Number of NUMA nodes</returns>
+  virtual int GetNumNumaNodes() const { return 1; }
+
+  /// <summary>
+  /// The API returns the NUMA node of the processor the calling thread is currently running on.
+  /// Returns 0 when the platform exposes no NUMA information.
+  /// </summary>
+  /// <returns>NUMA node of the calling thread</returns>
+  virtual int GetCurrentNumaNode() const { return 0; }
+
+  /// <summary>
+  /// Advises the OS to back the given memory range with huge pages where the
+  /// platform supports it. Best effort: failures and platforms without huge
+  /// page support are silently ignored.
+  /// </summary>
+  virtual void AdviseHugePages(void* /*address*/, size_t /*length*/) const {}
+
   /// \brief Returns the number of micro-seconds since the Unix epoch.
   virtual uint64_t NowMicros() const {
     return env_time_->NowMicros();
@@ -29,8 +29,10 @@ limitations under the License.
 #include <sys/syscall.h>
 #include <unistd.h>
 
+#include <fstream>
 #include <iostream>
 #include <optional>
+#include <sstream>
 #include <thread>
 #include <utility>  // for std::forward
 #include <vector>
@@ -302,6 +304,56 @@ class PosixEnv : public Env {
     return ret;
   }
 
+  int GetNumNumaNodes() const override {
+#ifdef __linux__
+    // the kernel lists online nodes as e.g. "0" or "0-3"
+    std::ifstream online_nodes("/sys/devices/system/node/online");
+    std::string node_range;
+    if (online_nodes >> node_range) {
+      auto dash_pos = node_range.find('-');
+      if (dash_pos != std::string::npos) {
+        int highest_node = -1;
+        std::istringstream iss(node_range.substr(dash_pos + 1));
+        if ((iss >> highest_node) && highest_node >= 0) {
+          return highest_node + 1;
+        }
+      }
+    }
+#endif
+    return 1;
+  }
+
+  int GetCurrentNumaNode() const override {
+#ifdef SYS_getcpu
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+      return static_cast<int>(node);
+    }
+#endif
+    return 0;
+  }
+
+  void AdviseHugePages(void* address, size_t length) const override {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise operates on whole pages, so trim the range to page boundaries.
+    // The allocation may not be page aligned when it comes from malloc.
+    const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t start = reinterpret_cast<uintptr_t>(address);
+    uintptr_t end = start + length;
+    start = (start + page_size - 1) & ~(page_size - 1);
+    end = end & ~(page_size - 1);
+    if (end > start) {
+      // best effort: THP may be disabled system-wide or the range may not be
+      // eligible. Either way the allocation stays usable on small pages.
+      (void)madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE);
+    }
+#else
+    ORT_UNUSED_PARAMETER(address);
+    ORT_UNUSED_PARAMETER(length);
+#endif
+  }
+
   void SleepForMicroseconds(int64_t micros) const override {
     while (micros > 0) {
       timespec sleep_time;
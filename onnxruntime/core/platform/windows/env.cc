@@ -16,6 +16,7 @@ limitations under the License.
 
 #include "core/platform/windows/env.h"
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <optional>
@@ -303,6 +304,43 @@ std::vector<LogicalProcessors> WindowsEnv::GetDefaultThreadAffinities() const {
   return cores_.empty() ? std::vector<LogicalProcessors>(DefaultNumCores(), LogicalProcessors{}) : cores_;
 }
 
+std::vector<LogicalProcessors> WindowsEnv::GetPerformanceCoreThreadAffinities() const {
+  if (cores_.empty() || core_efficiency_classes_.size() != cores_.size()) {
+    return {};
+  }
+  const auto [min_efficiency_class, max_efficiency_class] =
+      std::minmax_element(core_efficiency_classes_.begin(), core_efficiency_classes_.end());
+  if (*min_efficiency_class == *max_efficiency_class) {
+    // All cores are of a single type, leave the choice of cores to the default affinity logic.
+    return {};
+  }
+  std::vector<LogicalProcessors> performance_cores;
+  for (size_t i = 0; i < cores_.size(); ++i) {
+    if (core_efficiency_classes_[i] == *max_efficiency_class) {
+      performance_cores.push_back(cores_[i]);
+    }
+  }
+  return performance_cores;
+}
+
+int WindowsEnv::GetNumNumaNodes() const {
+  ULONG highest_node_number = 0;
+  if (GetNumaHighestNodeNumber(&highest_node_number)) {
+    return static_cast<int>(highest_node_number) + 1;
+  }
+  return 1;
+}
+
+int WindowsEnv::GetCurrentNumaNode() const {
+  PROCESSOR_NUMBER processor_number;
+  GetCurrentProcessorNumberEx(&processor_number);
+  USHORT node_number = 0;
+  if (GetNumaProcessorNodeEx(&processor_number, &node_number) && node_number != 0xffff) {
+    return static_cast<int>(node_number);
+  }
+  return 0;
+}
+
 WindowsEnv& WindowsEnv::Instance() {
   static WindowsEnv default_env;
   return default_env;
@@ -920,6 +958,7 @@ void WindowsEnv::InitializeCpuInfo() {
         }
       }
       cores_.push_back(std::move(core_global_proc_ids));
+      core_efficiency_classes_.push_back(static_cast<int>(processor_info->Processor.EfficiencyClass));
       core_id++;
     }
     iter += size;
@@ -55,6 +55,9 @@ class WindowsEnv : public Env {
   static int DefaultNumCores();
   int GetNumPhysicalCpuCores() const override;
   std::vector<LogicalProcessors> GetDefaultThreadAffinities() const override;
+  std::vector<LogicalProcessors> GetPerformanceCoreThreadAffinities() const override;
+  int GetNumNumaNodes() const override;
+  int GetCurrentNumaNode() const override;
   static WindowsEnv& Instance();
   PIDType GetSelfPid() const override;
   Status GetFileLength(_In_z_ const ORTCHAR_T* file_path, size_t& length) const override;
@@ -113,6 +116,11 @@ class WindowsEnv : public Env {
    * }
    */
   std::vector<LogicalProcessors> cores_;
+  /*
+   * "core_efficiency_classes_" holds the windows EfficiencyClass of every entry in "cores_",
+   * a larger value means a faster core. On non-hybrid parts all entries are equal (zero).
+   */
+  std::vector<int> core_efficiency_classes_;
   /*
    * "global_processor_info_map_" is a map of:
    * global_processor_id <--> (group_id, local_processor_id)
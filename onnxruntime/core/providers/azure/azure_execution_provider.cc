@@ -2,9 +2,92 @@
 // Licensed under the MIT License.
 
 #include "core/providers/azure/azure_execution_provider.h"
+
+#include <charconv>
+
+#include "core/common/common.h"
 #include "core/graph/constants.h"
 
 namespace onnxruntime {
-AzureExecutionProvider::AzureExecutionProvider(const std::unordered_map<std::string, std::string>& config) : IExecutionProvider{onnxruntime::kAzureExecutionProvider}, config_(config) {
+
+namespace {
+
+constexpr const char* kTransportCompression = "transport.compression";
+constexpr const char* kTransportCompressionLevel = "transport.compression_level";
+constexpr const char* kTransportByteShuffle = "transport.byte_shuffle";
+constexpr const char* kTransportChunkBytes = "transport.chunk_bytes";
+
+int64_t ParseInteger(const std::string& key, const std::string& value) {
+  int64_t parsed = 0;
+  auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+  ORT_ENFORCE(ec == std::errc{} && ptr == value.data() + value.size(),
+              "Invalid value for ", key, ": '", value, "', expected an integer.");
+  return parsed;
+}
+
+}  // namespace
+
+AzureTransportOptions AzureTransportOptions::FromConfig(
+    const std::unordered_map<std::string, std::string>& config) {
+  AzureTransportOptions options;
+
+  if (auto it = config.find(kTransportCompression); it != config.end()) {
+    if (it->second == "none") {
+      options.compression = Compression::kNone;
+    } else if (it->second == "lz4") {
+      options.compression = Compression::kLZ4;
+    } else if (it->second == "zstd") {
+      options.compression = Compression::kZstd;
+    } else {
+      ORT_THROW("Invalid value for ", kTransportCompression, ": '", it->second,
+                "', expected one of 'none', 'lz4', 'zstd'.");
+    }
+  }
+
+  if (auto it = config.find(kTransportCompressionLevel); it != config.end()) {
+    options.compression_level = static_cast<int>(ParseInteger(kTransportCompressionLevel, it->second));
+  }
+
+  if (auto it = config.find(kTransportByteShuffle); it != config.end()) {
+    ORT_ENFORCE(it->second == "0" || it->second == "1",
+                "Invalid value for ", kTransportByteShuffle, ": '", it->second, "', expected '0' or '1'.");
+    options.byte_shuffle = it->second == "1";
+  }
+
+  if (auto it = config.find(kTransportChunkBytes); it != config.end()) {
+    const int64_t chunk_bytes = ParseInteger(kTransportChunkBytes, it->second);
+    ORT_ENFORCE(chunk_bytes > 0, "Invalid value for ", kTransportChunkBytes, ": '", it->second,
+                "', expected a positive integer.");
+    options.chunk_bytes = static_cast<size_t>(chunk_bytes);
+  }
+
+  return options;
+}
+
+void ByteShuffle(const uint8_t* src, uint8_t* dst, size_t element_size, size_t num_elements) {
+  for (size_t byte = 0; byte < element_size; ++byte) {
+    const uint8_t* in = src + byte;
+    uint8_t* out = dst + byte * num_elements;
+    for (size_t i = 0; i < num_elements; ++i) {
+      out[i] = in[i * element_size];
+    }
+  }
 }
-}  // namespace onnxruntime
\ No newline at end of file
+
+void ByteUnshuffle(const uint8_t* src, uint8_t* dst, size_t element_size, size_t num_elements) {
+  for (size_t byte = 0; byte < element_size; ++byte) {
+    const uint8_t* in = src + byte * num_elements;
+    uint8_t* out = dst + byte;
+    for (size_t i = 0; i < num_elements; ++i) {
+      out[i * element_size] = in[i];
+    }
+  }
+}
+
+AzureExecutionProvider::AzureExecutionProvider(const std::unordered_map<std::string, std::string>& config)
+    : IExecutionProvider{onnxruntime::kAzureExecutionProvider},
+      config_(config),
+      transport_options_(AzureTransportOptions::FromConfig(config_)) {
+}
+
+}  // namespace onnxruntime
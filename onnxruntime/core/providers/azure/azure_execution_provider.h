@@ -3,18 +3,67 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
 #include "core/framework/execution_provider.h"
 
 namespace onnxruntime {
 
+// Transport settings for shipping tensors to a remote endpoint, parsed from the provider
+// config. The codecs and the HTTP client live with the endpoint invokers that consume the
+// provider config; parsing and validating here makes a misconfigured session fail at creation
+// time instead of at the first request.
+struct AzureTransportOptions {
+  enum class Compression {
+    kNone,
+    kLZ4,
+    kZstd,
+  };
+
+  // "transport.compression": "none" (default), "lz4" or "zstd". What is actually used is
+  // negotiated per endpoint: an endpoint that does not advertise the codec falls back to raw
+  // bytes.
+  Compression compression{Compression::kNone};
+
+  // "transport.compression_level": codec specific level; 0 (default) selects the codec default.
+  int compression_level{0};
+
+  // "transport.byte_shuffle": "0" (default) or "1". When enabled, fp16/fp32 tensor payloads are
+  // byte-shuffled before compression (see ByteShuffle below), which groups the slowly varying
+  // exponent bytes together and markedly improves the ratio of byte oriented codecs on float
+  // data. Ignored when compression is "none".
+  bool byte_shuffle{false};
+
+  // "transport.chunk_bytes": size of the chunks a request body is split into so that
+  // serialization and compression of chunk N+1 overlap the upload of chunk N. Must be positive.
+  size_t chunk_bytes{1024 * 1024};
+
+  // Parses the transport options out of the provider config, throwing for values that can never
+  // be valid. Unrelated config entries are ignored.
+  static AzureTransportOptions FromConfig(const std::unordered_map<std::string, std::string>& config);
+};
+
+// Reorders `num_elements` elements of `element_size` bytes each so that the i-th bytes of all
+// elements are stored contiguously ("byte shuffle", as done by HDF5 and Blosc). The element
+// values are unchanged; the transform only permutes bytes to make the buffer more compressible.
+// `src` and `dst` must not overlap and both hold element_size * num_elements bytes.
+void ByteShuffle(const uint8_t* src, uint8_t* dst, size_t element_size, size_t num_elements);
+
+// Inverse of ByteShuffle.
+void ByteUnshuffle(const uint8_t* src, uint8_t* dst, size_t element_size, size_t num_elements);
+
 class AzureExecutionProvider : public IExecutionProvider {
  public:
   explicit AzureExecutionProvider(const std::unordered_map<std::string, std::string>& config);
   ~AzureExecutionProvider() = default;
   const std::unordered_map<std::string, std::string>& GetConfig() const { return config_; }
+  const AzureTransportOptions& GetTransportOptions() const { return transport_options_; }
 
  private:
   std::unordered_map<std::string, std::string> config_;
+  AzureTransportOptions transport_options_;
 };
 
-}  // namespace onnxruntime
\ No newline at end of file
+}  // namespace onnxruntime
@@ -136,9 +136,44 @@ If::Info::Info(const onnxruntime::Node& node, const GraphViewer& subgraph_in) :
               num_subgraph_outputs, " outputs.");
 
   subgraph_output_names.reserve(num_subgraph_outputs);
+  output_info.reserve(num_subgraph_outputs);
   for (size_t i = 0; i < num_subgraph_outputs; ++i) {
     auto& output = subgraph_outputs[i];
     subgraph_output_names.push_back(output->Name());
+
+    // classify the output once here so the per-call output allocation doesn't need to
+    // look at the TypeProto/ShapeProto again.
+    const auto* output_type = output->TypeAsProto();
+    OutputInfo cur_output_info;
+
+#if !defined(DISABLE_OPTIONAL_TYPE)
+    if (utils::HasOptionalTensorType(*output_type)) {
+      cur_output_info.kind = OutputInfo::Kind::Tensor;
+      cur_output_info.is_optional = true;
+    } else if (utils::HasOptionalTensorSequenceType(*output_type)) {
+      cur_output_info.kind = OutputInfo::Kind::Sequence;
+      cur_output_info.is_optional = true;
+    } else
+#endif
+        if (output_type->has_tensor_type()) {
+      cur_output_info.kind = OutputInfo::Kind::Tensor;
+    } else if (output_type->has_sequence_type()) {
+      cur_output_info.kind = OutputInfo::Kind::Sequence;
+    }
+
+    if (cur_output_info.kind == OutputInfo::Kind::Tensor) {
+      if (const auto* output_shape = output->Shape(); output_shape != nullptr) {
+        TensorShape shape = onnxruntime::utils::GetTensorShapeFromTensorShapeProto(*output_shape);
+
+        // if size < 0 we have a symbolic dimension and need to use a temporary OrtValue in the subgraph execution
+        if (shape.Size() >= 0) {
+          cur_output_info.has_static_shape = true;
+          cur_output_info.static_shape = std::move(shape);
+        }
+      }
+    }
+
+    output_info.push_back(std::move(cur_output_info));
   }
 }
 
@@ -303,62 +338,43 @@ Status IfImpl::Initialize() {
 }
 
 Status IfImpl::AllocateOutputTensors() {
-  Status status = Status::OK();
+  // the per-output classification and any static shapes were computed once at subgraph setup,
+  // so the hot path here is a context_.Output call per output with no proto processing.
   int index = 0;
 
-  const auto& graph_outputs = info_.subgraph.GetOutputs();
+  const auto& output_info = info_.output_info;
 
 #if !defined(DISABLE_OPTIONAL_TYPE)
   // The number of optional type outputs can be atmost the total
   // number of subgraph outputs (it is okay to over-allocate)
-  optional_tensor_type_subgraph_outputs_.reserve(graph_outputs.size());
-  optional_tensor_sequence_type_subgraph_outputs_.reserve(graph_outputs.size());
-#endif
-
-  for (auto& graph_output : graph_outputs) {
-    const auto* graph_output_type = graph_output->TypeAsProto();
-
-#if !defined(DISABLE_OPTIONAL_TYPE)
-    bool is_optional_tensor = utils::HasOptionalTensorType(*graph_output_type);
-    bool is_optional_tensor_sequence = utils::HasOptionalTensorSequenceType(*graph_output_type);
+  optional_tensor_type_subgraph_outputs_.reserve(output_info.size());
+  optional_tensor_sequence_type_subgraph_outputs_.reserve(output_info.size());
 #endif
 
-    if (graph_output_type->has_tensor_type()
-#if !defined(DISABLE_OPTIONAL_TYPE)
-        || is_optional_tensor
-#endif
-    ) {
-      auto* graph_output_shape = graph_output->Shape();
-      bool symbolic_dim_in_shape = false;
-
-      if (graph_output_shape) {
-        TensorShape output_shape = onnxruntime::utils::GetTensorShapeFromTensorShapeProto(*graph_output_shape);
+  outputs_.reserve(output_info.size());
 
-        // if size < 0 we have a symbolic dimension and need to use a temporary OrtValue in the subgraph execution
-        if (output_shape.Size() < 0) {
-          symbolic_dim_in_shape = true;
-        } else {
-          auto* tensor = context_.Output(index, output_shape);
+  for (const auto& cur_output_info : output_info) {
+    using Kind = If::Info::OutputInfo::Kind;
 
-          if (!tensor)
-            return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to create output tensor for ", graph_output->Name());
+    if (cur_output_info.kind == Kind::Tensor) {
+      if (cur_output_info.has_static_shape) {
+        auto* tensor = context_.Output(index, cur_output_info.static_shape);
 
-          outputs_.push_back({AllocationType::IfOutput, *context_.GetOutputMLValue(index)});
-        }
-      }
+        if (!tensor)
+          return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to create output tensor for ",
+                                 info_.subgraph_output_names[index]);
 
-      if (!graph_output_shape || symbolic_dim_in_shape) {
+        outputs_.push_back({AllocationType::IfOutput, *context_.GetOutputMLValue(index)});
+      } else {
+        // no shape or a symbolic dimension in the shape.
         // we still need a value to put in the feeds we give to the execution frame, so just use an empty MLValue
         outputs_.push_back({AllocationType::Delayed, {}});
       }
-    } else if (graph_output_type->has_sequence_type()
-#if !defined(DISABLE_OPTIONAL_TYPE)
-               || is_optional_tensor_sequence
-#endif
-    ) {
+    } else if (cur_output_info.kind == Kind::Sequence) {
       auto* seq_tensor = context_.Output<TensorSeq>(index);
       if (!seq_tensor)
-        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to create output tensor for ", graph_output->Name());
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Failed to create output tensor for ",
+                               info_.subgraph_output_names[index]);
       outputs_.push_back({AllocationType::IfOutput, *context_.GetOutputMLValue(index)});
     } else {
       // Shouldn't hit this as the kernel assignment logic should check for the types before assigning this kernel
@@ -368,10 +384,12 @@ Status IfImpl::AllocateOutputTensors() {
 
 #if !defined(DISABLE_OPTIONAL_TYPE)
     // track optional type outputs - we will use them later
-    if (is_optional_tensor) {
-      optional_tensor_type_subgraph_outputs_.push_back(index);
-    } else if (is_optional_tensor_sequence) {
-      optional_tensor_sequence_type_subgraph_outputs_.push_back(index);
+    if (cur_output_info.is_optional) {
+      if (cur_output_info.kind == Kind::Tensor) {
+        optional_tensor_type_subgraph_outputs_.push_back(index);
+      } else {
+        optional_tensor_sequence_type_subgraph_outputs_.push_back(index);
+      }
     }
 #endif
 
@@ -24,11 +24,30 @@ class If : public controlflow::IControlFlowKernel {
     Info(const onnxruntime::Node& node, const GraphViewer& subgraph_in);
     const GraphViewer& subgraph;
 
+    // per-output info computed once at subgraph setup so Compute does not need to re-examine
+    // the subgraph output's TypeProto/ShapeProto on every call.
+    struct OutputInfo {
+      enum class Kind {
+        Tensor,
+        Sequence,
+        Unsupported
+      };
+
+      Kind kind = Kind::Unsupported;
+      bool is_optional = false;
+
+      // set when the subgraph output has a fully static shape, in which case the If output
+      // can be allocated up front and the subgraph execution writes directly into it.
+      bool has_static_shape = false;
+      TensorShape static_shape;
+    };
+
     std::vector<bool> used_implicit_inputs;
     int num_implicit_inputs;
     int num_outputs;
 
     std::vector<std::string> subgraph_output_names;
+    std::vector<OutputInfo> output_info;
   };
 
  private:
@@ -17,8 +17,10 @@
 #include "core/framework/stream_execution_context.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/framework/session_options.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -208,8 +210,20 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
     feeds[num_variadic_inputs + i] = *implicit_inputs[i];
   }
 
+  // when the Scan carries no state between iterations each iteration reads an independent input slice and
+  // writes an independent output slice, so the iterations after the first can run concurrently on the
+  // inter-op thread pool. the first iteration always runs on this thread so that outputs with a symbolic
+  // dimension get their final buffer allocated via the custom fetch allocators.
+  concurrency::ThreadPool* inter_op_tp = session_state.GetInterOpThreadPool();
+  const bool parallel_iterations =
+      num_loop_state_variables == 0 && seq_length > 1 &&
+      inter_op_tp != nullptr && concurrency::ThreadPool::DegreeOfParallelism(inter_op_tp) > 1 &&
+      session_state.GetSessionOptions().config_options.GetConfigOrDefault(
+          kOrtSessionOptionsParallelScanIterations, "0") == "1";
+
   int64_t seq_no = 0;
-  for (; seq_no < seq_length; ++seq_no) {
+  const int64_t sequential_len = parallel_iterations ? 1 : seq_length;  // seq_length > 1 if parallel_iterations
+  for (; seq_no < sequential_len; ++seq_no) {
     for (int input = 0; input < num_variadic_inputs; ++input) {
       if (input < num_loop_state_variables) {
         // add loop state variable input
@@ -290,6 +304,53 @@ Status IterateSequence(OpKernelContextInternal& context, const SessionState& ses
     }
   }
 
+  if (seq_no < seq_length) {
+    // the first iteration allocated any final outputs that had a symbolic dimension, so from here on every
+    // iterator produces a view of a disjoint slice of the final buffers
+    for (int output = 0; output < num_variadic_outputs; ++output) {
+      ORT_RETURN_IF_NOT(output_iterators[output]->FinalOutputAllocated(),
+                        "Final output was not allocated by the first Scan iteration. Output:", output);
+    }
+
+    // gather the feeds and fetches of the remaining iterations up front. the input and output iterators are
+    // only safe to advance on this thread.
+    const auto num_remaining = static_cast<size_t>(seq_length - seq_no);
+    std::vector<std::vector<OrtValue>> iteration_feeds(num_remaining, feeds);  // starts as copies of the implicit inputs
+    std::vector<std::vector<OrtValue>> iteration_fetches(num_remaining);
+
+    for (size_t i = 0; i < num_remaining; ++i) {
+      // num_loop_state_variables is 0 so all variadic inputs/outputs are sliced
+      for (int input = 0; input < num_variadic_inputs; ++input) {
+        auto& iterator = scan_input_stream_iterators[input];
+        iteration_feeds[i][input] = *iterator;
+        ++iterator;
+      }
+
+      iteration_fetches[i].reserve(num_variadic_outputs);
+      for (int output = 0; output < num_variadic_outputs; ++output) {
+        iteration_fetches[i].push_back(**output_iterators[output]);
+        ++(*output_iterators[output]);
+      }
+    }
+
+    // execute the remaining iterations concurrently. each execution creates its own ExecutionFrame, the same
+    // as concurrent Run calls against one session, so sharing session_state and ffm is safe.
+    std::vector<Status> statuses(num_remaining);
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        inter_op_tp, static_cast<std::ptrdiff_t>(num_remaining),
+        [&](std::ptrdiff_t i) {
+          std::unordered_map<size_t, IExecutor::CustomAllocator> no_fetch_allocators;
+          statuses[i] = utils::ExecuteSubgraph(session_state, ffm, iteration_feeds[i], iteration_fetches[i],
+                                               no_fetch_allocators, ExecutionMode::ORT_SEQUENTIAL,
+                                               context.GetTerminateFlag(), context.Logger(),
+                                               context.GetComputeStream());
+        });
+
+    for (const auto& iteration_status : statuses) {
+      ORT_RETURN_IF_ERROR(iteration_status);
+    }
+  }
+
   return status;
 }
 
@@ -18,6 +18,10 @@
 
 #include "core/framework/compute_capability.h"
 
+#if !defined(ORT_MINIMAL_BUILD)
+#include "core/providers/cpu/math/elementwise_chain.h"
+#endif
+
 namespace {
 struct KernelRegistryAndStatus {
   std::shared_ptr<onnxruntime::KernelRegistry> kernel_registry = std::make_shared<onnxruntime::KernelRegistry>();
@@ -39,11 +43,53 @@ std::vector<AllocatorPtr> CPUExecutionProvider::CreatePreferredAllocators() {
   create_arena = false;
 #endif
   AllocatorCreationInfo device_info{[](int) { return std::make_unique<CPUAllocator>(); },
-                                    DEFAULT_CPU_ALLOCATOR_DEVICE_ID, create_arena};
+                                    DEFAULT_CPU_ALLOCATOR_DEVICE_ID, create_arena,
+                                    {0, -1, -1, -1, -1, -1L},
+                                    /*stream_aware_arena*/ false,
+                                    /*cross_stream_reusing*/ false,
+                                    info_.use_numa_partitioned_arena};
 
   return std::vector<AllocatorPtr>{CreateAllocator(device_info)};
 }
 
+#if !defined(ORT_MINIMAL_BUILD)
+std::vector<std::unique_ptr<ComputeCapability>> CPUExecutionProvider::GetCapability(
+    const onnxruntime::GraphViewer& graph_viewer, const IKernelLookup& kernel_lookup) const {
+  auto capabilities = IExecutionProvider::GetCapability(graph_viewer, kernel_lookup);
+  if (!info_.enable_elementwise_fusion) {
+    return capabilities;
+  }
+
+  auto generate_metadef_name = [this, &graph_viewer]() {
+    HashValue model_hash;
+    int metadef_id = metadef_id_generator_.GenerateId(graph_viewer, model_hash);
+    return std::string("ElementwiseChain_") + std::to_string(model_hash) + "_" + std::to_string(metadef_id);
+  };
+
+  auto fused_capabilities = elementwise_chain::FindChainPartitions(graph_viewer, generate_metadef_name);
+  if (fused_capabilities.empty()) {
+    return capabilities;
+  }
+
+  // the fused groups go first so the partitioner claims whole chains before the per-node entries
+  std::move(capabilities.begin(), capabilities.end(), std::back_inserter(fused_capabilities));
+  return fused_capabilities;
+}
+
+Status CPUExecutionProvider::Compile(const std::vector<FusedNodeAndGraph>& fused_nodes_and_graphs,
+                                     std::vector<NodeComputeInfo>& node_compute_funcs) {
+  node_compute_funcs.reserve(fused_nodes_and_graphs.size());
+  for (const FusedNodeAndGraph& fused_node_and_graph : fused_nodes_and_graphs) {
+    NodeComputeInfo compute_info;
+    ORT_RETURN_IF_ERROR(elementwise_chain::CompileChain(fused_node_and_graph.fused_node,
+                                                        fused_node_and_graph.filtered_graph,
+                                                        compute_info));
+    node_compute_funcs.push_back(std::move(compute_info));
+  }
+  return Status::OK();
+}
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 // Forward declarations of op kernels
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 6, 10, Clip);
 class ONNX_OPERATOR_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 6, Elu);
@@ -476,6 +522,7 @@ class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDoma
 class ONNX_OPERATOR_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, Conv);
 #ifdef MLAS_F16VEC_INTRINSICS_SUPPORTED
 class ONNX_OPERATOR_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, MLFloat16, Conv);
+class ONNX_OPERATOR_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, MLFloat16, ConvTranspose);
 class ONNX_OPERATOR_VERSIONED_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, 18, MLFloat16,
                                                       AveragePool);
 #endif
@@ -2715,6 +2762,8 @@ Status RegisterFp16Kernels(KernelRegistry& kernel_registry) {
                                                                   GlobalAveragePool)>,
       BuildKernelCreateInfo<ONNX_OPERATOR_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, MLFloat16,
                                                                   Conv)>,
+      BuildKernelCreateInfo<ONNX_OPERATOR_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, MLFloat16,
+                                                                  ConvTranspose)>,
       BuildKernelCreateInfo<ONNX_OPERATOR_VERSIONED_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 11, 18,
                                                                             MLFloat16, AveragePool)>,
       BuildKernelCreateInfo<ONNX_OPERATOR_TYPED_KERNEL_CLASS_NAME(kCpuExecutionProvider, kOnnxDomain, 19, MLFloat16,
@@ -5,15 +5,22 @@
 
 #include "core/framework/execution_provider.h"
 #include "core/graph/constants.h"
+#if !defined(ORT_MINIMAL_BUILD)
+#include "core/framework/model_metadef_id_generator.h"
+#endif
 
 namespace onnxruntime {
 
 // Information needed to construct CPU execution providers.
 struct CPUExecutionProviderInfo {
   bool create_arena{true};
+  // partition the arena into per-NUMA-node sub-arenas. only relevant when create_arena is true.
+  bool use_numa_partitioned_arena{false};
+  // fuse chains of same-shape elementwise ops into a single compiled kernel. see math/elementwise_chain.h.
+  bool enable_elementwise_fusion{false};
 
-  explicit CPUExecutionProviderInfo(bool use_arena)
-      : create_arena(use_arena) {}
+  explicit CPUExecutionProviderInfo(bool use_arena, bool numa_partitioned_arena = false)
+      : create_arena(use_arena), use_numa_partitioned_arena(numa_partitioned_arena) {}
 
   CPUExecutionProviderInfo() = default;
 };
@@ -32,9 +39,20 @@ class CPUExecutionProvider : public IExecutionProvider {
   std::unique_ptr<IDataTransfer> GetDataTransfer() const override;
   std::vector<AllocatorPtr> CreatePreferredAllocators() override;
 
+#if !defined(ORT_MINIMAL_BUILD)
+  std::vector<std::unique_ptr<ComputeCapability>> GetCapability(const onnxruntime::GraphViewer& graph_viewer,
+                                                                const IKernelLookup& kernel_lookup) const override;
+
+  Status Compile(const std::vector<FusedNodeAndGraph>& fused_nodes_and_graphs,
+                 std::vector<NodeComputeInfo>& node_compute_funcs) override;
+#endif
+
  private:
   CPUExecutionProviderInfo info_;
   std::vector<FuseRuleFn> fuse_rules_;
+#if !defined(ORT_MINIMAL_BUILD)
+  ModelMetadefIdGenerator metadef_id_generator_;
+#endif
 };
 
 // Registers all available CPU kernels
@@ -0,0 +1,267 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+//
+// This file contains implementation of a fp16 transposed convolution operator.
+//
+
+#include "core/mlas/inc/mlas.h"
+
+#ifdef MLAS_F16VEC_INTRINSICS_SUPPORTED
+
+#include "core/common/safeint.h"
+#include "core/framework/float16.h"
+#include "core/framework/op_kernel.h"
+#include "core/providers/cpu/nn/conv_transpose_attributes.h"
+#include "core/util/math.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+
+/**
+ * @brief Transposed convolution operator for FP16 tensors.
+ *
+ * The structure mirrors the fp32 ConvTranspose kernel: a GEMM between the
+ * (transposed) filter and the input image produces the column buffer, which
+ * col2im then scatters into the output image. The GEMM runs in fp16 via
+ * MlasHalfGemmBatch; col2im accumulates overlapping windows, so that stage is
+ * staged through an fp32 buffer to avoid losing precision in the summation,
+ * and the result is converted back to fp16 once per image.
+ */
+class ConvTransposeFp16 final : public OpKernel {
+ public:
+  ConvTransposeFp16(const OpKernelInfo& info) : OpKernel(info), conv_transpose_attrs_(info) {
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed, /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
+ private:
+  ConvTransposeAttributes conv_transpose_attrs_;
+
+  TensorShape filter_shape_;
+  BufferUniquePtr transposed_filter_;
+};
+
+Status ConvTransposeFp16::PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                                  /*out*/ bool& is_packed,
+                                  /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  // only pack filter tensor
+  if (input_idx == 1) {
+    if (tensor.Shape().NumDimensions() <= 2) {
+      return Status::OK();
+    }
+    filter_shape_ = tensor.Shape();
+
+    // MlasHalfGemm has no transpose option, so the filter is transposed here:
+    // each group's (C/group x kernel_dim) block becomes (kernel_dim x C/group).
+    const size_t K = static_cast<size_t>(filter_shape_[0]) / onnxruntime::narrow<size_t>(conv_transpose_attrs_.group);
+    const size_t N = onnxruntime::narrow<size_t>(filter_shape_.SizeFromDimension(1));
+    auto packed_elements_per_group = N * K;
+    if (packed_elements_per_group == 0 || N == 1 || K == 1) {  // No need for single row or single col case
+      return Status::OK();
+    }
+
+    size_t packed_filter_data_size = SafeInt<size_t>(packed_elements_per_group) * sizeof(MLFloat16) * conv_transpose_attrs_.group;
+    auto* packed_filter_data = alloc->Alloc(packed_filter_data_size);
+
+    // Initialize memory to 0 as there could be some padding associated with pre-packed
+    // buffer memory and we don not want it uninitialized and generate different hashes
+    // if and when we try to cache this pre-packed buffer for sharing between sessions.
+    memset(packed_filter_data, 0, packed_filter_data_size);
+
+    transposed_filter_ = BufferUniquePtr(packed_filter_data, BufferDeleter(std::move(alloc)));
+
+    for (int64_t group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
+      MlasTranspose(tensor.Data<MLFloat16>() + (group_id * N * K),
+                    static_cast<MLFloat16*>(packed_filter_data) + (group_id * packed_elements_per_group),
+                    K, N);
+    }
+
+    bool share_prepacked_weights = (prepacked_weights != nullptr);
+    if (share_prepacked_weights) {
+      prepacked_weights->buffers_.push_back(std::move(transposed_filter_));
+      prepacked_weights->buffer_sizes_.push_back(packed_filter_data_size);
+    }
+
+    is_packed = true;
+  }
+  return Status::OK();
+}
+
+Status ConvTransposeFp16::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                                    int input_idx,
+                                                    /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == 1) {
+    used_shared_buffers = true;
+    transposed_filter_ = std::move(prepacked_buffers[0]);
+  }
+
+  return Status::OK();
+}
+
+Status ConvTransposeFp16::Compute(OpKernelContext* context) const {
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  size_t num_inputs = OpKernel::Node().InputDefs().size();
+  ConvTransposeAttributes::Prepare p;
+  bool has_bias = num_inputs == 3;
+  ORT_RETURN_IF_ERROR(conv_transpose_attrs_.PrepareForCompute(
+      context, has_bias, p, false, transposed_filter_ ? &filter_shape_ : nullptr));
+
+  // Bail out early if one of the dimensions is zero.
+  if (p.Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  const int64_t input_image_size = p.input_shape.Size();
+  const int64_t X_offset = p.num_input_channels / conv_transpose_attrs_.group * input_image_size;
+  const int64_t Y_offset = p.Y->Shape().Size() / p.Y->Shape()[0] / conv_transpose_attrs_.group;
+  const int64_t W_offset = (p.F ? p.F->Shape().Size() : filter_shape_.Size()) / conv_transpose_attrs_.group;
+  const int64_t kernel_size = TensorShape(p.kernel_shape).Size();
+  const int64_t kernel_dim = p.num_output_channels / conv_transpose_attrs_.group * kernel_size;
+  const int64_t output_size = (p.Y->Shape().Slice(2)).Size();
+  const int64_t group_input_channels = p.num_input_channels / conv_transpose_attrs_.group;
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  const int64_t col_buffer_size = kernel_dim * input_image_size;
+  auto col_data = alloc->Alloc(SafeInt<size_t>(sizeof(MLFloat16)) * col_buffer_size);
+  BufferUniquePtr col_buffer(col_data, BufferDeleter(alloc));
+  auto* col_buffer_data = static_cast<MLFloat16*>(col_buffer.get());
+
+  auto col_fp32_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * col_buffer_size);
+  BufferUniquePtr col_fp32_buffer(col_fp32_data, BufferDeleter(alloc));
+  auto* col_fp32_buffer_data = static_cast<float*>(col_fp32_buffer.get());
+
+  // col2im accumulates overlapping kernel windows, so run it against an fp32
+  // image and convert to fp16 once at the end.
+  const int64_t image_size = Y_offset * conv_transpose_attrs_.group;
+  auto image_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * image_size);
+  BufferUniquePtr image_buffer(image_data, BufferDeleter(alloc));
+  auto* image_buffer_data = static_cast<float*>(image_buffer.get());
+
+  const MLFloat16* filter_data;
+  BufferUniquePtr transposed_filter_buffer;
+  if (transposed_filter_) {
+    filter_data = static_cast<const MLFloat16*>(transposed_filter_.get());
+  } else if (group_input_channels == 1 || kernel_dim == 1) {
+    // A single row or column transposes to itself in memory.
+    filter_data = p.F->Data<MLFloat16>();
+  } else {
+    // Filter was not available at PrePack time. Transpose it here, once per Compute.
+    auto* transposed_data = alloc->Alloc(SafeInt<size_t>(sizeof(MLFloat16)) * p.F->Shape().Size());
+    transposed_filter_buffer = BufferUniquePtr(transposed_data, BufferDeleter(alloc));
+    for (int64_t group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
+      MlasTranspose(p.F->Data<MLFloat16>() + (group_id * W_offset),
+                    static_cast<MLFloat16*>(transposed_data) + (group_id * W_offset),
+                    static_cast<size_t>(group_input_channels),
+                    static_cast<size_t>(kernel_dim));
+    }
+    filter_data = static_cast<const MLFloat16*>(transposed_data);
+  }
+
+  std::vector<float> bias_fp32;
+  if (p.B != nullptr) {
+    bias_fp32.resize(onnxruntime::narrow<size_t>(p.num_output_channels));
+    MlasConvertHalfToFloatBuffer(reinterpret_cast<const unsigned short*>(p.B->Data<MLFloat16>()),
+                                 bias_fp32.data(),
+                                 bias_fp32.size());
+  }
+
+  const MLFloat16* Xdata = p.X->Data<MLFloat16>();
+  MLFloat16* Ydata = p.Y->MutableData<MLFloat16>();
+  TensorShape output_shape = p.Y->Shape().Slice(2);
+
+  for (auto image_id = 0; image_id < p.N; ++image_id) {
+    for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
+      // Weight term: col = W^T * X, with the transpose pre-applied to the filter.
+      MLAS_HALF_GEMM_DATA_PARAMS gemm_params;
+      gemm_params.A = filter_data + group_id * W_offset;
+      gemm_params.lda = static_cast<size_t>(group_input_channels);
+      gemm_params.B = Xdata + group_id * X_offset;
+      gemm_params.ldb = static_cast<size_t>(input_image_size);
+      gemm_params.C = col_buffer_data;
+      gemm_params.ldc = static_cast<size_t>(input_image_size);
+      MlasHalfGemmBatch(
+          static_cast<size_t>(kernel_dim),
+          static_cast<size_t>(input_image_size),
+          static_cast<size_t>(group_input_channels),
+          1, &gemm_params, thread_pool);
+
+      MlasConvertHalfToFloatBuffer(reinterpret_cast<const unsigned short*>(col_buffer_data),
+                                   col_fp32_buffer_data,
+                                   static_cast<size_t>(col_buffer_size));
+
+      if (p.X->Shape().NumDimensions() == 4) {
+        math::Col2im<float, CPUMathUtil, StorageOrder::NCHW>(
+            col_fp32_buffer_data,
+            p.num_output_channels / conv_transpose_attrs_.group,
+            p.Y->Shape()[2],
+            p.Y->Shape()[3],
+            p.kernel_shape[0],
+            p.kernel_shape[1],
+            p.dilations[0],
+            p.dilations[1],
+            p.pads[0],
+            p.pads[1],
+            p.pads[2],
+            p.pads[3],
+            p.strides[0],
+            p.strides[1],
+            image_buffer_data + group_id * Y_offset,
+            &CPUMathUtil::Instance());
+      } else {
+        math::Col2imNd<float, CPUMathUtil, StorageOrder::NCHW>(
+            col_fp32_buffer_data,
+            output_shape.GetDims().data(),
+            p.input_shape.GetDims().data(),
+            kernel_dim,
+            Y_offset,
+            p.kernel_shape.data(),
+            p.strides.data(),
+            p.dilations.data(),
+            p.pads.data(),
+            static_cast<int>(p.kernel_shape.size()),
+            image_buffer_data + group_id * Y_offset,
+            &CPUMathUtil::Instance());
+      }
+    }
+
+    if (p.B != nullptr) {
+      auto Ymatrix = EigenMatrixMap<float>(image_buffer_data, output_size, p.num_output_channels);
+      auto Bvec = ConstEigenVectorMap<float>(bias_fp32.data(), p.num_output_channels);
+      Ymatrix.rowwise() += Bvec.transpose();
+    }
+
+    EigenVectorMap<Eigen::half>(reinterpret_cast<Eigen::half*>(Ydata), image_size) =
+        ConstEigenVectorMap<float>(image_buffer_data, image_size).cast<Eigen::half>();
+
+    Xdata += X_offset * conv_transpose_attrs_.group;
+    Ydata += Y_offset * conv_transpose_attrs_.group;
+  }
+
+  return Status::OK();
+}
+
+ONNX_CPU_OPERATOR_TYPED_KERNEL(
+    ConvTranspose,
+    11,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    ConvTransposeFp16);
+
+}  // namespace onnxruntime
+
+#endif  // MLAS_F16VEC_INTRINSICS_SUPPORTED
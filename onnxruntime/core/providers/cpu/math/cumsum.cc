@@ -2,50 +2,96 @@
 // Licensed under the MIT License.
 
 #include "cumsum.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "core/providers/common.h"
-#include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/platform/threadpool.h"
 
 using namespace onnxruntime;
 
 namespace {
 // static section
-std::vector<int64_t> GetStarts(int64_t rank, int64_t axis, int64_t index) {
-  std::vector<int64_t> starts(onnxruntime::narrow<size_t>(rank), 0);
-  starts[onnxruntime::narrow<size_t>(axis)] = index;
-  return starts;
-}
+
+// Scans one contiguous [dim, inner] panel along the axis, where `inner` is the product of the
+// dimensions after the axis, so consecutive slices along the axis are `inner` elements apart.
+// The inner loop runs over contiguous memory and vectorizes.
 template <typename T>
-void ZeroOutSliceAtIndex(Tensor& output, int64_t rank, int64_t axis, int64_t index,
-                         gsl::span<const int64_t> slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  T zero{};
-  auto output_starts(GetStarts(rank, axis, index));
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator) {
-    *output_iterator = zero;
+void ScanPanel(const T* input, T* output, int64_t dim, int64_t inner, bool exclusive, bool reverse) {
+  // Maps the m-th scan step to the offset of the slice it writes.
+  const auto slice_offset = [dim, inner, reverse](int64_t m) { return (reverse ? dim - 1 - m : m) * inner; };
+
+  // The first output slice is zero if exclusive, else a copy of the first input slice.
+  if (exclusive) {
+    std::fill_n(output + slice_offset(0), onnxruntime::narrow<size_t>(inner), T{});
+  } else {
+    std::copy_n(input + slice_offset(0), onnxruntime::narrow<size_t>(inner), output + slice_offset(0));
   }
-}
-template <typename T>
-void CopySlices(const Tensor& input, Tensor& output,
-                const std::vector<int64_t>& input_starts, const std::vector<int64_t>& output_starts,
-                gsl::span<const int64_t> slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  SliceIterator<T> input_iterator(input, input_starts, slice_dims, steps);
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator, ++input_iterator) {
-    *output_iterator = *input_iterator;
+
+  for (int64_t m = 1; m < dim; ++m) {
+    // Each output slice is the sum of the corresponding input slice and the previous output slice.
+    const T* in = input + slice_offset(exclusive ? m - 1 : m);
+    const T* prev = output + slice_offset(m - 1);
+    T* out = output + slice_offset(m);
+    for (int64_t k = 0; k < inner; ++k) {
+      out[k] = in[k] + prev[k];
+    }
   }
 }
+
+// Splits a single long scan into blocks: each block is scanned locally in parallel, the block
+// totals are accumulated sequentially, and a second parallel pass adds each block's starting
+// offset. Elements keep their left-to-right accumulation order inside a block, but each block
+// offset groups the preceding elements block by block, so floating point results can differ
+// from the serial scan in the last bits.
 template <typename T>
-void SumSlices(const Tensor& input, Tensor& output,
-               const std::vector<int64_t>& input_starts, const std::vector<int64_t>& output_starts, const std::vector<int64_t>& previous_output_starts,
-               gsl::span<const int64_t> slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  SliceIterator<T> input_iterator(input, input_starts, slice_dims, steps);
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  SliceIterator<T> previous_output_iterator(output, previous_output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator, ++input_iterator, ++previous_output_iterator) {
-    *output_iterator = *input_iterator + *previous_output_iterator;
+void BlockScan(const T* input, T* output, int64_t dim, bool exclusive, bool reverse,
+               int64_t n_blocks, onnxruntime::concurrency::ThreadPool* tp) {
+  const auto element_offset = [dim, reverse](int64_t m) { return reverse ? dim - 1 - m : m; };
+  const int64_t block_size = (dim + n_blocks - 1) / n_blocks;
+
+  std::vector<T> block_totals(onnxruntime::narrow<size_t>(n_blocks), T{});
+  onnxruntime::concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, onnxruntime::narrow<std::ptrdiff_t>(n_blocks), [&](std::ptrdiff_t b) {
+        const int64_t begin = b * block_size;
+        const int64_t end = std::min<int64_t>(begin + block_size, dim);
+        T running{};
+        for (int64_t m = begin; m < end; ++m) {
+          const T v = input[element_offset(m)];
+          if (exclusive) {
+            output[element_offset(m)] = running;
+            running += v;
+          } else {
+            running += v;
+            output[element_offset(m)] = running;
+          }
+        }
+        block_totals[onnxruntime::narrow<size_t>(b)] = running;
+      });
+
+  // The offset of a block is the sum of the totals of the blocks before it.
+  std::vector<T> block_offsets(onnxruntime::narrow<size_t>(n_blocks), T{});
+  T running{};
+  for (int64_t b = 0; b < n_blocks; ++b) {
+    block_offsets[onnxruntime::narrow<size_t>(b)] = running;
+    running += block_totals[onnxruntime::narrow<size_t>(b)];
   }
+
+  onnxruntime::concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, onnxruntime::narrow<std::ptrdiff_t>(n_blocks), [&](std::ptrdiff_t b) {
+        if (b == 0) {
+          return;  // the first block starts at zero
+        }
+        const T block_offset = block_offsets[onnxruntime::narrow<size_t>(b)];
+        const int64_t begin = b * block_size;
+        const int64_t end = std::min<int64_t>(begin + block_size, dim);
+        for (int64_t m = begin; m < end; ++m) {
+          output[element_offset(m)] += block_offset;
+        }
+      });
 }
 }  // namespace
 
@@ -200,65 +246,47 @@ Status CumSum<T>::Compute(OpKernelContext* ctx) const {
   int64_t axis = 0;
   ORT_THROW_IF_ERROR(cumsum_op::GetAxis(axis_tensor, rank, axis));
 
-  auto dim(output_tensor.Shape()[onnxruntime::narrow<size_t>(axis)]);  // dimension size for the axis
-  TensorShape slice_shape(input->Shape());                             // the shape of one slice of input/output for the given value of the axis
-  slice_shape[onnxruntime::narrow<size_t>(axis)] = 1;
-  auto slice_size(slice_shape.Size());     // total number of elements in each slice
-  auto slice_dims(slice_shape.GetDims());  // dim array for the slice
-
-  std::vector<int64_t> steps(onnxruntime::narrow<size_t>(rank), 1);  // steps for the slice -- always set to 1
-
-  if (!reverse_) {
-    int64_t index(0);  // the index we use as we walkthrough the given axis
-    // If (exclusive == true) the first slice is always 0
-    if (exclusive_) {
-      ::ZeroOutSliceAtIndex<T>(output_tensor, rank, axis, index, slice_dims, steps, slice_size);
-      ++index;
-    }
-
-    if (index < dim) {
-      // The next slice is a copy of the input (if exclusive == false then this is the first slice)
-      auto input_starts(::GetStarts(rank, axis, 0));
-      auto output_starts(::GetStarts(rank, axis, index));
-      ::CopySlices<T>(*input, output_tensor, input_starts, output_starts, slice_dims, steps, slice_size);
-      ++index;
-    }
-
-    for (; index < dim; ++index) {
-      // Each output slice is the sum of corresponding input slice and the previous output slice
-      auto input_starts(::GetStarts(rank, axis, exclusive_ ? index - 1 : index));
-      auto output_starts(::GetStarts(rank, axis, index));
-      auto previous_starts(::GetStarts(rank, axis, index - 1));
-      ::SumSlices<T>(*input, output_tensor, input_starts, output_starts, previous_starts,
-                     slice_dims, steps, slice_size);
-    }
-  } else {
-    //_reverse == true
-    int64_t index(dim - 1);  // the index we use as we walkthrough the given axis
-    // If (exclusive == true) the first slice is always 0
-    if (exclusive_) {
-      ::ZeroOutSliceAtIndex<T>(output_tensor, rank, axis, index, slice_dims, steps, slice_size);
-      --index;
-    }
-
-    if (index >= 0) {
-      // The next slice is a copy of the input (if exclusive == false then this is the first slice)
-      auto input_starts(::GetStarts(rank, axis, dim - 1));
-      auto output_starts(::GetStarts(rank, axis, index));
-      ::CopySlices<T>(*input, output_tensor, input_starts, output_starts, slice_dims, steps, slice_size);
-      --index;
-    }
-
-    for (; index >= 0; --index) {
-      // Each output slice is the sum of corresponding input slice and the previous output slice
-      auto input_starts(::GetStarts(rank, axis, exclusive_ ? index + 1 : index));
-      auto output_starts(::GetStarts(rank, axis, index));
-      auto previous_starts(::GetStarts(rank, axis, index + 1));
-      ::SumSlices<T>(*input, output_tensor, input_starts, output_starts, previous_starts,
-                     slice_dims, steps, slice_size);
+  // The input is contiguous, so it decomposes into `before` independent [dim, inner] panels
+  // that are each scanned along the axis.
+  const auto dim = input->Shape()[onnxruntime::narrow<size_t>(axis)];  // dimension size for the axis
+  const int64_t before = input->Shape().SizeToDimension(onnxruntime::narrow<size_t>(axis));
+  const int64_t inner = input->Shape().SizeFromDimension(onnxruntime::narrow<size_t>(axis) + 1);
+
+  const T* input_data = input->Data<T>();
+  T* output_data = output_tensor.MutableData<T>();
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+
+  const bool exclusive = exclusive_ != 0;
+  const bool reverse = reverse_ != 0;
+
+  if (before == 1 && inner == 1) {
+    // A single long scan has no independent panels to spread across the pool, so split it into
+    // blocks with a fix-up pass instead. Deterministic sessions pin the block count so the
+    // accumulation order does not depend on the thread pool size.
+    constexpr int64_t kMinBlockSize = 16384;
+    constexpr int64_t kDeterministicMaxBlocks = 32;
+    const int64_t max_blocks = ctx->GetUseDeterministicCompute()
+                                   ? kDeterministicMaxBlocks
+                                   : concurrency::ThreadPool::DegreeOfParallelism(tp);
+    const int64_t n_blocks = std::min<int64_t>(max_blocks, (dim + kMinBlockSize - 1) / kMinBlockSize);
+    if (n_blocks > 1) {
+      ::BlockScan(input_data, output_data, dim, exclusive, reverse, n_blocks, tp);
+    } else {
+      ::ScanPanel(input_data, output_data, dim, int64_t{1}, exclusive, reverse);
     }
+    return Status::OK();
   }
 
+  // Panels are independent scans; spread them across the pool.
+  concurrency::ThreadPool::TryParallelFor(
+      tp, onnxruntime::narrow<std::ptrdiff_t>(before), static_cast<double>(dim * inner),
+      [=](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t p = first; p < last; ++p) {
+          const int64_t panel = p * dim * inner;
+          ::ScanPanel(input_data + panel, output_data + panel, dim, inner, exclusive, reverse);
+        }
+      });
+
   return Status::OK();
 }
 
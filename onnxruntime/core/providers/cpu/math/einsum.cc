@@ -3,6 +3,10 @@
 
 #include "einsum.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
 namespace onnxruntime {
 
 // Credit: Implementation influenced by Torch's implementation at the time of writing
@@ -17,6 +21,158 @@ ONNX_CPU_OPERATOR_KERNEL(
                                                DataTypeImpl::GetTensorType<int32_t>()}),
     Einsum);
 
+namespace {
+
+template <typename T>
+void DiagonalFastPathImpl(const Tensor& input, Tensor& output, int64_t n) {
+  const T* input_data = input.Data<T>();
+  T* output_data = output.MutableData<T>();
+  for (int64_t i = 0; i < n; ++i) {
+    output_data[i] = input_data[i * (n + 1)];
+  }
+}
+
+template <typename T>
+void TraceFastPathImpl(const Tensor& input, Tensor& output, int64_t n) {
+  const T* input_data = input.Data<T>();
+  T sum = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    sum += input_data[i * (n + 1)];
+  }
+  *output.MutableData<T>() = sum;
+}
+
+template <typename T>
+Status MatMulFastPathImpl(const Tensor& left, const Tensor& right, Tensor& output,
+                          size_t num_batches, size_t M, size_t K, size_t N,
+                          concurrency::ThreadPool* tp) {
+  return EinsumOp::DeviceHelpers::CpuDeviceHelpers::MatMul<T>(
+      left.Data<T>(), right.Data<T>(), output.MutableData<T>(),
+      M * K, K * N, M * N, num_batches, M, K, N, tp, nullptr);
+}
+
+}  // namespace
+
+Status Einsum::TryFastPath(OpKernelContext* context, const std::vector<const Tensor*>& inputs,
+                           concurrency::ThreadPool* tp, bool& handled) const {
+  handled = false;
+
+  if (fast_path_ == FastPathKind::kDiagonal || fast_path_ == FastPathKind::kTrace) {
+    if (inputs.size() != 1) {
+      return Status::OK();
+    }
+
+    const Tensor& input = *inputs[0];
+    const auto& dims = input.Shape().GetDims();
+    // A 1-dim may legally broadcast against the repeated label - leave that to the general path
+    if (dims.size() != 2 || dims[0] != dims[1]) {
+      return Status::OK();
+    }
+    int64_t n = dims[0];
+
+    if (fast_path_ == FastPathKind::kDiagonal) {
+      Tensor& output = *context->Output(0, TensorShape({n}));
+      if (n > 0) {
+        if (input.IsDataType<float>()) {
+          DiagonalFastPathImpl<float>(input, output, n);
+        } else if (input.IsDataType<int32_t>()) {
+          DiagonalFastPathImpl<int32_t>(input, output, n);
+        } else if (input.IsDataType<double>()) {
+          DiagonalFastPathImpl<double>(input, output, n);
+        } else if (input.IsDataType<int64_t>()) {
+          DiagonalFastPathImpl<int64_t>(input, output, n);
+        } else {
+          return Status::OK();
+        }
+      }
+    } else {
+      Tensor& output = *context->Output(0, TensorShape({}));
+      if (input.IsDataType<float>()) {
+        TraceFastPathImpl<float>(input, output, n);
+      } else if (input.IsDataType<int32_t>()) {
+        TraceFastPathImpl<int32_t>(input, output, n);
+      } else if (input.IsDataType<double>()) {
+        TraceFastPathImpl<double>(input, output, n);
+      } else if (input.IsDataType<int64_t>()) {
+        TraceFastPathImpl<int64_t>(input, output, n);
+      } else {
+        return Status::OK();
+      }
+    }
+
+    handled = true;
+    return Status::OK();
+  }
+
+  if (fast_path_ == FastPathKind::kBatchedMatMul) {
+    if (inputs.size() != 2) {
+      return Status::OK();
+    }
+
+    const Tensor& left = *inputs[0];
+    const Tensor& right = *inputs[1];
+    const auto& left_dims = left.Shape().GetDims();
+    const auto& right_dims = right.Shape().GetDims();
+    const size_t expected_rank = fast_path_batch_dims_ + 2;
+    if (left_dims.size() != expected_rank || right_dims.size() != expected_rank) {
+      return Status::OK();
+    }
+
+    // Shared labels must match exactly - a 1-dim may legally broadcast, which the plain
+    // batched matmul cannot honor
+    for (size_t i = 0; i < fast_path_batch_dims_; ++i) {
+      if (left_dims[i] != right_dims[i]) {
+        return Status::OK();
+      }
+    }
+    if (left_dims[fast_path_batch_dims_ + 1] != right_dims[fast_path_batch_dims_]) {
+      return Status::OK();
+    }
+
+    const auto M = static_cast<size_t>(left_dims[fast_path_batch_dims_]);
+    const auto K = static_cast<size_t>(left_dims[fast_path_batch_dims_ + 1]);
+    const auto N = static_cast<size_t>(right_dims[fast_path_batch_dims_ + 1]);
+
+    TensorShapeVector output_dims(left_dims.begin(), left_dims.begin() + fast_path_batch_dims_);
+    output_dims.push_back(static_cast<int64_t>(M));
+    output_dims.push_back(static_cast<int64_t>(N));
+    Tensor& output = *context->Output(0, TensorShape(output_dims));
+
+    const auto output_size = output.Shape().Size();
+    if (output_size == 0) {
+      handled = true;
+      return Status::OK();
+    }
+
+    if (K == 0) {
+      // Contraction over an empty axis - the result is all zeros
+      memset(output.MutableDataRaw(), 0, output.SizeInBytes());
+      handled = true;
+      return Status::OK();
+    }
+
+    const auto num_batches = static_cast<size_t>(output_size / static_cast<int64_t>(M * N));
+    Status status;
+    if (left.IsDataType<float>()) {
+      status = MatMulFastPathImpl<float>(left, right, output, num_batches, M, K, N, tp);
+    } else if (left.IsDataType<int32_t>()) {
+      status = MatMulFastPathImpl<int32_t>(left, right, output, num_batches, M, K, N, tp);
+    } else if (left.IsDataType<double>()) {
+      status = MatMulFastPathImpl<double>(left, right, output, num_batches, M, K, N, tp);
+    } else if (left.IsDataType<int64_t>()) {
+      status = MatMulFastPathImpl<int64_t>(left, right, output, num_batches, M, K, N, tp);
+    } else {
+      return Status::OK();
+    }
+
+    ORT_RETURN_IF_ERROR(status);
+    handled = true;
+    return Status::OK();
+  }
+
+  return Status::OK();
+}
+
 Status Einsum::Compute(OpKernelContext* context) const {
   int num_inputs = context->InputCount();
   if (num_inputs == 0) {
@@ -45,6 +201,16 @@ Status Einsum::Compute(OpKernelContext* context) const {
 
 Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const Tensor*>& inputs,
                              AllocatorPtr allocator, concurrency::ThreadPool* tp) const {
+  // Equation patterns detected at kernel creation (diagonal/trace/batched matmul) are computed
+  // directly, skipping the preprocessor and any transposed intermediates
+  if (fast_path_ != FastPathKind::kNone) {
+    bool handled = false;
+    ORT_RETURN_IF_ERROR(TryFastPath(context, inputs, tp, handled));
+    if (handled) {
+      return Status::OK();
+    }
+  }
+
   // EinsumComputePreprocessor section -
   auto einsum_compute_preprocessor =
       EinsumComputePreprocessor(*einsum_equation_preprocessor_, inputs, allocator, nullptr);
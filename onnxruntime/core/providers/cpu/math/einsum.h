@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+
 #ifndef SHARED_PROVIDER
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
@@ -18,17 +21,122 @@ class Einsum : public OpKernel {
     ORT_ENFORCE(info.GetAttr<std::string>("equation", &equation_).IsOK(),
                 "Missing 'equation' attribute");
     einsum_equation_preprocessor_ = std::make_unique<EinsumEquationPreprocessor>(equation_);
+    fast_path_ = DetectFastPath(*einsum_equation_preprocessor_, fast_path_batch_dims_);
   }
 
   virtual Status Compute(OpKernelContext* context) const override;
 
  protected:
+  // Contractions the CPU kernel can execute directly, without going through the generic
+  // transpose + matmul pipeline. The equation is attribute-static, so the pattern is
+  // detected once at kernel creation.
+  enum class FastPathKind {
+    kNone,
+    kDiagonal,       // 'ii->i'
+    kTrace,          // 'ii->'
+    kBatchedMatMul,  // '<batch>ij,<batch>jk-><batch>ik', with an identical batch prefix on all terms
+  };
+
   // Holds device specific (CPU / CUDA) compute logic
   virtual Status DeviceCompute(OpKernelContext* context, const std::vector<const Tensor*>& inputs,
                                AllocatorPtr allocator, concurrency::ThreadPool* tp) const;
 
   std::string equation_;
   std::unique_ptr<EinsumEquationPreprocessor> einsum_equation_preprocessor_;
+
+  FastPathKind fast_path_ = FastPathKind::kNone;
+  size_t fast_path_batch_dims_ = 0;  // number of leading batch dims for kBatchedMatMul
+
+ private:
+  // Defined inline as it is invoked from the constructor, which shared providers (CUDA / ROCm)
+  // compile without linking against this kernel's translation unit.
+  static FastPathKind DetectFastPath(const EinsumEquationPreprocessor& equation_preprocessor,
+                                     size_t& num_batch_dims) {
+    num_batch_dims = 0;
+
+    // Only explicit equations are considered - composing the output subscript of an implicit
+    // equation is left to the general implementation.
+    if (!equation_preprocessor.is_explicit_) {
+      return FastPathKind::kNone;
+    }
+
+    const auto& terms = equation_preprocessor.left_equation_split_;
+    const std::string& output = equation_preprocessor.right_equation_;
+
+    // No ellipses anywhere - every subscript label must be a plain letter
+    auto all_letters = [](const std::string& term) -> bool {
+      return std::all_of(term.begin(), term.end(),
+                         [](char ch) { return EinsumOp::LetterToIndex(ch) != -1; });
+    };
+    for (const auto& term : terms) {
+      if (!all_letters(term)) {
+        return FastPathKind::kNone;
+      }
+    }
+    if (!all_letters(output)) {
+      return FastPathKind::kNone;
+    }
+
+    if (terms.size() == 1) {
+      const std::string& term = terms[0];
+      if (term.size() == 2 && term[0] == term[1]) {
+        if (output.size() == 1 && output[0] == term[0]) {
+          return FastPathKind::kDiagonal;
+        }
+        if (output.empty()) {
+          return FastPathKind::kTrace;
+        }
+      }
+      return FastPathKind::kNone;
+    }
+
+    if (terms.size() == 2) {
+      const std::string& left = terms[0];
+      const std::string& right = terms[1];
+      if (left.size() < 2 || left.size() != right.size() || output.size() != left.size()) {
+        return FastPathKind::kNone;
+      }
+
+      // Both terms and the output must carry an identical batch prefix
+      size_t batch = left.size() - 2;
+      if (!std::equal(left.begin(), left.begin() + batch, right.begin()) ||
+          !std::equal(left.begin(), left.begin() + batch, output.begin())) {
+        return FastPathKind::kNone;
+      }
+
+      const char m_label = left[batch];
+      const char k_label = left[batch + 1];
+      const char n_label = right[batch + 1];
+      if (right[batch] != k_label || output[batch] != m_label || output[batch + 1] != n_label) {
+        return FastPathKind::kNone;
+      }
+
+      // All labels must be distinct, otherwise the equation carries hidden diagonal/reduction
+      // semantics that the plain matmul would miss
+      std::array<bool, EinsumOp::num_of_letters> seen{};
+      for (char ch : left) {
+        auto letter = static_cast<size_t>(EinsumOp::LetterToIndex(ch));
+        if (seen[letter]) {
+          return FastPathKind::kNone;
+        }
+        seen[letter] = true;
+      }
+      if (seen[static_cast<size_t>(EinsumOp::LetterToIndex(n_label))]) {
+        return FastPathKind::kNone;
+      }
+
+      num_batch_dims = batch;
+      return FastPathKind::kBatchedMatMul;
+    }
+
+    return FastPathKind::kNone;
+  }
+
+  // Runs the detected fast path if the runtime shapes allow it (exact dim matches, no
+  // numpy-style broadcast of a 1-dim). Sets `handled` to false to fall back to the
+  // general implementation.
+  Status TryFastPath(OpKernelContext* context, const std::vector<const Tensor*>& inputs,
+                     concurrency::ThreadPool* tp, bool& handled) const;
 };
 
 }  // namespace onnxruntime
@@ -13,6 +13,7 @@
 #include "core/mlas/inc/mlas.h"
 
 #include <cmath>
+#include <cstring>
 
 namespace onnxruntime {
 // Supported types for operators that have type reduction enabled
@@ -1943,6 +1944,127 @@ void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFun
   BroadcastLooper(broadcast_helper, funcs);
 }
 
+// Process the first total_size elements of the output by parallelizing across the spans of an
+// InputBroadcaster that is positioned at the start of the input.
+static void BroadcastParallelAcrossSpans(concurrency::ThreadPool* tp,
+                                         const InputBroadcaster& input_broadcaster,
+                                         Tensor& output_tensor, std::ptrdiff_t total_size,
+                                         const ProcessBroadcastSpanFuncs& funcs, double unit_cost,
+                                         void* user_data) {
+  const size_t span_size = input_broadcaster.GetSpanSize();
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, total_size / narrow<std::ptrdiff_t>(span_size),
+      TensorOpCost{static_cast<double>(input_broadcaster.Input0ElementSize()) * span_size,
+                   static_cast<double>(output_tensor.DataType()->Size()) * span_size,
+                   unit_cost * span_size},
+      [span_size, &input_broadcaster, &output_tensor, &funcs, user_data](std::ptrdiff_t first_span,
+                                                                         std::ptrdiff_t last_span) {
+        // copy original input_broadcaster (which is at start of all input) and advance to this segment
+        InputBroadcaster segment_input_broadcaster(input_broadcaster);
+        segment_input_broadcaster.AdvanceBy(first_span * span_size);
+
+        // create broadcaster for this segment of output
+        OutputBroadcaster segment_output_broadcaster(span_size, output_tensor,
+                                                     first_span * span_size, last_span * span_size);
+
+        BroadcastHelper segment_helper(segment_input_broadcaster, segment_output_broadcaster, user_data);
+        BroadcastLooper(segment_helper, funcs);
+      });
+}
+
+// Fast path for broadcasts that replay one contiguous block of the smaller input across the whole
+// output, such as a [D] bias or [1,1,T] mask applied to [B,T,D] activations. When the block is
+// small, the per-span functor dispatch and iterator bookkeeping dominate the vectorized work each
+// span does, so replicate the block into a larger tile once and re-run the broadcast with tile
+// sized spans. Returns false if the broadcast doesn't match the pattern, in which case nothing
+// has been processed.
+static bool TryTiledSingleBlockBroadcast(OpKernelContext& context, concurrency::ThreadPool* tp,
+                                         const Tensor& input0_tensor, const Tensor& input1_tensor,
+                                         Tensor& output_tensor,
+                                         const InputBroadcaster& input_broadcaster,
+                                         const ProcessBroadcastSpanFuncs& funcs, double unit_cost,
+                                         void* user_data) {
+  // spans at or above kSmallSpanElements amortize the per-span overhead well enough already.
+  // kTileElements trades per-span overhead against the tile staying resident in the innermost caches.
+  constexpr size_t kSmallSpanElements = 256;
+  constexpr size_t kTileElements = 4096;
+
+  const size_t span_size = input_broadcaster.GetSpanSize();
+  if (span_size == 0 || span_size >= kSmallSpanElements) {
+    return false;
+  }
+
+  const bool replay_input0 =
+      input_broadcaster.IsInput0SingleBlockReplay() && input_broadcaster.IsInput1Contiguous();
+  const bool replay_input1 =
+      input_broadcaster.IsInput1SingleBlockReplay() && input_broadcaster.IsInput0Contiguous();
+  if (replay_input0 == replay_input1) {
+    return false;
+  }
+
+  const Tensor& replayed_tensor = replay_input0 ? input0_tensor : input1_tensor;
+  const Tensor& full_tensor = replay_input0 ? input1_tensor : input0_tensor;
+
+  // the tile is built with memcpy so the replayed elements must be trivially copyable
+  if (replayed_tensor.IsDataTypeString()) {
+    return false;
+  }
+
+  const size_t output_size = narrow<size_t>(output_tensor.Shape().Size());
+  const size_t num_spans = output_size / span_size;
+  const size_t spans_per_tile = std::min(num_spans, kTileElements / span_size);
+  if (spans_per_tile < 2) {
+    return false;
+  }
+
+  AllocatorPtr allocator;
+  if (!context.GetTempSpaceAllocator(&allocator).IsOK()) {
+    return false;
+  }
+
+  const size_t block_bytes = span_size * replayed_tensor.DataType()->Size();
+  const size_t tile_elements = spans_per_tile * span_size;
+  const size_t tile_bytes = spans_per_tile * block_bytes;
+  IAllocatorUniquePtr<uint8_t> tile = IAllocator::MakeUniquePtr<uint8_t>(allocator, tile_bytes);
+
+  // replicate the block, doubling the copied range each iteration
+  memcpy(tile.get(), replayed_tensor.DataRaw(), block_bytes);
+  size_t filled_bytes = block_bytes;
+  while (filled_bytes < tile_bytes) {
+    size_t bytes_to_copy = std::min(filled_bytes, tile_bytes - filled_bytes);
+    memcpy(tile.get() + filled_bytes, tile.get(), bytes_to_copy);
+    filled_bytes += bytes_to_copy;
+  }
+
+  // view the same broadcast as 'tile op [num_tiles, tile]' so each span covers a full tile
+  const size_t num_tiles = num_spans / spans_per_tile;
+  const size_t tiled_size = num_tiles * tile_elements;
+
+  Tensor tile_tensor(replayed_tensor.DataType(), TensorShape({narrow<int64_t>(tile_elements)}),
+                     tile.get(), allocator->Info());
+  Tensor full_view(full_tensor.DataType(),
+                   TensorShape({narrow<int64_t>(num_tiles), narrow<int64_t>(tile_elements)}),
+                   const_cast<void*>(full_tensor.DataRaw()), full_tensor.Location());
+
+  InputBroadcaster tiled_broadcaster(replay_input0 ? tile_tensor : full_view,
+                                     replay_input0 ? full_view : tile_tensor);
+  BroadcastParallelAcrossSpans(tp, tiled_broadcaster, output_tensor, narrow<std::ptrdiff_t>(tiled_size),
+                               funcs, unit_cost, user_data);
+
+  // any leftover spans that don't fill a tile are processed with the original broadcaster
+  if (tiled_size < output_size) {
+    InputBroadcaster remainder_broadcaster(input_broadcaster);
+    remainder_broadcaster.AdvanceBy(tiled_size);
+    OutputBroadcaster remainder_output(span_size, output_tensor, narrow<std::ptrdiff_t>(tiled_size),
+                                       narrow<std::ptrdiff_t>(output_size));
+    BroadcastHelper remainder_helper(remainder_broadcaster, remainder_output, user_data);
+    BroadcastLooper(remainder_helper, funcs);
+  }
+
+  return true;
+}
+
 // Variant of UntypedBroadcastTwo that will parallelize.
 // Operator usage is the same as the parallelization is opaque to the operator.
 // unit_cost must be a valid cost value.
@@ -1970,28 +2092,13 @@ void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFun
     BroadcastLooper(broadcast_helper, funcs);
   } else {
     // Input data will be processed in multiple spans, so parallelize across spans.
+    if (TryTiledSingleBlockBroadcast(context, tp, input0_tensor, input1_tensor, output_tensor,
+                                     input_broadcaster, funcs, unit_cost, user_data)) {
+      return;
+    }
 
-    // enforce const on input broadcaster we copy from
-    const InputBroadcaster& const_input_broadcaster = input_broadcaster;
-
-    concurrency::ThreadPool::TryParallelFor(
-        tp, output_size / span_size,
-        TensorOpCost{static_cast<double>(input_broadcaster.Input0ElementSize()) * span_size,
-                     static_cast<double>(output_tensor.DataType()->Size()) * span_size,
-                     unit_cost * span_size},
-        [span_size, &const_input_broadcaster, &output_tensor, &funcs, user_data](std::ptrdiff_t first_span,
-                                                                                 std::ptrdiff_t last_span) {
-          // copy original input_broadcaster (which is at start of all input) and advance to this segment
-          InputBroadcaster segment_input_broadcaster(const_input_broadcaster);
-          segment_input_broadcaster.AdvanceBy(first_span * span_size);
-
-          // create broadcaster for this segment of output
-          OutputBroadcaster segment_output_broadcaster(span_size, output_tensor,
-                                                       first_span * span_size, last_span * span_size);
-
-          BroadcastHelper segment_helper(segment_input_broadcaster, segment_output_broadcaster, user_data);
-          BroadcastLooper(segment_helper, funcs);
-        });
+    BroadcastParallelAcrossSpans(tp, input_broadcaster, output_tensor, narrow<std::ptrdiff_t>(output_size),
+                                 funcs, unit_cost, user_data);
   }
 }
 
@@ -556,6 +556,17 @@ struct BroadcastIterator {
     return deltas_.front();
   }
 
+  // True if the iterator walks its input sequentially with no broadcasting involved.
+  bool IsContiguous() const {
+    return deltas_.size() == 1 && deltas_[0] == 1;
+  }
+
+  // True if the iterator replays a single contiguous block of GetCountsFront() elements for the
+  // entire output, e.g. the smaller input of a [D] op [B,T,D] or [1,1,D] op [B,T,D] broadcast.
+  bool IsSingleBlockReplay() const {
+    return deltas_.size() == 2 && deltas_[0] == 1 && deltas_[1] == -counts_[0];
+  }
+
   void Append(ptrdiff_t axis, ptrdiff_t largest) {
     ORT_ENFORCE(axis == 1 || axis == largest, "Attempting to broadcast an axis by a dimension other than 1. ", axis, " by ", largest);
 
@@ -731,6 +742,12 @@ struct InputBroadcaster {
   bool IsInput0Scalar() const { return broadcaster_.iterator1_.GetDeltasFront() == 0; }
   bool IsInput1Scalar() const { return broadcaster_.iterator2_.GetDeltasFront() == 0; }
 
+  bool IsInput0Contiguous() const { return broadcaster_.iterator1_.IsContiguous(); }
+  bool IsInput1Contiguous() const { return broadcaster_.iterator2_.IsContiguous(); }
+
+  bool IsInput0SingleBlockReplay() const { return broadcaster_.iterator1_.IsSingleBlockReplay(); }
+  bool IsInput1SingleBlockReplay() const { return broadcaster_.iterator2_.IsSingleBlockReplay(); }
+
   size_t Input0ElementSize() const { return input0_element_size_; }
   size_t Input1ElementSize() const { return input1_element_size_; }
 
@@ -0,0 +1,416 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cpu/math/elementwise_chain.h"
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "core/common/inlined_containers.h"
+#include "core/common/narrow.h"
+#include "core/framework/compute_capability.h"
+#include "core/framework/op_kernel.h"
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/constants.h"
+#include "core/graph/graph_viewer.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/partitioning_utils.h"
+
+namespace onnxruntime {
+namespace elementwise_chain {
+
+namespace {
+
+// Keep the per-tile working set (one tile per live register) cache resident.
+constexpr int64_t kTileSize = 1024;
+
+// Upper bound on nodes per fused group so the register file stays small. Groups larger than this are
+// left to the per-op kernels; real activation chains are far shorter.
+constexpr size_t kMaxChainNodes = 32;
+
+enum class OpCode : uint8_t {
+  kAdd,
+  kSub,
+  kMul,
+  kDiv,
+  kSigmoid,
+  kTanh,
+  kRelu,
+  kLeakyRelu,
+  kExp,
+  kNeg,
+  kSqrt,
+  kAbs,
+  kErf,
+};
+
+struct OpEntry {
+  OpCode op;
+  int num_inputs;
+  // minimum opset where the op has the semantics the interpreter implements. binary ops need 7+
+  // for numpy-style broadcast (we only accept the same-shape/scalar subset of it anyway).
+  int min_since_version;
+};
+
+const OpEntry* LookUpOp(const std::string& op_type) {
+  static const std::unordered_map<std::string, OpEntry> op_table = {
+      {"Add", {OpCode::kAdd, 2, 7}},
+      {"Sub", {OpCode::kSub, 2, 7}},
+      {"Mul", {OpCode::kMul, 2, 7}},
+      {"Div", {OpCode::kDiv, 2, 7}},
+      {"Sigmoid", {OpCode::kSigmoid, 1, 6}},
+      {"Tanh", {OpCode::kTanh, 1, 6}},
+      {"Relu", {OpCode::kRelu, 1, 6}},
+      {"LeakyRelu", {OpCode::kLeakyRelu, 1, 6}},
+      {"Exp", {OpCode::kExp, 1, 6}},
+      {"Neg", {OpCode::kNeg, 1, 6}},
+      {"Sqrt", {OpCode::kSqrt, 1, 6}},
+      {"Abs", {OpCode::kAbs, 1, 6}},
+      {"Erf", {OpCode::kErf, 1, 9}},
+  };
+
+  auto it = op_table.find(op_type);
+  return it == op_table.end() ? nullptr : &it->second;
+}
+
+bool IsFloatTensor(const NodeArg& node_arg) {
+  const auto* type_proto = node_arg.TypeAsProto();
+  return type_proto != nullptr && type_proto->has_tensor_type() &&
+         type_proto->tensor_type().elem_type() == ONNX_NAMESPACE::TensorProto_DataType_FLOAT;
+}
+
+// a statically known single-element shape. such inputs are treated as uniform (broadcast) operands.
+bool IsScalarShape(const ONNX_NAMESPACE::TensorShapeProto& shape) {
+  int64_t size = 1;
+  for (const auto& dim : shape.dim()) {
+    if (!utils::HasDimValue(dim)) {
+      return false;
+    }
+    size *= dim.dim_value();
+  }
+  return size == 1;
+}
+
+bool SameShape(const ONNX_NAMESPACE::TensorShapeProto& a, const ONNX_NAMESPACE::TensorShapeProto& b) {
+  if (a.dim_size() != b.dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < a.dim_size(); ++i) {
+    const auto& dim_a = a.dim(i);
+    const auto& dim_b = b.dim(i);
+    if (utils::HasDimValue(dim_a) && utils::HasDimValue(dim_b)) {
+      if (dim_a.dim_value() != dim_b.dim_value()) {
+        return false;
+      }
+    } else if (utils::HasDimParam(dim_a) && utils::HasDimParam(dim_b)) {
+      if (dim_a.dim_param() != dim_b.dim_param()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A node qualifies if it is a float elementwise op whose inputs are all either the same shape as its
+// output or statically scalar, so the whole chain can be evaluated with one index per element and no
+// general broadcasting.
+bool IsSupportedNode(const Node& node) {
+  if (!node.GetExecutionProviderType().empty() || node.Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  const OpEntry* entry = LookUpOp(node.OpType());
+  if (entry == nullptr || node.SinceVersion() < entry->min_since_version) {
+    return false;
+  }
+
+  const auto& input_defs = node.InputDefs();
+  if (input_defs.size() != static_cast<size_t>(entry->num_inputs) || node.OutputDefs().size() != 1) {
+    return false;
+  }
+
+  const NodeArg& output = *node.OutputDefs()[0];
+  const auto* output_shape = output.Shape();
+  if (!IsFloatTensor(output) || output_shape == nullptr || IsScalarShape(*output_shape)) {
+    return false;
+  }
+
+  for (const NodeArg* input : input_defs) {
+    if (input == nullptr || !input->Exists() || !IsFloatTensor(*input)) {
+      return false;
+    }
+    const auto* input_shape = input->Shape();
+    if (input_shape == nullptr ||
+        (!IsScalarShape(*input_shape) && !SameShape(*input_shape, *output_shape))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// where a register's tile comes from when an instruction reads or writes it.
+enum class RegKind : uint8_t {
+  kScalarInput,  // splatted scalar input; lives in a scratch tile filled once per worker
+  kTensorInput,  // full-size fused-node input; read in place
+  kOutput,       // fused-node output; written in place
+  kScratch,      // chain-internal value; lives in a scratch tile
+};
+
+struct RegInfo {
+  RegKind kind;
+  int slot;   // input index, output index or scratch tile index depending on kind
+  int input;  // for kScalarInput: the input index the splatted value comes from
+};
+
+struct Instruction {
+  OpCode op;
+  int in0;
+  int in1;  // -1 for unary ops
+  int out;
+  float alpha;  // LeakyRelu
+};
+
+struct ChainProgram {
+  InlinedVector<Instruction> instructions;
+  InlinedVector<RegInfo> regs;
+  size_t num_inputs = 0;
+  size_t num_outputs = 0;
+  size_t num_scratch_tiles = 0;
+  int shape_input = -1;  // first non-scalar input; provides the common element count and output shape
+};
+
+void ApplyOp(const Instruction& instr, const float* a, const float* b, float* out, int64_t n) {
+  switch (instr.op) {
+    case OpCode::kAdd:
+      for (int64_t i = 0; i < n; ++i) out[i] = a[i] + b[i];
+      break;
+    case OpCode::kSub:
+      for (int64_t i = 0; i < n; ++i) out[i] = a[i] - b[i];
+      break;
+    case OpCode::kMul:
+      for (int64_t i = 0; i < n; ++i) out[i] = a[i] * b[i];
+      break;
+    case OpCode::kDiv:
+      for (int64_t i = 0; i < n; ++i) out[i] = a[i] / b[i];
+      break;
+    case OpCode::kSigmoid:
+      MlasComputeLogistic(a, out, narrow<size_t>(n));
+      break;
+    case OpCode::kTanh:
+      MlasComputeTanh(a, out, narrow<size_t>(n));
+      break;
+    case OpCode::kRelu:
+      for (int64_t i = 0; i < n; ++i) out[i] = std::max(a[i], 0.0f);
+      break;
+    case OpCode::kLeakyRelu:
+      for (int64_t i = 0; i < n; ++i) out[i] = a[i] >= 0.0f ? a[i] : instr.alpha * a[i];
+      break;
+    case OpCode::kExp:
+      MlasComputeExp(a, out, narrow<size_t>(n));
+      break;
+    case OpCode::kNeg:
+      for (int64_t i = 0; i < n; ++i) out[i] = -a[i];
+      break;
+    case OpCode::kSqrt:
+      for (int64_t i = 0; i < n; ++i) out[i] = std::sqrt(a[i]);
+      break;
+    case OpCode::kAbs:
+      for (int64_t i = 0; i < n; ++i) out[i] = std::fabs(a[i]);
+      break;
+    case OpCode::kErf:
+      MlasComputeErf(a, out, narrow<size_t>(n));
+      break;
+  }
+}
+
+Status ExecuteChain(const ChainProgram& program, OpKernelContext& ctx) {
+  const Tensor& shape_tensor = *ctx.Input<Tensor>(program.shape_input);
+  const TensorShape& shape = shape_tensor.Shape();
+  const int64_t total = shape.Size();
+
+  InlinedVector<const float*> input_data(program.num_inputs, nullptr);
+  InlinedVector<float> scalar_values(program.num_inputs, 0.0f);
+  for (size_t i = 0; i < program.num_inputs; ++i) {
+    const Tensor& input = *ctx.Input<Tensor>(narrow<int>(i));
+    if (program.regs[i].kind == RegKind::kScalarInput) {
+      ORT_RETURN_IF_NOT(input.Shape().Size() == 1, "Input ", i, " expected to be a scalar.");
+      scalar_values[i] = *input.Data<float>();
+    } else {
+      ORT_RETURN_IF_NOT(input.Shape().Size() == total, "Input ", i, " element count mismatch.");
+      input_data[i] = input.Data<float>();
+    }
+  }
+
+  InlinedVector<float*> output_data(program.num_outputs, nullptr);
+  for (size_t i = 0; i < program.num_outputs; ++i) {
+    output_data[i] = ctx.Output(narrow<int>(i), shape)->MutableData<float>();
+  }
+
+  if (total == 0) {
+    return Status::OK();
+  }
+
+  const int64_t num_tiles = (total + kTileSize - 1) / kTileSize;
+  concurrency::ThreadPool* tp = ctx.GetOperatorThreadPool();
+  const int64_t num_workers =
+      std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp), num_tiles);
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, narrow<std::ptrdiff_t>(num_workers), [&](std::ptrdiff_t worker) {
+        const int64_t tiles_begin = num_tiles * worker / num_workers;
+        const int64_t tiles_end = num_tiles * (worker + 1) / num_workers;
+
+        InlinedVector<float> scratch(program.num_scratch_tiles * kTileSize);
+        // splat the scalar inputs once; their tiles are read-only from here on
+        for (size_t i = 0; i < program.num_inputs; ++i) {
+          const RegInfo& reg = program.regs[i];
+          if (reg.kind == RegKind::kScalarInput) {
+            std::fill_n(scratch.data() + reg.slot * kTileSize, kTileSize, scalar_values[reg.input]);
+          }
+        }
+
+        auto resolve = [&](int reg_index, int64_t offset) -> float* {
+          const RegInfo& reg = program.regs[reg_index];
+          switch (reg.kind) {
+            case RegKind::kTensorInput:
+              return const_cast<float*>(input_data[reg.slot]) + offset;
+            case RegKind::kOutput:
+              return output_data[reg.slot] + offset;
+            case RegKind::kScalarInput:
+            case RegKind::kScratch:
+            default:
+              return scratch.data() + reg.slot * kTileSize;
+          }
+        };
+
+        for (int64_t tile = tiles_begin; tile < tiles_end; ++tile) {
+          const int64_t offset = tile * kTileSize;
+          const int64_t n = std::min(kTileSize, total - offset);
+          for (const Instruction& instr : program.instructions) {
+            const float* a = resolve(instr.in0, offset);
+            const float* b = instr.in1 >= 0 ? resolve(instr.in1, offset) : nullptr;
+            ApplyOp(instr, a, b, resolve(instr.out, offset), n);
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+Status BuildChainProgram(const Node& fused_node, const GraphViewer& graph_viewer,
+                         ChainProgram& program) {
+  std::unordered_map<std::string, int> reg_map;
+
+  const auto& fused_inputs = fused_node.InputDefs();
+  program.num_inputs = fused_inputs.size();
+  program.regs.reserve(program.num_inputs + graph_viewer.NumberOfNodes());
+
+  int num_scratch = 0;
+  for (size_t i = 0; i < fused_inputs.size(); ++i) {
+    const NodeArg& input = *fused_inputs[i];
+    const auto* shape = input.Shape();
+    ORT_RETURN_IF_NOT(shape != nullptr, "Fused elementwise input has no shape: ", input.Name());
+    RegInfo reg;
+    if (IsScalarShape(*shape)) {
+      reg = {RegKind::kScalarInput, num_scratch++, narrow<int>(i)};
+    } else {
+      reg = {RegKind::kTensorInput, narrow<int>(i), -1};
+      if (program.shape_input < 0) {
+        program.shape_input = narrow<int>(i);
+      }
+    }
+    reg_map.emplace(input.Name(), narrow<int>(program.regs.size()));
+    program.regs.push_back(reg);
+  }
+
+  ORT_RETURN_IF_NOT(program.shape_input >= 0,
+                    "Fused elementwise chain has no non-scalar input: ", fused_node.Name());
+
+  for (NodeIndex node_index : graph_viewer.GetNodesInTopologicalOrder()) {
+    const Node& node = *graph_viewer.GetNode(node_index);
+    const OpEntry* entry = LookUpOp(node.OpType());
+    ORT_RETURN_IF_NOT(entry != nullptr, "Unexpected op in fused elementwise chain: ", node.OpType());
+
+    Instruction instr{entry->op, -1, -1, -1, 0.0f};
+    const auto& input_defs = node.InputDefs();
+    ORT_RETURN_IF_NOT(input_defs.size() == static_cast<size_t>(entry->num_inputs),
+                      "Unexpected input count for ", node.OpType());
+    for (int i = 0; i < entry->num_inputs; ++i) {
+      auto it = reg_map.find(input_defs[i]->Name());
+      ORT_RETURN_IF_NOT(it != reg_map.end(), "Chain input not produced yet: ", input_defs[i]->Name());
+      (i == 0 ? instr.in0 : instr.in1) = it->second;
+    }
+
+    if (entry->op == OpCode::kLeakyRelu) {
+      instr.alpha = 0.01f;
+      auto attr = node.GetAttributes().find("alpha");
+      if (attr != node.GetAttributes().end()) {
+        instr.alpha = attr->second.f();
+      }
+    }
+
+    instr.out = narrow<int>(program.regs.size());
+    reg_map.emplace(node.OutputDefs()[0]->Name(), instr.out);
+    program.regs.push_back({RegKind::kScratch, num_scratch++, -1});
+    program.instructions.push_back(instr);
+  }
+
+  // fused-node outputs are computed straight into the output buffers instead of scratch tiles
+  const auto& fused_outputs = fused_node.OutputDefs();
+  program.num_outputs = fused_outputs.size();
+  for (size_t i = 0; i < fused_outputs.size(); ++i) {
+    auto it = reg_map.find(fused_outputs[i]->Name());
+    ORT_RETURN_IF_NOT(it != reg_map.end(),
+                      "Fused node output not produced by chain: ", fused_outputs[i]->Name());
+    program.regs[it->second] = {RegKind::kOutput, narrow<int>(i), -1};
+  }
+
+  program.num_scratch_tiles = narrow<size_t>(num_scratch);
+  return Status::OK();
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<ComputeCapability>> FindChainPartitions(
+    const GraphViewer& graph_viewer,
+    const std::function<std::string()>& generate_metadef_name) {
+  const utils::IsNodeSupportedFn is_node_supported = [](const Node& node) {
+    return IsSupportedNode(node);
+  };
+
+  // only fuse genuine chains; a single elementwise node gains nothing over its regular kernel
+  const utils::OnGroupClosedFn on_group_closed = [](const std::vector<const Node*>& group) {
+    return group.size() >= 2 && group.size() <= kMaxChainNodes;
+  };
+
+  return utils::CreateSupportedPartitions(graph_viewer, is_node_supported, on_group_closed,
+                                          generate_metadef_name, kCpuExecutionProvider,
+                                          kCpuExecutionProvider);
+}
+
+Status CompileChain(const Node& fused_node, const GraphViewer& graph_viewer,
+                    NodeComputeInfo& compute_info) {
+  auto program = std::make_shared<ChainProgram>();
+  ORT_RETURN_IF_ERROR(BuildChainProgram(fused_node, graph_viewer, *program));
+
+  compute_info.compute_func = [program = std::move(program)](FunctionState /*state*/,
+                                                             const OrtApi* /*api*/,
+                                                             OrtKernelContext* context) -> Status {
+    // FunctionKernel hands us its OpKernelContext behind the C API type
+    return ExecuteChain(*program, *reinterpret_cast<OpKernelContext*>(context));
+  };
+
+  return Status::OK();
+}
+
+}  // namespace elementwise_chain
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if !defined(ORT_MINIMAL_BUILD)
+
+#include <memory>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/execution_provider.h"
+
+namespace onnxruntime {
+struct ComputeCapability;
+class GraphViewer;
+class Node;
+
+// Fusion of chains of same-shape elementwise ops (Add/Mul/Sigmoid/... as in Swish or erf-based Gelu
+// subgraphs) into a single compiled kernel that evaluates the whole chain one cache-resident tile at
+// a time instead of making a full pass over memory per node. The fused groups are returned from
+// CPUExecutionProvider::GetCapability as ComputeCapability instances with a MetaDef, and compiled by
+// CPUExecutionProvider::Compile into a small register-based program that a template interpreter
+// executes per tile.
+namespace elementwise_chain {
+
+// Find groups of fusible elementwise nodes in the graph. Returned capabilities all have a MetaDef so
+// the partitioner fuses them and routes them through Compile. Nodes that don't qualify are left for
+// the regular per-op kernels.
+std::vector<std::unique_ptr<ComputeCapability>> FindChainPartitions(
+    const GraphViewer& graph_viewer,
+    const std::function<std::string()>& generate_metadef_name);
+
+// Compile one fused chain into a NodeComputeInfo that interprets the chain tile by tile.
+Status CompileChain(const Node& fused_node, const GraphViewer& graph_viewer,
+                    NodeComputeInfo& compute_info);
+
+}  // namespace elementwise_chain
+}  // namespace onnxruntime
+
+#endif  // !defined(ORT_MINIMAL_BUILD)
@@ -408,6 +408,36 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   const float* c_data = C != nullptr ? C->Data<float>() : nullptr;
   const TensorShape* c_shape = C != nullptr ? &C->Shape() : nullptr;
 
+  if (fused_activation_.ActivationKind != MlasIdentityActivation) {
+    // FusedGemm with an MLAS-supported activation: run the activation as a GEMM epilogue applied
+    // to each output tile while it is still cache resident instead of as a second pass over Y.
+    GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
+
+    MLAS_SGEMM_ACTIVATION_PROCESSOR activation_processor(fused_activation_);
+    MLAS_SGEMM_DATA_PARAMS data;
+    data.A = A->Data<float>();
+    data.lda = static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K);
+    data.alpha = alpha_;
+    data.beta = c_data != nullptr ? beta_ : 0.0f;
+    data.C = y_data;
+    data.ldc = static_cast<size_t>(N);
+    data.OutputProcessor = &activation_processor;
+    CBLAS_TRANSPOSE trans_b = trans_B_;
+    if (B) {
+      data.B = B->Data<float>();
+      data.ldb = static_cast<size_t>(trans_B_ != CblasNoTrans ? K : N);
+    } else {
+      data.B = static_cast<const float*>(packed_b_.get());
+      data.BIsPacked = true;
+      trans_b = CblasNoTrans;
+    }
+
+    MlasGemmBatch(trans_A_, trans_b, static_cast<size_t>(M), static_cast<size_t>(N),
+                  static_cast<size_t>(K), &data, 1, thread_pool);
+
+    return Status::OK();
+  }
+
   if (B) {
     ComputeGemm(trans_A_, trans_B_, M, N, K, alpha_, A->Data<float>(), B->Data<float>(), beta_,
                 c_data, c_shape, y_data, thread_pool);
@@ -7,6 +7,7 @@
 
 #include "core/framework/op_kernel.h"
 #include "core/common/common.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/util/math.h"
 #include "core/providers/cpu/activation/activations.h"
 
@@ -44,6 +45,11 @@ class Gemm : protected GemmBase, public OpKernel {
   // For fused gemm + activation
   std::unique_ptr<functors::ElementWiseRangedTransform<T>> activation_;
 
+  // When the fused activation maps to an MLAS activation kind, it is applied as a GEMM epilogue
+  // tile by tile while the output is still cache resident instead of via activation_ as a second
+  // pass over the output (float only). MlasIdentityActivation means no fused MLAS activation.
+  MLAS_ACTIVATION fused_activation_{MlasIdentityActivation, {{0.0f}}};
+
   void ComputeActivation(_Inout_updates_(y_size) T* y_data, ptrdiff_t y_size, _Inout_opt_ concurrency::ThreadPool* thread_pool) const;
 };
 
@@ -2,6 +2,11 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/math/matmul.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
@@ -124,7 +129,7 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
 
   return Status::OK();
 }
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
 bool GemmPackBBfloat16(AllocatorPtr& alloc,
                        const Tensor& tensor_b,
                        bool trans_b,
@@ -163,6 +168,65 @@ bool GemmPackBBfloat16(AllocatorPtr& alloc,
 }
 #endif
 
+// Builds a CSR representation of a 2-D float weight matrix when the fraction of zero
+// elements meets the configured threshold. alpha is folded into the stored values.
+// Returns false to fall back to dense packing.
+static bool TrySparsePackB(AllocatorPtr& alloc,
+                           const Tensor& tensor_b,
+                           float sparse_weight_threshold,
+                           float alpha,
+                           IAllocatorUniquePtr<void>& row_begin_buffer,
+                           IAllocatorUniquePtr<void>& cols_buffer,
+                           IAllocatorUniquePtr<void>& values_buffer,
+                           size_t& nnz,
+                           TensorShape& b_shape) {
+  if (tensor_b.Shape().NumDimensions() != 2) {
+    return false;
+  }
+
+  const int64_t K = tensor_b.Shape()[0];
+  const int64_t N = tensor_b.Shape()[1];
+  // The CSR indices are stored as int32_t.
+  if (K <= 0 || N <= 0 ||
+      K >= std::numeric_limits<int32_t>::max() || N >= std::numeric_limits<int32_t>::max() ||
+      K * N >= std::numeric_limits<int32_t>::max()) {
+    return false;
+  }
+
+  const size_t num_elements = static_cast<size_t>(K * N);
+  const float* b_data = tensor_b.Data<float>();
+  const size_t zero_count = static_cast<size_t>(std::count(b_data, b_data + num_elements, 0.0f));
+  if (static_cast<double>(zero_count) < static_cast<double>(num_elements) * sparse_weight_threshold) {
+    return false;
+  }
+
+  nnz = num_elements - zero_count;
+  row_begin_buffer = IAllocator::MakeUniquePtr<void>(alloc, static_cast<size_t>(K + 1) * sizeof(int32_t), true);
+  cols_buffer = IAllocator::MakeUniquePtr<void>(alloc, std::max<size_t>(nnz, 1) * sizeof(int32_t), true);
+  values_buffer = IAllocator::MakeUniquePtr<void>(alloc, std::max<size_t>(nnz, 1) * sizeof(float), true);
+
+  auto* row_begin = static_cast<int32_t*>(row_begin_buffer.get());
+  auto* cols = static_cast<int32_t*>(cols_buffer.get());
+  auto* values = static_cast<float*>(values_buffer.get());
+
+  int32_t count = 0;
+  for (int64_t k = 0; k < K; ++k) {
+    row_begin[k] = count;
+    const float* b_row = b_data + k * N;
+    for (int64_t n = 0; n < N; ++n) {
+      if (b_row[n] != 0.0f) {
+        cols[count] = static_cast<int32_t>(n);
+        values[count] = alpha * b_row[n];
+        ++count;
+      }
+    }
+  }
+  row_begin[K] = count;
+
+  b_shape = tensor_b.Shape();
+  return true;
+}
+
 Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ AllocatorPtr alloc,
                               /*out*/ bool& is_packed,
                               /*out*/ PrePackedWeights* prepacked_weights) {
@@ -171,7 +235,26 @@ Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ Alloc
   // only pack Matrix B
   if (input_idx == 1) {
     size_t packed_b_size;
-#if defined(__aarch64__) && defined(__linux__)
+
+    if (sparse_weight_threshold_ > 0.0f && trans_a_attr_ == 0 && trans_b_attr_ == 0 &&
+        !trans_batch_a_ && !trans_batch_b_ &&
+        TrySparsePackB(alloc, tensor, sparse_weight_threshold_, alpha_attr_,
+                       sparse_row_begin_, sparse_cols_, sparse_values_, sparse_nnz_, b_shape_)) {
+      use_sparse_b_ = true;
+      is_packed = true;
+      if (prepacked_weights != nullptr) {
+        const size_t K = static_cast<size_t>(b_shape_[0]);
+        prepacked_weights->buffers_.push_back(std::move(sparse_row_begin_));
+        prepacked_weights->buffer_sizes_.push_back((K + 1) * sizeof(int32_t));
+        prepacked_weights->buffers_.push_back(std::move(sparse_cols_));
+        prepacked_weights->buffer_sizes_.push_back(std::max<size_t>(sparse_nnz_, 1) * sizeof(int32_t));
+        prepacked_weights->buffers_.push_back(std::move(sparse_values_));
+        prepacked_weights->buffer_sizes_.push_back(std::max<size_t>(sparse_nnz_, 1) * sizeof(float));
+      }
+      return Status::OK();
+    }
+
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
     size_t dim1 = 0;
     size_t dim2 = 0;
     TensorShape b_shape = tensor.Shape();
@@ -205,13 +288,83 @@ Status MatMul<float>::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& pr
 
   if (input_idx == 1) {
     used_shared_buffers = true;
-    packed_b_ = std::move(prepacked_buffers[0]);
+    if (prepacked_buffers.size() == 3) {
+      // CSR pre-pack produced by TrySparsePackB; the metadata (shape, nnz) was already
+      // set by this kernel's own PrePack call.
+      sparse_row_begin_ = std::move(prepacked_buffers[0]);
+      sparse_cols_ = std::move(prepacked_buffers[1]);
+      sparse_values_ = std::move(prepacked_buffers[2]);
+    } else {
+      packed_b_ = std::move(prepacked_buffers[0]);
+    }
+  }
+
+  return Status::OK();
+}
+
+Status MatMul<float>::ComputeSparse(OpKernelContext* ctx) const {
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
+  const Tensor* a = ctx->Input<Tensor>(0);
+
+  // The sparse pre-pack is only performed when none of the transpose attributes are set.
+  MatMulComputeHelper helper;
+  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b_shape_));
+  Tensor* y = ctx->Output(0, helper.OutputShape());
+
+  // Bail out early if the output is going to be empty
+  if (y->Shape().Size() == 0)
+    return Status::OK();
+
+  const auto* a_data = a->Data<float>();
+  auto* y_data = y->MutableData<float>();
+
+  const size_t M = static_cast<size_t>(helper.M());
+  const size_t N = static_cast<size_t>(helper.N());
+  const size_t K = static_cast<size_t>(helper.K());
+
+  const auto* row_begin = static_cast<const int32_t*>(sparse_row_begin_.get());
+  const auto* cols = static_cast<const int32_t*>(sparse_cols_.get());
+  const auto* values = static_cast<const float*>(sparse_values_.get());
+
+  // Each output row performs one multiply-add per stored non-zero.
+  const double cost_per_row = 2.0 * static_cast<double>(sparse_nnz_);
+
+  const size_t max_len = helper.OutputOffsets().size();
+  for (size_t i = 0; i < max_len; i++) {
+    const float* a_base = a_data + helper.LeftOffsets()[i];
+    float* y_base = y_data + helper.OutputOffsets()[i];
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool, static_cast<std::ptrdiff_t>(M), cost_per_row,
+        [a_base, y_base, row_begin, cols, values, N, K](std::ptrdiff_t begin, std::ptrdiff_t end) {
+          for (std::ptrdiff_t m = begin; m < end; ++m) {
+            const float* a_row = a_base + static_cast<size_t>(m) * K;
+            float* y_row = y_base + static_cast<size_t>(m) * N;
+            std::fill_n(y_row, N, 0.0f);
+            for (size_t k = 0; k < K; ++k) {
+              const float a_value = a_row[k];
+              if (a_value == 0.0f) {
+                continue;
+              }
+              const int32_t* col = cols + row_begin[k];
+              const float* val = values + row_begin[k];
+              const int32_t count = row_begin[k + 1] - row_begin[k];
+              for (int32_t j = 0; j < count; ++j) {
+                y_row[col[j]] += a_value * val[j];
+              }
+            }
+          }
+        });
   }
 
   return Status::OK();
 }
 
 Status MatMul<float>::Compute(OpKernelContext* ctx) const {
+  if (use_sparse_b_) {
+    return ComputeSparse(ctx);
+  }
+
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
 
   const Tensor* a = ctx->Input<Tensor>(0);
@@ -240,7 +393,7 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   const size_t K = static_cast<size_t>(helper.K());
   const size_t lda = helper.Lda(trans_a);
   const size_t ldb = helper.Ldb(trans_b);
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
   if (use_fastmath_mode_ && !trans_b && ((N * K) >= kFastMathModeKernelsizeThreshold)) {
     std::vector<MLAS_SBGEMM_DATA_PARAMS> data(max_len);
     for (size_t i = 0; i < max_len; i++) {
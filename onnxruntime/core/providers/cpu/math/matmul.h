@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <cstdlib>
+
 #include "core/framework/op_kernel.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
@@ -30,10 +32,14 @@ class MatMul<float> final : public OpKernel {
     trans_batch_a_ = trans_batch_a_attr != 0;
     trans_batch_b_ = trans_batch_b_attr != 0;
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
     auto config_ops = info.GetConfigOptions().GetConfigEntry(kOrtSessionOptionsMlasGemmFastMathArm64Bfloat16);
     use_fastmath_mode_ = (config_ops == "1") && MlasBf16AccelerationSupported();
 #endif
+
+    const std::string sparse_threshold = info.GetConfigOptions().GetConfigOrDefault(
+        kOrtSessionOptionsMatMulSparseWeightThreshold, "0");
+    sparse_weight_threshold_ = std::strtof(sparse_threshold.c_str(), nullptr);
   }
 
   Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
@@ -46,9 +52,23 @@ class MatMul<float> final : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 
  private:
+  Status ComputeSparse(OpKernelContext* ctx) const;
+
   TensorShape b_shape_;
   IAllocatorUniquePtr<void> packed_b_;
 
+  // CSR form of a 2-D initializer B, built at pre-pack time when the fraction of zero
+  // elements meets kOrtSessionOptionsMatMulSparseWeightThreshold. alpha is folded into
+  // the stored values.
+  IAllocatorUniquePtr<void> sparse_row_begin_;  // int32_t, K + 1 entries
+  IAllocatorUniquePtr<void> sparse_cols_;       // int32_t, column index per non-zero
+  IAllocatorUniquePtr<void> sparse_values_;     // float, value per non-zero
+  size_t sparse_nnz_{0};
+  bool use_sparse_b_{false};
+
+  // From kOrtSessionOptionsMatMulSparseWeightThreshold; 0 disables the sparse path.
+  float sparse_weight_threshold_{0.0f};
+
   // For FusedMatMul contrib ops
   float alpha_attr_;
   int64_t trans_a_attr_;
@@ -56,7 +76,7 @@ class MatMul<float> final : public OpKernel {
   bool trans_batch_a_;
   bool trans_batch_b_;
 
-#if defined(__aarch64__) && defined(__linux__)
+#if (defined(__aarch64__) && defined(__linux__)) || defined(__x86_64__) || defined(_M_AMD64)
   // fastmath mode state
   bool use_fastmath_mode_;
   // sbgemm kernel is implemented as 8x8 blocks with weights pre-packed to 4 blocks of 4x2
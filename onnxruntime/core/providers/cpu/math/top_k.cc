@@ -173,6 +173,68 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   int64_t threads_needed = static_cast<int64_t>(std::floor(input_shape.Size() * k / (128 * 1024)));
   num_threads = std::max(std::min(threads_needed, num_threads), static_cast<int64_t>(1));
 
+  // when there are fewer rows than available threads (e.g. a single row with millions of scores),
+  // partitioning work by row leaves most of the pool idle. if the selection axis is the innermost
+  // one, select within each row instead: every thread heap-selects the top k of one contiguous
+  // chunk of the row, and the per-chunk candidates are merged with a final nth_element over
+  // num_chunks * k entries. this also avoids materializing a per-element index vector for the row.
+  if (block_slice == 1 && k > 1 && rows < tp_threads) {
+    const int64_t num_chunks = std::min({tp_threads, num_blocks / static_cast<int64_t>(k),
+                                         std::max<int64_t>(threads_needed, 1)});
+    if (num_chunks > 1) {
+      Comparator comparer(input_data);
+      std::vector<int64_t> candidates(onnxruntime::narrow<size_t>(num_chunks * k));
+
+      for (int64_t i = 0; i < rows; ++i) {
+        const auto row_offset = i * cols;
+
+        concurrency::ThreadPool::TrySimpleParallelFor(
+            threadpool, onnxruntime::narrow<ptrdiff_t>(num_chunks),
+            [num_chunks, num_blocks, row_offset, k, input_data, &comparer, &candidates](std::ptrdiff_t chunk) {
+              auto work = concurrency::ThreadPool::PartitionWork(chunk, onnxruntime::narrow<size_t>(num_chunks),
+                                                                 onnxruntime::narrow<size_t>(num_blocks));
+              // every chunk holds at least k entries as num_chunks <= num_blocks / k
+              int64_t* indices = candidates.data() + chunk * k;
+              auto cur_idx = row_offset + work.start;
+
+              // add first k items starting from the bottom up
+              for (unsigned l = 0; l < k; ++l) {
+                indices[k - l - 1] = cur_idx++;
+                HeapifyIthPosition(indices, k - SafeInt<size_t>(l) - 1, k, comparer);
+              }
+
+              // insert remainder if the next value would replace the top of the heap
+              // (current worst top k value). save top so we only have one load in the
+              // CompareValueOnly call
+              auto top = input_data[indices[0]];
+              for (auto b = work.start + k; b < work.end; ++b, ++cur_idx) {
+                if (comparer.CompareValueOnly(input_data[cur_idx], top)) {
+                  indices[0] = cur_idx;
+                  HeapifyIthPosition(indices, 0, k, comparer);
+                  top = input_data[indices[0]];
+                }
+              }
+            });
+
+        // merge the per-chunk candidates with one final selection. every candidate slot was
+        // rewritten above, so the buffer can be reused across rows without clearing.
+        std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), comparer);
+        if (sorted) {
+          std::sort(candidates.begin(), candidates.begin() + k, comparer);
+        }
+
+        for (unsigned l = 0; l < k; ++l) {
+          int64_t idx = candidates[l];
+          values_map(i, l) = input_data[idx];
+          // block_slice == 1, so the result index is simply the offset within the row
+          indices_map(i, l) = idx - row_offset;
+        }
+      }
+
+      return;
+    }
+  }
+
   // from testing various batch sizes relative to k, the following appears to work well as a selector.
   // tested with following combinations
   //   batch_size = [ 8, 16, 32, 64, 128, 256, 512, 1024, 2048 ]
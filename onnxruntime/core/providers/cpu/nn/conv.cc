@@ -19,11 +19,74 @@
 
 #include "core/common/narrow.h"
 #include "core/common/safeint.h"
+#include "core/framework/tensorprotoutils.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
 using ConvPadVector = ConvAttributes::ConvPadVector;
 
+namespace {
+bool TryGetStaticShape(const NodeArg* def, TensorShape& shape) {
+  if (def == nullptr || !def->Exists()) {
+    return false;
+  }
+  const auto* shape_proto = def->Shape();
+  if (shape_proto == nullptr) {
+    return false;
+  }
+  TensorShapeVector dims;
+  dims.reserve(shape_proto->dim_size());
+  for (const auto& dim : shape_proto->dim()) {
+    if (!utils::HasDimValue(dim) || dim.dim_value() < 0) {
+      return false;
+    }
+    dims.push_back(dim.dim_value());
+  }
+  shape = TensorShape(dims);
+  return true;
+}
+}  // namespace
+
+std::optional<StaticConvParams> TryMakeStaticConvParams(const OpKernelInfo& info,
+                                                        const ConvAttributes& conv_attrs) {
+  const auto& input_defs = info.node().InputDefs();
+  StaticConvParams params;
+  if (input_defs.size() < 2 ||
+      !TryGetStaticShape(input_defs[0], params.input_shape) ||
+      !TryGetStaticShape(input_defs[1], params.weight_shape) ||
+      params.input_shape.NumDimensions() < 3) {
+    return std::nullopt;
+  }
+
+  // Run the shape math once. Failures are ignored here so that Compute reports them
+  // against the real tensors.
+  if (!conv_attrs.ValidateInputShape(params.input_shape, params.weight_shape).IsOK() ||
+      !conv_attrs.ComputeKernelShape(params.weight_shape, params.kernel_shape).IsOK()) {
+    return std::nullopt;
+  }
+
+  params.pads = conv_attrs.pads;
+  if (params.pads.empty()) {
+    params.pads.resize(params.kernel_shape.size() * 2, 0);
+  }
+  params.dilations = conv_attrs.dilations;
+  if (params.dilations.empty()) {
+    params.dilations.resize(params.kernel_shape.size(), 1);
+  }
+  params.strides = conv_attrs.strides;
+  if (params.strides.empty()) {
+    params.strides.resize(params.kernel_shape.size(), 1);
+  }
+
+  params.output_dims = TensorShapeVector{params.input_shape[0], params.weight_shape[0]};
+  if (!conv_attrs.InferPadsAndOutputShape(params.input_shape.Slice(2), params.kernel_shape, params.strides,
+                                          params.dilations, params.pads, params.output_dims)
+           .IsOK()) {
+    return std::nullopt;
+  }
+  return params;
+}
+
 template <typename T>
 Status Conv<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
@@ -32,27 +95,42 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   const int64_t N = X->Shape()[0];
   const int64_t C = X->Shape()[1];
   const int64_t M = W->Shape()[0];
-  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+  const StaticConvParams* static_params =
+      static_conv_params_.has_value() && static_conv_params_->Matches(X->Shape(), W->Shape())
+          ? &*static_conv_params_
+          : nullptr;
 
   TensorShapeVector kernel_shape;
-  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
-
-  ConvPadVector pads(conv_attrs_.pads);
-  if (pads.empty()) {
-    pads.resize(kernel_shape.size() * 2, 0);
-  }
-  TensorShapeVector dilations(conv_attrs_.dilations);
-  if (dilations.empty()) {
-    dilations.resize(kernel_shape.size(), 1);
-  }
-  TensorShapeVector strides(conv_attrs_.strides);
-  if (strides.empty()) {
-    strides.resize(kernel_shape.size(), 1);
-  }
-
+  ConvPadVector pads;
+  TensorShapeVector dilations;
+  TensorShapeVector strides;
   TensorShapeVector Y_dims({N, M});
+  if (static_params != nullptr) {
+    // Shapes were resolved at kernel construction time; reuse the precomputed parameters.
+    kernel_shape = static_params->kernel_shape;
+    pads = static_params->pads;
+    dilations = static_params->dilations;
+    strides = static_params->strides;
+    Y_dims = static_params->output_dims;
+  } else {
+    ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+    ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+    pads = conv_attrs_.pads;
+    if (pads.empty()) {
+      pads.resize(kernel_shape.size() * 2, 0);
+    }
+    dilations = conv_attrs_.dilations;
+    if (dilations.empty()) {
+      dilations.resize(kernel_shape.size(), 1);
+    }
+    strides = conv_attrs_.strides;
+    if (strides.empty()) {
+      strides.resize(kernel_shape.size(), 1);
+    }
+    ORT_RETURN_IF_ERROR(
+        conv_attrs_.InferPadsAndOutputShape(X->Shape().Slice(2), kernel_shape, strides, dilations, pads, Y_dims));
+  }
   TensorShape input_shape = X->Shape().Slice(2);
-  ORT_RETURN_IF_ERROR(conv_attrs_.InferPadsAndOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
   Tensor* Y = context->Output(0, Y_dims);
   TensorShape output_shape = Y->Shape().Slice(2);
 
@@ -73,19 +151,23 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   const size_t kernel_rank = kernel_shape.size();
 
   BufferUniquePtr col_buffer;
+  T* col_buffer_data = nullptr;
 
   // Pointwise convolutions can use the original input tensor in place,
   // otherwise a temporary buffer is required for the im2col transform.
   if (kernel_size != 1 || !conv_attrs_.HasStridesOneAndNoPadding()) {
-    AllocatorPtr alloc;
-    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-
-    auto* col_data = alloc->Alloc(sizeof(T) * SafeInt<size_t>(col_buffer_size));
-    col_buffer = BufferUniquePtr(col_data, BufferDeleter(std::move(alloc)));
+    const size_t col_buffer_bytes = sizeof(T) * SafeInt<size_t>(col_buffer_size);
+    col_buffer_data = static_cast<T*>(context->TryGetScratchBuffer(col_buffer_bytes));
+    if (col_buffer_data == nullptr) {
+      AllocatorPtr alloc;
+      ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+      auto* col_data = alloc->Alloc(col_buffer_bytes);
+      col_buffer = BufferUniquePtr(col_data, BufferDeleter(std::move(alloc)));
+      col_buffer_data = static_cast<T*>(col_buffer.get());
+    }
   }
 
-  T* col_buffer_data = static_cast<T*>(col_buffer.get());
-
   concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
 
   const T* Xdata = X->Data<T>();
@@ -162,28 +244,43 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
   const int64_t N = X->Shape()[0];
   const int64_t C = X->Shape()[1];
   const int64_t M = W->Shape()[0];
-  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+  const StaticConvParams* static_params =
+      static_conv_params_.has_value() && static_conv_params_->Matches(X->Shape(), W->Shape())
+          ? &*static_conv_params_
+          : nullptr;
 
   // kernel_shape is an optional attribute and has to be inferred from W if not provided
   TensorShapeVector kernel_shape;
-  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
-
-  ConvPadVector pads(conv_attrs_.pads);
-  if (pads.empty()) {
-    pads.resize(kernel_shape.size() * 2, 0);
-  }
-  TensorShapeVector dilations(conv_attrs_.dilations);
-  if (dilations.empty()) {
-    dilations.resize(kernel_shape.size(), 1);
-  }
-  TensorShapeVector strides(conv_attrs_.strides);
-  if (strides.empty()) {
-    strides.resize(kernel_shape.size(), 1);
-  }
-
+  ConvPadVector pads;
+  TensorShapeVector dilations;
+  TensorShapeVector strides;
   TensorShapeVector Y_dims({N, M});
+  if (static_params != nullptr) {
+    // Shapes were resolved at kernel construction time; reuse the precomputed parameters.
+    kernel_shape = static_params->kernel_shape;
+    pads = static_params->pads;
+    dilations = static_params->dilations;
+    strides = static_params->strides;
+    Y_dims = static_params->output_dims;
+  } else {
+    ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X, W));
+    ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W->Shape(), kernel_shape));
+    pads = conv_attrs_.pads;
+    if (pads.empty()) {
+      pads.resize(kernel_shape.size() * 2, 0);
+    }
+    dilations = conv_attrs_.dilations;
+    if (dilations.empty()) {
+      dilations.resize(kernel_shape.size(), 1);
+    }
+    strides = conv_attrs_.strides;
+    if (strides.empty()) {
+      strides.resize(kernel_shape.size(), 1);
+    }
+    ORT_RETURN_IF_ERROR(
+        conv_attrs_.InferPadsAndOutputShape(X->Shape().Slice(2), kernel_shape, strides, dilations, pads, Y_dims));
+  }
   TensorShape input_shape = X->Shape().Slice(2);
-  ORT_RETURN_IF_ERROR(conv_attrs_.InferPadsAndOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
   Tensor* Y = context->Output(0, TensorShape(Y_dims));
   TensorShape output_shape = Y->Shape().Slice(2);
 
@@ -233,15 +330,26 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
                     Beta,
                     thread_pool);
 
-    auto* working_data = WorkingBufferSize > 0 ? alloc->Alloc(sizeof(float) * SafeInt<size_t>(WorkingBufferSize))
-                                               : nullptr;
-    BufferUniquePtr working_buffer(working_data, BufferDeleter(std::move(alloc)));
+    if (use_winograd_conv_) {
+      MlasConvTryUseWinograd(&Parameters, &WorkingBufferSize);
+    }
+
+    BufferUniquePtr working_buffer;
+    float* working_data = nullptr;
+    if (WorkingBufferSize > 0) {
+      const size_t working_buffer_bytes = sizeof(float) * SafeInt<size_t>(WorkingBufferSize);
+      working_data = static_cast<float*>(context->TryGetScratchBuffer(working_buffer_bytes));
+      if (working_data == nullptr) {
+        working_buffer = BufferUniquePtr(alloc->Alloc(working_buffer_bytes), BufferDeleter(std::move(alloc)));
+        working_data = static_cast<float*>(working_buffer.get());
+      }
+    }
 
     MlasConv(&Parameters,
              Xdata.data(),
              W->Data<float>(),
              Bdata,
-             static_cast<float*>(working_buffer.get()),
+             working_data,
              Ydata.data(),
              thread_pool);
   } else {
@@ -254,7 +362,13 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
     const SafeInt<int64_t> kernel_dim = SafeInt<int64_t>(C) / conv_attrs_.group * kernel_size;
     const int64_t col_buffer_size = kernel_dim * output_image_size;
 
-    auto col_data = IAllocator::MakeUniquePtr<float>(alloc, narrow<size_t>(col_buffer_size));
+    IAllocatorUniquePtr<float> col_buffer;
+    auto* col_buffer_data =
+        static_cast<float*>(context->TryGetScratchBuffer(sizeof(float) * narrow<size_t>(col_buffer_size)));
+    if (col_buffer_data == nullptr) {
+      col_buffer = IAllocator::MakeUniquePtr<float>(alloc, narrow<size_t>(col_buffer_size));
+      col_buffer_data = col_buffer.get();
+    }
     auto w_data = W->DataAsSpan<float>();
     for (int image_id = 0; image_id < N; ++image_id) {
       for (int group_id = 0; group_id < conv_attrs_.group; ++group_id) {
@@ -268,7 +382,7 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
             dilations.data(),
             pads.data(),
             narrow<int>(kernel_shape.size()),
-            col_data.get());
+            col_buffer_data);
 
         math::Gemm<float>(
             CblasNoTrans,
@@ -278,7 +392,7 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
             narrow<ptrdiff_t>(kernel_dim),
             1,
             &w_data[group_id * W_offset],
-            col_data.get(),
+            col_buffer_data,
             Beta,
             &Ydata[group_id * Y_offset],
             thread_pool);
@@ -3,22 +3,50 @@
 
 #pragma once
 
+#include <optional>
+
 #include "core/framework/op_kernel.h"
 #include "core/providers/cpu/nn/conv_attributes.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 
 namespace onnxruntime {
 
+// Shape-dependent parameters of a Conv invocation. When every dimension of X and W
+// is static in the graph (for example after free-dimension overrides resolve the
+// dynamic dims at session creation), they are computed once at kernel construction
+// time, and Compute only has to check that the runtime shapes still match.
+struct StaticConvParams {
+  TensorShape input_shape;   // full shape of X
+  TensorShape weight_shape;  // full shape of W
+  TensorShapeVector kernel_shape;
+  ConvAttributes::ConvPadVector pads;
+  TensorShapeVector dilations;
+  TensorShapeVector strides;
+  TensorShapeVector output_dims;  // full shape of Y
+
+  bool Matches(const TensorShape& x_shape, const TensorShape& w_shape) const {
+    return x_shape == input_shape && w_shape == weight_shape;
+  }
+};
+
+// Returns the precomputed shape-dependent parameters if the shapes of X and W are
+// fully static in the graph, std::nullopt otherwise.
+std::optional<StaticConvParams> TryMakeStaticConvParams(const OpKernelInfo& info,
+                                                        const ConvAttributes& conv_attrs);
+
 template <typename T>
 class Conv : public OpKernel {
  public:
   Conv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
+    static_conv_params_ = TryMakeStaticConvParams(info, conv_attrs_);
   }
 
   Status Compute(OpKernelContext* context) const override;
 
  private:
   ConvAttributes conv_attrs_;
+  std::optional<StaticConvParams> static_conv_params_;
 };
 
 template <>
@@ -26,6 +54,9 @@ class Conv<float> : public OpKernel {
  public:
   Conv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
     activation_.ActivationKind = MlasIdentityActivation;
+    use_winograd_conv_ = info.GetConfigOptions().GetConfigOrDefault(
+                             kOrtSessionOptionsEnableWinogradConvolution, "0") == "1";
+    static_conv_params_ = TryMakeStaticConvParams(info, conv_attrs_);
   }
 
   Status Compute(OpKernelContext* context) const override;
@@ -34,6 +65,11 @@ class Conv<float> : public OpKernel {
   MLAS_ACTIVATION activation_;
 
   ConvAttributes conv_attrs_;
+  std::optional<StaticConvParams> static_conv_params_;
+
+  // From kOrtSessionOptionsEnableWinogradConvolution; opt-in because the Winograd
+  // result is not bit-identical to the GEMM-based algorithms.
+  bool use_winograd_conv_{false};
 };
 
 }  // namespace onnxruntime
@@ -17,6 +17,7 @@ limitations under the License.
 #include <utility>
 
 #include "core/common/narrow.h"
+#include "core/platform/threadpool.h"
 #include "non_max_suppression_helper.h"
 
 // TODO:fix the warnings
@@ -118,6 +119,48 @@ Status NonMaxSuppressionBase::GetThresholdsFromInputs(const PrepareContext& pc,
   return Status::OK();
 }
 
+namespace {
+// Boxes of one batch, canonicalized once into structure-of-arrays form so that
+// the suppression loop works on contiguous floats instead of re-deriving the
+// corners and area of every selected box for every candidate. The values match
+// what SuppressByIOU computes per pair, including degenerate boxes whose area
+// can be zero (center_point_box == 0) or negative (center_point_box == 1).
+struct CanonicalBoxes {
+  std::vector<float> x_min;
+  std::vector<float> y_min;
+  std::vector<float> x_max;
+  std::vector<float> y_max;
+  std::vector<float> area;
+};
+
+void CanonicalizeBoxes(const float* boxes_data, int64_t num_boxes, int64_t center_point_box,
+                       CanonicalBoxes& cb) {
+  cb.x_min.resize(num_boxes);
+  cb.y_min.resize(num_boxes);
+  cb.x_max.resize(num_boxes);
+  cb.y_max.resize(num_boxes);
+  cb.area.resize(num_boxes);
+
+  for (int64_t i = 0; i < num_boxes; ++i) {
+    const float* box = boxes_data + 4 * i;
+    if (0 == center_point_box) {
+      // boxes data format [y1, x1, y2, x2]
+      nms_helpers::MaxMin(box[1], box[3], cb.x_min[i], cb.x_max[i]);
+      nms_helpers::MaxMin(box[0], box[2], cb.y_min[i], cb.y_max[i]);
+    } else {
+      // 1 == center_point_box => boxes data format [x_center, y_center, width, height]
+      const float width_half = box[2] / 2;
+      const float height_half = box[3] / 2;
+      cb.x_min[i] = box[0] - width_half;
+      cb.x_max[i] = box[0] + width_half;
+      cb.y_min[i] = box[1] - height_half;
+      cb.y_max[i] = box[1] + height_half;
+    }
+    cb.area[i] = (cb.x_max[i] - cb.x_min[i]) * (cb.y_max[i] - cb.y_min[i]);
+  }
+}
+}  // namespace
+
 Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   PrepareContext pc;
   ORT_RETURN_IF_ERROR(PrepareCompute(ctx, pc));
@@ -149,57 +192,123 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
 
   const auto center_point_box = GetCenterPointBox();
 
-  std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfoPtr> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
+  // Canonicalize each batch of boxes once; the result is shared by all classes
+  // of that batch.
+  std::vector<CanonicalBoxes> canonical_boxes(static_cast<size_t>(pc.num_batches_));
   for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfoPtr> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
+    CanonicalizeBoxes(boxes_data + (batch_index * pc.num_boxes_ * 4), pc.num_boxes_,
+                      center_point_box, canonical_boxes[static_cast<size_t>(batch_index)]);
+  }
+
+  // Suppression within one (batch, class) pair is independent of every other
+  // pair, so distribute the pairs over the intra-op pool. Each job writes its
+  // own selection list and the lists are concatenated in job order afterwards,
+  // which keeps the output identical to the serial nested loops.
+  const std::ptrdiff_t num_jobs = narrow<std::ptrdiff_t>(pc.num_batches_ * pc.num_classes_);
+  std::vector<std::vector<SelectedIndex>> job_selections(static_cast<size_t>(num_jobs));
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      ctx->GetOperatorThreadPool(), num_jobs, [&](std::ptrdiff_t job) {
+        const int64_t batch_index = job / pc.num_classes_;
+        const int64_t class_index = job % pc.num_classes_;
+        const CanonicalBoxes& cb = canonical_boxes[static_cast<size_t>(batch_index)];
+
+        std::vector<BoxInfoPtr> candidate_boxes;
+        candidate_boxes.reserve(pc.num_boxes_);
+
+        // Filter by score_threshold_
+        const auto* class_scores = scores_data + job * pc.num_boxes_;
+        if (pc.score_threshold_ != nullptr) {
+          for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+            if (*class_scores > score_threshold) {
+              candidate_boxes.emplace_back(*class_scores, box_index);
+            }
+          }
+        } else {
+          for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
             candidate_boxes.emplace_back(*class_scores, box_index);
           }
         }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          candidate_boxes.emplace_back(*class_scores, box_index);
-        }
-      }
-      std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfoPtr& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
+        std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
+
+        // Corners and areas of the boxes selected so far, kept as flat arrays
+        // so the scan below stays vector-friendly.
+        std::vector<float> sel_x_min;
+        std::vector<float> sel_y_min;
+        std::vector<float> sel_x_max;
+        std::vector<float> sel_y_max;
+        std::vector<float> sel_area;
+        const size_t max_selected = std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_);
+        sel_x_min.reserve(max_selected);
+        sel_y_min.reserve(max_selected);
+        sel_x_max.reserve(max_selected);
+        sel_y_max.reserve(max_selected);
+        sel_area.reserve(max_selected);
+
+        auto& selections = job_selections[static_cast<size_t>(job)];
+
+        // Get the next box with top score, filter by iou_threshold
+        while (!sorted_boxes.empty() && static_cast<int64_t>(selections.size()) < max_output_boxes_per_class) {
+          const BoxInfoPtr& next_top_score = sorted_boxes.top();
+          const size_t c = static_cast<size_t>(next_top_score.index_);
+
+          const float c_x_min = cb.x_min[c];
+          const float c_y_min = cb.y_min[c];
+          const float c_x_max = cb.x_max[c];
+          const float c_y_max = cb.y_max[c];
+          const float c_area = cb.area[c];
+
+          bool selected = true;
+          // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold.
+          // A candidate with non-positive area can never be suppressed.
+          if (c_area > .0f) {
+            for (size_t j = 0; j < sel_area.size(); ++j) {
+              const float intersection_x_min = HelperMax(c_x_min, sel_x_min[j]);
+              const float intersection_x_max = HelperMin(c_x_max, sel_x_max[j]);
+              if (intersection_x_max <= intersection_x_min) continue;
+
+              const float intersection_y_min = HelperMax(c_y_min, sel_y_min[j]);
+              const float intersection_y_max = HelperMin(c_y_max, sel_y_max[j]);
+              if (intersection_y_max <= intersection_y_min) continue;
+
+              const float intersection_area = (intersection_x_max - intersection_x_min) *
+                                              (intersection_y_max - intersection_y_min);
+              if (intersection_area <= .0f) continue;
+
+              const float union_area = c_area + sel_area[j] - intersection_area;
+              if (sel_area[j] <= .0f || union_area <= .0f) continue;
+
+              if (intersection_area / union_area > iou_threshold) {
+                selected = false;
+                break;
+              }
+            }
           }
-        }
 
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
-        }
-        sorted_boxes.pop();
-      }  // while
-    }    // for class_index
-  }      // for batch_index
+          if (selected) {
+            sel_x_min.push_back(c_x_min);
+            sel_y_min.push_back(c_y_min);
+            sel_x_max.push_back(c_x_max);
+            sel_y_max.push_back(c_y_max);
+            sel_area.push_back(c_area);
+            selections.emplace_back(batch_index, class_index, next_top_score.index_);
+          }
+          sorted_boxes.pop();
+        }  // while
+      });
+
+  size_t num_selected = 0;
+  for (const auto& selections : job_selections) {
+    num_selected += selections.size();
+  }
+
+  std::vector<SelectedIndex> selected_indices;
+  selected_indices.reserve(num_selected);
+  for (const auto& selections : job_selections) {
+    selected_indices.insert(selected_indices.end(), selections.begin(), selections.end());
+  }
 
   constexpr auto last_dim = 3;
-  const auto num_selected = selected_indices.size();
   Tensor* output = ctx->Output(0, {static_cast<int64_t>(num_selected), last_dim});
   ORT_ENFORCE(output != nullptr);
   static_assert(last_dim * sizeof(int64_t) == sizeof(SelectedIndex), "Possible modification of SelectedIndex");
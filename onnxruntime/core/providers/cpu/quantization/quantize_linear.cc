@@ -247,7 +247,7 @@ ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
 template <typename T, typename OutT>
 struct DequantizeLinearApply {
   void op(int64_t N, int64_t axis_dim_val, int64_t quant_block_size, const T* input, const OutT* scale, OutT* output,
-          const T* zero_point) {
+          const T* zero_point, concurrency::ThreadPool*) {
     for (size_t n = 0; n < static_cast<size_t>(N); n++) {
       for (size_t bd = 0; bd < static_cast<size_t>(axis_dim_val); bd++) {
         auto zp = zero_point ? static_cast<int32_t>(zero_point[bd]) : 0;
@@ -260,11 +260,47 @@ struct DequantizeLinearApply {
   }
 };
 
+// Dequantizes 8-bit integer tensors to float using the SIMD kernel in MLAS. A large quant block is
+// chunked across the thread pool inside ParDequantizeLinearStd; when the blocks are small (e.g.
+// per-channel on one of the innermost axes) the loop over the blocks is parallelized instead so the
+// work still spreads across threads.
+#define DEQUANTIZE_LINEAR_APPLY_INT8(T)                                                                      \
+  template <>                                                                                                \
+  struct DequantizeLinearApply<T, float> {                                                                   \
+    void op(int64_t N, int64_t axis_dim_val, int64_t quant_block_size, const T* input, const float* scale,   \
+            float* output, const T* zero_point, concurrency::ThreadPool* thread_pool) {                      \
+      constexpr int64_t small_quant_block_size = 128;                                                        \
+      const int64_t total_blocks = N * axis_dim_val;                                                         \
+      if (quant_block_size >= small_quant_block_size || total_blocks == 1) {                                 \
+        for (int64_t b = 0; b < total_blocks; b++) {                                                         \
+          const int64_t bd = b % axis_dim_val;                                                               \
+          ParDequantizeLinearStd(input, output, static_cast<size_t>(quant_block_size), scale[bd],            \
+                                 zero_point != nullptr ? zero_point[bd] : static_cast<T>(0), thread_pool);   \
+          input += quant_block_size;                                                                         \
+          output += quant_block_size;                                                                        \
+        }                                                                                                    \
+      } else {                                                                                               \
+        concurrency::ThreadPool::TryBatchParallelFor(                                                        \
+            thread_pool, static_cast<std::ptrdiff_t>(total_blocks),                                          \
+            [=](std::ptrdiff_t b) {                                                                          \
+              const int64_t bd = b % axis_dim_val;                                                           \
+              MlasDequantizeLinear(input + b * quant_block_size, output + b * quant_block_size,              \
+                                   static_cast<size_t>(quant_block_size), scale[bd],                         \
+                                   zero_point != nullptr ? zero_point[bd] : static_cast<T>(0));              \
+            },                                                                                               \
+            0);                                                                                              \
+      }                                                                                                      \
+    }                                                                                                        \
+  };
+
+DEQUANTIZE_LINEAR_APPLY_INT8(int8_t);
+DEQUANTIZE_LINEAR_APPLY_INT8(uint8_t);
+
 #define DEQUANTIZE_LINEAR_APPLY_INT4(T)                                                                   \
   template <typename OutT>                                                                                \
   struct DequantizeLinearApply<T, OutT> {                                                                 \
     void op(int64_t N, int64_t axis_dim_val, int64_t quant_block_size, const T* input, const OutT* scale, \
-            OutT* output, const T* zero_point) {                                                          \
+            OutT* output, const T* zero_point, concurrency::ThreadPool*) {                                \
       size_t input_index = 0;                                                                             \
       for (size_t n = 0; n < static_cast<size_t>(N); n++) {                                               \
         for (size_t bd = 0; bd < static_cast<size_t>(axis_dim_val); bd++) {                               \
@@ -294,7 +330,7 @@ DEQUANTIZE_LINEAR_APPLY_INT4(UInt4x2);
   template <typename OutT>                                                                                \
   struct DequantizeLinearApply<T, OutT> {                                                                 \
     void op(int64_t N, int64_t axis_dim_val, int64_t quant_block_size, const T* input, const OutT* scale, \
-            OutT* output, const T*) {                                                                     \
+            OutT* output, const T*, concurrency::ThreadPool*) {                                           \
       for (size_t n = 0; n < static_cast<size_t>(N); n++) {                                               \
         for (size_t bd = 0; bd < static_cast<size_t>(axis_dim_val); bd++) {                               \
           auto sc = scale[bd];                                                                            \
@@ -349,11 +385,13 @@ Status DequantizeLinear<T>::Compute(OpKernelContext* ctx) const {
   if (to == ONNX_NAMESPACE::TensorProto::FLOAT) {
     const float* scale = x_scale.Data<float>();
     float* output = y.MutableData<float>();
-    DequantizeLinearApply<T, float>().op(N, axis_dim_val, quant_block_size, input, scale, output, zero_point);
+    DequantizeLinearApply<T, float>().op(N, axis_dim_val, quant_block_size, input, scale, output, zero_point,
+                                         ctx->GetOperatorThreadPool());
   } else if (to == ONNX_NAMESPACE::TensorProto::FLOAT16) {
     const MLFloat16* scale = x_scale.Data<MLFloat16>();
     MLFloat16* output = y.MutableData<MLFloat16>();
-    DequantizeLinearApply<T, MLFloat16>().op(N, axis_dim_val, quant_block_size, input, scale, output, zero_point);
+    DequantizeLinearApply<T, MLFloat16>().op(N, axis_dim_val, quant_block_size, input, scale, output, zero_point,
+                                             ctx->GetOperatorThreadPool());
   } else if (to == ONNX_NAMESPACE::TensorProto::BFLOAT16) {
     ORT_THROW("DequantizeLinear into BFLOAT16 is not implemented yet.");
   } else {
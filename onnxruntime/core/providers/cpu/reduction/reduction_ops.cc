@@ -462,7 +462,8 @@ struct ParallelizedData {
 template <typename AGG>
 void NoTransposeReduce1Loop(Tensor* output, const TensorShape& new_input_shape, const Tensor& input,
                             gsl::span<const int64_t> reduced_axes, concurrency::ThreadPool* tp,
-                            ResultsNoTransposePrepareForReduce& last_results) {
+                            ResultsNoTransposePrepareForReduce& last_results,
+                            bool use_deterministic_compute) {
   auto output_shape = output->Shape();
   const typename AGG::input_type* from_data = input.Data<typename AGG::input_type>();
   typename AGG::value_type* to_data = output->MutableData<typename AGG::value_type>();
@@ -471,7 +472,11 @@ void NoTransposeReduce1Loop(Tensor* output, const TensorShape& new_input_shape,
   if (reduced_axes.size() == 0 || reduced_axes.size() == new_input_shape.NumDimensions()) {
     ValidateNoTransposeReduce(count);
     int64_t input_size = new_input_shape.Size();
-    to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
+    if constexpr (AGG::HasParallelAggAll()) {
+      to_data[0] = AGG::ParallelAggAll(from_data, input_size, tp, use_deterministic_compute);
+    } else {
+      to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
+    }
     return;
   }
 
@@ -921,7 +926,8 @@ void CommonReduce1Loop(OpKernelContext* ctx,
   }
 
   ResultsNoTransposePrepareForReduce last_results;
-  NoTransposeReduce1Loop<AGG>(output, fast_shape, *input, fast_axes, ctx->GetOperatorThreadPool(), last_results);
+  NoTransposeReduce1Loop<AGG>(output, fast_shape, *input, fast_axes, ctx->GetOperatorThreadPool(), last_results,
+                              ctx->GetUseDeterministicCompute());
 }
 
 template <typename AGG>
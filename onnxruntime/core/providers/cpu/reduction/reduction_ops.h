@@ -12,6 +12,7 @@
 #include "core/util/math.h"
 #endif
 #include "core/framework/math.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/util/math_cpuonly.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/cpu/reduction/reduction_kernel_base.h"
@@ -155,6 +156,10 @@ class ReduceAggregatorBase {
  public:
   // Fast reduction: see OptimizeShapeForFastReduce's comment.
   static inline FastReduceKind WhichFastReduce() { return FastReduceKind::kNone; }
+  // Parallel whole-tensor reduction (all axes reduced, scalar output).
+  // Aggregators whose partial results can be merged override this to return
+  // true and define ParallelAggAll, see CommonParallelAggAll.
+  static constexpr bool HasParallelAggAll() { return false; }
   static void FastReduceKR(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceRK(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
   static void FastReduceKRK(const Tensor&, const gsl::span<const int64_t>&, Tensor&, concurrency::ThreadPool*);
@@ -206,6 +211,45 @@ class ReduceAggregator : public ReduceAggregatorBase {
           }
         });
   }
+
+  static TVAL CommonParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                                   bool use_deterministic_compute,
+                                   std::function<TVAL(const T*, int64_t)> f_chunk,
+                                   std::function<TVAL(const TVAL&, const TVAL&)> f_merge) {
+    // Each chunk is reduced independently on the thread pool. Partials land in
+    // cache-line padded slots so concurrent writers do not share a line, and
+    // are merged pairwise so the rounding error of the combine step grows with
+    // the depth of the merge tree rather than the number of chunks.
+    // In deterministic mode the chunk count is capped by a constant instead of the pool's
+    // degree of parallelism, so the split - and therefore the floating point result - is
+    // bitwise identical whatever the intra-op thread count is.
+    constexpr int64_t kMinChunkSize = 16384;
+    constexpr int64_t kDeterministicMaxChunks = 32;
+    const int64_t max_chunks = use_deterministic_compute ? kDeterministicMaxChunks
+                                                         : concurrency::ThreadPool::DegreeOfParallelism(tp);
+    int64_t n_chunks = std::min<int64_t>(max_chunks, (count + kMinChunkSize - 1) / kMinChunkSize);
+    if (n_chunks <= 1) {
+      return f_chunk(data, count);
+    }
+    const int64_t kSlotStride = std::max<int64_t>(1, 64 / static_cast<int64_t>(sizeof(TVAL)));
+    std::vector<TVAL> partials(onnxruntime::narrow<size_t>(n_chunks * kSlotStride));
+    int64_t chunk_size = count / n_chunks;
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, onnxruntime::narrow<std::ptrdiff_t>(n_chunks),
+        [data, count, chunk_size, n_chunks, kSlotStride, &partials, &f_chunk](std::ptrdiff_t i) {
+          int64_t begin = i * chunk_size;
+          int64_t size = (i == n_chunks - 1) ? count - begin : chunk_size;
+          partials[onnxruntime::narrow<size_t>(i * kSlotStride)] = f_chunk(data + begin, size);
+        });
+    for (int64_t stride = 1; stride < n_chunks; stride *= 2) {
+      for (int64_t i = 0; i + stride < n_chunks; i += 2 * stride) {
+        partials[onnxruntime::narrow<size_t>(i * kSlotStride)] =
+            f_merge(partials[onnxruntime::narrow<size_t>(i * kSlotStride)],
+                    partials[onnxruntime::narrow<size_t>((i + stride) * kSlotStride)]);
+      }
+    }
+    return partials[0];
+  }
 };
 
 template <typename T>
@@ -224,6 +268,16 @@ class ReduceAggregatorSum : public ReduceAggregator<T, T> {
     EigenMap<T>(output).array() = static_cast<T>(0);
   }
 
+  // Parallel whole-tensor reduction
+  static constexpr bool HasParallelAggAll() { return true; }
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return ReduceAggregator<T, T>::CommonParallelAggAll(
+        data, count, tp, use_deterministic_compute,
+        [](const T* p, int64_t size) -> T { return aggall(p, size); },
+        [](const T& a, const T& b) -> T { return a + b; });
+  }
+
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
     return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
@@ -293,13 +347,97 @@ template <typename T, typename TVAL = T>
 class ReduceAggregatorSumSquare : public ReduceAggregator<T, TVAL> {
  public:
   inline ReduceAggregatorSumSquare(int64_t N, const T&) : ReduceAggregator<T, TVAL>(N, 0) {}
+  static T aggall(const T* from_data, int64_t size) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(size)).squaredNorm();
+  }
   inline TVAL aggall(const T* from_data) {
-    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(this->N_)).squaredNorm();
+    return aggall(from_data, this->N_);
   }
   inline void update(const T& v) { this->accumulator_ += v * v; }
   static void fill_for_empty_set(Tensor& output) {
     EigenMap<T>(output).array() = static_cast<T>(0);
   }
+
+  // Parallel whole-tensor reduction
+  static constexpr bool HasParallelAggAll() { return true; }
+  static TVAL ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                             bool use_deterministic_compute) {
+    return ReduceAggregator<T, TVAL>::CommonParallelAggAll(
+        data, count, tp, use_deterministic_compute,
+        [](const T* p, int64_t size) -> TVAL { return aggall(p, size); },
+        [](const TVAL& a, const TVAL& b) -> TVAL { return a + b; });
+  }
+
+  // Fast reduction
+  static inline FastReduceKind WhichFastReduce() {
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+  }
+
+  static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    const T* data = input.Data<T>();
+    T* out = output.MutableData<T>();
+    int64_t stridei = fast_shape[1];
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<std::ptrdiff_t>(fast_shape[0]), ParallelReduceFastCost(1, stridei, sizeof(T), 6),
+        [data, stridei, out](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t d = first; d < last; ++d) {
+            out[d] = aggall(data + d * stridei, stridei);
+          }
+        });
+  }
+
+  static void FastReduceRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    int64_t N = fast_shape[1];
+    const T* data = input.Data<T>();
+    T* out = output.MutableData<T>();
+
+    int64_t n_rows = fast_shape[0];
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<std::ptrdiff_t>(N), ParallelReduceFastCost(1, n_rows, sizeof(T), 6),
+        [data, out, N, n_rows](ptrdiff_t begin, ptrdiff_t end) {
+          EigenVectorArrayMap<T>(out + begin, end - begin) =
+              ConstEigenVectorArrayMap<T>(data + begin, end - begin).square();
+          for (int64_t row = 1; row < n_rows; ++row) {
+            EigenVectorArrayMap<T>(out + begin, end - begin) += ConstEigenVectorArrayMap<T>(
+                                                                    data + row * N + begin, end - begin)
+                                                                    .square();
+          }
+        });
+  }
+
+  static void FastReduceKRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    int64_t N = fast_shape[2];
+    int64_t n_rows = fast_shape[1];
+    const T* data = input.Data<T>();
+    int64_t stridei = fast_shape[1] * fast_shape[2];
+    int64_t strideo = fast_shape[2];
+    T* out = output.MutableData<T>();
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<ptrdiff_t>(fast_shape[0]), ParallelReduceFastCost(fast_shape[1], fast_shape[2], sizeof(T), 6),
+        [data, stridei, strideo, out, N, n_rows](ptrdiff_t begin, ptrdiff_t last) {
+          for (ptrdiff_t d = begin; d < last; ++d) {
+            const T* p = data + d * stridei;
+            EigenVectorArrayMap<T> block(out + d * strideo, onnxruntime::narrow<size_t>(N));
+            block = ConstEigenVectorArrayMap<T>(p, onnxruntime::narrow<size_t>(N)).square();
+            for (int64_t row = 1; row < n_rows; ++row) {
+              block += ConstEigenVectorArrayMap<T>(p + row * N, onnxruntime::narrow<size_t>(N)).square();
+            }
+          }
+        });
+  }
+
+  static void FastReduceRKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregator<T, TVAL>::CommonFastReduceRKR(
+        input, fast_shape, output, tp,
+        [=](const T*) -> TVAL { return 0; },
+        [=](TVAL& value, const T* p, int64_t size) {
+          value += aggall(p, size);
+        });
+  }
 };
 
 template <typename T>
@@ -314,6 +452,13 @@ class ReduceAggregatorMean : public ReduceAggregatorSum<T> {
   }
   inline T get_value() { return this->accumulator_ / static_cast<T>(this->N_); }
 
+  // Parallel whole-tensor reduction: sum of chunk sums, divided once at the end.
+  // HasParallelAggAll() already defined in ReduceAggregatorSum
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return ReduceAggregatorSum<T>::ParallelAggAll(data, count, tp, use_deterministic_compute) / static_cast<T>(count);
+  }
+
   // Fast reduction
   // WhichFastReduce() already defined in ReduceAggregatorSum
 
@@ -384,6 +529,22 @@ class ReduceAggregatorMax : public ReduceAggregator<T> {
   }
   inline void update(const T& v) { this->accumulator_ = v > this->accumulator_ ? v : this->accumulator_; }
 
+  // Parallel whole-tensor reduction
+  static constexpr bool HasParallelAggAll() { return true; }
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return ReduceAggregator<T, T>::CommonParallelAggAll(
+        data, count, tp, use_deterministic_compute,
+        [](const T* p, int64_t size) -> T { return aggall(p, size); },
+        [](const T& a, const T& b) -> T {
+          if constexpr (std::is_same_v<bool, T>) { /* bool specific impl */
+            return a || b;
+          } else {
+            return a > b ? a : b;
+          }
+        });
+  }
+
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
     return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
@@ -500,6 +661,23 @@ class ReduceAggregatorArgMinMax : public ReduceAggregator<T, TVAL> {
   inline void enforce(const ResultsNoTransposePrepareForReduce& res) {
     ORT_ENFORCE(res.projected_index.size() == 0, "Only one axis is allowed for reduction.");
   }
+
+ protected:
+  // Locates the first element equal to the extreme produced by a vectorized reduction pass.
+  // Returns false when the extreme is a NaN or does not occur in the buffer (possible for an
+  // all-NaN input), in which case the caller falls back to the scalar update() loop.
+  inline bool find_first(const T* from_data, const T& extreme) {
+    if (reduce_isnan(extreme)) {
+      return false;
+    }
+    for (int64_t i = 0; i < this->N_; ++i) {
+      if (from_data[i] == extreme) {
+        arg_ = i;
+        return true;
+      }
+    }
+    return false;
+  }
 };
 
 template <typename T, typename TVAL = int64_t>
@@ -507,7 +685,14 @@ class ReduceAggregatorArgMax : public ReduceAggregatorArgMinMax<T, TVAL> {
  public:
   inline ReduceAggregatorArgMax(int64_t N, const T& init) : ReduceAggregatorArgMinMax<T, TVAL>(N, init) {}
   inline TVAL aggall(const T* from_data) {
-    Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(this->N_)).maxCoeff(&this->arg_);
+    // Two passes run faster than Eigen's index visitor: the reduction to the maximum is
+    // vectorized and the equality scan stops at the first occurrence.
+    T extreme = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(this->N_)).maxCoeff();
+    if (!this->find_first(from_data, extreme)) {
+      for (int64_t i = 0; i < this->N_; ++i) {
+        update(from_data[i]);
+      }
+    }
     return this->get_value();
   }
   inline void update(const T& v) {
@@ -519,6 +704,20 @@ class ReduceAggregatorArgMax : public ReduceAggregatorArgMinMax<T, TVAL> {
   }
 };
 
+// For float the platform-dispatched MLAS kernel (AVX/AVX-512 on x64) reduces to the maximum
+// faster than the Eigen expression. A single large float ArgMax over the vocabulary sits on the
+// greedy-decode critical path.
+template <>
+inline int64_t ReduceAggregatorArgMax<float, int64_t>::aggall(const float* from_data) {
+  float extreme = MlasReduceMaximum(from_data, onnxruntime::narrow<size_t>(this->N_));
+  if (!this->find_first(from_data, extreme)) {
+    for (int64_t i = 0; i < this->N_; ++i) {
+      update(from_data[i]);
+    }
+  }
+  return this->get_value();
+}
+
 template <typename T, typename TVAL = int64_t>
 class ReduceAggregatorArgMaxLastIndex : public ReduceAggregatorArgMax<T, TVAL> {
  public:
@@ -543,7 +742,14 @@ class ReduceAggregatorArgMin : public ReduceAggregatorArgMinMax<T, TVAL> {
  public:
   inline ReduceAggregatorArgMin(int64_t N, const T& init) : ReduceAggregatorArgMinMax<T, TVAL>(N, init) {}
   inline TVAL aggall(const T* from_data) {
-    Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(this->N_)).minCoeff(&this->arg_);
+    // Same two-pass scheme as ReduceAggregatorArgMax: vectorized reduction, then a scan for
+    // the first occurrence.
+    T extreme = Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(this->N_)).minCoeff();
+    if (!this->find_first(from_data, extreme)) {
+      for (int64_t i = 0; i < this->N_; ++i) {
+        update(from_data[i]);
+      }
+    }
     return this->get_value();
   }
   inline void update(const T& v) {
@@ -594,6 +800,22 @@ class ReduceAggregatorMin : public ReduceAggregator<T, T> {
     }
   }
 
+  // Parallel whole-tensor reduction
+  static constexpr bool HasParallelAggAll() { return true; }
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return ReduceAggregator<T, T>::CommonParallelAggAll(
+        data, count, tp, use_deterministic_compute,
+        [](const T* p, int64_t size) -> T { return aggall(p, size); },
+        [](const T& a, const T& b) -> T {
+          if constexpr (std::is_same_v<bool, T>) { /* bool specific impl */
+            return a && b;
+          } else {
+            return a < b ? a : b;
+          }
+        });
+  }
+
   // Fast reduction
   static inline FastReduceKind WhichFastReduce() {
     return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
@@ -712,14 +934,98 @@ template <typename T>
 class ReduceAggregatorL1 : public ReduceAggregator<T, T> {
  public:
   inline ReduceAggregatorL1(int64_t N, const T&) : ReduceAggregator<T, T>(N, 0) {}
+  static T aggall(const T* from_data, int64_t size) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(size)).cwiseAbs().sum();
+  }
   inline T aggall(const T* from_data) {
-    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, onnxruntime::narrow<size_t>(this->N_)).cwiseAbs().sum();
+    return aggall(from_data, this->N_);
   }
   inline void update(const T& v) { this->accumulator_ += v > 0 ? v : -v; }
 
   static void fill_for_empty_set(Tensor& output) {
     EigenMap<T>(output).array() = static_cast<T>(0);
   }
+
+  // Parallel whole-tensor reduction
+  static constexpr bool HasParallelAggAll() { return true; }
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return ReduceAggregator<T, T>::CommonParallelAggAll(
+        data, count, tp, use_deterministic_compute,
+        [](const T* p, int64_t size) -> T { return aggall(p, size); },
+        [](const T& a, const T& b) -> T { return a + b; });
+  }
+
+  // Fast reduction
+  static inline FastReduceKind WhichFastReduce() {
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+  }
+
+  static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    const T* data = input.Data<T>();
+    T* out = output.MutableData<T>();
+    int64_t stridei = fast_shape[1];
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<std::ptrdiff_t>(fast_shape[0]), ParallelReduceFastCost(1, stridei, sizeof(T), 6),
+        [data, stridei, out](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t d = first; d < last; ++d) {
+            out[d] = aggall(data + d * stridei, stridei);
+          }
+        });
+  }
+
+  static void FastReduceRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    int64_t N = fast_shape[1];
+    const T* data = input.Data<T>();
+    T* out = output.MutableData<T>();
+
+    int64_t n_rows = fast_shape[0];
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<std::ptrdiff_t>(N), ParallelReduceFastCost(1, n_rows, sizeof(T), 6),
+        [data, out, N, n_rows](ptrdiff_t begin, ptrdiff_t end) {
+          EigenVectorArrayMap<T>(out + begin, end - begin) =
+              ConstEigenVectorArrayMap<T>(data + begin, end - begin).abs();
+          for (int64_t row = 1; row < n_rows; ++row) {
+            EigenVectorArrayMap<T>(out + begin, end - begin) += ConstEigenVectorArrayMap<T>(
+                                                                    data + row * N + begin, end - begin)
+                                                                    .abs();
+          }
+        });
+  }
+
+  static void FastReduceKRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    int64_t N = fast_shape[2];
+    int64_t n_rows = fast_shape[1];
+    const T* data = input.Data<T>();
+    int64_t stridei = fast_shape[1] * fast_shape[2];
+    int64_t strideo = fast_shape[2];
+    T* out = output.MutableData<T>();
+    concurrency::ThreadPool::TryParallelFor(
+        tp, onnxruntime::narrow<ptrdiff_t>(fast_shape[0]), ParallelReduceFastCost(fast_shape[1], fast_shape[2], sizeof(T), 6),
+        [data, stridei, strideo, out, N, n_rows](ptrdiff_t begin, ptrdiff_t last) {
+          for (ptrdiff_t d = begin; d < last; ++d) {
+            const T* p = data + d * stridei;
+            EigenVectorArrayMap<T> block(out + d * strideo, onnxruntime::narrow<size_t>(N));
+            block = ConstEigenVectorArrayMap<T>(p, onnxruntime::narrow<size_t>(N)).abs();
+            for (int64_t row = 1; row < n_rows; ++row) {
+              block += ConstEigenVectorArrayMap<T>(p + row * N, onnxruntime::narrow<size_t>(N)).abs();
+            }
+          }
+        });
+  }
+
+  static void FastReduceRKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregator<T, T>::CommonFastReduceRKR(
+        input, fast_shape, output, tp,
+        [=](const T*) -> T { return 0; },
+        [=](T& value, const T* p, int64_t size) {
+          value += aggall(p, size);
+        });
+  }
 };
 
 template <typename T>
@@ -734,6 +1040,50 @@ class ReduceAggregatorL2 : public ReduceAggregator<T, T> {
   static void fill_for_empty_set(Tensor& output) {
     EigenMap<T>(output).array() = static_cast<T>(0);
   }
+
+  // Parallel whole-tensor reduction: sum of chunk squared norms, one final square root.
+  static constexpr bool HasParallelAggAll() { return true; }
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return reduce_sqrt<T>(ReduceAggregatorSumSquare<T>::ParallelAggAll(data, count, tp, use_deterministic_compute));
+  }
+
+  // Fast reduction: sum of squares followed by a square root over the (small) output.
+  static inline FastReduceKind WhichFastReduce() {
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+  }
+
+  static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSumSquare<T>::FastReduceKR(input, fast_shape, output, tp);
+    SqrtInPlace(output.MutableData<T>(), fast_shape[0]);
+  }
+
+  static void FastReduceRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSumSquare<T>::FastReduceRK(input, fast_shape, output, tp);
+    SqrtInPlace(output.MutableData<T>(), fast_shape[1]);
+  }
+
+  static void FastReduceKRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSumSquare<T>::FastReduceKRK(input, fast_shape, output, tp);
+    SqrtInPlace(output.MutableData<T>(), fast_shape[0] * fast_shape[2]);
+  }
+
+  static void FastReduceRKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSumSquare<T>::FastReduceRKR(input, fast_shape, output, tp);
+    SqrtInPlace(output.MutableData<T>(), fast_shape[1]);
+  }
+
+ private:
+  static void SqrtInPlace(T* out, int64_t size) {
+    T* end = out + size;
+    for (; out != end; ++out) {
+      *out = reduce_sqrt<T>(*out);
+    }
+  }
 };
 
 template <typename T>
@@ -748,6 +1098,50 @@ class ReduceAggregatorLogSum : public ReduceAggregator<T, T> {
   static void fill_for_empty_set(Tensor& output) {
     EigenMap<T>(output).array() = -std::numeric_limits<T>::infinity();
   }
+
+  // Parallel whole-tensor reduction: sum of chunk sums, one final log.
+  static constexpr bool HasParallelAggAll() { return true; }
+  static T ParallelAggAll(const T* data, int64_t count, concurrency::ThreadPool* tp,
+                          bool use_deterministic_compute) {
+    return reduce_log<T>(ReduceAggregatorSum<T>::ParallelAggAll(data, count, tp, use_deterministic_compute));
+  }
+
+  // Fast reduction: plain sum followed by a log over the (small) output.
+  static inline FastReduceKind WhichFastReduce() {
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+  }
+
+  static void FastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSum<T>::FastReduceKR(input, fast_shape, output, tp);
+    LogInPlace(output.MutableData<T>(), fast_shape[0]);
+  }
+
+  static void FastReduceRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSum<T>::FastReduceRK(input, fast_shape, output, tp);
+    LogInPlace(output.MutableData<T>(), fast_shape[1]);
+  }
+
+  static void FastReduceKRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSum<T>::FastReduceKRK(input, fast_shape, output, tp);
+    LogInPlace(output.MutableData<T>(), fast_shape[0] * fast_shape[2]);
+  }
+
+  static void FastReduceRKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                            Tensor& output, concurrency::ThreadPool* tp) {
+    ReduceAggregatorSum<T>::FastReduceRKR(input, fast_shape, output, tp);
+    LogInPlace(output.MutableData<T>(), fast_shape[1]);
+  }
+
+ private:
+  static void LogInPlace(T* out, int64_t size) {
+    T* end = out + size;
+    for (; out != end; ++out) {
+      *out = reduce_log<T>(*out);
+    }
+  }
 };
 
 template <typename T>
@@ -783,7 +1177,8 @@ void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
 template <typename AGG>
 void NoTransposeReduce1Loop(Tensor* output, const TensorShape& new_input_shape, const Tensor& input,
                             gsl::span<const int64_t> reduced_axes, concurrency::ThreadPool* tp,
-                            ResultsNoTransposePrepareForReduce& last_results);
+                            ResultsNoTransposePrepareForReduce& last_results,
+                            bool use_deterministic_compute = false);
 
 // Specific case for ReduceLogSumExp.
 template <typename AGG>
@@ -603,12 +603,13 @@ UniDirectionalGru<T>::UniDirectionalGru(AllocatorPtr allocator,
 }
 
 template <typename T>
+template <typename WeightT>
 void UniDirectionalGru<T>::Compute(gsl::span<const T> inputs_arg,
                                    gsl::span<const int> sequence_lengths_arg,
                                    const int num_directions,
-                                   const GemmWeights<T>& input_weights_s,
-                                   const GemmWeights<T>& recurrent_weightsZR_s,
-                                   const GemmWeights<T>& recurrent_weightsH_s,
+                                   const GemmWeights<WeightT>& input_weights_s,
+                                   const GemmWeights<WeightT>& recurrent_weightsZR_s,
+                                   const GemmWeights<WeightT>& recurrent_weightsH_s,
                                    gsl::span<T>& outputs,
                                    gsl::span<T>& final_hidden_state) {
   ComputeImpl(inputs_arg, sequence_lengths_arg, num_directions,
@@ -617,12 +618,13 @@ void UniDirectionalGru<T>::Compute(gsl::span<const T> inputs_arg,
 }
 
 template <typename T>
+template <typename WeightT>
 void UniDirectionalGru<T>::Compute(gsl::span<const T> inputs_arg,
                                    gsl::span<const int> sequence_lengths_arg,
                                    const int num_directions,
-                                   const GemmWeights<T>& input_weights_s,
-                                   const GemmWeights<T>& recurrent_weightsZR_s,
-                                   const GemmWeights<T>& recurrent_weightsH_s,
+                                   const GemmWeights<WeightT>& input_weights_s,
+                                   const GemmWeights<WeightT>& recurrent_weightsZR_s,
+                                   const GemmWeights<WeightT>& recurrent_weightsH_s,
                                    gsl::span<T>& outputs,
                                    gsl::span<T>& final_hidden_state,
                                    gsl::span<T>& zrh) {
@@ -632,12 +634,13 @@ void UniDirectionalGru<T>::Compute(gsl::span<const T> inputs_arg,
 }
 
 template <typename T>
+template <typename WeightT>
 void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
                                        gsl::span<const int> sequence_lengths_arg,
                                        const int num_directions,
-                                       const GemmWeights<T>& input_weights_s,
-                                       const GemmWeights<T>& recurrent_weightsZR_s,
-                                       const GemmWeights<T>& recurrent_weightsH_s,
+                                       const GemmWeights<WeightT>& input_weights_s,
+                                       const GemmWeights<WeightT>& recurrent_weightsZR_s,
+                                       const GemmWeights<WeightT>& recurrent_weightsH_s,
                                        gsl::span<T>& outputs,
                                        gsl::span<T>& final_hidden_state,
                                        gsl::span<T>& zrh) {
@@ -654,21 +657,7 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
     sequence_lengths = sequence_lengths_;
   }
 
-  gsl::span<const T> input_weights;
-  if (!input_weights_s.is_prepacked_) {
-    input_weights = input_weights_s.GetUnpackedSpan();
-    DumpMatrix("Inputs", inputs.data(), seq_length_ * batch_size_, input_size_);
-    DumpMatrix("input_weights", input_weights.data(), 3 * hidden_size_, input_size_);
-    DumpMatrix("recurrent_weights", recurrent_weights.data(), 3 * hidden_size_, hidden_size_);
-  }
-
-  gsl::span<const T> recurrent_weightsZR;
-  if (!recurrent_weightsZR_s.is_prepacked_)
-    recurrent_weightsZR = recurrent_weightsZR_s.GetUnpackedSpan();
-
-  gsl::span<const T> recurrent_weightsH;
-  if (!recurrent_weightsH_s.is_prepacked_)
-    recurrent_weightsH = recurrent_weightsH_s.GetUnpackedSpan();
+  DumpMatrix("Inputs", inputs.data(), seq_length_ * batch_size_, input_size_);
 
   gsl::span<T> original_outputs = outputs;
   const bool output_sequence = !outputs.empty();
@@ -695,29 +684,18 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
 
   float alpha = 1.0f;
 
+  AllocateQuantizeBuffers<WeightT>(max_sequence_length);
+
   // apply weights to all the inputs
-  if (!input_weights_s.is_prepacked_) {
-    ComputeGemm(total_rows, hidden_size_x3, input_size_, alpha,
-                inputs.begin(), inputs.end(),
-                input_size_,
-                input_weights.begin(), input_weights.end(),
-                input_size_, 0.f,
-                zrh.begin(), zrh.end(),
-                hidden_size_x3, ttp_);
-  } else {
-    MlasGemm(
-        CblasNoTrans,
-        static_cast<size_t>(total_rows),
-        static_cast<size_t>(hidden_size_x3),
-        static_cast<size_t>(input_size_),
-        alpha,
-        inputs.data(),
-        static_cast<size_t>(input_size_),
-        input_weights_s.buffer_,
-        0.0f,
-        &*zrh.begin(),
-        static_cast<size_t>(hidden_size_x3), ttp_);
-  }
+  ComputeGemm(total_rows, hidden_size_x3, input_size_, alpha,
+              inputs.data(), inputs.data() + inputs.size(),
+              input_weights_s,
+              0.f,
+              zrh.data(), zrh.data() + zrh.size(),
+              hidden_size_x3,
+              quantized_input_or_a_.data(),
+              nullptr,  // beta == 0 so no accumulation buffer is needed
+              ttp_);
 
   DumpMatrix("inputs with weights applied", zrh.data(), seq_length_ * batch_size_ * 3, hidden_size_);
 
@@ -781,25 +759,15 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
 
       // calculate Ht-1*R[zr], and add to the weighted inputs that are in zrh
       // Ht-1 * R[zr] + Xt*(W[zr]^T)
-      if (!recurrent_weightsZR_s.is_prepacked_) {
-        ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
-                    prev_Ht, prev_Ht_end,
-                    hidden_size_,
-                    recurrent_weightsZR.begin(), recurrent_weightsZR.end(),
-                    hidden_size_, 1.f,  // beta == 1 so we add existing values in zrh
-                    zrh.begin() + out_added_offset, zrh.end(),
-                    hidden_size_x3, ttp_);
-      } else {
-        MlasGemm(
-            CblasNoTrans,
-            static_cast<size_t>(batch_size_), static_cast<size_t>(hidden_size_x2), static_cast<size_t>(hidden_size_), alpha,
-            &*prev_Ht,
-            static_cast<size_t>(hidden_size_),
-            recurrent_weightsZR_s.buffer_,
-            1.f,
-            &*(zrh.begin() + out_added_offset),
-            static_cast<size_t>(hidden_size_x3), ttp_);
-      }
+      ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
+                  &*prev_Ht, &*prev_Ht + (prev_Ht_end - prev_Ht),
+                  recurrent_weightsZR_s,
+                  1.f,  // beta == 1 so we add existing values in zrh
+                  zrh.data() + out_added_offset, zrh.data() + zrh.size(),
+                  hidden_size_x3,
+                  quantized_input_or_a_.data(),
+                  quantized_C_buffer_.data(),
+                  ttp_);
 
       DumpMatrix("Ht-1 * R[zr] + Xt*(W[zr]^T)" + seqno_str,
                  zrh.data() + out_added_offset, batch_size_, hidden_size_x2, 0, hidden_size_x3);
@@ -813,27 +781,16 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
         }
 
         // compute Ht-1 * (Rh^T) + Rbh
-        if (!recurrent_weightsH_s.is_prepacked_) {
-          ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                      prev_Ht, prev_Ht_end,  // Ht-1
-                      hidden_size_,
-                      recurrent_weightsH.begin(), recurrent_weightsH.end(),  // Rh^T
-                      hidden_size_,
-                      use_bias_ ? 1.f : 0.f,  // don't add values in linear_output_ if no bias input
-                      linear_output_.begin(),
-                      linear_output_.end(),  // pre: Rbh if use_bias_, post:output
-                      hidden_size_, ttp_);
-        } else {
-          MlasGemm(
-              CblasNoTrans,
-              static_cast<size_t>(batch_size_), static_cast<size_t>(hidden_size_), static_cast<size_t>(hidden_size_), alpha,
-              &*prev_Ht,
-              static_cast<size_t>(hidden_size_),
-              recurrent_weightsH_s.buffer_,
-              use_bias_ ? 1.f : 0.f,  // don't add values in linear_output_ if no bias input
-              &*linear_output_.begin(),
-              static_cast<size_t>(hidden_size_), ttp_);
-        }
+        ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
+                    &*prev_Ht, &*prev_Ht + (prev_Ht_end - prev_Ht),  // Ht-1
+                    recurrent_weightsH_s,                            // Rh^T
+                    use_bias_ ? 1.f : 0.f,  // don't add values in linear_output_ if no bias input
+                    linear_output_.data(),
+                    linear_output_.data() + linear_output_.size(),  // pre: Rbh if use_bias_, post:output
+                    hidden_size_,
+                    quantized_input_or_a_.data(),
+                    quantized_C_buffer_.data(),
+                    ttp_);
 
         DumpMatrix("Ht-1 * (Rh^T) + Rbh " + seqno_str, linear_output_.data(), batch_size_, hidden_size_);
       }
@@ -898,25 +855,15 @@ void UniDirectionalGru<T>::ComputeImpl(gsl::span<const T> inputs_arg,
         auto out_H = zrh.begin() + out_added_offset + hidden_size_x2;
 
         // Calculate Xt*(Wh^T) + rt (.) Ht-1 * Rh
-        if (!recurrent_weightsH_s.is_prepacked_) {
-          ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                      cur_h_local, cur_h_local_end,  // rt (.) Ht-1
-                      hidden_size_,
-                      recurrent_weightsH.begin(), recurrent_weightsH.end(),  // Rh^T
-                      hidden_size_, 1.f,                                     // beta == 1 to add Xt*(Wh^T) from out_H
-                      out_H, zrh.end(),
-                      hidden_size_x3, ttp_);
-        } else {
-          MlasGemm(
-              CblasNoTrans,
-              static_cast<size_t>(batch_size_), static_cast<size_t>(hidden_size_), static_cast<size_t>(hidden_size_), alpha,
-              &*cur_h_local,
-              static_cast<size_t>(hidden_size_),
-              recurrent_weightsH_s.buffer_,
-              1.f,  // beta == 1 to add Xt*(Wh^T) from out_H
-              &*out_H,
-              static_cast<size_t>(hidden_size_x3), ttp_);
-        }
+        ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
+                    &*cur_h_local, &*cur_h_local + (cur_h_local_end - cur_h_local),  // rt (.) Ht-1
+                    recurrent_weightsH_s,                                            // Rh^T
+                    1.f,  // beta == 1 to add Xt*(Wh^T) from out_H
+                    &*out_H, zrh.data() + zrh.size(),
+                    hidden_size_x3,
+                    quantized_input_or_a_.data(),
+                    quantized_C_buffer_.data(),
+                    ttp_);
       }
 
       DumpMatrix("Xt*(Wh^T) + (" + label + ")" + seqno_str, zrh.data() + out_added_offset,
@@ -1070,7 +1017,42 @@ void UniDirectionalGru<T>::AllocateBuffers() {
   }
 }
 
+template <typename T>
+template <typename WeightT>
+void UniDirectionalGru<T>::AllocateQuantizeBuffers(int max_sequence_length) {
+  // Can not specialize on WeightT without specify T explicitly, so use sizeof
+  if constexpr (sizeof(WeightT) == 1) {
+    const int total_rows = max_sequence_length * batch_size_;
+
+    int input_or_a_size = std::max(total_rows * input_size_, batch_size_ * hidden_size_);
+    quantized_input_or_a_ = Allocate(allocator_, input_or_a_size, quantized_input_or_a_ptr_, false);
+    quantized_C_buffer_ = Allocate(allocator_, batch_size_ * 3 * hidden_size_, quantized_C_buffer_ptr_, false);
+  }
+}
+
 template class UniDirectionalGru<float>;
 
+template void UniDirectionalGru<float>::Compute<float>(
+    gsl::span<const float> inputs_arg, gsl::span<const int> sequence_lengths_arg, const int num_directions,
+    const GemmWeights<float>& input_weights,
+    const GemmWeights<float>& recurrent_weights_ZR,
+    const GemmWeights<float>& recurrent_weights_H,
+    gsl::span<float>& outputs, gsl::span<float>& final_hidden_state);
+
+template void UniDirectionalGru<float>::Compute<float>(
+    gsl::span<const float> inputs_arg, gsl::span<const int> sequence_lengths_arg, const int num_directions,
+    const GemmWeights<float>& input_weights,
+    const GemmWeights<float>& recurrent_weights_ZR,
+    const GemmWeights<float>& recurrent_weights_H,
+    gsl::span<float>& outputs, gsl::span<float>& final_hidden_state,
+    gsl::span<float>& zrh);
+
+template void UniDirectionalGru<float>::Compute<uint8_t>(
+    gsl::span<const float> inputs_arg, gsl::span<const int> sequence_lengths_arg, const int num_directions,
+    const GemmWeights<uint8_t>& input_weights,
+    const GemmWeights<uint8_t>& recurrent_weights_ZR,
+    const GemmWeights<uint8_t>& recurrent_weights_H,
+    gsl::span<float>& outputs, gsl::span<float>& final_hidden_state);
+
 }  // namespace detail
 }  // namespace onnxruntime
@@ -107,29 +107,32 @@ class UniDirectionalGru {
                     onnxruntime::concurrency::ThreadPool* ttp,
                     const bool training_mode = false);
 
+  template <typename WeightT>
   void Compute(gsl::span<const T> inputs, gsl::span<const int> sequence_lengths, int num_directions,
-               const rnn::detail::GemmWeights<T>& input_weights,
-               const rnn::detail::GemmWeights<T>& recurrent_weights_ZR,
-               const rnn::detail::GemmWeights<T>& recurrent_weights_H,
+               const rnn::detail::GemmWeights<WeightT>& input_weights,
+               const rnn::detail::GemmWeights<WeightT>& recurrent_weights_ZR,
+               const rnn::detail::GemmWeights<WeightT>& recurrent_weights_H,
                gsl::span<T>& outputs, gsl::span<T>& final_hidden_state);
 
   // This function overloads the above one by adding two additional reference inputs that are computed in this kernel:
   //   - zrh: intermediate gate computations
   // This extra output is needed for training for gradient computation.
+  template <typename WeightT>
   void Compute(gsl::span<const T> inputs, gsl::span<const int> sequence_lengths, int num_directions,
-               const rnn::detail::GemmWeights<T>& input_weights,
-               const rnn::detail::GemmWeights<T>& recurrent_weights_ZR,
-               const rnn::detail::GemmWeights<T>& recurrent_weights_H,
+               const rnn::detail::GemmWeights<WeightT>& input_weights,
+               const rnn::detail::GemmWeights<WeightT>& recurrent_weights_ZR,
+               const rnn::detail::GemmWeights<WeightT>& recurrent_weights_H,
                gsl::span<T>& outputs, gsl::span<T>& final_hidden_state,
                gsl::span<T>& zrh);
 
   ~UniDirectionalGru() = default;
 
  private:
+  template <typename WeightT>
   void ComputeImpl(gsl::span<const T> inputs, gsl::span<const int> sequence_lengths, int num_directions,
-                   const rnn::detail::GemmWeights<T>& input_weights,
-                   const rnn::detail::GemmWeights<T>& recurrent_weights_ZR,
-                   const rnn::detail::GemmWeights<T>& recurrent_weights_H,
+                   const rnn::detail::GemmWeights<WeightT>& input_weights,
+                   const rnn::detail::GemmWeights<WeightT>& recurrent_weights_ZR,
+                   const rnn::detail::GemmWeights<WeightT>& recurrent_weights_H,
                    gsl::span<T>& outputs, gsl::span<T>& final_hidden_state,
                    gsl::span<T>& zrh);
 
@@ -178,6 +181,12 @@ class UniDirectionalGru {
   gsl::span<T> inputs_reverse_;
   gsl::span<T> outputs_reverse_;
 
+  // buffers for dynamic quantization of the inputs when the weights are 8 bit
+  IAllocatorUniquePtr<uint8_t> quantized_input_or_a_ptr_;
+  gsl::span<uint8_t> quantized_input_or_a_;
+  IAllocatorUniquePtr<int32_t> quantized_C_buffer_ptr_;
+  gsl::span<int32_t> quantized_C_buffer_;
+
   rnn::detail::deepcpu::ClipWithBiasFuncPtr clip_with_bias_ptr_{};
 
   float zr_alpha_{};
@@ -191,6 +200,9 @@ class UniDirectionalGru {
 
   void AllocateBuffers();
 
+  template <typename WeightT>
+  void AllocateQuantizeBuffers(int max_sequence_length);
+
   onnxruntime::concurrency::ThreadPool* ttp_;
 
   const bool training_mode_ = false;
@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/sequence/concat_from_sequence.h"
+
+#include <cstring>
+
 #include "core/framework/tensorprotoutils.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/TensorSeq.h"
@@ -39,6 +42,27 @@ Status ConcatFromSequence::Compute(OpKernelContext* ctx) const {
   if (p.output_num_elements == 0)
     return Status::OK();
 
+  // Sequences produced by the CPU sequence kernels are commonly views over one contiguous slab in element
+  // order (see TensorSeq::AddFromSlab). When concatenating such a sequence along axis 0 the output is the
+  // slab contents verbatim, so a single memcpy replaces the per-element copies.
+  if (!p.is_string_type && p.axis == 0 && input_tensor_pointers.size() > 1) {
+    const char* next_contiguous = static_cast<const char*>(input_tensor_pointers[0]->DataRaw());
+    bool is_contiguous = true;
+    for (const Tensor* t : input_tensor_pointers) {
+      if (static_cast<const char*>(t->DataRaw()) != next_contiguous) {
+        is_contiguous = false;
+        break;
+      }
+      next_contiguous += t->SizeInBytes();
+    }
+
+    if (is_contiguous) {
+      memcpy(p.output_tensor->MutableDataRaw(), input_tensor_pointers[0]->DataRaw(),
+             p.output_tensor->SizeInBytes());
+      return Status::OK();
+    }
+  }
+
   // Compute values to be placed in the output tensor
   return ComputeImpl(p, ctx);
 }
@@ -3,6 +3,8 @@
 
 #include "core/providers/cpu/sequence/sequence_ops.h"
 
+#include <optional>
+
 #include "core/common/narrow.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/TensorSeq.h"
@@ -324,11 +326,34 @@ Status SequenceConstruct::Compute(OpKernelContext* context) const {
   // now copy the tensors to the output sequence
   Y->SetType(first_dtype);
   Y->Reserve(SafeInt<size_t>(num_inputs));
-  for (int input_idx = 0; input_idx < num_inputs; ++input_idx) {
-    const auto* X = context->Input<Tensor>(input_idx);
-    // Using DataTransferManager here allows other non-CPU EPs to use this implementation of the sequence ops
-    Y->Add(CloneTensor(*X, context, Info().GetDataTransferManager()));
+
+  if (first_dtype != DataTypeImpl::GetType<std::string>()) {
+    // back the whole sequence with a single slab rather than making one allocation per element
+    AllocatorPtr alloc;
+    ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+    SafeInt<size_t> total_bytes = 0;
+    for (int input_idx = 0; input_idx < num_inputs; ++input_idx) {
+      total_bytes += context->Input<Tensor>(input_idx)->SizeInBytes();
+    }
+
+    auto slab = TensorSeq::AllocateSlab(alloc, total_bytes);
+    SafeInt<size_t> offset = 0;
+    for (int input_idx = 0; input_idx < num_inputs; ++input_idx) {
+      const auto* X = context->Input<Tensor>(input_idx);
+      Tensor& target = Y->AddFromSlab(slab, X->Shape(), alloc->Info(), static_cast<ptrdiff_t>(offset));
+      // Using DataTransferManager here allows other non-CPU EPs to use this implementation of the sequence ops
+      ORT_RETURN_IF_ERROR(Info().GetDataTransferManager().CopyTensor(*X, target));
+      offset += X->SizeInBytes();
+    }
+  } else {
+    for (int input_idx = 0; input_idx < num_inputs; ++input_idx) {
+      const auto* X = context->Input<Tensor>(input_idx);
+      // Using DataTransferManager here allows other non-CPU EPs to use this implementation of the sequence ops
+      Y->Add(CloneTensor(*X, context, Info().GetDataTransferManager()));
+    }
   }
+
   return Status::OK();
 }
 
@@ -487,6 +512,18 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
   tseq->SetType(input.DataType());
   tseq->Reserve(static_cast<size_t>(num_outputs));
 
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context.GetTempSpaceAllocator(&alloc));
+
+  // for non-string types the outputs are disjoint slices of the input, so one slab the size of the input can
+  // back every element of the sequence. splitting a large tensor into thousands of small tensors then costs a
+  // single allocation instead of one per element.
+  std::shared_ptr<void> slab;
+  if (!is_string_type) {
+    slab = TensorSeq::AllocateSlab(alloc, SafeInt<size_t>(input_shape.Size()) * element_size);
+  }
+  SafeInt<size_t> slab_offset = 0;
+
   // copy dimensions so we can update the selected axis in place
   auto output_dimensions = input_shape.AsShapeVector();
   SafeInt<size_t> input_offset = 0;
@@ -501,10 +538,18 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
     }
     output_dimensions[onnxruntime::narrow<size_t>(axis)] = split_size;
 
-    AllocatorPtr alloc;
-    ORT_RETURN_IF_ERROR(context.GetTempSpaceAllocator(&alloc));
-    Tensor output_tensor(input.DataType(), onnxruntime::TensorShape(output_dimensions), alloc);
-    void* output_data = output_tensor.MutableDataRaw();
+    // string tensors cannot live in the slab so they keep their own allocation and are added at the end of
+    // the iteration. other types are added as views into the slab up front and filled in place.
+    std::optional<Tensor> string_tensor;
+    Tensor* output_tensor = nullptr;
+    if (is_string_type) {
+      string_tensor.emplace(input.DataType(), onnxruntime::TensorShape(output_dimensions), alloc);
+      output_tensor = &*string_tensor;
+    } else {
+      output_tensor = &tseq->AddFromSlab(slab, onnxruntime::TensorShape(output_dimensions), alloc->Info(),
+                                         static_cast<ptrdiff_t>(static_cast<size_t>(slab_offset)));
+    }
+    void* output_data = output_tensor->MutableDataRaw();
 
     const auto M = before_dims;
     const auto* A = static_cast<const char*>(input_data) + static_cast<size_t>(input_offset * element_size);
@@ -558,11 +603,15 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
           new_dims.push_back(output_dimensions[onnxruntime::narrow<size_t>(idx)]);
         }
       }
-      output_tensor.Reshape(new_dims);
+      output_tensor->Reshape(new_dims);
     }
 
-    // finally move the resulting tensor to the output sequence
-    tseq->Add(std::move(output_tensor));
+    if (is_string_type) {
+      // move the resulting tensor to the output sequence. slab backed tensors were added when created.
+      tseq->Add(std::move(*string_tensor));
+    } else {
+      slab_offset += SafeInt<size_t>(M) * N * element_size;
+    }
   }
 
   return Status::OK();
@@ -11,6 +11,7 @@
 #include <core/common/safeint.h>
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/providers/cpu/signal/utils.h"
@@ -533,24 +534,58 @@ static Status short_time_fourier_transform(OpKernelContext* ctx, bool is_oneside
   InlinedVector<std::complex<T>> V;
   InlinedVector<std::complex<T>> temp_output;
 
-  // Run each dft of each batch as if it was a real-valued batch size 1 dft operation
-  for (int64_t batch_idx = 0; batch_idx < batch_size; batch_idx++) {
-    for (int64_t i = 0; i < n_dfts; i++) {
-      auto input_frame_begin =
-          signal_data + (batch_idx * signal_size * signal_components) + (i * frame_step * signal_components);
+  // Runs one dft of one batch as if it was a real-valued batch size 1 dft operation
+  auto run_frame = [&](int64_t batch_idx, int64_t i, InlinedVector<std::complex<T>>& v,
+                       InlinedVector<std::complex<T>>& scratch) -> Status {
+    auto input_frame_begin =
+        signal_data + (batch_idx * signal_size * signal_components) + (i * frame_step * signal_components);
 
-      auto output_frame_begin = Y_data + (batch_idx * n_dfts * dft_output_size * output_components) +
-                                (i * dft_output_size * output_components);
+    auto output_frame_begin = Y_data + (batch_idx * n_dfts * dft_output_size * output_components) +
+                              (i * dft_output_size * output_components);
 
-      // Tensors do not own the backing memory, so no worries on destruction
-      auto input = onnxruntime::Tensor(signal->DataType(), dft_input_shape, input_frame_begin, signal->Location(), 0);
+    // Tensors do not own the backing memory, so no worries on destruction
+    auto input = onnxruntime::Tensor(signal->DataType(), dft_input_shape, input_frame_begin, signal->Location(), 0);
 
-      auto output = onnxruntime::Tensor(Y->DataType(), dft_output_shape, output_frame_begin, Y->Location(), 0);
+    auto output = onnxruntime::Tensor(Y->DataType(), dft_output_shape, output_frame_begin, Y->Location(), 0);
 
-      // Run individual dft
-      ORT_RETURN_IF_ERROR((discrete_fourier_transform<T, U>(ctx, &input, &output, b_fft, chirp, 1, window_size, window, is_onesided,
-                                                            false, V, temp_output)));
-    }
+    return discrete_fourier_transform<T, U>(ctx, &input, &output, b_fft, chirp, 1, window_size, window, is_onesided,
+                                            false, v, scratch);
+  };
+
+  const int64_t total_dfts = batch_size * n_dfts;
+
+  // Run the first frame on the calling thread. For non power-of-two window sizes this
+  // initializes the shared Bluestein chirp tensors, which the remaining frames only read.
+  if (total_dfts > 0) {
+    ORT_RETURN_IF_ERROR(run_frame(0, 0, V, temp_output));
+  }
+
+  // The remaining frames are independent, so run them in parallel. Each worker keeps its
+  // own twiddle/scratch buffers, which are computed once per worker and reused across its frames.
+  if (total_dfts > 1) {
+    Status parallel_status = Status::OK();
+    OrtMutex status_mutex;
+    // Rough per-frame cost assuming the O(n log n) path
+    const double per_frame_cost = static_cast<double>(window_size) * std::max(1.0, std::log2(static_cast<double>(window_size)));
+    concurrency::ThreadPool::TryParallelFor(
+        ctx->GetOperatorThreadPool(), onnxruntime::narrow<std::ptrdiff_t>(total_dfts - 1),
+        TensorOpCost{static_cast<double>(window_size), static_cast<double>(dft_output_size) * 2.0, per_frame_cost},
+        [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+          InlinedVector<std::complex<T>> local_v;
+          InlinedVector<std::complex<T>> local_scratch;
+          for (std::ptrdiff_t j = begin; j < end; ++j) {
+            const int64_t flat_idx = static_cast<int64_t>(j) + 1;
+            Status frame_status = run_frame(flat_idx / n_dfts, flat_idx % n_dfts, local_v, local_scratch);
+            if (!frame_status.IsOK()) {
+              std::lock_guard<OrtMutex> guard(status_mutex);
+              if (parallel_status.IsOK()) {
+                parallel_status = frame_status;
+              }
+              return;
+            }
+          }
+        });
+    ORT_RETURN_IF_ERROR(parallel_status);
   }
 
   return Status::OK();
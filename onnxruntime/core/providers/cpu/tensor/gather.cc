@@ -3,6 +3,9 @@
 
 // https://github.com/onnx/onnx/blob/main/docs/Operators.md#Gather
 #include "core/providers/cpu/tensor/gather.h"
+
+#include <algorithm>
+
 #include "core/common/common.h"
 #include "core/common/narrow.h"
 #include "core/common/safeint.h"
@@ -10,6 +13,10 @@
 #include "core/platform/threadpool.h"
 #include "core/providers/op_kernel_type_control.h"
 
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
 namespace onnxruntime {
 
 using DefaultIndexTypes = TypeList<int32_t, int64_t>;
@@ -83,6 +90,27 @@ Status GatherBase::PrepareForCompute(OpKernelContext* context, Prepare& p) const
   return Status::OK();
 }
 
+namespace {
+
+// Requests the leading cache lines of a gathered row ahead of its copy. Long rows are
+// capped at a few lines; their tail is a sequential read the hardware prefetcher covers.
+inline void PrefetchRow(const uint8_t* address, int64_t bytes) {
+  constexpr int64_t kCacheLineBytes = 64;
+  constexpr int64_t kMaxPrefetchBytes = 4 * kCacheLineBytes;
+  bytes = std::min(bytes, kMaxPrefetchBytes);
+  for (int64_t offset = 0; offset < bytes; offset += kCacheLineBytes) {
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+    _mm_prefetch(reinterpret_cast<const char*>(address + offset), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address + offset, /*rw*/ 0, /*locality*/ 3);
+#else
+    ORT_UNUSED_PARAMETER(address);
+#endif
+  }
+}
+
+}  // namespace
+
 template <typename Tin>
 Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uint8_t* dst_base, bool is_string_type,
                       const size_t element_bytes, const int64_t block_size, const int64_t M,
@@ -102,6 +130,32 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
+  // Embedding-style lookups (all batch dims of size 1, non-string data) on large tables are
+  // bound by DRAM latency: consecutive indices land on unrelated pages and the hardware
+  // prefetcher cannot follow the data-dependent row addresses. Walk the indices with a
+  // software prefetch window so several row fetches are in flight while the current row is
+  // copied, and let the intra-op pool partition the index range across threads as usual.
+  if (M == 1 && !is_string_type) {
+    constexpr int64_t kPrefetchDistance = 8;
+    concurrency::ThreadPool::TryParallelFor(
+        tp, narrow<ptrdiff_t>(N), static_cast<double>(block_size),
+        [&](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t i = first; i < last; ++i) {
+            const ptrdiff_t prefetch_i = i + kPrefetchDistance;
+            if (prefetch_i < last) {
+              Tin prefetch_idx = indices_data[prefetch_i];
+              prefetch_idx = prefetch_idx < 0 ? prefetch_idx + static_cast<Tin>(axis_dim_limit) : prefetch_idx;
+              PrefetchRow(src_base + prefetch_idx * block_size, block_size);
+            }
+            Tin idx = indices_data[i];
+            idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
+            memcpy(dst_base + i * block_size, src_base + idx * block_size, narrow<size_t>(block_size));
+          }
+        });
+
+    return Status::OK();
+  }
+
   auto lambda = [&](int64_t index) {
     int64_t batch = index / N;
     int64_t i = index % N;
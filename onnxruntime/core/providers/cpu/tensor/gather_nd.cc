@@ -177,15 +177,23 @@ Status GatherND::Compute(OpKernelContext* context) const {
 }
 
 Status GatherND::GatherNumber(const Prepare& p, concurrency::ThreadPool* tp) const {
-  auto lambda = [&](int64_t slice_idx) {
-    memcpy(p.output_base + slice_idx * p.bytes_per_slice, p.input_base + p.slice_offsets[onnxruntime::narrow<size_t>(slice_idx)] * p.element_bytes,
-           onnxruntime::narrow<size_t>(p.bytes_per_slice));
-  };
   concurrency::ThreadPool::TryParallelFor(
       tp, p.slice_offsets.size(), static_cast<double>(p.bytes_per_slice),
-      [&lambda](ptrdiff_t first, ptrdiff_t last) {
-        for (int slice_idx = static_cast<int>(first), end = static_cast<int>(last); slice_idx < end; ++slice_idx) {
-          lambda(slice_idx);
+      [&p](ptrdiff_t first, ptrdiff_t last) {
+        // Runs of slices that read consecutive input (common when indices are sorted) are
+        // merged into a single larger memcpy instead of one call per slice.
+        ptrdiff_t slice_idx = first;
+        while (slice_idx < last) {
+          ptrdiff_t run_end = slice_idx + 1;
+          while (run_end < last &&
+                 p.slice_offsets[onnxruntime::narrow<size_t>(run_end)] ==
+                     p.slice_offsets[onnxruntime::narrow<size_t>(run_end - 1)] + p.element_count_per_slice) {
+            ++run_end;
+          }
+          memcpy(p.output_base + slice_idx * p.bytes_per_slice,
+                 p.input_base + p.slice_offsets[onnxruntime::narrow<size_t>(slice_idx)] * p.element_bytes,
+                 onnxruntime::narrow<size_t>((run_end - slice_idx) * p.bytes_per_slice));
+          slice_idx = run_end;
         }
       });
   return Status::OK();
@@ -3,6 +3,8 @@
 
 #include "core/providers/cpu/tensor/scatter_nd.h"
 
+#include <algorithm>
+
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/platform/threadpool.h"
@@ -396,10 +398,52 @@ struct ScatterNDDispatchTarget {
         } break;
       }
     };
-    concurrency::ThreadPool::TryParallelFor(
-        tp, prepare.element_offsets.size(), static_cast<double>(prepare.element_to_copy),
-        [&lambda](ptrdiff_t first, ptrdiff_t last) {
-          for (int i = static_cast<int>(first), end = static_cast<int>(last); i < end; ++i) {
+    if (reduction == ScatterND::Reduction::None) {
+      // Each update overwrites its destination slice outright (behavior for duplicate indices
+      // is undefined per spec), so updates can be split across threads arbitrarily.
+      concurrency::ThreadPool::TryParallelFor(
+          tp, prepare.element_offsets.size(), static_cast<double>(prepare.element_to_copy),
+          [&lambda](ptrdiff_t first, ptrdiff_t last) {
+            for (int i = static_cast<int>(first), end = static_cast<int>(last); i < end; ++i) {
+              lambda(i);
+            }
+          });
+      return Status::OK();
+    }
+
+    // Reductions combine each update with whatever is already at the destination, and duplicate
+    // indices are legal, so two threads must never process updates aimed at the same slice.
+    // Every element offset is a sum of indices scaled by input strides that are all multiples of
+    // element_to_copy, so destination slices are aligned to element_to_copy and either coincide
+    // exactly or do not overlap at all. Partition updates by destination slice
+    // (offset / element_to_copy): all updates to one slice land in the same bucket in their
+    // original order, so buckets run in parallel without atomics and the result matches the
+    // sequential one.
+    const auto num_updates = static_cast<std::ptrdiff_t>(prepare.element_offsets.size());
+    constexpr std::ptrdiff_t kMinUpdatesPerBucket = 64;
+    const std::ptrdiff_t num_buckets =
+        std::min<std::ptrdiff_t>(concurrency::ThreadPool::DegreeOfParallelism(tp),
+                                 num_updates / kMinUpdatesPerBucket);
+    if (num_buckets < 2 || prepare.element_to_copy == 0) {
+      for (std::ptrdiff_t i = 0; i < num_updates; ++i) {
+        lambda(i);
+      }
+      return Status::OK();
+    }
+
+    std::vector<std::vector<std::ptrdiff_t>> buckets(static_cast<size_t>(num_buckets));
+    for (auto& bucket : buckets) {
+      bucket.reserve(static_cast<size_t>(num_updates / num_buckets + 1));
+    }
+    for (std::ptrdiff_t i = 0; i < num_updates; ++i) {
+      const uint64_t slice_idx = prepare.element_offsets[static_cast<size_t>(i)] / prepare.element_to_copy;
+      buckets[onnxruntime::narrow<size_t>(slice_idx % static_cast<uint64_t>(num_buckets))].push_back(i);
+    }
+
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, num_buckets,
+        [&](std::ptrdiff_t bucket_idx) {
+          for (std::ptrdiff_t i : buckets[static_cast<size_t>(bucket_idx)]) {
             lambda(i);
           }
         });
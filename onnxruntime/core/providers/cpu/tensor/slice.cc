@@ -7,6 +7,7 @@
 #include <unordered_map>
 
 #include "core/common/narrow.h"
+#include "core/framework/copy.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/providers/common.h"
@@ -39,16 +40,25 @@ using EnabledIndicesTypes = ORT_OP_KERNEL_ARG_ENABLED_TYPE_LIST_ALL_OPSETS(kCpuE
                                                                            Slice, Input, 1);
 }  // namespace
 
+// Any slice can be expressed as a view over the input (per-axis strides scaled by the step plus a
+// byte offset for the starts), so the output may share the input's buffer when every consumer
+// supports strided tensors.
+#ifdef ENABLE_STRIDED_TENSORS
+#define CREATE_SLICE_KERNEL_DEF KernelDefBuilder().MayStridedOutput(0, 0)
+#else
+#define CREATE_SLICE_KERNEL_DEF KernelDefBuilder()
+#endif
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Slice,
     1, 9,
-    KernelDefBuilder().TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>()),
+    CREATE_SLICE_KERNEL_DEF.TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>()),
     Slice1);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Slice,
     10, 10,
-    KernelDefBuilder()
+    CREATE_SLICE_KERNEL_DEF
         .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
         .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>()),
     Slice10);
@@ -57,7 +67,7 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Slice,
     11,
     12,
-    KernelDefBuilder()
+    CREATE_SLICE_KERNEL_DEF
         .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
         .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>()),
     Slice10);
@@ -65,11 +75,13 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
 ONNX_CPU_OPERATOR_KERNEL(
     Slice,
     13,
-    KernelDefBuilder()
+    CREATE_SLICE_KERNEL_DEF
         .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
         .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>()),
     Slice10);
 
+#undef CREATE_SLICE_KERNEL_DEF
+
 // Coalesce contiguous non-slice dimensions into a single dimension.
 // Set p_flattened_input_dims_ and p_flattened_output_dims_ to nullptr if nothing coalesced.
 // Updates starts and steps to match the new dimensions.
@@ -264,6 +276,27 @@ static Status SliceImpl(OpKernelContext* ctx,
   return Status::OK();
 }
 
+#ifdef ENABLE_STRIDED_TENSORS
+// Expose the slice as a view over the input: per-axis strides scaled by the step and a byte
+// offset addressing the first selected element. Only called when the allocation planner has
+// already made the output share the input's buffer (see MayStridedOutput).
+static Status MakeStridedView(const Tensor& input_tensor, const SliceOp::PrepareForComputeMetadata& compute_metadata,
+                              Tensor& output_tensor) {
+  const auto input_strides = StridesForTensor(input_tensor);
+  const size_t rank = compute_metadata.input_dimensions_.size();
+  TensorShapeVector output_strides(rank);
+  int64_t offset_elems = 0;
+  for (size_t dim = 0; dim < rank; ++dim) {
+    output_strides[dim] = input_strides[dim] * compute_metadata.steps_[dim];
+    offset_elems += compute_metadata.starts_[dim] * input_strides[dim];
+  }
+
+  output_tensor.SetShapeAndStrides(TensorShape(compute_metadata.output_dims_), output_strides);
+  output_tensor.SetByteOffset(narrow<ptrdiff_t>(offset_elems * static_cast<int64_t>(input_tensor.DataType()->Size())));
+  return Status::OK();
+}
+#endif
+
 template <typename EnabledTypes, typename T>
 static inline bool CallSliceImplIfEnabled(OpKernelContext* ctx,
                                           const Tensor& input_tensor,
@@ -288,12 +321,13 @@ Status SliceBase::Compute(OpKernelContext* ctx) const {
 
   SliceOp::PrepareForComputeMetadata compute_metadata(input_dimensions);
 
+  TensorShapeVector input_starts;
+  TensorShapeVector input_ends;
+  TensorShapeVector input_axes;
+  TensorShapeVector input_steps;
+
   // Slice V10 & DynamicSlice
   if (dynamic_) {
-    TensorShapeVector input_starts;
-    TensorShapeVector input_ends;
-    TensorShapeVector input_axes;
-    TensorShapeVector input_steps;
     ORT_RETURN_IF_ERROR(FillVectorsFromInput(*ctx->Input<Tensor>(1), *ctx->Input<Tensor>(2),
                                              ctx->Input<Tensor>(3), ctx->Input<Tensor>(4),
                                              input_starts, input_ends,
@@ -306,6 +340,25 @@ Status SliceBase::Compute(OpKernelContext* ctx) const {
     ORT_RETURN_IF_ERROR(PrepareForCompute(attr_starts_, attr_ends_, attr_axes_, compute_metadata));
   }
 
+#ifdef ENABLE_STRIDED_TENSORS
+  {
+    Tensor& output_tensor = *ctx->Output(0, TensorShape(compute_metadata.output_dims_));
+    if (output_tensor.Shape().Size() > 0 && output_tensor.DataRaw() == input_tensor.DataRaw()) {
+      // The allocation planner shared the input's buffer with this output because all consumers
+      // accept strided tensors. PrepareForCompute may have coalesced starts_/steps_ via
+      // FlattenOutputDims, so recompute the per-axis values for the view.
+      SliceOp::PrepareForComputeMetadata view_metadata(input_dimensions);
+      if (dynamic_) {
+        ORT_RETURN_IF_ERROR(
+            SliceOp::PrepareForComputeHelper(input_starts, input_ends, input_axes, input_steps, view_metadata));
+      } else {
+        ORT_RETURN_IF_ERROR(SliceOp::PrepareForComputeHelper(attr_starts_, attr_ends_, attr_axes_, view_metadata));
+      }
+      return MakeStridedView(input_tensor, view_metadata, output_tensor);
+    }
+  }
+#endif
+
   Status status = Status::OK();
 
   bool supported = false;
@@ -18,7 +18,9 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     12,
     KernelDefBuilder()
         .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
-                              DataTypeImpl::GetTensorType<double>()}),
+                              DataTypeImpl::GetTensorType<double>(),
+                              DataTypeImpl::GetTensorType<uint8_t>(),
+                              DataTypeImpl::GetTensorType<int8_t>()}),
     SpaceToDepth);
 
 ONNX_CPU_OPERATOR_KERNEL(
@@ -26,7 +28,9 @@ ONNX_CPU_OPERATOR_KERNEL(
     13,
     KernelDefBuilder()
         .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
-                              DataTypeImpl::GetTensorType<double>()}),
+                              DataTypeImpl::GetTensorType<double>(),
+                              DataTypeImpl::GetTensorType<uint8_t>(),
+                              DataTypeImpl::GetTensorType<int8_t>()}),
     SpaceToDepth);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -34,7 +38,9 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     1, 10,
     KernelDefBuilder()
         .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
-                              DataTypeImpl::GetTensorType<double>()}),
+                              DataTypeImpl::GetTensorType<double>(),
+                              DataTypeImpl::GetTensorType<uint8_t>(),
+                              DataTypeImpl::GetTensorType<int8_t>()}),
     DepthToSpace);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -43,7 +49,9 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     12,
     KernelDefBuilder()
         .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
-                              DataTypeImpl::GetTensorType<double>()}),
+                              DataTypeImpl::GetTensorType<double>(),
+                              DataTypeImpl::GetTensorType<uint8_t>(),
+                              DataTypeImpl::GetTensorType<int8_t>()}),
     DepthToSpace);
 
 ONNX_CPU_OPERATOR_KERNEL(
@@ -51,7 +59,9 @@ ONNX_CPU_OPERATOR_KERNEL(
     13,
     KernelDefBuilder()
         .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
-                              DataTypeImpl::GetTensorType<double>()}),
+                              DataTypeImpl::GetTensorType<double>(),
+                              DataTypeImpl::GetTensorType<uint8_t>(),
+                              DataTypeImpl::GetTensorType<int8_t>()}),
     DepthToSpace);
 
 // intermediate tensor shapes are:
@@ -81,6 +91,22 @@ static void SpaceDepthOpCpuImpl(const Tensor& input, Tensor& output,
           .shuffle(permutation);
 }
 
+// variant for 8-bit elements of either sign. The op never interprets the element values,
+// so int8_t and uint8_t tensors share the uint8_t instantiation to minimize binary size.
+static void SpaceDepthOpCpuImpl8Bit(const Tensor& input, Tensor& output,
+                                    const std::array<Eigen::DenseIndex, IntermediateTensorRank>& permutation,
+                                    const Eigen::DenseIndex batch_size,  // dim0 in both input and output
+                                    const Eigen::DenseIndex in_dim1, const Eigen::DenseIndex in_dim2, const Eigen::DenseIndex in_dim3,
+                                    const Eigen::DenseIndex in_dim4, const Eigen::DenseIndex in_dim5,
+                                    const Eigen::DenseIndex out_dim1, const Eigen::DenseIndex out_dim2, const Eigen::DenseIndex out_dim3,
+                                    const Eigen::DenseIndex out_dim4, const Eigen::DenseIndex out_dim5) {
+  EigenTensorMap<uint8_t>(reinterpret_cast<uint8_t*>(output.MutableDataRaw()),
+                          batch_size, out_dim1, out_dim2, out_dim3, out_dim4, out_dim5) =
+      ConstEigenTensorMap<uint8_t>(reinterpret_cast<const uint8_t*>(input.DataRaw()), batch_size,
+                                   in_dim1, in_dim2, in_dim3, in_dim4, in_dim5)
+          .shuffle(permutation);
+}
+
 Status SpaceToDepth::Compute(OpKernelContext* context) const {
   const auto* tensor_pointer = context->Input<Tensor>(0);
   if (tensor_pointer == nullptr) return Status(common::ONNXRUNTIME, common::FAIL, "input count mismatch");
@@ -132,8 +158,23 @@ Status SpaceToDepth::Compute(OpKernelContext* context) const {
                                 onnxruntime::narrow<std::ptrdiff_t>(input_depth),
                                 onnxruntime::narrow<std::ptrdiff_t>(input_height / blocksize_),
                                 onnxruntime::narrow<std::ptrdiff_t>(input_width / blocksize_));
+  } else if (input.IsDataType<uint8_t>() || input.IsDataType<int8_t>()) {
+    // 8-bit support lets QDQ models stay quantized through the op. The op only moves
+    // data around, so signed and unsigned 8-bit share the uint8_t instantiation.
+    SpaceDepthOpCpuImpl8Bit(input, output, permutation,
+                            onnxruntime::narrow<ptrdiff_t>(batch),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_depth),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_height / blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_width / blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(blocksize_),
+                            onnxruntime::narrow<ptrdiff_t>(blocksize_),
+                            onnxruntime::narrow<ptrdiff_t>(blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_depth),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_height / blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_width / blocksize_));
   } else {
-    // user will not see this as the kernel doesn't claim support for types other than float and double
+    // user will not see this as the kernel doesn't claim support for other types
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unsupported input type in SpaceToDepth op: ", input.DataType());
   }
 
@@ -196,8 +237,21 @@ Status DepthToSpace::Compute(OpKernelContext* context) const {
                                 onnxruntime::narrow<std::ptrdiff_t>(blocksize_),
                                 onnxruntime::narrow<std::ptrdiff_t>(input_width),
                                 onnxruntime::narrow<std::ptrdiff_t>(blocksize_));
+  } else if (input.IsDataType<uint8_t>() || input.IsDataType<int8_t>()) {
+    SpaceDepthOpCpuImpl8Bit(input, output, permutation,
+                            onnxruntime::narrow<std::ptrdiff_t>(batch),
+                            onnxruntime::narrow<std::ptrdiff_t>(dim1),
+                            onnxruntime::narrow<std::ptrdiff_t>(blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(dim3),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_height),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_width),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_depth / blocksize_ / blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_height),
+                            onnxruntime::narrow<std::ptrdiff_t>(blocksize_),
+                            onnxruntime::narrow<std::ptrdiff_t>(input_width),
+                            onnxruntime::narrow<std::ptrdiff_t>(blocksize_));
   } else {
-    // user will not see this as the kernel doesn't claim support for types other than float and double
+    // user will not see this as the kernel doesn't claim support for other types
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unsupported input type in DepthToSpace op: ", input.DataType());
   }
 
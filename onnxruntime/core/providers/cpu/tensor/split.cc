@@ -28,12 +28,21 @@ ORT_SPECIFY_OP_KERNEL_ARG_REQUIRED_TYPES_ALL_OPSETS(
 using EnabledSplitDataTypes = ORT_OP_KERNEL_ARG_ENABLED_TYPE_LIST_ALL_OPSETS(
     kCpuExecutionProvider, kOnnxDomain, Split, Input, 0);
 
+// Each output chunk is a sub-block of the input (the input's strides plus a byte offset), so the
+// outputs may share the input's buffer when every consumer supports strided tensors. The -1 output
+// index covers the variadic output list.
+#ifdef ENABLE_STRIDED_TENSORS
+#define CREATE_SPLIT_KERNEL_DEF KernelDefBuilder().MayStridedOutput(0, -1)
+#else
+#define CREATE_SPLIT_KERNEL_DEF KernelDefBuilder()
+#endif
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Split,
     2,
     10,
-    KernelDefBuilder().TypeConstraint("T",
-                                      BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
+    CREATE_SPLIT_KERNEL_DEF.TypeConstraint("T",
+                                           BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
     Split_1_13);
 
 // Opset 11 starts to support Neg Axis.
@@ -41,8 +50,8 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Split,
     11,
     12,
-    KernelDefBuilder().TypeConstraint("T",
-                                      BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
+    CREATE_SPLIT_KERNEL_DEF.TypeConstraint("T",
+                                           BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
     Split_1_13);
 
 // Opset 13 starts to supports 'split' as optional input.
@@ -50,18 +59,20 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Split,
     13,
     17,
-    KernelDefBuilder().TypeConstraint("T",
-                                      BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
+    CREATE_SPLIT_KERNEL_DEF.TypeConstraint("T",
+                                           BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
     Split_1_13);
 
 // TODO: support unequal split and num_outputs
 ONNX_CPU_OPERATOR_KERNEL(
     Split,
     18,
-    KernelDefBuilder().TypeConstraint("T",
-                                      BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
+    CREATE_SPLIT_KERNEL_DEF.TypeConstraint("T",
+                                           BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>()),
     Split_18);
 
+#undef CREATE_SPLIT_KERNEL_DEF
+
 Status SplitBase::PrepareForCompute(const TensorShape& input_shape, int num_outputs, int64_t& axis, int& before_dims,
                                     int& after_dims_including_split_axis, int& after_dims_excluding_split,
                                     std::vector<int64_t>& split_sizes) const {
@@ -158,7 +169,22 @@ Status SplitImpl::Compute(OpKernelContext* context) const {
     auto split_size = narrow<int>(split_sizes[i]);
     output_dimensions[narrow<size_t>(axis)] = split_size;
 
-    Tensor* output = context->Output(i, TensorShape{output_dimensions});
+    TensorShape output_shape{output_dimensions};
+    Tensor* output = context->Output(i, output_shape);
+
+#ifdef ENABLE_STRIDED_TENSORS
+    if (output_shape.Size() > 0 && output->DataRaw() == input.DataRaw()) {
+      // The allocation planner shared the input's buffer with this output because all consumers
+      // accept strided tensors: expose the chunk as a view (the input's strides plus a byte
+      // offset) instead of copying it out.
+      output->SetShapeAndStrides(output_shape, input_strides);
+      output->SetByteOffset(static_cast<ptrdiff_t>(input_offset) *
+                            static_cast<ptrdiff_t>(input.DataType()->Size()));
+      input_offset += SafeInt<ptrdiff_t>(split_size) * after_dims_excluding_split;
+      continue;
+    }
+#endif
+
     const auto output_strides = StridesForTensor(*output);
 
     ORT_RETURN_IF_ERROR(DispatchStridedCopy<EnabledSplitDataTypes>(context->GetOperatorThreadPool(),
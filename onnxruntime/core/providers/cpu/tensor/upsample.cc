@@ -935,7 +935,7 @@ float CubicInterpolation1D(const T* Xdata,
                            int64_t y,
                            int64_t input_height,
                            int64_t input_width,
-                           std::array<float, CubicModeGridLength>& coeff_array,
+                           const std::array<float, CubicModeGridLength>& coeff_array,
                            float coeff_sum,
                            std::unordered_map<int64_t, float>& cache) {
   // When calculating cubic interpolation we move the 4*4 grid across the original data and therefore there is
@@ -975,9 +975,10 @@ void ResizeBiCubic(int64_t batch_size,
                    float extrapolation_value,
                    bool exclude_outside,
                    gsl::span<const float> roi,
-                   const T* Xdata,
-                   T* Ydata,
-                   const GetOriginalCoordinateFunc& get_original_coordinate) {
+                   const T* XdataBase,
+                   T* YdataBase,
+                   const GetOriginalCoordinateFunc& get_original_coordinate,
+                   concurrency::ThreadPool* tp) {
   std::vector<float> y_original;
   y_original.reserve(narrow<size_t>(output_height));
 
@@ -985,7 +986,6 @@ void ResizeBiCubic(int64_t batch_size,
   x_original.reserve(narrow<size_t>(output_width));
 
   std::unordered_map<float, std::array<float, CubicModeGridLength>> cubic_coeffs;
-  std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
   auto roi_y_start = roi.size() / 2 - 2;
   auto roi_y_end = roi.size() - 2;
   auto roi_x_start = roi.size() / 2 - 1;
@@ -1002,7 +1002,6 @@ void ResizeBiCubic(int64_t batch_size,
     auto s = y_original[narrow<size_t>(y)] - std::floor(y_original[narrow<size_t>(y)]);
     if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
       cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
     }
   }
 
@@ -1018,92 +1017,95 @@ void ResizeBiCubic(int64_t batch_size,
     auto s = x_original[narrow<size_t>(x)] - std::floor(x_original[narrow<size_t>(x)]);
     if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
       cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
     }
   }
 
-  // setup up temp arrays to hold coefficients when exclude_outside is set to true
-  std::array<float, CubicModeGridLength> y_coeff_holder;
-  std::array<float, CubicModeGridLength> x_coeff_holder;
-  float y_coeff_sum = 1;
-  float x_coeff_sum = 1;
-
   for (int64_t n = 0; n < batch_size; n++) {
-    for (int64_t c = 0; c < num_channels; c++) {
-      for (int64_t y = 0; y < output_height; ++y) {
-        auto in_y = y_original[narrow<size_t>(y)];
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, narrow<std::ptrdiff_t>(num_channels),
+        [&](std::ptrdiff_t c) {
+          const T* Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
+          T* Ydata = YdataBase + (n * num_channels + c) * (output_height * output_width);
+
+          // Cache of 1-D interpolation results, keyed by the x coefficient set. Each channel keeps
+          // its own cache so worker threads never share mutable state; the cubic_coeffs table
+          // built above is only read from here on.
+          std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
+
+          // temp arrays to hold coefficients when exclude_outside is set to true
+          std::array<float, CubicModeGridLength> y_coeff_holder;
+          std::array<float, CubicModeGridLength> x_coeff_holder;
+          float y_coeff_sum = 1;
+          float x_coeff_sum = 1;
+
+          for (int64_t y = 0; y < output_height; ++y) {
+            auto in_y = y_original[narrow<size_t>(y)];
+
+            // when use_extrapolation is set and original index is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
+              for (int64_t x = 0; x < output_width; ++x) {
+                Ydata[y * output_width + x] = extrapolation_value;
+              }
+              continue;
+            }
 
-        // when use_extrapolation is set and original index is out of the dim range
-        // then use extrapolation_value as the output value.
-        if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
-          for (int64_t x = 0; x < output_width; ++x) {
-            Ydata[y * output_width + x] = extrapolation_value;
-          }
-          continue;
-        }
+            auto y_int = static_cast<int64_t>(std::floor(in_y));
+            auto& coeff_y = exclude_outside ? y_coeff_holder : cubic_coeffs.find(in_y - y_int)->second;
+            y_coeff_sum = 1;
+
+            if (exclude_outside) {
+              // When true, the weight of sampling locations outside the grid will be set to 0
+              // and the weight will be renormalized so that their sum is 1.0
+              y_coeff_sum = 0;
+              auto& orig_y_coeffs = cubic_coeffs.find(in_y - y_int)->second;
+              for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
+                y_coeff_holder[narrow<size_t>(i)] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[narrow<size_t>(i)];
+                y_coeff_sum += y_coeff_holder[narrow<size_t>(i)];
+              }
+            }
 
-        auto y_int = static_cast<int64_t>(std::floor(in_y));
-        auto& coeff_y = exclude_outside ? y_coeff_holder : cubic_coeffs[in_y - y_int];
-        y_coeff_sum = 1;
-
-        if (exclude_outside) {
-          // When true, the weight of sampling locations outside the grid will be set to 0
-          // and the weight will be renormalized so that their sum is 1.0
-          y_coeff_sum = 0;
-          auto& orig_y_coeffs = cubic_coeffs[in_y - y_int];
-          for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
-            y_coeff_holder[narrow<size_t>(i)] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[narrow<size_t>(i)];
-            y_coeff_sum += y_coeff_holder[narrow<size_t>(i)];
-          }
-        }
+            for (int64_t x = 0; x < output_width; ++x) {
+              auto in_x = x_original[narrow<size_t>(x)];
+
+              // when use_extrapolation is set and original index is out of the dim range
+              // then use extrapolation_value as the output value.
+              if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
+                Ydata[y * output_width + x] = extrapolation_value;
+                continue;
+              }
 
-        for (int64_t x = 0; x < output_width; ++x) {
-          auto in_x = x_original[narrow<size_t>(x)];
+              auto x_int = static_cast<int64_t>(std::floor(in_x));
+              auto s_x = static_cast<float>(in_x - x_int);
+              auto& coeff_x = exclude_outside ? x_coeff_holder : cubic_coeffs.find(s_x)->second;
+              x_coeff_sum = 1;
+
+              if (exclude_outside) {
+                // When true, the weight of sampling locations outside the grid will be set to 0
+                // and the weight will be renormalized so that their sum is 1.0
+                x_coeff_sum = 0;
+                auto& orig_x_coeff = cubic_coeffs.find(s_x)->second;
+                for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
+                  x_coeff_holder[narrow<size_t>(i)] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[narrow<size_t>(i)];
+                  x_coeff_sum += x_coeff_holder[narrow<size_t>(i)];
+                }
+              }
 
-          // when use_extrapolation is set and original index is out of the dim range
-          // then use extrapolation_value as the output value.
-          if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
-            Ydata[y * output_width + x] = extrapolation_value;
-            continue;
-          }
+              // Compute cubic interpolation in x dimension using the x coefficients.
+              // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
+              auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
+              float result = 0;
+              for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
+                auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
+                                                                   input_height, input_width, coeff_x, x_coeff_sum,
+                                                                   interpolation_result_cache);
+                result += x_interpolation_result * coeff_y[narrow<size_t>(i)] / y_coeff_sum;
+              }
 
-          auto x_int = static_cast<int64_t>(std::floor(in_x));
-          auto s_x = static_cast<float>(in_x - x_int);
-          auto& coeff_x = exclude_outside ? x_coeff_holder : cubic_coeffs[s_x];
-          x_coeff_sum = 1;
-
-          if (exclude_outside) {
-            // When true, the weight of sampling locations outside the grid will be set to 0
-            // and the weight will be renormalized so that their sum is 1.0
-            x_coeff_sum = 0;
-            auto& orig_x_coeff = cubic_coeffs[s_x];
-            for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
-              x_coeff_holder[narrow<size_t>(i)] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[narrow<size_t>(i)];
-              x_coeff_sum += x_coeff_holder[narrow<size_t>(i)];
+              Ydata[y * output_width + x] = static_cast<T>(result);
             }
           }
-
-          // Compute cubic interpolation in x dimension using the x coefficients.
-          // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
-          auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
-          float result = 0;
-          for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
-            auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
-                                                               input_height, input_width, coeff_x, x_coeff_sum,
-                                                               interpolation_result_cache);
-            result += x_interpolation_result * coeff_y[narrow<size_t>(i)] / y_coeff_sum;
-          }
-
-          Ydata[y * output_width + x] = static_cast<T>(result);
-        }
-      }
-
-      Xdata += input_height * input_width;
-      Ydata += output_height * output_width;
-
-      // clear the cache when moving to the next channel
-      coeff_to_1Dinterpolation_map.clear();
-    }
+        });
   }
 }
 #if defined(_MSC_VER)
@@ -1352,7 +1354,8 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
         ResizeBiCubic(batch_size, num_channels, input_height, input_width, output_height, output_width,
                       height_scale, width_scale, cubic_coeff_a_, use_extrapolation_,
                       extrapolation_value_, exclude_outside_, roi, X->Data<float>(),
-                      Y->MutableData<float>(), get_original_coordinate_);
+                      Y->MutableData<float>(), get_original_coordinate_,
+                      output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
       }
       return Status::OK();
     }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #ifndef SHARED_PROVIDER
 #include "core/framework/op_kernel.h"
@@ -102,33 +103,50 @@ void UpsampleBilinear(const int32_t batch_size,
                                            height_scale, width_scale, roi,
                                            alloc, get_original_coordinate, true);
   for (int32_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(
-        tp, num_channels,
-        [&](std::ptrdiff_t c) {
-          const T* const Xdata =
-              XdataBase + (n * num_channels + static_cast<int32_t>(c)) * (input_height * input_width);
-          T* const Ydata = YdataBase + (n * num_channels + static_cast<int32_t>(c)) * (output_height * output_width);
-          for (int32_t y = 0; y < output_height; ++y) {
+    // Parallelize across every output row of every channel rather than across channels only, so
+    // inputs with few channels still keep the whole pool busy. The row-invariant terms (the y
+    // extrapolation check, the two input row pointers and the y coefficient pair) are hoisted out
+    // of the inner loop, which then only reads the per-column tables and stays vectorizable.
+    concurrency::ThreadPool::TryParallelFor(
+        tp, static_cast<std::ptrdiff_t>(num_channels) * output_height,
+        static_cast<double>(output_width) * 2.0,
+        [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+          for (std::ptrdiff_t i = first; i < last; ++i) {
+            const int32_t c = static_cast<int32_t>(i / output_height);
+            const int32_t y = static_cast<int32_t>(i % output_height);
+            const T* const Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
+            T* const Ydata =
+                YdataBase + (n * num_channels + c) * (output_height * output_width) + output_width * y;
+
+            // when use_extrapolation is set and original index of x or y is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation &&
+                (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1))) {
+              std::fill_n(Ydata, output_width, static_cast<T>(extrapolation_value));
+              continue;
+            }
+
+            const T* const Xrow1 = Xdata + p.input_width_mul_y1[y];
+            const T* const Xrow2 = Xdata + p.input_width_mul_y2[y];
+            const float dy1 = p.dy1[y];
+            const float dy2 = p.dy2[y];
+
             for (int32_t x = 0; x < output_width; ++x) {
-              const int32_t output_offset = output_width * y + x;
-              // when use_extrapolation is set and original index of x or y is out of the dim range
-              // then use extrapolation_value as the output value.
               if (use_extrapolation &&
-                  ((p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
-                   (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
-                Ydata[output_offset] = static_cast<T>(extrapolation_value);
+                  (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1))) {
+                Ydata[x] = static_cast<T>(extrapolation_value);
                 continue;
               }
 
-              T X11 = Xdata[p.input_width_mul_y1[y] + p.in_x1[x]];
-              T X21 = Xdata[p.input_width_mul_y1[y] + p.in_x2[x]];
-              T X12 = Xdata[p.input_width_mul_y2[y] + p.in_x1[x]];
-              T X22 = Xdata[p.input_width_mul_y2[y] + p.in_x2[x]];
+              T X11 = Xrow1[p.in_x1[x]];
+              T X21 = Xrow1[p.in_x2[x]];
+              T X12 = Xrow2[p.in_x1[x]];
+              T X22 = Xrow2[p.in_x2[x]];
 
-              Ydata[output_offset] = static_cast<T>(p.dx2[x] * p.dy2[y] * X11 +
-                                                    p.dx1[x] * p.dy2[y] * X21 +
-                                                    p.dx2[x] * p.dy1[y] * X12 +
-                                                    p.dx1[x] * p.dy1[y] * X22);
+              Ydata[x] = static_cast<T>(p.dx2[x] * dy2 * X11 +
+                                        p.dx1[x] * dy2 * X21 +
+                                        p.dx2[x] * dy1 * X12 +
+                                        p.dx1[x] * dy1 * X22);
             }
           }
         });
@@ -435,6 +435,40 @@ const std::string default_locale("en_US.UTF-8");  // All non-MS and not Apple
 #endif
 
 #endif  // _MSC_VER
+
+// ASCII fast path. For ASCII-only strings, case conversion does not need the
+// UTF-8 -> wchar_t -> locale -> UTF-8 round trip with its per-string allocations;
+// it is a bytewise transform over the original buffer that compilers vectorize.
+
+inline bool IsAscii(const std::string& s) {
+  unsigned char acc = 0;
+  for (char c : s) {
+    acc |= static_cast<unsigned char>(c);
+  }
+  return (acc & 0x80) == 0;
+}
+
+inline void ChangeCaseAscii(StringNormalizer::CaseAction caseaction, std::string& s) {
+  assert(caseaction != StringNormalizer::NONE);
+  if (caseaction == StringNormalizer::LOWER) {
+    for (char& c : s) {
+      c = (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+  } else {
+    for (char& c : s) {
+      c = (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+    }
+  }
+}
+
+// The bytewise transform must match what the locale would produce for ASCII input.
+// That holds for the default/English/C locales but not in general (e.g. tr_TR maps
+// 'I' to a dotless lowercase i), so the fast path is gated on the locale name.
+inline bool LocaleSupportsAsciiFastPath(const std::string& locale_name) {
+  return locale_name.empty() || locale_name == "C" || locale_name == "POSIX" ||
+         locale_name.compare(0, 5, "en_US") == 0 || locale_name.compare(0, 5, "en-US") == 0;
+}
+
 }  // namespace string_normalizer
 
 using namespace string_normalizer;
@@ -459,6 +493,7 @@ StringNormalizer::StringNormalizer(const OpKernelInfo& info) : OpKernel(info) {
   }
 
   locale_name_ = info.GetAttrOrDefault("locale", default_locale);
+  ascii_case_fast_path_ = LocaleSupportsAsciiFastPath(locale_name_);
 
   std::vector<std::string> stop_words = info.GetAttrsOrDefault<std::string>("stopwords");
   if (is_case_sensitive_) {
@@ -471,6 +506,11 @@ StringNormalizer::StringNormalizer(const OpKernelInfo& info) : OpKernel(info) {
     Utf8Converter converter;
     wstopwords_.reserve(stop_words.size());
     for (std::string& s : stop_words) {
+      if (ascii_case_fast_path_ && IsAscii(s)) {
+        std::string cased = s;
+        ChangeCaseAscii(compare_caseaction_, cased);
+        ascii_cmp_stopwords_.insert(std::move(cased));
+      }
       std::wstring wstr = converter.from_bytes(s);
       locale.ChangeCase(compare_caseaction_, wstr);
       wstopwords_.insert(std::move(wstr));
@@ -525,9 +565,13 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
   Locale locale(locale_name_);
   Utf8Converter converter;
 
-  // Compute the largest widestring buffer needed.
+  // Compute the largest widestring buffer needed. ASCII-only strings never go through
+  // the wide-char conversion when the fast path is available (ASCII is always valid UTF-8).
   size_t max_wide_buffer_len = 0;
   for (const auto& s : input_span) {
+    if (ascii_case_fast_path_ && IsAscii(s)) {
+      continue;
+    }
     size_t wchars = 0;
     // Checks for invalid UTF-8 characters on Windows
     ORT_RETURN_IF_ERROR(converter.ComputeRequiredSizeToWideChar(s, wchars));
@@ -537,6 +581,7 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
   // Reuse reserved space
   std::wstring wchar_buffer;
   wchar_buffer.reserve(max_wide_buffer_len);
+  std::string ascii_buffer;
 
   // Output everything and change case as required
   auto output_no_filtering = [&](const TensorShape& output_shape) {
@@ -544,11 +589,17 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
     auto const output_data = output_tensor->MutableData<std::string>();
     for (size_t i = 0, lim = input_span.size(); i < lim; ++i) {
       const std::string& s = input_span[i];
+      auto& dest = output_data[i];
+      if (ascii_case_fast_path_ && IsAscii(s)) {
+        dest = s;
+        ChangeCaseAscii(case_change_action_, dest);
+        continue;
+      }
+
       wchar_buffer.resize(max_wide_buffer_len);
       ORT_RETURN_IF_ERROR(converter.ConvertToWideChar(s, wchar_buffer));
       locale.ChangeCase(case_change_action_, wchar_buffer);
 
-      auto& dest = output_data[i];
       size_t utf8_buffer_len = converter.ComputeRequiredSizeToUtf8(wchar_buffer);
       dest.resize(utf8_buffer_len);
       ORT_RETURN_IF_ERROR(converter.ConvertToUtf8(wchar_buffer, dest));
@@ -562,6 +613,13 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
     for (size_t i : filtered_indices) {
       const std::string& s = input_span[i];
       if (case_change_action_ != NONE) {
+        if (ascii_case_fast_path_ && IsAscii(s)) {
+          auto& dest = *output_data++;
+          dest = s;
+          ChangeCaseAscii(case_change_action_, dest);
+          continue;
+        }
+
         wchar_buffer.resize(max_wide_buffer_len);
         ORT_RETURN_IF_ERROR(converter.ConvertToWideChar(s, wchar_buffer));
         locale.ChangeCase(case_change_action_, wchar_buffer);
@@ -615,6 +673,17 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
       filtered_strings_indices.reserve(input_span.size());
       for (size_t i = 0, lim = input_span.size(); i < lim; ++i) {
         const std::string& s = input_span[i];
+        if (ascii_case_fast_path_ && IsAscii(s)) {
+          // A non-ASCII stopword can never match an ASCII string, so the ASCII subset
+          // of the stopwords is sufficient here.
+          ascii_buffer.assign(s);
+          ChangeCaseAscii(compare_caseaction_, ascii_buffer);
+          if (ascii_cmp_stopwords_.count(ascii_buffer) == 0) {
+            filtered_strings_indices.push_back(i);
+          }
+          continue;
+        }
+
         wchar_buffer.resize(max_wide_buffer_len);
         ORT_RETURN_IF_ERROR(converter.ConvertToWideChar(s, wchar_buffer));
         locale.ChangeCase(compare_caseaction_, wchar_buffer);
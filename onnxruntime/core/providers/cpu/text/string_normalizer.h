@@ -31,9 +31,15 @@ class StringNormalizer : public OpKernel {
   // used for case-insensitive compare
   CaseAction compare_caseaction_{LOWER};
   std::string locale_name_;
+  // True when the locale's case mapping agrees with ASCII for ASCII input, so ASCII-only
+  // strings can be case converted bytewise without the UTF-8 <-> wchar_t round trip.
+  bool ascii_case_fast_path_{false};
   // Either if these are populated but not both
   InlinedHashSet<std::string> stopwords_;
   InlinedHashSet<std::wstring> wstopwords_;
+  // ASCII members of wstopwords_, pre-cased with compare_caseaction_, so ASCII inputs can be
+  // filtered without conversion. Only populated when ascii_case_fast_path_ is true.
+  InlinedHashSet<std::string> ascii_cmp_stopwords_;
 };
 
 }  // namespace onnxruntime
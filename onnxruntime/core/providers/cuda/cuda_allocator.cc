@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <limits>
+
 #include "cuda_allocator.h"
 #include "cuda_common.h"
 #include "gpu_data_transfer.h"
@@ -55,6 +57,46 @@ void CUDAAllocator::Free(void* p) {
   cudaFree(p);         // do not throw error since it's OK for cudaFree to fail during shutdown
 }
 
+CUDAManagedAllocator::CUDAManagedAllocator(OrtDevice::DeviceId device_id, const char* name)
+    : CUDAAllocator(device_id, name) {
+  SetDevice(true);
+
+  int managed_memory_supported = 0;
+  CUDA_CALL_THROW(cudaDeviceGetAttribute(&managed_memory_supported, cudaDevAttrManagedMemory, device_id));
+  ORT_ENFORCE(managed_memory_supported != 0,
+              "Managed memory was requested but device ", device_id, " does not support it.");
+}
+
+void* CUDAManagedAllocator::Alloc(size_t size) {
+  SetDevice(true);
+  CheckDevice(true);
+  void* p = nullptr;
+  if (size > 0) {
+    CUDA_CALL_THROW(cudaMallocManaged(&p, size));
+
+    // Keep pages on the device while there is room; under memory pressure the driver evicts
+    // them to host and migrates them back on access. The hints (and the eager prefetch) need
+    // concurrent managed access, which is not available on every platform - without it the
+    // plain managed allocation still works, only the placement is left to the driver.
+    const int device_id = Info().id;
+    int concurrent_managed_access = 0;
+    if (cudaDeviceGetAttribute(&concurrent_managed_access, cudaDevAttrConcurrentManagedAccess,
+                               device_id) == cudaSuccess &&
+        concurrent_managed_access != 0) {
+      CUDA_CALL_THROW(cudaMemAdvise(p, size, cudaMemAdviseSetPreferredLocation, device_id));
+      CUDA_CALL_THROW(cudaMemAdvise(p, size, cudaMemAdviseSetAccessedBy, device_id));
+      CUDA_CALL_THROW(cudaMemPrefetchAsync(p, size, device_id, nullptr));
+    }
+  }
+  return p;
+}
+
+void CUDAManagedAllocator::Free(void* p) {
+  SetDevice(false);
+  CheckDevice(false);  // ignore CUDA failure when free
+  cudaFree(p);         // do not throw error since it's OK for cudaFree to fail during shutdown
+}
+
 void* CUDAExternalAllocator::Alloc(size_t size) {
   void* p = nullptr;
   if (size > 0) {
@@ -86,6 +128,73 @@ void* CUDAExternalAllocator::Reserve(size_t size) {
   return p;
 }
 
+CUDAAsyncAllocator::CUDAAsyncAllocator(OrtDevice::DeviceId device_id, const char* name,
+                                       size_t release_threshold_bytes)
+    : CUDAAllocator(device_id, name) {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  SetDevice(true);
+
+  int mem_pools_supported = 0;
+  CUDA_CALL_THROW(cudaDeviceGetAttribute(&mem_pools_supported, cudaDevAttrMemoryPoolsSupported, device_id));
+  ORT_ENFORCE(mem_pools_supported != 0,
+              "cudaMallocAsync was requested but device ", device_id, " does not support CUDA memory pools.");
+
+  cudaStream_t stream = nullptr;
+  CUDA_CALL_THROW(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  stream_ = stream;
+
+  // Let the pool cache freed memory up to the configured limit. Anything beyond the threshold
+  // is returned to the driver at stream synchronization points, where other consumers of the
+  // device pool can pick it up.
+  if (release_threshold_bytes != std::numeric_limits<size_t>::max()) {
+    cudaMemPool_t pool = nullptr;
+    CUDA_CALL_THROW(cudaDeviceGetDefaultMemPool(&pool, device_id));
+    uint64_t threshold = release_threshold_bytes;
+    CUDA_CALL_THROW(cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &threshold));
+  }
+#else
+  ORT_UNUSED_PARAMETER(release_threshold_bytes);
+  ORT_THROW("cudaMallocAsync requires building with CUDA 11.2 or later.");
+#endif
+}
+
+CUDAAsyncAllocator::~CUDAAsyncAllocator() {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  if (stream_ != nullptr) {
+    cudaStreamDestroy(static_cast<cudaStream_t>(stream_));  // ignore failure during shutdown
+  }
+#endif
+}
+
+void* CUDAAsyncAllocator::Alloc(size_t size) {
+  void* p = nullptr;
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  SetDevice(true);
+  CheckDevice(true);
+  if (size > 0) {
+    CUDA_CALL_THROW(cudaMallocAsync(&p, size, static_cast<cudaStream_t>(stream_)));
+    // make the pointer usable on every stream. the arena on top hands pieces of this
+    // region to arbitrary streams, so the allocation must be complete before it is used.
+    CUDA_CALL_THROW(cudaStreamSynchronize(static_cast<cudaStream_t>(stream_)));
+  }
+#else
+  ORT_UNUSED_PARAMETER(size);
+#endif
+  return p;
+}
+
+void CUDAAsyncAllocator::Free(void* p) {
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 11020
+  SetDevice(false);
+  CheckDevice(false);  // ignore CUDA failure when free
+  if (p != nullptr) {
+    cudaFreeAsync(p, static_cast<cudaStream_t>(stream_));  // do not throw error since it's OK to fail during shutdown
+  }
+#else
+  ORT_UNUSED_PARAMETER(p);
+#endif
+}
+
 void* CUDAPinnedAllocator::Alloc(size_t size) {
   void* p = nullptr;
   if (size > 0) {
@@ -19,11 +19,44 @@ class CUDAAllocator : public IAllocator {
   void* Alloc(size_t size) override;
   void Free(void* p) override;
 
- private:
+ protected:
   void CheckDevice(bool throw_when_fail) const;
   void SetDevice(bool throw_when_fail) const;
 };
 
+// Device allocator backed by cudaMallocAsync/cudaFreeAsync against the device's default
+// CUDA memory pool. Unlike cudaMalloc, allocation and release are stream-ordered and do not
+// serialize the device, and freed memory goes back to a pool that is shared dynamically by
+// every allocator on the device instead of staying reserved by this session.
+// Intended to back the BFC arena, which keeps handing out sub-allocations with per-stream
+// safety; the arena only calls Free when a region is released (e.g. arena shrinkage between
+// runs, after the session's streams have been synchronized).
+class CUDAAsyncAllocator : public CUDAAllocator {
+ public:
+  CUDAAsyncAllocator(OrtDevice::DeviceId device_id, const char* name, size_t release_threshold_bytes);
+  ~CUDAAsyncAllocator();
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+ private:
+  // cudaStream_t. kept opaque so this header stays free of CUDA runtime headers.
+  void* stream_{nullptr};
+};
+
+// Device allocator backed by cudaMallocManaged. Managed (unified) memory lets the driver page
+// allocations between device and host on demand, so when device memory is oversubscribed cold
+// pages (e.g. the KV cache of idle requests) spill to host and fault back on access instead of
+// the allocation failing outright. New regions are advised to prefer the device and prefetched
+// there, so while the working set fits, behavior matches plain device memory.
+class CUDAManagedAllocator : public CUDAAllocator {
+ public:
+  CUDAManagedAllocator(OrtDevice::DeviceId device_id, const char* name);
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+};
+
 class CUDAExternalAllocator : public CUDAAllocator {
   typedef void* (*ExternalAlloc)(size_t size);
   typedef void (*ExternalFree)(void* p);
@@ -137,7 +137,12 @@ AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId devi
                                                         size_t gpu_mem_limit,
                                                         ArenaExtendStrategy arena_extend_strategy,
                                                         CUDAExecutionProviderExternalAllocatorInfo external_allocator_info,
-                                                        const OrtArenaCfg* default_memory_arena_cfg) {
+                                                        const OrtArenaCfg* default_memory_arena_cfg,
+                                                        bool use_cuda_malloc_async,
+                                                        bool prefer_managed_memory) {
+  ORT_ENFORCE(!(use_cuda_malloc_async && prefer_managed_memory),
+              "use_cuda_malloc_async and prefer_managed_memory are mutually exclusive.");
+
   if (external_allocator_info.UseExternalAllocator()) {
     AllocatorCreationInfo default_memory_info(
         [external_allocator_info](OrtDevice::DeviceId id) {
@@ -152,7 +157,18 @@ AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId devi
     return CreateAllocator(default_memory_info);
   } else {
     AllocatorCreationInfo default_memory_info(
-        [](OrtDevice::DeviceId id) {
+        [use_cuda_malloc_async, prefer_managed_memory, gpu_mem_limit](OrtDevice::DeviceId id) -> std::unique_ptr<IAllocator> {
+          if (use_cuda_malloc_async) {
+            // stream-ordered allocations from the device's shared memory pool. the arena still
+            // provides sub-allocation and per-stream reuse on top, but regions it releases go
+            // back to a pool other sessions draw from instead of staying reserved.
+            return std::make_unique<CUDAAsyncAllocator>(id, CUDA, gpu_mem_limit);
+          }
+          if (prefer_managed_memory) {
+            // pageable device memory: oversubscribed regions spill to host instead of failing,
+            // at the cost of migration overhead when they are touched again.
+            return std::make_unique<CUDAManagedAllocator>(id, CUDA);
+          }
           return std::make_unique<CUDAAllocator>(id, CUDA);
         },
         device_id,
@@ -2610,7 +2626,8 @@ std::vector<AllocatorPtr> CUDAExecutionProvider::CreatePreferredAllocators() {
       0);
   return std::vector<AllocatorPtr>{
       CreateCudaAllocator(info_.device_id, info_.gpu_mem_limit, info_.arena_extend_strategy,
-                          info_.external_allocator_info, info_.default_memory_arena_cfg),
+                          info_.external_allocator_info, info_.default_memory_arena_cfg,
+                          info_.use_cuda_malloc_async, info_.prefer_managed_memory),
       CreateAllocator(pinned_memory_info),
   };
 }
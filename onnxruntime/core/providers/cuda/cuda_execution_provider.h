@@ -85,7 +85,9 @@ class CUDAExecutionProvider : public IExecutionProvider {
   }
 
   static AllocatorPtr CreateCudaAllocator(OrtDevice::DeviceId device_id, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy,
-                                          CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, const OrtArenaCfg* arena_cfg);
+                                          CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, const OrtArenaCfg* arena_cfg,
+                                          bool use_cuda_malloc_async = false,
+                                          bool prefer_managed_memory = false);
 
   ITuningContext* GetTuningContext() const override;
 
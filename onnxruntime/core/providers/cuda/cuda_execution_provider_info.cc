@@ -6,6 +6,10 @@
 #include "core/providers/cuda/cuda_execution_provider_info.h"
 #include "core/providers/cuda/cuda_provider_options.h"
 
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
 #include "core/common/make_string.h"
 #include "core/common/parse_string.h"
 #include "core/framework/provider_options_utils.h"
@@ -15,6 +19,7 @@ namespace onnxruntime {
 namespace cuda {
 namespace provider_option_names {
 constexpr const char* kDeviceId = "device_id";
+constexpr const char* kDeviceUuid = "device_uuid";
 constexpr const char* kHasUserComputeStream = "has_user_compute_stream";
 constexpr const char* kUserComputeStream = "user_compute_stream";
 constexpr const char* kMemLimit = "gpu_mem_limit";
@@ -33,6 +38,8 @@ constexpr const char* kTunableOpMaxTuningDurationMs = "tunable_op_max_tuning_dur
 constexpr const char* kEnableSkipLayerNormStrictMode = "enable_skip_layer_norm_strict_mode";
 constexpr const char* kPreferNHWCMode = "prefer_nhwc";
 constexpr const char* kUseEPLevelUnifiedStream = "use_ep_level_unified_stream";
+constexpr const char* kUseCudaMallocAsync = "use_cuda_malloc_async";
+constexpr const char* kPreferManagedMemory = "prefer_managed_memory";
 constexpr const char* kUseTF32 = "use_tf32";
 
 }  // namespace provider_option_names
@@ -49,6 +56,60 @@ const EnumNameMapping<ArenaExtendStrategy> arena_extend_strategy_mapping{
     {ArenaExtendStrategy::kSameAsRequested, "kSameAsRequested"},
 };
 
+std::string GetCudaDeviceUuid(int device_id) {
+  cudaDeviceProp prop;
+  CUDA_CALL_THROW(cudaGetDeviceProperties(&prop, device_id));
+  const auto* bytes = reinterpret_cast<const unsigned char*>(prop.uuid.bytes);
+  std::ostringstream uuid;
+  uuid << "GPU-" << std::hex << std::setfill('0');
+  for (int i = 0; i < 16; ++i) {
+    if (i == 4 || i == 6 || i == 8 || i == 10) {
+      uuid << '-';
+    }
+    uuid << std::setw(2) << static_cast<int>(bytes[i]);
+  }
+  return uuid.str();
+}
+
+namespace {
+
+// Keep only lower-cased hex digits so "GPU-1A2B..." and "MIG-1a2b..." compare equal to
+// the runtime-reported UUID regardless of prefix, case or dash placement.
+std::string NormalizeDeviceUuid(const std::string& uuid) {
+  std::string normalized;
+  normalized.reserve(uuid.size());
+  for (char c : uuid) {
+    if (std::isxdigit(static_cast<unsigned char>(c))) {
+      normalized.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+  }
+  return normalized;
+}
+
+Status ResolveDeviceUuid(CUDAExecutionProviderInfo& info) {
+  const std::string target = NormalizeDeviceUuid(info.device_uuid);
+  ORT_RETURN_IF(target.empty(), "Invalid device UUID: ", info.device_uuid);
+
+  int num_devices{};
+  CUDA_RETURN_IF_ERROR(cudaGetDeviceCount(&num_devices));
+
+  std::ostringstream visible_uuids;
+  for (int device_id = 0; device_id < num_devices; ++device_id) {
+    const std::string uuid = GetCudaDeviceUuid(device_id);
+    if (NormalizeDeviceUuid(uuid) == target) {
+      info.device_id = static_cast<OrtDevice::DeviceId>(device_id);
+      return Status::OK();
+    }
+    visible_uuids << (device_id == 0 ? "" : ", ") << uuid;
+  }
+
+  return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                         "No visible CUDA device with UUID ", info.device_uuid,
+                         ". Visible devices: ", visible_uuids.str());
+}
+
+}  // namespace
+
 CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const ProviderOptions& options) {
   CUDAExecutionProviderInfo info{};
   void* alloc = nullptr;
@@ -69,6 +130,7 @@ CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const P
                     ", must be between 0 (inclusive) and ", num_devices, " (exclusive).");
                 return Status::OK();
               })
+          .AddAssignmentToReference(cuda::provider_option_names::kDeviceUuid, info.device_uuid)
           .AddAssignmentToReference(cuda::provider_option_names::kHasUserComputeStream, info.has_user_compute_stream)
           .AddValueParser(
               cuda::provider_option_names::kUserComputeStream,
@@ -116,6 +178,8 @@ CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const P
           .AddAssignmentToReference(cuda::provider_option_names::kEnableSkipLayerNormStrictMode, info.enable_skip_layer_norm_strict_mode)
           .AddAssignmentToReference(cuda::provider_option_names::kPreferNHWCMode, info.prefer_nhwc)
           .AddAssignmentToReference(cuda::provider_option_names::kUseEPLevelUnifiedStream, info.use_ep_level_unified_stream)
+          .AddAssignmentToReference(cuda::provider_option_names::kUseCudaMallocAsync, info.use_cuda_malloc_async)
+          .AddAssignmentToReference(cuda::provider_option_names::kPreferManagedMemory, info.prefer_managed_memory)
           .AddAssignmentToReference(cuda::provider_option_names::kUseTF32, info.use_tf32)
           .AddValueParser(
               cuda::provider_option_names::kTunableOpEnable,
@@ -137,6 +201,11 @@ CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const P
               })
           .Parse(options));
 
+  // Resolve after parsing so the UUID wins regardless of option order.
+  if (!info.device_uuid.empty()) {
+    ORT_THROW_IF_ERROR(ResolveDeviceUuid(info));
+  }
+
   CUDAExecutionProviderExternalAllocatorInfo alloc_info{alloc, free, empty_cache};
   info.external_allocator_info = alloc_info;
 
@@ -149,6 +218,7 @@ CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const P
 ProviderOptions CUDAExecutionProviderInfo::ToProviderOptions(const CUDAExecutionProviderInfo& info) {
   const ProviderOptions options{
       {cuda::provider_option_names::kDeviceId, MakeStringWithClassicLocale(info.device_id)},
+      {cuda::provider_option_names::kDeviceUuid, info.device_uuid},
       {cuda::provider_option_names::kHasUserComputeStream, MakeStringWithClassicLocale(info.has_user_compute_stream)},
       {cuda::provider_option_names::kUserComputeStream, MakeStringWithClassicLocale(reinterpret_cast<size_t>(info.user_compute_stream))},
       {cuda::provider_option_names::kMemLimit, MakeStringWithClassicLocale(info.gpu_mem_limit)},
@@ -169,6 +239,8 @@ ProviderOptions CUDAExecutionProviderInfo::ToProviderOptions(const CUDAExecution
       {cuda::provider_option_names::kEnableSkipLayerNormStrictMode, MakeStringWithClassicLocale(info.enable_skip_layer_norm_strict_mode)},
       {cuda::provider_option_names::kPreferNHWCMode, MakeStringWithClassicLocale(info.prefer_nhwc)},
       {cuda::provider_option_names::kUseEPLevelUnifiedStream, MakeStringWithClassicLocale(info.use_ep_level_unified_stream)},
+      {cuda::provider_option_names::kUseCudaMallocAsync, MakeStringWithClassicLocale(info.use_cuda_malloc_async)},
+      {cuda::provider_option_names::kPreferManagedMemory, MakeStringWithClassicLocale(info.prefer_managed_memory)},
       {cuda::provider_option_names::kUseTF32, MakeStringWithClassicLocale(info.use_tf32)},
   };
 
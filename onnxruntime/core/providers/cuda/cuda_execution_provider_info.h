@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <limits>
+#include <string>
 
 #include "core/common/hash_combine.h"
 #include "core/framework/arena_extend_strategy.h"
@@ -47,6 +48,13 @@ struct TunableOpInfo {
 
 struct CUDAExecutionProviderInfo {
   OrtDevice::DeviceId device_id{0};
+
+  // Canonical UUID ("GPU-..." or "MIG-...") of the device to run on. Unlike ordinals,
+  // UUIDs are stable regardless of how CUDA_VISIBLE_DEVICES maps devices into the
+  // process, so orchestrators can pin sessions to a specific GPU or MIG slice
+  // deterministically. When set, it is resolved against the visible devices and takes
+  // precedence over device_id.
+  std::string device_uuid{};
   size_t gpu_mem_limit{std::numeric_limits<size_t>::max()};                         // Will be over-ridden by contents of `default_memory_arena_cfg` (if specified)
   ArenaExtendStrategy arena_extend_strategy{ArenaExtendStrategy::kNextPowerOfTwo};  // Will be over-ridden by contents of `default_memory_arena_cfg` (if specified)
   OrtCudnnConvAlgoSearch cudnn_conv_algo_search{OrtCudnnConvAlgoSearchExhaustive};
@@ -76,6 +84,17 @@ struct CUDAExecutionProviderInfo {
 
   bool use_ep_level_unified_stream{false};
 
+  // Back the device arena with cudaMallocAsync/cudaFreeAsync on the device's default memory pool
+  // instead of cudaMalloc/cudaFree, so memory released by arena shrinkage is shared dynamically
+  // with other sessions on the GPU. Requires CUDA 11.2+ and device support for memory pools.
+  bool use_cuda_malloc_async{false};
+
+  // Back the device arena with cudaMallocManaged so that allocations can be oversubscribed:
+  // under memory pressure the driver pages cold data out to host and migrates it back on
+  // access, trading throughput for not failing with an out-of-memory error during load spikes.
+  // Mutually exclusive with use_cuda_malloc_async.
+  bool prefer_managed_memory{false};
+
   // By default, enable TF32 to speed up float GEMM/MatMul or cuDNN convolution of float matrices.
   bool use_tf32{true};
 
@@ -83,6 +102,13 @@ struct CUDAExecutionProviderInfo {
   static ProviderOptions ToProviderOptions(const CUDAExecutionProviderInfo& info);
   static ProviderOptions ToProviderOptions(const OrtCUDAProviderOptionsV2& info);
 };
+
+// Canonical "GPU-xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" UUID of a visible CUDA device
+// as reported by the runtime. For a MIG slice exposed through CUDA_VISIBLE_DEVICES
+// this identifies the slice, and the string can be passed back as the "device_uuid"
+// provider option.
+std::string GetCudaDeviceUuid(int device_id);
+
 }  // namespace onnxruntime
 
 template <>
@@ -104,9 +130,13 @@ struct std::hash<::onnxruntime::CUDAExecutionProviderInfo> {
                   (static_cast<size_t>(info.enable_skip_layer_norm_strict_mode) << 27) ^
                   (static_cast<size_t>(info.prefer_nhwc) << 28) ^
                   (static_cast<size_t>(info.use_ep_level_unified_stream) << 29) ^
-                  (static_cast<size_t>(info.use_tf32) << 30);
+                  (static_cast<size_t>(info.use_tf32) << 30) ^
+                  (static_cast<size_t>(info.use_cuda_malloc_async) << 31);
     onnxruntime::HashCombine(data, value);
 
+    onnxruntime::HashCombine(static_cast<size_t>(info.prefer_managed_memory), value);
+
+    onnxruntime::HashCombine(info.device_uuid, value);
     onnxruntime::HashCombine(info.gpu_mem_limit, value);
     onnxruntime::HashCombine(info.tunable_op.max_tuning_duration_ms, value);
 
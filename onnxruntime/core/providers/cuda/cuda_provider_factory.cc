@@ -158,6 +158,37 @@ struct ProviderInfo_CUDA_Impl final : ProviderInfo_CUDA {
     return num_devices;
   }
 
+  Status GetDeviceCapacities(std::vector<CudaDeviceCapacity>& capacities) override {
+    int num_devices = 0;
+    ORT_RETURN_IF_ERROR(CUDA_CALL(::cudaGetDeviceCount(&num_devices)));
+    capacities.clear();
+    capacities.reserve(num_devices);
+    for (int device_id = 0; device_id < num_devices; ++device_id) {
+      cudaDeviceProp prop;
+      ORT_RETURN_IF_ERROR(CUDA_CALL(cudaGetDeviceProperties(&prop, device_id)));
+      CudaDeviceCapacity capacity;
+      capacity.device_id = device_id;
+      capacity.uuid = GetCudaDeviceUuid(device_id);
+      capacity.name = prop.name;
+      capacity.total_memory_bytes = prop.totalGlobalMem;
+      capacity.multiprocessor_count = prop.multiProcessorCount;
+      capacities.push_back(std::move(capacity));
+    }
+    return Status::OK();
+  }
+
+  Status MakeStreamWaitOnDefaultStream(void* consumer_stream) override {
+    cudaEvent_t event;
+    ORT_RETURN_IF_ERROR(CUDA_CALL(cudaEventCreateWithFlags(&event, cudaEventDisableTiming)));
+    Status status = CUDA_CALL(cudaEventRecord(event, cudaStreamLegacy));
+    if (status.IsOK()) {
+      status = CUDA_CALL(cudaStreamWaitEvent(static_cast<cudaStream_t>(consumer_stream), event, 0));
+    }
+    // destruction is deferred by the runtime until the recorded work and the enqueued wait complete
+    ORT_RETURN_IF_ERROR(CUDA_CALL(cudaEventDestroy(event)));
+    return status;
+  }
+
   void CUDAExecutionProviderInfo__FromProviderOptions(const ProviderOptions& options, CUDAExecutionProviderInfo& info) override {
     info = CUDAExecutionProviderInfo::FromProviderOptions(options);
   }
@@ -1,6 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <string>
+#include <vector>
+
 #include "onnxruntime_c_api.h"
 #include "core/framework/provider_options.h"
 #include "core/common/common.h"
@@ -20,6 +23,18 @@ namespace profile {
 class NvtxRangeCreator;
 }
 
+// Static capacity of one visible CUDA device, for placement decisions. When MIG
+// slices are exposed through CUDA_VISIBLE_DEVICES each slice shows up as its own
+// device with the memory and SM budget of that slice; uuid can be passed back as the
+// "device_uuid" provider option to pin a session to the device deterministically.
+struct CudaDeviceCapacity {
+  int device_id;
+  std::string uuid;
+  std::string name;
+  size_t total_memory_bytes;
+  int multiprocessor_count;
+};
+
 struct ProviderInfo_CUDA {
   virtual OrtStatus* SetCurrentGpuDeviceId(_In_ int device_id) = 0;
   virtual OrtStatus* GetCurrentGpuDeviceId(_In_ int* device_id) = 0;
@@ -40,6 +55,12 @@ struct ProviderInfo_CUDA {
   virtual void cudaMemcpy_HostToDevice(void* dst, const void* src, size_t count) = 0;
   virtual void cudaMemcpy_DeviceToHost(void* dst, const void* src, size_t count) = 0;
   virtual int cudaGetDeviceCount() = 0;
+  virtual Status GetDeviceCapacities(std::vector<CudaDeviceCapacity>& capacities) = 0;
+  // Records an event capturing the work currently queued on the current device's legacy default
+  // stream and makes `consumer_stream` (a cudaStream_t) wait on it, without blocking the host.
+  // Used for DLPack-style tensor exchanges where the producer's completion point is the default
+  // stream.
+  virtual Status MakeStreamWaitOnDefaultStream(void* consumer_stream) = 0;
   virtual void CUDAExecutionProviderInfo__FromProviderOptions(const onnxruntime::ProviderOptions& options, onnxruntime::CUDAExecutionProviderInfo& info) = 0;
 
 #if defined(USE_CUDA) && defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P) && defined(ENABLE_TRAINING)
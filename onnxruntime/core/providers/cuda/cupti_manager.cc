@@ -3,7 +3,11 @@
 
 #include "cupti_manager.h"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
+
+#include <cuda_runtime.h>
 
 namespace onnxruntime {
 namespace profiling {
@@ -36,6 +40,49 @@ static inline std::string GetMemcpyKindString(CUpti_ActivityMemcpyKind kind) {
   return "<unknown>";
 }
 
+// Estimates the theoretical occupancy of a kernel launch (active warps per SM relative to the
+// hardware maximum) from the launch configuration and per-thread resource usage reported in the
+// activity record. This is the standard occupancy-calculator estimate; it ignores per-architecture
+// register/shared-memory allocation granularity, which is close enough to tell whether a kernel is
+// limited by block size, registers or shared memory. Returns a negative value if the estimate
+// cannot be computed.
+static float EstimateTheoreticalOccupancy(uint32_t device_id, const CUpti_ActivityKernel3& kernel) {
+  // ProcessActivityBuffers is serialized by the tracer manager, so a plain cache is safe here.
+  static std::unordered_map<uint32_t, cudaDeviceProp> device_props;
+  auto it = device_props.find(device_id);
+  if (it == device_props.end()) {
+    cudaDeviceProp prop;
+    if (cudaGetDeviceProperties(&prop, static_cast<int>(device_id)) != cudaSuccess) {
+      return -1.0f;
+    }
+    it = device_props.emplace(device_id, prop).first;
+  }
+  const cudaDeviceProp& prop = it->second;
+
+  const int64_t block_threads = static_cast<int64_t>(kernel.blockX) * kernel.blockY * kernel.blockZ;
+  if (block_threads <= 0 || prop.warpSize <= 0 || prop.maxThreadsPerMultiProcessor <= 0) {
+    return -1.0f;
+  }
+
+  const int64_t block_warps = (block_threads + prop.warpSize - 1) / prop.warpSize;
+  const int64_t max_warps_per_sm = prop.maxThreadsPerMultiProcessor / prop.warpSize;
+
+  int64_t blocks_per_sm = std::min<int64_t>(max_warps_per_sm / block_warps,
+                                            prop.maxBlocksPerMultiProcessor);
+  if (kernel.registersPerThread > 0) {
+    const int64_t block_regs = static_cast<int64_t>(kernel.registersPerThread) * block_warps * prop.warpSize;
+    blocks_per_sm = std::min<int64_t>(blocks_per_sm, prop.regsPerMultiprocessor / block_regs);
+  }
+  const int64_t block_shared_memory =
+      static_cast<int64_t>(kernel.staticSharedMemory) + kernel.dynamicSharedMemory;
+  if (block_shared_memory > 0) {
+    blocks_per_sm = std::min<int64_t>(blocks_per_sm,
+                                      static_cast<int64_t>(prop.sharedMemPerMultiprocessor) / block_shared_memory);
+  }
+
+  return static_cast<float>(blocks_per_sm * block_warps) / static_cast<float>(max_warps_per_sm);
+}
+
 CUPTIManager& CUPTIManager::GetInstance() {
   static CUPTIManager instance;
   return instance;
@@ -114,8 +161,16 @@ void CUPTIManager::ProcessActivityBuffers(const std::vector<ProfilerActivityBuff
               {"block_x", std::to_string(kernel->blockX)},
               {"block_y", std::to_string(kernel->blockY)},
               {"block_z", std::to_string(kernel->blockZ)},
+              {"registers_per_thread", std::to_string(kernel->registersPerThread)},
+              {"static_shared_memory", std::to_string(kernel->staticSharedMemory)},
+              {"dynamic_shared_memory", std::to_string(kernel->dynamicSharedMemory)},
           };
 
+          const float occupancy = EstimateTheoreticalOccupancy(kernel->deviceId, *kernel);
+          if (occupancy >= 0.0f) {
+            args.emplace("theoretical_occupancy", std::to_string(occupancy));
+          }
+
           std::string name{demangle(kernel->name)};
 
           new (&event) EventRecord{
@@ -138,7 +193,14 @@ void CUPTIManager::ProcessActivityBuffers(const std::vector<ProfilerActivityBuff
               {"block_x", "-1"},
               {"block_y", "-1"},
               {"block_z", "-1"},
+              {"bytes", std::to_string(mmcpy->bytes)},
           };
+          if (mmcpy->end > mmcpy->start) {
+            // bytes per nanosecond == GB/s, which makes it easy to spot copies that fall short
+            // of the link or device bandwidth.
+            args.emplace("achieved_bandwidth_gb_per_s",
+                         std::to_string(static_cast<double>(mmcpy->bytes) / (mmcpy->end - mmcpy->start)));
+          }
           new (&event) EventRecord{
               /* cat = */ EventCategory::KERNEL_EVENT,
               /* pid = */ -1,
@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cuda/generator/philox_cuda_state.h"
+
+#include <map>
+#include <utility>
+
+#include "core/framework/random_generator.h"
+#include "core/providers/cuda/cuda_common.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+namespace {
+
+// Device-resident offsets start in a counter region far above anything the host-side
+// generator hands out, so the counter ranges consumed by graph replays never collide
+// with the ranges consumed by regular (non-captured) launches.
+constexpr uint64_t kDeviceOffsetRegionStart = static_cast<uint64_t>(1) << 62;
+
+// Layout of the device buffer: slot 0 is the running offset, slot 1 is the snapshot
+// the next captured random kernel reads from.
+__global__ void InitPhiloxOffsetKernel(uint64_t* offset, uint64_t value) {
+  offset[0] = value;
+  offset[1] = value;
+}
+
+// Snapshots the running offset for the random kernel that is enqueued right after
+// this launch, then advances it. Both this kernel and the random kernel become part
+// of the captured graph, so the offset keeps moving across replays.
+__global__ void AdvancePhiloxOffsetKernel(uint64_t* offset, uint64_t count) {
+  offset[1] = offset[0];
+  offset[0] += count;
+}
+
+// One device offset per (generator, device) pair, shared by every kernel drawing
+// from that generator so replayed counter ranges stay sequential the same way
+// regular launches are. Entries live for the rest of the process; they are a few
+// bytes each and only created for generators that feed CUDA random kernels.
+uint64_t* GetDeviceOffset(const PhiloxGenerator& generator, cudaStream_t stream, bool create_if_missing) {
+  static OrtMutex mutex;
+  // Intentionally leaked so no cudaFree runs during CUDA runtime teardown.
+  static auto& offsets = *new std::map<std::pair<const PhiloxGenerator*, int>, uint64_t*>();
+
+  int device = -1;
+  CUDA_CALL_THROW(cudaGetDevice(&device));
+
+  std::lock_guard<OrtMutex> lock(mutex);
+  const auto key = std::make_pair(&generator, device);
+  auto it = offsets.find(key);
+  if (it != offsets.end()) {
+    return it->second;
+  }
+
+  if (!create_if_missing) {
+    return nullptr;
+  }
+
+  uint64_t* ptr = nullptr;
+  CUDA_CALL_THROW(cudaMalloc(&ptr, 2 * sizeof(uint64_t)));
+  InitPhiloxOffsetKernel<<<1, 1, 0, stream>>>(ptr, kDeviceOffsetRegionStart);
+  offsets.emplace(key, ptr);
+  return ptr;
+}
+
+}  // namespace
+
+PhiloxCudaState NextPhiloxCudaState(PhiloxGenerator& generator, uint64_t count, cudaStream_t stream) {
+  cudaStreamCaptureStatus capture_status = cudaStreamCaptureStatusNone;
+  CUDA_CALL_THROW(cudaStreamIsCapturing(stream, &capture_status));
+
+  PhiloxCudaState state;
+  auto seeds = generator.NextPhiloxSeeds(count);
+  state.seed = seeds.first;
+
+  if (capture_status == cudaStreamCaptureStatusNone) {
+    state.offset = seeds.second;
+    // Make sure the device-resident offset exists before any capture happens, which
+    // keeps the initializing launch out of any captured graph. The CUDA EP always
+    // performs regular runs before it starts capturing.
+    GetDeviceOffset(generator, stream, /*create_if_missing*/ true);
+    return state;
+  }
+
+  uint64_t* device_offset = GetDeviceOffset(generator, stream, /*create_if_missing*/ false);
+  ORT_ENFORCE(device_offset != nullptr,
+              "A random kernel must run once outside CUDA graph capture before it can be captured.");
+
+  // The random kernel reads the snapshot slot written by the advance launch below.
+  // Note the seed is still baked into the graph at capture time: resetting the seed
+  // requires capturing a new graph.
+  state.offset_ptr = device_offset + 1;
+  AdvancePhiloxOffsetKernel<<<1, 1, 0, stream>>>(device_offset, count);
+  return state;
+}
+
+}  // namespace cuda
+}  // namespace onnxruntime
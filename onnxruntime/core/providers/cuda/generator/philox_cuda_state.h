@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <cuda_runtime.h>
+
+namespace onnxruntime {
+
+class PhiloxGenerator;
+
+namespace cuda {
+
+/**
+ * Seed and counter offset for a curand Philox kernel launch. When offset_ptr is
+ * set, the launch was recorded during CUDA graph capture and the offset must be
+ * read from device memory at run time, so each graph replay consumes a fresh
+ * counter range instead of replaying the offset baked in at capture time.
+ */
+struct PhiloxCudaState {
+  uint64_t seed = 0;
+  uint64_t offset = 0;
+  const uint64_t* offset_ptr = nullptr;
+};
+
+/**
+ * Returns the state for a launch on `stream` that consumes `count` Philox counter
+ * values from `generator`. Outside graph capture this just forwards
+ * PhiloxGenerator::NextPhiloxSeeds. While `stream` is capturing it switches to a
+ * device-resident offset shared by all kernels drawing from `generator` and
+ * records a bookkeeping launch that advances it, which makes the captured graph
+ * safe to replay: every replay produces new random numbers.
+ */
+PhiloxCudaState NextPhiloxCudaState(PhiloxGenerator& generator, uint64_t count, cudaStream_t stream);
+
+}  // namespace cuda
+}  // namespace onnxruntime
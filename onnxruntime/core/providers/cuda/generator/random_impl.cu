@@ -6,6 +6,7 @@
 #include <curand_kernel.h>
 #include <algorithm>
 #include "core/providers/cuda/cu_inc/common.cuh"
+#include "core/providers/cuda/generator/philox_cuda_state.h"
 
 namespace onnxruntime {
 namespace cuda {
@@ -36,13 +37,15 @@ struct TransformFunc_RandomUniform {
 };
 
 template <typename T, typename DistFuncT, typename TransformFuncT>
-__global__ void RandomKernel(const int64_t N, const std::pair<uint64_t, uint64_t> seeds, const DistFuncT& dist_func,
+__global__ void RandomKernel(const int64_t N, const PhiloxCudaState philox_state, const DistFuncT& dist_func,
                              const TransformFuncT& transform_func, const float alpha, const float beta, T* Y_data) {
   CUDA_LONG idx = blockDim.x * blockIdx.x + threadIdx.x;
   CUDA_LONG step_size = gridDim.x * blockDim.x * UNROLL;
 
   curandStatePhilox4_32_10_t state;
-  curand_init(seeds.first, idx, seeds.second, &state);
+  const uint64_t philox_offset =
+      philox_state.offset_ptr != nullptr ? *philox_state.offset_ptr : philox_state.offset;
+  curand_init(philox_state.seed, idx, philox_offset, &state);
   float4 rand;
 
   // We ensure every thread generates the same number of random numbers (by rounding
@@ -68,14 +71,16 @@ __global__ void RandomKernel(const int64_t N, const std::pair<uint64_t, uint64_t
 }
 
 template <typename T, typename DistFuncT, typename TransformFuncT>
-__global__ void RandomVectorizedKernel(const int64_t N, const std::pair<uint64_t, uint64_t> seeds,
+__global__ void RandomVectorizedKernel(const int64_t N, const PhiloxCudaState philox_state,
                                        const DistFuncT& dist_func, const TransformFuncT& transform_func,
                                        const float alpha, const float beta, T* Y_data) {
   CUDA_LONG idx = blockDim.x * blockIdx.x + threadIdx.x;
   CUDA_LONG step_size = gridDim.x * blockDim.x * UNROLL;
 
   curandStatePhilox4_32_10_t state;
-  curand_init(seeds.first, idx, seeds.second, &state);
+  const uint64_t philox_offset =
+      philox_state.offset_ptr != nullptr ? *philox_state.offset_ptr : philox_state.offset;
+  curand_init(philox_state.seed, idx, philox_offset, &state);
   float4 rand;
 
   // Using vectorized data load/store approach when N % 4 == 0 since this is typical case for input shape size.
@@ -109,13 +114,13 @@ void RandomKernelImpl(const cudaDeviceProp& prop, cudaStream_t stream, const int
   // Compute the number of random numbers generated by each thread, and increment philox generator offset by that
   // amount.
   const uint64_t counter_offset = static_cast<uint64_t>(((N - 1) / (block_size * grid_size * UNROLL) + 1) * UNROLL);
-  auto seeds = generator.NextPhiloxSeeds(counter_offset);
+  auto philox_state = NextPhiloxCudaState(generator, counter_offset, stream);
 
   if (N % UNROLL != 0) {
-    RandomKernel<T><<<grid_size, block_size, 0, stream>>>(N, seeds, dist_func, transform_func, alpha, beta, Y_data);
+    RandomKernel<T><<<grid_size, block_size, 0, stream>>>(N, philox_state, dist_func, transform_func, alpha, beta, Y_data);
   } else {
     RandomVectorizedKernel<T>
-        <<<grid_size, block_size, 0, stream>>>(N, seeds, dist_func, transform_func, alpha, beta, Y_data);
+        <<<grid_size, block_size, 0, stream>>>(N, philox_state, dist_func, transform_func, alpha, beta, Y_data);
   }
 }
 
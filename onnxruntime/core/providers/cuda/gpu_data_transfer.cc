@@ -3,13 +3,74 @@
 
 #include "core/providers/shared_library/provider_api.h"
 
+#include <algorithm>
+
 #include "core/providers/cuda/gpu_data_transfer.h"
 #include "cuda_common.h"
 
 namespace onnxruntime {
 GPUDataTransfer::GPUDataTransfer() {}
 
-GPUDataTransfer::~GPUDataTransfer() {}
+GPUDataTransfer::~GPUDataTransfer() {
+  for (size_t i = 0; i < kStagingBufferCount; ++i) {
+    if (staging_events_[i] != nullptr) {
+      (void)cudaEventDestroy(staging_events_[i]);
+    }
+    if (staging_buffers_[i] != nullptr) {
+      (void)cudaFreeHost(staging_buffers_[i]);
+    }
+  }
+}
+
+bool GPUDataTransfer::EnsureStagingBuffers() const {
+  if (!staging_init_attempted_) {
+    staging_init_attempted_ = true;
+    bool ok = true;
+    for (size_t i = 0; ok && i < kStagingBufferCount; ++i) {
+      ok = cudaMallocHost(&staging_buffers_[i], kStagingBufferBytes) == cudaSuccess &&
+           cudaEventCreateWithFlags(&staging_events_[i], cudaEventDisableTiming) == cudaSuccess;
+    }
+    if (!ok) {
+      // keep whatever was allocated for the destructor to release, but do not
+      // use a partially initialized set of buffers.
+      LOGS_DEFAULT(WARNING) << "Failed to allocate pinned staging buffers; "
+                               "falling back to blocking copies from pageable memory.";
+    }
+    staging_available_ = ok;
+  }
+  return staging_available_;
+}
+
+common::Status GPUDataTransfer::TryStagedCopyToDevice(void* dst_data, const void* src_data,
+                                                      size_t bytes, bool& staged) const {
+  std::lock_guard<OrtMutex> lock(staging_mutex_);
+  if (!EnsureStagingBuffers()) {
+    staged = false;
+    return Status::OK();
+  }
+
+  // Double-buffer: kick off the DMA of one chunk, then fill the other pinned
+  // buffer while it is in flight. An event per buffer tracks when the buffer
+  // can be reused.
+  bool event_recorded[kStagingBufferCount] = {};
+  size_t buffer_index = 0;
+  for (size_t offset = 0; offset < bytes; buffer_index = (buffer_index + 1) % kStagingBufferCount) {
+    const size_t chunk_bytes = std::min(bytes - offset, kStagingBufferBytes);
+    if (event_recorded[buffer_index]) {
+      CUDA_RETURN_IF_ERROR(cudaEventSynchronize(staging_events_[buffer_index]));
+    }
+    memcpy(staging_buffers_[buffer_index], static_cast<const char*>(src_data) + offset, chunk_bytes);
+    CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(static_cast<char*>(dst_data) + offset,
+                                         staging_buffers_[buffer_index], chunk_bytes,
+                                         cudaMemcpyHostToDevice, nullptr));
+    CUDA_RETURN_IF_ERROR(cudaEventRecord(staging_events_[buffer_index], nullptr));
+    event_recorded[buffer_index] = true;
+    offset += chunk_bytes;
+  }
+  CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
+  staged = true;
+  return Status::OK();
+}
 
 bool GPUDataTransfer::CanCopy(const OrtDevice& src_device, const OrtDevice& dst_device) const {
   return src_device.Type() == OrtDevice::GPU || src_device.MemType() == OrtDevice::MemType::CUDA_PINNED ||
@@ -33,9 +94,18 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst) const
         CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
       }
     } else {
-      // copy from other CPU memory to GPU, this is blocking
-      CUDA_RETURN_IF_ERROR(cudaMemcpy(dst_data, src_data, bytes, cudaMemcpyHostToDevice));
-      CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
+      // copy from other CPU memory to GPU. Copies that span several staging
+      // chunks go through the pinned double buffer so the host-side copy of
+      // each chunk overlaps the DMA of the previous one; the rest take the
+      // plain blocking path.
+      bool staged = false;
+      if (bytes > kStagingBufferBytes) {
+        ORT_RETURN_IF_ERROR(TryStagedCopyToDevice(dst_data, src_data, bytes, staged));
+      }
+      if (!staged) {
+        CUDA_RETURN_IF_ERROR(cudaMemcpy(dst_data, src_data, bytes, cudaMemcpyHostToDevice));
+        CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(nullptr));
+      }
     }
   } else if (src_device.Type() == OrtDevice::GPU) {
     // copying from GPU to CPU memory, this is blocking
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <array>
+
 #include "cuda_pch.h"
 #include "core/framework/data_transfer.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 
@@ -19,6 +22,31 @@ class GPUDataTransfer : public IDataTransfer {
   using IDataTransfer::CopyTensor;
   common::Status CopyTensor(const Tensor& src, Tensor& dst) const override;
   common::Status CopyTensorAsync(const Tensor& src, Tensor& dst, Stream& stream) const override;
+
+ private:
+  // Large copies from pageable CPU memory are staged in chunks through a pair
+  // of pinned buffers: while one chunk is being DMA'd to the device, the host
+  // copies the next chunk into the other buffer. This overlaps the host-side
+  // copy with the transfer and lets the DMA run at pinned-memory speed instead
+  // of falling back to the driver's internal pageable staging.
+  static constexpr size_t kStagingBufferBytes = 8 * 1024 * 1024;
+  static constexpr size_t kStagingBufferCount = 2;
+
+  // Copies `bytes` from pageable host memory through the staging buffers.
+  // Sets `staged` to false (without error) when pinned memory is unavailable
+  // so the caller can fall back to a plain blocking copy.
+  common::Status TryStagedCopyToDevice(void* dst_data, const void* src_data, size_t bytes,
+                                       bool& staged) const;
+
+  // Lazily allocates the staging buffers and their reuse-tracking events.
+  // Returns false when allocation failed (permanently disabling staging).
+  bool EnsureStagingBuffers() const;
+
+  mutable OrtMutex staging_mutex_;
+  mutable std::array<void*, kStagingBufferCount> staging_buffers_{};
+  mutable std::array<cudaEvent_t, kStagingBufferCount> staging_events_{};
+  mutable bool staging_init_attempted_{false};
+  mutable bool staging_available_{false};
 };
 
 }  // namespace onnxruntime
@@ -21,6 +21,7 @@
 #include <curand_kernel.h>
 #include <algorithm>
 #include "core/providers/cuda/cu_inc/bitmask.cuh"
+#include "core/providers/cuda/generator/philox_cuda_state.h"
 
 namespace onnxruntime {
 namespace cuda {
@@ -31,13 +32,15 @@ constexpr int kNumUnroll = 4;
 template <typename T, bool UseBitmask>
 __global__ void DropoutKernel(const CUDA_LONG N, const CUDA_LONG mask_element_count, const int step_size,
                               const int steps_per_thread, const fast_divmod fdm_bits_per_element, const float ratio,
-                              const std::pair<uint64_t, uint64_t> seeds, const T* X_data, T* Y_data, void* mask_data) {
+                              const PhiloxCudaState philox_state, const T* X_data, T* Y_data, void* mask_data) {
   CUDA_LONG idx = blockDim.x * blockIdx.x + threadIdx.x;
 
   const float p = 1.0f - ratio;
   const float scale = 1.0f / p;
   curandStatePhilox4_32_10_t state;
-  curand_init(seeds.first, idx, seeds.second, &state);
+  const uint64_t philox_offset =
+      philox_state.offset_ptr != nullptr ? *philox_state.offset_ptr : philox_state.offset;
+  curand_init(philox_state.seed, idx, philox_offset, &state);
 
   float4 rand;
 
@@ -79,14 +82,16 @@ __global__ void DropoutKernel(const CUDA_LONG N, const CUDA_LONG mask_element_co
 template <typename T, bool UseBitmask>
 __global__ void DropoutVectorizedKernel(const CUDA_LONG N, const CUDA_LONG mask_element_count, const int step_size,
                                         const int steps_per_thread, const fast_divmod fdm_bits_per_element,
-                                        const float ratio, const std::pair<uint64_t, uint64_t> seeds, const T* X_data,
+                                        const float ratio, const PhiloxCudaState philox_state, const T* X_data,
                                         T* Y_data, void* mask_data) {
   CUDA_LONG idx = blockDim.x * blockIdx.x + threadIdx.x;
 
   const float p = 1.0f - ratio;
   const float scale = 1.0f / p;
   curandStatePhilox4_32_10_t state;
-  curand_init(seeds.first, idx, seeds.second, &state);
+  const uint64_t philox_offset =
+      philox_state.offset_ptr != nullptr ? *philox_state.offset_ptr : philox_state.offset;
+  curand_init(philox_state.seed, idx, philox_offset, &state);
 
   float4 rand;
 
@@ -140,7 +145,7 @@ __global__ void DropoutVectorizedKernel(const CUDA_LONG N, const CUDA_LONG mask_
 #define LAUNCH_DROPOUT_KERNEL(FuncName, UseBitmask)                                                       \
   FuncName<T, UseBitmask><<<grid_size, kBlockSize, 0, stream>>>(                                          \
       static_cast<CUDA_LONG>(N), static_cast<CUDA_LONG>(mask_element_count), step_size, steps_per_thread, \
-      fdm_bits_per_element, ratio, seeds, X_data, Y_data, mask_data)
+      fdm_bits_per_element, ratio, philox_state, X_data, Y_data, mask_data)
 
 #define HANDLE_DROPOUT_USE_BITMASK(FuncName) \
   if (use_bitmask) {                         \
@@ -161,7 +166,8 @@ void DropoutKernelImpl(const cudaDeviceProp& prop, cudaStream_t stream, const in
   // amount.
   const int step_size = kBlockSize * grid_size * kNumUnroll;
   const int steps_per_thread = static_cast<int>(CeilDiv(N, step_size));
-  auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(steps_per_thread * kNumUnroll));
+  auto philox_state =
+      NextPhiloxCudaState(generator, static_cast<uint64_t>(steps_per_thread * kNumUnroll), stream);
 
   fast_divmod fdm_bits_per_element(kNumBitsPerBitmaskElement);
   if (N % kNumUnroll != 0) {
@@ -97,3 +97,7 @@
 #if defined(USE_AZURE)
 #include "core/providers/azure/azure_provider_factory_creator.h"
 #endif
+
+#if defined(USE_REMOTE)
+#include "core/providers/remote/remote_provider_factory_creator.h"
+#endif
@@ -16,6 +16,7 @@
 #include "core/common/gsl.h"
 #include "core/framework/endian_utils.h"
 #include "core/common/logging/capture.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/qnn/builder/onnx_ctx_model_helper.h"
 #include "core/providers/qnn/builder/qnn_configs_helper.h"
 
@@ -468,6 +469,7 @@ Status QnnBackendManager::CreateContext() {
 
   ORT_RETURN_IF(QNN_CONTEXT_NO_ERROR != result, "Failed to create context.");
 
+  contexts_.push_back(context_);
   context_created_ = true;
   return Status::OK();
 }
@@ -477,9 +479,17 @@ Status QnnBackendManager::ReleaseContext() {
     return Status::OK();
   }
 
-  auto result = qnn_interface_.contextFree(context_, nullptr);
-  ORT_RETURN_IF(QNN_CONTEXT_NO_ERROR != result, "Failed to release context.");
+  bool failed = false;
+  for (auto context : contexts_) {
+    auto result = qnn_interface_.contextFree(context, nullptr);
+    if (QNN_CONTEXT_NO_ERROR != result) {
+      failed = true;
+    }
+  }
+  ORT_RETURN_IF(failed, "Failed to release context.");
 
+  contexts_.clear();
+  context_ = nullptr;
   context_created_ = false;
   return Status::OK();
 }
@@ -576,6 +586,7 @@ Status QnnBackendManager::LoadCachedQnnContextFromBuffer(char* buffer, uint64_t
                                               &context_,
                                               profile_backend_handle_);
   ORT_RETURN_IF(QNN_SUCCESS != rt, "Failed to create context from binary.");
+  contexts_.push_back(context_);
 
   // More work to support multiple partition, how to map the graph name in compile to qnn graph name
   // Need the lower level framework to understand EPContext op and pass in the partition_name in fused_node during Compile
@@ -601,6 +612,44 @@ Status QnnBackendManager::LoadCachedQnnContextFromBuffer(char* buffer, uint64_t
   return Status::OK();
 }
 
+std::shared_ptr<QnnBackendManager> QnnBackendManager::GetOrCreateShared(std::string&& backend_path,
+                                                                        ProfilingLevel profiling_level_etw,
+                                                                        ProfilingLevel profiling_level,
+                                                                        std::string&& profiling_file_path,
+                                                                        ContextPriority context_priority,
+                                                                        std::string&& qnn_saver_path,
+                                                                        uint32_t device_id,
+                                                                        QnnHtpDevice_Arch_t htp_arch,
+                                                                        uint32_t soc_model) {
+  static OrtMutex shared_instance_mutex;
+  // weak_ptr so the backend is torn down (and NPU resources released) once the last sharing
+  // session goes away, instead of staying resident for the life of the process.
+  static std::weak_ptr<QnnBackendManager> shared_instance;
+
+  std::lock_guard<OrtMutex> lock(shared_instance_mutex);
+  std::shared_ptr<QnnBackendManager> instance = shared_instance.lock();
+  if (instance) {
+    if (instance->backend_path_ != backend_path) {
+      LOGS_DEFAULT(WARNING) << "Reusing shared QNN backend created with backend_path: " << instance->backend_path_
+                            << ", requested backend_path: " << backend_path << " is ignored.";
+    }
+    LOGS_DEFAULT(VERBOSE) << "Reusing shared QNN backend manager.";
+    return instance;
+  }
+
+  instance = std::make_shared<QnnBackendManager>(std::move(backend_path),
+                                                 profiling_level_etw,
+                                                 profiling_level,
+                                                 std::move(profiling_file_path),
+                                                 context_priority,
+                                                 std::move(qnn_saver_path),
+                                                 device_id,
+                                                 htp_arch,
+                                                 soc_model);
+  shared_instance = instance;
+  return instance;
+}
+
 Status QnnBackendManager::SetupBackend(const logging::Logger& logger, bool load_from_cached_context) {
   if (backend_setup_completed_) {
     LOGS(logger, VERBOSE) << "Backend setup already!";
@@ -52,6 +52,22 @@ class QnnBackendManager {
   }
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(QnnBackendManager);
 
+  // Returns the process-wide shared backend manager, creating it with the given configuration
+  // if no session currently holds it. Sessions that opt in to context sharing (ep.share_ep_contexts)
+  // all use one backend/device/context, so the expensive NPU initialization happens once for the
+  // whole model bundle and their graphs are packed into a single QNN context. The configuration of
+  // the first session wins; later sessions reuse the live instance as-is. The instance is released
+  // when the last sharing session is destroyed.
+  static std::shared_ptr<QnnBackendManager> GetOrCreateShared(std::string&& backend_path,
+                                                              ProfilingLevel profiling_level_etw,
+                                                              ProfilingLevel profiling_level,
+                                                              std::string&& profiling_file_path,
+                                                              ContextPriority context_priority,
+                                                              std::string&& qnn_saver_path,
+                                                              uint32_t device_id,
+                                                              QnnHtpDevice_Arch_t htp_arch,
+                                                              uint32_t soc_model);
+
   ~QnnBackendManager();
   char* DlError() {
 #ifdef _WIN32
@@ -229,6 +245,9 @@ class QnnBackendManager {
   Qnn_LogHandle_t log_handle_ = nullptr;
   Qnn_DeviceHandle_t device_handle_ = nullptr;
   Qnn_ContextHandle_t context_ = nullptr;
+  // All contexts owned by this manager. context_ is the most recently created/loaded one and is
+  // where newly compiled graphs go; loading multiple cached context binaries adds an entry each.
+  std::vector<Qnn_ContextHandle_t> contexts_;
   ProfilingLevel profiling_level_etw_;
   ProfilingLevel profiling_level_;
   ProfilingLevel profiling_level_merge_;
@@ -180,6 +180,10 @@ QNNExecutionProvider::QNNExecutionProvider(const ProviderOptions& provider_optio
 
     context_cache_path_cfg_ = session_options->config_options.GetConfigOrDefault(kOrtSessionOptionEpContextFilePath, "");
     LOGS_DEFAULT(VERBOSE) << "User specified context cache path: " << context_cache_path_cfg_;
+
+    share_ep_contexts_ = session_options->config_options.GetConfigOrDefault(
+                             kOrtSessionOptionShareEpContexts, "0") == "1";
+    LOGS_DEFAULT(VERBOSE) << "User specified option - share EP contexts across sessions: " << share_ep_contexts_;
   }
 
   static const std::string BACKEND_PATH = "backend_path";
@@ -326,16 +330,31 @@ QNNExecutionProvider::QNNExecutionProvider(const ProviderOptions& provider_optio
     LOGS_DEFAULT(VERBOSE) << "User specified enable_htp_fp16_precision: " << enable_HTP_FP16_precision_;
   }
 
-  qnn_backend_manager_ = std::make_unique<qnn::QnnBackendManager>(
-      std::move(backend_path),
-      profiling_level_etw,
-      profiling_level,
-      std::move(profiling_file_path),
-      context_priority,
-      std::move(qnn_saver_path),
-      device_id_,
-      htp_arch,
-      soc_model);
+  if (share_ep_contexts_) {
+    // Sessions that opt in share one backend manager, so a bundle of models runs in one QNN
+    // context and the NPU is initialized once for all of them.
+    qnn_backend_manager_ = qnn::QnnBackendManager::GetOrCreateShared(
+        std::move(backend_path),
+        profiling_level_etw,
+        profiling_level,
+        std::move(profiling_file_path),
+        context_priority,
+        std::move(qnn_saver_path),
+        device_id_,
+        htp_arch,
+        soc_model);
+  } else {
+    qnn_backend_manager_ = std::make_shared<qnn::QnnBackendManager>(
+        std::move(backend_path),
+        profiling_level_etw,
+        profiling_level,
+        std::move(profiling_file_path),
+        context_priority,
+        std::move(qnn_saver_path),
+        device_id_,
+        htp_arch,
+        soc_model);
+  }
 }
 
 QNNExecutionProvider::~QNNExecutionProvider() {
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/remote/remote_execution_provider.h"
+
+#include "core/common/parse_string.h"
+#include "core/graph/constants.h"
+
+namespace onnxruntime {
+
+RemoteExecutionProvider::RemoteExecutionProvider(const std::unordered_map<std::string, std::string>& config)
+    : IExecutionProvider{onnxruntime::kRemoteExecutionProvider}, config_(config) {
+  auto it = config_.find("peer_uri");
+  if (it != config_.end()) {
+    peer_uri_ = it->second;
+  }
+
+  it = config_.find("stage_index");
+  if (it != config_.end()) {
+    ORT_ENFORCE(TryParseStringWithClassicLocale(it->second, stage_index_) && stage_index_ >= 0,
+                "stage_index must be a non-negative integer. Got: ", it->second);
+  }
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "core/framework/execution_provider.h"
+
+namespace onnxruntime {
+
+// Execution provider skeleton for pipeline-parallel inference across hosts. Graph partitions
+// assigned to this provider are intended to run in peer ORT processes, with activation tensors
+// streamed between stages as raw OrtValue buffers (no protobuf round-trip) so network transfer
+// can overlap local compute. The partitioning and tensor transport are not implemented yet;
+// the provider currently claims no nodes and only carries the stage configuration.
+class RemoteExecutionProvider : public IExecutionProvider {
+ public:
+  explicit RemoteExecutionProvider(const std::unordered_map<std::string, std::string>& config);
+  ~RemoteExecutionProvider() = default;
+
+  const std::unordered_map<std::string, std::string>& GetConfig() const { return config_; }
+
+  // URI of the peer process running the next pipeline stage. Empty for the final stage.
+  const std::string& PeerUri() const { return peer_uri_; }
+
+  // zero-based index of the pipeline stage this process runs.
+  int StageIndex() const { return stage_index_; }
+
+ private:
+  std::unordered_map<std::string, std::string> config_;
+  std::string peer_uri_;
+  int stage_index_{0};
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,23 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include <unordered_map>
+#include "core/providers/remote/remote_provider_factory_creator.h"
+#include "core/providers/remote/remote_execution_provider.h"
+
+namespace onnxruntime {
+
+struct RemoteProviderFactory : public IExecutionProviderFactory {
+  RemoteProviderFactory(const std::unordered_map<std::string, std::string>& config) : config_(config) {}
+
+  std::unique_ptr<IExecutionProvider> CreateProvider() override {
+    return std::make_unique<RemoteExecutionProvider>(config_);
+  };
+
+  std::unordered_map<std::string, std::string> config_;
+};
+
+std::shared_ptr<IExecutionProviderFactory> RemoteProviderFactoryCreator::Create(const std::unordered_map<std::string, std::string>& config) {
+  return std::make_shared<RemoteProviderFactory>(config);
+}
+
+}  // namespace onnxruntime
@@ -73,10 +73,18 @@
 #endif
 
 #ifdef _WIN32
-// Override default new/delete so that we match the host's allocator
-_Ret_notnull_ _Post_writable_byte_size_(n) void* operator new(size_t n) { return Provider_GetHost()->HeapAllocate(n); }
-void operator delete(void* p) noexcept { return Provider_GetHost()->HeapFree(p); }
-void operator delete(void* p, size_t /*size*/) noexcept { return Provider_GetHost()->HeapFree(p); }
+// Override default new/delete so that we match the host's allocator.
+// The host pointer is cached on first use rather than via onnxruntime::g_host, as these can run
+// during static initialization before that global is constructed, and resolving the host once
+// avoids a cross-library call on every heap operation.
+static onnxruntime::ProviderHost* GetHostForHeap() {
+  static onnxruntime::ProviderHost* const host = Provider_GetHost();
+  return host;
+}
+
+_Ret_notnull_ _Post_writable_byte_size_(n) void* operator new(size_t n) { return GetHostForHeap()->HeapAllocate(n); }
+void operator delete(void* p) noexcept { return GetHostForHeap()->HeapFree(p); }
+void operator delete(void* p, size_t /*size*/) noexcept { return GetHostForHeap()->HeapFree(p); }
 #endif
 
 namespace onnxruntime {
@@ -121,140 +129,144 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
   return g_host->CreateAllocator(info);
 }
 
+// The MLDataType singletons live on the host side for the lifetime of the process, so each one is
+// resolved through the bridge once and served from a function-local static afterwards. Kernels
+// query these on hot paths (type dispatch, output allocation), where the repeated cross-library
+// calls were measurable.
 template <>
-MLDataType DataTypeImpl::GetType<Tensor>() { return Provider_GetHost()->DataTypeImpl__GetType_Tensor(); }
+MLDataType DataTypeImpl::GetType<Tensor>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_Tensor(); return type; }
 #if !defined(DISABLE_SPARSE_TENSORS)
 template <>
-MLDataType DataTypeImpl::GetType<SparseTensor>() { return Provider_GetHost()->DataTypeImpl__GetType_SparseTensor(); }
+MLDataType DataTypeImpl::GetType<SparseTensor>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_SparseTensor(); return type; }
 #endif
 template <>
-MLDataType DataTypeImpl::GetType<TensorSeq>() { return Provider_GetHost()->DataTypeImpl__GetType_TensorSeq(); }
+MLDataType DataTypeImpl::GetType<TensorSeq>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_TensorSeq(); return type; }
 MLDataType DataTypeImpl::GetTypeFromOnnxType(int onnx_type) { return Provider_GetHost()->DataTypeImpl__GetTypeFromOnnxType(onnx_type); }
 template <>
-MLDataType DataTypeImpl::GetType<bool>() { return Provider_GetHost()->DataTypeImpl__GetType_bool(); }
+MLDataType DataTypeImpl::GetType<bool>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_bool(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<int8_t>() { return Provider_GetHost()->DataTypeImpl__GetType_int8(); }
+MLDataType DataTypeImpl::GetType<int8_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_int8(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<uint8_t>() { return Provider_GetHost()->DataTypeImpl__GetType_uint8(); }
+MLDataType DataTypeImpl::GetType<uint8_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_uint8(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<int16_t>() { return Provider_GetHost()->DataTypeImpl__GetType_int16(); }
+MLDataType DataTypeImpl::GetType<int16_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_int16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<uint16_t>() { return Provider_GetHost()->DataTypeImpl__GetType_uint16(); }
+MLDataType DataTypeImpl::GetType<uint16_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_uint16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<int32_t>() { return Provider_GetHost()->DataTypeImpl__GetType_int32(); }
+MLDataType DataTypeImpl::GetType<int32_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_int32(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<uint32_t>() { return Provider_GetHost()->DataTypeImpl__GetType_uint32(); }
+MLDataType DataTypeImpl::GetType<uint32_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_uint32(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<int64_t>() { return Provider_GetHost()->DataTypeImpl__GetType_int64(); }
+MLDataType DataTypeImpl::GetType<int64_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_int64(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<uint64_t>() { return Provider_GetHost()->DataTypeImpl__GetType_uint64(); }
+MLDataType DataTypeImpl::GetType<uint64_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_uint64(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<float>() { return Provider_GetHost()->DataTypeImpl__GetType_float(); }
+MLDataType DataTypeImpl::GetType<float>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_float(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<double>() { return Provider_GetHost()->DataTypeImpl__GetType_double(); }
+MLDataType DataTypeImpl::GetType<double>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_double(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<BFloat16>() { return Provider_GetHost()->DataTypeImpl__GetType_BFloat16(); }
+MLDataType DataTypeImpl::GetType<BFloat16>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_BFloat16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<MLFloat16>() { return Provider_GetHost()->DataTypeImpl__GetType_MLFloat16(); }
+MLDataType DataTypeImpl::GetType<MLFloat16>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_MLFloat16(); return type; }
 
 #if !defined(DISABLE_FLOAT8_TYPES)
 template <>
-MLDataType DataTypeImpl::GetType<Float8E4M3FN>() { return Provider_GetHost()->DataTypeImpl__GetType_Float8E4M3FN(); }
+MLDataType DataTypeImpl::GetType<Float8E4M3FN>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_Float8E4M3FN(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<Float8E4M3FNUZ>() { return Provider_GetHost()->DataTypeImpl__GetType_Float8E4M3FNUZ(); }
+MLDataType DataTypeImpl::GetType<Float8E4M3FNUZ>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_Float8E4M3FNUZ(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<Float8E5M2>() { return Provider_GetHost()->DataTypeImpl__GetType_Float8E5M2(); }
+MLDataType DataTypeImpl::GetType<Float8E5M2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_Float8E5M2(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<Float8E5M2FNUZ>() { return Provider_GetHost()->DataTypeImpl__GetType_Float8E5M2FNUZ(); }
+MLDataType DataTypeImpl::GetType<Float8E5M2FNUZ>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_Float8E5M2FNUZ(); return type; }
 #endif
 template <>
-MLDataType DataTypeImpl::GetType<Int4x2>() { return Provider_GetHost()->DataTypeImpl__GetType_Int4x2(); }
+MLDataType DataTypeImpl::GetType<Int4x2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_Int4x2(); return type; }
 template <>
-MLDataType DataTypeImpl::GetType<UInt4x2>() { return Provider_GetHost()->DataTypeImpl__GetType_UInt4x2(); }
+MLDataType DataTypeImpl::GetType<UInt4x2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_UInt4x2(); return type; }
 
 template <>
-MLDataType DataTypeImpl::GetType<std::string>() { return Provider_GetHost()->DataTypeImpl__GetType_string(); }
+MLDataType DataTypeImpl::GetType<std::string>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetType_string(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<bool>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_bool(); }
+MLDataType DataTypeImpl::GetTensorType<bool>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_bool(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<int8_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_int8(); }
+MLDataType DataTypeImpl::GetTensorType<int8_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_int8(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<uint8_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_uint8(); }
+MLDataType DataTypeImpl::GetTensorType<uint8_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_uint8(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<int16_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_int16(); }
+MLDataType DataTypeImpl::GetTensorType<int16_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_int16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<uint16_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_uint16(); }
+MLDataType DataTypeImpl::GetTensorType<uint16_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_uint16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<int32_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_int32(); }
+MLDataType DataTypeImpl::GetTensorType<int32_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_int32(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<uint32_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_uint32(); }
+MLDataType DataTypeImpl::GetTensorType<uint32_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_uint32(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<int64_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_int64(); }
+MLDataType DataTypeImpl::GetTensorType<int64_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_int64(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<uint64_t>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_uint64(); }
+MLDataType DataTypeImpl::GetTensorType<uint64_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_uint64(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<float>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_float(); }
+MLDataType DataTypeImpl::GetTensorType<float>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_float(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<double>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_double(); }
+MLDataType DataTypeImpl::GetTensorType<double>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_double(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<BFloat16>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_BFloat16(); }
+MLDataType DataTypeImpl::GetTensorType<BFloat16>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_BFloat16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<MLFloat16>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_MLFloat16(); }
+MLDataType DataTypeImpl::GetTensorType<MLFloat16>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_MLFloat16(); return type; }
 
 #if !defined(DISABLE_FLOAT8_TYPES)
 template <>
-MLDataType DataTypeImpl::GetTensorType<Float8E4M3FN>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E4M3FN(); }
+MLDataType DataTypeImpl::GetTensorType<Float8E4M3FN>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E4M3FN(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<Float8E4M3FNUZ>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E4M3FNUZ(); }
+MLDataType DataTypeImpl::GetTensorType<Float8E4M3FNUZ>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E4M3FNUZ(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<Float8E5M2>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E5M2(); }
+MLDataType DataTypeImpl::GetTensorType<Float8E5M2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E5M2(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<Float8E5M2FNUZ>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E5M2FNUZ(); }
+MLDataType DataTypeImpl::GetTensorType<Float8E5M2FNUZ>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_Float8E5M2FNUZ(); return type; }
 #endif
 template <>
-MLDataType DataTypeImpl::GetTensorType<Int4x2>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_Int4x2(); }
+MLDataType DataTypeImpl::GetTensorType<Int4x2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_Int4x2(); return type; }
 template <>
-MLDataType DataTypeImpl::GetTensorType<UInt4x2>() { return Provider_GetHost()->DataTypeImpl__GetTensorType_UInt4x2(); }
+MLDataType DataTypeImpl::GetTensorType<UInt4x2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetTensorType_UInt4x2(); return type; }
 
 #if !defined(DISABLE_SPARSE_TENSORS)
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<bool>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_bool(); }
+MLDataType DataTypeImpl::GetSparseTensorType<bool>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_bool(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<int8_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int8(); }
+MLDataType DataTypeImpl::GetSparseTensorType<int8_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int8(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<uint8_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint8(); }
+MLDataType DataTypeImpl::GetSparseTensorType<uint8_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint8(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<int16_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int16(); }
+MLDataType DataTypeImpl::GetSparseTensorType<int16_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<uint16_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint16(); }
+MLDataType DataTypeImpl::GetSparseTensorType<uint16_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<int32_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int32(); }
+MLDataType DataTypeImpl::GetSparseTensorType<int32_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int32(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<uint32_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint32(); }
+MLDataType DataTypeImpl::GetSparseTensorType<uint32_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint32(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<int64_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int64(); }
+MLDataType DataTypeImpl::GetSparseTensorType<int64_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_int64(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<uint64_t>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint64(); }
+MLDataType DataTypeImpl::GetSparseTensorType<uint64_t>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_uint64(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<float>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_float(); }
+MLDataType DataTypeImpl::GetSparseTensorType<float>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_float(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<double>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_double(); }
+MLDataType DataTypeImpl::GetSparseTensorType<double>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_double(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<std::string>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_string(); }
+MLDataType DataTypeImpl::GetSparseTensorType<std::string>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_string(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<BFloat16>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_BFloat16(); }
+MLDataType DataTypeImpl::GetSparseTensorType<BFloat16>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_BFloat16(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<MLFloat16>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_MLFloat16(); }
+MLDataType DataTypeImpl::GetSparseTensorType<MLFloat16>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_MLFloat16(); return type; }
 
 #if !defined(DISABLE_FLOAT8_TYPES)
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<Float8E4M3FN>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E4M3FN(); }
+MLDataType DataTypeImpl::GetSparseTensorType<Float8E4M3FN>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E4M3FN(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<Float8E4M3FNUZ>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E4M3FNUZ(); }
+MLDataType DataTypeImpl::GetSparseTensorType<Float8E4M3FNUZ>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E4M3FNUZ(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<Float8E5M2>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E5M2(); }
+MLDataType DataTypeImpl::GetSparseTensorType<Float8E5M2>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E5M2(); return type; }
 template <>
-MLDataType DataTypeImpl::GetSparseTensorType<Float8E5M2FNUZ>() { return Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E5M2FNUZ(); }
+MLDataType DataTypeImpl::GetSparseTensorType<Float8E5M2FNUZ>() { static const MLDataType type = Provider_GetHost()->DataTypeImpl__GetSparseTensorType_Float8E5M2FNUZ(); return type; }
 #endif
 
 #endif
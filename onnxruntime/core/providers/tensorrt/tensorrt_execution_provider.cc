@@ -3150,6 +3150,47 @@ Status TensorrtExecutionProvider::CreateNodeComputeInfoFromGraph(const GraphView
       return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
                              "TensorRT EP could not build execution context for fused node: " + fused_node.Name());
     }
+  } else if (engine_cache_enable_ && !engine_decryption_enable_ && !weight_stripped_engine_enable_) {
+    // Warm start for dynamic shape subgraphs: if a serialized engine and its profile are already in the
+    // cache, e.g. produced by a previous run or copied over from an instance that has already been warmed
+    // up, deserialize them at session creation time so the first inference request doesn't pay for the
+    // engine load. A missing or unreadable cache simply falls back to the existing lazy path in the
+    // compute function.
+    auto lock = GetApiLock();
+    std::ifstream engine_file(engine_cache_path, std::ios::binary | std::ios::in);
+    std::ifstream profile_file(profile_cache_path, std::ios::binary | std::ios::in);
+    if (engine_file && profile_file) {
+      engine_file.seekg(0, std::ios::end);
+      size_t engine_size = engine_file.tellg();
+      engine_file.seekg(0, std::ios::beg);
+      std::unique_ptr<char[]> engine_buf{new char[engine_size]};
+      engine_file.read((char*)engine_buf.get(), engine_size);
+      trt_engine = std::unique_ptr<nvinfer1::ICudaEngine>(runtime_->deserializeCudaEngine(engine_buf.get(), engine_size));
+      if (trt_engine != nullptr) {
+        LOGS_DEFAULT(VERBOSE) << "[TensorRT EP] DeSerialized " + engine_cache_path;
+        // The engine was built with the serialized profile, not with the initial implicit ranges, so the
+        // cached profile replaces them. The compute function then only rebuilds the engine when an input
+        // falls outside the cached ranges, exactly as it would have after a lazy load.
+        input_implicit_shape_ranges = DeserializeProfileV2(profile_file);
+        LOGS_DEFAULT(VERBOSE) << "[TensorRT EP] DeSerialized " + profile_cache_path;
+        if (context_memory_sharing_enable_) {
+          size_t mem_size = trt_engine->getDeviceMemorySize();
+          if (mem_size > max_ctx_mem_size_) {
+            max_ctx_mem_size_ = mem_size;
+          }
+          trt_context = std::unique_ptr<nvinfer1::IExecutionContext>(trt_engine->createExecutionContextWithoutDeviceMemory());
+        } else {
+          trt_context = std::unique_ptr<nvinfer1::IExecutionContext>(trt_engine->createExecutionContext());
+        }
+        if (!trt_context) {
+          return ORT_MAKE_STATUS(ONNXRUNTIME, EP_FAIL,
+                                 "TensorRT EP could not build execution context for fused node: " + fused_node.Name());
+        }
+      } else {
+        // An unloadable cache is not fatal here; the compute function rebuilds the engine on demand.
+        LOGS_DEFAULT(WARNING) << "[TensorRT EP] Could not deserialize engine from cache " + engine_cache_path + " at session creation, the engine will be built at inference time";
+      }
+    }
   }
 
   // Create input to index map
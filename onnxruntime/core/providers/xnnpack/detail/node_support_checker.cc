@@ -15,6 +15,7 @@
 #include "core/providers/xnnpack/detail/utils.h"
 
 // each operator provides a helper to check if supported
+#include "core/providers/xnnpack/math/elementwise.h"
 #include "core/providers/xnnpack/math/gemm.h"
 #include "core/providers/xnnpack/math/matmul.h"
 #include "core/providers/xnnpack/math/softmax.h"
@@ -91,6 +92,8 @@ const NodeUnit* ClipReluChecker(const NodeUnit& node_unit,
 
 bool NodeSupportChecker::IsNodeSupported(const NodeUnit& nodeunit) {
   static std::unordered_map<std::string, CheckerFn> checkers{
+      {"Add", Elementwise::IsOnnxNodeSupported},
+      {"Mul", Elementwise::IsOnnxNodeSupported},
       {"Conv", Conv::IsOnnxNodeSupported},
       {"ConvTranspose", ConvTranspose::IsOnnxNodeSupported},
       {"QLinearConv", Conv::IsOnnxNodeSupported},
@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/xnnpack/math/elementwise.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "core/framework/node_unit.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace xnnpack {
+
+namespace {
+// numpy-style broadcast of the two input shapes. returns false if the shapes are incompatible.
+bool BroadcastShapes(const TensorShape& shape0, const TensorShape& shape1, TensorShapeVector& output_dims) {
+  const size_t rank = std::max(shape0.NumDimensions(), shape1.NumDimensions());
+  output_dims.resize(rank);
+  for (size_t i = 0; i < rank; ++i) {
+    const int64_t dim0 = i < shape0.NumDimensions() ? shape0[shape0.NumDimensions() - 1 - i] : 1;
+    const int64_t dim1 = i < shape1.NumDimensions() ? shape1[shape1.NumDimensions() - 1 - i] : 1;
+    if (dim0 != dim1 && dim0 != 1 && dim1 != 1) {
+      return false;
+    }
+    output_dims[rank - 1 - i] = std::max(dim0, dim1);
+  }
+  return true;
+}
+}  // namespace
+
+bool Elementwise::IsOnnxNodeSupported(const NodeUnit& node_unit, const GraphViewer& /*graph*/) {
+  bool supported = false;
+
+  // use do {} while(false) so it's easier to set a breakpoint on the return
+  do {
+    const auto& inputs = node_unit.Inputs();
+
+    // we only support float currently
+    bool all_float = true;
+    for (const auto& input : inputs) {
+      const auto* type = input.node_arg.TypeAsProto();
+      if (type == nullptr ||
+          type->tensor_type().elem_type() != ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
+        all_float = false;
+        break;
+      }
+    }
+
+    if (!all_float) {
+      break;
+    }
+
+    // the xnnpack nd operators handle numpy-style broadcasting but are limited to
+    // XNN_MAX_TENSOR_DIMS dimensions. the actual dims are passed at Compute time,
+    // so we only need the rank here.
+    const auto* shape0 = inputs[0].node_arg.Shape();
+    const auto* shape1 = inputs[1].node_arg.Shape();
+    if (!shape0 || !shape1 ||
+        shape0->dim_size() > XNN_MAX_TENSOR_DIMS ||
+        shape1->dim_size() > XNN_MAX_TENSOR_DIMS) {
+      break;
+    }
+
+    supported = true;
+  } while (false);
+
+  return supported;
+}
+
+Elementwise::Elementwise(const OpKernelInfo& info) : XnnpackKernel{info} {
+  const auto& op_type = info.node().OpType();
+  if (op_type == "Add") {
+    binary_op_type_ = BinaryOpType::kAdd;
+  } else if (op_type == "Mul") {
+    binary_op_type_ = BinaryOpType::kMul;
+  } else {
+    ORT_THROW("unsupported elementwise op: ", op_type);
+  }
+
+  xnn_status xstatus = xnn_status_invalid_state;
+  struct xnn_operator* p = nullptr;
+  if (binary_op_type_ == BinaryOpType::kAdd) {
+    xstatus = xnn_create_add_nd_f32(-INFINITY, INFINITY, 0 /*flags*/, &p);
+  } else {
+    xstatus = xnn_create_multiply_nd_f32(-INFINITY, INFINITY, 0 /*flags*/, &p);
+  }
+
+  ORT_ENFORCE(xstatus == xnn_status_success, "xnn_create_", op_type == "Add" ? "add" : "multiply",
+              "_nd_f32 failed. Status:", xstatus);
+  op0_.reset(p);
+}
+
+Status Elementwise::Compute(OpKernelContext* ctx) const {
+  const auto* A = ctx->Input<Tensor>(0);
+  const auto* B = ctx->Input<Tensor>(1);
+  const auto& a_shape = A->Shape();
+  const auto& b_shape = B->Shape();
+
+  TensorShapeVector output_dims;
+  ORT_RETURN_IF_NOT(BroadcastShapes(a_shape, b_shape, output_dims),
+                    "Incompatible shapes for broadcast: ", a_shape, " and ", b_shape);
+
+  auto* Y = ctx->Output(0, TensorShape(output_dims));
+
+  // edge case. one or more dims with value of 0. nothing to do
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  InlinedVector<size_t> a_dims(a_shape.NumDimensions());
+  InlinedVector<size_t> b_dims(b_shape.NumDimensions());
+  for (size_t i = 0; i < a_dims.size(); ++i) {
+    a_dims[i] = gsl::narrow_cast<size_t>(a_shape[i]);
+  }
+  for (size_t i = 0; i < b_dims.size(); ++i) {
+    b_dims[i] = gsl::narrow_cast<size_t>(b_shape[i]);
+  }
+
+  pthreadpool_t threadpool = GetThreadPool();
+
+  auto reshape_fn = binary_op_type_ == BinaryOpType::kAdd ? xnn_reshape_add_nd_f32
+                                                          : xnn_reshape_multiply_nd_f32;
+  xnn_status status = reshape_fn(op0_.get(), a_dims.size(), a_dims.data(), b_dims.size(), b_dims.data(),
+                                 threadpool);
+  if (status != xnn_status_success) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "xnn_reshape_",
+                           binary_op_type_ == BinaryOpType::kAdd ? "add" : "multiply",
+                           "_nd_f32 returned ", status);
+  }
+
+  auto setup_fn = binary_op_type_ == BinaryOpType::kAdd ? xnn_setup_add_nd_f32
+                                                        : xnn_setup_multiply_nd_f32;
+  status = setup_fn(op0_.get(), A->Data<float>(), B->Data<float>(), Y->MutableData<float>());
+  if (status != xnn_status_success) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "xnn_setup_",
+                           binary_op_type_ == BinaryOpType::kAdd ? "add" : "multiply",
+                           "_nd_f32 returned ", status);
+  }
+
+  status = xnn_run_operator(op0_.get(), threadpool);
+  if (status != xnn_status_success) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "xnn_run_operator returned ", status);
+  }
+
+  return Status::OK();
+}
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Add, kOnnxDomain, 7, 12, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  Elementwise);
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Add, kOnnxDomain, 13, 13, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  Elementwise);
+
+ONNX_OPERATOR_KERNEL_EX(Add, kOnnxDomain, 14, kXnnpackExecutionProvider,
+                        KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                        Elementwise);
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Mul, kOnnxDomain, 7, 12, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  Elementwise);
+
+ONNX_OPERATOR_VERSIONED_KERNEL_EX(Mul, kOnnxDomain, 13, 13, kXnnpackExecutionProvider,
+                                  KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                                  Elementwise);
+
+ONNX_OPERATOR_KERNEL_EX(Mul, kOnnxDomain, 14, kXnnpackExecutionProvider,
+                        KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+                        Elementwise);
+
+}  // namespace xnnpack
+}  // namespace onnxruntime
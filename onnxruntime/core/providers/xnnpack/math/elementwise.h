@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/providers/xnnpack/xnnpack_kernel.h"
+#include "core/providers/xnnpack/detail/utils.h"
+#include "core/common/common.h"
+
+namespace onnxruntime {
+class GraphViewer;
+class NodeUnit;
+namespace xnnpack {
+
+// Broadcasting binary elementwise ops (Add/Mul) backed by the XNNPACK *_nd_f32 operators.
+// Keeping these on the XNNPACK EP avoids bouncing back to the CPU EP between
+// XNNPACK-resident MatMul/Gemm/Softmax nodes in transformer graphs.
+class Elementwise : public XnnpackKernel {
+ public:
+  explicit Elementwise(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+  // Required for checking XNNpack restrictions on ORT side
+  static bool IsOnnxNodeSupported(const NodeUnit& node_unit, const GraphViewer& graph);
+
+ private:
+  enum class BinaryOpType {
+    kAdd,
+    kMul,
+  };
+
+  BinaryOpType binary_op_type_;
+  XnnpackOperator op0_ = nullptr;
+};
+
+}  // namespace xnnpack
+}  // namespace onnxruntime
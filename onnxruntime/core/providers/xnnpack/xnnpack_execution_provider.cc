@@ -70,6 +70,14 @@ class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kMSIn
 class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kMSInternalNHWCDomain, 12, MaxPool);
 
 // ONNX operators
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 7, 12, Add);
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 13, 13, Add);
+class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 14, Add);
+
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 7, 12, Mul);
+class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 13, 13, Mul);
+class ONNX_OPERATOR_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 14, Mul);
+
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 7, 8, Gemm);
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 9, 10, Gemm);
 class ONNX_OPERATOR_VERSIONED_KERNEL_CLASS_NAME(kXnnpackExecutionProvider, kOnnxDomain, 11, 12, Gemm);
@@ -118,6 +126,14 @@ std::unique_ptr<KernelRegistry> RegisterKernels() {
       KERNEL_CREATE_INFO(19, Resize, kMSInternalNHWCDomain),
 
       // layout insensitive, use ONNX-domain directly
+      KERNEL_CREATE_INFO_VERSIONED(7, 12, Add, kOnnxDomain),
+      KERNEL_CREATE_INFO_VERSIONED(13, 13, Add, kOnnxDomain),
+      KERNEL_CREATE_INFO(14, Add, kOnnxDomain),
+
+      KERNEL_CREATE_INFO_VERSIONED(7, 12, Mul, kOnnxDomain),
+      KERNEL_CREATE_INFO_VERSIONED(13, 13, Mul, kOnnxDomain),
+      KERNEL_CREATE_INFO(14, Mul, kOnnxDomain),
+
       KERNEL_CREATE_INFO_VERSIONED(1, 10, Softmax, kOnnxDomain),
       KERNEL_CREATE_INFO_VERSIONED(11, 12, Softmax, kOnnxDomain),
       KERNEL_CREATE_INFO(13, Softmax, kOnnxDomain),
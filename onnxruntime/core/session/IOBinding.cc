@@ -3,6 +3,7 @@
 
 #include "core/session/IOBinding.h"
 #include "core/common/logging/logging.h"
+#include "core/framework/feeds_fetches_manager.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/utils.h"
@@ -11,6 +12,35 @@ namespace onnxruntime {
 IOBinding::IOBinding(const SessionState& session_state) : session_state_(session_state) {
 }
 
+IOBinding::~IOBinding() = default;
+
+common::Status IOBinding::GetOrCreateFeedsFetchesManager(FeedsFetchesManager*& feeds_fetches_manager) {
+  if (feeds_fetches_manager_ == nullptr) {
+    ORT_RETURN_IF_ERROR(FeedsFetchesManager::Create(feed_names_, output_names_,
+                                                    session_state_.GetOrtValueNameIdxMap(),
+                                                    feeds_fetches_manager_));
+  }
+
+  feeds_fetches_manager = feeds_fetches_manager_.get();
+  return Status::OK();
+}
+
+bool IOBinding::SameTypeAndShape(const OrtValue& existing, const OrtValue& replacement) {
+  if (!existing.IsAllocated() && !replacement.IsAllocated()) {
+    return true;
+  }
+
+  if (!existing.IsAllocated() || !replacement.IsAllocated() ||
+      !existing.IsTensor() || !replacement.IsTensor()) {
+    return false;
+  }
+
+  const auto& existing_tensor = existing.Get<Tensor>();
+  const auto& replacement_tensor = replacement.Get<Tensor>();
+  return existing_tensor.DataType() == replacement_tensor.DataType() &&
+         existing_tensor.Shape() == replacement_tensor.Shape();
+}
+
 common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_value) {
   auto it = mapped_feed_names_.emplace(name, feed_names_.size());
 
@@ -18,7 +48,12 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
     if (it.second) {
       feed_names_.push_back(name);
       feeds_.push_back(value);
+      feeds_fetches_manager_.reset();  // the set of bound names changed
+      validated_ = false;
     } else {
+      if (validated_ && !SameTypeAndShape(feeds_[it.first->second], value)) {
+        validated_ = false;
+      }
       feeds_[it.first->second] = value;
     }
   };
@@ -41,10 +76,80 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
   return Status::OK();
 }
 
+common::Status IOBinding::BindBatchedInput(const std::string& name, gsl::span<const OrtValue> parts) {
+  ORT_RETURN_IF(parts.empty(), "No tensors were provided to batch for input: ", name);
+
+  for (const auto& part : parts) {
+    ORT_RETURN_IF(!part.IsTensor(), "BindBatchedInput only supports tensors. Input: ", name);
+  }
+
+  const auto& first = parts[0].Get<Tensor>();
+  ORT_RETURN_IF(first.IsDataTypeString(), "BindBatchedInput does not support string tensors. Input: ", name);
+
+  const auto* element_type = first.DataType();
+  auto batch_dims = first.Shape().AsShapeVector();
+  ORT_RETURN_IF(batch_dims.empty(), "BindBatchedInput requires tensors with at least one dimension. Input: ", name);
+
+  for (size_t i = 1; i < parts.size(); ++i) {
+    const auto& tensor = parts[i].Get<Tensor>();
+    ORT_RETURN_IF(tensor.DataType() != element_type,
+                  "Element type mismatch between batched tensors for input: ", name);
+    const auto dims = tensor.Shape().GetDims();
+    ORT_RETURN_IF(dims.size() != batch_dims.size(),
+                  "Rank mismatch between batched tensors for input: ", name);
+    for (size_t axis = 1; axis < batch_dims.size(); ++axis) {
+      ORT_RETURN_IF(dims[axis] != batch_dims[axis],
+                    "Dimension ", axis, " mismatch between batched tensors for input: ", name);
+    }
+    batch_dims[0] += dims[0];
+  }
+
+  // allocate the batch at the location the input is consumed so each part is copied exactly once
+  InlinedVector<SessionState::NodeInfo> node_info_vec;
+  ORT_RETURN_IF_ERROR(session_state_.GetInputNodeInfo(name, node_info_vec));
+  AllocatorPtr allocator = session_state_.GetAllocator(*node_info_vec.front().device);
+  ORT_RETURN_IF(allocator == nullptr, "Failed to find allocator for the device consuming input: ", name);
+
+  Tensor batch_tensor(element_type, TensorShape(batch_dims), std::move(allocator));
+
+  const auto& data_transfer_mgr = session_state_.GetDataTransferMgr();
+  char* batch_data = static_cast<char*>(batch_tensor.MutableDataRaw());
+  size_t byte_offset = 0;
+  for (const auto& part : parts) {
+    const auto& src = part.Get<Tensor>();
+    if (src.Shape().Size() == 0) {
+      continue;
+    }
+    Tensor dst(element_type, src.Shape(), batch_data + byte_offset, batch_tensor.Location());
+    ORT_RETURN_IF_ERROR(data_transfer_mgr.CopyTensor(src, dst));
+    byte_offset += src.SizeInBytes();
+  }
+
+  OrtValue batch_value;
+  Tensor::InitOrtValue(std::move(batch_tensor), batch_value);
+
+  auto it = mapped_feed_names_.emplace(name, feed_names_.size());
+  if (it.second) {
+    feed_names_.push_back(name);
+    feeds_.push_back(batch_value);
+    feeds_fetches_manager_.reset();  // the set of bound names changed
+    validated_ = false;
+  } else {
+    if (validated_ && !SameTypeAndShape(feeds_[it.first->second], batch_value)) {
+      validated_ = false;
+    }
+    feeds_[it.first->second] = batch_value;
+  }
+
+  return Status::OK();
+}
+
 void IOBinding::ClearInputs() {
   mapped_feed_names_.clear();
   feed_names_.clear();
   feeds_.clear();
+  feeds_fetches_manager_.reset();
+  validated_ = false;
 }
 
 static common::Status SyncProviders(const SessionState::NameNodeInfoMapType& node_info_map,
@@ -87,6 +192,25 @@ common::Status IOBinding::BindOutput(const std::string& name, OrtDevice device)
   return BindOutputImpl(name, {}, device);
 }
 
+common::Status IOBinding::BindOutputInPlace(const std::string& name, const OrtValue& ml_value) {
+  ORT_RETURN_IF(!ml_value.IsAllocated(), "BindOutputInPlace requires a pre-allocated value. Output: ", name);
+  ORT_RETURN_IF(!ml_value.IsTensor(), "BindOutputInPlace only supports tensors. Output: ", name);
+
+  // The execution frame writes a pre-allocated fetch in place when its location matches the
+  // device the output is produced on; anything else is satisfied by a device copy at the end
+  // of the run. Reject the binding up front in that case instead of silently copying.
+  InlinedVector<SessionState::NodeInfo> node_info_vec;
+  ORT_RETURN_IF_ERROR(session_state_.GetOutputNodeInfo(name, node_info_vec));
+
+  const OrtDevice& produced_on = *node_info_vec.front().device;
+  const OrtDevice& bound_to = ml_value.Get<Tensor>().Location().device;
+  ORT_RETURN_IF(produced_on != bound_to,
+                "Cannot bind output in place. Output: ", name, " is produced on device ",
+                produced_on.ToString(), " but the provided buffer is on device ", bound_to.ToString());
+
+  return BindOutputImpl(name, ml_value, bound_to);
+}
+
 common::Status IOBinding::BindOutputImpl(const std::string& name, const OrtValue& ml_value, OrtDevice device) {
   auto it = mapped_output_names_.emplace(name, output_names_.size());
   size_t index = it.first->second;
@@ -94,7 +218,13 @@ common::Status IOBinding::BindOutputImpl(const std::string& name, const OrtValue
     output_names_.push_back(name);
     outputs_.push_back(ml_value);
     outputs_device_info_.push_back(device);
+    feeds_fetches_manager_.reset();  // the set of bound names changed
+    validated_ = false;
   } else {
+    if (validated_ &&
+        (!SameTypeAndShape(outputs_[index], ml_value) || outputs_device_info_[index] != device)) {
+      validated_ = false;
+    }
     outputs_[index] = ml_value;
     outputs_device_info_[index] = device;
   }
@@ -103,11 +233,22 @@ common::Status IOBinding::BindOutputImpl(const std::string& name, const OrtValue
   return Status::OK();
 }
 
+void IOBinding::SetOutputReadyCallback(const std::string& name, OutputReadyCallback callback) {
+  if (callback) {
+    output_ready_callbacks_[name] = std::move(callback);
+  } else {
+    output_ready_callbacks_.erase(name);
+  }
+}
+
 void IOBinding::ClearOutputs() {
   mapped_output_names_.clear();
   output_names_.clear();
+  output_ready_callbacks_.clear();
   outputs_.clear();
   outputs_device_info_.clear();
+  feeds_fetches_manager_.reset();
+  validated_ = false;
 }
 
 const std::vector<std::string>& IOBinding::GetOutputNames() const { return output_names_; }
@@ -120,6 +261,10 @@ const std::vector<OrtDevice>& IOBinding::GetOutputsDeviceInfo() const {
   return outputs_device_info_;
 }
 
+const std::unordered_map<std::string, IOBinding::OutputReadyCallback>& IOBinding::GetOutputReadyCallbacks() const {
+  return output_ready_callbacks_;
+}
+
 const std::vector<std::string>& IOBinding::GetInputNames() const { return feed_names_; }
 
 const std::vector<OrtValue>& IOBinding::GetInputs() const { return feeds_; }
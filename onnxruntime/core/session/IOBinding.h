@@ -2,10 +2,13 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "core/common/gsl.h"
 #include "core/framework/execution_provider.h"
 #include "core/common/status.h"
 #include "core/graph/basic_types.h"
@@ -14,6 +17,7 @@
 #include "core/common/logging/logging.h"
 
 namespace onnxruntime {
+class FeedsFetchesManager;
 class SessionState;
 /**
  * Input/Output binding.
@@ -49,6 +53,16 @@ class IOBinding {
    */
   common::Status BindInput(const std::string& name, const OrtValue& ml_value);
 
+  /**
+   * Bind a batch of tensors to a single input, concatenating them along axis 0.
+   * The parts may be ragged in their first dimension but must agree on element type and
+   * trailing dimensions. Each part is copied exactly once, directly into a batch buffer
+   * allocated at the location the input is consumed at, so callers batching multiple
+   * requests avoid the intermediate pre-concatenation copy.
+   * Not supported for string tensors.
+   */
+  common::Status BindBatchedInput(const std::string& name, gsl::span<const OrtValue> parts);
+
   /**
    * If the BindInput calls are async this function acts as a barrier to ensure all inputs are fully copied
    * before you call the Run() method. There is no point calling Run() if you're inputs are not ready at the
@@ -71,6 +85,37 @@ class IOBinding {
    */
   common::Status BindOutput(const std::string& name, OrtDevice device = {});
 
+  /**
+   * Bind an output name to a provided pre-allocated OrtValue, requiring that the producing
+   * kernel writes into the provided buffer directly.
+   *
+   * A value bound with BindOutput() whose location does not match the device the output is
+   * produced on is silently filled via a device copy of the internally allocated output at
+   * the end of Run(). This variant instead fails at bind time in that case, so callers that
+   * rely on the output being written in place (e.g. views over large user buffers) get an
+   * error rather than a hidden copy.
+   */
+  common::Status BindOutputInPlace(const std::string& name, const OrtValue& ml_value);
+
+  /**
+   * Callback invoked during Run() as soon as the named output has been produced, before the
+   * remaining outputs complete. Lets callers start post-processing an early output (e.g. a small
+   * classification head) while later ones (e.g. a large feature map) are still being computed.
+   *
+   * The callback runs on an execution thread, so it must be cheap, must not throw and must not
+   * call back into the session. The value it receives lives on the device the output is produced
+   * on; a device-resident value may still require a stream synchronization before the host reads
+   * it. If the run fails, callbacks for outputs that were not produced are never invoked.
+   */
+  using OutputReadyCallback = std::function<void(const OrtValue& value)>;
+
+  /**
+   * Register a callback for an output name, replacing any existing one. An empty callback removes
+   * the registration. The name does not have to be bound yet, but only callbacks whose name is
+   * bound as an output when Run() is called take effect. Cleared by ClearOutputs().
+   */
+  void SetOutputReadyCallback(const std::string& name, OutputReadyCallback callback);
+
   /**
    * This simply collects the outputs obtained after calling Run() inside the @param outputs.
    */
@@ -81,6 +126,14 @@ class IOBinding {
   const std::vector<std::string>& GetInputNames() const;
   const std::vector<OrtValue>& GetInputs() const;
 
+  /**
+   * True once a Run() with this binding has passed input/output validation and no bind since
+   * then changed the bound names or replaced a value with a different type or shape. A validated
+   * binding lets subsequent Run() calls skip the per-feed name/type/shape checks, so steady-state
+   * loops that only swap same-shaped values pay no validation cost.
+   */
+  bool IsValidated() const { return validated_; }
+
   /**
    * Get a CPU allocator from provider for async copy later if the provider supports that
    * If it doesn't support that, return the default allocator from CPU provider
@@ -94,24 +147,45 @@ class IOBinding {
   void ClearOutputs();
   void ClearInputs();
   IOBinding(const SessionState& session_state);
+  ~IOBinding();
 
  private:
   friend InferenceSession;
 
+  // Returns the feeds/fetches manager for the currently bound names, creating it on first use.
+  // The manager is invalidated whenever the set of bound names changes, but survives rebinding
+  // a value to an existing name, so a Run() loop that only swaps values reuses it every step.
+  // IOBinding is stateful and must not be used by concurrent Run() calls.
+  common::Status GetOrCreateFeedsFetchesManager(FeedsFetchesManager*& feeds_fetches_manager);
+
+  // Called by InferenceSession::Run once the bound names, types and shapes have passed validation.
+  void SetValidated() { validated_ = true; }
+
+  // Returns true if replacing a bound value is guaranteed to pass the same validation as the
+  // value it replaces, i.e. both are tensors of the same element type and shape (or both are
+  // unallocated placeholders).
+  static bool SameTypeAndShape(const OrtValue& existing, const OrtValue& replacement);
+
   const SessionState& session_state_;
   std::vector<std::string> feed_names_;
   std::unordered_map<std::string, size_t> mapped_feed_names_;
   std::vector<OrtValue> feeds_;
   std::vector<std::string> output_names_;
   std::unordered_map<std::string, size_t> mapped_output_names_;
+  std::unordered_map<std::string, OutputReadyCallback> output_ready_callbacks_;
   std::vector<OrtValue> outputs_;
   std::vector<OrtDevice> outputs_device_info_;
+  std::unique_ptr<FeedsFetchesManager> feeds_fetches_manager_;
+  bool validated_{false};
 
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IOBinding);
 
   // device info for all outputs. only used by InferenceSession if the output is not pre-allocated.
   const std::vector<OrtDevice>& GetOutputsDeviceInfo() const;
 
+  // callbacks registered via SetOutputReadyCallback, keyed by output name.
+  const std::unordered_map<std::string, OutputReadyCallback>& GetOutputReadyCallbacks() const;
+
   // The implementation for the BindOutput() overloads
   common::Status BindOutputImpl(const std::string& name, const OrtValue& ml_value, OrtDevice device);
 };
@@ -46,6 +46,7 @@ static constexpr uint32_t min_ort_version_with_custom_version = 17;
 #if ENABLE_CUSTOM_OP_API
 static constexpr uint32_t min_ort_version_with_compute_v2_support = 16;
 static constexpr uint32_t min_ort_version_with_shape_inference = 17;
+static constexpr uint32_t min_ort_version_with_prepack_support = 19;
 #endif
 
 #if !defined(DISABLE_FLOAT8_TYPES)
@@ -790,6 +791,22 @@ struct CustomOpKernel : OpKernel {
     op_.KernelDestroy(op_kernel_);
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr /*alloc*/,
+                 bool& is_packed, PrePackedWeights* /*prepacked_weights*/) override {
+    is_packed = false;
+    if (op_.version < min_ort_version_with_prepack_support || !op_.KernelPrePack) {
+      return Status::OK();
+    }
+
+    // wrap the initializer in a non-owning OrtValue for the C callback
+    OrtValue value;
+    value.Init(const_cast<Tensor*>(&tensor), DataTypeImpl::GetType<Tensor>(), [](void*) {});
+    int packed = 0;
+    ORT_RETURN_IF_ERROR(ToStatus(op_.KernelPrePack(op_kernel_, &value, input_idx, &packed)));
+    is_packed = packed != 0;
+    return Status::OK();
+  }
+
   Status Compute(OpKernelContext* ctx) const override {
     if (op_.version >= min_ort_version_with_compute_v2_support &&
         op_.KernelComputeV2) {
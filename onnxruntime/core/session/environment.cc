@@ -137,6 +137,8 @@ Status Environment::CreateAndRegisterAllocator(const OrtMemoryInfo& mem_info, co
     int max_dead_bytes_per_chunk = -1;
     int initial_growth_chunk_size_bytes = -1;
     int64_t max_power_of_two_extend_bytes = -1L;
+    int use_huge_pages = -1;
+    int free_region_idle_timeout_ms = -1;
 
     // override with values from the user supplied arena_cfg object
     if (arena_cfg) {
@@ -154,10 +156,14 @@ Status Environment::CreateAndRegisterAllocator(const OrtMemoryInfo& mem_info, co
       max_dead_bytes_per_chunk = arena_cfg->max_dead_bytes_per_chunk;
       initial_growth_chunk_size_bytes = arena_cfg->initial_growth_chunk_size_bytes;
       max_power_of_two_extend_bytes = arena_cfg->max_power_of_two_extend_bytes;
+      use_huge_pages = arena_cfg->use_huge_pages;
+      free_region_idle_timeout_ms = arena_cfg->free_region_idle_timeout_ms;
     }
 
     OrtArenaCfg l_arena_cfg{max_mem, arena_extend_strategy, initial_chunk_size_bytes, max_dead_bytes_per_chunk,
                             initial_growth_chunk_size_bytes, max_power_of_two_extend_bytes};
+    l_arena_cfg.use_huge_pages = use_huge_pages;
+    l_arena_cfg.free_region_idle_timeout_ms = free_region_idle_timeout_ms;
     AllocatorCreationInfo alloc_creation_info{
         [mem_info](int) { return std::make_unique<CPUAllocator>(mem_info); },
         0,
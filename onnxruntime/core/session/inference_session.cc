@@ -4,6 +4,7 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/session/inference_session.h"
 
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <list>
@@ -37,6 +38,7 @@
 #include "core/framework/utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/optimizer/graph_transformer_utils.h"
 #include "core/optimizer/graph_transformer.h"
 #include "core/optimizer/layout_transformation/layout_transformation.h"
@@ -210,6 +212,147 @@ static bool HasShapeSubgraphNodes(const Graph& graph) {
   return has_shape_nodes && has_cpu_ep_nodes;
 }
 
+// Writes the machine-readable partition report requested via kOrtSessionOptionsPartitionReportFile:
+// per execution provider the assigned node count and the number of disjoint partitions, and each
+// tensor crossing a provider boundary with its size when statically known. The partition count is
+// the number of connected components of same-provider nodes; a fused node is a compiled unit
+// (e.g. one TensorRT engine) and always forms its own partition.
+static Status WritePartitionReport(const Graph& graph, const std::string& file_path) {
+  auto provider_of = [](const Node& node) -> std::string {
+    const auto& provider = node.GetExecutionProviderType();
+    return provider.empty() ? std::string(kCpuExecutionProvider) : provider;
+  };
+
+  // union-find over node indices, merging the endpoints of same-provider edges between
+  // non-fused nodes
+  std::vector<NodeIndex> parent(graph.MaxNodeIndex());
+  for (NodeIndex i = 0; i < parent.size(); ++i) {
+    parent[i] = i;
+  }
+  auto find = [&parent](NodeIndex i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.NodeType() == Node::Type::Fused) {
+      continue;
+    }
+    const std::string provider = provider_of(node);
+    for (auto it = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); it != end; ++it) {
+      const Node& consumer = it->GetNode();
+      if (consumer.NodeType() != Node::Type::Fused && provider_of(consumer) == provider) {
+        parent[find(node.Index())] = find(consumer.Index());
+      }
+    }
+  }
+
+  struct ProviderStats {
+    size_t node_count = 0;
+    std::set<NodeIndex> partitions;
+  };
+  std::map<std::string, ProviderStats> providers;  // ordered so the report is stable across runs
+  for (const auto& node : graph.Nodes()) {
+    auto& stats = providers[provider_of(node)];
+    ++stats.node_count;
+    stats.partitions.insert(find(node.Index()));
+  }
+
+  struct BoundaryTensor {
+    std::string name;
+    std::string producer;
+    std::string consumer;
+    int64_t elements;
+    int64_t bytes;
+  };
+  std::vector<BoundaryTensor> boundaries;
+  std::set<std::pair<std::string, std::string>> seen;  // tensor name + consumer provider
+  int64_t total_known_bytes = 0;
+
+  for (const auto& node : graph.Nodes()) {
+    const std::string provider = provider_of(node);
+    for (auto it = node.OutputEdgesBegin(), end = node.OutputEdgesEnd(); it != end; ++it) {
+      const std::string consumer_provider = provider_of(it->GetNode());
+      if (consumer_provider == provider) {
+        continue;
+      }
+      const NodeArg* def = node.OutputDefs()[it->GetSrcArgIndex()];
+      if (!seen.insert(std::make_pair(def->Name(), consumer_provider)).second) {
+        continue;
+      }
+
+      int64_t elements = -1;
+      int64_t bytes = -1;
+      const auto* shape = def->Shape();
+      if (shape != nullptr) {
+        elements = 1;
+        for (const auto& dim : shape->dim()) {
+          if (!utils::HasDimValue(dim)) {
+            elements = -1;
+            break;
+          }
+          elements *= dim.dim_value();
+        }
+      }
+      if (elements >= 0) {
+        MLDataType ml_type = utils::GetMLDataType(*def);
+        const auto* tensor_type = ml_type != nullptr ? ml_type->AsTensorType() : nullptr;
+        if (tensor_type != nullptr) {
+          bytes = elements * static_cast<int64_t>(tensor_type->GetElementType()->Size());
+          total_known_bytes += bytes;
+        }
+      }
+
+      boundaries.push_back(BoundaryTensor{def->Name(), provider, consumer_provider, elements, bytes});
+    }
+  }
+
+  auto escape = [](const std::string& s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+      if (c == '"' || c == '\\') {
+        out.push_back('\\');
+      }
+      out.push_back(c);
+    }
+    return out;
+  };
+
+  std::ofstream report(file_path, std::ios::trunc);
+  ORT_RETURN_IF(!report, "Failed to open partition report file: ", file_path);
+
+  report << "{\n  \"providers\": [";
+  bool first = true;
+  for (const auto& [provider, stats] : providers) {
+    report << (first ? "" : ",")
+           << "\n    {\"name\": \"" << escape(provider)
+           << "\", \"nodes\": " << stats.node_count
+           << ", \"partitions\": " << stats.partitions.size() << "}";
+    first = false;
+  }
+  report << "\n  ],\n  \"boundary_tensors\": [";
+  first = true;
+  for (const auto& boundary : boundaries) {
+    report << (first ? "" : ",")
+           << "\n    {\"name\": \"" << escape(boundary.name)
+           << "\", \"producer\": \"" << escape(boundary.producer)
+           << "\", \"consumer\": \"" << escape(boundary.consumer)
+           << "\", \"elements\": " << boundary.elements
+           << ", \"bytes\": " << boundary.bytes << "}";
+    first = false;
+  }
+  report << "\n  ],\n  \"boundary_tensor_count\": " << boundaries.size()
+         << ",\n  \"total_known_boundary_bytes\": " << total_known_bytes << "\n}\n";
+
+  report.flush();
+  ORT_RETURN_IF(!report, "Failed to write partition report file: ", file_path);
+  return Status::OK();
+}
+
 Status GetMinimalBuildOptimizationHandling(
     std::string_view config_value, bool saving_ort_format,
     InferenceSession::MinimalBuildOptimizationHandling& minimal_build_optimization_handling) {
@@ -437,6 +580,27 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
   use_per_session_threads_ = session_options.use_per_session_threads;
   force_spinning_stop_between_runs_ = session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigForceSpinningStop, "0") == "1";
 
+  const std::string& batch_split_factor_str =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigBatchSplitFactor, "0");
+  ORT_ENFORCE(TryParseStringWithClassicLocale<int>(batch_split_factor_str, batch_split_factor_) &&
+                  batch_split_factor_ >= 0,
+              "Invalid value for ", kOrtSessionOptionsConfigBatchSplitFactor, ": ", batch_split_factor_str);
+
+  const std::string& run_result_cache_capacity_str =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsRunResultCacheCapacity, "0");
+  ORT_ENFORCE(TryParseStringWithClassicLocale<size_t>(run_result_cache_capacity_str, run_result_cache_capacity_),
+              "Invalid value for ", kOrtSessionOptionsRunResultCacheCapacity, ": ", run_result_cache_capacity_str);
+
+  const std::string& intra_op_thread_quota_str =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpThreadQuota, "0");
+  ORT_ENFORCE(TryParseStringWithClassicLocale<int>(intra_op_thread_quota_str, intra_op_thread_quota_) &&
+                  intra_op_thread_quota_ >= 0,
+              "Invalid value for ", kOrtSessionOptionsConfigIntraOpThreadQuota, ": ", intra_op_thread_quota_str);
+
+  if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseDeterministicCompute, "0") == "1") {
+    session_options_.use_deterministic_compute = true;
+  }
+
   if (use_per_session_threads_) {
     LOGS(*session_logger_, INFO) << "Creating and using per session threadpools since use_per_session_threads_ is true";
     {
@@ -455,8 +619,12 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
         // If the thread pool can use all the processors, then
         // we set affinity of each thread to each processor.
         to.allow_spinning = allow_intra_op_spinning;
+        to.adaptive_spinning =
+            session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigAdaptiveIntraOpSpinning, "0") == "1";
         to.dynamic_block_base_ = std::stoi(session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDynamicBlockBase, "0"));
         LOGS(*session_logger_, INFO) << "Dynamic block base set to " << to.dynamic_block_base_;
+        to.loop_tuning =
+            session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpLoopTuning, "0") == "1";
 
         // Set custom threading functions
         to.custom_create_thread_fn = session_options_.custom_create_thread_fn;
@@ -465,6 +633,10 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
         if (session_options_.config_options.TryGetConfigEntry(kOrtSessionOptionsConfigIntraOpThreadAffinities, to.affinity_str)) {
           ORT_ENFORCE(!to.affinity_str.empty(), "Affinity string must not be empty");
         }
+        to.restrict_to_performance_cores =
+            to.thread_pool_size == 0 && to.affinity_str.empty() &&
+            session_options_.config_options.GetConfigOrDefault(
+                kOrtSessionOptionsConfigIntraOpRestrictToPerformanceCores, "0") == "1";
         to.auto_set_affinity = to.thread_pool_size == 0 &&
                                session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL &&
                                to.affinity_str.empty();
@@ -492,6 +664,8 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
         to.name = inter_thread_pool_name_.c_str();
         to.set_denormal_as_zero = set_denormal_as_zero;
         to.allow_spinning = allow_inter_op_spinning;
+        to.adaptive_spinning =
+            session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigAdaptiveInterOpSpinning, "0") == "1";
         to.dynamic_block_base_ = std::stoi(session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDynamicBlockBase, "0"));
 
         // Set custom threading functions
@@ -520,6 +694,9 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
   }
 
   session_profiler_.Initialize(session_logger_);
+  if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsProfilerCompactEvents, "0") == "1") {
+    session_profiler_.EnableCompactEvents();
+  }
   if (session_options_.enable_profiling) {
     StartProfiling(session_options_.profile_file_prefix);
   }
@@ -920,6 +1097,22 @@ common::Status InferenceSession::LoadWithLoader(std::function<common::Status(std
   return status;
 }
 
+bool InferenceSession::UseProtobufArenaForModelParsing() const {
+  return session_options_.config_options.GetConfigOrDefault(
+             kOrtSessionOptionsConfigUseProtobufArenaForModelParsing, "0") == "1";
+}
+
+concurrency::ThreadPool* InferenceSession::GetShapeInferenceThreadPool() const {
+  const bool parallel_shape_inference = session_options_.config_options.GetConfigOrDefault(
+                                            kOrtSessionOptionsConfigParallelShapeInference, "0") == "1";
+  if (!parallel_shape_inference) {
+    return nullptr;
+  }
+
+  auto* thread_pool = GetInterOpThreadPoolToUse();
+  return thread_pool != nullptr ? thread_pool : GetIntraOpThreadPoolToUse();
+}
+
 common::Status InferenceSession::LoadOnnxModel(const PathString& model_uri) {
   model_location_ = model_uri;
   auto loader = [this](std::shared_ptr<onnxruntime::Model>& model) {
@@ -934,7 +1127,8 @@ common::Status InferenceSession::LoadOnnxModel(const PathString& model_uri) {
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
     return onnxruntime::Model::Load(model_location_, model, HasLocalSchema() ? &custom_schema_registries_ : nullptr,
                                     *session_logger_,
-                                    ModelOptions(true, strict_shape_type_inference));
+                                    ModelOptions(true, strict_shape_type_inference, GetShapeInferenceThreadPool(),
+                                                 UseProtobufArenaForModelParsing()));
   };
 
   common::Status st = LoadWithLoader(loader, "model_loading_uri");
@@ -1020,7 +1214,8 @@ common::Status InferenceSession::Load(const void* model_data, int model_data_len
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
     return onnxruntime::Model::Load(std::move(model_proto), PathString(), model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
-                                    ModelOptions(true, strict_shape_type_inference));
+                                    ModelOptions(true, strict_shape_type_inference, GetShapeInferenceThreadPool(),
+                                                 UseProtobufArenaForModelParsing()));
   };
 
   return LoadWithLoader(loader, "model_loading_array");
@@ -1051,7 +1246,8 @@ common::Status InferenceSession::LoadOnnxModel(ModelProto model_proto) {
     // This call will move model_proto to the constructed model instance
     return onnxruntime::Model::Load(std::move(model_proto), PathString(), model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
-                                    ModelOptions(true, strict_shape_type_inference));
+                                    ModelOptions(true, strict_shape_type_inference, GetShapeInferenceThreadPool(),
+                                                 UseProtobufArenaForModelParsing()));
   };
 
   return LoadWithLoader(loader, "model_loading_proto");
@@ -1084,7 +1280,9 @@ common::Status InferenceSession::Load(std::istream& model_istream, bool allow_re
     const bool strict_shape_type_inference = session_options_.config_options.GetConfigOrDefault(
                                                  kOrtSessionOptionsConfigStrictShapeTypeInference, "0") == "1";
     ModelOptions model_opts(allow_released_opsets_only,
-                            strict_shape_type_inference);
+                            strict_shape_type_inference,
+                            GetShapeInferenceThreadPool(),
+                            UseProtobufArenaForModelParsing());
     return onnxruntime::Model::Load(std::move(model_proto), PathString(), model,
                                     HasLocalSchema() ? &custom_schema_registries_ : nullptr,
                                     *session_logger_, model_opts);
@@ -1116,7 +1314,8 @@ common::Status InferenceSession::Load() {
     // Pass on ownership of the parsed ModelProto to the Model instance (its job here is done by this stage)
     return Model::Load(std::move(this->model_proto_), model_location_, model,
                        HasLocalSchema() ? &custom_schema_registries_ : nullptr, *session_logger_,
-                       ModelOptions(allow_released_opsets_only, strict_shape_type_inference));
+                       ModelOptions(allow_released_opsets_only, strict_shape_type_inference, GetShapeInferenceThreadPool(),
+                                    UseProtobufArenaForModelParsing()));
   };
 
   return LoadWithLoader(loader, "model_loading_from_saved_proto");
@@ -1305,10 +1504,42 @@ static Status LoadOrtModelBytes(const PathString& model_uri,
   return Status::OK();
 }
 
+static Status MapOrtModelBytes(const PathString& model_uri,
+                               gsl::span<const uint8_t>& bytes,
+                               Env::MappedMemoryPtr& mapped_memory) {
+  size_t num_bytes = 0;
+  ORT_RETURN_IF_ERROR(Env::Default().GetFileLength(model_uri.c_str(), num_bytes));
+  ORT_RETURN_IF_ERROR(Env::Default().MapFileIntoMemory(model_uri.c_str(), 0, num_bytes, mapped_memory));
+
+  bytes = gsl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(mapped_memory.get()), num_bytes);
+
+  return Status::OK();
+}
+
 Status InferenceSession::LoadOrtModel(const PathString& model_uri) {
   return LoadOrtModelWithLoader(
       [&]() {
         model_location_ = model_uri;
+
+        // If the user asked for the model bytes to be used directly, map the file instead of reading it
+        // up front. Pages are faulted in as the flatbuffer sections are accessed, so load-time I/O is
+        // proportional to what is touched rather than to the file size.
+        const bool use_ort_model_bytes_directly =
+            session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseORTModelBytesDirectly,
+                                                               "0") == "1";
+        if (use_ort_model_bytes_directly) {
+          auto status = MapOrtModelBytes(model_location_, ort_format_model_bytes_,
+                                         ort_format_model_bytes_mapping_);
+          if (status.IsOK()) {
+            return Status::OK();
+          }
+
+          LOGS(*session_logger_, WARNING) << "Failed to memory map the ORT format model from "
+                                          << ToUTF8String(model_location_) << ": " << status.ErrorMessage()
+                                          << ". Falling back to reading the file.";
+          ort_format_model_bytes_mapping_.reset();
+        }
+
         ORT_RETURN_IF_ERROR(
             LoadOrtModelBytes(model_location_, ort_format_model_bytes_, ort_format_model_bytes_data_holder_));
         return Status::OK();
@@ -1523,6 +1754,22 @@ common::Status InferenceSession::AddPrePackedWeightsContainer(PrepackedWeightsCo
   return Status::OK();
 }
 
+common::Status InferenceSession::AddSharedInitializersContainer(SharedInitializersContainer* shared_initializers_container) {
+  if (shared_initializers_container == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "The provided SharedInitializersContainer instance to be added to the session is null");
+  }
+
+  if (shared_initializers_container_ != nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "The session already has a SharedInitializersContainer instance");
+  }
+
+  shared_initializers_container_ = shared_initializers_container;
+
+  return Status::OK();
+}
+
 namespace {
 Status PartitionOrtFormatModel(onnxruntime::Graph& graph,
                                const ExecutionProviders& providers,
@@ -1641,6 +1888,12 @@ common::Status InferenceSession::Initialize() {
     if (!have_cpu_ep) {
       LOGS(*session_logger_, INFO) << "Adding default CPU execution provider.";
       CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena};
+      epi.use_numa_partitioned_arena =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsUseNumaPartitionedArena, "0") == "1";
+#if !defined(ORT_MINIMAL_BUILD)
+      epi.enable_elementwise_fusion =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableCpuElementwiseFusion, "0") == "1";
+#endif
       auto p_cpu_exec_provider = std::make_unique<CPUExecutionProvider>(epi);
       ORT_RETURN_IF_ERROR_SESSIONID_(RegisterExecutionProvider(std::move(p_cpu_exec_provider)));
       execution_providers_.SetCpuProviderWasImplicitlyAdded(true);
@@ -1668,6 +1921,21 @@ common::Status InferenceSession::Initialize() {
     session_activity_started_ = true;
 #endif
 
+    if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableMlasGemmTuning, "0") == "1") {
+      LOGS(*session_logger_, INFO) << "Probing MLAS SGEMM blocking configurations for this machine.";
+      MlasSgemmTune();
+    }
+
+    if (prepacked_weights_container_ != nullptr) {
+      const std::string prepacked_weights_file_cache_dir =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsPrepackedWeightsFileCacheDirectory, "");
+      if (!prepacked_weights_file_cache_dir.empty()) {
+        LOGS(*session_logger_, INFO) << "Pre-packed weights will be cached on disk under: "
+                                     << prepacked_weights_file_cache_dir;
+        prepacked_weights_container_->SetFileCacheDirectory(ToPathString(prepacked_weights_file_cache_dir));
+      }
+    }
+
     // now that we have all the execution providers, create the session state
     session_state_ = std::make_unique<SessionState>(
         model_->MainGraph(),
@@ -1678,7 +1946,9 @@ common::Status InferenceSession::Initialize() {
         *session_logger_,
         session_profiler_,
         session_options_,
-        prepacked_weights_container_);
+        prepacked_weights_container_,
+        /*parent_allocators*/ nullptr,
+        shared_initializers_container_);
 
     bool use_env_allocators =
         session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigUseEnvAllocators, "0") == "1";
@@ -1801,7 +2071,18 @@ common::Status InferenceSession::Initialize() {
       ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, saving_ort_format));
 
       // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
-      ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      Graph::ResolveOptions resolve_options;
+      resolve_options.shape_inference_thread_pool = GetShapeInferenceThreadPool();
+      ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve(resolve_options));
+
+      // optionally dump a machine-readable report of the partition assignments so deployment
+      // tooling can inspect provider fragmentation without parsing logs
+      const std::string partition_report_file =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsPartitionReportFile, "");
+      if (!partition_report_file.empty()) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(WritePartitionReport(graph, partition_report_file));
+        LOGS(*session_logger_, INFO) << "Partition report written to " << partition_report_file;
+      }
 
       // Currently graph capture is only considered by CUDA EP, TRT EP, ROCM EP and JS EP.
       //
@@ -2021,6 +2302,7 @@ common::Status InferenceSession::Initialize() {
     if (!using_ort_model_bytes_for_initializers_) {
       ort_format_model_bytes_ = gsl::span<const uint8_t>();
       std::vector<uint8_t>().swap(ort_format_model_bytes_data_holder_);
+      ort_format_model_bytes_mapping_.reset();
     }
 
     // once the model is saved, we may remove unnecessary attributes for inference
@@ -2401,10 +2683,305 @@ struct ThreadPoolSpinningSwitch {
 };
 }  // namespace
 
+int InferenceSession::GetGraphAnnotationIdForInputShapes(gsl::span<const std::string> feed_names,
+                                                         gsl::span<const OrtValue> feeds) {
+  std::string signature;
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    if (!feeds[i].IsTensor()) {
+      // Non-tensor feeds have no shape to bucket on.
+      return CachedExecutionProviderForGraphReplay::kGraphAnnotationSkip;
+    }
+
+    signature += feed_names[i];
+    signature += ':';
+    for (int64_t dim : feeds[i].Get<Tensor>().Shape().GetDims()) {
+      signature += std::to_string(dim);
+      signature += 'x';
+    }
+    signature += ';';
+  }
+
+  std::lock_guard<OrtMutex> lock(graph_annotation_mutex_);
+  auto it = graph_annotation_id_by_input_shapes_.find(signature);
+  if (it == graph_annotation_id_by_input_shapes_.end()) {
+    // Ids start at the default annotation id so single-shape traffic behaves as before.
+    const int annotation_id = static_cast<int>(graph_annotation_id_by_input_shapes_.size());
+    it = graph_annotation_id_by_input_shapes_.emplace(std::move(signature), annotation_id).first;
+    LOGS(*session_logger_, INFO) << "Assigned graph annotation id " << annotation_id
+                                 << " to input shape bucket " << it->first;
+  }
+
+  return it->second;
+}
+
+common::Status InferenceSession::TryRunWithBatchSplit(const RunOptions& run_options,
+                                                      gsl::span<const std::string> feed_names,
+                                                      gsl::span<const OrtValue> feeds,
+                                                      gsl::span<const std::string> output_names,
+                                                      std::vector<OrtValue>* p_fetches,
+                                                      bool& handled) {
+  handled = false;
+
+  // Pre-allocated fetches would need to be sliced per replica; keep the mode to the common
+  // serving path where the session allocates the outputs.
+  if (p_fetches == nullptr || !p_fetches->empty() || feeds.empty()) {
+    return Status::OK();
+  }
+
+  // Every feed must be a CPU tensor of a primitive type, and all feeds must agree on the
+  // outermost (batch) dimension with at least one row per replica.
+  int64_t batch_size = -1;
+  for (const auto& feed : feeds) {
+    if (!feed.IsTensor()) {
+      return Status::OK();
+    }
+    const Tensor& tensor = feed.Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString() ||
+        tensor.Shape().NumDimensions() == 0) {
+      return Status::OK();
+    }
+    if (batch_size < 0) {
+      batch_size = tensor.Shape()[0];
+    } else if (tensor.Shape()[0] != batch_size) {
+      return Status::OK();
+    }
+  }
+
+  const int64_t num_splits = batch_split_factor_;
+  if (batch_size < num_splits) {
+    return Status::OK();
+  }
+
+  handled = true;
+
+  // The replica feeds alias the caller's buffers: slicing the outermost dimension of a
+  // contiguous tensor needs no copy. The first batch_size % num_splits replicas take one
+  // extra row.
+  const int64_t rows_per_split = batch_size / num_splits;
+  const int64_t remainder = batch_size % num_splits;
+  std::vector<std::vector<OrtValue>> sub_feeds(static_cast<size_t>(num_splits));
+  int64_t start_row = 0;
+  for (int64_t i = 0; i < num_splits; ++i) {
+    const int64_t rows = rows_per_split + (i < remainder ? 1 : 0);
+    auto& replica_feeds = sub_feeds[static_cast<size_t>(i)];
+    replica_feeds.reserve(feeds.size());
+    for (const auto& feed : feeds) {
+      const Tensor& tensor = feed.Get<Tensor>();
+      const int64_t row_bytes = static_cast<int64_t>(tensor.SizeInBytes()) / batch_size;
+      auto dims = tensor.Shape().AsShapeVector();
+      dims[0] = rows;
+      void* data = static_cast<char*>(const_cast<void*>(tensor.DataRaw())) + start_row * row_bytes;
+      OrtValue sub_value;
+      Tensor::InitOrtValue(tensor.DataType(), TensorShape(dims), data, tensor.Location(), sub_value);
+      replica_feeds.push_back(std::move(sub_value));
+    }
+    start_row += rows;
+  }
+
+  RunOptions replica_run_options = run_options;
+  ORT_RETURN_IF_ERROR(replica_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDisableBatchSplit,
+                                                                        "1"));
+
+  // The replicas are plain concurrent Run() calls against this session, so they share its
+  // weights, allocators and thread pools instead of duplicating them per replica. They are
+  // hosted on the inter-op pool when there is one; otherwise they are dispatched to the
+  // intra-op pool, whose work stealing lets the replica tasks and their nested per-kernel
+  // loops share the same threads.
+  std::vector<std::vector<OrtValue>> sub_fetches(static_cast<size_t>(num_splits));
+  std::vector<Status> sub_statuses(static_cast<size_t>(num_splits));
+  auto* tp = GetInterOpThreadPoolToUse();
+  if (tp == nullptr) {
+    tp = GetIntraOpThreadPoolToUse();
+  }
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_splits), [&](std::ptrdiff_t i) {
+        const auto idx = static_cast<size_t>(i);
+        sub_statuses[idx] = Run(replica_run_options, feed_names, sub_feeds[idx], output_names, &sub_fetches[idx],
+                                /*p_fetches_device_info*/ nullptr);
+      });
+  for (const auto& sub_status : sub_statuses) {
+    ORT_RETURN_IF_ERROR(sub_status);
+  }
+
+  // Concatenate the per-replica outputs along the batch dimension. Outputs that do not carry a
+  // batch dimension cannot be merged; that is a misuse of the mode (see the config key docs)
+  // and is reported rather than papered over.
+  AllocatorPtr allocator = session_state_->GetAllocator(OrtDevice());
+  ORT_RETURN_IF(allocator == nullptr, "No CPU allocator registered to merge the batch split outputs into.");
+  p_fetches->resize(output_names.size());
+  for (size_t j = 0; j < output_names.size(); ++j) {
+    if (!sub_fetches[0][j].IsTensor()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Output ", output_names[j],
+                             " is not a tensor. ", kOrtSessionOptionsConfigBatchSplitFactor,
+                             " requires every output to be a tensor batched on dimension 0.");
+    }
+    const Tensor& first = sub_fetches[0][j].Get<Tensor>();
+    int64_t total_rows = 0;
+    for (int64_t i = 0; i < num_splits; ++i) {
+      const OrtValue& part_value = sub_fetches[static_cast<size_t>(i)][j];
+      if (!part_value.IsTensor()) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Output ", output_names[j],
+                               " is not a tensor. ", kOrtSessionOptionsConfigBatchSplitFactor,
+                               " requires every output to be a tensor batched on dimension 0.");
+      }
+      const Tensor& part = part_value.Get<Tensor>();
+      if (part.DataType() != first.DataType() || part.Location().device.Type() != OrtDevice::CPU ||
+          part.IsDataTypeString() || part.Shape().NumDimensions() == 0 ||
+          part.Shape().Slice(1) != first.Shape().Slice(1)) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Output ", output_names[j],
+                               " is not batched on dimension 0; the batch split replicas cannot be merged.");
+      }
+      total_rows += part.Shape()[0];
+    }
+    auto dims = first.Shape().AsShapeVector();
+    dims[0] = total_rows;
+    OrtValue merged;
+    Tensor::InitOrtValue(first.DataType(), TensorShape(dims), allocator, merged);
+    char* dst = static_cast<char*>(merged.GetMutable<Tensor>()->MutableDataRaw());
+    for (int64_t i = 0; i < num_splits; ++i) {
+      const Tensor& part = sub_fetches[static_cast<size_t>(i)][j].Get<Tensor>();
+      if (part.SizeInBytes() > 0) {
+        memcpy(dst, part.DataRaw(), part.SizeInBytes());
+        dst += part.SizeInBytes();
+      }
+    }
+    (*p_fetches)[j] = std::move(merged);
+  }
+
+  return Status::OK();
+}
+
+bool InferenceSession::LookupRunResultCache(const std::string& key, gsl::span<const std::string> output_names,
+                                            std::vector<OrtValue>& fetches) {
+  std::lock_guard<OrtMutex> lock(run_result_cache_mutex_);
+  auto it = run_result_cache_index_.find(key);
+  if (it == run_result_cache_index_.end()) {
+    return false;
+  }
+
+  const RunResultCacheEntry& entry = it->second->second;
+  if (entry.output_names.size() != output_names.size() ||
+      !std::equal(entry.output_names.begin(), entry.output_names.end(), output_names.begin())) {
+    // the caller reused a key with different outputs; treat it as a miss and let the
+    // execution below refresh the entry
+    return false;
+  }
+
+  run_result_cache_lru_.splice(run_result_cache_lru_.begin(), run_result_cache_lru_, it->second);
+  fetches = entry.fetches;
+  return true;
+}
+
+void InferenceSession::InsertRunResultCache(const std::string& key, gsl::span<const std::string> output_names,
+                                            const std::vector<OrtValue>& fetches) {
+  std::lock_guard<OrtMutex> lock(run_result_cache_mutex_);
+  auto it = run_result_cache_index_.find(key);
+  if (it != run_result_cache_index_.end()) {
+    run_result_cache_lru_.splice(run_result_cache_lru_.begin(), run_result_cache_lru_, it->second);
+  } else {
+    while (run_result_cache_lru_.size() >= run_result_cache_capacity_) {
+      run_result_cache_index_.erase(run_result_cache_lru_.back().first);
+      run_result_cache_lru_.pop_back();
+    }
+    run_result_cache_lru_.emplace_front(key, RunResultCacheEntry{});
+    run_result_cache_index_.emplace(key, run_result_cache_lru_.begin());
+  }
+
+  RunResultCacheEntry& entry = run_result_cache_lru_.front().second;
+  entry.output_names.assign(output_names.begin(), output_names.end());
+  entry.fetches = fetches;
+}
+
 Status InferenceSession::Run(const RunOptions& run_options,
                              gsl::span<const std::string> feed_names, gsl::span<const OrtValue> feeds,
                              gsl::span<const std::string> output_names, std::vector<OrtValue>* p_fetches,
-                             const std::vector<OrtDevice>* p_fetches_device_info) {
+                             const std::vector<OrtDevice>* p_fetches_device_info,
+                             FeedsFetchesManager* cached_feeds_fetches_manager,
+                             bool skip_io_validation,
+                             const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers) {
+  // Serve repeated runs of an unchanged input set straight from the result cache when the caller
+  // keyed this run. Runs with pre-allocated fetches or fetch device info bypass the cache.
+  std::string result_cache_key;
+  bool use_result_cache = false;
+  if (run_result_cache_capacity_ > 0 && p_fetches_device_info == nullptr &&
+      cached_feeds_fetches_manager == nullptr && fetch_notifiers.empty() &&
+      p_fetches != nullptr && p_fetches->empty()) {
+    result_cache_key = run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigResultCacheKey, "");
+    use_result_cache = !result_cache_key.empty();
+    if (use_result_cache && LookupRunResultCache(result_cache_key, output_names, *p_fetches)) {
+      return Status::OK();
+    }
+  }
+
+  // Collapse concurrent runs that the caller fingerprinted as identical: the first run with a
+  // key executes the graph (recursing with the key cleared) and the others wait for its result.
+  // Runs with pre-allocated fetches or fetch device info bypass coalescing, like the result cache.
+  if (p_fetches_device_info == nullptr && cached_feeds_fetches_manager == nullptr &&
+      fetch_notifiers.empty() && p_fetches != nullptr && p_fetches->empty()) {
+    const std::string coalesce_key = run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigCoalesceKey, "");
+    if (!coalesce_key.empty()) {
+      std::shared_ptr<CoalescedRun> coalesced_run;
+      bool is_leader = false;
+      {
+        std::unique_lock<OrtMutex> lock(coalesced_runs_mutex_);
+        auto it = coalesced_runs_.find(coalesce_key);
+        if (it == coalesced_runs_.end()) {
+          coalesced_run = std::make_shared<CoalescedRun>();
+          coalesced_runs_.emplace(coalesce_key, coalesced_run);
+          is_leader = true;
+        } else {
+          coalesced_run = it->second;
+          while (!coalesced_run->completed) {
+            coalesced_run->cv.wait(lock);
+          }
+        }
+      }
+
+      if (is_leader) {
+        RunOptions leader_run_options = run_options;
+        ORT_RETURN_IF_ERROR(leader_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigCoalesceKey, ""));
+        Status run_status = Run(leader_run_options, feed_names, feeds, output_names, p_fetches,
+                                p_fetches_device_info, cached_feeds_fetches_manager, skip_io_validation,
+                                fetch_notifiers);
+        {
+          std::lock_guard<OrtMutex> lock(coalesced_runs_mutex_);
+          coalesced_run->status = run_status;
+          coalesced_run->output_names.assign(output_names.begin(), output_names.end());
+          if (run_status.IsOK()) {
+            coalesced_run->fetches = *p_fetches;
+          }
+          coalesced_run->completed = true;
+          coalesced_runs_.erase(coalesce_key);
+        }
+        coalesced_run->cv.notify_all();
+        return run_status;
+      }
+
+      if (coalesced_run->status.IsOK() &&
+          coalesced_run->output_names.size() == output_names.size() &&
+          std::equal(coalesced_run->output_names.begin(), coalesced_run->output_names.end(),
+                     output_names.begin())) {
+        *p_fetches = coalesced_run->fetches;
+        return Status::OK();
+      }
+      // The leader failed or asked for different outputs under the same key; execute this run
+      // independently rather than sharing a result that does not apply to it.
+    }
+  }
+
+  if (batch_split_factor_ > 1 && p_fetches_device_info == nullptr && cached_feeds_fetches_manager == nullptr &&
+      fetch_notifiers.empty() &&
+      run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigDisableBatchSplit, "0") != "1") {
+    bool handled = false;
+    Status split_status = TryRunWithBatchSplit(run_options, feed_names, feeds, output_names, p_fetches, handled);
+    if (handled) {
+      if (use_result_cache && split_status.IsOK()) {
+        InsertRunResultCache(result_cache_key, output_names, *p_fetches);
+      }
+      return split_status;
+    }
+  }
+
   TimePoint tp;
   if (session_profiler_.IsEnabled()) {
     tp = session_profiler_.Start();
@@ -2428,6 +3005,22 @@ Status InferenceSession::Run(const RunOptions& run_options,
     }
   }
 
+  // When enabled, derive the annotation id from the input shapes so each padded shape bucket gets its own
+  // captured graph. An explicit annotation id in the run options takes precedence. The derived id is
+  // passed to the execution providers through a copy of the run options, since they read it from there.
+  RunOptions run_options_with_graph_annotation;
+  const RunOptions* effective_run_options = &run_options;
+  if (graph_annotation_str.empty() &&
+      cached_execution_provider_for_graph_replay_.IsGraphCaptureEnabled() &&
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsCudaGraphAnnotationFromInputShapes,
+                                                         "0") == "1") {
+    graph_annotation_id = GetGraphAnnotationIdForInputShapes(feed_names, feeds);
+    run_options_with_graph_annotation = run_options;
+    ORT_RETURN_IF_ERROR_SESSIONID_(run_options_with_graph_annotation.config_options.AddConfigEntry(
+        kOrtRunOptionsConfigCudaGraphAnnotation, std::to_string(graph_annotation_id).c_str()));
+    effective_run_options = &run_options_with_graph_annotation;
+  }
+
   // Increment/decrement concurrent_num_runs_ and control
   // session threads spinning as configured. Do nothing for graph replay except the counter.
   const bool control_spinning = use_per_session_threads_ &&
@@ -2459,8 +3052,10 @@ Status InferenceSession::Run(const RunOptions& run_options,
       // log evaluation start to trace logging provider
       env.GetTelemetryProvider().LogEvaluationStart();
 
-      ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
-      ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
+      if (!skip_io_validation) {
+        ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
+        ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
+      }
 
       // shrink certain default memory arenas if the user has requested for it
       const std::string& shrink_memory_arenas =
@@ -2470,8 +3065,14 @@ Status InferenceSession::Run(const RunOptions& run_options,
         ORT_RETURN_IF_ERROR_SESSIONID_(ValidateAndParseShrinkArenaString(shrink_memory_arenas, arenas_to_shrink));
       }
 
-      FeedsFetchesInfo info(feed_names, output_names, session_state_->GetOrtValueNameIdxMap());
-      FeedsFetchesManager feeds_fetches_manager{std::move(info)};
+      std::optional<FeedsFetchesManager> owned_feeds_fetches_manager;
+      if (cached_feeds_fetches_manager == nullptr) {
+        FeedsFetchesInfo info(feed_names, output_names, session_state_->GetOrtValueNameIdxMap());
+        owned_feeds_fetches_manager.emplace(std::move(info));
+      }
+
+      FeedsFetchesManager& feeds_fetches_manager =
+          cached_feeds_fetches_manager != nullptr ? *cached_feeds_fetches_manager : *owned_feeds_fetches_manager;
 
       if (p_fetches_device_info) {
         // populate the target device info. ignored if pre-allocated fetches are provided
@@ -2501,8 +3102,8 @@ Status InferenceSession::Run(const RunOptions& run_options,
       // TODO: only call OnRunStart for all providers in-use
       for (auto& xp : execution_providers_) {
         // call OnRunStart and add to exec_providers_to_stop if successful
-        auto start_func = [&xp, &exec_providers_to_stop, &run_options]() {
-          auto status = xp->OnRunStart(run_options);
+        auto start_func = [&xp, &exec_providers_to_stop, effective_run_options]() {
+          auto status = xp->OnRunStart(*effective_run_options);
           if (status.IsOK())
             exec_providers_to_stop.push_back(xp.get());
 
@@ -2528,22 +3129,60 @@ Status InferenceSession::Run(const RunOptions& run_options,
 
 #ifdef ORT_ENABLE_STREAM
       DeviceStreamCollectionHolder device_stream_collection_holder(session_state_.get());
+
+      // apply an optional per-run device memory budget to this run's streams. the budget (and the
+      // accounting behind it) is dropped again when the stream buffers are released in CleanUp.
+      const std::string& device_memory_budget_str =
+          run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigDeviceMemoryBudget, "");
+      if (!device_memory_budget_str.empty() && device_stream_collection_holder.p_ != nullptr) {
+        size_t device_memory_budget_bytes = 0;
+        if (!TryParseStringWithClassicLocale<size_t>(device_memory_budget_str, device_memory_budget_bytes)) {
+          ORT_CHECK_AND_SET_RETVAL(ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Failed to parse ",
+                                                   kOrtRunOptionsConfigDeviceMemoryBudget, ": ",
+                                                   device_memory_budget_str));
+        } else if (device_memory_budget_bytes > 0) {
+          device_stream_collection_holder.p_->SetMemoryBudget(device_memory_budget_bytes);
+        }
+      }
 #endif
 
+      // Apply the requested scheduling priority to parallel loops started from this
+      // thread for the duration of graph execution so concurrent runs with different
+      // priorities can share the intra-op thread pool.
+      std::optional<concurrency::ThreadPool::PriorityScope> priority_scope;
+      const std::string run_priority =
+          run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigRunPriority, "normal");
+      if (run_priority == "low") {
+        priority_scope.emplace(concurrency::ThreadPool::Priority::kLow);
+      } else if (run_priority == "high") {
+        priority_scope.emplace(concurrency::ThreadPool::Priority::kHigh);
+      } else if (run_priority != "normal") {
+        ORT_CHECK_AND_SET_RETVAL(ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                                                 kOrtRunOptionsConfigRunPriority, ": ", run_priority));
+      }
+
+      // A session-level quota caps how many workers this session's loops fan out to, so one
+      // session cannot saturate a thread pool shared between sessions.
+      std::optional<concurrency::ThreadPool::ParallelismCapScope> quota_scope;
+      if (intra_op_thread_quota_ > 0) {
+        quota_scope.emplace(intra_op_thread_quota_);
+      }
+
       if (retval.IsOK()) {
         retval = utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
                                      session_options_.execution_mode,
-                                     run_options,
+                                     *effective_run_options,
 #ifdef ORT_ENABLE_STREAM
                                      device_stream_collection_holder,
 #endif
-                                     run_logger);
+                                     run_logger,
+                                     fetch_notifiers);
       }
 
       // info all execution providers InferenceSession:Run ended
       for (auto* xp : exec_providers_to_stop) {
         bool synchronize_execution_providers = run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigDisableSynchronizeExecutionProviders, "0") == "0";
-        auto status = xp->OnRunEnd(synchronize_execution_providers, run_options);
+        auto status = xp->OnRunEnd(synchronize_execution_providers, *effective_run_options);
         ORT_CHECK_AND_SET_RETVAL(status);
       }
 
@@ -2608,8 +3247,14 @@ Status InferenceSession::Run(const RunOptions& run_options,
       cached_execution_provider_for_graph_replay_.AllowGraphCaptureOnRun(graph_annotation_id) &&
       !cached_execution_provider_for_graph_replay_.IsGraphCaptured(graph_annotation_id)) {
     LOGS(*session_logger_, INFO) << "Start another run for necessary memory allocation or graph capture.";
-    ORT_RETURN_IF_ERROR(Run(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info));
+    ORT_RETURN_IF_ERROR(Run(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info,
+                            cached_feeds_fetches_manager));
   }
+
+  if (use_result_cache && retval.IsOK()) {
+    InsertRunResultCache(result_cache_key, output_names, *p_fetches);
+  }
+
   return retval;
 }
 
@@ -2692,9 +3337,16 @@ common::Status InferenceSession::RunAsync(const RunOptions* run_options,
                                           RunAsyncCallbackFn callback,
                                           void* user_data) {
   size_t num_fetches = fetch_names.size();
-  auto* tp = GetIntraOpThreadPoolToUse();
+  // Prefer dispatching on the inter-op pool: it exists to orchestrate concurrent executions,
+  // and keeping async runs off the intra-op pool leaves the compute threads free for the
+  // kernels the run is about to schedule.
+  auto* tp = GetInterOpThreadPoolToUse();
+  if (!tp) {
+    tp = GetIntraOpThreadPoolToUse();
+  }
   if (!tp || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2) {
-    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "intra op thread pool must have at least one thread for RunAsync");
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "a thread pool with at least one thread is required for RunAsync");
   }
   std::function<void()> run_fn = [=]() {
     Status status = Status::OK();
@@ -2808,8 +3460,37 @@ common::Status InferenceSession::NewIOBinding(std::unique_ptr<IOBinding>* io_bin
 common::Status InferenceSession::Run(const RunOptions& run_options, IOBinding& io_binding) {
   // TODO should Run() call io_binding.SynchronizeInputs() or should it let the callers do it?
   // io_binding.SynchronizeInputs();
-  return Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
-             &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo());
+
+  // Reuse the binding's feeds/fetches manager across calls, so loops that Run() once per step
+  // (e.g. token generation with bound past/present values) skip the per-Run name resolution.
+  FeedsFetchesManager* feeds_fetches_manager = nullptr;
+  ORT_RETURN_IF_ERROR(io_binding.GetOrCreateFeedsFetchesManager(feeds_fetches_manager));
+
+  // A binding that passed validation on an earlier run and has only been rebound with
+  // same-typed, same-shaped values since does not need to be validated again.
+  const bool skip_io_validation = io_binding.IsValidated();
+
+  // map any per-output ready callbacks from output name to position in the fetches
+  std::unordered_map<size_t, IExecutor::FetchReadyCallback> fetch_notifiers;
+  const auto& output_ready_callbacks = io_binding.GetOutputReadyCallbacks();
+  if (!output_ready_callbacks.empty()) {
+    const auto& output_names = io_binding.GetOutputNames();
+    for (size_t i = 0, end = output_names.size(); i < end; ++i) {
+      auto it = output_ready_callbacks.find(output_names[i]);
+      if (it != output_ready_callbacks.end()) {
+        fetch_notifiers.emplace(i, it->second);
+      }
+    }
+  }
+
+  auto status = Run(run_options, io_binding.GetInputNames(), io_binding.GetInputs(), io_binding.GetOutputNames(),
+                    &io_binding.GetOutputs(), &io_binding.GetOutputsDeviceInfo(), feeds_fetches_manager,
+                    skip_io_validation, fetch_notifiers);
+  if (status.IsOK()) {
+    io_binding.SetValidated();
+  }
+
+  return status;
 }
 
 common::Status InferenceSession::Run(IOBinding& io_binding) {
@@ -2817,6 +3498,191 @@ common::Status InferenceSession::Run(IOBinding& io_binding) {
   return Run(run_options, io_binding);
 }
 
+common::Status InferenceSession::WarmUp(const WarmUpOptions& options) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  if (options.prefault_initializers) {
+    // Read one byte per page of each CPU initializer so the first inference does not stall on weights
+    // that are still backed by the (possibly memory-mapped) model file. The volatile sink keeps the
+    // loads from being optimized away.
+    constexpr size_t kPageSize = 4096;
+    volatile unsigned char sink = 0;
+    for (const auto& entry : session_state_->GetInitializedTensors()) {
+      const OrtValue& ort_value = entry.second;
+      if (!ort_value.IsAllocated() || !ort_value.IsTensor()) {
+        continue;
+      }
+      const Tensor& tensor = ort_value.Get<Tensor>();
+      if (tensor.Location().device.Type() != OrtDevice::CPU || tensor.IsDataTypeString()) {
+        continue;
+      }
+      const auto* data = static_cast<const unsigned char*>(tensor.DataRaw());
+      const size_t num_bytes = tensor.SizeInBytes();
+      if (data == nullptr || num_bytes == 0) {
+        continue;
+      }
+      for (size_t offset = 0; offset < num_bytes; offset += kPageSize) {
+        sink ^= data[offset];
+      }
+      sink ^= data[num_bytes - 1];
+    }
+  }
+
+  if (options.shape_signatures.empty() || options.dry_runs_per_signature <= 0) {
+    return Status::OK();
+  }
+
+  const Graph& graph = model_->MainGraph();
+
+  std::vector<std::string> output_names;
+  output_names.reserve(graph.GetOutputs().size());
+  for (const NodeArg* output_def : graph.GetOutputs()) {
+    output_names.push_back(output_def->Name());
+  }
+
+  AllocatorPtr cpu_allocator = session_state_->GetAllocator(OrtDevice());
+  ORT_RETURN_IF(cpu_allocator == nullptr, "No CPU allocator available for warm-up feeds.");
+
+  RunOptions run_options;
+  run_options.run_tag = "warmup";
+
+  for (const auto& signature : options.shape_signatures) {
+    NameMLValMap feeds;
+    feeds.reserve(graph.GetInputs().size());
+    for (const NodeArg* input_def : graph.GetInputs()) {
+      auto shape_it = signature.find(input_def->Name());
+      ORT_RETURN_IF(shape_it == signature.end(),
+                    "Warm-up shape signature is missing model input: ", input_def->Name());
+
+      const auto* type_proto = input_def->TypeAsProto();
+      ORT_RETURN_IF(type_proto == nullptr || !type_proto->has_tensor_type(),
+                    "Warm-up only supports tensor inputs: ", input_def->Name());
+      const auto elem_type = type_proto->tensor_type().elem_type();
+      ORT_RETURN_IF(elem_type == ONNX_NAMESPACE::TensorProto_DataType_STRING,
+                    "Warm-up does not support string inputs: ", input_def->Name());
+
+      MLDataType element_type = DataTypeImpl::TensorTypeFromONNXEnum(elem_type)->GetElementType();
+      OrtValue feed;
+      Tensor::InitOrtValue(element_type, TensorShape(shape_it->second), cpu_allocator, feed);
+      Tensor& tensor = *feed.GetMutable<Tensor>();
+      if (tensor.SizeInBytes() > 0) {
+        memset(tensor.MutableDataRaw(), 0, tensor.SizeInBytes());
+      }
+      feeds.emplace(input_def->Name(), std::move(feed));
+    }
+
+    // The dry runs populate whatever the session caches per shape signature: memory patterns, cached
+    // CUDA graphs, transient allocations in the arena, etc.
+    for (int i = 0; i < options.dry_runs_per_signature; ++i) {
+      std::vector<OrtValue> fetches;
+      ORT_RETURN_IF_ERROR(Run(run_options, feeds, output_names, &fetches));
+    }
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::PrewarmShape(const std::map<std::string, std::vector<int64_t>>& shape_signature) {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  const Graph& graph = model_->MainGraph();
+
+  AllocatorPtr cpu_allocator = session_state_->GetAllocator(OrtDevice());
+  ORT_RETURN_IF(cpu_allocator == nullptr, "No CPU allocator available for pre-warm feeds.");
+
+  // Materialize zero-filled feeds for the hinted shapes. They serve as the memory pattern cache key
+  // and, if the signature has not been seen yet, as inputs to the tracing dry run.
+  std::vector<std::string> feed_names;
+  std::vector<OrtValue> feeds;
+  InlinedVector<int> feed_mlvalue_idxs;
+  feed_names.reserve(graph.GetInputs().size());
+  feeds.reserve(graph.GetInputs().size());
+  feed_mlvalue_idxs.reserve(graph.GetInputs().size());
+  for (const NodeArg* input_def : graph.GetInputs()) {
+    auto shape_it = shape_signature.find(input_def->Name());
+    ORT_RETURN_IF(shape_it == shape_signature.end(),
+                  "Pre-warm shape signature is missing model input: ", input_def->Name());
+
+    const auto* type_proto = input_def->TypeAsProto();
+    ORT_RETURN_IF(type_proto == nullptr || !type_proto->has_tensor_type(),
+                  "Pre-warm only supports tensor inputs: ", input_def->Name());
+    const auto elem_type = type_proto->tensor_type().elem_type();
+    ORT_RETURN_IF(elem_type == ONNX_NAMESPACE::TensorProto_DataType_STRING,
+                  "Pre-warm does not support string inputs: ", input_def->Name());
+
+    int ort_value_idx = -1;
+    ORT_RETURN_IF_ERROR(session_state_->GetOrtValueNameIdxMap().GetIdx(input_def->Name(), ort_value_idx));
+
+    MLDataType element_type = DataTypeImpl::TensorTypeFromONNXEnum(elem_type)->GetElementType();
+    OrtValue feed;
+    Tensor::InitOrtValue(element_type, TensorShape(shape_it->second), cpu_allocator, feed);
+    Tensor& tensor = *feed.GetMutable<Tensor>();
+    if (tensor.SizeInBytes() > 0) {
+      memset(tensor.MutableDataRaw(), 0, tensor.SizeInBytes());
+    }
+    feed_names.push_back(input_def->Name());
+    feeds.push_back(std::move(feed));
+    feed_mlvalue_idxs.push_back(ort_value_idx);
+  }
+
+  if (session_state_->GetEnableMemoryPattern()) {
+    std::shared_ptr<const InlinedHashMap<int, TensorShape>> inferred_shapes;
+    auto mem_patterns = session_state_->GetMemoryPatternGroup(feeds, feed_mlvalue_idxs, inferred_shapes);
+    if (mem_patterns) {
+      // The pattern for this signature is already cached: grow each arena to the pattern's peak now
+      // so ExecutionFrame's pattern buffer allocation is served from an existing region. The
+      // transient allocation is freed right away; the arena keeps the grown regions.
+      for (size_t i = 0; i < mem_patterns->locations.size(); ++i) {
+        const size_t peak_size = mem_patterns->patterns[i].PeakSize();
+        if (peak_size == 0) {
+          continue;
+        }
+        AllocatorPtr alloc = session_state_->GetAllocator(mem_patterns->locations[i]);
+        if (alloc == nullptr || alloc->Info().alloc_type != OrtArenaAllocator) {
+          continue;
+        }
+        ORT_TRY {
+          void* buffer = alloc->Alloc(peak_size);
+          if (buffer != nullptr) {
+            alloc->Free(buffer);
+          }
+        }
+        ORT_CATCH(const std::exception& ex) {
+          // Best effort - the Run itself copes with a failed pattern buffer allocation as well.
+          ORT_HANDLE_EXCEPTION([&]() {
+            LOGS(*session_logger_, WARNING) << "Unable to pre-extend arena "
+                                            << mem_patterns->locations[i].ToString()
+                                            << " to " << peak_size << " bytes: " << ex.what();
+          });
+        }
+      }
+      return Status::OK();
+    }
+  }
+
+  // First time this signature is seen (or memory patterns are disabled) - trace it with one
+  // zero-filled dry run so the pattern is generated and cached for subsequent Runs.
+  std::vector<std::string> output_names;
+  output_names.reserve(graph.GetOutputs().size());
+  for (const NodeArg* output_def : graph.GetOutputs()) {
+    output_names.push_back(output_def->Name());
+  }
+
+  RunOptions run_options;
+  run_options.run_tag = "prewarm";
+  std::vector<OrtValue> fetches;
+  return Run(run_options, feed_names, feeds, output_names, &fetches);
+}
+
 template <typename T>
 void InferenceSession::StartProfiling(const std::basic_string<T>& file_prefix) {
   std::basic_ostringstream<T> ss;
@@ -2855,6 +3721,75 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+common::Status InferenceSession::GetKernelLatencyStatsReport(std::string& report) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  const auto* latency_stats = session_state_->GetKernelLatencyStats();
+  if (latency_stats == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Kernel latency stats are not enabled. Set the session config entry '",
+                           kOrtSessionOptionsKernelLatencySamplingInterval,
+                           "' to a non-zero value to collect them.");
+  }
+
+  report = latency_stats->ReportAsJson();
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetMemoryStatsReport(std::string& report) const {
+  if (!is_inited_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Session was not initialized.");
+  }
+
+  auto device_type_name = [](const OrtDevice& device) {
+    switch (device.Type()) {
+      case OrtDevice::CPU:
+        return "CPU";
+      case OrtDevice::GPU:
+        return "GPU";
+      case OrtDevice::FPGA:
+        return "FPGA";
+      case OrtDevice::NPU:
+        return "NPU";
+      default:
+        return "UNKNOWN";
+    }
+  };
+
+  std::ostringstream ss;
+  ss << "{\"allocators\":[";
+  bool first = true;
+  for (const auto& [device, allocator] : session_state_->GetAllocators()) {
+    AllocatorStats stats;
+    allocator->GetStats(&stats);
+    const OrtMemoryInfo& info = allocator->Info();
+    if (!first) {
+      ss << ",";
+    }
+    first = false;
+    ss << "{\"name\":\"" << info.name << "\""
+       << ",\"device_type\":\"" << device_type_name(device) << "\""
+       << ",\"device_id\":" << device.Id()
+       << ",\"alloc_type\":\"" << (info.alloc_type == OrtArenaAllocator ? "arena" : "device") << "\""
+       << ",\"bytes_in_use\":" << stats.bytes_in_use
+       << ",\"max_bytes_in_use\":" << stats.max_bytes_in_use
+       << ",\"total_allocated_bytes\":" << stats.total_allocated_bytes
+       << ",\"max_alloc_size\":" << stats.max_alloc_size
+       << ",\"num_allocs\":" << stats.num_allocs
+       << ",\"num_reserves\":" << stats.num_reserves
+       << ",\"num_arena_extensions\":" << stats.num_arena_extensions
+       << ",\"num_arena_shrinkages\":" << stats.num_arena_shrinkages
+       << ",\"bytes_limit\":" << stats.bytes_limit
+       << "}";
+  }
+  ss << "]}";
+
+  report = ss.str();
+  return Status::OK();
+}
+
 #if !defined(ORT_MINIMAL_BUILD)
 std::vector<TuningResults> InferenceSession::GetTuningResults() const {
   std::vector<TuningResults> ret;
@@ -2912,6 +3847,78 @@ AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const
   return session_state_->GetAllocator(mem_info);
 }
 
+common::Status InferenceSession::ReleaseUnusedArenaMemory(const std::string& ort_device_list) {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  InlinedVector<AllocatorPtr> arenas_to_shrink;
+  ORT_RETURN_IF_ERROR(ValidateAndParseShrinkArenaString(ort_device_list, arenas_to_shrink));
+  ShrinkMemoryArenas(arenas_to_shrink);
+  return Status::OK();
+}
+
+common::Status InferenceSession::DefragmentArenaMemory(const std::string& ort_device_list) {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  InlinedVector<AllocatorPtr> arenas_to_defragment;
+  ORT_RETURN_IF_ERROR(ValidateAndParseShrinkArenaString(ort_device_list, arenas_to_defragment));
+
+  for (auto& alloc : arenas_to_defragment) {
+    auto status = static_cast<BFCArena*>(alloc.get())->Defragment();
+
+    if (!status.IsOK()) {
+      LOGS(*session_logger_, WARNING) << "Unable to defragment arena: " << alloc->Info().ToString()
+                                      << " error message: " << status.ErrorMessage();
+    }
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::ResetState() {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  ORT_RETURN_IF(current_num_runs_.load() > 0,
+                "ResetState must not be called while Run() calls are in flight.");
+
+  // drop the memory pattern and inferred shape caches built for the input shapes seen so far
+  session_state_->ClearMemoryPatternCache();
+
+  // return transient chunks of every arena based allocator back to the system.
+  // only regions with no live allocation are freed, so initializers stay resident.
+  InlinedVector<AllocatorPtr> arenas_to_shrink;
+  for (const auto& entry : session_state_->GetAllocators()) {
+    if (entry.second->Info().alloc_type == OrtAllocatorType::OrtArenaAllocator) {
+      arenas_to_shrink.push_back(entry.second);
+    }
+  }
+  ShrinkMemoryArenas(arenas_to_shrink);
+
+  // discard profiling events buffered by previous runs
+  if (session_profiler_.IsEnabled()) {
+    session_profiler_.DiscardEvents();
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::UpdateInitializedTensors(const NameMLValMap& delta) {
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  return session_state_->UpdateInitializedTensors(delta);
+}
+
 common::Status InferenceSession::ValidateAndParseShrinkArenaString(const std::string& ort_device_list,
                                                                    /*out*/ InlinedVector<AllocatorPtr>& arenas_to_shrink) const {
   arenas_to_shrink.reserve(5);  // Allocate some memory for the container (we are unlikely to see more than 5 memory arena shrink requests)
@@ -3105,8 +4112,20 @@ common::Status InferenceSession::AddPredefinedTransformers(
     GraphTransformerManager& transformer_manager,
     TransformerLevel graph_optimization_level,
     MinimalBuildOptimizationHandling minimal_build_optimization_handling,
-    RecordRuntimeOptimizationProducedNodeOpSchemaFn record_runtime_optimization_produced_op_schema_fn) const {
+    RecordRuntimeOptimizationProducedNodeOpSchemaFn record_runtime_optimization_produced_op_schema_fn) {
   const auto& cpu_ep = *execution_providers_.Get(onnxruntime::kCpuExecutionProvider);
+
+  // Opt-in: fold constant subgraphs on the first non-CPU provider when it has the required kernels.
+  IExecutionProvider* device_ep_for_constant_folding = nullptr;
+  if (session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableDeviceConstantFolding, "0") == "1") {
+    for (const auto& provider_id : execution_providers_.GetIds()) {
+      if (provider_id != onnxruntime::kCpuExecutionProvider) {
+        device_ep_for_constant_folding = execution_providers_.Get(provider_id);
+        break;
+      }
+    }
+  }
+
   for (int i = static_cast<int>(TransformerLevel::Level1); i <= static_cast<int>(TransformerLevel::MaxLevel); i++) {
     TransformerLevel level = static_cast<TransformerLevel>(i);
     if (graph_optimization_level >= level) {
@@ -3118,7 +4137,8 @@ common::Status InferenceSession::AddPredefinedTransformers(
 
         if (use_full_build_optimizations) {
           return optimizer_utils::GenerateTransformers(level, session_options_, cpu_ep,
-                                                       optimizers_to_disable_);
+                                                       optimizers_to_disable_,
+                                                       device_ep_for_constant_folding);
         } else {
           const auto sat_context =
               minimal_build_optimization_handling ==
@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <list>
 #include <map>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "core/common/common.h"
 #include "core/common/inlined_containers.h"
@@ -19,6 +21,8 @@
 #include "core/framework/iexecutor.h"
 #include "core/framework/kernel_registry_manager.h"
 #include "core/framework/prepacked_weights_container.h"
+#include "core/framework/shared_initializers_container.h"
+#include "core/platform/env.h"
 #include "core/framework/session_state.h"
 #include "core/framework/tuning_results.h"
 #include "core/framework/framework_provider_common.h"
@@ -43,6 +47,7 @@ class ModelProto;
 namespace onnxruntime {  // forward declarations
 class CustomRegistry;
 class Environment;
+class FeedsFetchesManager;
 class GraphTransformer;
 class IExecutionProvider;
 class IOBinding;
@@ -76,6 +81,25 @@ struct ModelMetadata {
   std::unordered_map<std::string, std::string> custom_metadata_map;
 };
 
+/**
+ * Options for InferenceSession::WarmUp.
+ */
+struct WarmUpOptions {
+  // Input-shape signatures to prime, one entry per signature, mapping each model input name to the
+  // concrete dimensions to use. Symbolic dimensions must be resolved to values by the caller. For each
+  // signature the session executes dry runs with zero-filled inputs, which faults in the code paths and,
+  // when memory pattern optimization is enabled, plans and caches the allocation pattern for that
+  // signature so real requests skip planning.
+  std::vector<std::map<std::string, std::vector<int64_t>>> shape_signatures;
+
+  // Number of dry runs to execute per shape signature.
+  int dry_runs_per_signature{1};
+
+  // Touch every page of the CPU-resident initializer buffers so weights loaded lazily (e.g. from
+  // memory-mapped external data files) are faulted in before the first request.
+  bool prefault_initializers{true};
+};
+
 /**
  * @brief This is the main class used to Run a model.
  * Sample simple usage:
@@ -322,10 +346,21 @@ class InferenceSession {
    */
   [[nodiscard]] common::Status Initialize();
 
+  // cached_feeds_fetches_manager, if provided, must have been created from the same feed and output names and is
+  // reused instead of resolving the names again. Callers running the model in a loop (e.g. one Run() per generated
+  // token) can keep one instance alive across calls to avoid the per-Run setup cost.
+  // skip_io_validation may be set when the feeds and fetches are known to have passed validation on an earlier
+  // call with identical names, types and shapes (see IOBinding::IsValidated); the per-feed name/type/shape
+  // checks are then bypassed.
+  // fetch_notifiers optionally maps an index in p_fetches to a callback invoked as soon as that output has
+  // been produced during graph execution (see IExecutor::FetchReadyCallback).
   [[nodiscard]] common::Status Run(const RunOptions& run_options, gsl::span<const std::string> feed_names,
                                    gsl::span<const OrtValue> feeds, gsl::span<const std::string> output_names,
                                    std::vector<OrtValue>* p_fetches,
-                                   const std::vector<OrtDevice>* p_fetches_device_info = nullptr);
+                                   const std::vector<OrtDevice>* p_fetches_device_info = nullptr,
+                                   FeedsFetchesManager* cached_feeds_fetches_manager = nullptr,
+                                   bool skip_io_validation = false,
+                                   const std::unordered_map<size_t, IExecutor::FetchReadyCallback>& fetch_notifiers = {});
 
   [[nodiscard]] common::Status Run(const RunOptions& run_options,
                                    gsl::span<const char* const> feed_names,
@@ -373,6 +408,28 @@ class InferenceSession {
   [[nodiscard]] virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding);
   [[nodiscard]] common::Status Run(IOBinding& io_binding);
 
+  /**
+   * Bring an initialized session to steady-state latency before it serves real requests. Pre-faults
+   * the initializer buffers and optionally executes dry runs with zero-filled inputs for a set of
+   * input-shape signatures; see WarmUpOptions for details. Dry runs go through the regular Run path,
+   * so any side effects a real run has (profiling events, cached memory patterns, lazily created
+   * kernels and streams) apply.
+   * @return OK if the session is initialized and all requested dry runs succeed.
+   */
+  [[nodiscard]] common::Status WarmUp(const WarmUpOptions& options);
+
+  /**
+   * Prepare the session for an upcoming Run whose input shapes are already known, e.g. from a
+   * traffic predictor that sees the next batch before its data arrives. If the memory pattern for
+   * the shape signature is cached, the arenas backing the pattern's locations are grown to its peak
+   * usage so the Run carves its buffers out of existing regions instead of stalling on region
+   * extension (on devices, an allocation such as cudaMalloc). If the shape has not been seen yet,
+   * one zero-filled dry run traces and caches the pattern, like WarmUp would.
+   * @param shape_signature maps every model input name to the concrete dimensions of the next batch.
+   * @return OK if the session is initialized and the pre-warm (including any dry run) succeeds.
+   */
+  [[nodiscard]] common::Status PrewarmShape(const std::map<std::string, std::vector<int64_t>>& shape_signature);
+
 #ifdef ENABLE_TRAINING
   /**
    * Partially run a pre-loaded and pre-intialized model.
@@ -479,6 +536,27 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+   * Serialize the sampled per-kernel latency histograms to JSON.
+   * Only available when the session was created with the config entry
+   * "session.kernel_latency_sampling_interval" set to a non-zero value. Unlike EndProfiling this can
+   * be called at any time, including while Run() calls are in flight, and does not stop collection.
+   * @param report is set to the JSON report on success.
+   * @return OK if the histograms are enabled and the session is initialized.
+   */
+  common::Status GetKernelLatencyStatsReport(std::string& report) const;
+
+  /**
+   * Serialize the statistics of every allocator registered with the session to JSON.
+   * Arena backed allocators collect their counters (bytes in use, peak, arena reservation, ...)
+   * as part of normal operation, so this is cheap enough to poll periodically for telemetry;
+   * allocators that do not track statistics report zeros. May be called at any time, including
+   * while Run() calls are in flight.
+   * @param report is set to the JSON report on success.
+   * @return OK if the session is initialized.
+   */
+  common::Status GetMemoryStatsReport(std::string& report) const;
+
 #if !defined(ORT_MINIMAL_BUILD)
   /**
    * Get the TuningResults of TunableOp for every execution providers.
@@ -512,6 +590,56 @@ class InferenceSession {
    */
   AllocatorPtr GetAllocator(const OrtMemoryInfo& mem_info) const;
 
+  /**
+   * Return unused memory held by the arena based allocators of the given devices back to the system.
+   * Only arena regions with no live allocations are freed, so tensors owned by the session (e.g.
+   * initializers) stay resident and the session remains usable without re-initialization. This
+   * allows an idle session to hand scratch memory to other sessions time-sharing the same device
+   * without waiting for the next Run() to trigger shrinkage via
+   * kOrtRunOptionsConfigEnableMemoryArenaShrinkage.
+   * @param ort_device_list semicolon separated device list, e.g. "cpu:0" or "gpu:0;gpu:1", in the
+   *        same format as the kOrtRunOptionsConfigEnableMemoryArenaShrinkage run config value.
+   */
+  common::Status ReleaseUnusedArenaMemory(const std::string& ort_device_list);
+
+  /**
+   * Defragment the arena based allocators of the given devices by merging allocation regions
+   * that are physically contiguous in device memory and coalescing the free space at their
+   * former boundaries. Long-running sessions with mixed-shape traffic accumulate regions whose
+   * free tails cannot be combined into one large block; this restores large-block availability
+   * without a session restart. No live allocation is moved, so the session stays usable and the
+   * call is safe at any time, but it is most effective at a quiescent point when transient
+   * buffers have been freed.
+   * @param ort_device_list semicolon separated device list, e.g. "cpu:0" or "gpu:0;gpu:1", in the
+   *        same format as the kOrtRunOptionsConfigEnableMemoryArenaShrinkage run config value.
+   */
+  common::Status DefragmentArenaMemory(const std::string& ort_device_list);
+
+  /**
+   * Reset run-accumulated state back to post-Initialize conditions so the session can be
+   * pooled and reused across tenants instead of being created per request. This clears the
+   * cached memory patterns and inferred shapes for the input shapes seen so far, returns
+   * transient arena chunks (anything with no live allocation) to the system for every arena
+   * based allocator of the session, and discards buffered profiling events. The loaded model,
+   * created kernels and pre-packed weights are untouched, so the next Run() behaves like the
+   * first Run() after Initialize() without paying initialization again.
+   * Must not be called while Run() calls are in flight.
+   */
+  common::Status ResetState();
+
+  /**
+   * Replace the values of initialized tensors (weights) in the session with the given named
+   * tensors without re-creating the session. Each entry must name an existing initializer of the
+   * main graph and match its data type and shape; either all entries are applied or none are.
+   * Runs that are in flight when this is called finish with the weights they started with and
+   * subsequent runs pick up the new weights, so traffic does not need to be drained.
+   * Initializers consumed by kernel pre-packing cannot be updated; disable pre-packing
+   * (session config kOrtSessionOptionsConfigDisablePrepacking) for weights that will be
+   * refreshed at runtime.
+   * @param delta map of initializer name to the new value.
+   */
+  common::Status UpdateInitializedTensors(const NameMLValMap& delta);
+
   /**
    *Get InferenceSession logger.
    */
@@ -529,6 +657,14 @@ class InferenceSession {
    */
   Status AddPrePackedWeightsContainer(PrepackedWeightsContainer* prepacked_weights_container);
 
+  /**
+   * Add a SharedInitializersContainer instance to the session so that sessions created from the
+   * same model reference one copy of each CPU placed constant initializer instead of each session
+   * materializing its own.
+   * @param shared_initializers_container SharedInitializersContainer instance
+   */
+  Status AddSharedInitializersContainer(SharedInitializersContainer* shared_initializers_container);
+
  protected:
 #if !defined(ORT_MINIMAL_BUILD)
 
@@ -582,6 +718,13 @@ class InferenceSession {
     }
   }
 
+  // Returns the thread pool Graph::Resolve should use for parallel type/shape inference, or nullptr
+  // when parallel shape inference is not enabled via session config options.
+  onnxruntime::concurrency::ThreadPool* GetShapeInferenceThreadPool() const;
+
+  // Returns true when the session is configured to deserialize the ModelProto into a protobuf arena.
+  bool UseProtobufArenaForModelParsing() const;
+
   /// convenience pointer to logger. should always be the same as session_state_.Logger();
   const logging::Logger* session_logger_;
 
@@ -665,6 +808,37 @@ class InferenceSession {
 
   [[nodiscard]] common::Status WaitForNotification(Notification* p_executor_done, int64_t timeout_in_ms);
 
+  // Shards the feeds into batch_split_factor_ contiguous slices along dimension 0, runs the
+  // slices as concurrent Run() calls against this session and concatenates the per-slice outputs
+  // along dimension 0 into p_fetches (see kOrtSessionOptionsConfigBatchSplitFactor). The slices
+  // alias the caller's feed buffers, so no input copies are made. Sets handled to false without
+  // executing anything when the feeds or fetches do not qualify for splitting, in which case the
+  // caller falls through to the regular unsplit path.
+  [[nodiscard]] common::Status TryRunWithBatchSplit(const RunOptions& run_options,
+                                                    gsl::span<const std::string> feed_names,
+                                                    gsl::span<const OrtValue> feeds,
+                                                    gsl::span<const std::string> output_names,
+                                                    std::vector<OrtValue>* p_fetches,
+                                                    bool& handled);
+
+  // Returns true and fills fetches when the Run() result cache holds key with matching output
+  // names, refreshing the entry's LRU position (see kOrtSessionOptionsRunResultCacheCapacity).
+  bool LookupRunResultCache(const std::string& key, gsl::span<const std::string> output_names,
+                            std::vector<OrtValue>& fetches);
+
+  // Inserts (or refreshes) the Run() result cache entry for key, evicting the least recently
+  // used entries while the cache is above capacity.
+  void InsertRunResultCache(const std::string& key, gsl::span<const std::string> output_names,
+                            const std::vector<OrtValue>& fetches);
+
+  // Returns the graph annotation id assigned to the combination of feed names and shapes, assigning the
+  // next free id when the combination is seen for the first time. Used when
+  // kOrtSessionOptionsCudaGraphAnnotationFromInputShapes is enabled so each padded shape bucket gets its
+  // own captured graph. Returns kGraphAnnotationSkip when a feed is not a tensor, since such runs cannot
+  // be bucketed by shape.
+  int GetGraphAnnotationIdForInputShapes(gsl::span<const std::string> feed_names,
+                                         gsl::span<const OrtValue> feeds);
+
   template <typename T>
   void StartProfiling(const std::basic_string<T>& file_prefix);
 
@@ -692,7 +866,7 @@ class InferenceSession {
       GraphTransformerManager& transformer_manager,
       TransformerLevel graph_optimization_level,
       MinimalBuildOptimizationHandling minimal_build_optimization_handling,
-      RecordRuntimeOptimizationProducedNodeOpSchemaFn record_runtime_optimization_produced_op_schema_fn) const;
+      RecordRuntimeOptimizationProducedNodeOpSchemaFn record_runtime_optimization_produced_op_schema_fn);
 
   common::Status TransformGraph(onnxruntime::Graph& graph, bool saving_model_in_ort_format);
 
@@ -739,6 +913,40 @@ class InferenceSession {
   // Spinning is restarted on the next Run()
   bool force_spinning_stop_between_runs_ = false;
 
+  // Number of concurrent replica executions each Run() is sharded into along the batch dimension,
+  // from kOrtSessionOptionsConfigBatchSplitFactor. Values below 2 disable the mode.
+  int batch_split_factor_ = 0;
+
+  // Quota on the intra-op parallelism of this session's parallel loops, from
+  // kOrtSessionOptionsConfigIntraOpThreadQuota. 0 applies no quota.
+  int intra_op_thread_quota_ = 0;
+
+  // LRU cache of fetched outputs keyed by the caller-provided kOrtRunOptionsConfigResultCacheKey,
+  // with capacity from kOrtSessionOptionsRunResultCacheCapacity (0 disables caching). The most
+  // recently used entry is at the front of the list.
+  struct RunResultCacheEntry {
+    std::vector<std::string> output_names;
+    std::vector<OrtValue> fetches;
+  };
+  size_t run_result_cache_capacity_ = 0;
+  std::list<std::pair<std::string, RunResultCacheEntry>> run_result_cache_lru_;
+  std::unordered_map<std::string, std::list<std::pair<std::string, RunResultCacheEntry>>::iterator>
+      run_result_cache_index_;
+  OrtMutex run_result_cache_mutex_;
+
+  // In-flight runs keyed by the caller-provided kOrtRunOptionsConfigCoalesceKey. The first run
+  // with a key executes the graph; concurrent runs with the same key wait on the entry and share
+  // the leader's fetches. Entries are removed when the leader publishes its result.
+  struct CoalescedRun {
+    bool completed = false;
+    common::Status status = common::Status::OK();
+    std::vector<std::string> output_names;
+    std::vector<OrtValue> fetches;
+    OrtCondVar cv;
+  };
+  std::unordered_map<std::string, std::shared_ptr<CoalescedRun>> coalesced_runs_;
+  OrtMutex coalesced_runs_mutex_;
+
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> thread_pool_;
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> inter_op_thread_pool_;
 
@@ -841,13 +1049,30 @@ class InferenceSession {
   // "session.use_ort_model_bytes_directly" to "1", this will be empty
   std::vector<uint8_t> ort_format_model_bytes_data_holder_;
 
+  // Memory mapping of an ORT format model file. Only set when the session is started with a model_uri
+  // and "session.use_ort_model_bytes_directly" is "1": the file is mapped instead of read into
+  // ort_format_model_bytes_data_holder_, so the OS faults in only the flatbuffer sections that are
+  // actually accessed. Combined with "session.use_ort_model_bytes_for_initializers" this keeps both
+  // load-time I/O and resident memory proportional to what is executed.
+  Env::MappedMemoryPtr ort_format_model_bytes_mapping_;
+
   bool using_ort_model_bytes_for_initializers_{false};
 
+  // Maps an input-shape signature to the graph annotation id captured for that shape bucket.
+  // Only populated when kOrtSessionOptionsCudaGraphAnnotationFromInputShapes is enabled.
+  std::unordered_map<std::string, int> graph_annotation_id_by_input_shapes_;  // GUARDED_BY(graph_annotation_mutex_)
+  mutable onnxruntime::OrtMutex graph_annotation_mutex_;
+
   // Container to store pre-packed weights to share between sessions.
   // The life-cycle of the cache itself is maintained by the user and the user will ensure
   // the cache is valid until any session reliant on it is still in scope.
   PrepackedWeightsContainer* prepacked_weights_container_ = nullptr;
 
+  // Container to store deserialized constant initializers to share between sessions created
+  // from the same model. The life-cycle of the container is maintained by the user and the user
+  // will ensure the container is valid while any session reliant on it is still in scope.
+  SharedInitializersContainer* shared_initializers_container_ = nullptr;
+
   // Cache the EP instance if the user has configured the EP to capture a graph
   // for the model and all the necessary criteria for graph capture has been met.
   // At Run() time, if this member is not nullptr and the captured graph is ready
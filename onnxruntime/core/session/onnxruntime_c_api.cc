@@ -11,9 +11,12 @@
 #include "core/framework/tensor_type_and_shape.h"
 #include "core/framework/utils.h"
 #include <cassert>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <sstream>
+#include <thread>
 
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
@@ -47,6 +50,10 @@ ProviderInfo_CUDA* TryGetProviderInfo_CUDA();
 }
 #endif
 
+#ifdef ENABLE_TRAINING
+#include "core/dlpack/dlpack_converter.h"
+#endif
+
 #ifdef ENABLE_TRAINING_APIS
 #include "orttraining/training_api/include/onnxruntime_training_c_api.h"
 #include "orttraining/training_api/ort_training_apis.h"
@@ -241,6 +248,44 @@ ORT_API_STATUS_IMPL(OrtApis::CreateTensorWithDataAsOrtValue, _In_ const OrtMemor
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::UpdateTensorWithDataAsOrtValue, _Inout_ OrtValue* value,
+                    _In_ const OrtMemoryInfo* info, _Inout_ void* p_data, size_t p_data_len,
+                    _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type) {
+  API_IMPL_BEGIN
+  if (value == nullptr || !value->IsAllocated() || !value->IsTensor()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "value must be an OrtValue holding a tensor");
+  }
+
+  Tensor& tensor = *value->GetMutable<Tensor>();
+  if (tensor.OwnsBuffer()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT,
+                                 "only tensors created over pre-allocated memory can be updated");
+  }
+
+  TensorShape tensor_shape(shape, shape_len);
+  if (std::any_of(tensor_shape.GetDims().begin(), tensor_shape.GetDims().end(), [](int64_t v) { return v < 0; })) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "tried creating tensor with negative value in shape");
+  }
+
+  auto ml_type = DataTypeImpl::TensorTypeFromONNXEnum(type)->GetElementType();
+  size_t size_required = 0;
+  Status status = Tensor::CalculateTensorStorageSize(ml_type, tensor_shape, 0 /*alignment*/, size_required);
+  if (!status.IsOK()) {
+    return ToOrtStatus(status);
+  }
+  if (size_required > p_data_len) {
+    std::ostringstream oss;
+    oss << "not enough space: expected " << size_required << ", got " << p_data_len;
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, oss.str().c_str());
+  }
+
+  // re-initialize the contained Tensor in place. nothing here touches the heap unless the new
+  // shape has too many dimensions for the inlined storage.
+  tensor = Tensor(ml_type, tensor_shape, p_data, *info);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::CreateTensorAsOrtValue, _Inout_ OrtAllocator* allocator,
                     _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type,
                     _Outptr_ OrtValue** out) {
@@ -737,7 +782,8 @@ static ORT_STATUS_PTR CreateSessionAndLoadModel(_In_ const OrtSessionOptions* op
 
 static ORT_STATUS_PTR InitializeSession(_In_ const OrtSessionOptions* options,
                                         _In_ std::unique_ptr<::onnxruntime::InferenceSession>& sess,
-                                        _Inout_opt_ OrtPrepackedWeightsContainer* prepacked_weights_container = nullptr) {
+                                        _Inout_opt_ OrtPrepackedWeightsContainer* prepacked_weights_container = nullptr,
+                                        _Inout_opt_ OrtSharedInitializersContainer* shared_initializers_container = nullptr) {
   // we need to disable mem pattern if DML is one of the providers since DML doesn't have the concept of
   // byte addressable memory
   std::vector<std::unique_ptr<IExecutionProvider>> provider_list;
@@ -760,6 +806,11 @@ static ORT_STATUS_PTR InitializeSession(_In_ const OrtSessionOptions* options,
         reinterpret_cast<PrepackedWeightsContainer*>(prepacked_weights_container)));
   }
 
+  if (shared_initializers_container != nullptr) {
+    ORT_API_RETURN_IF_STATUS_NOT_OK(sess->AddSharedInitializersContainer(
+        reinterpret_cast<SharedInitializersContainer*>(shared_initializers_container)));
+  }
+
   ORT_API_RETURN_IF_STATUS_NOT_OK(sess->Initialize());
 
   return nullptr;
@@ -1052,6 +1103,160 @@ ORT_API_STATUS_IMPL(OrtApis::SynchronizeBoundOutputs, _Inout_ OrtIoBinding* bind
   API_IMPL_END
 }
 
+struct OrtPipelinedRun {
+  // Double buffered run pipeline over one session. A single worker thread executes submitted runs
+  // in submission order; each of the two binding slots alternates between the caller (reading the
+  // previous outputs and binding the next inputs) and the worker (running inference).
+  struct Slot {
+    std::unique_ptr<OrtIoBinding> binding;
+    bool in_flight = false;
+    ::onnxruntime::Status status = ::onnxruntime::Status::OK();
+  };
+
+  OrtPipelinedRun(::onnxruntime::InferenceSession* session,
+                  std::unique_ptr<OrtIoBinding> binding_0, std::unique_ptr<OrtIoBinding> binding_1)
+      : session_(session) {
+    slots_[0].binding = std::move(binding_0);
+    slots_[1].binding = std::move(binding_1);
+    worker_ = std::thread([this] { WorkerLoop(); });
+  }
+
+  ~OrtPipelinedRun() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    worker_cv_.notify_all();
+    worker_.join();
+  }
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(OrtPipelinedRun);
+
+  ::onnxruntime::Status Acquire(OrtIoBinding** binding_out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (acquired_slot_ >= 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "A binding is already acquired. Submit it before acquiring again.");
+    }
+
+    Slot& slot = slots_[next_slot_];
+    done_cv_.wait(lock, [&slot] { return !slot.in_flight; });
+
+    if (!slot.status.IsOK()) {
+      // report the failed run once and free the slot for re-use
+      ::onnxruntime::Status run_status = std::move(slot.status);
+      slot.status = ::onnxruntime::Status::OK();
+      return run_status;
+    }
+
+    acquired_slot_ = next_slot_;
+    *binding_out = slot.binding.get();
+    return ::onnxruntime::Status::OK();
+  }
+
+  ::onnxruntime::Status Submit(const OrtRunOptions* run_options) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (acquired_slot_ < 0) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "No binding is acquired. Acquire a binding and bind inputs before submitting.");
+    }
+
+    slots_[acquired_slot_].in_flight = true;
+    queue_.push_back(Job{acquired_slot_, run_options != nullptr ? *run_options : OrtRunOptions{}});
+    next_slot_ = 1 - acquired_slot_;
+    acquired_slot_ = -1;
+    worker_cv_.notify_all();
+    return ::onnxruntime::Status::OK();
+  }
+
+ private:
+  struct Job {
+    int slot;
+    OrtRunOptions run_options;
+  };
+
+  void WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      worker_cv_.wait(lock, [this] { return shutdown_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        // shutdown requested and all submitted runs have drained
+        break;
+      }
+
+      Job job = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+
+      auto status = session_->Run(job.run_options, *slots_[job.slot].binding->binding_);
+
+      lock.lock();
+      slots_[job.slot].in_flight = false;
+      slots_[job.slot].status = std::move(status);
+      done_cv_.notify_all();
+    }
+  }
+
+  ::onnxruntime::InferenceSession* session_;
+  Slot slots_[2];
+  std::deque<Job> queue_;
+  std::mutex mutex_;
+  std::condition_variable worker_cv_;
+  std::condition_variable done_cv_;
+  int next_slot_ = 0;
+  int acquired_slot_ = -1;
+  bool shutdown_ = false;
+  std::thread worker_;
+};
+
+ORT_API_STATUS_IMPL(OrtApis::CreatePipelinedRun, _Inout_ OrtSession* sess, _Outptr_ OrtPipelinedRun** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+
+  std::unique_ptr<::onnxruntime::IOBinding> binding_0;
+  std::unique_ptr<::onnxruntime::IOBinding> binding_1;
+  auto status = session->NewIOBinding(&binding_0);
+  if (status.IsOK()) {
+    status = session->NewIOBinding(&binding_1);
+  }
+  if (!status.IsOK()) {
+    return ToOrtStatus(status);
+  }
+
+  *out = std::make_unique<OrtPipelinedRun>(session,
+                                           std::make_unique<OrtIoBinding>(std::move(binding_0)),
+                                           std::make_unique<OrtIoBinding>(std::move(binding_1)))
+             .release();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::PipelinedRunAcquireBinding, _Inout_ OrtPipelinedRun* pipelined_run,
+                    _Outptr_ OrtIoBinding** binding) {
+  API_IMPL_BEGIN
+  auto status = pipelined_run->Acquire(binding);
+  if (!status.IsOK()) {
+    return ToOrtStatus(status);
+  }
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::PipelinedRunSubmit, _Inout_ OrtPipelinedRun* pipelined_run,
+                    _In_opt_ const OrtRunOptions* run_options) {
+  API_IMPL_BEGIN
+  auto status = pipelined_run->Submit(run_options);
+  if (!status.IsOK()) {
+    return ToOrtStatus(status);
+  }
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API(void, OrtApis::ReleasePipelinedRun, _Frees_ptr_opt_ OrtPipelinedRun* pipelined_run) {
+  delete pipelined_run;
+}
+
 ORT_API_STATUS_IMPL(OrtApis::IsTensor, _In_ const OrtValue* value, _Out_ int* out) {
   auto v = reinterpret_cast<const ::OrtValue*>(value);
   *out = v->IsTensor() ? 1 : 0;
@@ -1363,6 +1568,28 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetKernelLatencyStats, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string report;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetKernelLatencyStatsReport(report));
+  *out = StrDup(report, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionGetMemoryStats, _In_ const OrtSession* sess,
+                    _Inout_ OrtAllocator* allocator, _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string report;
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->GetMemoryStatsReport(report));
+  *out = StrDup(report, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -2229,6 +2456,10 @@ ORT_API_STATUS_IMPL(OrtApis::CreateArenaCfgV2, _In_reads_(num_keys) const char*
       cfg->initial_growth_chunk_size_bytes = static_cast<int>(arena_config_values[i]);
     } else if (strcmp(arena_config_keys[i], "max_power_of_two_extend_bytes") == 0) {
       cfg->max_power_of_two_extend_bytes = static_cast<int64_t>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "use_huge_pages") == 0) {
+      cfg->use_huge_pages = static_cast<int>(arena_config_values[i]);
+    } else if (strcmp(arena_config_keys[i], "free_region_idle_timeout_ms") == 0) {
+      cfg->free_region_idle_timeout_ms = static_cast<int>(arena_config_values[i]);
     } else {
       std::ostringstream oss;
       oss << "Invalid key found: " << arena_config_keys[i];
@@ -2309,6 +2540,137 @@ ORT_API_STATUS_IMPL(OrtApis::CreateSessionFromArrayWithPrepackedWeightsContainer
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::CreateSharedInitializersContainer, _Outptr_ OrtSharedInitializersContainer** out) {
+  API_IMPL_BEGIN
+  std::unique_ptr<SharedInitializersContainer> container = std::make_unique<SharedInitializersContainer>();
+  *out = reinterpret_cast<OrtSharedInitializersContainer*>(container.release());
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API(void, OrtApis::ReleaseSharedInitializersContainer, _Frees_ptr_opt_ OrtSharedInitializersContainer* ptr) {
+  delete reinterpret_cast<SharedInitializersContainer*>(ptr);
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateSessionWithSharedInitializersContainer, _In_ const OrtEnv* env, _In_ const ORTCHAR_T* model_path,
+                    _In_ const OrtSessionOptions* options, _Inout_ OrtSharedInitializersContainer* shared_initializers_container,
+                    _Outptr_ OrtSession** out) {
+  API_IMPL_BEGIN
+  std::unique_ptr<onnxruntime::InferenceSession> sess;
+  OrtStatus* status = nullptr;
+  *out = nullptr;
+
+  ORT_TRY {
+    ORT_API_RETURN_IF_ERROR(CreateSessionAndLoadModel(options, env, model_path, nullptr, 0, sess));
+    ORT_API_RETURN_IF_ERROR(InitializeSession(options, sess, nullptr, shared_initializers_container));
+
+    *out = reinterpret_cast<OrtSession*>(sess.release());
+  }
+  ORT_CATCH(const std::exception& e) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      status = OrtApis::CreateStatus(ORT_FAIL, e.what());
+    });
+  }
+
+  return status;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateSessionFromArrayWithSharedInitializersContainer, _In_ const OrtEnv* env,
+                    _In_ const void* model_data, size_t model_data_length,
+                    _In_ const OrtSessionOptions* options, _Inout_ OrtSharedInitializersContainer* shared_initializers_container,
+                    _Outptr_ OrtSession** out) {
+  API_IMPL_BEGIN
+  std::unique_ptr<onnxruntime::InferenceSession> sess;
+  OrtStatus* status = nullptr;
+  *out = nullptr;
+
+  ORT_TRY {
+    ORT_API_RETURN_IF_ERROR(CreateSessionAndLoadModel(options, env, nullptr, model_data,
+                                                      model_data_length, sess));
+    ORT_API_RETURN_IF_ERROR(InitializeSession(options, sess, nullptr, shared_initializers_container));
+
+    *out = reinterpret_cast<OrtSession*>(sess.release());
+  }
+  ORT_CATCH(const std::exception& e) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      status = OrtApis::CreateStatus(ORT_FAIL, e.what());
+    });
+  }
+
+  return status;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionReleaseUnusedArenaMemory, _Inout_ OrtSession* sess,
+                    _In_ const char* ort_device_list) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->ReleaseUnusedArenaMemory(ort_device_list));
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::SessionResetState, _Inout_ OrtSession* sess) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  ORT_API_RETURN_IF_STATUS_NOT_OK(session->ResetState());
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateDLPackTensorFromValue, _Inout_ OrtValue* value, _In_opt_ void* consumer_stream,
+                    _Outptr_ void** dlpack_tensor) {
+  API_IMPL_BEGIN
+#ifdef ENABLE_TRAINING
+  if (!value->IsTensor()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "Only tensor OrtValues can be exported through DLPack.");
+  }
+
+  if (consumer_stream != nullptr && value->Get<Tensor>().Location().device.Type() == OrtDevice::GPU) {
+#ifdef USE_CUDA
+    auto* provider_info = TryGetProviderInfo_CUDA();
+    if (provider_info == nullptr) {
+      return OrtApis::CreateStatus(ORT_FAIL, "CUDA execution provider is not available to order consumer_stream.");
+    }
+    ORT_API_RETURN_IF_STATUS_NOT_OK(provider_info->MakeStreamWaitOnDefaultStream(consumer_stream));
+#else
+    return OrtApis::CreateStatus(ORT_NOT_IMPLEMENTED, "consumer_stream is only supported in CUDA enabled builds.");
+#endif
+  }
+
+  *dlpack_tensor = onnxruntime::dlpack::OrtValueToDlpack(*value);
+  return nullptr;
+#else
+  ORT_UNUSED_PARAMETER(value);
+  ORT_UNUSED_PARAMETER(consumer_stream);
+  ORT_UNUSED_PARAMETER(dlpack_tensor);
+  return OrtApis::CreateStatus(ORT_NOT_IMPLEMENTED, "DLPack interop is not supported in this build.");
+#endif
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateValueFromDLPackTensor, _In_ void* dlpack_tensor, bool is_bool_tensor,
+                    _Outptr_ OrtValue** out) {
+  API_IMPL_BEGIN
+#ifdef ENABLE_TRAINING
+  if (dlpack_tensor == nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "dlpack_tensor must not be null.");
+  }
+
+  auto value = std::make_unique<OrtValue>(
+      onnxruntime::dlpack::DlpackToOrtValue(reinterpret_cast<DLManagedTensor*>(dlpack_tensor), is_bool_tensor));
+  *out = value.release();
+  return nullptr;
+#else
+  ORT_UNUSED_PARAMETER(dlpack_tensor);
+  ORT_UNUSED_PARAMETER(is_bool_tensor);
+  ORT_UNUSED_PARAMETER(out);
+  return OrtApis::CreateStatus(ORT_NOT_IMPLEMENTED, "DLPack interop is not supported in this build.");
+#endif
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::GetTensorMemoryInfo, _In_ const OrtValue* value, _Outptr_ const OrtMemoryInfo** memory_info) {
   TENSOR_READ_API_BEGIN
   *memory_info = &tensor.Location();
@@ -2730,6 +3092,22 @@ static constexpr OrtApi ort_api_1_to_19 = {
     &OrtApis::KernelInfoGetAllocator,
     &OrtApis::AddExternalInitializersFromFilesInMemory,
     // End of Version 18 - DO NOT MODIFY ABOVE (see above text for more information)
+
+    &OrtApis::SessionGetKernelLatencyStats,
+    &OrtApis::CreateSharedInitializersContainer,
+    &OrtApis::ReleaseSharedInitializersContainer,
+    &OrtApis::CreateSessionWithSharedInitializersContainer,
+    &OrtApis::CreateSessionFromArrayWithSharedInitializersContainer,
+    &OrtApis::SessionReleaseUnusedArenaMemory,
+    &OrtApis::UpdateTensorWithDataAsOrtValue,
+    &OrtApis::CreatePipelinedRun,
+    &OrtApis::PipelinedRunAcquireBinding,
+    &OrtApis::PipelinedRunSubmit,
+    &OrtApis::ReleasePipelinedRun,
+    &OrtApis::SessionResetState,
+    &OrtApis::CreateDLPackTensorFromValue,
+    &OrtApis::CreateValueFromDLPackTensor,
+    &OrtApis::SessionGetMemoryStats,
 };
 
 // OrtApiBase can never change as there is no way to know what version of OrtApiBase is returned by OrtGetApiBase.
@@ -523,4 +523,40 @@ ORT_API_STATUS_IMPL(SessionOptionsAppendExecutionProvider_VitisAI, _In_ OrtSessi
 ORT_API_STATUS_IMPL(KernelContext_GetScratchBuffer, _In_ const OrtKernelContext* context, _In_ const OrtMemoryInfo* mem_info, _In_ size_t count_or_bytes, _Outptr_ void** out);
 
 ORT_API_STATUS_IMPL(KernelInfoGetAllocator, _In_ const OrtKernelInfo* info, _In_ OrtMemType mem_type, _Outptr_ OrtAllocator** out);
+
+ORT_API_STATUS_IMPL(CreateSharedInitializersContainer, _Outptr_ OrtSharedInitializersContainer** out);
+ORT_API(void, ReleaseSharedInitializersContainer, _Frees_ptr_opt_ OrtSharedInitializersContainer*);
+ORT_API_STATUS_IMPL(CreateSessionWithSharedInitializersContainer, _In_ const OrtEnv* env, _In_ const ORTCHAR_T* model_path,
+                    _In_ const OrtSessionOptions* options, _Inout_ OrtSharedInitializersContainer* shared_initializers_container,
+                    _Outptr_ OrtSession** out);
+ORT_API_STATUS_IMPL(CreateSessionFromArrayWithSharedInitializersContainer, _In_ const OrtEnv* env,
+                    _In_ const void* model_data, size_t model_data_length,
+                    _In_ const OrtSessionOptions* options, _Inout_ OrtSharedInitializersContainer* shared_initializers_container,
+                    _Outptr_ OrtSession** out);
+
+ORT_API_STATUS_IMPL(SessionGetKernelLatencyStats, _In_ const OrtSession* session, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
+
+ORT_API_STATUS_IMPL(SessionReleaseUnusedArenaMemory, _Inout_ OrtSession* session,
+                    _In_ const char* ort_device_list);
+
+ORT_API_STATUS_IMPL(UpdateTensorWithDataAsOrtValue, _Inout_ OrtValue* value, _In_ const OrtMemoryInfo* info,
+                    _Inout_ void* p_data, size_t p_data_len, _In_ const int64_t* shape, size_t shape_len,
+                    ONNXTensorElementDataType type);
+
+ORT_API_STATUS_IMPL(CreatePipelinedRun, _Inout_ OrtSession* session, _Outptr_ OrtPipelinedRun** out);
+ORT_API_STATUS_IMPL(PipelinedRunAcquireBinding, _Inout_ OrtPipelinedRun* pipelined_run,
+                    _Outptr_ OrtIoBinding** binding);
+ORT_API_STATUS_IMPL(PipelinedRunSubmit, _Inout_ OrtPipelinedRun* pipelined_run,
+                    _In_opt_ const OrtRunOptions* run_options);
+ORT_API(void, ReleasePipelinedRun, _Frees_ptr_opt_ OrtPipelinedRun*);
+
+ORT_API_STATUS_IMPL(SessionResetState, _Inout_ OrtSession* session);
+
+ORT_API_STATUS_IMPL(CreateDLPackTensorFromValue, _Inout_ OrtValue* value, _In_opt_ void* consumer_stream,
+                    _Outptr_ void** dlpack_tensor);
+ORT_API_STATUS_IMPL(CreateValueFromDLPackTensor, _In_ void* dlpack_tensor, bool is_bool_tensor,
+                    _Outptr_ OrtValue** out);
+ORT_API_STATUS_IMPL(SessionGetMemoryStats, _In_ const OrtSession* session, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
 }  // namespace OrtApis
@@ -142,6 +142,12 @@ ORT_API_STATUS_IMPL(OrtApis::SessionOptionsAppendExecutionProvider,
     options->provider_factories.push_back(AzureProviderFactoryCreator::Create(provider_options));
 #else
     status = create_not_supported_status();
+#endif
+  } else if (strcmp(provider_name, "REMOTE") == 0) {
+#if defined(USE_REMOTE)
+    options->provider_factories.push_back(RemoteProviderFactoryCreator::Create(provider_options));
+#else
+    status = create_not_supported_status();
 #endif
   } else if (strcmp(provider_name, "JS") == 0) {
 #if defined(USE_JSEP)
@@ -133,6 +133,26 @@ ParQuantizeLinearStd(const float* Input,
   });
 }
 
+/**
+ * @brief Run MlasDequantizeLinear in parallel, with provided thread pool
+ */
+template <typename InputType>
+void ParDequantizeLinearStd(const InputType* Input,
+                            float* Output,
+                            size_t N,
+                            float Scale,
+                            InputType ZeroPoint,
+                            concurrency::ThreadPool* thread_pool) {
+  constexpr std::ptrdiff_t block_size = 128;
+  const std::ptrdiff_t num_blocks = (N + block_size - 1) / block_size;
+  const TensorOpCost unit_cost{static_cast<double>(block_size * sizeof(InputType)), static_cast<double>(block_size * sizeof(float)), static_cast<double>(block_size) * 2.0};
+  concurrency::ThreadPool::TryParallelFor(thread_pool, num_blocks, unit_cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    auto begin_idx = begin * block_size;
+    auto end_idx = std::min(static_cast<std::ptrdiff_t>(N), end * block_size);
+    MlasDequantizeLinear(&(Input[begin_idx]), &(Output[begin_idx]), end_idx - begin_idx, Scale, ZeroPoint);
+  });
+}
+
 /**
  * Defines a function for int4 quantization. Calls MLAS kernel in parallel with the provided thread pool.
  *
@@ -19,7 +19,10 @@ std::ostream& operator<<(std::ostream& os, const OrtThreadPoolParams& params) {
   os << " thread_pool_size: " << params.thread_pool_size;
   os << " auto_set_affinity: " << params.auto_set_affinity;
   os << " allow_spinning: " << params.allow_spinning;
+  os << " adaptive_spinning: " << params.adaptive_spinning;
+  os << " restrict_to_performance_cores: " << params.restrict_to_performance_cores;
   os << " dynamic_block_base_: " << params.dynamic_block_base_;
+  os << " loop_tuning: " << params.loop_tuning;
   os << " stack_size: " << params.stack_size;
   os << " affinity_str: " << params.affinity_str;
   // os << " name: " << (params.name ? params.name : L"nullptr");
@@ -92,6 +95,16 @@ static std::vector<LogicalProcessors> ReadThreadAffinityConfig(const std::string
 static std::unique_ptr<ThreadPool>
 CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   ThreadOptions to;
+  if (options.thread_pool_size <= 0 && options.restrict_to_performance_cores && options.affinity_str.empty()) {
+    // On hybrid CPUs a worker scheduled onto an efficiency core drags every other
+    // shard down to its speed at the next join point, so size the pool to the
+    // performance cores and attach one thread to each of them.
+    auto performance_core_affinities = Env::Default().GetPerformanceCoreThreadAffinities();
+    if (performance_core_affinities.size() > 1) {
+      options.thread_pool_size = static_cast<int>(performance_core_affinities.size());
+      to.affinities = std::move(performance_core_affinities);
+    }
+  }
   if (options.thread_pool_size <= 0) {  // default
     if (options.auto_set_affinity) {
 #ifdef _WIN32
@@ -151,6 +164,8 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   to.custom_thread_creation_options = options.custom_thread_creation_options;
   to.custom_join_thread_fn = options.custom_join_thread_fn;
   to.dynamic_block_base_ = options.dynamic_block_base_;
+  to.adaptive_spinning = options.adaptive_spinning;
+  to.loop_tuning = options.loop_tuning;
   if (to.custom_create_thread_fn) {
     ORT_ENFORCE(to.custom_join_thread_fn, "custom join thread function not set");
   }
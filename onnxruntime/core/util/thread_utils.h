@@ -21,10 +21,28 @@ struct OrtThreadPoolParams {
   // If it is true, the thread pool will spin a while after the queue became empty.
   bool allow_spinning = true;
 
+  // If it is true (and allow_spinning is true), worker threads adapt how long they spin to the
+  // outcome of their recent waits: the spin budget shrinks each time a spin phase expires without
+  // finding work and recovers when work arrives during the spin. This keeps the low wake-up
+  // latency of spinning for busy sessions while stopping the workers of a mostly idle session
+  // from stealing cycles on a machine shared with other workloads.
+  bool adaptive_spinning = false;
+
+  // If it is true and thread_pool_size = 0 and no affinity_str is given, size the thread pool
+  // to the performance (P) cores of a hybrid CPU and attach one thread per performance core.
+  // It has no effect on systems where all cores are of a single type or where the platform
+  // exposes no core-type information.
+  bool restrict_to_performance_cores = false;
+
   // It it is non-negative, thread pool will split a task by a decreasing block size
   // of remaining_of_total_iterations / (num_of_threads * dynamic_block_base_)
   int dynamic_block_base_ = 0;
 
+  // If it is true, cost-model driven parallel loops measure themselves and converge, per
+  // distinct loop signature, on the degree of parallelism that actually runs fastest -
+  // including staying sequential when sharding loses to the dispatch overhead.
+  bool loop_tuning = false;
+
   unsigned int stack_size = 0;
 
   // A utf-8 string of affinity settings, format be like:
@@ -1,26 +1,26 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
-#if defined(USE_CUDA) || defined(USE_ROCM)
-
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/common/tensor_op_test_utils.h"
 #include "test/util/include/default_providers.h"
-#ifdef USE_ROCM
+#if defined(USE_ROCM)
 #include "core/providers/rocm/shared_inc/rocm_utils.h"
-#else
+#elif defined(USE_CUDA)
 #include "core/providers/cuda/shared_inc/cuda_utils.h"
+#else
+#include "contrib_ops/cpu/math/bitmask_dropout.h"
 #endif
 
 namespace onnxruntime {
 namespace contrib {
 namespace test {
 
-#ifdef USE_ROCM
+#if defined(USE_ROCM)
 using onnxruntime::rocm::BitmaskElementType;
 using onnxruntime::rocm::kNumBitsPerBitmaskElement;
-#else
+#elif defined(USE_CUDA)
 using onnxruntime::cuda::BitmaskElementType;
 using onnxruntime::cuda::kNumBitsPerBitmaskElement;
 #endif
@@ -64,6 +64,8 @@ void RunTestForInference(const std::vector<int64_t>& input_dims, bool has_ratio
   test_eps.emplace_back(DefaultCudaExecutionProvider());
 #elif USE_ROCM
   test_eps.emplace_back(DefaultRocmExecutionProvider());
+#else
+  test_eps.emplace_back(DefaultCpuExecutionProvider());
 #endif
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &test_eps);
 }
@@ -125,6 +127,8 @@ void RunTestForTraining(const std::vector<int64_t>& input_dims) {
     dropout_eps.emplace_back(DefaultCudaExecutionProvider());
 #elif USE_ROCM
     dropout_eps.emplace_back(DefaultRocmExecutionProvider());
+#else
+    dropout_eps.emplace_back(DefaultCpuExecutionProvider());
 #endif
     dropout.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &dropout_eps);
 
@@ -148,6 +152,8 @@ void RunTestForTraining(const std::vector<int64_t>& input_dims) {
     bitmask_dropout_eps.emplace_back(DefaultCudaExecutionProvider());
 #elif USE_ROCM
     bitmask_dropout_eps.emplace_back(DefaultRocmExecutionProvider());
+#else
+    bitmask_dropout_eps.emplace_back(DefaultCpuExecutionProvider());
 #endif
     bitmask_dropout.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &bitmask_dropout_eps);
   }
@@ -169,16 +175,19 @@ TEST(BitmaskDropoutTest, InferenceFloatType) { RunTestForInferenceWrapper<float>
 
 TEST(BitmaskDropoutTest, InferenceDoubleType) { RunTestForInferenceWrapper<double>(); }
 
+// The CPU kernel does not support half data (same as the CPU Dropout kernel).
+#if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(BitmaskDropoutTest, InferenceHalfType) { RunTestForInferenceWrapper<MLFloat16>(); }
+#endif
 
 TEST(BitmaskDropoutTest, TrainingFloatType) { RunTestForTrainingWrapper<float>(); }
 
 TEST(BitmaskDropoutTest, TrainingDoubleType) { RunTestForTrainingWrapper<double>(); }
 
+#if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(BitmaskDropoutTest, TrainingHalfType) { RunTestForTrainingWrapper<MLFloat16>(); }
+#endif
 
 }  // namespace test
 }  // namespace contrib
 }  // namespace onnxruntime
-
-#endif
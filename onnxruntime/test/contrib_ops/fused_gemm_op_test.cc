@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Relu maps to an MLAS activation, so this exercises the GEMM epilogue path.
+TEST(FusedGemmOpTest, GemmRelu) {
+  OpTester test("FusedGemm", 1, kMSDomain);
+  test.AddAttribute("activation", "Relu");
+  test.AddInput<float>("A", {2, 3}, {1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f});
+  test.AddInput<float>("B", {3, 2}, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+  test.AddInput<float>("C", {2, 2}, {0.5f, 0.5f, -0.5f, -0.5f});
+  test.AddOutput<float>("Y", {2, 2}, {2.5f, 2.5f, 0.0f, 0.0f});
+  test.Run();
+}
+
+TEST(FusedGemmOpTest, GemmLeakyReluTrans) {
+  OpTester test("FusedGemm", 1, kMSDomain);
+  test.AddAttribute("activation", "LeakyRelu");
+  test.AddAttribute("activation_alpha", 0.5f);
+  test.AddAttribute<int64_t>("transA", 1);
+  test.AddAttribute<int64_t>("transB", 1);
+  test.AddInput<float>("A", {3, 2}, {1.0f, -4.0f, -2.0f, 5.0f, 3.0f, -6.0f});
+  test.AddInput<float>("B", {2, 3}, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+  test.AddInput<float>("C", {2, 2}, {0.5f, 0.5f, -0.5f, -0.5f});
+  test.AddOutput<float>("Y", {2, 2}, {2.5f, 2.5f, -2.75f, -2.75f});
+  test.Run();
+}
+
+// Softsign has no MLAS equivalent, so this exercises the second-pass fallback.
+TEST(FusedGemmOpTest, GemmSoftsign) {
+  OpTester test("FusedGemm", 1, kMSDomain);
+  test.AddAttribute("activation", "Softsign");
+  test.AddInput<float>("A", {2, 3}, {1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f});
+  test.AddInput<float>("B", {3, 2}, {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f});
+  test.AddInput<float>("C", {2, 2}, {0.0f, 0.0f, 0.0f, 0.0f});
+  test.AddOutput<float>("Y", {2, 2}, {2.0f / 3.0f, 2.0f / 3.0f, -5.0f / 6.0f, -5.0f / 6.0f});
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
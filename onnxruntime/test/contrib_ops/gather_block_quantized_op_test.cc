@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/int4.h"
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// int8 table quantized blockwise along axis 1, per-row scales, no zero points.
+TEST(GatherBlockQuantizedOpTest, Int8NoZeroPoints) {
+  OpTester test("GatherBlockQuantized", 1, kMSDomain);
+  test.AddAttribute<int64_t>("gather_axis", 0);
+  test.AddAttribute<int64_t>("quantize_axis", 1);
+  test.AddAttribute<int64_t>("block_size", 16);
+
+  std::vector<int8_t> data(4 * 16);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int8_t>(static_cast<int>(i) - 32);
+  }
+  const std::vector<float> scales{1.0f, 0.5f, 2.0f, 0.25f};
+  const std::vector<int64_t> indices{2, 0};
+
+  std::vector<float> expected;
+  for (int64_t row : indices) {
+    for (int c = 0; c < 16; ++c) {
+      expected.push_back(static_cast<float>(data[static_cast<size_t>(row) * 16 + c]) * scales[static_cast<size_t>(row)]);
+    }
+  }
+
+  test.AddInput<int8_t>("data", {4, 16}, data);
+  test.AddInput<int64_t>("indices", {1, 2}, indices);
+  test.AddInput<float>("scales", {4, 1}, scales);
+  test.AddOutput<float>("output", {1, 2, 16}, expected);
+  test.Run();
+}
+
+// int8 table with zero points, negative index, int32 indices and negative quantize_axis.
+TEST(GatherBlockQuantizedOpTest, Int8ZeroPointsNegativeIndex) {
+  OpTester test("GatherBlockQuantized", 1, kMSDomain);
+  test.AddAttribute<int64_t>("gather_axis", 0);
+  test.AddAttribute<int64_t>("quantize_axis", -1);
+  test.AddAttribute<int64_t>("block_size", 16);
+
+  std::vector<int8_t> data(4 * 16);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int8_t>(static_cast<int>(i) - 32);
+  }
+  const std::vector<float> scales{1.0f, 0.5f, 2.0f, 0.25f};
+  const std::vector<int8_t> zero_points{1, -2, 0, 3};
+  const std::vector<int32_t> indices{-1, 1};  // rows 3 and 1
+
+  std::vector<float> expected;
+  for (int32_t idx : indices) {
+    const size_t row = static_cast<size_t>(idx < 0 ? idx + 4 : idx);
+    for (int c = 0; c < 16; ++c) {
+      expected.push_back(static_cast<float>(data[row * 16 + c] - zero_points[row]) * scales[row]);
+    }
+  }
+
+  test.AddInput<int8_t>("data", {4, 16}, data);
+  test.AddInput<int32_t>("indices", {2}, indices);
+  test.AddInput<float>("scales", {4, 1}, scales);
+  test.AddInput<int8_t>("zero_points", {4, 1}, zero_points);
+  test.AddOutput<float>("output", {2, 16}, expected);
+  test.Run();
+}
+
+// int4 table: two logical elements per byte, per-row scales and zero points.
+TEST(GatherBlockQuantizedOpTest, Int4ZeroPoints) {
+  OpTester test("GatherBlockQuantized", 1, kMSDomain);
+  test.AddAttribute<int64_t>("gather_axis", 0);
+  test.AddAttribute<int64_t>("quantize_axis", 1);
+  test.AddAttribute<int64_t>("block_size", 16);
+
+  // data[r][c] = c - 8, in [-8, 7]
+  std::vector<Int4x2> data;
+  for (int r = 0; r < 2; ++r) {
+    for (int c = 0; c < 16; c += 2) {
+      data.emplace_back(static_cast<int8_t>(c - 8), static_cast<int8_t>(c - 7));
+    }
+  }
+  const std::vector<float> scales{2.0f, 0.5f};
+  const std::vector<Int4x2> zero_points{Int4x2(2, -1)};  // zp[0]=2, zp[1]=-1
+
+  std::vector<float> expected;
+  for (int c = 0; c < 16; ++c) {
+    expected.push_back(static_cast<float>((c - 8) - (-1)) * 0.5f);
+  }
+
+  test.AddInput<Int4x2>("data", {2, 16}, data);
+  test.AddInput<int64_t>("indices", {1}, {1});
+  test.AddInput<float>("scales", {2, 1}, scales);
+  test.AddInput<Int4x2>("zero_points", {2, 1}, zero_points);
+  test.AddOutput<float>("output", {1, 16}, expected);
+  test.Run();
+}
+
+// uint4 table without zero points; multiple blocks per row.
+TEST(GatherBlockQuantizedOpTest, UInt4MultipleBlocks) {
+  OpTester test("GatherBlockQuantized", 1, kMSDomain);
+  test.AddAttribute<int64_t>("gather_axis", 0);
+  test.AddAttribute<int64_t>("quantize_axis", 1);
+  test.AddAttribute<int64_t>("block_size", 16);
+
+  // data[r][c] = (r + c) % 16, two 16-wide blocks per row
+  std::vector<uint8_t> logical(2 * 32);
+  for (int r = 0; r < 2; ++r) {
+    for (int c = 0; c < 32; ++c) {
+      logical[static_cast<size_t>(r) * 32 + c] = static_cast<uint8_t>((r + c) % 16);
+    }
+  }
+  std::vector<UInt4x2> data;
+  for (size_t i = 0; i < logical.size(); i += 2) {
+    data.emplace_back(logical[i], logical[i + 1]);
+  }
+  const std::vector<float> scales{1.0f, 2.0f, 0.5f, 0.25f};  // shape {2, 2}
+
+  std::vector<float> expected;
+  for (int c = 0; c < 32; ++c) {
+    expected.push_back(static_cast<float>(logical[32 + c]) * scales[c < 16 ? 2 : 3]);
+  }
+
+  test.AddInput<UInt4x2>("data", {2, 32}, data);
+  test.AddInput<int64_t>("indices", {1}, {1});
+  test.AddInput<float>("scales", {2, 2}, scales);
+  test.AddOutput<float>("output", {1, 32}, expected);
+  test.Run();
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/contrib_ops/qordered_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// Only the CUDA EP supports ordered quantized ops for now
+#if defined(USE_CUDA)
+
+template <typename T>  // MLFloat16 or float
+static void RunQOrdered_SkipLayerNorm_RowMajor(std::vector<int64_t> const& shape, int axis, float epsilon,
+                                               const std::vector<int8_t>& vec_x, float scale_x,
+                                               const std::vector<int8_t>& vec_skip, float scale_skip,
+                                               const std::vector<T>& gamma, const std::vector<T>* beta,
+                                               float scale_y, const std::vector<int8_t>& vec_y) {
+  std::vector<int64_t> bias_shape = {shape.back()};
+  OpTester test_qorder("QOrderedSkipLayerNormalization", 1, onnxruntime::kMSDomain);
+  test_qorder.AddAttribute("axis", (int64_t)axis);
+  test_qorder.AddAttribute("epsilon", epsilon);
+  test_qorder.AddInput<int8_t>("X", shape, vec_x);
+  test_qorder.AddInput<float>("scale_X", {}, {scale_x});
+  test_qorder.AddInput<int8_t>("skip", shape, vec_skip);
+  test_qorder.AddInput<float>("scale_skip", {}, {scale_skip});
+  test_qorder.AddInput<T>("scale", bias_shape, gamma);
+  if (beta) {
+    test_qorder.AddInput<T>("B", bias_shape, *beta);
+  } else {
+    test_qorder.AddOptionalInputEdge<T>();
+  }
+  test_qorder.AddInput<float>("scale_Y", {}, {scale_y});
+  test_qorder.AddOutput<int8_t>("Y", shape, vec_y, false, 0.0f, 0.0f /* abs error */);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCudaExecutionProvider());
+  test_qorder.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(QOrderedTest, SkipLayerNormalization_RowMajor) {
+  float scale_x = 1.0f / 32.0f;
+  float scale_skip = 1.0f / 64.0f;
+  float scale_y = 1.0f / 16.0f;
+
+  int64_t batch = 2;
+  int64_t sequence = 2;
+  int64_t hidden = 32;
+
+  std::vector<int8_t> vec_x = {
+      115, -71, -72, -33, 116, -106, 27, 82, 62, 104, -44,
+      103, 22, 77, -74, -21, 9, -69, 42, 59, 17, 61,
+      -35, -85, 17, -69, -13, -88, -1, 46, 40, -3,
+
+      20, 47, -90, 2, 76, -67, -54, -116, -64, 24, -101,
+      27, -95, -106, -59, -29, -98, -8, -86, -72, 114, 73,
+      12, 59, 80, -7, 96, -59, 64, -61, -102, -44,
+
+      115, -71, -72, -33, 116, -106, 27, 82, 62, 104, -44,
+      103, 22, 77, -74, -21, 9, -69, 42, 59, 17, 61,
+      -35, -85, 17, -69, -13, -88, -1, 46, 40, -3,
+
+      20, 47, -90, 2, 76, -67, -54, -116, -64, 24, -101,
+      27, -95, -106, -59, -29, -98, -8, -86, -72, 114, 73,
+      12, 59, 80, -7, 96, -59, 64, -61, -102, -44};
+
+  std::vector<int8_t> vec_skip = {
+      -109, 50, 63, 39, -44, 86, -103, -118, -67, -33, 51,
+      -112, -45, -4, -80, 78, -17, -4, -8, 116, 97, 79,
+      67, -85, 100, -26, 47, 44, 12, -103, -115, -57,
+
+      -5, 50, -12, -1, -100, 67, -89, -85, 83, 3, -46,
+      66, -31, -72, -93, 110, -48, 12, 36, 7, -85, 7,
+      -27, -16, 50, 94, 19, -38, -114, -14, -35, 89,
+
+      -109, 50, 63, 39, -44, 86, -103, -118, -67, -33, 51,
+      -112, -45, -4, -80, 78, -17, -4, -8, 116, 97, 79,
+      67, -85, 100, -26, 47, 44, 12, -103, -115, -57,
+
+      -5, 50, -12, -1, -100, 67, -89, -85, 83, 3, -46,
+      66, -31, -72, -93, 110, -48, 12, 36, 7, -85, 7,
+      -27, -16, 50, 94, 19, -38, -114, -14, -35, 89};
+
+  // gamma and beta values are exactly representable in float16 so the same expected
+  // output holds for the float16 and float variants.
+  std::vector<float> gamma_fp32 = {
+      1.016602f, 1.091797f, 1.34668f, 1.026367f, 1.055664f,
+      1.111328f, 0.8291016f, 1.058594f, 1.140625f, 1.254883f,
+      0.7661133f, 0.9125977f, 0.7636719f, 1.266602f, 1.185547f,
+      0.7294922f, 1.387695f, 1.375f, 1.157227f, 1.130859f,
+      0.8100586f, 0.7104492f, 1.070312f, 0.7416992f, 0.8330078f,
+      0.8696289f, 0.7211914f, 1.024414f, 1.008789f, 1.290039f,
+      1.063477f, 1.148438f};
+
+  auto gamma_fp16 = ToFloat16(gamma_fp32);
+
+  std::vector<float> beta_fp32 = {
+      -0.0001000166f, 0.06500244f, -0.0171051f, -0.08868408f, 0.1990967f,
+      0.1982422f, 0.1361084f, 0.08312988f, -0.07391357f, -0.1080933f,
+      -0.08441162f, -0.171875f, 0.1065063f, -0.03979492f, 0.1385498f,
+      -0.04541016f, 0.1832275f, 0.138916f, -0.1998291f, -0.1160889f,
+      0.1640625f, -0.01200104f, 0.1921387f, -0.04098511f, -0.1707764f,
+      0.05178833f, 0.1113892f, -0.09210205f, -0.1650391f, -0.0670166f,
+      0.1855469f, 0.1032104f};
+
+  auto beta_fp16 = ToFloat16(beta_fp32);
+
+  std::vector<int8_t> vec_y = {
+      15, -13, -16, -6, 28, -16, -4, 7, 6, 26, -6,
+      8, 1, 23, -34, 2, 2, -25, 7, 32, 16, 18,
+      2, -26, 11, -19, 3, -20, -2, -4, -3, -9,
+
+      9, 23, -21, 4, 14, 1, -11, -29, -1, 11, -18,
+      13, -12, -32, -18, 7, -26, 8, -14, -13, 19, 15,
+      8, 11, 20, 12, 21, -13, 4, -13, -19, 7,
+
+      15, -13, -16, -6, 28, -16, -4, 7, 6, 26, -6,
+      8, 1, 23, -34, 2, 2, -25, 7, 32, 16, 18,
+      2, -26, 11, -19, 3, -20, -2, -4, -3, -9,
+
+      9, 23, -21, 4, 14, 1, -11, -29, -1, 11, -18,
+      13, -12, -32, -18, 7, -26, 8, -14, -13, 19, 15,
+      8, 11, 20, 12, 21, -13, 4, -13, -19, 7};
+
+  RunQOrdered_SkipLayerNorm_RowMajor({batch, sequence, hidden}, -1, 0.00001f, vec_x, scale_x,
+                                     vec_skip, scale_skip, gamma_fp16, &beta_fp16, scale_y, vec_y);
+
+  RunQOrdered_SkipLayerNorm_RowMajor({batch, sequence, hidden}, -1, 0.00001f, vec_x, scale_x,
+                                     vec_skip, scale_skip, gamma_fp32, &beta_fp32, scale_y, vec_y);
+}
+
+#endif
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace wordpiece_encoder_test {
+
+constexpr const char* domain = onnxruntime::kMSDomain;
+constexpr int opset_ver = 1;
+
+// ids: [PAD]=0 [UNK]=1 [CLS]=2 [SEP]=3 hello=4 world=5 un=6 ##aff=7 ##able=8 !=9
+const std::vector<std::string> vocab{
+    "[PAD]", "[UNK]", "[CLS]", "[SEP]", "hello", "world", "un", "##aff", "##able", "!"};
+
+}  // namespace wordpiece_encoder_test
+
+using namespace wordpiece_encoder_test;
+
+TEST(ContribOpTest, WordpieceEncoderBasicBatch) {
+  // Lowercasing, punctuation splitting, suffix pieces and padding in one batch.
+  OpTester test("WordpieceEncoder", opset_ver, domain);
+  test.AddAttribute("vocab", vocab);
+  test.AddAttribute("max_length", int64_t{7});
+
+  std::vector<int64_t> input_dims{2};
+  test.AddInput<std::string>("X", input_dims, {"Hello world!", "unaffable"});
+
+  std::vector<int64_t> output_dims{2, 7};
+  test.AddOutput<int64_t>("input_ids", output_dims,
+                          {2, 4, 5, 9, 3, 0, 0,
+                           2, 6, 7, 8, 3, 0, 0});
+  test.AddOutput<int64_t>("attention_mask", output_dims,
+                          {1, 1, 1, 1, 1, 0, 0,
+                           1, 1, 1, 1, 1, 0, 0});
+  test.AddOutput<int64_t>("token_type_ids", output_dims,
+                          {0, 0, 0, 0, 0, 0, 0,
+                           0, 0, 0, 0, 0, 0, 0});
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
+TEST(ContribOpTest, WordpieceEncoderUnknownWord) {
+  // A word that cannot be fully segmented becomes a single [UNK],
+  // not one unknown per unmatched piece.
+  OpTester test("WordpieceEncoder", opset_ver, domain);
+  test.AddAttribute("vocab", vocab);
+  test.AddAttribute("max_length", int64_t{6});
+
+  std::vector<int64_t> input_dims{1};
+  test.AddInput<std::string>("X", input_dims, {"unknowable world"});
+
+  std::vector<int64_t> output_dims{1, 6};
+  test.AddOutput<int64_t>("input_ids", output_dims, {2, 1, 5, 3, 0, 0});
+  test.AddOutput<int64_t>("attention_mask", output_dims, {1, 1, 1, 1, 0, 0});
+  test.AddOutput<int64_t>("token_type_ids", output_dims, {0, 0, 0, 0, 0, 0});
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
+TEST(ContribOpTest, WordpieceEncoderTruncation) {
+  // Rows longer than max_length keep the leading pieces and the end token.
+  OpTester test("WordpieceEncoder", opset_ver, domain);
+  test.AddAttribute("vocab", vocab);
+  test.AddAttribute("max_length", int64_t{4});
+
+  std::vector<int64_t> input_dims{1};
+  test.AddInput<std::string>("X", input_dims, {"hello world hello world"});
+
+  std::vector<int64_t> output_dims{1, 4};
+  test.AddOutput<int64_t>("input_ids", output_dims, {2, 4, 5, 3});
+  test.AddOutput<int64_t>("attention_mask", output_dims, {1, 1, 1, 1});
+  test.AddOutput<int64_t>("token_type_ids", output_dims, {0, 0, 0, 0});
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
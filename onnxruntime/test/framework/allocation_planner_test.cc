@@ -1858,6 +1858,39 @@ TEST_F(PlannerTest, TestMultiStreamConfig) {
               graph_partitioner_cpu_gpu->Streams() == 2);
 }
 
+// Two heads sharing a backbone should land in three streams: the shared backbone stream and
+// one stream per head.
+TEST_F(PlannerTest, TestParallelBranchPartitioner) {
+  std::string X("X"), B("B"), H1a("H1a"), H1b("H1b"), H2a("H2a"), H2b("H2b");
+  AddNormalNode(X, B);  // backbone
+  AddNormalNode(B, H1a);
+  AddNormalNode(H1a, H1b);  // head 1
+  AddNormalNode(B, H2a);
+  AddNormalNode(H2a, H2b);  // head 2
+  ASSERT_STATUS_OK(GetGraph().Resolve());
+
+  const char* config_file_path = "./parallel_branch_partitioner.json";
+  {
+    std::ofstream of_stream(config_file_path);
+    of_stream << R"({"type": "ParallelBranchPartitioner"})";
+  }
+
+  auto partitioner = IGraphPartitioner::CreateGraphPartitioner(DefaultLoggingManager().DefaultLogger(),
+                                                               ORT_TSTR("./parallel_branch_partitioner.json"));
+  ASSERT_TRUE(partitioner);
+  ASSERT_STREQ(partitioner->Type(), "ParallelBranchPartitioner");
+
+  onnxruntime::GraphViewer graph_viewer{GetGraph()};
+  std::vector<InlinedVector<NodeIndex>> stream_nodes;
+  ASSERT_STATUS_OK(partitioner->PartitionGraph(graph_viewer, GetExecutionProviders(), stream_nodes,
+                                               ExecutionOrder::DEFAULT));
+  ASSERT_EQ(stream_nodes.size(), 3u);
+  ASSERT_EQ(partitioner->Streams(), 3u);
+  for (const auto& nodes : stream_nodes) {
+    ASSERT_FALSE(nodes.empty());
+  }
+}
+
 // Save partition config to a file and check its completeness
 TEST_F(PlannerTest, TestMultiStreamSaveConfig) {
   const char* config_file_path = "./testdata/multi_stream_models/conv_add_relu_single_stream.json";
@@ -6,6 +6,7 @@
 #include "core/framework/allocator_utils.h"
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+#include <algorithm>
 #include <cstdlib>
 #include "core/framework/stream_handles.h"
 
@@ -307,6 +308,87 @@ TEST(BFCArenaTest, TestShrink) {
   EXPECT_EQ(stats.total_allocated_bytes, 10 * 1024 * 1024) << "Expect 10M bytes but actually " << stats.total_allocated_bytes << " bytes";
 }
 
+TEST(BFCArenaTest, TestFreeRegionIdleTimeout) {
+  AllocatorStats stats;
+  // A zero timeout makes a fully-free region eligible for reclamation as soon as
+  // its last chunk is freed, so no explicit Shrink() call is needed.
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30, ArenaExtendStrategy::kSameAsRequested,
+             BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+             BFCArena::DEFAULT_INITIAL_GROWTH_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_POWER_OF_TWO_EXTEND_BYTES,
+             /*use_huge_pages*/ false,
+             /*free_region_idle_timeout_ms*/ 0);
+  void* p1k = a.Alloc(1024);
+  void* p10M = a.Alloc(10 * 1024 * 1024);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 2) << "Expect 2 regions but got " << stats.num_arena_extensions << " region";
+
+  a.Free(p1k);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 1) << "1 region left as p10M is still in use";
+  EXPECT_EQ(stats.num_arena_shrinkages, 1) << "only the region backing p1k is fully free";
+  EXPECT_EQ(stats.total_allocated_bytes, 10 * 1024 * 1024) << "Expect 10M bytes but actually " << stats.total_allocated_bytes << " bytes";
+
+  a.Free(p10M);
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 0) << "both regions reclaimed once everything is freed";
+  EXPECT_EQ(stats.num_arena_shrinkages, 2);
+  EXPECT_EQ(stats.total_allocated_bytes, 0);
+}
+
+// Hands out consecutive slices of one pre-allocated slab so that successive arena
+// regions are physically contiguous, which is what Defragment() needs to merge them.
+class ContiguousSlabAllocator : public IAllocator {
+ public:
+  explicit ContiguousSlabAllocator(size_t slab_size)
+      : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator)),
+        slab_(std::make_unique<char[]>(slab_size)),
+        slab_size_(slab_size) {}
+
+  void* Alloc(size_t size) override {
+    ORT_ENFORCE(used_ + size <= slab_size_);
+    void* p = slab_.get() + used_;
+    used_ += size;
+    return p;
+  }
+  void Free(void* /*p*/) override {}
+
+ private:
+  std::unique_ptr<char[]> slab_;
+  size_t slab_size_;
+  size_t used_ = 0;
+};
+
+TEST(BFCArenaTest, TestDefragmentMergesContiguousRegions) {
+  constexpr size_t kRegionSize = 256 * 1024;
+  BFCArena a(std::make_unique<ContiguousSlabAllocator>(1 << 20), 1 << 20,
+             ArenaExtendStrategy::kSameAsRequested);
+
+  // Each allocation forces its own region; the slab allocator makes them contiguous.
+  void* p1 = a.Alloc(kRegionSize);
+  void* p2 = a.Alloc(kRegionSize);
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 2);
+
+  a.Free(p1);
+  a.Free(p2);
+
+  // The free chunks live in separate regions and cannot coalesce across the boundary,
+  // so a request spanning both would extend the arena. After Defragment the regions
+  // merge into one and the request is served from the combined free block.
+  EXPECT_EQ(a.Defragment(), Status::OK());
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 1) << "contiguous regions should have merged";
+
+  void* p3 = a.Alloc(2 * kRegionSize);
+  EXPECT_EQ(p3, p1) << "expected the allocation to reuse the merged free block";
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_arena_extensions, 1) << "no new region should be needed";
+  a.Free(p3);
+}
+
 class BadAllocator : public IAllocator {
  public:
   BadAllocator() : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator)) {}
@@ -414,6 +496,48 @@ TEST(StreamAwareArenaTest, TestSecureTheChunk) {
   EXPECT_TRUE(waitFunctionInvoked) << "wait function should be invoked";
   a.Free(p2);
 }
+
+TEST(StreamAwareArenaTest, TestStreamMemoryBudget) {
+  StreamAwareArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30, false);
+  OrtDevice tmp;
+  StreamMock stream1(tmp), stream2(tmp);
+
+  a.SetStreamMemoryBudget(&stream1, 1024 * 1024);
+
+  void* p1 = a.AllocOnStream(512 * 1024, &stream1, nullptr);
+  EXPECT_NE(nullptr, p1);
+
+  // an allocation that would push stream1 past its budget throws instead of extending the arena
+  ORT_TRY {
+    a.AllocOnStream(768 * 1024, &stream1, nullptr);
+    FAIL() << "Allocation should have thrown";
+  }
+  ORT_CATCH(const OnnxRuntimeException& ex) {
+    ORT_HANDLE_EXCEPTION([&ex]() {
+      EXPECT_THAT(ex.what(), testing::HasSubstr("Stream memory budget exceeded"));
+    });
+  }
+  ORT_CATCH(...) {
+    FAIL() << "Allocation should have thrown OnnxRuntimeException";
+  }
+
+  // other streams are unaffected
+  void* p2 = a.AllocOnStream(768 * 1024, &stream2, nullptr);
+  EXPECT_NE(nullptr, p2);
+
+  // freeing restores head-room under the budget
+  a.Free(p1);
+  void* p3 = a.AllocOnStream(768 * 1024, &stream1, nullptr);
+  EXPECT_NE(nullptr, p3);
+  a.Free(p3);
+  a.Free(p2);
+
+  // releasing the stream buffers drops the budget along with the chunk assignments
+  a.ReleaseStreamBuffers(&stream1);
+  void* p4 = a.AllocOnStream(2 * 1024 * 1024, &stream1, nullptr);
+  EXPECT_NE(nullptr, p4);
+  a.Free(p4);
+}
 #endif
 
 TEST(BFCArenaTest, TestExtendStrategy) {
@@ -481,5 +605,33 @@ TEST(BFCArenaTest, TestExtendStrategy) {
   ASSERT_EQ(extend_delta_bytes, extend_limit);
 }
 
+TEST(BFCArenaTest, NumaPartitionedArenaRoundTrip) {
+  std::vector<std::unique_ptr<IAllocator>> node_allocators;
+  node_allocators.push_back(std::make_unique<CPUAllocator>());
+  node_allocators.push_back(std::make_unique<CPUAllocator>());
+  NumaPartitionedArena a(std::move(node_allocators), 1 << 24);
+  ASSERT_EQ(a.NumNodeArenas(), static_cast<size_t>(2));
+
+  // allocations must be unique and freeable regardless of which sub-arena served them
+  std::vector<void*> ptrs;
+  for (int s = 1; s < 64; s++) {
+    void* raw = a.Alloc(s * 256);
+    ASSERT_NE(raw, nullptr);
+    ASSERT_EQ(std::count(ptrs.begin(), ptrs.end(), raw), 0);
+    ptrs.push_back(raw);
+  }
+
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.num_allocs, 63);
+
+  for (void* p : ptrs) {
+    a.Free(p);
+  }
+
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.bytes_in_use, 0);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
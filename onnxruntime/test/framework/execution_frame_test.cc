@@ -8,6 +8,7 @@
 #include "core/graph/model.h"
 #include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test_utils.h"
 #include "test/test_environment.h"
 #include "test/framework/TestAllocatorManager.h"
@@ -118,6 +119,80 @@ TEST_F(ExecutionFrameTest, TensorAllocationTest) {
   ASSERT_EQ(tensor2->Data<float>(), p_tensor->Data<float>());
 }
 
+TEST_F(ExecutionFrameTest, RunScopedCpuArenaTest) {
+  onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  onnxruntime::NodeArg input_def("X", &tensor_float), output_def("Y", &tensor_float);
+
+  onnxruntime::Node* node = &graph.AddNode("node1", "Relu", "Relu operator", ArgMap{&input_def}, ArgMap{&output_def});
+  node->SetExecutionProviderType(kCpuExecutionProvider);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_typ = cpu_xp->Type();
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(xp_typ, std::move(cpu_xp)));
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+
+  SessionOptions sess_options;
+  sess_options.enable_mem_pattern = false;
+  sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  ASSERT_STATUS_OK(sess_options.config_options.AddConfigEntry(kOrtSessionOptionsUseRunScopedCpuArena, "1"));
+
+  SessionState state(graph, execution_providers, &tp_, nullptr, dtm,
+                     DefaultLoggingManager().DefaultLogger(), profiler, sess_options);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  vector<OrtValue> outputs;
+  ExecutionFrame frame(
+      {},
+      {},
+      {},
+      outputs,
+      {},
+#ifdef ORT_ENABLE_STREAM
+      {},
+#endif
+      state);
+
+  // CPU allocations from this frame are served by a run-private arena, not the session allocator
+  AllocatorPtr frame_allocator = frame.GetAllocator(OrtDevice());
+  ASSERT_TRUE(frame_allocator != nullptr);
+  ASSERT_EQ(frame_allocator->Info().alloc_type, OrtAllocatorType::OrtArenaAllocator);
+  ASSERT_NE(frame_allocator.get(), state.GetAllocator(OrtDevice()).get());
+
+  // a second frame gets its own arena
+  vector<OrtValue> outputs2;
+  ExecutionFrame frame2(
+      {},
+      {},
+      {},
+      outputs2,
+      {},
+#ifdef ORT_ENABLE_STREAM
+      {},
+#endif
+      state);
+  ASSERT_NE(frame.GetAllocator(OrtDevice()).get(), frame2.GetAllocator(OrtDevice()).get());
+
+  // allocations behave as usual
+  int start_index = frame.GetNodeOffset(node->Index());
+  TensorShape shape(std::vector<int64_t>{2, 3});
+  OrtValue& mlvalue0 = *frame.GetMutableNodeInputOrOutputMLValue(start_index);
+  const auto& memory_info = execution_providers.Get(xp_typ)->GetOrtDeviceByMemType(OrtMemTypeDefault);
+  ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(mlvalue0, start_index, DataTypeImpl::GetType<float>(),
+                                                            memory_info, shape));
+  const Tensor& tensor = mlvalue0.Get<Tensor>();
+  ASSERT_EQ(tensor.Shape(), shape);
+}
+
 TEST_F(ExecutionFrameTest, OutputShapeValidationTest) {
   onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
                            {{kOnnxDomain, 12}}, {}, DefaultLoggingManager().DefaultLogger());
@@ -403,6 +403,244 @@ TEST(InferenceSessionTests, NoTimeout) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, KernelLatencyStats) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.KernelLatencyStats";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsKernelLatencySamplingInterval, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+
+  // stats are only created during Initialize
+  std::string report;
+  ASSERT_FALSE(session_object.GetKernelLatencyStatsReport(report).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+  RunModel(session_object, run_options);
+
+  ASSERT_STATUS_OK(session_object.GetKernelLatencyStatsReport(report));
+  EXPECT_NE(report.find("\"sampling_interval\":1"), std::string::npos) << report;
+  EXPECT_NE(report.find("\"op_type\":\"Mul\""), std::string::npos) << report;
+  EXPECT_NE(report.find("\"invocations\":2"), std::string::npos) << report;
+}
+
+TEST(InferenceSessionTests, MemoryStatsReport) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.MemoryStatsReport";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+
+  // allocators are only registered during Initialize
+  std::string report;
+  ASSERT_FALSE(session_object.GetMemoryStatsReport(report).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  ASSERT_STATUS_OK(session_object.GetMemoryStatsReport(report));
+  EXPECT_NE(report.find("\"device_type\":\"CPU\""), std::string::npos) << report;
+  EXPECT_NE(report.find("\"bytes_in_use\":"), std::string::npos) << report;
+  EXPECT_NE(report.find("\"alloc_type\":\"arena\""), std::string::npos) << report;
+}
+
+TEST(InferenceSessionTests, BatchSplitRun) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.BatchSplitRun";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigBatchSplitFactor, "2"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+
+  // the 3 input rows are sharded into contiguous slices of 2 and 1 rows, run concurrently and
+  // concatenated back; the merged output must match the unsplit run exactly
+  RunModel(session_object, run_options);
+
+  // pre-allocated fetches do not qualify for splitting and fall through to the unsplit path
+  RunModel(session_object, run_options, /*is_preallocate_output_vec*/ true);
+
+  // a run can opt out of splitting explicitly
+  RunOptions unsplit_run_options;
+  unsplit_run_options.run_tag = run_options.run_tag;
+  ASSERT_STATUS_OK(unsplit_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDisableBatchSplit, "1"));
+  RunModel(session_object, unsplit_run_options);
+}
+
+TEST(InferenceSessionTests, RunResultCache) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunResultCache";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsRunResultCacheCapacity, "2"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims{3, 2};
+  std::vector<float> values_a{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  std::vector<float> values_b{2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+
+  auto run_with_key = [&](const std::vector<float>& values, const char* key, std::vector<OrtValue>& fetches) {
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims, values, &ml_value);
+    NameMLValMap feeds;
+    feeds.insert(std::make_pair("X", ml_value));
+    std::vector<std::string> output_names{"Y"};
+    RunOptions run_options;
+    ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigResultCacheKey, key));
+    ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  };
+
+  // first run under "doc-a" executes and populates the cache
+  std::vector<OrtValue> fetches_1;
+  run_with_key(values_a, "doc-a", fetches_1);
+  VerifyOutputs(fetches_1, dims, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+
+  // a repeat of "doc-a" is served from the cache without executing: the different feeds
+  // are ignored and the cached outputs come back
+  std::vector<OrtValue> fetches_2;
+  run_with_key(values_b, "doc-a", fetches_2);
+  VerifyOutputs(fetches_2, dims, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+
+  // a new key executes normally
+  std::vector<OrtValue> fetches_3;
+  run_with_key(values_b, "doc-b", fetches_3);
+  VerifyOutputs(fetches_3, dims, {4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f});
+
+  // an unkeyed run neither consults nor populates the cache
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, CoalescedRuns) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.CoalescedRuns";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims{3, 2};
+  std::vector<float> values{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  std::vector<float> expected{1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+
+  auto run_with_key = [&](const char* key, std::vector<OrtValue>& fetches) {
+    OrtValue ml_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims, values, &ml_value);
+    NameMLValMap feeds;
+    feeds.insert(std::make_pair("X", ml_value));
+    std::vector<std::string> output_names{"Y"};
+    RunOptions run_options;
+    ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigCoalesceKey, key));
+    ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  };
+
+  // a thundering herd of identical keyed runs; every caller must see the correct result,
+  // whether it led the execution or shared a leader's fetches
+  constexpr int kNumThreads = 8;
+  std::vector<std::thread> threads;
+  std::vector<std::vector<OrtValue>> per_thread_fetches(kNumThreads);
+  threads.reserve(kNumThreads);
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i]() { run_with_key("herd", per_thread_fetches[i]); });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  for (int i = 0; i < kNumThreads; ++i) {
+    VerifyOutputs(per_thread_fetches[i], dims, expected);
+  }
+
+  // coalescing leaves no state behind: a later run under the same key executes normally
+  std::vector<OrtValue> fetches;
+  run_with_key("herd", fetches);
+  VerifyOutputs(fetches, dims, expected);
+
+  // an unkeyed run is unaffected
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, DeterministicDispatchRun) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.DeterministicDispatchRun";
+  so.execution_mode = ExecutionMode::ORT_PARALLEL;
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // the keyed run executes inline in plan order despite the parallel session mode
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDeterministicDispatch, "1"));
+  RunModel(session_object, run_options);
+
+  // an unkeyed run still uses the session's parallel executor
+  RunOptions parallel_run_options;
+  parallel_run_options.run_tag = run_options.run_tag;
+  RunModel(session_object, parallel_run_options);
+}
+
+TEST(InferenceSessionTests, PartitionReportFile) {
+  const std::string report_path = "testdata/partition_report_test.json";
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.PartitionReportFile";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsPartitionReportFile, report_path.c_str()));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::ifstream report(report_path);
+  ASSERT_TRUE(report.good());
+  std::stringstream buffer;
+  buffer << report.rdbuf();
+  const std::string content = buffer.str();
+
+  // the test model runs entirely on the CPU EP: one provider, one partition, no boundaries
+  EXPECT_NE(content.find("\"name\": \"CPUExecutionProvider\""), std::string::npos) << content;
+  EXPECT_NE(content.find("\"partitions\": 1"), std::string::npos) << content;
+  EXPECT_NE(content.find("\"boundary_tensor_count\": 0"), std::string::npos) << content;
+}
+
+TEST(InferenceSessionTests, InitializerReadAheadDepth) {
+  // the test model has no externally stored initializers, so this exercises the first-use ordered
+  // deserialization path and the config parsing; there is nothing to read ahead
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.InitializerReadAheadDepth";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsInitializerReadAheadDepth, "4"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  // a non-numeric depth fails session initialization
+  SessionOptions bad_so;
+  bad_so.session_logid = so.session_logid;
+  ASSERT_STATUS_OK(bad_so.config_options.AddConfigEntry(kOrtSessionOptionsInitializerReadAheadDepth, "lots"));
+  InferenceSession bad_session_object{bad_so, GetEnvironment()};
+  ASSERT_STATUS_OK(bad_session_object.Load(MODEL_URI));
+  ASSERT_FALSE(bad_session_object.Initialize().IsOK());
+}
+
 TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   SessionOptions so;
 
@@ -434,6 +672,162 @@ TEST(InferenceSessionTests, DisableCPUArena) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, ResetState) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.ResetState";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+
+  // resetting before Initialize is rejected
+  ASSERT_FALSE(session_object.ResetState().IsOK());
+
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  // a pooled session gets reset between tenants; runs afterwards behave like the first one
+  ASSERT_STATUS_OK(session_object.ResetState());
+  RunModel(session_object, run_options);
+
+  // resetting repeatedly on an idle session is fine
+  ASSERT_STATUS_OK(session_object.ResetState());
+  ASSERT_STATUS_OK(session_object.ResetState());
+}
+
+TEST(InferenceSessionTests, UpdateInitializedTensors) {
+  // build a model with an initializer so there is a weight to swap: Y = X + W
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[onnxruntime::kOnnxDomain] = 13;
+  Model model("update_initializers", true, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+              std::vector<ONNX_NAMESPACE::FunctionProto>{}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto& input_arg = graph.GetOrCreateNodeArg("X", &tensor_float);
+  auto& weight_arg = graph.GetOrCreateNodeArg("W", &tensor_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+  ONNX_NAMESPACE::TensorProto weight;
+  weight.set_name("W");
+  weight.set_data_type(TensorProto_DataType_FLOAT);
+  weight.add_dims(3);
+  weight.add_dims(2);
+  for (int i = 0; i < 6; ++i) {
+    weight.add_float_data(1.0f);
+  }
+  graph.AddInitializedTensor(weight);
+
+  graph.AddNode("add", "Add", "Y = X + W", {&input_arg, &weight_arg}, {&output_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.UpdateInitializedTensors";
+  InferenceSession session_object{so, GetEnvironment()};
+
+  std::string model_data;
+  model.ToProto().SerializeToString(&model_data);
+  std::stringstream sstr(model_data);
+  ASSERT_STATUS_OK(session_object.Load(sstr));
+
+  // updating before Initialize is rejected
+  ASSERT_FALSE(session_object.UpdateInitializedTensors({}).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims = {3, 2};
+  std::vector<float> x_values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue x_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims, x_values, &x_value);
+  NameMLValMap feeds{{"X", x_value}};
+  std::vector<std::string> output_names{"Y"};
+
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims, {2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f});
+
+  // swap in a new weight and run again
+  std::vector<float> new_weight_values = {10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f};
+  OrtValue new_weight;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], dims, new_weight_values,
+                       &new_weight);
+  ASSERT_STATUS_OK(session_object.UpdateInitializedTensors({{"W", new_weight}}));
+
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims, {11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f});
+
+  // unknown names and mismatched shapes are rejected without applying anything
+  ASSERT_FALSE(session_object.UpdateInitializedTensors({{"does_not_exist", new_weight}}).IsOK());
+  ASSERT_FALSE(session_object.UpdateInitializedTensors({{"X", new_weight}}).IsOK());
+
+  OrtValue wrong_shape;
+  CreateMLValue<float>(TestCPUExecutionProvider()->CreatePreferredAllocators()[0], {2, 3}, new_weight_values,
+                       &wrong_shape);
+  ASSERT_FALSE(session_object.UpdateInitializedTensors({{"W", wrong_shape}}).IsOK());
+
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims, {11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f});
+}
+
+TEST(InferenceSessionTests, WarmUp) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.WarmUp";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  WarmUpOptions warm_up_options;
+  warm_up_options.shape_signatures = {{{"X", {3, 2}}}};
+  warm_up_options.dry_runs_per_signature = 2;
+  ASSERT_STATUS_OK(session_object.WarmUp(warm_up_options));
+
+  // the session still produces correct results after warm-up
+  RunOptions run_options;
+  run_options.run_tag = "after warmup";
+  RunModel(session_object, run_options);
+
+  // a signature that does not cover the model inputs is rejected
+  WarmUpOptions bad_options;
+  bad_options.shape_signatures = {{{"missing_input", {1}}}};
+  ASSERT_FALSE(session_object.WarmUp(bad_options).IsOK());
+}
+
+TEST(InferenceSessionTests, PrewarmShape) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.PrewarmShape";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // rejected before Initialize
+  ASSERT_FALSE(session_object.PrewarmShape({{"X", {3, 2}}}).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // first call for a new shape traces it with a dry run; the second hits the cached pattern
+  // and only pre-extends the arenas
+  ASSERT_STATUS_OK(session_object.PrewarmShape({{"X", {3, 2}}}));
+  ASSERT_STATUS_OK(session_object.PrewarmShape({{"X", {3, 2}}}));
+
+  // the session still produces correct results after pre-warming
+  RunOptions run_options;
+  run_options.run_tag = "after prewarm";
+  RunModel(session_object, run_options);
+
+  // a signature that does not cover the model inputs is rejected
+  ASSERT_FALSE(session_object.PrewarmShape({{"missing_input", {1}}}).IsOK());
+}
+
 TEST(InferenceSessionTests, TestModelSerialization) {
   // Load model with level 0 transform level
   // and assert that the model has Identity nodes.
@@ -741,6 +1135,52 @@ TEST(InferenceSessionTests, CheckRunProfilerWithSessionOptions2) {
 #endif
 }
 
+TEST(InferenceSessionTests, CheckRunProfilerWithCompactEvents) {
+  SessionOptions so;
+
+  so.session_logid = "CheckRunProfiler";
+  so.enable_profiling = true;
+  so.profile_file_prefix = ORT_TSTR("onnxprofile_profile_compact_test");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsProfilerCompactEvents, "1"));
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "RunTag";
+
+  RunModel(session_object, run_options);
+  std::string profile_file = session_object.EndProfiling();
+
+  std::ifstream profile(profile_file);
+  ASSERT_TRUE(profile);
+  std::string line;
+  std::vector<std::string> lines;
+
+  while (std::getline(profile, line)) {
+    lines.push_back(line);
+  }
+
+  auto size = lines.size();
+  ASSERT_TRUE(size > 1);
+  ASSERT_TRUE(lines[0].find("[") != string::npos);
+  ASSERT_TRUE(lines[size - 1].find("]") != string::npos);
+  std::vector<std::string> tags = {"pid", "dur", "ts", "ph", "X", "name", "args"};
+
+  // Compact node records are converted to the same chrome trace format; per-node
+  // fence events and argument details are absent in compact mode.
+  bool has_kernel_time = false;
+  for (size_t i = 1; i < size - 1; ++i) {
+    for (auto& s : tags) {
+      ASSERT_TRUE(lines[i].find(s) != string::npos);
+    }
+    has_kernel_time = has_kernel_time || lines[i].find("_kernel_time") != string::npos;
+    ASSERT_TRUE(lines[i].find("_fence_before") == string::npos);
+  }
+  ASSERT_TRUE(has_kernel_time);
+}
+
 TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
   SessionOptions so;
 
@@ -1073,6 +1513,141 @@ TEST(InferenceSessionTests, TestIOBindingReuse) {
   }
 }
 
+TEST(InferenceSessionTests, TestIOBindingValidationToken) {
+  SessionOptions so;
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_TRUE(session_object.Load(sstr).IsOK());
+  ASSERT_STATUS_OK(session_object.Initialize());
+  unique_ptr<IOBinding> io_binding;
+  ASSERT_STATUS_OK(session_object.NewIOBinding(&io_binding));
+
+  auto allocator = TestCPUExecutionProvider()->CreatePreferredAllocators()[0];
+  OrtValue input_a;
+  CreateMLValue<float>(allocator, {3, 4}, std::vector<float>(12, 1.f), &input_a);
+  OrtValue input_b;
+  CreateMLValue<float>(allocator, {4, 3}, std::vector<float>(12, 1.f), &input_b);
+
+  ASSERT_STATUS_OK(io_binding->BindInput("A", input_a));
+  ASSERT_STATUS_OK(io_binding->BindInput("B", input_b));
+  ASSERT_STATUS_OK(io_binding->BindOutput("Y", OrtDevice()));
+  ASSERT_FALSE(io_binding->IsValidated());
+
+  RunOptions run_options;
+  ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+  ASSERT_TRUE(io_binding->IsValidated());
+
+  // Rebinding a value with the same type and shape keeps the token and the run stays correct.
+  OrtValue input_a2;
+  CreateMLValue<float>(allocator, {3, 4}, std::vector<float>(12, 2.f), &input_a2);
+  ASSERT_STATUS_OK(io_binding->BindInput("A", input_a2));
+  ASSERT_TRUE(io_binding->IsValidated());
+  ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+  auto span = io_binding->GetOutputs()[0].Get<Tensor>().DataAsSpan<float>();
+  for (auto v : span) {
+    ASSERT_EQ(v, 8.f);
+  }
+
+  // Rebinding a value with a different element type clears the token and full validation
+  // rejects the run.
+  OrtValue bad_a;
+  CreateMLValue<double>(allocator, {3, 4}, std::vector<double>(12, 1.0), &bad_a);
+  ASSERT_STATUS_OK(io_binding->BindInput("A", bad_a));
+  ASSERT_FALSE(io_binding->IsValidated());
+  ASSERT_FALSE(session_object.Run(run_options, *io_binding).IsOK());
+}
+
+TEST(InferenceSessionTests, TestIOBindingBatchedInput) {
+  SessionOptions so;
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_TRUE(session_object.Load(sstr).IsOK());
+  ASSERT_STATUS_OK(session_object.Initialize());
+  unique_ptr<IOBinding> io_binding;
+  ASSERT_STATUS_OK(session_object.NewIOBinding(&io_binding));
+
+  auto allocator = TestCPUExecutionProvider()->CreatePreferredAllocators()[0];
+  OrtValue part_1;
+  CreateMLValue<float>(allocator, {1, 4}, {0.f, 1.f, 2.f, 3.f}, &part_1);
+  OrtValue part_2;
+  CreateMLValue<float>(allocator, {2, 4}, {4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f}, &part_2);
+
+  // the parts are ragged in the first dimension and concatenated along it
+  std::vector<OrtValue> parts{part_1, part_2};
+  ASSERT_STATUS_OK(io_binding->BindBatchedInput("A", parts));
+  ASSERT_EQ(io_binding->GetInputs().size(), 1u);
+  const auto& batched = io_binding->GetInputs()[0].Get<Tensor>();
+  ASSERT_EQ(batched.Shape(), TensorShape({3, 4}));
+  auto span = batched.DataAsSpan<float>();
+  for (int i = 0; i < 12; ++i) {
+    ASSERT_EQ(span[i], static_cast<float>(i));
+  }
+
+  // trailing dimensions must match
+  OrtValue bad_part;
+  CreateMLValue<float>(allocator, {1, 3}, {0.f, 1.f, 2.f}, &bad_part);
+  std::vector<OrtValue> bad_parts{part_1, bad_part};
+  ASSERT_FALSE(io_binding->BindBatchedInput("A", bad_parts).IsOK());
+}
+
+TEST(InferenceSessionTests, TestIOBindingOutputReadyCallback) {
+  SessionOptions so;
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_TRUE(session_object.Load(sstr).IsOK());
+  ASSERT_STATUS_OK(session_object.Initialize());
+  unique_ptr<IOBinding> io_binding;
+  ASSERT_STATUS_OK(session_object.NewIOBinding(&io_binding));
+
+  auto allocator = TestCPUExecutionProvider()->CreatePreferredAllocators()[0];
+  OrtValue input_a;
+  CreateMLValue<float>(allocator, {3, 4}, std::vector<float>(12, 1.f), &input_a);
+  OrtValue input_b;
+  CreateMLValue<float>(allocator, {4, 3}, std::vector<float>(12, 1.f), &input_b);
+
+  ASSERT_STATUS_OK(io_binding->BindInput("A", input_a));
+  ASSERT_STATUS_OK(io_binding->BindInput("B", input_b));
+  ASSERT_STATUS_OK(io_binding->BindOutput("Y", OrtDevice()));
+
+  int num_calls = 0;
+  std::vector<float> callback_values;
+  io_binding->SetOutputReadyCallback("Y", [&](const OrtValue& value) {
+    ++num_calls;
+    auto span = value.Get<Tensor>().DataAsSpan<float>();
+    callback_values.assign(span.begin(), span.end());
+  });
+
+  RunOptions run_options;
+  ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+
+  // the callback fired exactly once and saw the produced output
+  ASSERT_EQ(num_calls, 1);
+  ASSERT_EQ(callback_values.size(), 9u);
+  for (auto v : callback_values) {
+    ASSERT_EQ(v, 4.f);
+  }
+
+  // an empty callback removes the registration
+  io_binding->SetOutputReadyCallback("Y", nullptr);
+  ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+  ASSERT_EQ(num_calls, 1);
+}
+
 TEST(InferenceSessionTests, InvalidInputTypeOfTensorElement) {
   SessionOptions so;
 
@@ -2216,6 +2791,34 @@ TEST(InferenceSessionTests, TestArenaShrinkageAfterRun) {
 
 #endif
 
+TEST(InferenceSessionTests, ReleaseUnusedArenaMemory) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.ReleaseUnusedArenaMemory";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // calling before Initialize() must fail
+  ASSERT_FALSE(session_object.ReleaseUnusedArenaMemory("cpu:0").IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  // an unknown device in the list must be rejected
+  ASSERT_FALSE(session_object.ReleaseUnusedArenaMemory("npu:0").IsOK());
+
+  // only exercise the happy path if the CPU allocator of this build is arena based
+  auto cpu_alloc = session_object.GetAllocator(OrtMemoryInfo(CPU, OrtArenaAllocator));
+  if (cpu_alloc != nullptr && cpu_alloc->Info().alloc_type == OrtAllocatorType::OrtArenaAllocator) {
+    // releasing the CPU arena's unused regions keeps the session usable
+    ASSERT_STATUS_OK(session_object.ReleaseUnusedArenaMemory("cpu:0"));
+    RunModel(session_object, run_options);
+  }
+}
+
 // The model being tested here triggers a case where the allocation planner (AP) tries to reuse a tensor of type
 // double for a string tensor. The reuse logic of AP works correctly on Windows and Ubuntu 16.x
 // since there the sizeof(double) != sizeof(std::string). However, on CentOS (gcc 4.8.x), the 2 sizes are equal.
@@ -2836,6 +3439,54 @@ TEST(InferenceSessionTests, InitializerSharing_EnsureSessionsUseUserAddedInitial
   }
 }
 
+TEST(InferenceSessionTests, InitializerSharing_SharedInitializersContainer) {
+  SharedInitializersContainer container;
+
+  const char* init_name = "W";
+  RunOptions run_options;
+  run_options.run_tag = "InitializerSharing_SharedInitializersContainer";
+
+  SessionOptions so1;
+  InferenceSessionWrapper sess1(so1, GetEnvironment());
+  ASSERT_STATUS_OK(sess1.AddSharedInitializersContainer(&container));
+  // ensure an error is returned when a second container is added.
+  ASSERT_FALSE(sess1.AddSharedInitializersContainer(&container).IsOK());
+  ASSERT_STATUS_OK(sess1.Load(MODEL_URI));
+  ASSERT_STATUS_OK(sess1.Initialize());
+
+  SessionOptions so2;
+  InferenceSessionWrapper sess2(so2, GetEnvironment());
+  ASSERT_STATUS_OK(sess2.AddSharedInitializersContainer(&container));
+  ASSERT_STATUS_OK(sess2.Load(MODEL_URI));
+  ASSERT_STATUS_OK(sess2.Initialize());
+
+  // the first session to initialize has populated the container
+  ASSERT_GE(container.GetNumberOfElements(), 1u);
+
+  // both sessions still compute the right answer with the shared weights
+  RunModel(sess1, run_options);
+  RunModel(sess2, run_options);
+
+  int so1_idx;
+  int so2_idx;
+  // If the original initializer name got changed by graph transformers, then we can't check
+  // buffer reuse across the sessions.
+  if (sess1.GetSessionState().GetOrtValueNameIdxMap().GetIdx(init_name, so1_idx).IsOK() &&
+      sess2.GetSessionState().GetOrtValueNameIdxMap().GetIdx(init_name, so2_idx).IsOK()) {
+    const auto* so1_init_buffer =
+        sess1.GetSessionState().GetInitializedTensors().at(so1_idx).Get<Tensor>().Data<float>();
+    const auto* so2_init_buffer =
+        sess2.GetSessionState().GetInitializedTensors().at(so2_idx).Get<Tensor>().Data<float>();
+
+    // Ensure both sessions share the same data ptr
+    ASSERT_EQ(so1_init_buffer, so2_init_buffer);
+
+    OrtValue container_value;
+    ASSERT_TRUE(container.GetInitializer(init_name, container_value));
+    ASSERT_EQ(so1_init_buffer, container_value.Get<Tensor>().Data<float>());
+  }
+}
+
 void RunModelWithDenormalAsZero(InferenceSession& session_object,
                                 const RunOptions& run_options,
                                 bool set_denormal_as_zero) {
@@ -557,6 +557,22 @@ TEST(OrtModelOnlyTests, LoadOrtFormatModelFromBufferNoCopyInitializersUseBuffer)
   RunOrtModel(test_info);
 }
 
+// Load the model from a file path with "session.use_ort_model_bytes_directly" set, which memory maps
+// the file instead of reading it into a copy up front
+TEST(OrtModelOnlyTests, LoadOrtFormatModelFromFileNoCopy) {
+  OrtModelTestInfo test_info = GetTestInfoForLoadOrtFormatModel();
+  test_info.disable_copy_ort_buffer = true;
+  RunOrtModel(test_info);
+}
+
+// Memory map the file and use the mapped bytes directly for initializers
+TEST(OrtModelOnlyTests, LoadOrtFormatModelFromFileNoCopyInitializersUseBuffer) {
+  OrtModelTestInfo test_info = GetTestInfoForLoadOrtFormatModel();
+  test_info.disable_copy_ort_buffer = true;
+  test_info.use_buffer_for_initializers = true;
+  RunOrtModel(test_info);
+}
+
 // regression test for 2 issues covered by PR #17000 (internally reported issue).
 // 1) allocation planner broke in minimal build when subgraph had no nodes.
 // 2) usage of a sequence data type caused an exception due to IsSparseTensor() throwing
@@ -18,9 +18,12 @@
 #include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/util/thread_utils.h"
+#include "core/framework/prepacked_weights_container.h"
 #include "gtest/gtest.h"
+#include "test/framework/test_utils.h"
 #include "test/test_environment.h"
 #include "test/util/include/default_providers.h"
+#include "test/util/include/temp_dir.h"
 #include "core/optimizer/layout_transformation/layout_transformation.h"
 
 using namespace ONNX_NAMESPACE;
@@ -346,6 +349,61 @@ TEST(SessionStateTest, TestInitializerMemoryAllocatedUsingNonArenaMemory) {
 
 #endif
 
+TEST(SessionStateTest, MemoryPatternCacheLimitEviction) {
+  std::basic_ostringstream<ORTCHAR_T> oss;
+  oss << ORT_TSTR("testdata/mul_1.onnx");
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(oss.str(), model, nullptr, DefaultLoggingManager().DefaultLogger()));
+  Graph& graph = model->MainGraph();
+
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(onnxruntime::kCpuExecutionProvider,
+                                           std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo{})));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+
+  SessionOptions sess_options;
+  sess_options.enable_mem_pattern = true;
+  sess_options.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  // keep at most 2 cached pattern groups
+  ASSERT_STATUS_OK(sess_options.config_options.AddConfigEntry(kOrtSessionOptionsMemoryPatternCacheLimit, "2"));
+
+  SessionState session_state(graph, execution_providers, nullptr, nullptr, dtm,
+                             DefaultLoggingManager().DefaultLogger(), profiler, sess_options);
+
+  AllocatorPtr cpu_allocator = std::make_shared<CPUAllocator>();
+  auto make_feeds = [&cpu_allocator](int64_t len) {
+    OrtValue value;
+    CreateMLValue<float>(cpu_allocator, {len}, std::vector<float>(static_cast<size_t>(len), 1.f), &value);
+    return std::vector<OrtValue>{value};
+  };
+
+  auto feeds_1 = make_feeds(8);
+  auto feeds_2 = make_feeds(16);
+  auto feeds_3 = make_feeds(32);
+
+  ASSERT_STATUS_OK(session_state.UpdateMemoryPatternGroupCache(feeds_1, MemoryPatternGroup{}));
+  ASSERT_STATUS_OK(session_state.UpdateMemoryPatternGroupCache(feeds_2, MemoryPatternGroup{}));
+
+  const std::vector<int> no_feed_idxs;
+  std::shared_ptr<const InlinedHashMap<int, TensorShape>> inferred_shapes;
+
+  // touch feeds_1 so feeds_2 becomes the least recently used entry
+  ASSERT_NE(session_state.GetMemoryPatternGroup(feeds_1, no_feed_idxs, inferred_shapes), nullptr);
+
+  // inserting a third entry should evict feeds_2
+  ASSERT_STATUS_OK(session_state.UpdateMemoryPatternGroupCache(feeds_3, MemoryPatternGroup{}));
+
+  EXPECT_NE(session_state.GetMemoryPatternGroup(feeds_1, no_feed_idxs, inferred_shapes), nullptr);
+#ifndef ENABLE_TRAINING
+  // in training builds a cache miss attempts to generate a pattern group in place,
+  // which requires a finalized session, so only check the eviction in inference builds
+  EXPECT_EQ(session_state.GetMemoryPatternGroup(feeds_2, no_feed_idxs, inferred_shapes), nullptr);
+#endif
+  EXPECT_NE(session_state.GetMemoryPatternGroup(feeds_3, no_feed_idxs, inferred_shapes), nullptr);
+}
+
 INSTANTIATE_TEST_SUITE_P(SessionStateTests, SessionStateTestP, testing::ValuesIn(param_list));
 
 #ifndef ENABLE_TRAINING_CORE
@@ -983,6 +1041,50 @@ TEST_F(SessionStateTestSharedInitalizersWithPrePacking, test4) {
   ASSERT_EQ(if_node_branches_shared_prepack_counter_2, static_cast<size_t>(2));
 }
 
+// The file-backed pre-packed weights cache should round-trip entries between container
+// instances (each instance standing in for a separate worker process).
+TEST(PrepackedWeightsContainerTest, FileCacheRoundTrip) {
+  TemporaryDirectory temp_dir(ORT_TSTR("prepacked_weights_file_cache_test"));
+
+  const std::string key = "TestOp+12345";
+  std::vector<float> payload_0{1.f, 2.f, 3.f, 4.f};
+  std::vector<float> payload_1{5.f, 6.f};
+
+  {
+    PrepackedWeightsContainer container_1;
+    container_1.SetFileCacheDirectory(temp_dir.Path());
+
+    AllocatorPtr allocator = container_1.GetOrCreateAllocator(CPU);
+    PrePackedWeights weights;
+    for (const auto* payload : {&payload_0, &payload_1}) {
+      size_t size_in_bytes = payload->size() * sizeof(float);
+      auto buffer = IAllocator::MakeUniquePtr<void>(allocator, size_in_bytes);
+      memcpy(buffer.get(), payload->data(), size_in_bytes);
+      weights.buffers_.push_back(std::move(buffer));
+      weights.buffer_sizes_.push_back(size_in_bytes);
+    }
+
+    ASSERT_TRUE(container_1.WriteWeight(key, std::move(weights)));
+    ASSERT_STATUS_OK(container_1.WriteWeightToFileCache(key));
+  }
+
+  PrepackedWeightsContainer container_2;
+  ASSERT_FALSE(container_2.HasWeight(key));
+  // no cache directory configured yet - the lookup must miss
+  ASSERT_FALSE(container_2.LoadWeightFromFileCache(key));
+
+  container_2.SetFileCacheDirectory(temp_dir.Path());
+  ASSERT_TRUE(container_2.LoadWeightFromFileCache(key));
+  ASSERT_TRUE(container_2.HasWeight(key));
+
+  const auto& loaded_weights = container_2.GetWeight(key);
+  ASSERT_EQ(loaded_weights.buffers_.size(), static_cast<size_t>(2));
+  ASSERT_EQ(loaded_weights.buffer_sizes_[0], payload_0.size() * sizeof(float));
+  ASSERT_EQ(loaded_weights.buffer_sizes_[1], payload_1.size() * sizeof(float));
+  ASSERT_EQ(memcmp(loaded_weights.buffers_[0].get(), payload_0.data(), loaded_weights.buffer_sizes_[0]), 0);
+  ASSERT_EQ(memcmp(loaded_weights.buffers_[1].get(), payload_1.data(), loaded_weights.buffer_sizes_[1]), 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(SessionStateTests,
                          SessionStatePrepackingTest,
                          testing::Values(PrepackingTestParam{false, false},
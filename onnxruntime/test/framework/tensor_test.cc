@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/framework/tensor.h"
+#include "core/framework/TensorSeq.h"
 #include "test_utils.h"
 
 #include "gmock/gmock.h"
@@ -123,6 +124,37 @@ TEST(TensorTest, CPUUInt64TensorOffsetTest) {
   CPUTensorTest<uint64_t>(std::vector<int64_t>({3, 2, 4}), 5);
 }
 
+TEST(TensorTest, InlineSmallTensorTest) {
+  auto alloc = TestCPUExecutionProvider()->CreatePreferredAllocators()[0];
+
+  // small tensors created via the allocator-owning constructor use the inline buffer
+  Tensor small(DataTypeImpl::GetType<int64_t>(), TensorShape({2}), alloc);
+  EXPECT_TRUE(small.UsesInlineBuffer());
+  EXPECT_TRUE(small.OwnsBuffer());
+
+  auto small_data = small.MutableDataAsSpan<int64_t>();
+  small_data[0] = 42;
+  small_data[1] = -1;
+
+  // a move copies the inline bytes and re-points the data at the destination's buffer
+  Tensor moved(std::move(small));
+  EXPECT_TRUE(moved.UsesInlineBuffer());
+  EXPECT_EQ(moved.Data<int64_t>()[0], 42);
+  EXPECT_EQ(moved.Data<int64_t>()[1], -1);
+
+  Tensor assigned(DataTypeImpl::GetType<float>(), TensorShape({64}), alloc);
+  assigned = std::move(moved);
+  EXPECT_TRUE(assigned.UsesInlineBuffer());
+  EXPECT_EQ(assigned.Data<int64_t>()[0], 42);
+  EXPECT_EQ(assigned.Data<int64_t>()[1], -1);
+
+  // anything over kInlineBufferSize still goes through the allocator
+  constexpr int64_t num_large_elems = static_cast<int64_t>(Tensor::kInlineBufferSize / sizeof(int64_t)) + 1;
+  Tensor large(DataTypeImpl::GetType<int64_t>(), TensorShape({num_large_elems}), alloc);
+  EXPECT_FALSE(large.UsesInlineBuffer());
+  EXPECT_TRUE(large.OwnsBuffer());
+}
+
 TEST(TensorTest, EmptyTensorTest) {
   auto type = DataTypeImpl::GetType<float>();
   Tensor t(type, TensorShape({1, 0}), nullptr, TestCPUExecutionProvider()->CreatePreferredAllocators()[0]->Info());
@@ -261,5 +293,41 @@ TEST(TensorTest, Strided) {
 }
 #endif
 
+TEST(TensorTest, TensorSeqSlabBackedElements) {
+  auto alloc = TestCPUExecutionProvider()->CreatePreferredAllocators()[0];
+
+  auto seq = std::make_unique<TensorSeq>(DataTypeImpl::GetType<float>());
+  constexpr size_t num_elements = 4;
+  const TensorShape shape{2, 3};
+  const size_t element_bytes = static_cast<size_t>(shape.Size()) * sizeof(float);
+
+  auto slab = TensorSeq::AllocateSlab(alloc, num_elements * element_bytes);
+  for (size_t i = 0; i < num_elements; ++i) {
+    Tensor& t = seq->AddFromSlab(slab, shape, alloc->Info(), static_cast<ptrdiff_t>(i * element_bytes));
+    float* data = t.MutableData<float>();
+    for (int64_t j = 0; j < shape.Size(); ++j) {
+      data[j] = static_cast<float>(i);
+    }
+  }
+
+  ASSERT_EQ(seq->Size(), num_elements);
+
+  // the elements are contiguous views over the slab, in order
+  const char* expected_data = static_cast<const char*>(slab.get());
+  for (size_t i = 0; i < num_elements; ++i) {
+    const Tensor& t = seq->Get(i);
+    EXPECT_EQ(t.DataRaw(), expected_data + i * element_bytes);
+    EXPECT_EQ(t.Shape(), shape);
+    EXPECT_EQ(t.Data<float>()[0], static_cast<float>(i));
+  }
+
+  // an element copied out of the sequence keeps the slab alive after both the sequence and the local slab
+  // reference are gone
+  OrtValue element = seq->GetAt(1);
+  slab.reset();
+  seq.reset();
+  EXPECT_EQ(element.Get<Tensor>().Data<float>()[0], 1.f);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -8,6 +8,8 @@
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
 #include "core/graph/op.h"
+#include "core/platform/threadpool.h"
+#include "core/util/thread_utils.h"
 #include "test/providers/provider_test_utils.h"
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -681,6 +683,37 @@ TEST_F(GraphTest, GraphConstruction_VerifyNoDuplicateName) {
   EXPECT_TRUE(duplicate_error_found);
 }
 
+TEST_F(GraphTest, GraphConstruction_ProducerConsumerLookupsTrackAddRemoveNode) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto& input_arg = graph.GetOrCreateNodeArg("input_1", &tensor_float);
+  auto& mid_arg = graph.GetOrCreateNodeArg("mid_1", &tensor_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("output_1", &tensor_float);
+
+  std::vector<NodeArg*> inputs{&input_arg};
+  std::vector<NodeArg*> outputs{&mid_arg};
+  auto& node_1 = graph.AddNode("node_1", "Identity", "node 1", inputs, outputs);
+
+  inputs[0] = &mid_arg;
+  outputs[0] = &output_arg;
+  auto& node_2 = graph.AddNode("node_2", "Identity", "node 2", inputs, outputs);
+
+  // the lookups are maintained by AddNode without requiring a Resolve
+  EXPECT_EQ(graph.GetProducerNode("mid_1"), &node_1);
+  auto consumers = graph.GetConsumerNodes("mid_1");
+  ASSERT_EQ(consumers.size(), 1u);
+  EXPECT_EQ(consumers[0], &node_2);
+
+  // and RemoveNode drops the removed node from them
+  ASSERT_TRUE(graph.RemoveNode(node_2.Index()));
+  EXPECT_TRUE(graph.GetConsumerNodes("mid_1").empty());
+  EXPECT_EQ(graph.GetProducerNode("output_1"), nullptr);
+  EXPECT_EQ(graph.GetProducerNode("mid_1"), &node_1);
+}
+
 TEST_F(GraphTest, GraphConstruction_VerifyNodeAndOpMatch) {
   Model model("graph_1", false, *logger_);
   auto& graph = model.MainGraph();
@@ -793,6 +826,54 @@ TEST_F(GraphTest, GraphConstruction_CheckIsAcyclic) {
   }
 }
 
+TEST_F(GraphTest, GraphConstruction_ParallelTypeAndShapeInference) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+
+  // a wide level of independent Identity nodes feeding a chain of Add nodes
+  auto& input_arg = graph.GetOrCreateNodeArg("input", &tensor_float);
+  std::vector<NodeArg*> inputs{&input_arg};
+  std::vector<NodeArg*> outputs;
+  std::vector<NodeArg*> identity_outputs;
+  for (int i = 0; i < 8; ++i) {
+    auto& identity_out = graph.GetOrCreateNodeArg("identity_out_" + std::to_string(i), nullptr);
+    outputs = {&identity_out};
+    graph.AddNode("identity_" + std::to_string(i), "Identity", "identity", inputs, outputs);
+    identity_outputs.push_back(&identity_out);
+  }
+
+  NodeArg* previous_output = identity_outputs[0];
+  for (size_t i = 1; i < identity_outputs.size(); ++i) {
+    auto& add_out = graph.GetOrCreateNodeArg("add_out_" + std::to_string(i), nullptr);
+    inputs = {previous_output, identity_outputs[i]};
+    outputs = {&add_out};
+    graph.AddNode("add_" + std::to_string(i), "Add", "add", inputs, outputs);
+    previous_output = &add_out;
+  }
+
+  OrtThreadPoolParams tpo;
+  auto tp = concurrency::CreateThreadPool(&onnxruntime::Env::Default(), tpo,
+                                          concurrency::ThreadPoolType::INTRA_OP);
+
+  Graph::ResolveOptions resolve_options;
+  resolve_options.shape_inference_thread_pool = tp.get();
+  auto status = graph.Resolve(resolve_options);
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+
+  // every output shape must have been inferred, matching what serial inference produces
+  for (const auto& node : graph.Nodes()) {
+    for (const auto* output_def : node.OutputDefs()) {
+      ASSERT_TRUE(output_def->Shape() != nullptr) << "missing inferred shape for " << output_def->Name();
+      EXPECT_EQ(output_def->Shape()->dim_size(), 1);
+      EXPECT_EQ(output_def->Shape()->dim(0).dim_value(), 4);
+    }
+  }
+}
+
 TEST_F(GraphTest, GraphConstruction_CheckInputNodeOrderMaintained) {
   Model model("graph_1", false, *logger_);
   auto& graph = model.MainGraph();
@@ -69,6 +69,12 @@ class MlasConv2DTest : public MlasTestBase {
              threadpool_);
   }
 
+  // Algorithms that reassociate the reduction (e.g. Winograd) override this to
+  // compare against the reference with a tolerance instead of bit-exactly.
+  virtual bool ExactComparison() {
+    return true;
+  }
+
   void ReferenceConv2D(
       size_t BatchCount,
       size_t GroupCount,
@@ -246,18 +252,36 @@ class MlasConv2DTest : public MlasTestBase {
                     Bias,
                     OutputReference);
 
-    ASSERT_EQ(memcmp(Output, OutputReference, OutputElements * sizeof(float)), 0)
-        << "B" << BatchCount << "/"
-        << "G" << GroupCount << "/"
-        << "Cpg" << InputChannels << "/"
-        << "Fpg" << FilterCount << "/"
-        << "H" << InputHeight << "/"
-        << "W" << InputWidth << "/"
-        << "KH" << KernelHeight << "/"
-        << "KW" << KernelWidth << "/"
-        << "Pad" << PaddingLeftHeight << "," << PaddingLeftWidth << "," << PaddingRightHeight << "," << PaddingRightWidth << "/"
-        << "Dilation" << DilationHeight << "," << DilationWidth << "/"
-        << "Stride" << StrideHeight << "," << StrideWidth;
+    if (ExactComparison()) {
+      ASSERT_EQ(memcmp(Output, OutputReference, OutputElements * sizeof(float)), 0)
+          << "B" << BatchCount << "/"
+          << "G" << GroupCount << "/"
+          << "Cpg" << InputChannels << "/"
+          << "Fpg" << FilterCount << "/"
+          << "H" << InputHeight << "/"
+          << "W" << InputWidth << "/"
+          << "KH" << KernelHeight << "/"
+          << "KW" << KernelWidth << "/"
+          << "Pad" << PaddingLeftHeight << "," << PaddingLeftWidth << "," << PaddingRightHeight << "," << PaddingRightWidth << "/"
+          << "Dilation" << DilationHeight << "," << DilationWidth << "/"
+          << "Stride" << StrideHeight << "," << StrideWidth;
+    } else {
+      for (size_t n = 0; n < OutputElements; n++) {
+        ASSERT_NEAR(Output[n], OutputReference[n], 1e-3f * std::max(1.0f, std::fabs(OutputReference[n])))
+            << "@" << n << "/"
+            << "B" << BatchCount << "/"
+            << "G" << GroupCount << "/"
+            << "Cpg" << InputChannels << "/"
+            << "Fpg" << FilterCount << "/"
+            << "H" << InputHeight << "/"
+            << "W" << InputWidth << "/"
+            << "KH" << KernelHeight << "/"
+            << "KW" << KernelWidth << "/"
+            << "Pad" << PaddingLeftHeight << "," << PaddingLeftWidth << "," << PaddingRightHeight << "," << PaddingRightWidth << "/"
+            << "Dilation" << DilationHeight << "," << DilationWidth << "/"
+            << "Stride" << StrideHeight << "," << StrideWidth;
+      }
+    }
   }
 
   void ExecuteLong(void) override {
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_conv2d.h"
+#include "test_conv2d_fixture.h"
+
+//
+// Runs the shared Conv2d test cases with the Winograd F(2x2,3x3) algorithm
+// requested. Cases that do not qualify for Winograd fall back to the algorithm
+// MlasConvPrepare selected, so the whole case list remains valid. The reference
+// comparison uses a tolerance because the Winograd reduction is reassociated.
+//
+
+template <bool Threaded>
+class MlasConvWinogradTest : public MlasConv2DTest<Threaded> {
+ protected:
+  void MlasConv2D(size_t BatchCount,
+                  size_t GroupCount,
+                  size_t InputChannels,
+                  size_t InputHeight,
+                  size_t InputWidth,
+                  size_t FilterCount,
+                  size_t KernelHeight,
+                  size_t KernelWidth,
+                  size_t PaddingLeftHeight,
+                  size_t PaddingLeftWidth,
+                  size_t PaddingRightHeight,
+                  size_t PaddingRightWidth,
+                  size_t DilationHeight,
+                  size_t DilationWidth,
+                  size_t StrideHeight,
+                  size_t StrideWidth,
+                  size_t OutputHeight,
+                  size_t OutputWidth,
+                  const float* Input,
+                  const float* Filter,
+                  const float* Bias,
+                  float* Output) override {
+    int64_t InputShape[] = {int64_t(InputHeight), int64_t(InputWidth)};
+    int64_t KernelShape[] = {int64_t(KernelHeight), int64_t(KernelWidth)};
+    int64_t DilationShape[] = {int64_t(DilationHeight), int64_t(DilationWidth)};
+    int64_t Padding[] = {int64_t(PaddingLeftHeight), int64_t(PaddingLeftWidth), int64_t(PaddingRightHeight), int64_t(PaddingRightWidth)};
+    int64_t StrideShape[] = {int64_t(StrideHeight), int64_t(StrideWidth)};
+    int64_t OutputShape[] = {int64_t(OutputHeight), int64_t(OutputWidth)};
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    MLAS_CONV_PARAMETERS Parameters;
+    size_t WorkingBufferSize;
+
+    MlasConvPrepare(&Parameters,
+                    2,
+                    BatchCount,
+                    GroupCount,
+                    InputChannels,
+                    InputShape,
+                    KernelShape,
+                    DilationShape,
+                    Padding,
+                    StrideShape,
+                    OutputShape,
+                    FilterCount,
+                    &Activation,
+                    &WorkingBufferSize,
+                    0.0f,
+                    this->threadpool_);
+
+    MlasConvTryUseWinograd(&Parameters, &WorkingBufferSize);
+
+    MlasConv(&Parameters,
+             Input,
+             Filter,
+             Bias,
+             this->BufferWorking.GetBuffer(WorkingBufferSize),
+             Output,
+             this->threadpool_);
+  }
+
+  bool ExactComparison() override {
+    return false;
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name(Threaded ? "Conv2dWinograd_Threaded" : "Conv2dWinograd_SingleThread");
+    return suite_name.c_str();
+  }
+};
+
+static size_t Conv2dWinogradRegistShortExecute() {
+  size_t count = Conv2dShortExecuteTest<MlasConvWinogradTest<false>>::RegisterShortExecuteTests();
+  if (GetMlasThreadPool() != nullptr) {
+    count += Conv2dShortExecuteTest<MlasConvWinogradTest<true>>::RegisterShortExecuteTests();
+  }
+  return count;
+}
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? Conv2dWinogradRegistShortExecute() : 0;
+});
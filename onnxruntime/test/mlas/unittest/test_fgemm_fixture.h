@@ -70,6 +70,9 @@ class FgemmShortExecuteTest : public MlasTestFixture<MlasFgemmTest<T, Packed, Th
     test_registered += RegisterTestTransposeABProduct(128, 3072, 768, 1, 1.0f, 0.0f);
     test_registered += RegisterTestTransposeABProduct(128, 768, 3072, 1, 1.0f, 0.0f);
     test_registered += RegisterTestTransposeABProduct(25, 81, 79, 7, 1.0f, 0.0f);
+    // large batches of small operations take the coalesced dispatch path
+    test_registered += RegisterTestTransposeABProduct(8, 16, 64, 64, 1.0f, 0.0f);
+    test_registered += RegisterTestTransposeABProduct(4, 16, 512, 33, 1.0f, 0.0f);
     return test_registered;
   }
 
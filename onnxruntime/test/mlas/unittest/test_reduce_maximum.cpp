@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+class MlasReduceMaximumTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+
+  void Test(size_t N, float MinimumValue, float MaximumValue) {
+    float* Input = BufferInput.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = distribution(generator);
+    }
+
+    float max_ref = *std::max_element(Input, Input + N);
+
+    float max = MlasReduceMaximum(Input, N);
+
+    ASSERT_EQ(max, max_ref) << " for parameter (" << N << "," << MinimumValue << "," << MaximumValue << ")";
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("ReduceMaximum");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t n = 1; n < 128; n++) {
+      Test(n, -10.f, 10.f);
+    }
+    // Cover the unrolled vector path and a vocabulary-sized reduction.
+    Test(1024, -10.f, 10.f);
+    Test(250000, -10.f, 10.f);
+  }
+};
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasReduceMaximumTest>::RegisterShortExecute() : 0;
+});
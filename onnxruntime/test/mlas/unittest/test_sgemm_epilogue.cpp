@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+//
+// Tests the SGEMM output processor hook: activations and a composed epilogue
+// chain applied tile by tile instead of as a second pass over the output.
+//
+
+class MlasSgemmEpilogueTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferSum;
+  MatrixGuardBuffer<float> BufferCReference;
+
+  void Test(size_t M, size_t N, size_t K, const MLAS_ACTIVATION& Activation, bool WithResidual) {
+    const float* A = BufferA.GetFilledBuffer(M * K, [](float* start, size_t size) {
+      std::default_random_engine generator(static_cast<unsigned>(size));
+      std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+      for (size_t i = 0; i < size; i++) {
+        start[i] = distribution(generator);
+      }
+    });
+    const float* B = BufferB.GetFilledBuffer(K * N, [](float* start, size_t size) {
+      std::default_random_engine generator(static_cast<unsigned>(size) + 1);
+      std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+      for (size_t i = 0; i < size; i++) {
+        start[i] = distribution(generator);
+      }
+    });
+    const float* Sum = BufferSum.GetFilledBuffer(M * N, [](float* start, size_t size) {
+      std::default_random_engine generator(static_cast<unsigned>(size) + 2);
+      std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+      for (size_t i = 0; i < size; i++) {
+        start[i] = distribution(generator);
+      }
+    });
+    float* C = BufferC.GetBuffer(M * N, true);
+    float* CReference = BufferCReference.GetBuffer(M * N, true);
+
+    MLAS_SGEMM_ACTIVATION_PROCESSOR activation_processor(Activation);
+    MLAS_SGEMM_ACTIVATION_PROCESSOR residual_activation_processor(Activation, Sum);
+    MLAS_GEMM_EPILOGUE_CHAIN<float> chain;
+    chain.Append(WithResidual ? &residual_activation_processor : &activation_processor);
+
+    MLAS_SGEMM_DATA_PARAMS data;
+    data.A = A;
+    data.lda = K;
+    data.B = B;
+    data.ldb = N;
+    data.C = C;
+    data.ldc = N;
+    data.OutputProcessor = &chain;
+
+    MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, data, GetMlasThreadPool());
+
+    ReferenceGemm(M, N, K, A, B, CReference);
+    if (WithResidual) {
+      for (size_t i = 0; i < M * N; i++) {
+        CReference[i] += Sum[i];
+      }
+    }
+    MlasActivation(&Activation, CReference, nullptr, M, N, N);
+
+    for (size_t i = 0; i < M * N; i++) {
+      ASSERT_NEAR(C[i], CReference[i], 1e-5f)
+          << " M=" << M << ", N=" << N << ", K=" << K
+          << ", activation=" << int(Activation.ActivationKind)
+          << ", residual=" << WithResidual << ", index=" << i;
+    }
+  }
+
+  static void ReferenceGemm(size_t M, size_t N, size_t K, const float* A, const float* B, float* C) {
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        float sum = 0.0f;
+        for (size_t k = 0; k < K; k++) {
+          sum += A[m * K + k] * B[k * N + n];
+        }
+        C[m * N + n] = sum;
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("SgemmEpilogue");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    MLAS_ACTIVATION Relu;
+    Relu.ActivationKind = MlasReluActivation;
+
+    MLAS_ACTIVATION LeakyRelu;
+    LeakyRelu.ActivationKind = MlasLeakyReluActivation;
+    LeakyRelu.Parameters.LeakyRelu.alpha = 0.01f;
+
+    // Cover the single threaded path, the multi-tile threaded path, and ragged
+    // tile edges not divisible by the vector width.
+    for (size_t M : {1u, 7u, 63u, 256u}) {
+      for (size_t N : {1u, 30u, 128u}) {
+        Test(M, N, 32, Relu, false);
+        Test(M, N, 32, Relu, true);
+        Test(M, N, 32, LeakyRelu, false);
+      }
+    }
+  }
+};
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  return is_short_execute ? MlasDirectShortExecuteTests<MlasSgemmEpilogueTest>::RegisterShortExecute() : 0;
+});
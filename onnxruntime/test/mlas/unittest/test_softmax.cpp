@@ -94,6 +94,11 @@ class MlasSoftmaxTest : public MlasTestBase {
     Test(3, 128, 20.f, 30.f);
     Test(63, 95, -150.f, 190.f);
     Test(16, 211, 20.f, 30.f);
+
+    // Wide rows cover the two-pass online normalizer path used for rows that
+    // exceed the cache resident threshold, including a ragged vector tail.
+    Test(3, 4096, -10.f, 10.f);
+    Test(2, 5000, 20.f, 30.f);
   }
 };
 
@@ -20,6 +20,13 @@ class MlasTransposeTest : public MlasTestBase {
     ReferenceTranspose(Input, OutputReference, M, N);
 
     ASSERT_EQ(memcmp(Output, OutputReference, M * N * sizeof(ElementType)), 0) << " [" << M << "," << N << "]";
+
+    std::fill_n(Output, M * N, ElementType(0));
+
+    MlasTranspose(Input, Output, M, N, GetMlasThreadPool());
+
+    ASSERT_EQ(memcmp(Output, OutputReference, M * N * sizeof(ElementType)), 0)
+        << " [" << M << "," << N << "] (threaded)";
   }
 
   void ReferenceTranspose(const ElementType* Input, ElementType* Output, size_t M, size_t N) {
@@ -42,6 +49,11 @@ class MlasTransposeTest : public MlasTestBase {
         Test(m, n);
       }
     }
+
+    // larger shapes so the threaded overload splits the columns into multiple panels
+    Test(128, 1024);
+    Test(1024, 128);
+    Test(768, 771);
   }
 };
 
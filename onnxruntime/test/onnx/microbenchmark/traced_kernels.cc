@@ -0,0 +1,362 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Benchmarks generated from a session profile instead of being written by hand.
+//
+// Point ORT_KERNEL_BENCH_TRACE at a profiling json produced by a session run with
+// profiling enabled (SessionOptions.EnableProfiling). The kernels that accumulated
+// the most CPU time in the trace are registered as benchmarks and re-invoked through
+// the standalone op invoker (OrtApi::CreateOp/InvokeOp) with the exact input/output
+// shapes and element types the production run saw.
+//
+// Limitations, all reported via SkipWithError at run time rather than silently:
+//  - the profiler does not record node attributes, so only kernels that behave
+//    sensibly with default attribute values can be replayed;
+//  - the trace does not record the model opset, so the newest kernel registered
+//    for the op is benchmarked;
+//  - ops whose primary type constraint is not named "T" may resolve to a kernel
+//    variant other than the one the trace exercised.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "core/common/logging/logging.h"
+#include "core/framework/allocator.h"
+#include "core/framework/config_options.h"
+#include "core/framework/data_transfer_manager.h"
+#include "core/framework/data_types.h"
+#include "core/framework/kernel_registry.h"
+#include "core/framework/op_kernel.h"
+#include "core/framework/op_kernel_info.h"
+#include "core/framework/ort_value.h"
+#include "core/framework/ort_value_name_idx_map.h"
+#include "core/framework/tensor.h"
+#include "core/graph/constants.h"
+#include "core/graph/graph.h"
+#include "core/providers/cpu/cpu_execution_provider.h"
+#include "core/session/onnxruntime_c_api.h"
+
+#include "nlohmann/json.hpp"
+
+extern const OrtApi* g_ort;
+
+using namespace onnxruntime;
+using json = nlohmann::json;
+
+namespace {
+
+struct TensorSpec {
+  ONNXTensorElementDataType elem_type;
+  std::vector<int64_t> dims;
+};
+
+struct TracedKernel {
+  std::string op_name;
+  std::vector<TensorSpec> inputs;
+  std::vector<TensorSpec> outputs;
+  int64_t total_dur_us = 0;
+  int64_t invocations = 0;
+};
+
+// element type names as DataTypeImpl::ToString writes them into the trace
+ONNXTensorElementDataType ElementTypeFromTraceName(const std::string& name) {
+  static const std::unordered_map<std::string, ONNXTensorElementDataType> type_names = {
+      {"float", ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT},
+      {"double", ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE},
+      {"float16", ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16},
+      {"bfloat16", ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16},
+      {"int8", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8},
+      {"uint8", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8},
+      {"int16", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16},
+      {"uint16", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16},
+      {"int32", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32},
+      {"uint32", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32},
+      {"int64", ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64},
+      {"uint64", ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64},
+      {"bool", ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL}};
+  auto it = type_names.find(name);
+  return it == type_names.end() ? ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED : it->second;
+}
+
+// parses a "[{"float":[1,3,224,224]},...]" style type_shape array from the trace args
+bool ParseTypeShapes(const json& type_shapes, std::vector<TensorSpec>& specs) {
+  if (!type_shapes.is_array()) return false;
+  for (const auto& entry : type_shapes) {
+    if (!entry.is_object() || entry.size() != 1) return false;
+    const auto item = entry.begin();
+    TensorSpec spec;
+    spec.elem_type = ElementTypeFromTraceName(item.key());
+    if (spec.elem_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED) return false;
+    if (!item.value().is_array()) return false;
+    for (const auto& dim : item.value()) {
+      if (!dim.is_number_integer() || dim.get<int64_t>() < 0) return false;
+      spec.dims.push_back(dim.get<int64_t>());
+    }
+    specs.push_back(std::move(spec));
+  }
+  return !specs.empty();
+}
+
+std::vector<TracedKernel> ParseHotKernels(const char* trace_path, size_t max_kernels) {
+  std::vector<TracedKernel> result;
+  std::ifstream trace_file(trace_path);
+  if (!trace_file) {
+    std::cerr << "ORT_KERNEL_BENCH_TRACE: cannot open " << trace_path << std::endl;
+    return result;
+  }
+
+  json trace;
+  try {
+    trace = json::parse(trace_file);
+  } catch (const json::exception& e) {
+    std::cerr << "ORT_KERNEL_BENCH_TRACE: failed to parse " << trace_path << ": " << e.what() << std::endl;
+    return result;
+  }
+
+  const json& events = trace.is_object() && trace.contains("traceEvents") ? trace["traceEvents"] : trace;
+  if (!events.is_array()) return result;
+
+  constexpr const char* kKernelTimeSuffix = "_kernel_time";
+  std::unordered_map<std::string, TracedKernel> aggregated;
+  for (const auto& event : events) {
+    if (!event.is_object() || event.value("cat", "") != "Node") continue;
+    const std::string name = event.value("name", "");
+    if (name.size() < strlen(kKernelTimeSuffix) ||
+        name.compare(name.size() - strlen(kKernelTimeSuffix), std::string::npos, kKernelTimeSuffix) != 0) {
+      continue;
+    }
+    if (!event.contains("args") || !event["args"].is_object()) continue;
+    const auto& args = event["args"];
+    if (args.value("provider", "") != "CPUExecutionProvider") continue;
+    if (!args.contains("op_name") || !args.contains("input_type_shape") || !args.contains("output_type_shape")) {
+      continue;
+    }
+
+    TracedKernel kernel;
+    kernel.op_name = args["op_name"].get<std::string>();
+    if (!ParseTypeShapes(args["input_type_shape"], kernel.inputs) ||
+        !ParseTypeShapes(args["output_type_shape"], kernel.outputs)) {
+      continue;
+    }
+
+    // one bucket per (op, input signature) so that e.g. the first conv of a CNN and the
+    // stack of identically shaped ones in the body show up as separate benchmarks
+    const std::string key = kernel.op_name + "|" + args["input_type_shape"].dump();
+    auto [it, inserted] = aggregated.emplace(key, std::move(kernel));
+    it->second.total_dur_us += event.value("dur", static_cast<int64_t>(0));
+    ++it->second.invocations;
+  }
+
+  result.reserve(aggregated.size());
+  for (auto& entry : aggregated) {
+    result.push_back(std::move(entry.second));
+  }
+  std::sort(result.begin(), result.end(),
+            [](const TracedKernel& a, const TracedKernel& b) { return a.total_dur_us > b.total_dur_us; });
+  if (result.size() > max_kernels) {
+    result.resize(max_kernels);
+  }
+  return result;
+}
+
+// Stands in for the session-provided kernel context that OrtApi::InvokeOp expects.
+// Only the pieces InvokeOp reads are populated; the base class implementation of
+// GetTempSpaceAllocator would dereference the null kernel pointer, hence the override.
+class BenchmarkKernelContext : public OpKernelContext {
+ public:
+  BenchmarkKernelContext(concurrency::ThreadPool* threadpool, const logging::Logger& logger, AllocatorPtr allocator)
+      : OpKernelContext(threadpool, logger, nullptr), allocator_(std::move(allocator)) {}
+
+  Status GetTempSpaceAllocator(AllocatorPtr* output) const override {
+    *output = allocator_;
+    return Status::OK();
+  }
+
+ private:
+  AllocatorPtr allocator_;
+};
+
+OrtValue MakeCpuTensor(const TensorSpec& spec, const AllocatorPtr& allocator, bool fill_random) {
+  OrtValue value;
+  MLDataType elem_type = DataTypeImpl::TensorTypeFromONNXEnum(spec.elem_type)->GetElementType();
+  Tensor::InitOrtValue(elem_type, TensorShape(spec.dims), allocator, value);
+  Tensor& tensor = *value.GetMutable<Tensor>();
+  if (fill_random && tensor.IsDataType<float>()) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (auto& v : tensor.MutableDataAsSpan<float>()) v = dist(gen);
+  } else if (fill_random && tensor.IsDataType<double>()) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : tensor.MutableDataAsSpan<double>()) v = dist(gen);
+  } else {
+    // zero is a valid value for every remaining element type, index tensors included
+    memset(tensor.MutableDataRaw(), 0, tensor.SizeInBytes());
+  }
+  return value;
+}
+
+// the trace does not record the model opset, so probe downwards for the newest kernel
+constexpr int kMaxOpsetToTry = 23;
+
+void BM_TracedKernel(benchmark::State& state, const TracedKernel& spec) {
+  const auto& logger = logging::LoggingManager::DefaultLogger();
+  CPUExecutionProvider ep{CPUExecutionProviderInfo{}};
+  AllocatorPtr cpu_allocator = std::make_shared<CPUAllocator>();
+  AllocatorMap allocators{{cpu_allocator->Info().device, cpu_allocator}};
+  DataTransferManager data_transfer_mgr;
+  ConfigOptions config_options;
+
+  // a seed node of the benched op, used both to resolve the kernel version and as the
+  // node behind the seed OrtKernelInfo that CreateOp copies the provider pieces from
+  std::vector<std::unique_ptr<NodeArg>> arg_ptrs;
+  std::vector<NodeArg*> input_args;
+  std::vector<NodeArg*> output_args;
+  for (size_t i = 0; i < spec.inputs.size(); ++i) {
+    arg_ptrs.push_back(std::make_unique<NodeArg>(std::to_string(i), nullptr));
+    input_args.push_back(arg_ptrs.back().get());
+  }
+  for (size_t i = 0; i < spec.outputs.size(); ++i) {
+    arg_ptrs.push_back(std::make_unique<NodeArg>(std::to_string(i), nullptr));
+    output_args.push_back(arg_ptrs.back().get());
+  }
+  Node seed_node("traced_" + spec.op_name, spec.op_name, "", input_args, output_args, nullptr, kOnnxDomain);
+
+  KernelRegistry::TypeConstraintMap type_constraint_map;
+  MLDataType input_type =
+      DataTypeImpl::TensorTypeFromONNXEnum(spec.inputs[0].elem_type)->GetElementType();
+  type_constraint_map["T"] = input_type;
+
+  auto kernel_registry = ep.GetKernelRegistry();
+  const KernelCreateInfo* kernel_create_info = nullptr;
+  int op_version = 0;
+  for (int version = kMaxOpsetToTry; version > 0; --version) {
+    seed_node.SetSinceVersion(version);
+    if (kernel_registry->TryFindKernel(seed_node, ep.Type(), type_constraint_map, &kernel_create_info).IsOK() &&
+        kernel_create_info != nullptr) {
+      op_version = version;
+      break;
+    }
+    kernel_create_info = nullptr;
+  }
+  if (kernel_create_info == nullptr) {
+    state.SkipWithError(("no CPU kernel found for " + spec.op_name).c_str());
+    return;
+  }
+
+  static const std::unordered_map<int, OrtValue> kEmptyValueMap;
+  static const OrtValueNameIdxMap kEmptyNameMap;
+  OpKernelInfo seed_info(seed_node, *kernel_create_info->kernel_def, ep, kEmptyValueMap, kEmptyNameMap,
+                         data_transfer_mgr, allocators, config_options);
+
+  const char* type_constraint_names[] = {"T"};
+  ONNXTensorElementDataType type_constraint_values[] = {spec.inputs[0].elem_type};
+  OrtOp* op = nullptr;
+  OrtStatus* status = g_ort->CreateOp(reinterpret_cast<const OrtKernelInfo*>(&seed_info),
+                                      spec.op_name.c_str(), kOnnxDomain, op_version,
+                                      type_constraint_names, type_constraint_values, 1,
+                                      nullptr, 0,
+                                      static_cast<int>(spec.inputs.size()),
+                                      static_cast<int>(spec.outputs.size()), &op);
+  if (status != nullptr) {
+    std::string error = std::string("CreateOp failed for ") + spec.op_name + ": " + g_ort->GetErrorMessage(status);
+    g_ort->ReleaseStatus(status);
+    state.SkipWithError(error.c_str());
+    return;
+  }
+
+  std::vector<OrtValue> inputs;
+  std::vector<const OrtValue*> input_ptrs;
+  for (const auto& input_spec : spec.inputs) {
+    inputs.push_back(MakeCpuTensor(input_spec, cpu_allocator, /*fill_random*/ true));
+  }
+  for (const auto& input : inputs) {
+    input_ptrs.push_back(&input);
+  }
+  // preallocated outputs pass straight through the standalone kernel context, so the
+  // benchmark loop measures kernel compute without per-iteration output allocation
+  std::vector<OrtValue> outputs;
+  std::vector<OrtValue*> output_ptrs;
+  for (const auto& output_spec : spec.outputs) {
+    outputs.push_back(MakeCpuTensor(output_spec, cpu_allocator, /*fill_random*/ false));
+  }
+  for (auto& output : outputs) {
+    output_ptrs.push_back(&output);
+  }
+
+  OrtThreadPoolParams tpo;
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<concurrency::ThreadPool> tp(
+      concurrency::CreateThreadPool(&Env::Default(), tpo, concurrency::ThreadPoolType::INTRA_OP));
+  BenchmarkKernelContext ctx(tp.get(), logger, cpu_allocator);
+  auto* ort_ctx = reinterpret_cast<OrtKernelContext*>(static_cast<OpKernelContext*>(&ctx));
+
+  // validate once before timing; kernels that need non-default attributes fail here
+  status = g_ort->InvokeOp(ort_ctx, op, input_ptrs.data(), static_cast<int>(input_ptrs.size()),
+                           output_ptrs.data(), static_cast<int>(output_ptrs.size()));
+  if (status != nullptr) {
+    std::string error = std::string("InvokeOp failed for ") + spec.op_name + ": " + g_ort->GetErrorMessage(status);
+    g_ort->ReleaseStatus(status);
+    g_ort->ReleaseOp(op);
+    state.SkipWithError(error.c_str());
+    return;
+  }
+
+  for (auto _ : state) {
+    status = g_ort->InvokeOp(ort_ctx, op, input_ptrs.data(), static_cast<int>(input_ptrs.size()),
+                             output_ptrs.data(), static_cast<int>(output_ptrs.size()));
+    if (status != nullptr) {
+      g_ort->ReleaseStatus(status);
+      state.SkipWithError("InvokeOp failed");
+      break;
+    }
+  }
+  state.counters["trace_avg_us"] =
+      benchmark::Counter(static_cast<double>(spec.total_dur_us) / static_cast<double>(spec.invocations));
+
+  g_ort->ReleaseOp(op);
+}
+
+std::string BenchmarkName(const TracedKernel& kernel) {
+  std::string name = "BM_TracedKernel/" + kernel.op_name;
+  for (const auto& input : kernel.inputs) {
+    name += '/';
+    if (input.dims.empty()) {
+      name += "scalar";
+    } else {
+      for (size_t i = 0; i < input.dims.size(); ++i) {
+        if (i != 0) name += 'x';
+        name += std::to_string(input.dims[i]);
+      }
+    }
+  }
+  return name;
+}
+
+bool RegisterTracedKernelBenchmarks() {
+  const char* trace_path = getenv("ORT_KERNEL_BENCH_TRACE");
+  if (trace_path == nullptr) {
+    return false;
+  }
+  constexpr size_t kMaxTracedKernels = 10;
+  for (const auto& kernel : ParseHotKernels(trace_path, kMaxTracedKernels)) {
+    benchmark::RegisterBenchmark(BenchmarkName(kernel).c_str(),
+                                 [kernel](benchmark::State& state) { BM_TracedKernel(state, kernel); })
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+  return true;
+}
+
+const bool registered = RegisterTracedKernelBenchmarks();
+
+}  // namespace
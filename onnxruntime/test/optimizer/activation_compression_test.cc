@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "graph_transform_test_builder.h"
+
+#include "core/graph/graph.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(ActivationCompressionTests, CompressesSkipConnection) {
+  // A 1M element fp32 activation is consumed immediately by a Relu chain and again 17 nodes
+  // later. The distant edge is rerouted through a fp16 round trip (two Cast nodes), while the
+  // adjacent consumer keeps reading the original tensor.
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1024, 1024}, -1.f, 1.f);
+    auto* skip_arg = builder.MakeIntermediate();
+    builder.AddNode("Relu", {input_arg}, {skip_arg});
+    NodeArg* cur = skip_arg;
+    for (int i = 0; i < 16; ++i) {
+      auto* next = builder.MakeIntermediate();
+      builder.AddNode("Relu", {cur}, {next});
+      cur = next;
+    }
+    auto* output_arg = builder.MakeOutput();
+    builder.AddNode("Add", {skip_arg, cur}, {output_arg});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Cast"], 2);
+  };
+
+  auto add_session_options = [](SessionOptions& so) {
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsCompressLongLivedActivations, "1"));
+  };
+
+  TransformerTester(build_test_case,
+                    check_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3,
+                    14,
+                    // The compressed skip connection goes through a fp16 round trip.
+                    2e-3, 2e-3,
+                    nullptr, add_session_options);
+}
+
+TEST(ActivationCompressionTests, LeavesShortLivedActivationsAlone) {
+  // Same sized tensors, but every edge connects adjacent nodes, so nothing is compressed.
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1024, 1024}, -1.f, 1.f);
+    auto* relu_arg = builder.MakeIntermediate();
+    builder.AddNode("Relu", {input_arg}, {relu_arg});
+    auto* output_arg = builder.MakeOutput();
+    builder.AddNode("Add", {relu_arg, relu_arg}, {output_arg});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Cast"], 0);
+  };
+
+  auto add_session_options = [](SessionOptions& so) {
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsCompressLongLivedActivations, "1"));
+  };
+
+  TransformerTester(build_test_case,
+                    check_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3,
+                    14,
+                    0.0, 0.0,
+                    nullptr, add_session_options);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -270,6 +270,46 @@ TEST(CseTests, MergedValueAndGraphOutputAreOutputsOfSameNode) {
   ASSERT_EQ(op_count["Split"], 2);
 }
 
+TEST(CseTests, AttributeInsertionOrderDoesNotPreventMerge) {
+  // NodeAttributes is an unordered_map, so two nodes with equal attributes can iterate them in
+  // different orders. CSE must still recognize the nodes as equivalent.
+  Model model("cse_attribute_order", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{kOnnxDomain, 13}}, {}, DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& a = graph.GetOrCreateNodeArg("a", &float_tensor);
+  auto& b = graph.GetOrCreateNodeArg("b", &float_tensor);
+  auto& gemm_out_1 = graph.GetOrCreateNodeArg("gemm_out_1", &float_tensor);
+  auto& gemm_out_2 = graph.GetOrCreateNodeArg("gemm_out_2", &float_tensor);
+  auto& add_out = graph.GetOrCreateNodeArg("add_out", &float_tensor);
+
+  auto& gemm_1 = graph.AddNode("gemm_1", "Gemm", "", {&a, &b}, {&gemm_out_1});
+  gemm_1.AddAttribute("alpha", 0.5f);
+  gemm_1.AddAttribute("beta", 2.0f);
+  gemm_1.AddAttribute("transA", static_cast<int64_t>(0));
+  gemm_1.AddAttribute("transB", static_cast<int64_t>(1));
+
+  auto& gemm_2 = graph.AddNode("gemm_2", "Gemm", "", {&a, &b}, {&gemm_out_2});
+  gemm_2.AddAttribute("transB", static_cast<int64_t>(1));
+  gemm_2.AddAttribute("transA", static_cast<int64_t>(0));
+  gemm_2.AddAttribute("beta", 2.0f);
+  gemm_2.AddAttribute("alpha", 0.5f);
+
+  graph.AddNode("add", "Add", "", {&gemm_out_1, &gemm_out_2}, {&add_out});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+  ApplyCse(model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count["Gemm"], 1);
+  ASSERT_EQ(op_count["Add"], 1);
+}
+
 TEST(CseTests, MergeConstants) {
   auto model_uri = ORT_TSTR("testdata/transform/cse/cse_merge_constants.onnx");
   std::shared_ptr<Model> model;
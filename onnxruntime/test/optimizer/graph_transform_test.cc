@@ -24,6 +24,7 @@
 #include "core/optimizer/bias_dropout_fusion.h"
 #include "core/optimizer/bias_gelu_fusion.h"
 #include "core/optimizer/bias_softmax_fusion.h"
+#include "core/optimizer/cast_chain_elimination.h"
 #include "core/optimizer/cast_elimination.h"
 #include "core/optimizer/common_subexpression_elimination.h"
 #include "core/optimizer/concat_slice_elimination.h"
@@ -50,6 +51,7 @@
 #include "core/optimizer/graph_transformer_mgr.h"
 #include "core/optimizer/graph_transformer_utils.h"
 #include "core/optimizer/graph_transformer.h"
+#include "core/optimizer/group_query_attention_rotary_fusion.h"
 #include "core/optimizer/identity_elimination.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/isinf_reducesum_fusion.h"
@@ -1574,6 +1576,55 @@ TEST_F(GraphTransformationTests, FusePadWithMaxPoolOpsetLessThan11) {
   }
 }
 
+// Conv treats a missing "pads" attribute as all zeros; the fusion materializes it.
+TEST_F(GraphTransformationTests, FusePadWithConvNoPadsAttribute) {
+  auto pre_graph_checker = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["Pad"] == 1);
+    TEST_RETURN_IF_NOT(op_to_count["Conv"] == 1);
+    for (auto& node : graph.Nodes()) {
+      if (node.OpType() == "Conv") {
+        TEST_RETURN_IF_NOT(node.GetAttributes().find("pads") == node.GetAttributes().end());
+      }
+    }
+    return Status::OK();
+  };
+
+  auto post_graph_checker = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["Pad"] == 0);
+    TEST_RETURN_IF_NOT(op_to_count["Conv"] == 1);
+    for (auto& node : graph.Nodes()) {
+      if (node.OpType() == "Conv") {
+        auto pads_iter = node.GetAttributes().find("pads");
+        TEST_RETURN_IF_NOT(pads_iter != node.GetAttributes().end());
+        const auto& pads = pads_iter->second.ints();
+        TEST_RETURN_IF_NOT(pads.size() == 4);
+        for (int i = 0; i < 4; ++i) {
+          TEST_RETURN_IF_NOT(pads.Get(i) == 1);
+        }
+      }
+    }
+    return Status::OK();
+  };
+
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({{1, 1, 8, 8}});
+    auto* pads_arg = builder.MakeInitializer<int64_t>({8}, {0, 0, 1, 1, 0, 0, 1, 1});
+    auto* weight_arg = builder.MakeInitializer<float>({1, 1, 3, 3}, std::vector<float>(9, 1.0f));
+    auto* pad_out = builder.MakeIntermediate();
+    auto* conv_out = builder.MakeOutput();
+
+    builder.AddNode("Pad", {input_arg, pads_arg}, {pad_out});
+    builder.AddNode("Conv", {pad_out, weight_arg}, {conv_out});
+  };
+
+  auto rule_transformer = std::make_unique<RuleBasedGraphTransformer>("RuleTransformer");
+  ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<PadFusion>()));
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(rule_transformer),
+                                        TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+}
+
 TEST_F(GraphTransformationTests, FuseMatmulBNWithInBetweenNodes) {
   constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/fuse-matmul-bn-with-reshape.onnx";
 
@@ -2579,6 +2630,105 @@ TEST_F(GraphTransformationTests, TransposeMatmulFusionOnThreeTranspose) {
   ASSERT_TRUE(static_cast<bool>(node.GetAttributes().at("transB").i()));
 }
 
+TEST_F(GraphTransformationTests, TransposeMatmulFusionOnMatMulOutput) {
+  auto pre_graph_checker = [&](Graph& graph) {
+    TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["com.microsoft.FusedMatMul"] == 0);
+    return Status::OK();
+  };
+
+  // Transpose of the MatMul output swapping the two innermost dims is folded using (A x B)^T = B^T x A^T.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input1_arg = builder.MakeInput<float>({{2, 3, 16, 32}});
+      auto* input2_arg = builder.MakeInput<float>({{2, 3, 32, 64}});
+      auto* matmul_output = builder.MakeIntermediate();
+      auto* transpose_output = builder.MakeOutput();
+
+      builder.AddNode("MatMul", {input1_arg, input2_arg}, {matmul_output});
+      builder.AddNode("Transpose", {matmul_output}, {transpose_output})
+          .AddAttribute("perm", std::vector<int64_t>{0, 1, 3, 2});
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_to_count["Transpose"] == 0);
+      TEST_RETURN_IF_NOT(op_to_count["MatMul"] == 0);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.FusedMatMul"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "FusedMatMul") {
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("transA").i() == 1);
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("transB").i() == 1);
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("transBatchA").i() == 0);
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("transBatchB").i() == 0);
+        }
+      }
+      return Status::OK();
+    };
+
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::make_unique<MatmulTransposeFusion>(),
+                                          TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // Transposes on both an input and the output collapse into a single FusedMatMul.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input1_arg = builder.MakeInput<float>({{2, 3, 32, 16}});
+      auto* input2_arg = builder.MakeInput<float>({{2, 3, 32, 64}});
+      auto* transpose1_output = builder.MakeIntermediate();
+      auto* matmul_output = builder.MakeIntermediate();
+      auto* transpose2_output = builder.MakeOutput();
+
+      builder.AddNode("Transpose", {input1_arg}, {transpose1_output})
+          .AddAttribute("perm", std::vector<int64_t>{0, 1, 3, 2});
+      builder.AddNode("MatMul", {transpose1_output, input2_arg}, {matmul_output});
+      builder.AddNode("Transpose", {matmul_output}, {transpose2_output})
+          .AddAttribute("perm", std::vector<int64_t>{0, 1, 3, 2});
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_to_count["Transpose"] == 0);
+      TEST_RETURN_IF_NOT(op_to_count["MatMul"] == 0);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.FusedMatMul"] == 1);
+      for (auto& node : graph.Nodes()) {
+        if (node.OpType() == "FusedMatMul") {
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("transA").i() == 1);
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("transB").i() == 0);
+        }
+      }
+      return Status::OK();
+    };
+
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::make_unique<MatmulTransposeFusion>(),
+                                          TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  // A Transpose that also moves batch dims cannot be expressed with transA/transB and is left alone.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input1_arg = builder.MakeInput<float>({{2, 3, 16, 32}});
+      auto* input2_arg = builder.MakeInput<float>({{2, 3, 32, 64}});
+      auto* matmul_output = builder.MakeIntermediate();
+      auto* transpose_output = builder.MakeOutput();
+
+      builder.AddNode("MatMul", {input1_arg, input2_arg}, {matmul_output});
+      builder.AddNode("Transpose", {matmul_output}, {transpose_output})
+          .AddAttribute("perm", std::vector<int64_t>{3, 2, 1, 0});
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_to_count["Transpose"] == 1);
+      TEST_RETURN_IF_NOT(op_to_count["MatMul"] == 1);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.FusedMatMul"] == 0);
+      return Status::OK();
+    };
+
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::make_unique<MatmulTransposeFusion>(),
+                                          TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
 TEST_F(GraphTransformationTests, TransposeMatmulNoFusionOnInvalidInput) {
   const std::vector<PathString> model_uris = {
       MODEL_FOLDER "fusion/transpose_matmul_4d_fusion_invalid_perm.onnx",
@@ -4106,6 +4256,129 @@ TEST_F(GraphTransformationTests, CastElimination) {
   ASSERT_TRUE(op_to_count["Cast"] == 4);
 }
 
+TEST_F(GraphTransformationTests, CastChainElimination) {
+  // int32 -> int64 -> int32: the widening is value preserving, so the first Cast is removed and
+  // the second becomes a same-type cast that CastElimination then eliminates.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<int32_t>({{2, 3}});
+      auto* cast1_out = builder.MakeIntermediate();
+      auto* cast2_out = builder.MakeIntermediate();
+      auto* identity_out = builder.MakeOutput();
+
+      builder.AddNode("Cast", {input_arg}, {cast1_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT64));
+      builder.AddNode("Cast", {cast1_out}, {cast2_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT32));
+      builder.AddNode("Identity", {cast2_out}, {identity_out});
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Cast"] == 2);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Cast"] == 0);
+      return Status::OK();
+    };
+
+    auto rule_transformer = std::make_unique<RuleBasedGraphTransformer>("RuleTransformer");
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastElimination>()));
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastChainElimination>()));
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(rule_transformer),
+                                          TransformerLevel::Level1, 5, pre_graph_checker, post_graph_checker));
+  }
+
+  // fp16 -> fp32 -> int32: the first Cast is removed and the chain collapses to a direct
+  // fp16 -> int32 cast.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<MLFloat16>({{2, 3}});
+      auto* cast1_out = builder.MakeIntermediate();
+      auto* cast2_out = builder.MakeIntermediate();
+      auto* identity_out = builder.MakeOutput();
+
+      builder.AddNode("Cast", {input_arg}, {cast1_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+      builder.AddNode("Cast", {cast1_out}, {cast2_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT32));
+      builder.AddNode("Identity", {cast2_out}, {identity_out});
+    };
+
+    auto pre_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Cast"] == 2);
+      return Status::OK();
+    };
+
+    auto post_graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Cast"] == 1);
+      return Status::OK();
+    };
+
+    auto rule_transformer = std::make_unique<RuleBasedGraphTransformer>("RuleTransformer");
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastElimination>()));
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastChainElimination>()));
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(rule_transformer),
+                                          TransformerLevel::Level1, 5, pre_graph_checker, post_graph_checker));
+  }
+
+  // int64 -> int32 -> int64: the narrowing is not value preserving, so the chain must be kept.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<int64_t>({{2, 3}});
+      auto* cast1_out = builder.MakeIntermediate();
+      auto* cast2_out = builder.MakeIntermediate();
+      auto* identity_out = builder.MakeOutput();
+
+      builder.AddNode("Cast", {input_arg}, {cast1_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT32));
+      builder.AddNode("Cast", {cast1_out}, {cast2_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT64));
+      builder.AddNode("Identity", {cast2_out}, {identity_out});
+    };
+
+    auto graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Cast"] == 2);
+      return Status::OK();
+    };
+
+    auto rule_transformer = std::make_unique<RuleBasedGraphTransformer>("RuleTransformer");
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastElimination>()));
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastChainElimination>()));
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(rule_transformer),
+                                          TransformerLevel::Level1, 5, graph_checker, graph_checker));
+  }
+
+  // The intermediate value has a second consumer, so the first Cast must be kept.
+  {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<int32_t>({{2, 3}});
+      auto* cast1_out = builder.MakeIntermediate();
+      auto* cast2_out = builder.MakeIntermediate();
+      auto* identity1_out = builder.MakeOutput();
+      auto* identity2_out = builder.MakeOutput();
+
+      builder.AddNode("Cast", {input_arg}, {cast1_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT64));
+      builder.AddNode("Cast", {cast1_out}, {cast2_out})
+          .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_INT32));
+      builder.AddNode("Identity", {cast1_out}, {identity1_out});
+      builder.AddNode("Identity", {cast2_out}, {identity2_out});
+    };
+
+    auto graph_checker = [&](Graph& graph) {
+      TEST_RETURN_IF_NOT(CountOpsInGraph(graph)["Cast"] == 2);
+      return Status::OK();
+    };
+
+    auto rule_transformer = std::make_unique<RuleBasedGraphTransformer>("RuleTransformer");
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<CastChainElimination>()));
+    ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 13, *logger_, std::move(rule_transformer),
+                                          TransformerLevel::Level1, 5, graph_checker, graph_checker));
+  }
+}
+
 TEST_F(GraphTransformationTests, PreShapeNodeElimination) {
   constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "pre_shape_node_elimination.onnx";
   std::shared_ptr<Model> model;
@@ -4478,6 +4751,83 @@ TEST_F(GraphTransformationTests, AttentionFusionDistilBertTest) {
   EXPECT_EQ(op_to_count["Shape"], 0);
 }
 
+TEST_F(GraphTransformationTests, GroupQueryAttentionRotaryFusionTest) {
+  // Builds RotaryEmbedding nodes on the query and key inputs of a GroupQueryAttention node.
+  // When share_caches is false the two rotary nodes use separate cos/sin caches and must not fuse.
+  auto make_build_test_case = [](bool share_caches) {
+    return [share_caches](ModelTestBuilder& builder) {
+      auto* query = builder.MakeInput<float>({{1, 8, 64}});
+      auto* key = builder.MakeInput<float>({{1, 8, 32}});
+      auto* value = builder.MakeInput<float>({{1, 8, 32}});
+      auto* position_ids = builder.MakeInput<int64_t>({{1, 8}});
+      auto* seqlens_k = builder.MakeInput<int32_t>({{1}});
+      auto* total_seqlen = builder.MakeInput<int32_t>(std::vector<int64_t>{});
+      auto* cos_cache = builder.MakeInitializer<float>({32, 8}, -1.0f, 1.0f);
+      auto* sin_cache = builder.MakeInitializer<float>({32, 8}, -1.0f, 1.0f);
+      auto* k_cos_cache = share_caches ? cos_cache : builder.MakeInitializer<float>({32, 8}, -1.0f, 1.0f);
+      auto* k_sin_cache = share_caches ? sin_cache : builder.MakeInitializer<float>({32, 8}, -1.0f, 1.0f);
+      auto* past_key = builder.MakeEmptyInput();
+      auto* past_value = builder.MakeEmptyInput();
+      auto* rotary_q_out = builder.MakeIntermediate();
+      auto* rotary_k_out = builder.MakeIntermediate();
+      auto* output = builder.MakeOutput();
+      auto* present_key = builder.MakeOutput();
+      auto* present_value = builder.MakeOutput();
+
+      builder.AddNode("RotaryEmbedding", {query, position_ids, cos_cache, sin_cache}, {rotary_q_out}, kMSDomain);
+      builder.AddNode("RotaryEmbedding", {key, position_ids, k_cos_cache, k_sin_cache}, {rotary_k_out}, kMSDomain);
+      auto& gqa = builder.AddNode("GroupQueryAttention",
+                                  {rotary_q_out, rotary_k_out, value, past_key, past_value, seqlens_k, total_seqlen},
+                                  {output, present_key, present_value}, kMSDomain);
+      gqa.AddAttribute("num_heads", static_cast<int64_t>(4));
+      gqa.AddAttribute("kv_num_heads", static_cast<int64_t>(2));
+    };
+  };
+
+  auto pre_graph_checker = [](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    TEST_RETURN_IF_NOT(op_to_count["com.microsoft.RotaryEmbedding"] == 2);
+    TEST_RETURN_IF_NOT(op_to_count["com.microsoft.GroupQueryAttention"] == 1);
+    return Status::OK();
+  };
+
+  {
+    // shared caches: both rotary nodes fold into the attention node
+    auto post_graph_checker = [](Graph& graph) {
+      auto op_to_count = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.RotaryEmbedding"] == 0);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.GroupQueryAttention"] == 1);
+      for (const auto& node : graph.Nodes()) {
+        if (node.OpType() == "GroupQueryAttention") {
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("do_rotary").i() == 1);
+          TEST_RETURN_IF_NOT(node.GetAttributes().at("rotary_interleaved").i() == 0);
+          TEST_RETURN_IF_NOT(node.InputDefs().size() == 9);
+          TEST_RETURN_IF_NOT(node.InputDefs()[7]->Exists() && node.InputDefs()[8]->Exists());
+        }
+      }
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<GroupQueryAttentionRotaryFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(make_build_test_case(true), 17, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+
+  {
+    // separate caches: the rotations may differ, so the pattern must be left alone
+    auto post_graph_checker = [](Graph& graph) {
+      auto op_to_count = CountOpsInGraph(graph);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.RotaryEmbedding"] == 2);
+      TEST_RETURN_IF_NOT(op_to_count["com.microsoft.GroupQueryAttention"] == 1);
+      return Status::OK();
+    };
+
+    std::unique_ptr<GraphTransformer> transformer = std::make_unique<GroupQueryAttentionRotaryFusion>();
+    ASSERT_STATUS_OK(TestGraphTransformer(make_build_test_case(false), 17, *logger_, std::move(transformer),
+                                          TransformerLevel::Level2, 1, pre_graph_checker, post_graph_checker));
+  }
+}
+
 TEST_F(GraphTransformationTests, GeluFusionTest) {
   constexpr const ORTCHAR_T* model_uri = MODEL_FOLDER "fusion/gelu.onnx";
   std::shared_ptr<Model> p_model;
@@ -7224,6 +7574,146 @@ TEST_F(GraphTransformationTests, ConstantSharing_ShouldNotShareForGraphOutput) {
   }
 }
 
+TEST_F(GraphTransformationTests, ConstantSharing_ShareLargeInitializer) {
+  auto pre_graph_checker = [](Graph& graph) -> Status {
+    TEST_RETURN_IF_NOT(graph.GetAllInitializedTensors().size() == 3U);
+    return Status::OK();
+  };
+
+  auto post_graph_checker = [](Graph& graph) {
+    TEST_RETURN_IF_NOT(graph.GetAllInitializedTensors().size() == 1U);
+    const NodeArg* mul_initializer = nullptr;
+    for (auto& node : graph.Nodes()) {
+      if (node.OpType().compare("Mul") == 0) {
+        if (!mul_initializer) {
+          mul_initializer = node.InputDefs()[1];
+          TEST_RETURN_IF(mul_initializer == nullptr);
+          TEST_RETURN_IF_NOT(mul_initializer->Shape()->dim_size() == 2);
+        } else {
+          TEST_RETURN_IF_NOT(mul_initializer == node.InputDefs()[1]);
+        }
+      }
+    }
+    TEST_RETURN_IF(mul_initializer == nullptr);
+    return Status::OK();
+  };
+
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({{2, 8}});
+
+    std::vector<float> values(16);
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = static_cast<float>(i) * 0.25f;
+    }
+
+    // Three identical initializers above TENSOR_ELEM_COUNT_THRESHOLD elements.
+    for (size_t i = 0; i < 3; ++i) {
+      auto* mul_initializer = builder.MakeInitializer<float>({2, 8}, values);
+      auto* mul_out = builder.MakeOutput();
+      builder.AddNode("Mul", {input_arg, mul_initializer}, {mul_out});
+    }
+  };
+
+  std::unique_ptr<GraphTransformer> transformer = std::make_unique<ConstantSharing>();
+  ASSERT_STATUS_OK(TestGraphTransformer(build_test_case, 14, *logger_, std::move(transformer),
+                                        TransformerLevel::Level1,
+                                        1, pre_graph_checker, post_graph_checker));
+}
+
+TEST_F(GraphTransformationTests, ConstantSharing_ShareLargeInitializerAcrossSubgraph) {
+  // Build a 16-element float initializer duplicated in the main graph and in both If branches.
+  std::vector<float> values(16);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i) * 0.5f;
+  }
+
+  TensorProto value_tensor;
+  value_tensor.add_dims(16);
+  for (float v : values) {
+    value_tensor.add_float_data(v);
+  }
+  value_tensor.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+
+  TypeProto float_tensor_type;
+  float_tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(16);
+
+  auto create_subgraph = [&](GraphProto& graph_proto) {
+    // Subgraph multiplies an outer scope value by its own copy of the shared constant.
+    Model model("ConstantSharingSubgraphTest_subgraph", false, ModelMetaData(), PathString(),
+                IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {}, *logger_);
+    auto& graph = model.MainGraph();
+
+    TensorProto local_constant(value_tensor);
+    local_constant.set_name("sub_constant");
+    graph.AddInitializedTensor(local_constant);
+
+    auto& local_constant_arg = graph.GetOrCreateNodeArg("sub_constant", &float_tensor_type);
+    auto& outer_input_arg = graph.GetOrCreateNodeArg("main_in", &float_tensor_type);
+    graph.AddOuterScopeNodeArg("main_in");
+
+    auto& mul_out = graph.GetOrCreateNodeArg("mul_out", &float_tensor_type);
+    graph.AddNode("mul", "Mul", "Multiply by the duplicated constant.",
+                  {&outer_input_arg, &local_constant_arg}, {&mul_out});
+
+    auto& subgraph_out = graph.GetOrCreateNodeArg("subgraph_out", &float_tensor_type);
+    graph.AddNode("identity", "Identity", "So Mul isn't providing graph output.", {&mul_out}, {&subgraph_out});
+
+    ASSERT_STATUS_OK(graph.Resolve());
+    graph_proto = graph.ToGraphProto();
+  };
+
+  Model model("ConstantSharingSubgraphTest_main_graph", false, ModelMetaData(), PathString(),
+              IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 14}}, {}, *logger_);
+  auto& graph = model.MainGraph();
+
+  // Same constant owned (and consumed) by the main graph.
+  TensorProto parent_value_tensor(value_tensor);
+  parent_value_tensor.set_name("parent_constant");
+  graph.AddInitializedTensor(parent_value_tensor);
+
+  auto& main_input_arg = graph.GetOrCreateNodeArg("main_in", &float_tensor_type);
+  auto& parent_constant_arg = graph.GetOrCreateNodeArg("parent_constant", &float_tensor_type);
+  auto& main_mul_out = graph.GetOrCreateNodeArg("main_mul_out", &float_tensor_type);
+  graph.AddNode("main_mul", "Mul", "Main graph consumer of the shared constant.",
+                {&main_input_arg, &parent_constant_arg}, {&main_mul_out});
+
+  TypeProto if_cond_type;
+  if_cond_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_BOOL);
+  if_cond_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+  auto& if_cond_input = graph.GetOrCreateNodeArg("if_in", &if_cond_type);
+  auto& if_output = graph.GetOrCreateNodeArg("if_out", &float_tensor_type);
+
+  auto& if_node = graph.AddNode("if", "If", "If node", {&if_cond_input}, {&if_output});
+
+  GraphProto subgraph;
+  create_subgraph(subgraph);
+
+  if_node.AddAttribute("then_branch", subgraph);
+  if_node.AddAttribute("else_branch", subgraph);
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  std::unique_ptr<GraphTransformer> transformer = std::make_unique<ConstantSharing>();
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(transformer), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_));
+
+  // The main graph keeps its copy; both subgraphs should have dropped theirs and reference
+  // the parent-owned initializer through the outer scope.
+  ASSERT_EQ(graph.GetAllInitializedTensors().size(), 1U);
+  for (const char* branch : {"then_branch", "else_branch"}) {
+    Graph* subgraph_ptr = graph.GetNode(if_node.Index())->GetMutableGraphAttribute(branch);
+    ASSERT_TRUE(subgraph_ptr != nullptr);
+    ASSERT_EQ(subgraph_ptr->GetAllInitializedTensors().size(), 0U);
+    for (auto& node : subgraph_ptr->Nodes()) {
+      if (node.OpType().compare("Mul") == 0) {
+        ASSERT_EQ(node.InputDefs()[1]->Name(), "parent_constant");
+      }
+    }
+  }
+}
+
 TEST_F(GraphTransformationTests, GatherSliceToSplitFusion_AllGather) {
   auto build_test_case = [&](ModelTestBuilder& builder) {
     auto* data_arg = builder.MakeInput<float>({{54}});
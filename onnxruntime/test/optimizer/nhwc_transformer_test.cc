@@ -684,6 +684,38 @@ TEST_F(NhwcTransformerTestsFp16, ConvAveragePoolFp16) {
                     TransformerLevel::Level3);
 }
 
+TEST_F(NhwcTransformerTestsFp16, ConvReluChainFp16) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = MakeInputARangeFP16(builder, {1, 23, 13, 13}, MLFloat16(-1.5f), MLFloat16(1.5f));
+    auto* conv1_output_arg = builder.MakeIntermediate();
+    auto* relu1_output_arg = builder.MakeIntermediate();
+    auto* conv2_output_arg = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* conv1_weight_arg = MakeInitializerARangeFP16(builder, {30, 23, 3, 3}, MLFloat16(-1.5f), MLFloat16(1.5f));
+    auto* conv2_weight_arg = MakeInitializerARangeFP16(builder, {16, 30, 3, 3}, MLFloat16(-1.5f), MLFloat16(1.5f));
+
+    Node& conv1_node = builder.AddConvNode(input_arg, conv1_weight_arg, conv1_output_arg);
+    conv1_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    builder.AddNode("Relu", {conv1_output_arg}, {relu1_output_arg});
+    builder.AddConvNode(relu1_output_arg, conv2_weight_arg, conv2_output_arg);
+    builder.AddNode("Relu", {conv2_output_arg}, {output_arg});
+  };
+
+  // The layout transposes should be pushed through the Relu nodes so the interior of the chain is
+  // transpose-free and only the graph input/output transposes remain.
+  auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.NhwcFusedConv"], 2);
+    EXPECT_EQ(op_to_count["Relu"], 2);
+    EXPECT_EQ(op_to_count["Transpose"], 2);
+  };
+
+  TransformerTester(build_test_case,
+                    check_nhwc_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3);
+}
+
 #endif  // MLAS_F16VEC_INTRINSICS_SUPPORTED
 
 #endif  // DISABLE_CONTRIB_OPS
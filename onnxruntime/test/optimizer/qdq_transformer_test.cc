@@ -1040,6 +1040,99 @@ TEST(QDQTransformerTests, UnsqueezeDropQDQ) {
   RunSqueezeUnsqueezeDropQDQTestCase<uint16_t>("Unsqueeze", {1, 3, 2, 2}, {0}, false, 21);
 }
 
+// Runs a test case that checks if Q/DQ nodes are dropped from DQ -> Flatten -> Q.
+template <typename QuantType>
+static void RunFlattenDropQDQTestCase(const std::vector<int64_t>& input_shape,
+                                      int64_t axis = 1,
+                                      bool use_contrib_qdq = false,
+                                      int opset = 13) {
+  auto build_test_case = [input_shape, axis, use_contrib_qdq](ModelTestBuilder& builder) {
+    constexpr QuantType qmin = std::numeric_limits<QuantType>::min();
+    constexpr QuantType qmax = std::numeric_limits<QuantType>::max();
+
+    auto* input_arg = builder.MakeInput<QuantType>(input_shape, qmin, qmax);
+    auto* output_arg = builder.MakeOutput();
+    QuantType zero_point = 1 + (qmax + qmin) / 2;
+
+    // Add Flatten node
+    auto* input_arg_dq = builder.MakeIntermediate();
+    auto* flatten_output = builder.MakeIntermediate();
+    builder.AddDequantizeLinearNode<QuantType>(input_arg, .003f, zero_point, input_arg_dq, use_contrib_qdq);
+    Node& flatten_node = builder.AddNode("Flatten", {input_arg_dq}, {flatten_output});
+    flatten_node.AddAttribute("axis", axis);
+
+    // add Q
+    builder.AddQuantizeLinearNode<QuantType>(flatten_output, .003f, zero_point, output_arg, use_contrib_qdq);
+  };
+
+  auto check_graph = [use_contrib_qdq](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    const QDQOpKeys qdq_keys = GetQDQOpKeys(use_contrib_qdq);
+    EXPECT_EQ(op_to_count["Flatten"], 1);
+    EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], 0);
+    EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], 0);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, opset);
+}
+
+// Checks that Q/DQ nodes are dropped from DQ -> Flatten -> Q. Uses 8-bit and 16-bit Q/DQ ops.
+TEST(QDQTransformerTests, FlattenDropQDQ) {
+  RunFlattenDropQDQTestCase<int8_t>({1, 3, 2, 2});
+  RunFlattenDropQDQTestCase<int8_t>({1, 3, 2, 2}, 1, true);          // Use com.microsoft QDQ ops
+  RunFlattenDropQDQTestCase<int16_t>({1, 3, 2, 2}, 1, true);         // Use int16 com.microsoft QDQ ops
+  RunFlattenDropQDQTestCase<uint16_t>({1, 3, 2, 2}, 1, true);        // Use int16 com.microsoft QDQ ops
+  RunFlattenDropQDQTestCase<int16_t>({1, 3, 2, 2}, 1, false, 21);    // Use int16 ONNX QDQ ops
+  RunFlattenDropQDQTestCase<uint16_t>({1, 3, 2, 2}, 1, false, 21);   // Use int16 ONNX QDQ ops
+}
+
+// Runs a test case that checks if Q/DQ nodes are dropped from
+// DQ -> DepthToSpace/SpaceToDepth -> Q.
+template <typename QuantType>
+static void RunSpaceDepthDropQDQTestCase(const std::string& op_type,
+                                         const std::vector<int64_t>& input_shape,
+                                         int64_t blocksize,
+                                         bool use_contrib_qdq = false,
+                                         int opset = 13) {
+  auto build_test_case = [op_type, input_shape, blocksize, use_contrib_qdq](ModelTestBuilder& builder) {
+    constexpr QuantType qmin = std::numeric_limits<QuantType>::min();
+    constexpr QuantType qmax = std::numeric_limits<QuantType>::max();
+
+    auto* input_arg = builder.MakeInput<QuantType>(input_shape, qmin, qmax);
+    auto* output_arg = builder.MakeOutput();
+    QuantType zero_point = 1 + (qmax + qmin) / 2;
+
+    // Add DepthToSpace/SpaceToDepth node
+    auto* input_arg_dq = builder.MakeIntermediate();
+    auto* space_depth_output = builder.MakeIntermediate();
+    builder.AddDequantizeLinearNode<QuantType>(input_arg, .003f, zero_point, input_arg_dq, use_contrib_qdq);
+    Node& space_depth_node = builder.AddNode(op_type, {input_arg_dq}, {space_depth_output});
+    space_depth_node.AddAttribute("blocksize", blocksize);
+
+    // add Q
+    builder.AddQuantizeLinearNode<QuantType>(space_depth_output, .003f, zero_point, output_arg, use_contrib_qdq);
+  };
+
+  auto check_graph = [op_type, use_contrib_qdq](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    const QDQOpKeys qdq_keys = GetQDQOpKeys(use_contrib_qdq);
+    EXPECT_EQ(op_to_count[op_type], 1);
+    EXPECT_EQ(op_to_count[qdq_keys.quantize_linear], 0);
+    EXPECT_EQ(op_to_count[qdq_keys.dequantize_linear], 0);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, opset);
+}
+
+// Checks that Q/DQ nodes are dropped from DQ -> DepthToSpace -> Q and DQ -> SpaceToDepth -> Q.
+// Only 8-bit Q/DQ ops, the CPU kernels have no 16-bit support.
+TEST(QDQTransformerTests, SpaceDepthDropQDQ) {
+  RunSpaceDepthDropQDQTestCase<int8_t>("DepthToSpace", {1, 8, 2, 2}, 2);
+  RunSpaceDepthDropQDQTestCase<int8_t>("DepthToSpace", {1, 8, 2, 2}, 2, true);  // Use com.microsoft QDQ ops
+  RunSpaceDepthDropQDQTestCase<int8_t>("SpaceToDepth", {1, 2, 4, 4}, 2);
+  RunSpaceDepthDropQDQTestCase<int8_t>("SpaceToDepth", {1, 2, 4, 4}, 2, true);  // Use com.microsoft QDQ ops
+}
+
 TEST(QDQTransformerTests, DoubleQDQ) {
   constexpr uint8_t good_u8_1 = 80;
   constexpr uint8_t good_u8_2 = 40;
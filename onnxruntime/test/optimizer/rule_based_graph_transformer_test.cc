@@ -59,6 +59,110 @@ TEST(RuleBasedGraphTransformerTest, TestCompatibleProviders) {
   ASSERT_TRUE(dummy_rule1_ptr->IsRewriteRuleInvoked());
 }
 
+namespace {
+// Counts how often it is applied, optionally reporting the graph as modified for the
+// first 'modifying_applications' applications.
+class CountingGraphTransformer : public GraphTransformer {
+ public:
+  CountingGraphTransformer(const std::string& name, std::vector<std::string> target_op_types,
+                           int modifying_applications = 0)
+      : GraphTransformer(name),
+        target_op_types_(std::move(target_op_types)),
+        modifying_applications_(modifying_applications) {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return target_op_types_;
+  }
+
+  int ApplyCount() const {
+    return apply_count_;
+  }
+
+ private:
+  Status ApplyImpl(Graph& /*graph*/, bool& modified, int /*graph_level*/, const logging::Logger&) const override {
+    ++apply_count_;
+    if (apply_count_ <= modifying_applications_) {
+      modified = true;
+    }
+    return Status::OK();
+  }
+
+  const std::vector<std::string> target_op_types_;
+  const int modifying_applications_;
+  mutable int apply_count_ = 0;
+};
+}  // namespace
+
+TEST(RuleBasedGraphTransformerTest, TestTransformerSkippedWithoutCandidateOpTypes) {
+  auto model_uri = ORT_TSTR("testdata/transform/fusion/fuse-conv-bn-mul-add-unsqueeze.onnx");
+
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, model, nullptr, DefaultLoggingManager().DefaultLogger()));
+  Graph& graph = model->MainGraph();
+
+  auto absent_op_transformer = std::make_unique<CountingGraphTransformer>(
+      "AbsentOpTransformer", std::vector<std::string>{"NotARealOpType"});
+  const auto* absent_op_transformer_ptr = absent_op_transformer.get();
+
+  auto present_op_transformer = std::make_unique<CountingGraphTransformer>(
+      "PresentOpTransformer", std::vector<std::string>{"NotARealOpType", "Conv"});
+  const auto* present_op_transformer_ptr = present_op_transformer.get();
+
+  auto any_op_transformer = std::make_unique<CountingGraphTransformer>(
+      "AnyOpTransformer", std::vector<std::string>{});
+  const auto* any_op_transformer_ptr = any_op_transformer.get();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(absent_op_transformer), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(present_op_transformer), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(any_op_transformer), TransformerLevel::Level1));
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  // A transformer whose target op types are absent from the graph is never applied.
+  ASSERT_EQ(absent_op_transformer_ptr->ApplyCount(), 0);
+  // A transformer with at least one target op type in the graph is applied.
+  ASSERT_EQ(present_op_transformer_ptr->ApplyCount(), 1);
+  // A transformer with no declared target op types is always applied.
+  ASSERT_EQ(any_op_transformer_ptr->ApplyCount(), 1);
+}
+
+TEST(RuleBasedGraphTransformerTest, TestFixedPointSkipsRedundantReapplications) {
+  auto model_uri = ORT_TSTR("testdata/transform/fusion/fuse-conv-bn-mul-add-unsqueeze.onnx");
+
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, model, nullptr, DefaultLoggingManager().DefaultLogger()));
+  Graph& graph = model->MainGraph();
+
+  // The first transformer reports a modification on its first application only.
+  auto modifying_transformer = std::make_unique<CountingGraphTransformer>(
+      "ModifyingTransformer", std::vector<std::string>{}, /*modifying_applications*/ 1);
+  const auto* modifying_transformer_ptr = modifying_transformer.get();
+
+  auto stable_transformer_1 = std::make_unique<CountingGraphTransformer>(
+      "StableTransformer1", std::vector<std::string>{});
+  const auto* stable_transformer_1_ptr = stable_transformer_1.get();
+
+  auto stable_transformer_2 = std::make_unique<CountingGraphTransformer>(
+      "StableTransformer2", std::vector<std::string>{});
+  const auto* stable_transformer_2_ptr = stable_transformer_2.get();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(modifying_transformer), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(stable_transformer_1), TransformerLevel::Level1));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(stable_transformer_2), TransformerLevel::Level1));
+
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  // The modifying transformer runs a second time to confirm the fixed point, but the stable
+  // transformers already saw the final graph during the first step and are not re-applied.
+  ASSERT_EQ(modifying_transformer_ptr->ApplyCount(), 2);
+  ASSERT_EQ(stable_transformer_1_ptr->ApplyCount(), 1);
+  ASSERT_EQ(stable_transformer_2_ptr->ApplyCount(), 1);
+}
+
 TEST(RuleBasedGraphTransformerTest, TestSettingStepsInGraphTransformerManager) {
   // steps provided at object construction time
   onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
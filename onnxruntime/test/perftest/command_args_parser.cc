@@ -36,6 +36,10 @@ namespace perftest {
       "\t-M: Disable memory pattern.\n"
       "\t-A: Disable memory arena\n"
       "\t-I: Generate tensor input binding (Free dimensions are treated as 1.)\n"
+      "\t-l [shape_distribution_file]: Only works with -I. Benchmark a mix of shapes instead of a single fixed one. "
+      "The file is a JSON array of buckets, e.g. [{\"count\": 120, \"free_dims\": {\"batch_size\": 1, \"sequence_length\": 128}}, ...], "
+      "typically a histogram of dynamic axis values replayed from production logs. Each inference samples a bucket in "
+      "proportion to its count, and latency percentiles are additionally reported per bucket.\n"
       "\t-c [parallel runs]: Specifies the (max) number of runs to invoke simultaneously. Default:1.\n"
       "\t-e [cpu|cuda|dnnl|tensorrt|openvino|dml|acl|nnapi|coreml|qnn|snpe|rocm|migraphx|xnnpack|vitisai]: Specifies the provider 'cpu','cuda','dnnl','tensorrt', "
       "'openvino', 'dml', 'acl', 'nnapi', 'coreml', 'qnn', 'snpe', 'rocm', 'migraphx', 'xnnpack' or 'vitisai'. "
@@ -63,6 +67,9 @@ namespace perftest {
       "\t-C: Specify session configuration entries as key-value pairs: -C \"<key1>|<value1> <key2>|<value2>\" \n"
       "\t    Refer to onnxruntime_session_options_config_keys.h for valid keys and values. \n"
       "\t    [Example] -C \"session.disable_cpu_ep_fallback|1 ep.context_enable|1\" \n"
+      "\t-R: Specify run configuration entries as key-value pairs, applied to every Run() call: -R \"<key1>|<value1> <key2>|<value2>\" \n"
+      "\t    Refer to onnxruntime_run_options_config_keys.h for valid keys and values. \n"
+      "\t    [Example] -R \"run.deterministic_dispatch|1\" \n"
       "\t-i: Specify EP specific runtime options as key value pairs. Different runtime options available are: \n"
       "\t    [Usage]: -e <provider_name> -i '<key1>|<value1> <key2>|<value2>'\n"
       "\n"
@@ -205,7 +212,7 @@ static bool ParseSessionConfigs(const std::string& configs_string,
 
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("m:e:r:t:p:x:y:c:d:o:u:i:f:F:S:T:C:AMPIDZvhsqzn"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("m:e:r:t:p:x:y:c:d:o:u:i:f:F:l:S:T:C:R:AMPIDZvhsqzn"))) != -1) {
     switch (ch) {
       case 'f': {
         std::basic_string<ORTCHAR_T> dim_name;
@@ -358,6 +365,9 @@ static bool ParseSessionConfigs(const std::string& configs_string,
       case 'I':
         test_config.run_config.generate_model_input_binding = true;
         break;
+      case 'l':
+        test_config.run_config.shape_distribution_file = optarg;
+        break;
       case 'd':
         test_config.run_config.cudnn_conv_algo = static_cast<int>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
         break;
@@ -379,6 +389,12 @@ static bool ParseSessionConfigs(const std::string& configs_string,
         }
         break;
       }
+      case 'R': {
+        if (!ParseSessionConfigs(ToUTF8String(optarg), test_config.run_config.run_config_entries)) {
+          return false;
+        }
+        break;
+      }
       case 'D':
         test_config.run_config.disable_spinning = true;
         break;
@@ -395,6 +411,12 @@ static bool ParseSessionConfigs(const std::string& configs_string,
     }
   }
 
+  // -l samples synthetic inputs per bucket, so it needs the generated input binding
+  if (!test_config.run_config.shape_distribution_file.empty() &&
+      !test_config.run_config.generate_model_input_binding) {
+    return false;
+  }
+
   // parse model_path and result_file_path
   argc -= optind;
   argv += optind;
@@ -31,11 +31,18 @@ namespace perftest {
 
 std::chrono::duration<double> OnnxRuntimeTestSession::Run() {
   // Randomly pick one OrtValueArray from test_inputs_. (NOT ThreadSafe)
-  const std::uniform_int_distribution<int>::param_type p(0, static_cast<int>(test_inputs_.size() - 1));
-  const size_t id = static_cast<size_t>(dist_(rand_engine_, p));
+  size_t id;
+  if (!shape_distribution_.buckets.empty()) {
+    // Weight the pick by the observed shape mix so the results reflect production traffic.
+    id = static_cast<size_t>(shape_bucket_dist_(rand_engine_));
+    last_shape_bucket_ = static_cast<int>(id);
+  } else {
+    const std::uniform_int_distribution<int>::param_type p(0, static_cast<int>(test_inputs_.size() - 1));
+    id = static_cast<size_t>(dist_(rand_engine_, p));
+  }
   auto& input = test_inputs_.at(id);
   auto start = std::chrono::high_resolution_clock::now();
-  auto output_values = session_.Run(Ort::RunOptions{nullptr}, input_names_.data(), input.data(), input_names_.size(),
+  auto output_values = session_.Run(run_options_, input_names_.data(), input.data(), input_names_.size(),
                                     output_names_raw_ptr.data(), output_names_raw_ptr.size());
   auto end = std::chrono::high_resolution_clock::now();
   std::chrono::duration<double> duration_seconds = end - start;
@@ -806,6 +813,11 @@ select from 'TF8', 'TF16', 'UINT8', 'FLOAT', 'ITENSOR'. \n)");
     }
   }
 
+  // Run configuration entries are applied to every Run() call (see onnxruntime_run_options_config_keys.h).
+  for (auto& it : performance_test_config.run_config.run_config_entries) {
+    run_options_.AddConfigEntry(it.first.c_str(), it.second.c_str());
+  }
+
   session_ = Ort::Session(env, performance_test_config.model_info.model_file_path.c_str(), session_options);
 
   size_t output_count = session_.GetOutputCount();
@@ -826,6 +838,17 @@ select from 'TF8', 'TF16', 'UINT8', 'FLOAT', 'ITENSOR'. \n)");
     input_names_str_[i] = m.GetInputName(i);
     input_names_[i] = input_names_str_[i].c_str();
   }
+
+  if (!performance_test_config.run_config.shape_distribution_file.empty()) {
+    shape_distribution_ = ShapeDistribution::Load(performance_test_config.run_config.shape_distribution_file);
+    std::vector<double> weights;
+    weights.reserve(shape_distribution_.buckets.size());
+    for (const auto& bucket : shape_distribution_.buckets) {
+      weights.push_back(bucket.count);
+      shape_bucket_labels_.push_back(bucket.label);
+    }
+    shape_bucket_dist_ = std::discrete_distribution<int>(weights.begin(), weights.end());
+  }
 }
 
 template <typename T>
@@ -909,26 +932,41 @@ static void InitializeTensorWithSeed(int32_t seed, Ort::Value& tensor) {
 }
 
 bool OnnxRuntimeTestSession::PopulateGeneratedInputTestData(int32_t seed) {
-  // iterate over all input nodes
-  for (size_t i = 0; i < static_cast<size_t>(input_length_); i++) {
-    Ort::TypeInfo type_info = session_.GetInputTypeInfo(i);
-    Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
-    if (type_info.GetONNXType() == ONNX_TYPE_TENSOR) {
-      auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
-      std::vector<int64_t> input_node_dim = tensor_info.GetShape();
-
-      // free dimensions are treated as 1 if not overriden
-      for (int64_t& dim : input_node_dim) {
-        if (dim == -1) {
-          dim = 1;
+  // one set of inputs per shape bucket when a distribution was given, a single set otherwise
+  const size_t bucket_count = std::max<size_t>(shape_distribution_.buckets.size(), 1);
+  for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+    const ShapeBucket* shape_bucket =
+        shape_distribution_.buckets.empty() ? nullptr : &shape_distribution_.buckets[bucket];
+
+    // iterate over all input nodes
+    for (size_t i = 0; i < static_cast<size_t>(input_length_); i++) {
+      Ort::TypeInfo type_info = session_.GetInputTypeInfo(i);
+      Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+      if (type_info.GetONNXType() == ONNX_TYPE_TENSOR) {
+        auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
+        std::vector<int64_t> input_node_dim = tensor_info.GetShape();
+        std::vector<const char*> symbolic_dims(input_node_dim.size(), nullptr);
+        tensor_info.GetSymbolicDimensions(symbolic_dims.data(), symbolic_dims.size());
+
+        // free dimensions take the bucket's value, and are treated as 1 if not listed there
+        for (size_t dim = 0; dim < input_node_dim.size(); ++dim) {
+          if (input_node_dim[dim] == -1) {
+            input_node_dim[dim] = 1;
+            if (shape_bucket != nullptr && symbolic_dims[dim] != nullptr) {
+              auto it = shape_bucket->free_dims.find(symbolic_dims[dim]);
+              if (it != shape_bucket->free_dims.end()) {
+                input_node_dim[dim] = it->second;
+              }
+            }
+          }
         }
-      }
 
-      auto allocator = Ort::AllocatorWithDefaultOptions();
-      Ort::Value input_tensor = Ort::Value::CreateTensor(allocator, (const int64_t*)input_node_dim.data(),
-                                                         input_node_dim.size(), tensor_info.GetElementType());
-      InitializeTensorWithSeed(seed, input_tensor);
-      PreLoadTestData(0, i, std::move(input_tensor));
+        auto allocator = Ort::AllocatorWithDefaultOptions();
+        Ort::Value input_tensor = Ort::Value::CreateTensor(allocator, (const int64_t*)input_node_dim.data(),
+                                                           input_node_dim.size(), tensor_info.GetElementType());
+        InitializeTensorWithSeed(seed, input_tensor);
+        PreLoadTestData(bucket, i, std::move(input_tensor));
+      }
     }
   }
   return true;
@@ -4,6 +4,7 @@
 #pragma once
 #include <core/session/onnxruntime_cxx_api.h>
 #include <random>
+#include "shape_distribution.h"
 #include "test_configuration.h"
 #include "test_session.h"
 class TestModelInfo;
@@ -27,6 +28,11 @@ class OnnxRuntimeTestSession : public TestSession {
 
   bool PopulateGeneratedInputTestData(int32_t seed);
 
+  int GetLastShapeBucket() const override { return last_shape_bucket_; }
+
+  // Empty unless a shape distribution was given; bucket i labels test_inputs_[i].
+  const std::vector<std::string>& GetShapeBucketLabels() const { return shape_bucket_labels_; }
+
   ~OnnxRuntimeTestSession() = default;
 
   std::chrono::duration<double> Run() override;
@@ -35,6 +41,7 @@ class OnnxRuntimeTestSession : public TestSession {
 
  private:
   Ort::Session session_{nullptr};
+  Ort::RunOptions run_options_;
   std::mt19937 rand_engine_;
   std::uniform_int_distribution<int> dist_;
   std::vector<std::vector<Ort::Value>> test_inputs_;
@@ -46,6 +53,12 @@ class OnnxRuntimeTestSession : public TestSession {
   std::vector<std::string> input_names_str_;
   const int input_length_;
   std::string provider_name_;
+  // Populated from run_config.shape_distribution_file; test_inputs_[i] then holds the
+  // generated inputs for bucket i and Run() samples buckets by their observed counts.
+  ShapeDistribution shape_distribution_;
+  std::vector<std::string> shape_bucket_labels_;
+  std::discrete_distribution<int> shape_bucket_dist_;
+  int last_shape_bucket_{-1};
 };
 
 }  // namespace perftest
@@ -111,6 +111,40 @@ void PerformanceResult::DumpToFile(const std::basic_string<ORTCHAR_T>& path, boo
   }
 }
 
+void PerformanceResult::DumpShapeBucketStatistics(const std::vector<std::string>& bucket_labels) const {
+  std::vector<std::vector<double>> bucket_times(bucket_labels.size());
+  const size_t count = std::min(time_costs.size(), shape_buckets.size());
+  for (size_t i = 0; i < count; ++i) {
+    const int bucket = shape_buckets[i];
+    if (bucket >= 0 && static_cast<size_t>(bucket) < bucket_times.size()) {
+      bucket_times[static_cast<size_t>(bucket)].push_back(time_costs[i]);
+    }
+  }
+
+  for (size_t bucket = 0; bucket < bucket_times.size(); ++bucket) {
+    std::vector<double>& sorted_time = bucket_times[bucket];
+    std::cout << "Shape bucket [" << bucket_labels[bucket] << "]: " << sorted_time.size() << " runs\n";
+    if (sorted_time.empty()) {
+      continue;
+    }
+
+    size_t total = sorted_time.size();
+    size_t n50 = static_cast<size_t>(total * 0.5);
+    size_t n90 = static_cast<size_t>(total * 0.9);
+    size_t n95 = static_cast<size_t>(total * 0.95);
+    size_t n99 = static_cast<size_t>(total * 0.99);
+
+    std::sort(sorted_time.begin(), sorted_time.end());
+
+    std::cout << "\tMin Latency: " << sorted_time[0] << " s\n";
+    std::cout << "\tMax Latency: " << sorted_time[total - 1] << " s\n";
+    std::cout << "\tP50 Latency: " << sorted_time[n50] << " s\n";
+    std::cout << "\tP90 Latency: " << sorted_time[n90] << " s\n";
+    std::cout << "\tP95 Latency: " << sorted_time[n95] << " s\n";
+    std::cout << "\tP99 Latency: " << sorted_time[n99] << " s" << std::endl;
+  }
+}
+
 void PerformanceRunner::LogSessionCreationTime() {
   std::chrono::duration<double> session_create_duration = session_create_end_ - session_create_start_;
   std::cout << "\nSession creation time cost: " << session_create_duration.count() << " s\n";
@@ -165,6 +199,11 @@ Status PerformanceRunner::Run() {
             << "Peak working set size: " << performance_result_.peak_workingset_size << " bytes"
             << std::endl;
 
+  const auto& bucket_labels = static_cast<OnnxRuntimeTestSession*>(session_.get())->GetShapeBucketLabels();
+  if (!bucket_labels.empty()) {
+    performance_result_.DumpShapeBucketStatistics(bucket_labels);
+  }
+
   return Status::OK();
 }
 
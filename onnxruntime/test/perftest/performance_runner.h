@@ -34,9 +34,15 @@ struct PerformanceResult {
   short average_CPU_usage{0};
   double total_time_cost{0};
   std::vector<double> time_costs;
+  // Shape bucket sampled by each run; parallel to time_costs, -1 when no distribution is active.
+  std::vector<int> shape_buckets;
   std::string model_name;
 
   void DumpToFile(const std::basic_string<ORTCHAR_T>& path, bool f_include_statistics = false) const;
+
+  // Prints per-bucket latency statistics for shape-distribution runs; bucket_labels[i]
+  // describes the dynamic axis values behind bucket i.
+  void DumpShapeBucketStatistics(const std::vector<std::string>& bucket_labels) const;
 };
 
 class PerformanceRunner {
@@ -77,6 +83,7 @@ class PerformanceRunner {
     if (!isWarmup) {
       std::lock_guard<OrtMutex> guard(results_mutex_);
       performance_result_.time_costs.emplace_back(duration_seconds.count());
+      performance_result_.shape_buckets.emplace_back(session_->GetLastShapeBucket());
       performance_result_.total_time_cost += duration_seconds.count();
       if (performance_test_config_.run_config.f_verbose) {
         std::cout << "iteration:" << performance_result_.time_costs.size() << ","
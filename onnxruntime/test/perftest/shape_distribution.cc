@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "shape_distribution.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "nlohmann/json.hpp"
+
+#include <core/common/common.h>
+#include <core/platform/path_lib.h>
+
+namespace onnxruntime {
+namespace perftest {
+
+ShapeDistribution ShapeDistribution::Load(const std::basic_string<ORTCHAR_T>& path) {
+  std::ifstream stream{path};
+  ORT_ENFORCE(stream.good(), "failed to open shape distribution file '", ToUTF8String(path), "'");
+
+  const auto histogram = nlohmann::json::parse(stream);
+  ORT_ENFORCE(histogram.is_array() && !histogram.empty(),
+              "shape distribution file must hold a non-empty JSON array of buckets");
+
+  ShapeDistribution distribution;
+  distribution.buckets.reserve(histogram.size());
+  for (const auto& entry : histogram) {
+    ShapeBucket bucket;
+    bucket.count = entry.at("count").get<double>();
+    ORT_ENFORCE(bucket.count > 0, "shape bucket count must be > 0");
+
+    std::ostringstream label;
+    for (const auto& [name, value] : entry.at("free_dims").items()) {
+      const int64_t dim_value = value.get<int64_t>();
+      ORT_ENFORCE(dim_value > 0, "dynamic axis '", name, "' must have a positive value");
+      if (!bucket.free_dims.empty()) {
+        label << ",";
+      }
+      label << name << "=" << dim_value;
+      bucket.free_dims.emplace(name, dim_value);
+    }
+    ORT_ENFORCE(!bucket.free_dims.empty(), "each shape bucket needs at least one dynamic axis value");
+
+    bucket.label = label.str();
+    distribution.buckets.push_back(std::move(bucket));
+  }
+
+  return distribution;
+}
+
+}  // namespace perftest
+}  // namespace onnxruntime
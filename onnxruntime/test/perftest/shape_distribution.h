@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <core/session/onnxruntime_c_api.h>
+
+namespace onnxruntime {
+namespace perftest {
+
+// One bucket of a shape histogram: a combination of dynamic axis values together
+// with how often that combination was observed.
+struct ShapeBucket {
+  std::string label;                                   // e.g. "batch_size=4,sequence_length=128"
+  double count{0};                                     // observed frequency, used as the sampling weight
+  std::unordered_map<std::string, int64_t> free_dims;  // dynamic axis name -> value
+};
+
+// Histogram of dynamic axis values, typically replayed from production logs, used to
+// sample a shape per inference instead of benchmarking a single fixed shape.
+struct ShapeDistribution {
+  std::vector<ShapeBucket> buckets;
+
+  // Loads a JSON array of buckets, e.g.
+  //   [{"count": 120, "free_dims": {"batch_size": 1, "sequence_length": 128}}, ...]
+  // Throws on I/O or format errors so a bad histogram fails the run instead of
+  // silently benchmarking the wrong shapes.
+  static ShapeDistribution Load(const std::basic_string<ORTCHAR_T>& path);
+};
+
+}  // namespace perftest
+}  // namespace onnxruntime
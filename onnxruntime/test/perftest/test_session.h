@@ -17,6 +17,10 @@ class TestSession {
   void ThreadSafeRun() { abort(); }
   virtual void PreLoadTestData(size_t test_data_id, size_t input_id, Ort::Value&& value) = 0;
 
+  // When a shape distribution is active, identifies the bucket sampled by the most recent
+  // Run() call so the caller can aggregate latency per bucket. -1 when inactive.
+  virtual int GetLastShapeBucket() const { return -1; }
+
   virtual ~TestSession() = default;
 };
 }  // namespace perftest
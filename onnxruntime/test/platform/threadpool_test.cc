@@ -12,8 +12,10 @@
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <functional>
+#include <thread>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -434,6 +436,25 @@ TEST(ThreadPoolTest, TestBurstScheduling_65536Task) {
   TestBurstScheduling("TestBurstScheduling_65536Tasks", 65536);
 }
 
+TEST(ThreadPoolTest, TestAdaptiveSpinning) {
+  // Alternate idle gaps (which shrink the workers' spin budget) with bursts of loops (which
+  // grow it back) and check that work is still executed exactly once throughout.
+  onnxruntime::ThreadOptions thread_options;
+  thread_options.adaptive_spinning = true;
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), thread_options, nullptr, 4, true);
+
+  constexpr int num_tasks = 128;
+  for (int rep = 0; rep < 8; rep++) {
+    auto test_data = CreateTestData(num_tasks);
+    for (int loop = 0; loop < 16; loop++) {
+      ThreadPool::TrySimpleParallelFor(tp.get(), num_tasks,
+                                       [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    }
+    ValidateTestData(*test_data, 16);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+}
+
 TEST(ThreadPoolTest, TestPoolCreation_1Iter) {
   TestPoolCreation("TestPoolCreation_1Iter", 1);
 }
@@ -510,6 +531,85 @@ TEST(ThreadPoolTest, TestStagedMultiLoopSections_4Thread_100Loop) {
   TestStagedMultiLoopSections("TestStagedMultiLoopSections_4Thread_100Loop", 4, 100);
 }
 
+TEST(ThreadPoolTest, TestPriorityScope) {
+  using Priority = ThreadPool::Priority;
+  ASSERT_EQ(ThreadPool::CurrentThreadPriority(), Priority::kNormal);
+  {
+    ThreadPool::PriorityScope low(Priority::kLow);
+    ASSERT_EQ(ThreadPool::CurrentThreadPriority(), Priority::kLow);
+    {
+      ThreadPool::PriorityScope high(Priority::kHigh);
+      ASSERT_EQ(ThreadPool::CurrentThreadPriority(), Priority::kHigh);
+    }
+    ASSERT_EQ(ThreadPool::CurrentThreadPriority(), Priority::kLow);
+  }
+  ASSERT_EQ(ThreadPool::CurrentThreadPriority(), Priority::kNormal);
+}
+
+TEST(ThreadPoolTest, TestConcurrentLoopsWithPriorities) {
+  // A low-priority loop gives its worker threads up while a high-priority loop is
+  // running, with the remaining iterations run by the thread that started it.
+  // Whatever the interleaving, every loop must execute each iteration exactly once.
+  for (int rep = 0; rep < 5; rep++) {
+    CreateThreadPoolAndTest("TestConcurrentLoopsWithPriorities", 4, [&](ThreadPool* tp) {
+      constexpr int num_tasks = 1024;
+      auto low_test_data = CreateTestData(num_tasks);
+      auto high_test_data = CreateTestData(num_tasks);
+      Barrier b(1);
+
+      ThreadPool::Schedule(tp, [&]() {
+        ThreadPool::PriorityScope scope(ThreadPool::Priority::kLow);
+        ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) {
+          IncrementElement(*low_test_data, i);
+        });
+        b.Notify();
+      });
+
+      {
+        ThreadPool::PriorityScope scope(ThreadPool::Priority::kHigh);
+        ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t i) {
+          IncrementElement(*high_test_data, i);
+        });
+      }
+
+      b.Wait();
+      ValidateTestData(*low_test_data);
+      ValidateTestData(*high_test_data);
+    });
+  }
+}
+
+TEST(ThreadPoolTest, TestParallelismCapScope) {
+  CreateThreadPoolAndTest("TestParallelismCapScope", 4, [](ThreadPool* tp) {
+    const int dop = ThreadPool::DegreeOfParallelism(tp);
+    ASSERT_GE(dop, 3);
+    {
+      ThreadPool::ParallelismCapScope cap(2);
+      ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 2);
+      {
+        // A nested scope can lower the cap but not raise it.
+        ThreadPool::ParallelismCapScope wider(3);
+        ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 2);
+      }
+      {
+        ThreadPool::ParallelismCapScope narrower(1);
+        ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 1);
+      }
+      ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), 2);
+
+      // A capped loop still processes every element exactly once.
+      auto test_data = CreateTestData(1000);
+      ThreadPool::TryParallelFor(tp, 1000, 1.0, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (auto i = first; i < last; i++) {
+          IncrementElement(*test_data, i);
+        }
+      });
+      ValidateTestData(*test_data);
+    }
+    ASSERT_EQ(ThreadPool::DegreeOfParallelism(tp), dop);
+  });
+}
+
 #ifdef _WIN32
 #if WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
 #pragma warning(push)
@@ -5,6 +5,7 @@
 #include "gmock/gmock.h"
 #include "core/framework/session_state.h"
 #include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/providers/common.h"
 #include "core/providers/cpu/controlflow/scan_utils.h"
 #include "test/providers/provider_test_utils.h"
@@ -1181,6 +1182,51 @@ void UnknownDimInSubgraphOutput(bool is_v8, bool mixed_execution_providers = fal
 
 TEST_8_AND_9(UnknownDimInSubgraphOutput);
 
+// Scan with no loop state variables, so the iterations are independent of each other.
+// With kOrtSessionOptionsParallelScanIterations enabled and the inter-op pool available (parallel execution mode),
+// the iterations after the first run concurrently and must produce the same results as the sequential default.
+TEST(Scan9, NoLoopStateVarsParallelIterations) {
+  // subgraph: scan_input_0 -> [Add] -> scan_output_0 (doubles each slice of the scan input)
+  Model model("ParallelIterationsSubgraph", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{"", 11}}, {}, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& scan_in_0 = graph.GetOrCreateNodeArg("scan_in_0", &float_tensor);
+  auto& scan_out_0 = graph.GetOrCreateNodeArg("scan_out_0", &float_tensor);
+  graph.AddNode("add", "Add", "Double the scan input", {&scan_in_0, &scan_in_0}, {&scan_out_0});
+
+  graph.SetInputs({&scan_in_0});
+  graph.SetOutputs({&scan_out_0});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  constexpr int64_t sequence_len = 8;
+  constexpr int64_t input_size = 2;
+
+  std::vector<float> input_data(sequence_len * input_size);
+  std::vector<float> output_data(sequence_len * input_size);
+  for (size_t i = 0; i < input_data.size(); ++i) {
+    input_data[i] = static_cast<float>(i);
+    output_data[i] = input_data[i] * 2.f;
+  }
+
+  OpTester test("Scan", 11);
+  test.AddAttribute("body", graph.ToGraphProto());
+  test.AddAttribute<int64_t>("num_scan_inputs", 1);
+  test.AddInput<float>("scan_input_0", {sequence_len, input_size}, input_data);
+  test.AddOutput<float>("scan_output_0", {sequence_len, input_size}, output_data);
+
+  SessionOptions so;
+  so.execution_mode = ExecutionMode::ORT_PARALLEL;  // the inter-op pool is only created in parallel mode
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsParallelScanIterations, "1"));
+
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "",
+           {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 #if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(Scan, MixedExecutionProviders) {
   RunOptions options{};
@@ -247,5 +247,33 @@ TEST(CumSumTest, _1DTestdouble_WithInt64Axis) {
   test.AddOutput<double>("y", {5}, {1., 3., 6., 10., 15.});
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
 }
+// A scan long enough to exercise the parallel block scan and its offset fix-up pass on the CPU
+// provider. An all-ones input keeps the expected values exact for every block boundary.
+TEST(CumSumTest, _1DTestLargeInt32) {
+  constexpr int32_t n = 100000;
+  std::vector<int32_t> x(n, 1);
+  std::vector<int32_t> y(n);
+  for (int32_t i = 0; i < n; ++i)
+    y[static_cast<size_t>(i)] = i + 1;
+  OpTester test("CumSum", 11, onnxruntime::kOnnxDomain);
+  test.AddInput<int32_t>("x", {n}, x);
+  test.AddInput<int32_t>("axis", {}, {0});
+  test.AddOutput<int32_t>("y", {n}, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+TEST(CumSumTest, _1DTestLargeReverseExclusive) {
+  constexpr int32_t n = 100000;
+  std::vector<float> x(n, 1.f);
+  std::vector<float> y(n);
+  for (int32_t i = 0; i < n; ++i)
+    y[static_cast<size_t>(i)] = static_cast<float>(n - 1 - i);
+  OpTester test("CumSum", 11, onnxruntime::kOnnxDomain);
+  test.AddAttribute<int64_t>("exclusive", 1);
+  test.AddAttribute<int64_t>("reverse", 1);
+  test.AddInput<float>("x", {n}, x);
+  test.AddInput<int32_t>("axis", {}, {0});
+  test.AddOutput<float>("y", {n}, y);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
 }  // namespace test
 }  // namespace onnxruntime
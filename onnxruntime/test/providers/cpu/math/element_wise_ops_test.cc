@@ -263,6 +263,42 @@ TEST(MathOpTest, Add_Broadcast_MultidirectionalBA) {
 #endif  // USE_DNNL
 }
 
+TEST(MathOpTest, Add_Broadcast_SmallRowReplay) {
+  // a short row broadcast across a large output takes the tiled fast path on CPU.
+  // 4250 rows of 3 elements covers multiple tiles plus a remainder that doesn't fill a tile.
+  const std::vector<int64_t> large_dims{5, 850, 3};
+  const std::vector<int64_t> row_dims{3};
+  const std::vector<float> row_values{1.0f, 2.0f, 3.0f};
+
+  std::vector<float> large_values;
+  std::vector<float> out_values;
+  large_values.reserve(5 * 850 * 3);
+  out_values.reserve(5 * 850 * 3);
+  for (size_t i = 0; i < 5 * 850 * 3; ++i) {
+    large_values.push_back(static_cast<float>(i % 17) * 0.5f);
+    out_values.push_back(large_values[i] + row_values[i % 3]);
+  }
+
+  auto run = [&](bool row_first) {
+    OpTester test("Add");
+    if (row_first) {
+      test.AddInput<float>("A", row_dims, row_values);
+      test.AddInput<float>("B", large_dims, large_values);
+    } else {
+      test.AddInput<float>("A", large_dims, large_values);
+      test.AddInput<float>("B", row_dims, row_values);
+    }
+    test.AddOutput<float>("C", large_dims, out_values);
+
+    std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+    execution_providers.push_back(DefaultCpuExecutionProvider());
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+  };
+
+  run(true);
+  run(false);
+}
+
 TEST(MathOpTest, Add_Broadcast_0x0) {
   OpTester test("Add");
 
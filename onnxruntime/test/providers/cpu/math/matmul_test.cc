@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/providers/run_options_config_keys.h"
 #include "test/common/dnnl_op_test_utils.h"
@@ -300,6 +301,78 @@ TEST(MathOpTest, MatMul_bfloat16) {
 
 #ifndef ENABLE_TRAINING
 // Prepacking is disabled in full training build so no need to test the feature in a training build.
+TEST(MathOpTest, MatMulSparseWeight) {
+  OpTester test("MatMul");
+
+  // A 4x8 weight with 75% zeros; the threshold of 0.5 triggers the CSR pre-pack.
+  std::vector<float> b_init_values(32, 0.0f);
+  b_init_values[0] = 1.0f;    // (0, 0)
+  b_init_values[5] = 2.0f;    // (0, 5)
+  b_init_values[9] = -3.0f;   // (1, 1)
+  b_init_values[15] = 4.0f;   // (1, 7)
+  b_init_values[18] = 0.5f;   // (2, 2)
+  b_init_values[24] = -1.0f;  // (3, 0)
+  b_init_values[25] = 1.5f;   // (3, 1)
+  b_init_values[31] = 2.0f;   // (3, 7)
+
+  test.AddInput<float>("A", {2, 4},
+                       {1.0f, 2.0f, 3.0f, 4.0f,
+                        -1.0f, 0.0f, -3.0f, -4.0f});
+  // B is to be an initializer for triggering pre-packing
+  test.AddInput<float>("B", {4, 8}, b_init_values, true);
+
+  test.AddOutput<float>("Y", {2, 8},
+                        {-3.0f, 0.0f, 1.5f, 0.0f, 0.0f, 2.0f, 0.0f, 16.0f,
+                         3.0f, -6.0f, -1.5f, 0.0f, 0.0f, -2.0f, 0.0f, -8.0f});
+
+  SessionOptions so;
+  ASSERT_EQ(so.config_options.AddConfigEntry(kOrtSessionOptionsMatMulSparseWeightThreshold, "0.5"), Status::OK());
+
+  test.Config(so)
+      .Config(run_with_tunable_op)
+      .ConfigEps([]() {
+        std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+        execution_providers.push_back(DefaultCpuExecutionProvider());
+        return execution_providers;
+      }())
+      .RunWithConfig();
+}
+
+TEST(MathOpTest, MatMulSparseWeightBatched) {
+  OpTester test("MatMul");
+
+  // A batched A exercises the per-batch loop of the sparse path.
+  std::vector<float> b_init_values(6, 0.0f);
+  b_init_values[1] = 2.0f;  // (0, 1)
+  b_init_values[5] = 3.0f;  // (1, 2)
+
+  test.AddInput<float>("A", {2, 2, 2},
+                       {1.0f, 2.0f,
+                        3.0f, 4.0f,
+                        -1.0f, -2.0f,
+                        -3.0f, -4.0f});
+  // B is to be an initializer for triggering pre-packing
+  test.AddInput<float>("B", {2, 3}, b_init_values, true);
+
+  test.AddOutput<float>("Y", {2, 2, 3},
+                        {0.0f, 2.0f, 6.0f,
+                         0.0f, 6.0f, 12.0f,
+                         0.0f, -2.0f, -6.0f,
+                         0.0f, -6.0f, -12.0f});
+
+  SessionOptions so;
+  ASSERT_EQ(so.config_options.AddConfigEntry(kOrtSessionOptionsMatMulSparseWeightThreshold, "0.6"), Status::OK());
+
+  test.Config(so)
+      .Config(run_with_tunable_op)
+      .ConfigEps([]() {
+        std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+        execution_providers.push_back(DefaultCpuExecutionProvider());
+        return execution_providers;
+      }())
+      .RunWithConfig();
+}
+
 TEST(MathOpTest, MatMulSharedPrepackedWeights) {
   OpTester test("MatMul");
 
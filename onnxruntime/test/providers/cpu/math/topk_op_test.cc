@@ -861,5 +861,15 @@ TEST(TopKOperator, SelectTopKThreaded) {
   TestThreaded<double>(k, n, batch_size);
 }
 
+// create a single large row so there are fewer rows than threads and the in-row parallel path
+// is used, with the per-chunk candidates merged by a final selection
+TEST(TopKOperator, SingleRowInRowParallelThreaded) {
+  constexpr int64_t k = 100;
+  constexpr int64_t n = 1;
+  constexpr int64_t batch_size = 16384;
+  TestThreaded<float>(k, n, batch_size);
+  TestThreaded<double>(k, n, batch_size);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
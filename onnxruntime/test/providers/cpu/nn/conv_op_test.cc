@@ -2,7 +2,9 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/asserts.h"
 using namespace std;
 namespace onnxruntime {
 namespace test {
@@ -730,5 +732,40 @@ TEST(ConvTest, Conv_AutoPad_with_non_default_strides) {
   TestConvOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape, true);
 }
 
+// 3x3/stride-1 conv with enough channels to take the opt-in Winograd path on CPU.
+TEST(ConvTest, Conv2D_Winograd) {
+  OpTester test("Conv");
+  test.AddAttribute("group", int64_t(1));
+  test.AddAttribute("kernel_shape", vector<int64_t>{3, 3});
+  test.AddAttribute("pads", vector<int64_t>{1, 1, 1, 1});
+  test.AddAttribute("strides", vector<int64_t>{1, 1});
+
+  vector<float> X(8 * 4 * 4, 1.0f);
+  vector<float> W(8 * 8 * 3 * 3, 1.0f);
+
+  // with all-ones input and weights each output value is the channel count times
+  // the number of kernel taps that land inside the padded input
+  const float taps[16] = {4.0f, 6.0f, 6.0f, 4.0f,
+                          6.0f, 9.0f, 9.0f, 6.0f,
+                          6.0f, 9.0f, 9.0f, 6.0f,
+                          4.0f, 6.0f, 6.0f, 4.0f};
+  vector<float> expected_vals;
+  for (int m = 0; m < 8; ++m) {
+    for (int i = 0; i < 16; ++i) {
+      expected_vals.push_back(8.0f * taps[i]);
+    }
+  }
+
+  test.AddInput<float>("X", {1, 8, 4, 4}, X);
+  test.AddInput<float>("W", {8, 8, 3, 3}, W);
+  test.AddOutput<float>("Y", {1, 8, 4, 4}, expected_vals);
+
+  SessionOptions so;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsEnableWinogradConvolution, "1"));
+  test.Config(so)
+      .ConfigExcludeEps({kTensorrtExecutionProvider, kCudaNHWCExecutionProvider, kQnnExecutionProvider})
+      .RunWithConfig();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/mlas/inc/mlas.h"
+
+#ifdef MLAS_F16VEC_INTRINSICS_SUPPORTED
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+#include "default_providers.h"
+
+using namespace std;
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+struct ConvTransposeFp16OpAttributes {
+  vector<int64_t> kernel_shape;
+  vector<int64_t> output_padding;
+  vector<int64_t> output_shape;
+  vector<int64_t> pads;
+  vector<int64_t> strides;
+  vector<int64_t> dilations;
+  int64_t group;
+  string auto_pad;
+};
+
+vector<MLFloat16> ToFp16(const vector<float>& data) {
+  vector<MLFloat16> result;
+  result.reserve(data.size());
+  for (float v : data) {
+    result.emplace_back(v);
+  }
+  return result;
+}
+
+void TestConvTransposeFp16OpInitializer(const ConvTransposeFp16OpAttributes& attributes,
+                                        const vector<vector<float>>& inputs,
+                                        const vector<vector<int64_t>>& input_shapes,
+                                        const vector<float>& expected_output,
+                                        const vector<int64_t>& expected_output_shape,
+                                        bool is_filter_initializer = false) {
+  OpTester test("ConvTranspose", 11);
+  test.AddAttribute("kernel_shape", attributes.kernel_shape);
+  test.AddAttribute("group", attributes.group);
+
+  // Only one of pads / auto_pad can be present
+  if (!attributes.pads.empty()) {
+    test.AddAttribute("pads", attributes.pads);
+  } else {
+    test.AddAttribute("auto_pad", attributes.auto_pad);
+  }
+
+  if (!attributes.output_padding.empty()) {
+    test.AddAttribute("output_padding", attributes.output_padding);
+  }
+  if (!attributes.output_shape.empty()) {
+    test.AddAttribute("output_shape", attributes.output_shape);
+  }
+
+  if (!attributes.strides.empty()) {
+    test.AddAttribute("strides", attributes.strides);
+  }
+
+  if (!attributes.dilations.empty()) {
+    test.AddAttribute("dilations", attributes.dilations);
+  }
+
+  ORT_ENFORCE(inputs.size() <= 3, "Our name array is only setup to handle 3 inputs");
+  const char* szNames[] = {"X", "W", "B"};
+  bool isInitializers[] = {false, is_filter_initializer, false};
+  for (size_t i = 0; i < inputs.size(); i++) {
+    test.AddInput<MLFloat16>(szNames[i], input_shapes[i], ToFp16(inputs[i]), isInitializers[i]);
+  }
+  test.AddOutput<MLFloat16>("Y", expected_output_shape, ToFp16(expected_output), /*no sort*/ false, 0.005f, 0.005f);
+
+  // Disable TensorRT because weight as input is not supported
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "",
+           {kCudaNHWCExecutionProvider, kTensorrtExecutionProvider, kQnnExecutionProvider,
+            kOpenVINOExecutionProvider});
+}
+
+void TestConvTransposeFp16Op(const ConvTransposeFp16OpAttributes& attributes,
+                             const vector<vector<float>>& inputs,
+                             const vector<vector<int64_t>>& input_shapes,
+                             const vector<float>& expected_output,
+                             const vector<int64_t>& expected_output_shape) {
+  // Run with the filter as an initializer to exercise PrePack, and as a
+  // regular input to exercise the dynamic-weight transpose.
+  TestConvTransposeFp16OpInitializer(attributes, inputs, input_shapes, expected_output, expected_output_shape, true);
+  TestConvTransposeFp16OpInitializer(attributes, inputs, input_shapes, expected_output, expected_output_shape, false);
+}
+
+}  // namespace
+
+TEST(ConvTransposeFp16Test, ConvTranspose_1D) {
+  ConvTransposeFp16OpAttributes attrs{
+      vector<int64_t>{3},     // kernel_shape
+      {},                     // output_padding
+      {},                     // output_shape
+      vector<int64_t>{0, 0},  // pads
+      vector<int64_t>{1},     // strides
+      vector<int64_t>{1},     // dilations
+      1,                      // group
+      "NOTSET"                // auto_pad
+  };
+
+  vector<int64_t> X_shape = {1, 2, 3};
+  vector<float> X = {0.1f, 1.0f, 2.0f,
+                     3.0f, 4.0f, 5.0f};
+  vector<int64_t> W_shape = {2, 2, 3};
+  vector<float> W = {1.0f, 2.0f, 3.0f,
+                     4.0f, 5.0f, 6.0f,
+                     6.0f, 5.0f, 4.0f,
+                     3.0f, 2.0f, 1.0f};
+  vector<int64_t> Y_shape = {1, 2, 5};
+  vector<float> expected_vals = {18.1f, 40.2f, 66.3f, 48.f, 26.f,
+                                 9.4f, 22.5f, 39.6f, 30.f, 17.f};
+
+  TestConvTransposeFp16Op(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
+}
+
+TEST(ConvTransposeFp16Test, ConvTranspose_2D_Bias) {
+  ConvTransposeFp16OpAttributes attrs = {
+      vector<int64_t>{3, 3},        // kernel_shape
+      vector<int64_t>{0, 0},        // output_padding
+      {},                           // output_shape
+      vector<int64_t>{1, 1, 1, 1},  // pads
+      vector<int64_t>{1, 1},        // strides
+      vector<int64_t>{1, 1},        // dilations
+      1,                            // group
+      "NOTSET"                      // auto_pad
+  };
+  vector<float> X = {0.22572887f, -0.07105902f, -0.40399021f, -0.14461157f, 0.05367219f,
+                     -0.08353302f, 0.41023391f, 0.42745841f, -0.3769345f, -0.42057109f,
+                     -0.1372498f, 0.05485916f, 0.34602994f, -0.06402895f, -0.06000063f,
+                     0.07891446f, -0.09410021f, 0.26251942f, -0.11043271f, 0.47966552f,
+                     0.34682763f, -0.04511502f, 0.22414422f, 0.24618894f, -0.21480265f};
+  vector<int64_t> X_shape = {1, 1, 5, 5};
+  vector<float> W = {-0.0962126f, 0.19827795f, 0.03667754f,
+                     0.36756599f, -0.01076147f, -0.11781135f,
+                     -0.11574665f, -0.38404959f, 0.44403327f};
+  vector<int64_t> W_shape = {1, 1, 3, 3};
+  vector<float> B = {0.04676145f};
+  vector<int64_t> B_shape = {1};
+  vector<int64_t> Y_shape = {1, 1, 5, 5};
+  vector<float> expected_vals = {-0.03781903f, -0.09041066f, 0.14239404f, 0.09704495f, -0.03399426f,
+                                 0.08749044f, 0.35613984f, 0.07240347f, -0.27841991f, -0.00337578f,
+                                 0.07770107f, -0.09561026f, 0.13388641f, 0.30945939f, 0.14015588f,
+                                 0.13079405f, -0.00488365f, -0.06758944f, 0.45621645f, 0.01566098f,
+                                 0.00703105f, 0.12956856f, 0.0103332f, 0.04221053f, -0.21318194f};
+  TestConvTransposeFp16Op(attrs, {X, W, B}, {X_shape, W_shape, B_shape}, expected_vals, Y_shape);
+}
+
+TEST(ConvTransposeFp16Test, ConvTranspose_2D_Group) {
+  ConvTransposeFp16OpAttributes attrs = {
+      vector<int64_t>{1, 1},        // kernel_shape
+      {},                           // output_padding
+      {},                           // output_shape
+      vector<int64_t>{0, 0, 0, 0},  // pads
+      vector<int64_t>{1, 1},        // strides
+      vector<int64_t>{1, 1},        // dilations
+      4,                            // group
+      "NOTSET"                      // auto_pad
+  };
+  vector<float> X = {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f};
+  vector<int64_t> X_shape = {1, 16, 1, 1};
+  vector<float> W = {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f,
+                     16.f, 17.f, 18.f, 19.f, 20.f, 21.f, 22.f, 23.f, 24.f, 25.f, 26.f, 27.f, 28.f, 29.f, 30.f, 31.0f};
+  vector<int64_t> W_shape = {16, 2, 1, 1};
+  vector<int64_t> Y_shape = {1, 8, 1, 1};
+  vector<float> expected_vals = {28.f, 34.f, 252.f, 274.f, 732.f, 770.f, 1468.f, 1522.f};
+  TestConvTransposeFp16Op(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
+}
+
+TEST(ConvTransposeFp16Test, ConvTranspose_2D_Dilation_Group) {
+  ConvTransposeFp16OpAttributes attrs = {
+      vector<int64_t>{2, 2},        // kernel_shape
+      {},                           // output_padding
+      {},                           // output_shape
+      vector<int64_t>{0, 0, 0, 0},  // pads
+      vector<int64_t>{1, 1},        // strides
+      vector<int64_t>{2, 2},        // dilations
+      2,                            // group
+      "NOTSET"                      // auto_pad
+  };
+
+  vector<float> X = {3.0f, 8.0f, 1.0f, 9.0f, 5.0f, 7.0f, 3.0f, 2.0f, 3.0f,
+                     7.0f, 9.0f, 1.0f, 5.0f, 2.0f, 3.0f, 9.0f, 0.0f, 2.0f};
+  vector<int64_t> X_shape = {1, 2, 3, 3};
+  vector<float> W = {9.0f, 3.0f, 1.0f, 2.0f, 3.0f, 7.0f, 0.0f, 8.0f};
+  vector<int64_t> W_shape = {2, 1, 2, 2};
+  vector<int64_t> Y_shape = {1, 2, 5, 5};
+  vector<float> expected_vals = {27.0f, 72.0f, 18.0f, 24.0f, 3.0f,
+                                 81.0f, 45.0f, 90.0f, 15.0f, 21.0f,
+                                 30.0f, 26.0f, 43.0f, 22.0f, 11.0f,
+                                 9.0f, 5.0f, 25.0f, 10.0f, 14.0f,
+                                 3.0f, 2.0f, 9.0f, 4.0f, 6.0f,
+                                 21.0f, 27.0f, 52.0f, 63.0f, 7.0f,
+                                 15.0f, 6.0f, 44.0f, 14.0f, 21.0f,
+                                 27.0f, 0.0f, 125.0f, 72.0f, 22.0f,
+                                 0.0f, 0.0f, 40.0f, 16.0f, 24.0f,
+                                 0.0f, 0.0f, 72.0f, 0.0f, 16.0f};
+
+  TestConvTransposeFp16Op(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
+
+#endif  // MLAS_F16VEC_INTRINSICS_SUPPORTED
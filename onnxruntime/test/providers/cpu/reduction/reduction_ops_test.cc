@@ -10,6 +10,8 @@
 #include "test/providers/provider_test_utils.h"
 #include "test/providers/cpu/reduction/reduction_test_cases.h"
 #include "core/providers/cpu/reduction/reduction_ops.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/util/include/asserts.h"
 #include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
@@ -493,6 +495,70 @@ TEST(ReductionOpTest, ReduceL20DTensor) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
 }
 
+TEST(ReductionOpTest, ReduceL2_KRK) {
+  OpTester test("ReduceL2");
+  test.AddAttribute("axes", std::vector<int64_t>{1});
+  test.AddAttribute("keepdims", (int64_t)1);
+  test.AddInput<float>("data", {3, 2, 2},
+                       {1.0f, 2.0f,
+                        3.0f, 4.0f,
+
+                        5.0f, 6.0f,
+                        7.0f, 8.0f,
+
+                        9.0f, 10.0f,
+                        11.0f, 12.0f});
+  test.AddOutput<float>("reduced", {3, 1, 2},
+                        {3.16227766f, 4.47213595f,
+                         8.60232527f, 10.0f,
+                         14.21267040f, 15.62049935f});
+  test.Run();
+}
+
+TEST(ReductionOpTest, ReduceL2_RK) {
+  OpTester test("ReduceL2");
+  test.AddAttribute("axes", std::vector<int64_t>{0});
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {3, 2},
+                       {1.0f, 2.0f,
+                        3.0f, 4.0f,
+                        5.0f, 6.0f});
+  test.AddOutput<float>("reduced", {2}, {5.91607978f, 7.48331477f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
+TEST(ReductionOpTest, ReduceL1_RK) {
+  OpTester test("ReduceL1");
+  test.AddAttribute("axes", std::vector<int64_t>{0});
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {3, 2},
+                       {-1.0f, 2.0f,
+                        -3.0f, 4.0f,
+                        -5.0f, 6.0f});
+  test.AddOutput<float>("reduced", {2}, {9.0f, 12.0f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
+TEST(ReductionOpTest, ReduceSumSquare_KRK) {
+  OpTester test("ReduceSumSquare");
+  test.AddAttribute("axes", std::vector<int64_t>{1});
+  test.AddAttribute("keepdims", (int64_t)0);
+  test.AddInput<float>("data", {3, 2, 2},
+                       {1.0f, 2.0f,
+                        3.0f, 4.0f,
+
+                        5.0f, 6.0f,
+                        7.0f, 8.0f,
+
+                        9.0f, 10.0f,
+                        11.0f, 12.0f});
+  test.AddOutput<float>("reduced", {3, 2},
+                        {10.0f, 20.0f,
+                         74.0f, 100.0f,
+                         202.0f, 244.0f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
 TEST(ReductionOpTest, ReduceLogSum) {
   OpTester test("ReduceLogSum");
   test.AddAttribute("axes", std::vector<int64_t>{1});
@@ -1498,6 +1564,62 @@ TEST(ReductionOpTest, ReduceMean_default_axes_do_not_keep_dims) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: full reduce without keepDimensions is not supported with explicit batch
 }
 
+TEST(ReductionOpTest, ReduceMean_default_axes_large) {
+  // Large enough to exercise the chunked parallel reduction over all axes.
+  // The values cycle over small integers so every chunk sum is exact in float
+  // regardless of how the input is split.
+  constexpr int64_t m = 64;
+  constexpr int64_t n = 1024;
+  std::vector<float> X(m * n);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>(static_cast<int64_t>(i % 8)) - 3.0f;
+  }
+
+  OpTester test("ReduceMean");
+  test.AddAttribute("keepdims", static_cast<int64_t>(0));
+  test.AddInput<float>("data", {m, n}, X);
+  test.AddOutput<float>("reduced", {}, {0.5f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: full reduce without keepDimensions is not supported with explicit batch
+}
+
+TEST(ReductionOpTest, ReduceMax_default_axes_large) {
+  // Large enough to exercise the chunked parallel reduction over all axes.
+  constexpr int64_t m = 64;
+  constexpr int64_t n = 1024;
+  std::vector<float> X(m * n);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>(static_cast<int64_t>(i % 251));
+  }
+  X[X.size() / 2] = 1000.0f;
+
+  OpTester test("ReduceMax");
+  test.AddAttribute("keepdims", static_cast<int64_t>(0));
+  test.AddInput<float>("data", {m, n}, X);
+  test.AddOutput<float>("reduced", {}, {1000.0f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: full reduce without keepDimensions is not supported with explicit batch
+}
+
+TEST(ReductionOpTest, ReduceSum_default_axes_deterministic_compute) {
+  // Exercises the deterministic chunking of the all-axes parallel reduction, where the
+  // chunk count is independent of the intra-op thread count. The values cycle over small
+  // integers so every chunk sum is exact in float regardless of how the input is split.
+  constexpr int64_t m = 64;
+  constexpr int64_t n = 1024;
+  std::vector<float> X(m * n);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>(static_cast<int64_t>(i % 8)) - 3.0f;
+  }
+
+  SessionOptions so;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigUseDeterministicCompute, "1"));
+
+  OpTester test("ReduceSum");
+  test.AddAttribute("keepdims", static_cast<int64_t>(0));
+  test.AddInput<float>("data", {m, n}, X);
+  test.AddOutput<float>("reduced", {}, {static_cast<float>(m * n) * 0.5f});
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: full reduce without keepDimensions is not supported with explicit batch
+}
+
 #ifdef USE_DNNL
 TEST(ReductionOpTest, ReduceMean_default_axes_do_not_keep_dims_bfloat16) {
 #ifdef USE_DNNL
@@ -3145,6 +3267,38 @@ TEST(ReductionOpTest, ArgMax_do_not_keepdims_2) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});  // TensorRT: node1: at least 2 dimensions are required for input
 }
 
+TEST(ReductionOpTest, ArgMax_large_vector) {
+  // Large enough to take the vectorized reduce-then-scan path. The maximum appears twice and
+  // the first occurrence must win, as in the scalar comparison loop.
+  constexpr int64_t n = 250000;
+  std::vector<float> data(n);
+  for (int64_t i = 0; i < n; ++i)
+    data[static_cast<size_t>(i)] = std::sin(static_cast<float>(i));
+  data[100000] = 2.0f;
+  data[200000] = 2.0f;
+  OpTester test("ArgMax");
+  test.AddAttribute("axis", (int64_t)0);
+  test.AddAttribute("keepdims", (int64_t)1);
+  test.AddInput<float>("data", {n}, data);
+  test.AddOutput<int64_t>("reduced", {1}, {100000});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
+TEST(ReductionOpTest, ArgMin_large_vector) {
+  constexpr int64_t n = 250000;
+  std::vector<float> data(n);
+  for (int64_t i = 0; i < n; ++i)
+    data[static_cast<size_t>(i)] = std::sin(static_cast<float>(i));
+  data[100000] = -2.0f;
+  data[200000] = -2.0f;
+  OpTester test("ArgMin");
+  test.AddAttribute("axis", (int64_t)0);
+  test.AddAttribute("keepdims", (int64_t)1);
+  test.AddInput<float>("data", {n}, data);
+  test.AddOutput<int64_t>("reduced", {1}, {100000});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
 TEST(ReductionOpTest, ArgMax_int32) {
   OpTester test("ArgMax");
   test.AddAttribute("axis", (int64_t)1);
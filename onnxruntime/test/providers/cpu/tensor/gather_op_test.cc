@@ -369,6 +369,37 @@ TEST(GatherOpTest, Gather_perf) {
   test.Run();
 }
 
+TEST(GatherOpTest, Gather_axis0_large_indices) {
+  // enough indices to exercise the prefetch-pipelined row copy path, with a mix of
+  // positive and negative index values
+  OpTester test("Gather");
+  test.AddAttribute<int64_t>("axis", 0LL);
+
+  constexpr int64_t num_rows = 512;
+  constexpr int64_t row_size = 8;
+  constexpr int64_t num_indices = 100;
+
+  std::vector<float> input(num_rows * row_size);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<float>(i);
+  }
+
+  std::vector<int64_t> indices(num_indices);
+  std::vector<float> output(num_indices * row_size);
+  for (int64_t i = 0; i < num_indices; ++i) {
+    const int64_t row = (i * 37) % num_rows;
+    indices[static_cast<size_t>(i)] = (i % 3 == 0) ? row - num_rows : row;
+    for (int64_t j = 0; j < row_size; ++j) {
+      output[static_cast<size_t>(i * row_size + j)] = static_cast<float>(row * row_size + j);
+    }
+  }
+
+  test.AddInput<float>("data", {num_rows, row_size}, input);
+  test.AddInput<int64_t>("indices", {num_indices}, indices);
+  test.AddOutput<float>("output", {num_indices, row_size}, output);
+  test.Run();
+}
+
 TEST(GatherOpTest, Gather_axis1_neg_indices2d_int8) {
   OpTester test("Gather", 11);
   test.AddAttribute<int64_t>("axis", 1LL);
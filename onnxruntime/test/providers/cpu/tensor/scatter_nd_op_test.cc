@@ -235,5 +235,35 @@ TEST(ScatterNDOpTest, ScatterND_18_max) {
   test1.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
 }
 
+// Many updates aimed at few rows: large enough to take the parallel reduction path on the
+// CPU EP, which must combine duplicate indices in order rather than racing on them.
+TEST(ScatterNDOpTest, ScatterND_18_add_many_duplicate_indices) {
+  constexpr int64_t num_rows = 4;
+  constexpr int64_t row_size = 2;
+  constexpr int64_t num_updates = 256;
+
+  std::vector<float> data(num_rows * row_size, 1.0f);
+  std::vector<int64_t> indices(num_updates);
+  std::vector<float> updates(num_updates * row_size);
+  std::vector<float> output(data);
+  for (int64_t i = 0; i < num_updates; ++i) {
+    const int64_t row = i % num_rows;
+    indices[i] = row;
+    for (int64_t j = 0; j < row_size; ++j) {
+      const float value = static_cast<float>(i * row_size + j);
+      updates[i * row_size + j] = value;
+      output[row * row_size + j] += value;
+    }
+  }
+
+  OpTester test1("ScatterND", 18);
+  test1.AddAttribute("reduction", "add");
+  test1.AddInput<float>("data", {num_rows, row_size}, data);
+  test1.AddInput<int64_t>("indices", {num_updates, 1}, indices);
+  test1.AddInput<float>("updates", {num_updates, row_size}, updates);
+  test1.AddOutput<float>("output", {num_rows, row_size}, output);
+  test1.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -6,6 +6,10 @@
 #include "test/providers/provider_test_utils.h"
 #include "test/util/include/default_providers.h"
 
+#ifdef ENABLE_STRIDED_TENSORS
+#include "test/providers/kernel_compute_test_utils.h"
+#endif
+
 namespace onnxruntime {
 namespace test {
 
@@ -761,5 +765,35 @@ TEST(SliceTest, CoalesceDims) {
   RunSliceTest<float>({1, 1, 1}, {1.f}, {0}, {std::numeric_limits<int64_t>::max()}, {1}, {}, {1, 1, 1}, {1.f}, true);
 }
 
+#ifdef ENABLE_STRIDED_TENSORS
+// When the allocation planner shares the input's buffer with the output (see MayStridedOutput in
+// the kernel def), the CPU kernel produces a strided view instead of copying. The expected values
+// given to AddOutput are the underlying storage the view addresses, starting at its first element.
+TEST(SliceTest, StridedOutput) {
+  // Whole rows: the view keeps the input's strides and selects the block through a byte offset.
+  {
+    KernelComputeTester test("Slice", kCpuExecutionProvider);
+    test.AddInput<float>("data", {4, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+    test.AddInput<int64_t>("starts", {1}, {1}, {}, true);
+    test.AddInput<int64_t>("ends", {1}, {3}, {}, true);
+    test.AddInput<int64_t>("axes", {1}, {0}, {}, true);
+    test.AddOutput<float>("output", {2, 2}, {3.f, 4.f, 5.f, 6.f}, {2, 1});
+    test.Run({0});
+  }
+
+  // A step along the last axis scales the view's stride.
+  {
+    KernelComputeTester test("Slice", kCpuExecutionProvider);
+    test.AddInput<float>("data", {2, 4}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+    test.AddInput<int64_t>("starts", {1}, {0}, {}, true);
+    test.AddInput<int64_t>("ends", {1}, {4}, {}, true);
+    test.AddInput<int64_t>("axes", {1}, {1}, {}, true);
+    test.AddInput<int64_t>("steps", {1}, {2}, {}, true);
+    test.AddOutput<float>("output", {2, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f}, {4, 2});
+    test.Run({0});
+  }
+}
+#endif
+
 }  // namespace test
 }  // namespace onnxruntime
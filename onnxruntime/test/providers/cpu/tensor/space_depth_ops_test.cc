@@ -71,6 +71,38 @@ TEST(TensorOpTest, SpaceToDepthTest_1_double) {
   test.AddOutput<double>("output", {N, C * blocksize * blocksize, H / blocksize, W / blocksize}, result);
   test.Run();
 }
+
+TEST(TensorOpTest, SpaceToDepthTest_1_uint8) {
+  OpTester test("SpaceToDepth");
+  constexpr int64_t blocksize = 2;
+  test.AddAttribute("blocksize", blocksize);
+  constexpr int64_t N = 1, C = 2, H = 2, W = 4;
+  const std::vector<uint8_t> X =
+      {0, 1, 2, 3,
+       10, 11, 12, 13,
+
+       20, 21, 22, 23,
+       30, 31, 32, 33};
+
+  test.AddInput<uint8_t>("input", {N, C, H, W}, X);
+
+  const std::vector<uint8_t> result = {
+      0, 2,
+      20, 22,
+
+      1, 3,
+      21, 23,
+
+      10, 12,
+      30, 32,
+
+      11, 13,
+      31, 33};
+
+  test.AddOutput<uint8_t>("output", {N, C * blocksize * blocksize, H / blocksize, W / blocksize}, result);
+  test.Run();
+}
+
 TEST(TensorOpTest, SpaceToDepthTest_2) {
   OpTester test("SpaceToDepth");
   constexpr int64_t blocksize = 3;
@@ -216,6 +248,38 @@ TEST(TensorOpTest, DepthToSpaceTest_1_double) {
   test.AddOutput<double>("output", {N, C / (blocksize * blocksize), H * blocksize, W * blocksize}, result);
   test.Run();
 }
+
+TEST(TensorOpTest, DepthToSpaceTest_1_int8) {
+  OpTester test("DepthToSpace", 7);  // create an opset 7 model
+  constexpr int64_t blocksize = 2;
+  test.AddAttribute("blocksize", blocksize);
+
+  constexpr int64_t N = 1, C = 8, H = 1, W = 2;
+  const std::vector<int8_t> X = {
+      0, 2,
+      20, 22,
+
+      1, 3,
+      21, 23,
+
+      10, 12,
+      30, 32,
+
+      11, 13,
+      31, 33};
+
+  test.AddInput<int8_t>("input", {N, C, H, W}, X);
+
+  const std::vector<int8_t> result =
+      {0, 1, 2, 3,
+       10, 11, 12, 13,
+
+       20, 21, 22, 23,
+       30, 31, 32, 33};
+  test.AddOutput<int8_t>("output", {N, C / (blocksize * blocksize), H * blocksize, W * blocksize}, result);
+  test.Run();
+}
+
 TEST(TensorOpTest, DepthToSpaceTest_2) {
   OpTester test("DepthToSpace", 7);  // create an opset 7 model
   constexpr int64_t blocksize = 2;
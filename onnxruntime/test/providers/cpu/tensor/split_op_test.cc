@@ -5,6 +5,10 @@
 #include "core/framework/to_tensor_proto_element_type.h"
 #include "test/providers/provider_test_utils.h"
 
+#ifdef ENABLE_STRIDED_TENSORS
+#include "test/providers/kernel_compute_test_utils.h"
+#endif
+
 namespace onnxruntime {
 namespace test {
 
@@ -815,5 +819,18 @@ TEST(SplitOperatorTest, Split18_NumOutputsUnevenSplitAxis1) {
   RunTest<float>(axis, {}, input, outputs, {kTensorrtExecutionProvider, kQnnExecutionProvider}, false, true, num_outputs, false);
 }
 
+#ifdef ENABLE_STRIDED_TENSORS
+// When the allocation planner shares the input's buffer with the outputs (see MayStridedOutput in
+// the kernel def), each chunk becomes a view carrying the input's strides plus a byte offset.
+TEST(SplitOperatorTest, StridedOutputs) {
+  KernelComputeTester test("Split", kCpuExecutionProvider);
+  test.AddAttribute<int64_t>("axis", 0);
+  test.AddInput<float>("input", {4, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+  test.AddOutput<float>("output_1", {2, 2}, {1.f, 2.f, 3.f, 4.f}, {2, 1});
+  test.AddOutput<float>("output_2", {2, 2}, {5.f, 6.f, 7.f, 8.f}, {2, 1});
+  test.Run({0, 1});
+}
+#endif
+
 }  // namespace test
 }  // namespace onnxruntime
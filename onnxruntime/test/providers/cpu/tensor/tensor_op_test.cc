@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "gtest/gtest.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/common/dnnl_op_test_utils.h"
 #include "test/common/tensor_op_test_utils.h"
@@ -71,6 +72,20 @@ TEST(TensorOpTest, ReshapeWithEmptyInputAndDynamicShape) {
   }
 }
 
+TEST(TensorOpTest, ReshapeWithShapeMemo) {
+  // with the symbolic shape memo enabled the kernel picks its output shape up from the per shape-signature
+  // cache instead of reading the shape tensor. output must be identical to the default path.
+  OpTester test("Reshape");
+
+  test.AddInput<float>("data", {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  test.AddInput<int64_t>("shape", {3}, {-1, 0, 2}, true);
+  test.AddOutput<float>("reshaped", {1, 3, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+
+  SessionOptions so;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsEnableShapeMemo, "1"));
+  test.Run(so, OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
 TEST(TensorOpTest, ReshapeWithInitializer) {
   OpTester test("Reshape");
 
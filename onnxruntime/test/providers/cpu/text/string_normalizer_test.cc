@@ -194,6 +194,28 @@ TEST(ContribOpTest, StringNormalizerInsensitiveFilterOutUpperWithLocale) {
   test.Run(OpTester::ExpectResult::kExpectSuccess);
 }
 
+TEST(ContribOpTest, StringNormalizerInsensitiveFilterMixedCaseLower) {
+  // - case-INSENSITIVE filtering with mixed-case ASCII input and a mixed-case stopword,
+  //   exercising the bytewise ASCII path alongside non-ASCII strings that take the
+  //   wide-char path
+
+  OpTester test("StringNormalizer", opset_ver, domain);
+  InitTestAttr(test, "LOWER", false, {"Monday"}, test_locale);
+  std::vector<int64_t> dims{5};
+  std::vector<std::string> input = {"MONDAY",
+                                    "monday",
+                                    "TuesDay",
+                                    "Besançon",
+                                    "École élémentaire"};
+  test.AddInput<std::string>("T", dims, input);
+
+  std::vector<std::string> output = {"tuesday",
+                                     "besançon",
+                                     "école élémentaire"};
+  test.AddOutput<std::string>("Y", {3}, output);
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
 TEST(ContribOpTest, StringNormalizerSensitiveFilterOutUpperEmptyCase) {
   // Empty output case
   // - casesensitive approach
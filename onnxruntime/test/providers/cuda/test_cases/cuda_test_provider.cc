@@ -82,6 +82,15 @@ struct ProviderInfo_CUDA_TestImpl : ProviderInfo_CUDA {
 
   int cudaGetDeviceCount() override { return 0; }
 
+  Status GetDeviceCapacities(std::vector<CudaDeviceCapacity>& capacities) override {
+    capacities.clear();
+    return Status::OK();
+  }
+
+  Status MakeStreamWaitOnDefaultStream(void*) override {
+    return Status::OK();
+  }
+
   void CUDAExecutionProviderInfo__FromProviderOptions(const ProviderOptions&, CUDAExecutionProviderInfo&) override {}
 
 #if defined(USE_CUDA) && defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P) && defined(ENABLE_TRAINING)
@@ -75,9 +75,19 @@ class KernelComputeTester {
     OrtValue value;
     TensorShape shape(dims);
     auto allocator = AllocatorManager::Instance().GetAllocator(CPU);
-    Tensor::InitOrtValue(DataTypeImpl::GetType<T>(), shape, std::move(allocator), value);
-
-    if (!strides.empty()) {
+    if (strides.empty()) {
+      Tensor::InitOrtValue(DataTypeImpl::GetType<T>(), shape, std::move(allocator), value);
+    } else {
+      // A strided tensor's storage extent may differ from shape.Size() in either direction (e.g.
+      // a broadcast view needs fewer elements, a view skipping elements needs more), so allocate
+      // based on the strides.
+      int64_t storage_size = shape.Size() == 0 ? 0 : 1;
+      if (storage_size > 0) {
+        for (size_t dim = 0; dim < dims.size(); ++dim) {
+          storage_size += (dims[dim] - 1) * strides[dim];
+        }
+      }
+      Tensor::InitOrtValue(DataTypeImpl::GetType<T>(), TensorShape({storage_size}), std::move(allocator), value);
       value.GetMutable<Tensor>()->SetShapeAndStrides(shape, strides);
     }
 
@@ -389,6 +389,23 @@ TEST(XnnpackEP, TestQDQSoftMax_axisLast) {
                {ExpectedEPNodeAssignment::All});
 }
 
+TEST(XnnpackEP, TestElementwiseAddMulWithBroadcast) {
+  const std::vector<int64_t> input_shape = {2, 3, 8};
+  const std::vector<int64_t> bias_shape = {8};
+  auto modelCreater = [input_shape, bias_shape](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>(input_shape, -1.f, 1.f);
+    auto* bias_arg = builder.MakeInput<float>(bias_shape, -1.f, 1.f);
+    auto* add_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("Add", {input_arg, bias_arg}, {add_out});
+    builder.AddNode("Mul", {add_out, bias_arg}, {output_arg});
+  };
+  RunModelTest(modelCreater,
+               "xnnpack_test_graph_add_mul",
+               {ExpectedEPNodeAssignment::All});
+}
+
 TEST(XnnpackEP, TestConvTranspose) {
   // Conv+ConvTranspose with attributes of Group and Dilation
   const ORTCHAR_T* ort_model_path = ORT_MODEL_FOLDER "test_conv_follow_convtrans.onnx";
@@ -270,7 +270,12 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
       transformers.emplace_back(std::make_unique<FreeDimensionOverrideTransformer>(free_dimension_overrides));
       transformers.emplace_back(std::make_unique<MatmulTransposeFusion>(cuda_rocm_execution_providers));
       transformers.emplace_back(std::make_unique<BiasDropoutFusion>(cuda_rocm_execution_providers));
-      transformers.emplace_back(std::make_unique<BitmaskDropoutReplacement>(cuda_rocm_execution_providers));
+      // CPU has BitmaskDropout/BitmaskDropoutGrad kernels too; BiasDropout never lands on CPU so
+      // only plain Dropout pairs are rewritten there.
+      InlinedHashSet<std::string_view> bitmask_dropout_execution_providers = {onnxruntime::kCudaExecutionProvider,
+                                                                              onnxruntime::kRocmExecutionProvider,
+                                                                              onnxruntime::kCpuExecutionProvider};
+      transformers.emplace_back(std::make_unique<BitmaskDropoutReplacement>(bitmask_dropout_execution_providers));
       transformers.emplace_back(std::make_unique<BiasSoftmaxFusion>(l1_execution_providers));
       InlinedHashSet<std::string> excluded_initializers(weights_to_train.begin(), weights_to_train.end());
       transformers.emplace_back(std::make_unique<MatMulScaleFusion>(l1_execution_providers, excluded_initializers));
@@ -194,6 +194,22 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {19, {}},
             },
         },
+        {
+            // Unfused Gelu exported as Div -> Erf -> Add -> Mul decompositions are cheap to recompute.
+            utils::GetFullQualifiedOpName("Erf", kOnnxDomain),
+            {
+                {9, {}},
+                {13, {}},
+            },
+        },
+        {
+            utils::GetFullQualifiedOpName("Exp", kOnnxDomain),
+            {
+                {1, {}},
+                {6, {}},
+                {13, {}},
+            },
+        },
         {
             utils::GetFullQualifiedOpName("Expand", kOnnxDomain),
             {
@@ -253,6 +269,14 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {13, {}},
             },
         },
+        {
+            utils::GetFullQualifiedOpName("Log", kOnnxDomain),
+            {
+                {1, {}},
+                {6, {}},
+                {13, {}},
+            },
+        },
         {
             utils::GetFullQualifiedOpName("MemcpyFromHost", kOnnxDomain),
             {
@@ -290,6 +314,17 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {1, {1, 2}},  // ignore the indices and unflatten_dims
             },
         },
+        {
+            // The tanh approximation of Gelu is exported as Pow -> Mul -> Add -> Tanh -> ... chains.
+            utils::GetFullQualifiedOpName("Pow", kOnnxDomain),
+            {
+                {1, {}},
+                {7, {}},
+                {12, {}},
+                {13, {}},
+                {15, {}},
+            },
+        },
         {
             // Be noted, NOT all PythonOp will be allowed to recompute, there will be further check.
             utils::GetFullQualifiedOpName("PythonOp", kMSDomain),
@@ -303,6 +338,15 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {11, {0, 1, 2}},  // ignore start, end, delta, because they are scalars.
             },
         },
+        {
+            utils::GetFullQualifiedOpName("Relu", kOnnxDomain),
+            {
+                {1, {}},
+                {6, {}},
+                {13, {}},
+                {14, {}},
+            },
+        },
         {
             utils::GetFullQualifiedOpName("Reshape", kOnnxDomain),
             {
@@ -313,6 +357,14 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {19, {}},
             },
         },
+        {
+            utils::GetFullQualifiedOpName("Sigmoid", kOnnxDomain),
+            {
+                {1, {}},
+                {6, {}},
+                {13, {}},
+            },
+        },
         {
             utils::GetFullQualifiedOpName("Sin", kOnnxDomain),
             {
@@ -338,6 +390,14 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {18, {1}},
             },
         },
+        {
+            utils::GetFullQualifiedOpName("Sqrt", kOnnxDomain),
+            {
+                {1, {}},
+                {6, {}},
+                {13, {}},
+            },
+        },
         {
             utils::GetFullQualifiedOpName("Squeeze", kOnnxDomain),
             {
@@ -356,6 +416,14 @@ const InlinedHashMap<std::string, OpsetToIgnorableIndicesMap>& GetAllowedRecompu
                 {14, {}},
             },
         },
+        {
+            utils::GetFullQualifiedOpName("Tanh", kOnnxDomain),
+            {
+                {1, {}},
+                {6, {}},
+                {13, {}},
+            },
+        },
         {
             utils::GetFullQualifiedOpName("Tile", kOnnxDomain),
             {
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "orttraining/training_ops/cpu/nn/dropout_op.h"
+#include "contrib_ops/cpu/math/bitmask_dropout.h"
 #include "core/providers/cpu/nn/dropout_op.h"
 #include <chrono>
 #include <random>
@@ -68,6 +69,27 @@ REGISTER_GRADIENT_KERNEL_TYPED(DropoutGrad, double, MLFloat16)
 REGISTER_GRADIENT_KERNEL_TYPED(DropoutGrad, double, float)
 REGISTER_GRADIENT_KERNEL_TYPED(DropoutGrad, double, double)
 
+#define REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(T1, T2)                                \
+  ONNX_OPERATOR_TYPED_KERNEL_EX(                                                      \
+      BitmaskDropoutGrad,                                                             \
+      kMSDomain,                                                                      \
+      1,                                                                              \
+      T1##_##T2,                                                                      \
+      kCpuExecutionProvider,                                                          \
+      KernelDefBuilder()                                                              \
+          .TypeConstraint("T", DataTypeImpl::GetTensorType<T1>())                     \
+          .TypeConstraint("T1", DataTypeImpl::GetTensorType<T2>())                    \
+          .TypeConstraint("T2", DataTypeImpl::GetTensorType<bool>())                  \
+          .TypeConstraint("T3", DataTypeImpl::GetTensorType<BitmaskElementType>()),   \
+      BitmaskDropoutGrad<T1, T2>);
+
+REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(float, MLFloat16)
+REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(float, float)
+REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(float, double)
+REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(double, MLFloat16)
+REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(double, float)
+REGISTER_BITMASK_GRADIENT_KERNEL_TYPED(double, double)
+
 template <typename T1, typename T2>
 Status DropoutGrad<T1, T2>::Compute(OpKernelContext* context) const {
   const Tensor* dY = context->Input<Tensor>(0);
@@ -97,5 +119,37 @@ Status DropoutGrad<T1, T2>::Compute(OpKernelContext* context) const {
 
   return Status::OK();
 }
+
+template <typename T1, typename T2>
+Status BitmaskDropoutGrad<T1, T2>::Compute(OpKernelContext* context) const {
+  const Tensor* dY = context->Input<Tensor>(0);
+  auto dY_span = dY->DataAsSpan<T1>();
+  const auto& dY_shape = dY->Shape();
+  const int64_t N = dY_shape.Size();
+  const Tensor* mask = context->Input<Tensor>(1);
+  ORT_ENFORCE(mask->Shape().Size() == (N + kNumBitsPerBitmaskElement - 1) / kNumBitsPerBitmaskElement,
+              "mask should hold one bit per dY element");
+  const Tensor* ratio = context->Input<Tensor>(2);  // optional
+  const float ratio_value = GetRatioOrDefault<T2>(ratio);
+  Tensor* dX = context->Output(0, dY_shape);
+  auto dX_span = dX->MutableDataAsSpan<T1>();
+
+  if (ratio_value == 0.0f) {
+    if (dY_span.data() != dX_span.data()) {
+      std::copy(dY_span.begin(), dY_span.end(), dX_span.begin());
+    }
+    return Status::OK();
+  }
+
+  const BitmaskElementType* mask_data = mask->Data<BitmaskElementType>();
+  const T1 keep_prob = static_cast<T1>(1.0f - ratio_value);
+  for (int64_t i = 0; i < N; ++i) {
+    const bool keep =
+        ((mask_data[i / kNumBitsPerBitmaskElement] >> (i % kNumBitsPerBitmaskElement)) & 1) != 0;
+    dX_span[static_cast<size_t>(i)] = keep ? dY_span[static_cast<size_t>(i)] / keep_prob : T1{};
+  }
+
+  return Status::OK();
+}
 }  // namespace contrib
 }  // namespace onnxruntime
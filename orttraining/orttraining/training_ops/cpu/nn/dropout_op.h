@@ -18,5 +18,15 @@ class DropoutGrad final : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 };
 
+// Same as DropoutGrad, but consumes the bit-packed uint32 mask produced by BitmaskDropout.
+template <typename T1, typename T2>
+class BitmaskDropoutGrad final : public OpKernel {
+ public:
+  BitmaskDropoutGrad(const OpKernelInfo& info) : OpKernel{info} {
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
 }  // namespace contrib
 }  // namespace onnxruntime